@@ -0,0 +1,356 @@
+/**
+ * @file   benchmark/sbnobj_io_benchmark.cc
+ * @brief  Measures ROOT I/O cost of a selection of `sbnobj` data products.
+ *
+ * Usage:
+ *
+ *     sbnobj_io_benchmark [events]
+ *
+ * For each product, a synthetic but realistically sized event payload is
+ * written `events` times (default: 100) into a tree in a memory-resident ROOT
+ * file, once with no compression and once with the default ROOT compression,
+ * and then read back.
+ * The reported figures are:
+ * * write and read throughput, in MB/s of uncompressed (streamed) data;
+ * * uncompressed and compressed size per event, as counted by the tree;
+ * * number of heap allocations per object, during write and during read.
+ *
+ * The branches are written with the same default split level used by _art_
+ * (99), so the layout matches the one of the product branches in _art_ files.
+ * The dictionaries are loaded by ROOT via the rootmap files; a product whose
+ * dictionary can't be found is reported and skipped.
+ *
+ * This is a tool to be run by hand, and it is not part of the tests.
+ */
+
+// SBN libraries
+#include "sbnobj/ICARUS/TPC/ChannelROI.h"
+#include "sbnobj/ICARUS/PMT/Trigger/Data/OpticalTriggerGate.h"
+#include "sbnobj/Common/CRT/CRTHit.hh"
+#include "sbnobj/Common/SBNEventWeight/EventWeightMap.h"
+#include "sbnobj/Common/Calibration/TrackCaloSkimmerObj.h"
+#include "sbnobj/Common/POTAccounting/BNBSpillInfo.h"
+
+// ROOT libraries
+#include "TClass.h"
+#include "TMemFile.h"
+#include "TTree.h"
+
+// C/C++ standard libraries
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib> // std::malloc(), std::free()
+#include <new>
+#include <random>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+
+// -----------------------------------------------------------------------------
+// --- allocation counting
+// -----------------------------------------------------------------------------
+namespace {
+  std::atomic<std::size_t> gAllocations { 0 };
+}
+
+void* operator new(std::size_t size) {
+  ++gAllocations;
+  if (void* p = std::malloc(size? size: 1)) return p;
+  throw std::bad_alloc{};
+}
+// GCC can't tell that the replaced `operator new` also allocates via `malloc()`
+#if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 11)
+#  pragma GCC diagnostic push
+#  pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+#if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 11)
+#  pragma GCC diagnostic pop
+#endif
+
+
+// -----------------------------------------------------------------------------
+// --- synthetic payloads
+// -----------------------------------------------------------------------------
+namespace {
+
+  using RandomEngine_t = std::mt19937;
+
+  /// A TPC readout: 500 channels, each with three 40-tick regions of interest.
+  std::vector<recob::ChannelROI> makeChannelROIs(RandomEngine_t& engine) {
+    std::normal_distribution<float> adc { 0.0f, 8.0f };
+    std::vector<recob::ChannelROI> rois;
+    rois.reserve(500);
+    for (raw::ChannelID_t channel = 0; channel < 500; ++channel) {
+      recob::ChannelROI::RegionsOfInterest_t signal;
+      signal.resize(4096);
+      for (std::size_t const start: { 300U, 1700U, 3100U }) {
+        std::vector<short int> samples(40);
+        for (short int& sample: samples)
+          sample = static_cast<short int>(adc(engine));
+        signal.add_range(start + channel % 64, samples.begin(), samples.end());
+      }
+      rois.emplace_back(std::move(signal), channel);
+    }
+    return rois;
+  } // makeChannelROIs()
+
+
+  /// PMT trigger gates: 360 channels, each with a few tens of openings.
+  std::vector<icarus::trigger::OpticalTriggerGateData_t> makeTriggerGates
+    (RandomEngine_t& engine)
+  {
+    using Gate_t = icarus::trigger::OpticalTriggerGate;
+    std::uniform_int_distribution<Gate_t::ClockTick_t> start { 0, 250'000 };
+    std::uniform_int_distribution<Gate_t::ClockTick_t> width { 5, 80 };
+    std::vector<icarus::trigger::OpticalTriggerGateData_t> gates;
+    gates.reserve(360);
+    for (Gate_t::ChannelID_t channel = 0; channel < 360; ++channel) {
+      Gate_t gate { channel };
+      for (int i = 0; i < 30; ++i) {
+        Gate_t::ClockTick_t const tick = start(engine);
+        gate.openBetween(tick, tick + width(engine));
+      }
+      gates.push_back(std::move(gate.gateLevels()));
+    }
+    return gates;
+  } // makeTriggerGates()
+
+
+  /// CRT hits: 200 hits from two FEB each, 4 channels with signal per FEB.
+  std::vector<sbn::crt::CRTHit> makeCRTHits(RandomEngine_t& engine) {
+    std::uniform_real_distribution<float> pos { -500.0f, 500.0f };
+    std::exponential_distribution<float> pe { 0.05f };
+    std::vector<sbn::crt::CRTHit> hits(200);
+    std::uint64_t ts = 1'600'000'000ULL;
+    for (sbn::crt::CRTHit& hit: hits) {
+      hit.feb_id = { 12, 47 };
+      hit.peshit = 0.0f;
+      for (std::uint8_t const feb: hit.feb_id) {
+        for (int channel = 0; channel < 4; ++channel) {
+          float const signal = pe(engine);
+          hit.addPE(feb, channel * 8, signal);
+          hit.peshit += signal;
+        }
+      }
+      hit.ts0_s = ts;
+      hit.ts0_ns = static_cast<double>((ts += 1'733) % 1'000'000'000);
+      hit.ts1_ns = hit.ts0_ns - 1'500'000.0;
+      hit.x_pos = pos(engine);
+      hit.y_pos = pos(engine);
+      hit.z_pos = pos(engine);
+      hit.x_err = hit.y_err = hit.z_err = 5.0f;
+    }
+    return hits;
+  } // makeCRTHits()
+
+
+  /// Event weights for one interaction: 30 knobs, 500 universes each.
+  std::vector<sbn::evwgh::EventWeightMap> makeEventWeights
+    (RandomEngine_t& engine)
+  {
+    std::lognormal_distribution<float> weight { 0.0f, 0.1f };
+    sbn::evwgh::EventWeightMap weights;
+    for (int knob = 0; knob < 30; ++knob) {
+      std::vector<float>& universes
+        = weights["GENIEReWeight_SBN_v1_multisim_Knob" + std::to_string(knob)];
+      universes.resize(500);
+      for (float& w: universes) w = weight(engine);
+    }
+    return { std::move(weights) };
+  } // makeEventWeights()
+
+
+  /// Calorimetry skim: 5 tracks, 300 hits and 300 wire snippets per plane.
+  std::vector<sbn::TrackInfo> makeTrackInfo(RandomEngine_t& engine) {
+    std::normal_distribution<float> charge { 300.0f, 60.0f };
+    std::normal_distribution<float> adc { 0.0f, 20.0f };
+    auto makeHits = [&](unsigned int plane){
+      std::vector<sbn::TrackHitInfo> hits(300);
+      for (std::size_t i = 0; i < hits.size(); ++i) {
+        sbn::TrackHitInfo& hit = hits[i];
+        hit.h.integral = charge(engine);
+        hit.h.sumadc = hit.h.integral * 0.97f;
+        hit.h.width = 2.5f;
+        hit.h.time = 1000.0f + i * 3.0f;
+        hit.h.id = static_cast<int>(i);
+        hit.h.plane = static_cast<std::uint16_t>(plane);
+        hit.h.wire = static_cast<std::uint16_t>(1000 + i);
+        hit.pitch = 0.3f;
+        hit.dqdx = hit.h.integral / hit.pitch;
+        hit.rr = 0.3f * i;
+        hit.i_snippet = static_cast<std::uint16_t>(i);
+        hit.ontraj = hit.oncalo = true;
+      }
+      return hits;
+    };
+    auto makeWires = [&](unsigned int plane){
+      std::vector<sbn::WireInfo> wires(300);
+      for (std::size_t i = 0; i < wires.size(); ++i) {
+        sbn::WireInfo& wire = wires[i];
+        wire.wire = static_cast<std::uint16_t>(1000 + i);
+        wire.plane = static_cast<std::uint16_t>(plane);
+        wire.tdc0 = static_cast<std::int16_t>(990 + 3 * i);
+        wire.adcs.resize(25);
+        for (short& sample: wire.adcs) sample = static_cast<short>(adc(engine));
+      }
+      return wires;
+    };
+    std::vector<sbn::TrackInfo> tracks(5);
+    for (std::size_t i = 0; i < tracks.size(); ++i) {
+      sbn::TrackInfo& track = tracks[i];
+      track.id = static_cast<int>(i);
+      track.cryostat = 0;
+      track.length = 90.0f;
+      track.hits0 = makeHits(0);
+      track.hits1 = makeHits(1);
+      track.hits2 = makeHits(2);
+      track.wires0 = makeWires(0);
+      track.wires1 = makeWires(1);
+      track.wires2 = makeWires(2);
+    }
+    return tracks;
+  } // makeTrackInfo()
+
+
+  /// Beam information: one spill with its multiwire profiles.
+  std::vector<sbn::BNBSpillInfo> makeSpillInfo(RandomEngine_t& engine) {
+    std::normal_distribution<float> monitor { 1.0f, 0.1f };
+    std::uniform_int_distribution<int> wire { 0, 4096 };
+    sbn::BNBSpillInfo spill;
+    spill.spill_time_s = 1'600'000'000UL;
+    spill.spill_time_ns = 66'000'000UL;
+    spill.event = 1;
+    spill.TOR860 = spill.TOR875 = 4.5f * monitor(engine);
+    spill.LM875A = spill.LM875B = spill.LM875C = monitor(engine);
+    spill.HP875 = spill.VP875 = monitor(engine);
+    spill.HPTG1 = spill.VPTG1 = spill.HPTG2 = spill.VPTG2 = monitor(engine);
+    spill.BTJT2 = 30.0f * monitor(engine);
+    spill.THCURR = 174.0f * monitor(engine);
+    for (std::vector<int>* profile: { &spill.M875BB, &spill.M876BB, &spill.MMBTBB })
+    {
+      profile->resize(48);
+      for (int& w: *profile) w = wire(engine);
+    }
+    return { std::move(spill) };
+  } // makeSpillInfo()
+
+
+  // ---------------------------------------------------------------------------
+  // --- benchmark
+  // ---------------------------------------------------------------------------
+
+  /// Default ROOT compression setting (same as _art_ output default).
+  constexpr int DefaultCompression = 101;
+
+  /// Result of one write/read round.
+  struct Result_t {
+    double writeSeconds = 0.0;
+    double readSeconds = 0.0;
+    Long64_t totBytes = 0;
+    Long64_t zipBytes = 0;
+    std::size_t writeAllocations = 0;
+    std::size_t readAllocations = 0;
+  };
+
+
+  /// Writes `collection` `nEvents` times into a tree, then reads it all back.
+  template <typename Coll>
+  Result_t writeAndRead(Coll const& collection, int nEvents, int compression) {
+    using Clock_t = std::chrono::steady_clock;
+    auto const secondsSince = [](Clock_t::time_point start)
+      { return std::chrono::duration<double>(Clock_t::now() - start).count(); };
+
+    Result_t result;
+
+    TMemFile file { "sbnobj_io_benchmark.root", "RECREATE", "", compression };
+    TTree* tree = new TTree("Events", "I/O benchmark"); // owned by `file`
+
+    Coll buffer { collection };
+    Coll* address = &buffer;
+    tree->Branch("product", &address, 32000, 99);
+
+    std::size_t allocations = gAllocations.load();
+    Clock_t::time_point start = Clock_t::now();
+    for (int iEvent = 0; iEvent < nEvents; ++iEvent) tree->Fill();
+    tree->FlushBaskets();
+    result.writeSeconds = secondsSince(start);
+    result.writeAllocations = gAllocations.load() - allocations;
+    result.totBytes = tree->GetTotBytes();
+    result.zipBytes = tree->GetZipBytes();
+    tree->DropBaskets(); // force reading back from the file
+
+    Coll* read = nullptr;
+    tree->SetBranchAddress("product", &read);
+    allocations = gAllocations.load();
+    start = Clock_t::now();
+    for (Long64_t iEvent = 0; iEvent < nEvents; ++iEvent) {
+      tree->GetEntry(iEvent);
+      read->clear(); // also charge the destruction of the objects
+    }
+    result.readSeconds = secondsSince(start);
+    result.readAllocations = gAllocations.load() - allocations;
+    tree->ResetBranchAddresses();
+    delete read;
+
+    return result;
+  } // writeAndRead()
+
+
+  template <typename Coll>
+  void benchmark
+    (char const* name, Coll const& collection, int nEvents)
+  {
+    TClass const* const cl = TClass::GetClass(typeid(Coll));
+    if (!cl || !cl->HasDictionary()) {
+      std::printf("%-20s  dictionary not found: skipped\n", name);
+      return;
+    }
+
+    double const nObjects
+      = static_cast<double>(collection.size()) * nEvents;
+    for (int const compression: { 0, DefaultCompression }) {
+      Result_t const r = writeAndRead(collection, nEvents, compression);
+      double const MB = r.totBytes / 1e6;
+      std::printf(
+        "%-20s %5d %10.1f %10.1f %12.1f %12.1f %10.2f %10.2f\n",
+        name, compression,
+        MB / r.writeSeconds, MB / r.readSeconds,
+        r.totBytes / 1024.0 / nEvents, r.zipBytes / 1024.0 / nEvents,
+        r.writeAllocations / nObjects, r.readAllocations / nObjects
+        );
+    } // for compression
+  } // benchmark()
+
+} // local namespace
+
+
+// -----------------------------------------------------------------------------
+int main(int argc, char** argv) {
+
+  int const nEvents = (argc > 1)? std::atoi(argv[1]): 100;
+  if (nEvents <= 0) {
+    std::fprintf(stderr, "Usage:  %s [events]\n", argv[0]);
+    return 1;
+  }
+
+  RandomEngine_t engine { 12345 };
+
+  std::printf("%d events per product\n", nEvents);
+  std::printf(
+    "%-20s %5s %10s %10s %12s %12s %10s %10s\n",
+    "product", "comp.", "write MB/s", "read MB/s",
+    "kB/ev (raw)", "kB/ev (zip)", "alloc/w", "alloc/r"
+    );
+  benchmark("recob::ChannelROI", makeChannelROIs(engine), nEvents);
+  benchmark("OpticalTriggerGate", makeTriggerGates(engine), nEvents);
+  benchmark("sbn::crt::CRTHit", makeCRTHits(engine), nEvents);
+  benchmark("EventWeightMap", makeEventWeights(engine), nEvents);
+  benchmark("sbn::TrackInfo", makeTrackInfo(engine), nEvents);
+  benchmark("sbn::BNBSpillInfo", makeSpillInfo(engine), nEvents);
+
+  return 0;
+} // main()
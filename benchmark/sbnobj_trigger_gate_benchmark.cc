@@ -0,0 +1,262 @@
+/**
+ * @file   benchmark/sbnobj_trigger_gate_benchmark.cc
+ * @brief  Measures the cost of the main operations on PMT trigger gates.
+ *
+ * Usage:
+ *
+ *     sbnobj_trigger_gate_benchmark [rounds]
+ *
+ * A set of synthetic PMT-like gates (180 channels, each opening 4 times in
+ * a 3000 tick readout window) is created, and each of the following
+ * operations is repeated `rounds` times (default: 1000):
+ * * `SymmetricCombination`: sum of each gate with the next one, via the
+ *   two-gate `SymmetricCombination()`;
+ * * `Sum(other)`: all the gates summed one at a time into a single gate,
+ *   which is reset at the start of each round; each combination creates a new
+ *   evolution;
+ * * `Sum(other, buffer)`: as above, with the memory of a caller-owned
+ *   `CombinationBuffer` reused by each combination;
+ * * `Multiplicity`: the N-channel sum of all the gates at once;
+ * * `openingCount`: the opening of the multiplicity gate at every tick of the
+ *   readout window, one query at a time;
+ * * `openingCounts`: as above, with all the ticks in a single sorted query;
+ * * `findOpen`: for each opening threshold up to the maximum of the
+ *   multiplicity gate, the opening time searched from every 100th tick;
+ * * `compact()`: compaction of a gate where each opening is followed by
+ *   another one starting where it ends.
+ *
+ * For each operation, the time and the number of heap allocations per
+ * operation are reported.
+ * The results of the operations are accumulated and checked, so that the
+ * compiler can't discard them, and so that `Sum(other)`,
+ * `Sum(other, buffer)` and `Multiplicity` are verified to give the same gate.
+ * A gate from `range().toGate()` is also verified to respond to a further
+ * `openBetween()` like the gate it was copied from.
+ *
+ * Reference figures, from 1000 rounds on an x86-64 Intel Xeon (shared
+ * machine: times vary by up to 30% from run to run, while the allocation
+ * counts are exact), built with `g++ -O2`:
+ *
+ *     operation                         ops      ns/op  allocs/op
+ *     SymmetricCombination           179000      182.9      2.017
+ *     Sum(other)                     180000     4913.0      1.728
+ *     Sum(other, buffer)             180000     4432.2      0.044
+ *     Multiplicity                     1000    52858.7      4.000
+ *     openingCount                  3101000       46.8      0.000
+ *     openingCounts                 3101000        2.4      0.000
+ *     findOpen                       640000       92.7      0.000
+ *     compact()                        1000     2537.8      0.000
+ *
+ * This is a tool to be run by hand, and it is not part of the tests.
+ */
+
+// SBN libraries
+#include "sbnobj/ICARUS/PMT/Trigger/Data/OpticalTriggerGate.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::max()
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib> // std::malloc(), std::free(), std::strtol()
+#include <functional> // std::plus<>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+
+// -----------------------------------------------------------------------------
+// --- allocation counting
+// -----------------------------------------------------------------------------
+namespace {
+  std::atomic<std::size_t> gAllocations { 0 };
+}
+
+void* operator new(std::size_t size) {
+  ++gAllocations;
+  if (void* p = std::malloc(size? size: 1)) return p;
+  throw std::bad_alloc{};
+}
+// GCC can't tell that the replaced `operator new` also allocates via `malloc()`
+#if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 11)
+#  pragma GCC diagnostic push
+#  pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+#if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 11)
+#  pragma GCC diagnostic pop
+#endif
+
+
+// -----------------------------------------------------------------------------
+namespace {
+
+  using Gate_t = icarus::trigger::OpticalTriggerGateData_t;
+  using ClockTick_t = Gate_t::ClockTick_t;
+  using OpeningCount_t = Gate_t::OpeningCount_t;
+
+  using Clock_t = std::chrono::steady_clock;
+
+  double secondsSince(Clock_t::time_point start)
+    { return std::chrono::duration<double>(Clock_t::now() - start).count(); }
+
+  constexpr ClockTick_t NTicks = 3000; ///< Readout window [ticks]
+
+
+  /// Returns `nGates` gates, each opening `nOpenings` times in `nTicks`.
+  /// If `chained`, each opening is followed by one starting where it ends.
+  std::vector<Gate_t> makePMTGates(
+    unsigned int nGates, unsigned int nOpenings, ClockTick_t nTicks,
+    bool chained = false
+  ) {
+    std::mt19937 engine { 12345 };
+    std::uniform_int_distribution<ClockTick_t> start { 0, nTicks };
+    std::uniform_int_distribution<ClockTick_t> width { 5, 80 };
+
+    std::vector<Gate_t> gates(nGates);
+    for (Gate_t& gate: gates) {
+      for (unsigned int i = 0; i < nOpenings; ++i) {
+        ClockTick_t const tick = start(engine);
+        ClockTick_t const end = tick + width(engine);
+        gate.openBetween(tick, end);
+        if (chained) gate.openBetween(end, end + width(engine));
+      }
+      if (!chained) gate.compact();
+    }
+    return gates;
+  } // makePMTGates()
+
+
+  /// Prints the cost of `nOps` operations run by `run()`.
+  template <typename Run>
+  void measure(std::string const& name, std::size_t nOps, Run run) {
+    std::size_t const startAllocations = gAllocations;
+    Clock_t::time_point const start = Clock_t::now();
+    run();
+    double const seconds = secondsSince(start);
+    std::size_t const nAllocations = gAllocations - startAllocations;
+    std::printf("%-24s %12zu %10.1f %10.3f\n", name.c_str(), nOps,
+      seconds / nOps * 1e9, static_cast<double>(nAllocations) / nOps);
+  } // measure()
+
+} // local namespace
+
+
+// -----------------------------------------------------------------------------
+int main(int argc, char** argv) {
+
+  long const nRounds = (argc > 1)? std::strtol(argv[1], nullptr, 10): 1000L;
+  if ((argc > 2) || (nRounds <= 0)) {
+    std::fprintf(stderr, "Usage:  %s [rounds]\n", argv[0]);
+    return 1;
+  }
+
+  std::vector<Gate_t> const gates = makePMTGates(180U, 4U, NTicks);
+  std::size_t const nGates = gates.size();
+
+  // the results are accumulated here, so that they are not optimized away
+  unsigned long long sink = 0ULL;
+
+  std::printf("%zu gates, %ld rounds\n", nGates, nRounds);
+  std::printf("%-24s %12s %10s %10s\n",
+    "operation", "ops", "ns/op", "allocs/op");
+
+  // --- two-gate combinations
+  measure("SymmetricCombination", nRounds * (nGates - 1), [&](){
+    for (long iRound = 0; iRound < nRounds; ++iRound) {
+      for (std::size_t i = 1; i < nGates; ++i) {
+        sink += Gate_t::SymmetricCombination
+          (std::plus<OpeningCount_t>{}, gates[i - 1], gates[i]).lastTick();
+      }
+    }
+  });
+
+  Gate_t newSum;
+  measure("Sum(other)", nRounds * nGates, [&](){
+    for (long iRound = 0; iRound < nRounds; ++iRound) {
+      newSum.clear();
+      for (Gate_t const& gate: gates) newSum.Sum(gate);
+    }
+  });
+
+  Gate_t bufferSum;
+  Gate_t::CombinationBuffer buffer;
+  measure("Sum(other, buffer)", nRounds * nGates, [&](){
+    for (long iRound = 0; iRound < nRounds; ++iRound) {
+      bufferSum.clear();
+      for (Gate_t const& gate: gates) bufferSum.Sum(gate, buffer);
+    }
+  });
+
+  // --- N-channel combination
+  Gate_t multiplicity;
+  measure("Multiplicity", nRounds, [&](){
+    for (long iRound = 0; iRound < nRounds; ++iRound)
+      multiplicity = Gate_t::Multiplicity(gates);
+  });
+
+  // --- queries
+  std::vector<ClockTick_t> ticks;
+  for (ClockTick_t tick = 0; tick <= NTicks + 100; ++tick) ticks.push_back(tick);
+
+  measure("openingCount", nRounds * ticks.size(), [&](){
+    for (long iRound = 0; iRound < nRounds; ++iRound)
+      for (ClockTick_t const tick: ticks) sink += multiplicity.openingCount(tick);
+  });
+
+  std::vector<OpeningCount_t> counts(ticks.size());
+  measure("openingCounts", nRounds * ticks.size(), [&](){
+    for (long iRound = 0; iRound < nRounds; ++iRound) {
+      multiplicity.openingCounts(ticks.data(), ticks.size(), counts.data());
+      sink += counts[iRound % counts.size()];
+    }
+  });
+
+  OpeningCount_t maxOpening = 0U;
+  for (ClockTick_t const tick: ticks)
+    maxOpening = std::max(maxOpening, multiplicity.openingCount(tick));
+  std::size_t const nStarts = (NTicks + 100) / 100 + 1;
+  measure("findOpen", nRounds * maxOpening * nStarts, [&](){
+    for (long iRound = 0; iRound < nRounds; ++iRound) {
+      for (OpeningCount_t threshold = 1U; threshold <= maxOpening; ++threshold) {
+        for (std::size_t iStart = 0; iStart < nStarts; ++iStart) {
+          ClockTick_t const start = static_cast<ClockTick_t>(iStart * 100);
+          sink += multiplicity.findOpen(threshold, start) != Gate_t::MaxTick;
+        }
+      }
+    }
+  });
+
+  // --- compaction (of copies prepared in advance)
+  Gate_t const chained = makePMTGates(1U, 360U, NTicks, true).front();
+  std::vector<Gate_t> toCompact(nRounds, chained);
+  measure("compact()", nRounds, [&](){
+    for (Gate_t& gate: toCompact) gate.compact();
+  });
+  sink += toCompact.back().lastTick();
+
+  // --- a combination result must stay modifiable like any other gate
+  Gate_t direct = gates.front();
+  auto combined = gates.front().range(0, NTicks + 101).toGate();
+  direct.openBetween(5, NTicks / 2);
+  combined.openBetween(5, NTicks / 2);
+  for (ClockTick_t const tick: ticks) {
+    if (direct.openingCount(tick) == combined.openingCount(tick)) continue;
+    std::fprintf(stderr,
+      "ERROR: the gate from range().toGate() differs after openBetween()!\n");
+    return 1;
+  }
+
+  if (newSum != bufferSum) {
+    std::fprintf(stderr, "ERROR: the sums with and without buffer differ!\n");
+    return 1;
+  }
+  if (!(newSum == multiplicity)) {
+    std::fprintf(stderr, "ERROR: the sum and the multiplicity differ!\n");
+    return 1;
+  }
+  std::printf("(checksum: %llu)\n", sink);
+  return 0;
+} // main()
@@ -0,0 +1,325 @@
+/**
+ * @file   benchmark/sbnobj_trigger_gate_replay.cc
+ * @brief  Replays captured PMT trigger gates through trigger combinations.
+ *
+ * Usage:
+ *
+ *     sbnobj_trigger_gate_replay [options] capture-file
+ *
+ * The optical trigger gates of all the events in `capture-file` (written by
+ * `icarus::trigger::TriggerGateCaptureWriter`) are loaded in memory, and then
+ * each of the configured trigger pipelines is run on all of them.
+ * Options:
+ * * `--generate N`: first writes `N` synthetic events into `capture-file`
+ *   (360 channels with random openings, and a coincident burst on a random
+ *   set of channels in some events);
+ * * `--majority N[,N...]`: multiplicity of all the gates of the event
+ *   (`Multiplicity()`), triggering if it reaches `N`;
+ * * `--window W:N`: sums of `W` gates adjacent in channel number, slid by one
+ *   gate at a time (`SlidingWindowTriggerGate`), triggering if any window
+ *   reaches `N` (can be repeated);
+ * * `--delays D[,D...]`: as `--majority`, but with the second half of the
+ *   gates (by channel) delayed by `D` ticks with respect to the first half,
+ *   for each of the delays and each of the majority thresholds;
+ * * `--repeat R`: runs each pipeline `R` times on the whole capture.
+ *
+ * With no pipeline option, `--majority 5,10,20 --window 6:4
+ * --delays -20,-10,0,10,20` is used.
+ * For each pipeline, the number of triggering events (which should not change
+ * when the code is optimized) and the throughput, in events and in input gate
+ * stati per second, are reported.
+ *
+ * This is a tool to be run by hand, and it is not part of the tests.
+ */
+
+// SBN libraries
+#include "sbnobj/ICARUS/PMT/Trigger/Data/TriggerGateCapture.h"
+#include "sbnobj/ICARUS/PMT/Trigger/Data/SingleChannelOpticalTriggerGate.h"
+#include "sbnobj/ICARUS/PMT/Trigger/Data/SlidingWindowTriggerGate.h"
+
+// framework libraries
+#include "cetlib_except/exception.h"
+
+// C/C++ standard libraries
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib> // std::strtol()
+#include <functional>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+// -----------------------------------------------------------------------------
+namespace {
+
+  using Event_t = icarus::trigger::TriggerGateCaptureEvent;
+  using Gate_t = Event_t::Gate_t;
+  using ClockTick_t = Gate_t::ClockTick_t;
+  using ClockTicks_t = Gate_t::ClockTicks_t;
+  using OpeningCount_t = Gate_t::OpeningCount_t;
+  using Window_t = icarus::trigger::SlidingWindowTriggerGate
+    <icarus::trigger::TriggerGateTick_t, icarus::trigger::TriggerGateTicks_t, raw::Channel_t>;
+
+  using Clock_t = std::chrono::steady_clock;
+
+  double secondsSince(Clock_t::time_point start)
+    { return std::chrono::duration<double>(Clock_t::now() - start).count(); }
+
+
+  /// A trigger logic: returns whether the event triggers.
+  struct Pipeline_t {
+    std::string name;
+    std::function<bool(Event_t const&)> trigger;
+  };
+
+
+  /// Parses a comma-separated list of integers; throws on errors.
+  std::vector<long> parseList(std::string const& value) {
+    std::vector<long> list;
+    std::istringstream sstr { value };
+    std::string item;
+    while (std::getline(sstr, item, ',')) {
+      char* end = nullptr;
+      long const n = std::strtol(item.c_str(), &end, 10);
+      if (item.empty() || *end) {
+        throw cet::exception("sbnobj_trigger_gate_replay")
+          << "Invalid number '" << item << "' in '" << value << "'.\n";
+      }
+      list.push_back(n);
+    }
+    return list;
+  } // parseList()
+
+
+  // ---------------------------------------------------------------------------
+  // --- synthetic capture
+  // ---------------------------------------------------------------------------
+  /// Writes `nEvents` synthetic events into a capture file at `path`.
+  void generateCapture(std::string const& path, unsigned int nEvents) {
+    using SingleGate_t = icarus::trigger::SingleChannelOpticalTriggerGate;
+
+    std::mt19937 engine { 12345 };
+    std::uniform_int_distribution<ClockTick_t> start { 0, 250'000 };
+    std::uniform_int_distribution<ClockTick_t> width { 5, 80 };
+    std::uniform_int_distribution<ClockTick_t> jitter { 0, 12 };
+    std::uniform_int_distribution<unsigned int> burstChannels { 0, 40 };
+    std::uniform_int_distribution<raw::Channel_t> burstFirst { 0, 320 };
+
+    icarus::trigger::TriggerGateCaptureWriter capture { path };
+    std::vector<SingleGate_t> gates;
+    for (unsigned int iEvent = 0; iEvent < nEvents; ++iEvent) {
+      gates.clear();
+      for (raw::Channel_t channel = 0; channel < 360; ++channel) {
+        SingleGate_t& gate = gates.emplace_back(channel);
+        for (int i = 0; i < 30; ++i) {
+          ClockTick_t const tick = start(engine);
+          gate.openBetween(tick, tick + width(engine));
+        }
+      } // for channels
+
+      // a burst of light seen by adjacent channels
+      ClockTick_t const burstTick = start(engine);
+      raw::Channel_t const first = burstFirst(engine);
+      unsigned int const n = burstChannels(engine);
+      for (raw::Channel_t channel = first; channel < first + n; ++channel) {
+        ClockTick_t const tick = burstTick + jitter(engine);
+        gates[channel].openBetween(tick, tick + 10);
+      }
+
+      capture.write(1U, 1U, iEvent + 1U, gates);
+    } // for events
+    capture.close();
+
+    std::printf("Written %zu synthetic events into '%s' (%.1f kB/event)\n",
+      capture.nEvents(), path.c_str(), capture.nBytes() / 1024.0 / nEvents);
+  } // generateCapture()
+
+
+  // ---------------------------------------------------------------------------
+  // --- pipelines
+  // ---------------------------------------------------------------------------
+  Pipeline_t makeMajority(OpeningCount_t threshold) {
+    return {
+      "majority " + std::to_string(threshold),
+      [threshold](Event_t const& event){
+        return Gate_t::Multiplicity(event.gates).findOpen(threshold)
+          != Gate_t::MaxTick;
+      }
+    };
+  } // makeMajority()
+
+
+  Pipeline_t makeWindow(std::size_t width, OpeningCount_t threshold) {
+    return {
+      "window " + std::to_string(width) + ":" + std::to_string(threshold),
+      [width, threshold](Event_t const& event){
+        std::vector<Gate_t> const& gates = event.gates; // sorted by channel
+        Window_t window;
+        for (std::size_t i = 0; i < gates.size(); ++i) {
+          if (i >= width) window.slide(gates[i - width], gates[i]);
+          else            window.add(gates[i]);
+          if (i + 1 < width) continue;
+          if (window.gate().findOpen(threshold) != Gate_t::MaxTick)
+            return true;
+        }
+        return false;
+      }
+    };
+  } // makeWindow()
+
+
+  Pipeline_t makeDelayedMajority(ClockTicks_t delay, OpeningCount_t threshold)
+  {
+    return {
+      "delay " + std::to_string(delay) + " majority "
+        + std::to_string(threshold),
+      [delay, threshold](Event_t const& event){
+        std::size_t const nGates = event.gates.size();
+        std::vector<ClockTicks_t> delays(nGates, ClockTicks_t{ 0 });
+        std::fill(delays.begin() + nGates / 2, delays.end(), delay);
+        return Gate_t::Multiplicity(event.gates, delays).findOpen(threshold)
+          != Gate_t::MaxTick;
+      }
+    };
+  } // makeDelayedMajority()
+
+
+  /// Returns the number of stati of `gate` (its input size).
+  std::size_t countStati(Gate_t const& gate) {
+    std::size_t n = 0;
+    gate.forEachStatus([&n](ClockTick_t, OpeningCount_t){ ++n; });
+    return n;
+  }
+
+
+  /// Runs `pipeline` `nRepeat` times on all `events` and prints the result.
+  void replay(
+    Pipeline_t const& pipeline, std::vector<Event_t> const& events,
+    std::size_t nStati, unsigned int nRepeat
+  ) {
+    std::size_t nTriggers = 0;
+    Clock_t::time_point const start = Clock_t::now();
+    for (unsigned int iRepeat = 0; iRepeat < nRepeat; ++iRepeat) {
+      nTriggers = 0;
+      for (Event_t const& event: events)
+        if (pipeline.trigger(event)) ++nTriggers;
+    }
+    double const seconds = secondsSince(start);
+    double const nEvents = static_cast<double>(events.size()) * nRepeat;
+    std::printf("%-28s %8zu %10.3f %12.1f %12.2f\n",
+      pipeline.name.c_str(), nTriggers, seconds,
+      nEvents / seconds, nStati * double(nRepeat) / seconds / 1e6
+      );
+  } // replay()
+
+} // local namespace
+
+
+// -----------------------------------------------------------------------------
+int main(int argc, char** argv) try {
+
+  std::string path;
+  long nGenerate = 0;
+  long nRepeat = 1;
+  std::vector<long> majorities;
+  std::vector<std::pair<long, long>> windows;
+  std::vector<long> delays;
+  bool badArguments = false;
+
+  for (int iArg = 1; iArg < argc; ++iArg) {
+    std::string const arg = argv[iArg];
+    bool const hasValue = (iArg + 1 < argc);
+    if ((arg == "--generate") && hasValue)
+      nGenerate = parseList(argv[++iArg]).at(0);
+    else if ((arg == "--repeat") && hasValue)
+      nRepeat = parseList(argv[++iArg]).at(0);
+    else if ((arg == "--majority") && hasValue) {
+      for (long const n: parseList(argv[++iArg])) majorities.push_back(n);
+    }
+    else if ((arg == "--delays") && hasValue) {
+      for (long const d: parseList(argv[++iArg])) delays.push_back(d);
+    }
+    else if ((arg == "--window") && hasValue) {
+      std::string value = argv[++iArg];
+      std::replace(value.begin(), value.end(), ':', ',');
+      std::vector<long> const spec = parseList(value);
+      if ((spec.size() != 2) || (spec[0] <= 0)) {
+        throw cet::exception("sbnobj_trigger_gate_replay")
+          << "Invalid window specification '" << argv[iArg] << "'.\n";
+      }
+      windows.emplace_back(spec[0], spec[1]);
+    }
+    else if (path.empty() && (arg.substr(0, 2) != "--")) path = arg;
+    else badArguments = true;
+  } // for arguments
+
+  if (badArguments || path.empty() || (nGenerate < 0) || (nRepeat <= 0)) {
+    std::fprintf(stderr,
+      "Usage:  %s [--generate N] [--repeat R] [--majority N[,N...]]"
+      " [--window W:N] [--delays D[,D...]] capture-file\n",
+      argv[0]);
+    return 1;
+  }
+  bool const defaultPipelines
+    = majorities.empty() && windows.empty() && delays.empty();
+  if (defaultPipelines) {
+    majorities = { 5, 10, 20 };
+    windows = { { 6, 4 } };
+    delays = { -20, -10, 0, 10, 20 };
+  }
+  else if (!delays.empty() && majorities.empty()) majorities = { 10 };
+
+  if (nGenerate > 0) generateCapture(path, nGenerate);
+
+  // --- load the capture
+  Clock_t::time_point const startRead = Clock_t::now();
+  icarus::trigger::TriggerGateCaptureReader capture { path };
+  std::vector<Event_t> events = capture.readAll();
+  double const readSeconds = secondsSince(startRead);
+
+  std::size_t nGates = 0;
+  std::size_t nStati = 0;
+  for (Event_t& event: events) {
+    // the sliding windows run on gates sorted by channel
+    std::stable_sort(event.gates.begin(), event.gates.end(),
+      [](Gate_t const& a, Gate_t const& b){
+        return a.hasChannels() && (!b.hasChannels()
+          || (a.channels().front() < b.channels().front()));
+      });
+    nGates += event.gates.size();
+    for (Gate_t const& gate: event.gates) nStati += countStati(gate);
+  }
+  std::printf(
+    "'%s': %zu events, %zu gates, %zu stati; read in %.3f s (%.1f MB/s)\n",
+    path.c_str(), events.size(), nGates, nStati,
+    readSeconds, capture.nBytes() / readSeconds / 1e6
+    );
+  if (events.empty()) return 0;
+
+  // --- configure the pipelines
+  std::vector<Pipeline_t> pipelines;
+  for (long const threshold: majorities)
+    pipelines.push_back(makeMajority(threshold));
+  for (auto const& [ width, threshold ]: windows)
+    pipelines.push_back(makeWindow(width, threshold));
+  for (long const threshold: majorities) {
+    for (long const delay: delays)
+      pipelines.push_back(makeDelayedMajority(delay, threshold));
+  }
+
+  // --- replay
+  std::printf("%-28s %8s %10s %12s %12s\n",
+    "pipeline", "triggers", "time [s]", "events/s", "Mstati/s");
+  for (Pipeline_t const& pipeline: pipelines)
+    replay(pipeline, events, nStati, nRepeat);
+
+  return 0;
+} // main()
+catch (std::exception const& e) {
+  std::cerr << e.what() << std::endl;
+  return 1;
+}
@@ -0,0 +1,106 @@
+#include "sbnobj/Common/Analysis/TPCPurityAccumulator.hh"
+
+#include "cetlib_except/exception.h"
+
+#include <cmath>
+
+void anab::WeightedStats::Add(double value, double weight)
+{
+  if (!(weight > 0.)) return;
+  ++Count;
+  SumWeights += weight;
+  double const delta = value - Mean;
+  Mean += delta * weight / SumWeights;
+  SumSqDev += weight * delta * (value - Mean);
+}
+
+void anab::WeightedStats::Merge(WeightedStats const& other)
+{
+  if (other.Count == 0) return;
+  if (Count == 0) {
+    *this = other;
+    return;
+  }
+  double const sumWeights = SumWeights + other.SumWeights;
+  double const delta = other.Mean - Mean;
+  Mean += delta * other.SumWeights / sumWeights;
+  SumSqDev += other.SumSqDev + delta * delta * SumWeights * other.SumWeights / sumWeights;
+  SumWeights = sumWeights;
+  Count += other.Count;
+}
+
+double anab::WeightedStats::Variance() const
+{
+  return (SumWeights > 0.)? SumSqDev / SumWeights: 0.;
+}
+
+double anab::WeightedStats::MeanError() const
+{
+  return (SumWeights > 0.)? 1. / std::sqrt(SumWeights): 0.;
+}
+
+anab::TPCPurityAccumulator::TPCPurityAccumulator(Weighting weighting)
+  : fWeighting(weighting)
+  , fTimeOrigin(0.)
+  , fBinWidth(0.)
+{}
+
+anab::TPCPurityAccumulator::TPCPurityAccumulator(double timeOrigin, double binWidth, Weighting weighting)
+  : fWeighting(weighting)
+  , fTimeOrigin(timeOrigin)
+  , fBinWidth(binWidth)
+{
+  if (!(binWidth > 0.)) {
+    throw cet::exception("TPCPurityAccumulator")
+      << "Invalid time bin width " << binWidth << ".\n";
+  }
+}
+
+long anab::TPCPurityAccumulator::TimeBin(double time) const
+{
+  return TimeBinned()? static_cast<long>(std::floor((time - fTimeOrigin) / fBinWidth)): 0;
+}
+
+bool anab::TPCPurityAccumulator::Add(TPCPurityInfo const& info, double time)
+{
+  double weight = 1.;
+  if (fWeighting == Weighting::InverseVariance) {
+    double const error = info.FracError * info.Attenuation;
+    weight = 1. / (error * error);
+    if (!(info.FracError > 0.) || !std::isfinite(weight)) weight = 0.;
+  }
+  if (!std::isfinite(info.Attenuation) || !(weight > 0.)) {
+    ++fNSkipped;
+    return false;
+  }
+
+  Key const key { info.Run, info.Cryostat, info.TPC, TimeBin(time) };
+  fStats[key].Add(info.Attenuation, weight);
+  return true;
+}
+
+void anab::TPCPurityAccumulator::Merge(TPCPurityAccumulator const& other)
+{
+  if (other.fWeighting != fWeighting || other.fTimeOrigin != fTimeOrigin
+    || other.fBinWidth != fBinWidth)
+  {
+    throw cet::exception("TPCPurityAccumulator")
+      << "Can't merge accumulators with different weighting or time binning.\n";
+  }
+  for (auto const& [key, stats]: other.fStats) fStats[key].Merge(stats);
+  fNSkipped += other.fNSkipped;
+}
+
+anab::WeightedStats anab::TPCPurityAccumulator::Stats(Key const& key) const
+{
+  auto const it = fStats.find(key);
+  return (it == fStats.end())? WeightedStats{}: it->second;
+}
+
+std::vector<anab::TPCPurityAccumulator::Entry> anab::TPCPurityAccumulator::Entries() const
+{
+  std::vector<Entry> entries;
+  entries.reserve(fStats.size());
+  for (auto const& [key, stats]: fStats) entries.push_back({ key, stats });
+  return entries;
+}
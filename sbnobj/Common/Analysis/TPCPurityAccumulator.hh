@@ -0,0 +1,105 @@
+/**
+ * \class TPCPurityAccumulator
+ *
+ * \ingroup anab
+ *
+ * \brief Mergeable summary of TPCPurityInfo per run, cryostat and TPC
+ *
+ */
+
+#ifndef TPCPurityAccumulator_hh_
+#define TPCPurityAccumulator_hh_
+
+#include "sbnobj/Common/Analysis/TPCPurityInfo.hh"
+
+#include <cstddef>
+#include <map>
+#include <tuple>
+#include <vector>
+
+namespace anab {
+
+  // Weighted mean and variance of a sample, updated one value at a time
+  // (West's algorithm) and combined with other samples (Chan's formula).
+  struct WeightedStats{
+
+    std::size_t Count = 0;
+    double SumWeights = 0.;
+    double Mean = 0.;
+    double SumSqDev = 0.; // weighted sum of squared deviations from the mean
+
+    void Add(double value, double weight = 1.);
+    void Merge(WeightedStats const& other);
+
+    double Variance() const; // weighted population variance (0 if empty)
+    double MeanError() const; // 1/sqrt(SumWeights), for inverse variance weights
+  };
+
+  // Accumulates Attenuation of TPCPurityInfo per (Run, Cryostat, TPC) and,
+  // in the time-binned mode, per time bin. Each accumulator can be filled
+  // independently (e.g. one per thread or input file) and then merged in any
+  // order: the merge is associative and commutative but for rounding.
+  class TPCPurityAccumulator{
+
+  public:
+
+    enum class Weighting { Uniform, InverseVariance };
+
+    struct Key{
+      unsigned int Run;
+      unsigned int Cryostat;
+      unsigned int TPC;
+      long TimeBin; // 0 if not time-binned
+
+      bool operator< (Key const& other) const
+        {
+          return std::tie(Run, Cryostat, TPC, TimeBin)
+            < std::tie(other.Run, other.Cryostat, other.TPC, other.TimeBin);
+        }
+    };
+
+    struct Entry{
+      Key key;
+      WeightedStats stats;
+    };
+
+    // with InverseVariance, each value is weighted by 1/(FracError Attenuation)^2
+    explicit TPCPurityAccumulator(Weighting weighting = Weighting::InverseVariance);
+
+    // time-binned mode, with bins of binWidth starting at timeOrigin (any unit)
+    TPCPurityAccumulator(double timeOrigin, double binWidth,
+                         Weighting weighting = Weighting::InverseVariance);
+
+    bool TimeBinned() const { return fBinWidth > 0.; }
+
+    // adds the measurement; returns false (and skips it) if its attenuation or
+    // error are not valid (not finite, or the error is not positive when used
+    // for the weight)
+    bool Add(TPCPurityInfo const& info, double time = 0.);
+
+    void Merge(TPCPurityAccumulator const& other);
+
+    std::size_t NKeys() const { return fStats.size(); }
+    std::size_t NSkipped() const { return fNSkipped; }
+
+    // statistics of the key, empty if never filled
+    WeightedStats Stats(Key const& key) const;
+
+    // all the statistics, sorted by key
+    std::vector<Entry> Entries() const;
+
+  private:
+
+    Weighting fWeighting;
+    double fTimeOrigin;
+    double fBinWidth;
+    std::map<Key, WeightedStats> fStats;
+    std::size_t fNSkipped = 0;
+
+    long TimeBin(double time) const;
+  };
+
+}
+
+
+#endif
@@ -0,0 +1,84 @@
+/**
+ * \class CRTEventArena
+ *
+ * \ingroup crt
+ *
+ * \brief Per-event memory arena for transient CRT reconstruction objects
+ *
+ */
+
+#ifndef CRTEventArena_hh_
+#define CRTEventArena_hh_
+
+#include <cstddef>
+#include <memory_resource>
+#include <optional>
+#include <vector>
+
+namespace sbn::crt {
+
+    /**
+     * Monotonic memory resource for the `std::pmr` containers of the
+     * transient CRT objects of one event (e.g. `sbn::crt::pmr::CRTHit`):
+     * allocations are served from a buffer kept across events, and memory is
+     * only given back, all at once, by `reset()` at the end of the event.
+     * When the buffer is exhausted, more memory is taken from the default
+     * resource, and the buffer is grown for the following events.
+     *
+     * The arena is not thread safe: use one per event being processed.
+     */
+    class CRTEventArena {
+
+    public:
+
+      using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+      explicit CRTEventArena(std::size_t initialSize = 1U << 20)
+        : fBuffer(initialSize)
+        { fResource.emplace(fBuffer.data(), fBuffer.size(), &fUpstream); }
+
+      CRTEventArena(CRTEventArena const&) = delete;
+      CRTEventArena& operator=(CRTEventArena const&) = delete;
+
+      std::pmr::memory_resource* resource() { return &*fResource; }
+      allocator_type allocator() { return allocator_type{ resource() }; }
+
+      /// Releases all the memory of the event; all objects from the arena must
+      /// have been destroyed already.
+      void reset()
+        {
+          fResource.reset(); // gives back the memory taken beyond the buffer
+          if (fUpstream.used > 0) {
+            fBuffer.assign(fBuffer.size() + fUpstream.used, std::byte{ 0 });
+            fUpstream.used = 0;
+          }
+          fResource.emplace(fBuffer.data(), fBuffer.size(), &fUpstream);
+        }
+
+      std::size_t bufferSize() const { return fBuffer.size(); }
+
+    private:
+
+      /// Default resource, recording how much was needed beyond the buffer.
+      struct CountingResource: std::pmr::memory_resource {
+        std::size_t used = 0;
+
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override
+          {
+            used += bytes;
+            return std::pmr::get_default_resource()->allocate(bytes, alignment);
+          }
+        void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override
+          { std::pmr::get_default_resource()->deallocate(p, bytes, alignment); }
+        bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override
+          { return this == &other; }
+      };
+
+      std::vector<std::byte> fBuffer;
+      CountingResource fUpstream;
+      std::optional<std::pmr::monotonic_buffer_resource> fResource;
+    };
+
+} // namespace sbn::crt
+
+#endif
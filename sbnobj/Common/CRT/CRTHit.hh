@@ -12,6 +12,9 @@
 #ifndef CRTHit_hh_
 #define CRTHit_hh_
 
+#include "sbnobj/Common/Utilities/TimeNs.h"
+
+#include <algorithm>
 #include <cstdint>
 #include <vector>
 #include <map>
@@ -20,10 +23,25 @@
 
 namespace sbn::crt {
 
+    /// Signal of one channel in a CRT hit.
+    struct CRTHitPE {
+      uint8_t    feb; ///< FEB address.
+      int    channel; ///< Local channel in the FEB.
+      float       pe; ///< Signal [photo-electrons].
+    };
+
+    /**
+     * @brief Hit reconstructed from the CRT.
+     *
+     * Since version 18 the signals are stored in the flat list `pes` instead
+     * of the `pesmap` data member: code reading `hit.pesmap` needs to change
+     * into `hit.pesmap()`, which rebuilds the old map, or better to iterate
+     * `pes` directly. Files with older versions are converted on read.
+     */
     struct CRTHit{
 
       std::vector<uint8_t> feb_id; ///< FEB address
-      std::map< uint8_t, std::vector<std::pair<int,float> > > pesmap; ///< Saves signal hit information (FEB, local-channel and PE) .
+      std::vector<CRTHitPE> pes; ///< Saves signal hit information (FEB, local-channel and PE), sorted by FEB.
       float         peshit; ///< Total photo-electron (PE) in a crt hit.
 
       uint64_t       ts0_s; ///< Second-only part of timestamp T0.
@@ -51,6 +69,32 @@ namespace sbn::crt {
       // nano-second part is enough and we saved entire time there.
       int64_t ts1() const { return static_cast<int64_t>(ts1_ns); }
 
+      /// Timestamp T0 (`ts0()`) as `sbn::TimeNs_t`.
+      sbn::TimeNs_t ts0Time() const { return sbn::TimeNs_t{ ts0() }; }
+      /// Timestamp T1 (`ts1()`) as `sbn::TimeNs_t`.
+      sbn::TimeNs_t ts1Time() const { return sbn::TimeNs_t{ ts1() }; }
+
+      /// Adds a channel signal, after the others from the same FEB.
+      void addPE(uint8_t feb, int channel, float pe)
+        {
+          auto const where = std::upper_bound(pes.begin(), pes.end(), feb,
+            [](uint8_t f, CRTHitPE const& p){ return f < p.feb; });
+          pes.insert(where, CRTHitPE{ feb, channel, pe });
+        }
+
+      /**
+       * @brief Compatibility replacement of the `pesmap` data member removed in version 18.
+       * @return the signals in the (FEB, list of (local channel, PE)) form used up to version 17
+       *
+       * The map is rebuilt at each call: new code should iterate `pes` instead.
+       */
+      std::map< uint8_t, std::vector<std::pair<int,float> > > pesmap() const
+        {
+          std::map< uint8_t, std::vector<std::pair<int,float> > > map;
+          for (CRTHitPE const& p: pes) map[p.feb].emplace_back(p.channel, p.pe);
+          return map;
+        }
+
     };
 
 } // namespace sbn::crt
@@ -0,0 +1,169 @@
+#include "sbnobj/Common/CRT/CRTHitCollection.hh"
+
+#include "cetlib_except/exception.h"
+
+#include <algorithm>
+#include <numeric>
+
+sbn::crt::CRTHitCollection::CRTHitCollection(std::vector<CRTHit> const& hits) {
+
+  std::size_t nFEBs = 0, nPEs = 0;
+  for (CRTHit const& hit: hits) {
+    nFEBs += hit.feb_id.size();
+    nPEs += hit.pes.size();
+  }
+
+  reserve(hits.size(), nFEBs, nPEs);
+
+  for (CRTHit const& hit: hits) append(hit);
+
+  fTs0Order.resize(size());
+  std::iota(fTs0Order.begin(), fTs0Order.end(), 0U);
+  std::stable_sort(fTs0Order.begin(), fTs0Order.end(),
+    [this](uint32_t a, uint32_t b){ return ts0(a) < ts0(b); });
+
+} // sbn::crt::CRTHitCollection::CRTHitCollection()
+
+
+void sbn::crt::CRTHitCollection::reserve
+  (std::size_t nHits, std::size_t nFEBs, std::size_t nPEs)
+{
+
+  fPeshit.reserve(nHits);
+  fTs0_s.reserve(nHits);
+  fTs0_s_corr.reserve(nHits);
+  fTs0_ns.reserve(nHits);
+  fTs0_ns_corr.reserve(nHits);
+  fTs1_ns.reserve(nHits);
+  fPlane.reserve(nHits);
+  fX_pos.reserve(nHits);
+  fX_err.reserve(nHits);
+  fY_pos.reserve(nHits);
+  fY_err.reserve(nHits);
+  fZ_pos.reserve(nHits);
+  fZ_err.reserve(nHits);
+  fFEBs.reserve(nFEBs);
+  fFEBOffsets.reserve(nHits + 1);
+  fPEFEB.reserve(nPEs);
+  fPEChannel.reserve(nPEs);
+  fPEValue.reserve(nPEs);
+  fPEOffsets.reserve(nHits + 1);
+  fTaggerID.reserve(nHits);
+  fTs0Order.reserve(nHits);
+
+} // sbn::crt::CRTHitCollection::reserve()
+
+
+void sbn::crt::CRTHitCollection::push_back(CRTHit const& hit) {
+
+  append(hit);
+
+  // hits usually come in time order, in which case this is the end
+  uint32_t const index = size() - 1;
+  int64_t const time = ts0(index);
+  auto const where = std::upper_bound(fTs0Order.begin(), fTs0Order.end(), time,
+    [this](int64_t t, uint32_t i){ return t < ts0(i); });
+  fTs0Order.insert(where, index);
+
+} // sbn::crt::CRTHitCollection::push_back()
+
+
+sbn::crt::CRTHit sbn::crt::CRTHitCollection::hit(std::size_t i) const {
+
+  if (i >= size()) {
+    throw cet::exception("CRTHitCollection") << "Requested hit #" << i
+      << " of a collection of " << size() << "\n";
+  }
+
+  CRTHit hit;
+  hit.feb_id.assign(febs(i), febs(i) + nFEBs(i));
+  hit.pes.reserve(pesEnd(i) - pesBegin(i));
+  for (std::size_t k = pesBegin(i); k < pesEnd(i); ++k)
+    hit.pes.push_back(CRTHitPE{ fPEFEB[k], fPEChannel[k], fPEValue[k] });
+  hit.peshit = fPeshit[i];
+  hit.ts0_s = fTs0_s[i];
+  hit.ts0_s_corr = fTs0_s_corr[i];
+  hit.ts0_ns = fTs0_ns[i];
+  hit.ts0_ns_corr = fTs0_ns_corr[i];
+  hit.ts1_ns = fTs1_ns[i];
+  hit.plane = fPlane[i];
+  hit.x_pos = fX_pos[i];
+  hit.x_err = fX_err[i];
+  hit.y_pos = fY_pos[i];
+  hit.y_err = fY_err[i];
+  hit.z_pos = fZ_pos[i];
+  hit.z_err = fZ_err[i];
+  hit.tagger = tagger(i);
+  return hit;
+
+} // sbn::crt::CRTHitCollection::hit()
+
+
+std::vector<sbn::crt::CRTHit> sbn::crt::CRTHitCollection::toHits() const {
+
+  std::vector<CRTHit> hits;
+  hits.reserve(size());
+  for (std::size_t i = 0; i < size(); ++i) hits.push_back(hit(i));
+  return hits;
+
+} // sbn::crt::CRTHitCollection::toHits()
+
+
+auto sbn::crt::CRTHitCollection::findTagger(std::string const& name) const
+  -> TaggerID_t
+{
+  auto const it = std::find(fTaggerNames.begin(), fTaggerNames.end(), name);
+  return (it == fTaggerNames.end())
+    ? NoTagger: static_cast<TaggerID_t>(it - fTaggerNames.begin());
+} // sbn::crt::CRTHitCollection::findTagger()
+
+
+std::pair<std::size_t, std::size_t> sbn::crt::CRTHitCollection::ts0Window
+  (int64_t start, int64_t stop) const
+{
+  auto const first = std::lower_bound(fTs0Order.begin(), fTs0Order.end(), start,
+    [this](uint32_t i, int64_t t){ return ts0(i) < t; });
+  auto const last = std::lower_bound(first, fTs0Order.end(), stop,
+    [this](uint32_t i, int64_t t){ return ts0(i) < t; });
+  return { first - fTs0Order.begin(), last - fTs0Order.begin() };
+} // sbn::crt::CRTHitCollection::ts0Window()
+
+
+void sbn::crt::CRTHitCollection::append(CRTHit const& hit) {
+
+  fPeshit.push_back(hit.peshit);
+  fTs0_s.push_back(hit.ts0_s);
+  fTs0_s_corr.push_back(hit.ts0_s_corr);
+  fTs0_ns.push_back(hit.ts0_ns);
+  fTs0_ns_corr.push_back(hit.ts0_ns_corr);
+  fTs1_ns.push_back(hit.ts1_ns);
+  fPlane.push_back(hit.plane);
+  fX_pos.push_back(hit.x_pos);
+  fX_err.push_back(hit.x_err);
+  fY_pos.push_back(hit.y_pos);
+  fY_err.push_back(hit.y_err);
+  fZ_pos.push_back(hit.z_pos);
+  fZ_err.push_back(hit.z_err);
+
+  fFEBs.insert(fFEBs.end(), hit.feb_id.begin(), hit.feb_id.end());
+  fFEBOffsets.push_back(fFEBs.size());
+
+  for (CRTHitPE const& pe: hit.pes) {
+    fPEFEB.push_back(pe.feb);
+    fPEChannel.push_back(pe.channel);
+    fPEValue.push_back(pe.pe);
+  }
+  fPEOffsets.push_back(fPEValue.size());
+
+  TaggerID_t tagger = findTagger(hit.tagger);
+  if (tagger == NoTagger) {
+    if (fTaggerNames.size() >= NoTagger) {
+      throw cet::exception("CRTHitCollection")
+        << "Too many different taggers (" << fTaggerNames.size() << ")\n";
+    }
+    tagger = fTaggerNames.size();
+    fTaggerNames.push_back(hit.tagger);
+  }
+  fTaggerID.push_back(tagger);
+
+} // sbn::crt::CRTHitCollection::append()
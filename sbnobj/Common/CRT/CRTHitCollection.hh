@@ -0,0 +1,158 @@
+/**
+ * \class CRTHitCollection
+ *
+ * \ingroup crt
+ *
+ * \brief CRT hits stored by column
+ *
+ */
+
+#ifndef CRTHitCollection_hh_
+#define CRTHitCollection_hh_
+
+#include "sbnobj/Common/CRT/CRTHit.hh"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace sbn::crt {
+
+    /**
+     * @brief Collection of `CRTHit` with one contiguous array per data member.
+     *
+     * The FEB addresses and the signals (`CRTHit::pes`) of all the hits
+     * are concatenated, each hit addressing its own range by offset.
+     * Taggers are stored once, hits referring to them by index.
+     *
+     * The hits keep their insertion order, and an index sorted by `ts0()` is
+     * maintained for time window queries (`ts0Window()`).
+     */
+    class CRTHitCollection {
+
+    public:
+
+      using TaggerID_t = uint16_t; ///< Type of index of a tagger name.
+
+      CRTHitCollection() = default;
+
+      /// Creates a collection with a copy of all the `hits`.
+      explicit CRTHitCollection(std::vector<CRTHit> const& hits);
+
+      /// Number of hits in the collection.
+      std::size_t size() const { return fTs0_s.size(); }
+      bool empty() const { return fTs0_s.empty(); }
+
+      /// Reserves room for `nHits` hits with `nFEBs` FEB addresses and
+      /// `nPEs` signals in total.
+      void reserve(std::size_t nHits, std::size_t nFEBs = 0, std::size_t nPEs = 0);
+
+      /// Adds a copy of the `hit` at the end of the collection.
+      void push_back(CRTHit const& hit);
+
+      /// Returns a copy of the hit `i` as a `CRTHit`.
+      CRTHit hit(std::size_t i) const;
+
+      /// Returns a copy of all the hits as `CRTHit`, in the insertion order.
+      std::vector<CRTHit> toHits() const;
+
+      // --- per-hit columns; see `CRTHit` for their meaning
+      std::vector<float> const& peshit() const { return fPeshit; }
+      std::vector<uint64_t> const& ts0_s() const { return fTs0_s; }
+      std::vector<double> const& ts0_s_corr() const { return fTs0_s_corr; }
+      std::vector<double> const& ts0_ns() const { return fTs0_ns; }
+      std::vector<double> const& ts0_ns_corr() const { return fTs0_ns_corr; }
+      std::vector<double> const& ts1_ns() const { return fTs1_ns; }
+      std::vector<int> const& plane() const { return fPlane; }
+      std::vector<float> const& x_pos() const { return fX_pos; }
+      std::vector<float> const& x_err() const { return fX_err; }
+      std::vector<float> const& y_pos() const { return fY_pos; }
+      std::vector<float> const& y_err() const { return fY_err; }
+      std::vector<float> const& z_pos() const { return fZ_pos; }
+      std::vector<float> const& z_err() const { return fZ_err; }
+
+      /// `CRTHit::ts0()` of hit `i`.
+      int64_t ts0(std::size_t i) const
+        { return static_cast<int64_t>(fTs0_s[i]) * 1'000'000'000LL + static_cast<int64_t>(fTs0_ns[i]); }
+
+      /// `CRTHit::ts1()` of hit `i`.
+      int64_t ts1(std::size_t i) const { return static_cast<int64_t>(fTs1_ns[i]); }
+
+      // --- FEB addresses
+      /// Number of FEB addresses of hit `i`.
+      std::size_t nFEBs(std::size_t i) const { return fFEBOffsets[i + 1] - fFEBOffsets[i]; }
+      /// Pointer to the first FEB address of hit `i`.
+      uint8_t const* febs(std::size_t i) const { return fFEBs.data() + fFEBOffsets[i]; }
+
+      // --- `CRTHit::pes` content: hit `i` owns entries in
+      //     [ pesBegin(i), pesEnd(i) [
+      std::size_t pesBegin(std::size_t i) const { return fPEOffsets[i]; }
+      std::size_t pesEnd(std::size_t i) const { return fPEOffsets[i + 1]; }
+      std::vector<uint8_t> const& pesFEB() const { return fPEFEB; }
+      std::vector<int> const& pesChannel() const { return fPEChannel; }
+      std::vector<float> const& pesPE() const { return fPEValue; }
+
+      // --- taggers
+      /// Index of the tagger of hit `i`.
+      TaggerID_t taggerID(std::size_t i) const { return fTaggerID[i]; }
+      /// Name of the tagger of hit `i`.
+      std::string const& tagger(std::size_t i) const { return fTaggerNames[fTaggerID[i]]; }
+      /// Names of all the taggers, by index.
+      std::vector<std::string> const& taggerNames() const { return fTaggerNames; }
+      /// Index of the tagger `name`, `NoTagger` if no hit has it.
+      TaggerID_t findTagger(std::string const& name) const;
+
+      static constexpr TaggerID_t NoTagger = static_cast<TaggerID_t>(-1);
+
+      // --- time index
+      /// Hit indices in ascending `ts0()` (hits with the same time in insertion order).
+      std::vector<uint32_t> const& ts0Order() const { return fTs0Order; }
+
+      /**
+       * @brief Returns the range in `ts0Order()` of the hits with `ts0()` in
+       *        [ `start`, `stop` [.
+       *
+       * The hits in the window are `ts0Order()[k]` with `k` from `first`
+       * (included) to `second` (excluded) of the returned pair.
+       */
+      std::pair<std::size_t, std::size_t> ts0Window(int64_t start, int64_t stop) const;
+
+    private:
+
+      std::vector<float> fPeshit;
+      std::vector<uint64_t> fTs0_s;
+      std::vector<double> fTs0_s_corr;
+      std::vector<double> fTs0_ns;
+      std::vector<double> fTs0_ns_corr;
+      std::vector<double> fTs1_ns;
+      std::vector<int> fPlane;
+      std::vector<float> fX_pos;
+      std::vector<float> fX_err;
+      std::vector<float> fY_pos;
+      std::vector<float> fY_err;
+      std::vector<float> fZ_pos;
+      std::vector<float> fZ_err;
+
+      std::vector<uint8_t> fFEBs; ///< FEB addresses of all hits.
+      std::vector<uint32_t> fFEBOffsets{ 0 }; ///< First FEB of each hit, plus the end.
+
+      std::vector<uint8_t> fPEFEB; ///< FEB of each signal.
+      std::vector<int> fPEChannel; ///< Local channel of each signal.
+      std::vector<float> fPEValue; ///< PE of each signal.
+      std::vector<uint32_t> fPEOffsets{ 0 }; ///< First signal of each hit, plus the end.
+
+      std::vector<TaggerID_t> fTaggerID; ///< Tagger of each hit.
+      std::vector<std::string> fTaggerNames; ///< Names of the taggers, by index.
+
+      std::vector<uint32_t> fTs0Order; ///< Hit indices sorted by `ts0()`.
+
+      /// Appends the hit to the columns, without updating the time index.
+      void append(CRTHit const& hit);
+
+    };
+
+} // namespace sbn::crt
+
+#endif
@@ -0,0 +1,171 @@
+/**
+ * \brief Transient CRT hit and CRT-PMT match with `std::pmr` containers
+ *
+ * \ingroup crt
+ *
+ */
+
+#ifndef CRTHitPmr_hh_
+#define CRTHitPmr_hh_
+
+#include "sbnobj/Common/CRT/CRTHit.hh"
+#include "sbnobj/Common/CRT/CRTPMTMatching.hh"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory_resource>
+#include <string>
+#include <utility> // std::move()
+#include <vector>
+
+namespace sbn::crt::pmr {
+
+    /**
+     * Reconstruction-only form of `sbn::crt::CRTHit`, with all the containers
+     * allocated from a memory resource (typically a `CRTEventArena`).
+     * It is allocator-aware, so that the hits in a `std::pmr::vector` share
+     * the resource of the vector. Use `toCRTHit()` when writing the products.
+     */
+    struct CRTHit{
+
+      using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+      std::pmr::vector<uint8_t> feb_id; ///< FEB address
+      std::pmr::vector<CRTHitPE> pes; ///< Signal hit information, sorted by FEB.
+      float         peshit = 0; ///< Total photo-electron (PE) in a crt hit.
+
+      uint64_t       ts0_s = 0; ///< Second-only part of timestamp T0.
+      double    ts0_s_corr = 0;
+      double        ts0_ns = 0; ///< Timestamp T0 (from White Rabbit) [ns]
+      double   ts0_ns_corr = 0;
+
+      double        ts1_ns = 0; ///< Timestamp T1 ([signal time w.r.t. Trigger time])
+
+      int            plane = 0; ///< Name of the CRT wall (in the form of numbers).
+
+      float          x_pos = 0; ///< position in x-direction (cm).
+      float          x_err = 0; ///< position uncertainty in x-direction (cm).
+      float          y_pos = 0; ///< position in y-direction (cm).
+      float          y_err = 0; ///< position uncertainty in y-direction (cm).
+      float          z_pos = 0; ///< position in z-direction (cm).
+      float          z_err = 0; ///< position uncertainty in z-direction (cm).
+
+      std::pmr::string tagger; ///< Name of the CRT wall (in the form of strings).
+
+      explicit CRTHit(allocator_type alloc = {})
+        : feb_id(alloc), pes(alloc), tagger(alloc) {}
+
+      CRTHit(CRTHit const& other, allocator_type alloc)
+        : feb_id(other.feb_id, alloc), pes(other.pes, alloc)
+        , peshit(other.peshit), ts0_s(other.ts0_s), ts0_s_corr(other.ts0_s_corr)
+        , ts0_ns(other.ts0_ns), ts0_ns_corr(other.ts0_ns_corr), ts1_ns(other.ts1_ns)
+        , plane(other.plane), x_pos(other.x_pos), x_err(other.x_err)
+        , y_pos(other.y_pos), y_err(other.y_err), z_pos(other.z_pos), z_err(other.z_err)
+        , tagger(other.tagger, alloc)
+        {}
+
+      CRTHit(CRTHit&& other, allocator_type alloc)
+        : feb_id(std::move(other.feb_id), alloc), pes(std::move(other.pes), alloc)
+        , peshit(other.peshit), ts0_s(other.ts0_s), ts0_s_corr(other.ts0_s_corr)
+        , ts0_ns(other.ts0_ns), ts0_ns_corr(other.ts0_ns_corr), ts1_ns(other.ts1_ns)
+        , plane(other.plane), x_pos(other.x_pos), x_err(other.x_err)
+        , y_pos(other.y_pos), y_err(other.y_err), z_pos(other.z_pos), z_err(other.z_err)
+        , tagger(std::move(other.tagger), alloc)
+        {}
+
+      CRTHit(CRTHit const&) = default;
+      CRTHit(CRTHit&&) = default;
+      CRTHit& operator=(CRTHit const&) = default;
+      CRTHit& operator=(CRTHit&&) = default;
+
+      allocator_type get_allocator() const { return pes.get_allocator(); }
+
+      /// Adds a channel signal, after the others from the same FEB.
+      void addPE(uint8_t feb, int channel, float pe)
+        {
+          auto const where = std::upper_bound(pes.begin(), pes.end(), feb,
+            [](uint8_t f, CRTHitPE const& p){ return f < p.feb; });
+          pes.insert(where, CRTHitPE{ feb, channel, pe });
+        }
+
+      /// Returns a persistent copy.
+      sbn::crt::CRTHit toCRTHit() const
+        {
+          sbn::crt::CRTHit hit;
+          hit.feb_id.assign(feb_id.begin(), feb_id.end());
+          hit.pes.assign(pes.begin(), pes.end());
+          hit.peshit = peshit;
+          hit.ts0_s = ts0_s;
+          hit.ts0_s_corr = ts0_s_corr;
+          hit.ts0_ns = ts0_ns;
+          hit.ts0_ns_corr = ts0_ns_corr;
+          hit.ts1_ns = ts1_ns;
+          hit.plane = plane;
+          hit.x_pos = x_pos;
+          hit.x_err = x_err;
+          hit.y_pos = y_pos;
+          hit.y_err = y_err;
+          hit.z_pos = z_pos;
+          hit.z_err = z_err;
+          hit.tagger.assign(tagger.begin(), tagger.end());
+          return hit;
+        }
+
+    };
+
+    /// Reconstruction-only form of `sbn::crt::CRTPMTMatching`, with the
+    /// matched hits allocated from a memory resource.
+    struct CRTPMTMatching{
+
+      using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+      /// All the information but the matched hits.
+      sbn::crt::CRTPMTMatching flash{};
+
+      std::pmr::vector<MatchedCRT> matchedCRTHits; ///< Matched CRT Hits with the optical flash.
+
+      explicit CRTPMTMatching(allocator_type alloc = {}): matchedCRTHits(alloc) {}
+
+      CRTPMTMatching(CRTPMTMatching const& other, allocator_type alloc)
+        : flash(other.flash), matchedCRTHits(other.matchedCRTHits, alloc) {}
+
+      CRTPMTMatching(CRTPMTMatching&& other, allocator_type alloc)
+        : flash(std::move(other.flash)), matchedCRTHits(std::move(other.matchedCRTHits), alloc) {}
+
+      CRTPMTMatching(CRTPMTMatching const&) = default;
+      CRTPMTMatching(CRTPMTMatching&&) = default;
+      CRTPMTMatching& operator=(CRTPMTMatching const&) = default;
+      CRTPMTMatching& operator=(CRTPMTMatching&&) = default;
+
+      allocator_type get_allocator() const { return matchedCRTHits.get_allocator(); }
+
+      /// Returns a persistent copy.
+      sbn::crt::CRTPMTMatching toCRTPMTMatching() const
+        {
+          sbn::crt::CRTPMTMatching match = flash;
+          match.matchedCRTHits.assign(matchedCRTHits.begin(), matchedCRTHits.end());
+          return match;
+        }
+
+    };
+
+    /// Returns persistent copies of all the hits or matches.
+    inline std::vector<sbn::crt::CRTHit> toPersistent(std::pmr::vector<CRTHit> const& hits)
+      {
+        std::vector<sbn::crt::CRTHit> result;
+        result.reserve(hits.size());
+        for (CRTHit const& hit: hits) result.push_back(hit.toCRTHit());
+        return result;
+      }
+
+    inline std::vector<sbn::crt::CRTPMTMatching> toPersistent(std::pmr::vector<CRTPMTMatching> const& matches)
+      {
+        std::vector<sbn::crt::CRTPMTMatching> result;
+        result.reserve(matches.size());
+        for (CRTPMTMatching const& match: matches) result.push_back(match.toCRTPMTMatching());
+        return result;
+      }
+
+} // namespace sbn::crt::pmr
+
+#endif
@@ -0,0 +1,92 @@
+#include "sbnobj/Common/CRT/CRTHitTimeIndex.hh"
+
+#include <algorithm>
+#include <numeric>
+
+sbn::crt::CRTHitTimeIndex::CRTHitTimeIndex(std::vector<CRTHit> const& hits) {
+
+  std::vector<int> subsystem;
+  subsystem.reserve(hits.size());
+  for (CRTHit const& hit: hits) subsystem.push_back(hit.plane);
+  build(hits, subsystem);
+
+} // sbn::crt::CRTHitTimeIndex::CRTHitTimeIndex()
+
+
+auto sbn::crt::CRTHitTimeIndex::window
+  (TimeRef ref, std::int64_t start, std::int64_t stop, int subsystem) const
+  -> Range
+{
+  auto const it
+    = std::lower_bound(fSubsystems.begin(), fSubsystems.end(), subsystem);
+  if ((it == fSubsystems.end()) || (*it != subsystem)) return {};
+  return fBuckets[it - fSubsystems.begin()].window(ref, start, stop);
+} // sbn::crt::CRTHitTimeIndex::window()
+
+
+auto sbn::crt::CRTHitTimeIndex::Bucket::window
+  (TimeRef ref, std::int64_t start, std::int64_t stop) const -> Range
+{
+  std::vector<std::int64_t> const& times
+    = (ref == TimeRef::ts0)? ts0Times: ts1Times;
+  std::vector<std::uint32_t> const& hits
+    = (ref == TimeRef::ts0)? ts0Hits: ts1Hits;
+
+  auto const first = std::lower_bound(times.begin(), times.end(), start);
+  auto const last = std::lower_bound(first, times.end(), stop);
+  return {
+    hits.data() + (first - times.begin()),
+    hits.data() + (last - times.begin())
+    };
+} // sbn::crt::CRTHitTimeIndex::Bucket::window()
+
+
+void sbn::crt::CRTHitTimeIndex::build
+  (std::vector<CRTHit> const& hits, std::vector<int> const& subsystem)
+{
+  std::vector<std::int64_t> ts0(hits.size()), ts1(hits.size());
+  for (std::size_t i = 0; i < hits.size(); ++i) {
+    ts0[i] = hits[i].ts0();
+    ts1[i] = hits[i].ts1();
+  }
+
+  // hits sorted by each time; hits with the same time stay in their order
+  auto sortedBy = [&hits](std::vector<std::int64_t> const& times){
+    std::vector<std::uint32_t> order(hits.size());
+    std::iota(order.begin(), order.end(), 0U);
+    std::stable_sort(order.begin(), order.end(),
+      [&times](std::uint32_t a, std::uint32_t b){ return times[a] < times[b]; });
+    return order;
+  };
+  fAll.ts0Hits = sortedBy(ts0);
+  fAll.ts1Hits = sortedBy(ts1);
+
+  fSubsystems = subsystem;
+  std::sort(fSubsystems.begin(), fSubsystems.end());
+  fSubsystems.erase
+    (std::unique(fSubsystems.begin(), fSubsystems.end()), fSubsystems.end());
+  fBuckets.assign(fSubsystems.size(), Bucket{});
+
+  auto bucketOf = [this, &subsystem](std::uint32_t iHit) -> Bucket& {
+    auto const it = std::lower_bound
+      (fSubsystems.begin(), fSubsystems.end(), subsystem[iHit]);
+    return fBuckets[it - fSubsystems.begin()];
+  };
+
+  // buckets are filled in time order, so they come out sorted
+  fAll.ts0Times.reserve(hits.size());
+  for (std::uint32_t iHit: fAll.ts0Hits) {
+    fAll.ts0Times.push_back(ts0[iHit]);
+    Bucket& bucket = bucketOf(iHit);
+    bucket.ts0Times.push_back(ts0[iHit]);
+    bucket.ts0Hits.push_back(iHit);
+  }
+  fAll.ts1Times.reserve(hits.size());
+  for (std::uint32_t iHit: fAll.ts1Hits) {
+    fAll.ts1Times.push_back(ts1[iHit]);
+    Bucket& bucket = bucketOf(iHit);
+    bucket.ts1Times.push_back(ts1[iHit]);
+    bucket.ts1Hits.push_back(iHit);
+  }
+
+} // sbn::crt::CRTHitTimeIndex::build()
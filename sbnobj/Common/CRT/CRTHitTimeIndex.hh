@@ -0,0 +1,119 @@
+/**
+ * \class CRTHitTimeIndex
+ *
+ * \ingroup crt
+ *
+ * \brief Time-sorted index of CRT hits, for time window queries
+ *
+ */
+
+#ifndef CRTHitTimeIndex_hh_
+#define CRTHitTimeIndex_hh_
+
+#include "sbnobj/Common/CRT/CRTHit.hh"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace sbn::crt {
+
+    /**
+     * @brief Index of CRT hits sorted by `ts0()` and by `ts1()`.
+     *
+     * The index refers to the hits by their position in the collection it is
+     * built from, which must be kept as it is while the index is used.
+     * Hits are also grouped into subsystems (by default their `plane`), each
+     * with its own sorted index.
+     *
+     * For example, the hits with `ts1()` between 100 and 200 &micro;s before
+     * a flash at `flashTime` [ns] can be found with:
+     *
+     *     for (std::uint32_t iHit: index.window
+     *       (sbn::crt::CRTHitTimeIndex::TimeRef::ts1, flashTime - 200'000, flashTime - 100'000)
+     *       )
+     *       process(hits[iHit]);
+     *
+     * Each query is two binary searches, so matching `F` flashes against a
+     * collection of `H` hits costs `O((F + H) log H)` rather than `O(F H)`.
+     */
+    class CRTHitTimeIndex {
+
+    public:
+
+      /// Which of the hit times to use.
+      enum class TimeRef { ts0, ts1 };
+
+      /// Range of hit indices from a query, in ascending time.
+      struct Range {
+        std::uint32_t const* first = nullptr;
+        std::uint32_t const* last = nullptr;
+
+        std::uint32_t const* begin() const { return first; }
+        std::uint32_t const* end() const { return last; }
+        std::size_t size() const { return last - first; }
+        bool empty() const { return first == last; }
+      };
+
+      CRTHitTimeIndex() = default;
+
+      /// Indexes the `hits`, with the `plane` of each hit as subsystem.
+      explicit CRTHitTimeIndex(std::vector<CRTHit> const& hits);
+
+      /// Indexes the `hits`, with `subsystemOf(hit)` (an `int`) as subsystem.
+      template <typename SubsystemFunc>
+      CRTHitTimeIndex(std::vector<CRTHit> const& hits, SubsystemFunc subsystemOf);
+
+      /// Number of indexed hits.
+      std::size_t size() const { return fAll.ts0Hits.size(); }
+
+      /// Subsystems with at least one hit, in ascending order.
+      std::vector<int> const& subsystems() const { return fSubsystems; }
+
+      /// Hits with `ref` time in [ `start`, `stop` [ [ns].
+      Range window(TimeRef ref, std::int64_t start, std::int64_t stop) const
+        { return fAll.window(ref, start, stop); }
+
+      /// Hits of the `subsystem` with `ref` time in [ `start`, `stop` [ [ns].
+      Range window
+        (TimeRef ref, std::int64_t start, std::int64_t stop, int subsystem) const;
+
+    private:
+
+      /// Hits of a subsystem (or of all), sorted by each of the times.
+      struct Bucket {
+        std::vector<std::int64_t> ts0Times; ///< Sorted `ts0()` values.
+        std::vector<std::uint32_t> ts0Hits; ///< Hit of each of `ts0Times`.
+        std::vector<std::int64_t> ts1Times; ///< Sorted `ts1()` values.
+        std::vector<std::uint32_t> ts1Hits; ///< Hit of each of `ts1Times`.
+
+        Range window(TimeRef ref, std::int64_t start, std::int64_t stop) const;
+      };
+
+      Bucket fAll; ///< All the hits.
+      std::vector<int> fSubsystems; ///< Subsystem of each of `fBuckets`.
+      std::vector<Bucket> fBuckets; ///< Hits of each subsystem.
+
+      /// Fills the index, given the subsystem of each hit.
+      void build(std::vector<CRTHit> const& hits, std::vector<int> const& subsystem);
+
+    };
+
+} // namespace sbn::crt
+
+
+//------------------------------------------------------------------------------
+template <typename SubsystemFunc>
+sbn::crt::CRTHitTimeIndex::CRTHitTimeIndex
+  (std::vector<CRTHit> const& hits, SubsystemFunc subsystemOf)
+{
+  std::vector<int> subsystem;
+  subsystem.reserve(hits.size());
+  for (CRTHit const& hit: hits) subsystem.push_back(subsystemOf(hit));
+  build(hits, subsystem);
+}
+
+
+//------------------------------------------------------------------------------
+
+#endif
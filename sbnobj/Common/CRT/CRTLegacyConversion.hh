@@ -0,0 +1,192 @@
+/**
+ * \class CRTLegacyConversion
+ *
+ * \ingroup crt
+ *
+ * \brief Conversion of the legacy `sbnd::crt` and `icarus::crt` CRT objects
+ *
+ */
+
+#ifndef CRTLegacyConversion_hh_
+#define CRTLegacyConversion_hh_
+
+#include "sbnobj/Common/CRT/CRTHit.hh"
+#include "sbnobj/Common/CRT/CRTHitCollection.hh"
+#include "sbnobj/Common/CRT/CRTTrack.hh"
+#include "sbnobj/Common/CRT/CRTTzero.hh"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+/*
+ * The legacy types in `CRTHit_Legacy.hh`, `CRTTrack_Legacy.hh` and
+ * `CRTTzero_Legacy.hh` have the same layout in both the `sbnd::crt` and
+ * `icarus::crt` namespaces, so the conversions below take either of them.
+ *
+ * ROOT schema evolution can't do this conversion on read: _art_ looks up a
+ * data product by its type, and a product stored as e.g.
+ * `std::vector<icarus::crt::CRTHit>` stays of that type. Old files need to
+ * be read with the legacy types and converted with these functions, e.g. in
+ * a producer:
+ *
+ *     auto const& legacyHits
+ *       = event.getProduct<std::vector<icarus::crt::CRTHit>>(fLegacyHitTag);
+ *     event.put(std::make_unique<std::vector<sbn::crt::CRTHit>>
+ *       (sbn::crt::fromLegacyHits(legacyHits)));
+ *
+ */
+
+namespace sbn::crt {
+
+    /// Sets `hit` from the legacy `legacyHit`, reusing the memory of `hit`.
+    template <typename LegacyHit>
+    void fillFromLegacy(CRTHit& hit, LegacyHit const& legacyHit)
+      {
+        hit.feb_id.assign(legacyHit.feb_id.begin(), legacyHit.feb_id.end());
+        hit.pes.clear();
+        for (auto const& [ feb, channelPEs ]: legacyHit.pesmap) // sorted by FEB
+          for (auto const& [ channel, pe ]: channelPEs)
+            hit.pes.push_back(CRTHitPE{ feb, channel, pe });
+        hit.peshit = legacyHit.peshit;
+        hit.ts0_s = legacyHit.ts0_s;
+        hit.ts0_s_corr = legacyHit.ts0_s_corr;
+        hit.ts0_ns = legacyHit.ts0_ns;
+        hit.ts0_ns_corr = legacyHit.ts0_ns_corr;
+        hit.ts1_ns = legacyHit.ts1_ns;
+        hit.plane = legacyHit.plane;
+        hit.x_pos = legacyHit.x_pos;
+        hit.x_err = legacyHit.x_err;
+        hit.y_pos = legacyHit.y_pos;
+        hit.y_err = legacyHit.y_err;
+        hit.z_pos = legacyHit.z_pos;
+        hit.z_err = legacyHit.z_err;
+        hit.tagger = legacyHit.tagger;
+      }
+
+    /// Returns a `CRTHit` with the content of the legacy `legacyHit`.
+    template <typename LegacyHit>
+    CRTHit fromLegacyHit(LegacyHit const& legacyHit)
+      { CRTHit hit; fillFromLegacy(hit, legacyHit); return hit; }
+
+    /**
+     * @brief Converts legacy CRT tracks.
+     *
+     * The `feb_id` and `pesmap` of the legacy tracks are dropped, since
+     * `CRTTrack` does not have them any more.
+     */
+    template <typename LegacyTrack>
+    CRTTrack fromLegacyTrack(LegacyTrack const& legacyTrack)
+      {
+        CRTTrack track;
+        track.peshit = legacyTrack.peshit;
+        track.ts0_s = legacyTrack.ts0_s;
+        track.ts0_s_err = legacyTrack.ts0_s_err;
+        track.ts0_ns = legacyTrack.ts0_ns;
+        track.ts0_ns_err = legacyTrack.ts0_ns_err;
+        track.ts1_ns = legacyTrack.ts1_ns;
+        track.ts1_ns_err = legacyTrack.ts1_ns_err;
+        track.plane1 = legacyTrack.plane1;
+        track.plane2 = legacyTrack.plane2;
+        track.x1_pos = legacyTrack.x1_pos;
+        track.x1_err = legacyTrack.x1_err;
+        track.y1_pos = legacyTrack.y1_pos;
+        track.y1_err = legacyTrack.y1_err;
+        track.z1_pos = legacyTrack.z1_pos;
+        track.z1_err = legacyTrack.z1_err;
+        track.x2_pos = legacyTrack.x2_pos;
+        track.x2_err = legacyTrack.x2_err;
+        track.y2_pos = legacyTrack.y2_pos;
+        track.y2_err = legacyTrack.y2_err;
+        track.z2_pos = legacyTrack.z2_pos;
+        track.z2_err = legacyTrack.z2_err;
+        track.length = legacyTrack.length;
+        track.thetaxy = legacyTrack.thetaxy;
+        track.phizy = legacyTrack.phizy;
+        track.ts0_ns_h1 = legacyTrack.ts0_ns_h1;
+        track.ts0_ns_err_h1 = legacyTrack.ts0_ns_err_h1;
+        track.ts0_ns_h2 = legacyTrack.ts0_ns_h2;
+        track.ts0_ns_err_h2 = legacyTrack.ts0_ns_err_h2;
+        track.complete = legacyTrack.complete;
+        return track;
+      }
+
+    /// Returns a `CRTTzero` with the content of the legacy `legacyTzero`.
+    template <typename LegacyTzero>
+    CRTTzero fromLegacyTzero(LegacyTzero const& legacyTzero)
+      {
+        CRTTzero tzero;
+        tzero.ts0_s = legacyTzero.ts0_s;
+        tzero.ts0_s_err = legacyTzero.ts0_s_err;
+        tzero.ts0_ns = legacyTzero.ts0_ns;
+        tzero.ts0_ns_err = legacyTzero.ts0_ns_err;
+        tzero.ts1_ns = legacyTzero.ts1_ns;
+        tzero.ts1_ns_err = legacyTzero.ts1_ns_err;
+        std::copy(std::begin(legacyTzero.nhits), std::end(legacyTzero.nhits), tzero.nhits);
+        std::copy(std::begin(legacyTzero.pes), std::end(legacyTzero.pes), tzero.pes);
+        return tzero;
+      }
+
+
+    // --- bulk conversions, in the order of the legacy objects
+    template <typename LegacyHit>
+    std::vector<CRTHit> fromLegacyHits(std::vector<LegacyHit> const& legacyHits)
+      {
+        std::vector<CRTHit> hits(legacyHits.size());
+        for (std::size_t i = 0; i < hits.size(); ++i)
+          fillFromLegacy(hits[i], legacyHits[i]);
+        return hits;
+      }
+
+    template <typename LegacyTrack>
+    std::vector<CRTTrack> fromLegacyTracks(std::vector<LegacyTrack> const& legacyTracks)
+      {
+        std::vector<CRTTrack> tracks;
+        tracks.reserve(legacyTracks.size());
+        for (LegacyTrack const& track: legacyTracks)
+          tracks.push_back(fromLegacyTrack(track));
+        return tracks;
+      }
+
+    template <typename LegacyTzero>
+    std::vector<CRTTzero> fromLegacyTzeros(std::vector<LegacyTzero> const& legacyTzeros)
+      {
+        std::vector<CRTTzero> tzeros;
+        tzeros.reserve(legacyTzeros.size());
+        for (LegacyTzero const& tzero: legacyTzeros)
+          tzeros.push_back(fromLegacyTzero(tzero));
+        return tzeros;
+      }
+
+    /**
+     * @brief Fills a `CRTHitCollection` directly from legacy hits.
+     *
+     * The columns are sized in advance, and a single `CRTHit` is reused as
+     * conversion buffer, instead of converting into a `std::vector<CRTHit>`
+     * first.
+     */
+    template <typename LegacyHit>
+    CRTHitCollection makeCRTHitCollection(std::vector<LegacyHit> const& legacyHits)
+      {
+        std::size_t nFEBs = 0, nPEs = 0;
+        for (LegacyHit const& legacyHit: legacyHits) {
+          nFEBs += legacyHit.feb_id.size();
+          for (auto const& channelPEs: legacyHit.pesmap)
+            nPEs += channelPEs.second.size();
+        }
+
+        CRTHitCollection hits;
+        hits.reserve(legacyHits.size(), nFEBs, nPEs);
+        CRTHit buffer;
+        for (LegacyHit const& legacyHit: legacyHits) {
+          fillFromLegacy(buffer, legacyHit);
+          hits.push_back(buffer);
+        }
+        return hits;
+      }
+
+} // namespace sbn::crt
+
+#endif
@@ -0,0 +1,30 @@
+#include "sbnobj/Common/CRT/CRTPMTMatchTable.hh"
+
+#include "cetlib_except/exception.h"
+
+#include <algorithm>
+#include <utility>
+
+sbn::crt::CRTPMTMatchTable::CRTPMTMatchTable
+  (std::size_t nFlashes, std::vector<CRTPMTMatchRow> matches)
+  : fRows(std::move(matches))
+{
+
+  for (CRTPMTMatchRow const& row: fRows) {
+    if (row.flash < nFlashes) continue;
+    throw cet::exception("CRTPMTMatchTable")
+      << "Match with flash #" << row.flash << " (CRT hit #" << row.hit
+      << ") but only " << nFlashes << " flashes.\n";
+  }
+
+  std::stable_sort(fRows.begin(), fRows.end(),
+    [](CRTPMTMatchRow const& a, CRTPMTMatchRow const& b)
+      { return (a.flash != b.flash)? (a.flash < b.flash): (a.hit < b.hit); }
+    );
+
+  // counting pass, then the running sum gives the first match of each flash
+  fOffsets.assign(nFlashes + 1, 0);
+  for (CRTPMTMatchRow const& row: fRows) ++fOffsets[row.flash + 1];
+  for (std::size_t i = 1; i <= nFlashes; ++i) fOffsets[i] += fOffsets[i - 1];
+
+} // sbn::crt::CRTPMTMatchTable::CRTPMTMatchTable()
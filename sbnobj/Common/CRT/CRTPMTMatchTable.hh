@@ -0,0 +1,134 @@
+/**
+ * @file   sbnobj/Common/CRT/CRTPMTMatchTable.hh
+ * @brief  Per-event table of all the flash-CRT hit matches, sorted by flash
+ */
+
+#ifndef CRTPMTMATCHTABLE_hh_
+#define CRTPMTMATCHTABLE_hh_
+
+#include "sbnobj/Common/CRT/CRTPMTMatching.hh"
+
+// C++ includes
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace sbn::crt {
+
+  /**
+   * @brief One match of a flash and a CRT hit, with its information.
+   *
+   * Flash and CRT hit are identified by their index in their data products
+   * (as `art::Ptr::key()`). The time of flight is in single precision, in
+   * microseconds, as the times of `CompactMatchedCRT`;
+   * `CRTPMTMatchingInfo::NoTime` is stored as `NoTime`.
+   */
+  struct CRTPMTMatchRow {
+
+    /// Special value to indicate the lack of information on a time.
+    static constexpr float NoTime = std::numeric_limits<float>::lowest();
+
+    std::uint32_t flash = 0; ///< Index of the flash in its data product.
+    std::uint32_t hit = 0; ///< Index of the CRT hit in its data product.
+
+    /// Whether CRT hit describes a particle entering the detector of exiting.
+    CRTPMTMatchingInfo::Dir direction = CRTPMTMatchingInfo::Dir::unknown;
+    float timeOfFlight = NoTime; ///< CRT hit time minus PMT flash time [us]
+    float distance = 0.f; ///< Distance between CRT Hit and optical flash centroid [cm]
+
+    CRTPMTMatchRow() = default;
+
+    CRTPMTMatchRow
+      (std::uint32_t flash, std::uint32_t hit, CRTPMTMatchingInfo const& info)
+      : flash(flash), hit(hit), direction(info.direction)
+      , timeOfFlight((info.timeOfFlight == CRTPMTMatchingInfo::NoTime)
+          ? NoTime: static_cast<float>(info.timeOfFlight))
+      , distance(static_cast<float>(info.distance))
+      {}
+
+    /// Returns the match information in the association metadata form.
+    CRTPMTMatchingInfo info() const
+      {
+        CRTPMTMatchingInfo info;
+        info.direction = direction;
+        info.timeOfFlight = (timeOfFlight == NoTime)
+          ? CRTPMTMatchingInfo::NoTime: static_cast<double>(timeOfFlight);
+        info.distance = distance;
+        return info;
+      }
+
+  };
+
+
+  /**
+   * @brief All the matches of flashes and CRT hits of an event, by flash.
+   *
+   * This is the content of an association flash-CRT hit with
+   * `CRTPMTMatchingInfo` metadata, stored as a single array of rows sorted by
+   * flash (and by CRT hit within each flash) instead of pairs of `art::Ptr`
+   * and a separate metadata collection. The matches of each flash are a
+   * contiguous range, found in constant time:
+   *
+   *     for (sbn::crt::CRTPMTMatchRow const& match: table.matches(iFlash)) {
+   *       sbn::crt::CRTHit const& hit = crtHits[match.hit];
+   *       // ...
+   *     }
+   */
+  class CRTPMTMatchTable {
+
+  public:
+
+    /// Range of the matches of a flash.
+    struct Range {
+      CRTPMTMatchRow const* first = nullptr;
+      CRTPMTMatchRow const* last = nullptr;
+
+      CRTPMTMatchRow const* begin() const { return first; }
+      CRTPMTMatchRow const* end() const { return last; }
+      std::size_t size() const { return last - first; }
+      bool empty() const { return first == last; }
+    };
+
+    CRTPMTMatchTable() = default;
+
+    /**
+     * @brief Creates the table of the `matches` of `nFlashes` flashes.
+     * @param nFlashes number of flashes in the flash data product
+     * @param matches all the matches, in any order
+     * @throw cet::exception if a match has a flash index not below `nFlashes`
+     */
+    CRTPMTMatchTable(std::size_t nFlashes, std::vector<CRTPMTMatchRow> matches);
+
+    /// Number of flashes (matched or not) in the flash data product.
+    std::size_t nFlashes() const { return fOffsets.size() - 1; }
+
+    /// Total number of matches, from all the flashes.
+    std::size_t size() const { return fRows.size(); }
+    bool empty() const { return fRows.empty(); }
+
+    /// Matches of the flash with index `flash` (empty if out of range).
+    Range matches(std::size_t flash) const
+      {
+        if (flash >= nFlashes()) return {};
+        return { fRows.data() + fOffsets[flash], fRows.data() + fOffsets[flash + 1] };
+      }
+
+    /// Number of matches of the flash with index `flash`.
+    std::size_t nMatches(std::size_t flash) const { return matches(flash).size(); }
+
+    // --- direct access to the storage
+    std::vector<CRTPMTMatchRow> const& rows() const { return fRows; }
+    std::vector<std::uint32_t> const& offsets() const { return fOffsets; }
+
+  private:
+
+    std::vector<CRTPMTMatchRow> fRows; ///< All the matches, sorted by flash and hit.
+    std::vector<std::uint32_t> fOffsets{ 0 }; ///< First match of each flash, plus the end.
+
+  };
+
+} // namespace sbn::crt
+
+
+#endif
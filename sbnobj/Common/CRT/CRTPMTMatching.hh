@@ -9,9 +9,11 @@
 #define CRTPMTMATCHING_hh_
 
 // C++ includes
+#include <array>
 #include <vector>
 #include <limits>
 #include "larcoreobj/SimpleTypesAndConstants/geo_vectors.h"
+#include "sbnobj/Common/Utilities/TimeNs.h"
 
 namespace sbn::crt {
 
@@ -33,6 +35,93 @@ namespace sbn::crt {
       exSide_enBottom   = 14, ///< Matched with one Bottom CRT hit before the optical flash and matched with one Side CRT hit after the optical flash.
       others            = 9  ///< All the other cases.
       };
+
+  /**
+   * @brief Classification of a flash from its CRT hit counts.
+   *
+   * Each of the six counts (top, side and bottom CRT hits before and after
+   * the flash) is reduced to a 2-bit code: 0, 1, 2 for "two or more", and 3
+   * for `CRTPMTMatching::NoCount`. The packed codes index `MatchTypeTable`,
+   * which is filled at compile time by `classifyMatchCode()`, so that
+   * `classifyMatch()` is a single lookup without branches.
+   *
+   * Counts with no information yield `MatchType::others`.
+   */
+  namespace matchtype {
+
+    /// Number of distinct packed count codes.
+    constexpr unsigned NCodes = 1U << 12;
+
+    /// 2-bit code of a hit count; `NoCount` is `unsigned int` maximum.
+    constexpr unsigned countCode(unsigned n)
+      {
+        return (n == std::numeric_limits<unsigned int>::max())
+          ? 3U: ((n < 2U)? n: 2U);
+      }
+
+    /// Packs the codes of the six counts into a table index.
+    constexpr unsigned packCounts(
+      unsigned topBefore, unsigned sideBefore, unsigned bottomBefore,
+      unsigned topAfter, unsigned sideAfter, unsigned bottomAfter
+      )
+      {
+        return countCode(topBefore) | (countCode(sideBefore) << 2)
+          | (countCode(bottomBefore) << 4) | (countCode(topAfter) << 6)
+          | (countCode(sideAfter) << 8) | (countCode(bottomAfter) << 10);
+      }
+
+    /// Classification of the packed count codes; used to fill the table.
+    constexpr MatchType classifyMatchCode(unsigned code)
+      {
+        unsigned const tb = code & 3U, sb = (code >> 2) & 3U, bb = (code >> 4) & 3U;
+        unsigned const ta = (code >> 6) & 3U, sa = (code >> 8) & 3U, ba = (code >> 10) & 3U;
+        if ((tb == 3U) || (sb == 3U) || (bb == 3U) || (ta == 3U) || (sa == 3U) || (ba == 3U))
+          return MatchType::others;
+
+        // code of a combination of (top, side, bottom) before and after
+        auto const is = [code](unsigned t0, unsigned s0, unsigned b0, unsigned t1, unsigned s1, unsigned b1)
+          { return code == (t0 | (s0 << 2) | (b0 << 4) | (t1 << 6) | (s1 << 8) | (b1 << 10)); };
+
+        if (is(0, 0, 0, 0, 0, 0)) return MatchType::noMatch;
+        if (is(1, 0, 0, 0, 0, 0)) return MatchType::enTop;
+        if (is(0, 1, 0, 0, 0, 0)) return MatchType::enSide;
+        if (is(1, 0, 0, 0, 1, 0)) return MatchType::enTop_exSide;
+        if (is(0, 0, 0, 1, 0, 0)) return MatchType::exTop;
+        if (is(0, 0, 0, 0, 1, 0)) return MatchType::exSide;
+        if (is(2, 0, 0, 0, 0, 0)) return MatchType::enTop_mult;
+        if (is(2, 0, 0, 0, 2, 0)) return MatchType::enTop_exSide_mult;
+        if (is(0, 0, 1, 0, 0, 0)) return MatchType::enBottom;
+        if (is(0, 0, 0, 0, 0, 1)) return MatchType::exBottom;
+        if (is(1, 0, 0, 0, 0, 1)) return MatchType::enTop_exBottom;
+        if (is(0, 1, 0, 0, 0, 1)) return MatchType::enSide_exBottom;
+        if (is(0, 0, 1, 1, 0, 0)) return MatchType::exTop_enBottom;
+        if (is(0, 0, 1, 0, 1, 0)) return MatchType::exSide_enBottom;
+        return MatchType::others;
+      }
+
+    constexpr std::array<MatchType, NCodes> makeMatchTypeTable()
+      {
+        std::array<MatchType, NCodes> table{};
+        for (unsigned code = 0; code < NCodes; ++code)
+          table[code] = classifyMatchCode(code);
+        return table;
+      }
+
+    /// Classification of all the packed count codes.
+    inline constexpr std::array<MatchType, NCodes> MatchTypeTable = makeMatchTypeTable();
+
+  } // namespace matchtype
+
+  /// Returns the classification of a flash with the specified CRT hit counts.
+  constexpr MatchType classifyMatch(
+    unsigned topBefore, unsigned sideBefore, unsigned bottomBefore,
+    unsigned topAfter, unsigned sideAfter, unsigned bottomAfter
+    )
+    {
+      return matchtype::MatchTypeTable[matchtype::packCounts
+        (topBefore, sideBefore, bottomBefore, topAfter, sideAfter, bottomAfter)];
+    }
+
   /// Information about a CRT hit matched with a PMT flash.
   struct MatchedCRT {
 
@@ -47,6 +136,12 @@ namespace sbn::crt {
     double time;//        = NoTime;     ///< CRT hit time [us]
     int sys;     //       = NoLocation; ///< CRT subdetector the hit fell into.
     int region;//         = NoLocation; ///< Region the matched CRT hit fell into.
+
+    /// CRT hit time (`time`), invalid if `NoTime`.
+    sbn::TimeNs_t timeNs() const { return sbn::TimeNs_t::fromMicroseconds(time); }
+
+    /// CRT hit time minus PMT flash time (`PMTTimeDiff`), invalid if `NoTime`.
+    sbn::TimeNs_t PMTTimeDiffNs() const { return sbn::TimeNs_t::fromMicroseconds(PMTTimeDiff); }
   };
 
   struct CRTPMTMatching{
@@ -90,6 +185,22 @@ namespace sbn::crt {
     /// Returns whether the information in this record is in any way valid.
     bool isValid() const { return flashID != NoID; }
 
+    /// Time of the flash w.r.t. the global trigger (`flashTime`).
+    sbn::TimeNs_t flashTimeNs() const { return sbn::TimeNs_t::fromMicroseconds(flashTime); }
+
+    /// Time of the flash w.r.t. the beam gate opening (`flashGateTime`).
+    sbn::TimeNs_t flashGateTimeNs() const { return sbn::TimeNs_t::fromMicroseconds(flashGateTime); }
+
+    /// Classification from the hit counts (bottom counts are not stored here).
+    MatchType classifyCounts
+      (unsigned int nBottomCRTHitsBefore = 0, unsigned int nBottomCRTHitsAfter = 0) const
+      {
+        return classifyMatch(
+          nTopCRTHitsBefore, nSideCRTHitsBefore, nBottomCRTHitsBefore,
+          nTopCRTHitsAfter, nSideCRTHitsAfter, nBottomCRTHitsAfter
+          );
+      }
+
   };
 
   /// Additional information about the matching of one flash and one CRT hit.
@@ -107,6 +218,9 @@ namespace sbn::crt {
     double timeOfFlight = NoTime; ///< CRT hit time minus PMT flash time [us]
     double distance; ///< Distance between CRT Hit and optical flash centroid [cm]
 
+    /// CRT hit time minus PMT flash time (`timeOfFlight`), invalid if `NoTime`.
+    sbn::TimeNs_t timeOfFlightNs() const { return sbn::TimeNs_t::fromMicroseconds(timeOfFlight); }
+
   }; // CRTPMTMatchingInfo
 
 
@@ -0,0 +1,82 @@
+#include "sbnobj/Common/CRT/CRTPMTMatchingCollection.hh"
+
+#include <utility>
+
+sbn::crt::CRTPMTMatchingCollection::CRTPMTMatchingCollection
+  (std::vector<CRTPMTMatching> const& matchings)
+{
+
+  std::size_t nMatches = 0;
+  for (CRTPMTMatching const& matching: matchings)
+    nMatches += matching.matchedCRTHits.size();
+
+  reserve(matchings.size(), nMatches);
+  for (CRTPMTMatching const& matching: matchings) push_back(matching);
+
+} // sbn::crt::CRTPMTMatchingCollection::CRTPMTMatchingCollection()
+
+
+void sbn::crt::CRTPMTMatchingCollection::reserve
+  (std::size_t nFlashes, std::size_t nMatches)
+{
+
+  fFlashes.reserve(nFlashes);
+  fMatches.reserve(nMatches);
+  fOffsets.reserve(nFlashes + 1);
+
+} // sbn::crt::CRTPMTMatchingCollection::reserve()
+
+
+void sbn::crt::CRTPMTMatchingCollection::push_back
+  (CRTPMTMatching const& matching)
+{
+
+  appendMatches(matching.matchedCRTHits);
+  fFlashes.push_back(matching);
+  fFlashes.back().matchedCRTHits = {};
+
+} // sbn::crt::CRTPMTMatchingCollection::push_back()
+
+
+void sbn::crt::CRTPMTMatchingCollection::push_back(CRTPMTMatching&& matching) {
+
+  appendMatches(matching.matchedCRTHits);
+  matching.matchedCRTHits = {};
+  fFlashes.push_back(std::move(matching));
+
+} // sbn::crt::CRTPMTMatchingCollection::push_back()
+
+
+sbn::crt::CRTPMTMatching sbn::crt::CRTPMTMatchingCollection::matching
+  (std::size_t i) const
+{
+
+  CRTPMTMatching matching = fFlashes.at(i);
+  Range const hits = matches(i);
+  matching.matchedCRTHits.reserve(hits.size());
+  for (CompactMatchedCRT const& hit: hits)
+    matching.matchedCRTHits.push_back(hit.toMatchedCRT());
+  return matching;
+
+} // sbn::crt::CRTPMTMatchingCollection::matching()
+
+
+std::vector<sbn::crt::CRTPMTMatching>
+sbn::crt::CRTPMTMatchingCollection::toMatchings() const {
+
+  std::vector<CRTPMTMatching> matchings;
+  matchings.reserve(size());
+  for (std::size_t i = 0; i < size(); ++i) matchings.push_back(matching(i));
+  return matchings;
+
+} // sbn::crt::CRTPMTMatchingCollection::toMatchings()
+
+
+void sbn::crt::CRTPMTMatchingCollection::appendMatches
+  (std::vector<MatchedCRT> const& matches)
+{
+
+  for (MatchedCRT const& match: matches) fMatches.emplace_back(match);
+  fOffsets.push_back(fMatches.size());
+
+} // sbn::crt::CRTPMTMatchingCollection::appendMatches()
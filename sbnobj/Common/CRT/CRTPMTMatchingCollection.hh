@@ -0,0 +1,143 @@
+/**
+ * @file   sbnobj/Common/CRT/CRTPMTMatchingCollection.hh
+ * @brief  Per-event collection of CRT PMT matches with contiguous CRT hit storage
+ */
+
+#ifndef CRTPMTMATCHINGCOLLECTION_hh_
+#define CRTPMTMATCHINGCOLLECTION_hh_
+
+#include "sbnobj/Common/CRT/CRTPMTMatching.hh"
+
+// C++ includes
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace sbn::crt {
+
+  /**
+   * @brief `MatchedCRT` with single precision time and position.
+   *
+   * Times are in microseconds from the global trigger, where `float` still
+   * resolves about a nanosecond up to 8 ms, well past the readout window;
+   * positions are in centimetres. `MatchedCRT::NoTime` is stored as `NoTime`.
+   */
+  struct CompactMatchedCRT {
+
+    /// Special value to indicate the lack of information on a time.
+    static constexpr float NoTime = std::numeric_limits<float>::lowest();
+
+    float x = 0.f; ///< Hit location on x [cm]
+    float y = 0.f; ///< Hit location on y [cm]
+    float z = 0.f; ///< Hit location on z [cm]
+    float PMTTimeDiff = NoTime; ///< CRT hit time minus PMT flash time [us]
+    float time = NoTime;        ///< CRT hit time [us]
+    int sys = MatchedCRT::NoLocation;    ///< CRT subdetector the hit fell into.
+    int region = MatchedCRT::NoLocation; ///< Region the matched CRT hit fell into.
+
+    CompactMatchedCRT() = default;
+
+    explicit CompactMatchedCRT(MatchedCRT const& match)
+      : x(match.position.X()), y(match.position.Y()), z(match.position.Z())
+      , PMTTimeDiff(toCompactTime(match.PMTTimeDiff))
+      , time(toCompactTime(match.time))
+      , sys(match.sys), region(match.region)
+      {}
+
+    /// Returns the match in the double precision form.
+    MatchedCRT toMatchedCRT() const
+      {
+        return MatchedCRT{
+          geo::Point_t{ x, y, z },
+          fromCompactTime(PMTTimeDiff), fromCompactTime(time),
+          sys, region
+          };
+      }
+
+    static float toCompactTime(double t)
+      { return (t == MatchedCRT::NoTime)? NoTime: static_cast<float>(t); }
+    static double fromCompactTime(float t)
+      { return (t == NoTime)? MatchedCRT::NoTime: static_cast<double>(t); }
+
+  };
+
+
+  /**
+   * @brief CRT PMT matches of all the flashes of an event.
+   *
+   * The matched CRT hits of all the flashes are stored in a single array,
+   * each flash owning the range between two consecutive offsets, instead of
+   * one `std::vector<MatchedCRT>` per flash.
+   * The flash information is kept as `CRTPMTMatching` objects with an empty
+   * `matchedCRTHits`; `matching()` returns a complete copy.
+   */
+  class CRTPMTMatchingCollection {
+
+  public:
+
+    /// Range of matched CRT hits of a flash.
+    struct Range {
+      CompactMatchedCRT const* first = nullptr;
+      CompactMatchedCRT const* last = nullptr;
+
+      CompactMatchedCRT const* begin() const { return first; }
+      CompactMatchedCRT const* end() const { return last; }
+      std::size_t size() const { return last - first; }
+      bool empty() const { return first == last; }
+    };
+
+    CRTPMTMatchingCollection() = default;
+
+    /// Creates a collection with a copy of all the `matchings`.
+    explicit CRTPMTMatchingCollection(std::vector<CRTPMTMatching> const& matchings);
+
+    /// Number of flashes in the collection.
+    std::size_t size() const { return fFlashes.size(); }
+    bool empty() const { return fFlashes.empty(); }
+
+    /// Total number of matched CRT hits, from all the flashes.
+    std::size_t nMatches() const { return fMatches.size(); }
+
+    /// Reserves room for `nFlashes` flashes and `nMatches` matched CRT hits.
+    void reserve(std::size_t nFlashes, std::size_t nMatches = 0);
+
+    /// Adds a copy of the `matching` at the end of the collection.
+    void push_back(CRTPMTMatching const& matching);
+
+    /// Adds the `matching` at the end of the collection, stealing its content.
+    void push_back(CRTPMTMatching&& matching);
+
+    /// Information of flash `i`, with an empty `matchedCRTHits`.
+    CRTPMTMatching const& flash(std::size_t i) const { return fFlashes[i]; }
+
+    /// Matched CRT hits of flash `i`.
+    Range matches(std::size_t i) const
+      { return { fMatches.data() + fOffsets[i], fMatches.data() + fOffsets[i + 1] }; }
+
+    /// Returns a complete copy of the matching of flash `i`.
+    CRTPMTMatching matching(std::size_t i) const;
+
+    /// Returns a complete copy of all the matchings.
+    std::vector<CRTPMTMatching> toMatchings() const;
+
+    // --- direct access to the storage
+    std::vector<CRTPMTMatching> const& flashes() const { return fFlashes; }
+    std::vector<CompactMatchedCRT> const& allMatches() const { return fMatches; }
+    std::vector<std::uint32_t> const& offsets() const { return fOffsets; }
+
+  private:
+
+    std::vector<CRTPMTMatching> fFlashes; ///< Flash information, without CRT hits.
+    std::vector<CompactMatchedCRT> fMatches; ///< Matched CRT hits of all flashes.
+    std::vector<std::uint32_t> fOffsets{ 0 }; ///< First match of each flash, plus the end.
+
+    /// Appends the matched CRT hits of a flash and closes its range.
+    void appendMatches(std::vector<MatchedCRT> const& matches);
+
+  };
+
+} // namespace sbn::crt
+
+
+#endif
@@ -0,0 +1,144 @@
+/**
+ * \class CRTHitTimestamps
+ *
+ * \ingroup crt
+ *
+ * \brief Compact integer timestamps of CRT hits and tracks
+ *
+ */
+
+#ifndef CRTTimestamps_hh_
+#define CRTTimestamps_hh_
+
+#include "sbnobj/Common/CRT/CRTHit.hh"
+#include "sbnobj/Common/CRT/CRTTrack.hh"
+
+#include <cmath> // std::floor(), std::llround()
+#include <cstdint>
+
+namespace sbn::crt {
+
+    /**
+     * @brief Times of a `CRTHit`, with a single integer per clock.
+     *
+     * The accessors have the names of the `CRTHit` data members they stand
+     * for.
+     * The nanosecond parts are stored as integers, so any fraction of
+     * nanosecond of the `CRTHit` times is dropped, as `CRTHit::ts0()` and
+     * `CRTHit::ts1()` already do.
+     */
+    struct CRTHitTimestamps {
+
+      static constexpr int64_t NsPerSecond = 1'000'000'000LL;
+
+      int64_t       t0 = 0; ///< Timestamp T0, in UTC nanoseconds from the Epoch (`CRTHit::ts0()`).
+      int64_t       t1 = 0; ///< Timestamp T1 [ns] (`CRTHit::ts1()`).
+      float    s_corr = 0.; ///< `CRTHit::ts0_s_corr`.
+      float   ns_corr = 0.; ///< `CRTHit::ts0_ns_corr`.
+
+      CRTHitTimestamps() = default;
+
+      explicit CRTHitTimestamps(CRTHit const& hit)
+        : t0(hit.ts0()), t1(hit.ts1())
+        , s_corr(hit.ts0_s_corr), ns_corr(hit.ts0_ns_corr)
+        {}
+
+      int64_t ts0() const { return t0; }
+      int64_t ts1() const { return t1; }
+      uint64_t ts0_s() const { return static_cast<uint64_t>(t0 / NsPerSecond); }
+      double ts0_ns() const { return static_cast<double>(t0 % NsPerSecond); }
+      double ts0_s_corr() const { return s_corr; }
+      double ts0_ns_corr() const { return ns_corr; }
+      double ts1_ns() const { return static_cast<double>(t1); }
+
+      /// Sets the time data members of `hit` to these times.
+      void setTimes(CRTHit& hit) const
+        {
+          hit.ts0_s = ts0_s();
+          hit.ts0_ns = ts0_ns();
+          hit.ts0_s_corr = ts0_s_corr();
+          hit.ts0_ns_corr = ts0_ns_corr();
+          hit.ts1_ns = ts1_ns();
+        }
+
+    };
+
+
+    /**
+     * @brief Times of a `CRTTrack`, with a single integer per clock.
+     *
+     * The accessors have the names of the `CRTTrack` data members they stand
+     * for; errors are stored as `float`.
+     *
+     * `CRTTrack::ts0_s` is an average of seconds, and it may be fractional:
+     * its fraction is rounded to the closest nanosecond and moved into the
+     * nanosecond part, so `ts0_s()` is always integral. As for hits, any
+     * fraction of nanosecond of the nanosecond times is dropped.
+     */
+    struct CRTTrackTimestamps {
+
+      static constexpr int64_t NsPerSecond = CRTHitTimestamps::NsPerSecond;
+
+      int64_t        t0 = 0; ///< Average T0 of the two hits [ns] (`ts0_s` and `ts0_ns` combined).
+      int64_t        t1 = 0; ///< Average T1 of the two hits [ns] (`ts1_ns`).
+      int64_t     t0_h1 = 0; ///< T0 of the first hit [ns] (`ts0_ns_h1`).
+      int64_t     t0_h2 = 0; ///< T0 of the second hit [ns] (`ts0_ns_h2`).
+      float       s_err = 0.; ///< `CRTTrack::ts0_s_err`.
+      float      ns_err = 0.; ///< `CRTTrack::ts0_ns_err`.
+      float      t1_err = 0.; ///< `CRTTrack::ts1_ns_err`.
+      float      err_h1 = 0.; ///< `CRTTrack::ts0_ns_err_h1`.
+      float      err_h2 = 0.; ///< `CRTTrack::ts0_ns_err_h2`.
+
+      CRTTrackTimestamps() = default;
+
+      explicit CRTTrackTimestamps(CRTTrack const& track)
+        : t0(timestamp(track.ts0_s, track.ts0_ns))
+        , t1(static_cast<int64_t>(track.ts1_ns))
+        , t0_h1(static_cast<int64_t>(track.ts0_ns_h1))
+        , t0_h2(static_cast<int64_t>(track.ts0_ns_h2))
+        , s_err(track.ts0_s_err), ns_err(track.ts0_ns_err), t1_err(track.ts1_ns_err)
+        , err_h1(track.ts0_ns_err_h1), err_h2(track.ts0_ns_err_h2)
+        {}
+
+      int64_t ts0() const { return t0; }
+      int64_t ts1() const { return t1; }
+      double ts0_s() const { return static_cast<double>(t0 / NsPerSecond); }
+      double ts0_s_err() const { return s_err; }
+      double ts0_ns() const { return static_cast<double>(t0 % NsPerSecond); }
+      double ts0_ns_err() const { return ns_err; }
+      double ts1_ns() const { return static_cast<double>(t1); }
+      double ts1_ns_err() const { return t1_err; }
+      double ts0_ns_h1() const { return static_cast<double>(t0_h1); }
+      double ts0_ns_err_h1() const { return err_h1; }
+      double ts0_ns_h2() const { return static_cast<double>(t0_h2); }
+      double ts0_ns_err_h2() const { return err_h2; }
+
+      /// Returns the nanoseconds of `seconds` and `ns` combined (see above).
+      static int64_t timestamp(double seconds, double ns)
+        {
+          double const wholeSeconds = std::floor(seconds);
+          return static_cast<int64_t>(wholeSeconds) * NsPerSecond
+            + std::llround((seconds - wholeSeconds) * NsPerSecond)
+            + static_cast<int64_t>(ns);
+        }
+
+      /// Sets the time data members of `track` to these times.
+      void setTimes(CRTTrack& track) const
+        {
+          track.ts0_s = ts0_s();
+          track.ts0_s_err = ts0_s_err();
+          track.ts0_ns = ts0_ns();
+          track.ts0_ns_err = ts0_ns_err();
+          track.ts1_ns = ts1_ns();
+          track.ts1_ns_err = ts1_ns_err();
+          track.ts0_ns_h1 = ts0_ns_h1();
+          track.ts0_ns_err_h1 = ts0_ns_err_h1();
+          track.ts0_ns_h2 = ts0_ns_h2();
+          track.ts0_ns_err_h2 = ts0_ns_err_h2();
+        }
+
+    };
+
+} // namespace sbn::crt
+
+#endif
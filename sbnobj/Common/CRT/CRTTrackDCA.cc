@@ -0,0 +1,119 @@
+#include "sbnobj/Common/CRT/CRTTrackDCA.hh"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+  /// `std::atan2(y, x)` for non-negative `y` and `x` (error below 1e-5),
+  /// without branches nor library calls so that loops using it vectorize.
+  inline float firstQuadrantAtan2(float y, float x) {
+    // the tiny offset avoids 0/0 without a conditional division
+    float const t = std::min(y, x) / (std::max(y, x) + 1e-30f);
+    float const t2 = t * t;
+    float const a = t * (0.99997726f + t2 * (-0.33262347f + t2 * (0.19354346f
+      + t2 * (-0.11643287f + t2 * (0.05265332f + t2 * -0.01172120f)))));
+    float const flip = (y > x); // 1 if the angle is above pi/4
+    return a + flip * (1.57079633f - 2.f * a);
+  }
+
+  /// Distance and angle of the TPC line from each of the `n` CRT tracks.
+  void trackDCAkernel(std::size_t n,
+    float const* __restrict__ x1, float const* __restrict__ y1,
+    float const* __restrict__ z1, float const* __restrict__ x2,
+    float const* __restrict__ y2, float const* __restrict__ z2,
+    sbn::crt::TPCTrackLine const& tpc,
+    float* __restrict__ dca, float* __restrict__ angle
+  ) {
+    float const ux = tpc.dx, uy = tpc.dy, uz = tpc.dz;
+    float const px = tpc.x, py = tpc.y, pz = tpc.z;
+    float const uu = ux * ux + uy * uy + uz * uz;
+
+    for (std::size_t i = 0; i < n; ++i) {
+      // CRT track direction v, and w from the CRT track to the TPC track
+      float const vx = x2[i] - x1[i], vy = y2[i] - y1[i], vz = z2[i] - z1[i];
+      float const wx = px - x1[i], wy = py - y1[i], wz = pz - z1[i];
+
+      // the distance is the projection of w on the common normal n = u x v
+      float const nx = uy * vz - uz * vy;
+      float const ny = uz * vx - ux * vz;
+      float const nz = ux * vy - uy * vx;
+      float const nn = nx * nx + ny * ny + nz * nz;
+      float const wn = wx * nx + wy * ny + wz * nz;
+      float const vv = vx * vx + vy * vy + vz * vz;
+
+      // parallel lines: distance of the TPC point from the CRT line, |w x v|/|v|
+      float const cx = wy * vz - wz * vy;
+      float const cy = wz * vx - wx * vz;
+      float const cz = wx * vy - wy * vx;
+      float const cc = cx * cx + cy * cy + cz * cz;
+      // coincident CRT hits: distance of the CRT point from the TPC line, |w x u|/|u|
+      float const dx = wy * uz - wz * uy;
+      float const dy = wz * ux - wx * uz;
+      float const dz = wx * uy - wy * ux;
+      float const dd = dx * dx + dy * dy + dz * dz;
+
+      // parallel if sin^2(angle) below 1e-10 (angles below about 10 urad)
+      float const parallel = (nn <= 1e-10f * uu * vv);
+      float const point = (vv == 0.f);
+      // the three candidates are blended rather than selected (branches would
+      // prevent vectorization); denominators are kept away from 0 since all
+      // of them are always computed
+      float const skewDCA2 = wn * wn / std::max(nn, 1e-30f);
+      float const parallelDCA2 = cc / std::max(vv, 1e-30f);
+      float const pointDCA2 = dd / uu;
+      float const lineDCA2 = skewDCA2 + parallel * (parallelDCA2 - skewDCA2);
+      dca[i] = lineDCA2 + point * (pointDCA2 - lineDCA2);
+      angle[i] = std::min(nn / std::max(uu * vv, 1e-30f), 1.f); // sin^2
+    } // for
+
+    // DCA from its square, angle from sin^2
+    for (std::size_t i = 0; i < n; ++i) {
+      dca[i] = std::sqrt(dca[i]);
+      angle[i] = firstQuadrantAtan2(std::sqrt(angle[i]), std::sqrt(1.f - angle[i]));
+    } // for
+  } // trackDCAkernel()
+
+} // local namespace
+
+
+sbn::crt::CRTTrackPoints::CRTTrackPoints(std::vector<CRTTrack> const& tracks) {
+
+  x1.reserve(tracks.size());
+  y1.reserve(tracks.size());
+  z1.reserve(tracks.size());
+  x2.reserve(tracks.size());
+  y2.reserve(tracks.size());
+  z2.reserve(tracks.size());
+  for (CRTTrack const& track: tracks) {
+    x1.push_back(track.x1_pos);
+    y1.push_back(track.y1_pos);
+    z1.push_back(track.z1_pos);
+    x2.push_back(track.x2_pos);
+    y2.push_back(track.y2_pos);
+    z2.push_back(track.z2_pos);
+  }
+
+} // sbn::crt::CRTTrackPoints::CRTTrackPoints()
+
+
+void sbn::crt::CRTTrackDCA
+  (CRTTrackPoints const& crt, TPCTrackLine const& tpc, float* dca, float* angle)
+{
+  trackDCAkernel(crt.size(),
+    crt.x1.data(), crt.y1.data(), crt.z1.data(),
+    crt.x2.data(), crt.y2.data(), crt.z2.data(),
+    tpc, dca, angle);
+} // sbn::crt::CRTTrackDCA()
+
+
+void sbn::crt::CRTTrackDCA(
+  CRTTrackPoints const& crt, std::vector<TPCTrackLine> const& tpc,
+  std::vector<float>& dca, std::vector<float>& angle
+) {
+  std::size_t const n = crt.size();
+  dca.resize(tpc.size() * n);
+  angle.resize(tpc.size() * n);
+  for (std::size_t i = 0; i < tpc.size(); ++i)
+    CRTTrackDCA(crt, tpc[i], dca.data() + i * n, angle.data() + i * n);
+} // sbn::crt::CRTTrackDCA()
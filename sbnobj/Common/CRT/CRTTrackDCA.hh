@@ -0,0 +1,79 @@
+/**
+ * \class CRTTrackPoints
+ *
+ * \ingroup crt
+ *
+ * \brief Distance of closest approach between CRT tracks and TPC tracks
+ *
+ */
+
+#ifndef CRTTrackDCA_hh_
+#define CRTTrackDCA_hh_
+
+#include "sbnobj/Common/CRT/CRTTrack.hh"
+
+#include <cstddef>
+#include <vector>
+
+namespace sbn::crt {
+
+    /// Positions of the two hits of each of a set of CRT tracks, by column.
+    struct CRTTrackPoints {
+
+      std::vector<float> x1; ///< X position of first CRTHit of each track.
+      std::vector<float> y1; ///< Y position of first CRTHit of each track.
+      std::vector<float> z1; ///< Z position of first CRTHit of each track.
+      std::vector<float> x2; ///< X position of second CRTHit of each track.
+      std::vector<float> y2; ///< Y position of second CRTHit of each track.
+      std::vector<float> z2; ///< Z position of second CRTHit of each track.
+
+      CRTTrackPoints() = default;
+
+      explicit CRTTrackPoints(std::vector<CRTTrack> const& tracks);
+
+      std::size_t size() const { return x1.size(); }
+
+    };
+
+
+    /// A TPC track, as a straight line through a point.
+    struct TPCTrackLine {
+      float x, y, z; ///< A point on the track [cm].
+      float dx, dy, dz; ///< Direction of the track (need not be normalized).
+    };
+
+
+    /**
+     * @brief Computes the distance and angle between a TPC track and each of
+     *        the CRT tracks.
+     * @param crt the CRT tracks
+     * @param tpc the TPC track
+     * @param[out] dca distance of closest approach for each CRT track [cm]
+     * @param[out] angle angle for each CRT track, in [ 0, pi/2 ] [rad]
+     *
+     * Both tracks are taken as infinite lines, the CRT track through its two
+     * hits. When the lines are parallel, `dca` is their distance, and when
+     * the two hits of a CRT track are in the same place, the distance from
+     * that point to the TPC line (`angle` is then 0).
+     * The output arrays must have room for `crt.size()` values each.
+     *
+     * The loop over CRT tracks has no branches, for the compiler to
+     * vectorize it; the square roots are taken in a second pass.
+     */
+    void CRTTrackDCA
+      (CRTTrackPoints const& crt, TPCTrackLine const& tpc, float* dca, float* angle);
+
+    /**
+     * @brief Computes distance and angle for all pairs of CRT and TPC tracks.
+     *
+     * The results for TPC track `i` and CRT track `j` are at index
+     * `i * crt.size() + j` of `dca` and `angle`, which are resized.
+     */
+    void CRTTrackDCA(
+      CRTTrackPoints const& crt, std::vector<TPCTrackLine> const& tpc,
+      std::vector<float>& dca, std::vector<float>& angle
+      );
+
+} // namespace sbn::crt
+
+#endif
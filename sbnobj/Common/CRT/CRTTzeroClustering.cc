@@ -0,0 +1,143 @@
+#include "sbnobj/Common/CRT/CRTTzeroClustering.hh"
+
+#include "cetlib_except/exception.h"
+
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
+#include "tbb/task_arena.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <type_traits>
+
+namespace {
+
+  constexpr std::size_t NPlanes = std::extent_v<decltype(sbn::crt::CRTTzero::nhits)>;
+
+  /// Standard deviation from sums, as a `uint16_t` [ns].
+  std::uint16_t spread(double sum, double sum2, std::size_t n) {
+    double const mean = sum / n;
+    double const rms = std::sqrt(std::max(sum2 / n - mean * mean, 0.0));
+    return static_cast<std::uint16_t>
+      (std::min(std::round(rms), double(std::numeric_limits<std::uint16_t>::max())));
+  }
+
+  /// Clusters the sorted hits in [ first, last [ of `order`.
+  void clusterSegment(
+    std::vector<sbn::crt::CRTHit> const& hits,
+    std::vector<std::int64_t> const& ts0, std::vector<std::uint32_t> const& order,
+    std::size_t first, std::size_t last, std::int64_t window,
+    sbn::crt::CRTTzeroClusters& clusters
+  ) {
+    std::size_t begin = first;
+    while (begin < last) {
+      std::int64_t const start = ts0[order[begin]];
+      std::size_t end = begin + 1;
+      while ((end < last) && (ts0[order[end]] - start <= window)) ++end;
+
+      sbn::crt::CRTTzero tzero;
+      std::fill(std::begin(tzero.nhits), std::end(tzero.nhits), 0);
+      std::fill(std::begin(tzero.pes), std::end(tzero.pes), 0.0);
+      double sum0 = 0.0, sum0sq = 0.0, sum1 = 0.0, sum1sq = 0.0;
+      for (std::size_t i = begin; i < end; ++i) {
+        sbn::crt::CRTHit const& hit = hits[order[i]];
+        ++tzero.nhits[hit.plane];
+        tzero.pes[hit.plane] += hit.peshit;
+        // ts0 relative to the first hit, to keep the precision of the sums
+        double const dt0 = ts0[order[i]] - start;
+        double const t1 = hit.ts1();
+        sum0 += dt0;
+        sum0sq += dt0 * dt0;
+        sum1 += t1;
+        sum1sq += t1 * t1;
+        clusters.hits.push_back(order[i]);
+      } // for hits
+
+      std::size_t const n = end - begin;
+      std::int64_t const t0 = start + std::llround(sum0 / n);
+      tzero.ts0_s = static_cast<std::uint32_t>(t0 / 1'000'000'000LL);
+      tzero.ts0_s_err = 0;
+      tzero.ts0_ns = static_cast<std::uint32_t>(t0 % 1'000'000'000LL);
+      tzero.ts0_ns_err = spread(sum0, sum0sq, n);
+      tzero.ts1_ns = static_cast<std::int32_t>(std::llround(sum1 / n));
+      tzero.ts1_ns_err = spread(sum1, sum1sq, n);
+      clusters.tzeros.push_back(tzero);
+      clusters.hitOffsets.push_back(clusters.hits.size());
+
+      begin = end;
+    } // while
+  } // clusterSegment()
+
+} // local namespace
+
+
+sbn::crt::CRTTzeroClusters sbn::crt::clusterCRTHits
+  (std::vector<CRTHit> const& hits, std::int64_t window, unsigned int nThreads)
+{
+  std::vector<std::int64_t> ts0(hits.size());
+  for (std::size_t i = 0; i < hits.size(); ++i) {
+    if ((hits[i].plane < 0) || (static_cast<std::size_t>(hits[i].plane) >= NPlanes)) {
+      throw cet::exception("clusterCRTHits") << "Hit #" << i << " is on plane "
+        << hits[i].plane << ", while CRTTzero supports only planes 0 to "
+        << (NPlanes - 1) << ".\n";
+    }
+    ts0[i] = hits[i].ts0();
+  }
+
+  // hits sorted by time; hits with the same time stay in their order
+  std::vector<std::uint32_t> order(hits.size());
+  std::iota(order.begin(), order.end(), 0U);
+  std::stable_sort(order.begin(), order.end(),
+    [&ts0](std::uint32_t a, std::uint32_t b){ return ts0[a] < ts0[b]; });
+
+  CRTTzeroClusters clusters;
+  if (nThreads == 1U) {
+    clusters.hits.reserve(hits.size());
+    clusterSegment(hits, ts0, order, 0U, order.size(), window, clusters);
+    return clusters;
+  }
+
+  // segments start at hits more than `window` after the previous one
+  std::vector<std::size_t> segmentStart;
+  for (std::size_t i = 0; i < order.size(); ++i) {
+    if ((i == 0) || (ts0[order[i]] - ts0[order[i - 1]] > window))
+      segmentStart.push_back(i);
+  }
+  segmentStart.push_back(order.size());
+  std::size_t const nSegments = segmentStart.size() - 1;
+
+  std::vector<CRTTzeroClusters> segments(nSegments);
+  tbb::task_arena arena{
+    (nThreads > 0U)
+      ? static_cast<int>(nThreads): int(tbb::task_arena::automatic)
+    };
+  arena.execute([&]()
+    {
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0U, nSegments),
+        [&](tbb::blocked_range<std::size_t> const& range)
+        {
+          for (std::size_t iSeg = range.begin(); iSeg != range.end(); ++iSeg) {
+            clusterSegment(hits, ts0, order,
+              segmentStart[iSeg], segmentStart[iSeg + 1], window, segments[iSeg]);
+          }
+        }
+        );
+    });
+
+  // segments are merged in time order
+  clusters.hits.reserve(hits.size());
+  for (CRTTzeroClusters const& segment: segments) {
+    std::uint32_t const offset = clusters.hits.size();
+    clusters.tzeros.insert
+      (clusters.tzeros.end(), segment.tzeros.begin(), segment.tzeros.end());
+    clusters.hits.insert
+      (clusters.hits.end(), segment.hits.begin(), segment.hits.end());
+    for (std::size_t i = 1; i < segment.hitOffsets.size(); ++i)
+      clusters.hitOffsets.push_back(offset + segment.hitOffsets[i]);
+  }
+  return clusters;
+
+} // sbn::crt::clusterCRTHits()
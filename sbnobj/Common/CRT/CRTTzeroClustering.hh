@@ -0,0 +1,70 @@
+/**
+ * \class CRTTzeroClusters
+ *
+ * \ingroup crt
+ *
+ * \brief Clustering of CRT hits into CRT T0 candidates
+ *
+ */
+
+#ifndef CRTTzeroClustering_hh_
+#define CRTTzeroClustering_hh_
+
+#include "sbnobj/Common/CRT/CRTHit.hh"
+#include "sbnobj/Common/CRT/CRTTzero.hh"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace sbn::crt {
+
+    /// T0 candidates from `clusterCRTHits()`, with the hits of each one.
+    struct CRTTzeroClusters {
+
+      std::vector<CRTTzero> tzeros; ///< T0 candidates, in time order.
+      /// Start of the hits of each T0 in `hits`, plus the end.
+      std::vector<std::uint32_t> hitOffsets{ 0U };
+      std::vector<std::uint32_t> hits; ///< Index of the hits of all the T0s.
+
+      std::size_t size() const { return tzeros.size(); }
+
+      /// Number of hits of the T0 `i`.
+      std::size_t nHits(std::size_t i) const
+        { return hitOffsets[i + 1] - hitOffsets[i]; }
+
+      /// Index of the first hit of T0 `i` (the others follow in `hits`).
+      std::uint32_t const* hitsOf(std::size_t i) const
+        { return hits.data() + hitOffsets[i]; }
+
+    };
+
+
+    /**
+     * @brief Groups the `hits` into T0 candidates by their `ts0()`.
+     * @param hits the CRT hits to be clustered
+     * @param window maximum time after the first hit of a T0 for other hits
+     *               to join it [ns]
+     * @param nThreads maximum number of threads to use
+     *                 (`1`: sequential, `0`: no limit)
+     * @return the T0 candidates, with the index of the hits of each
+     * @throw cet::exception if a hit `plane` is not in [ 0, 7 [
+     *
+     * The hits are sorted by `ts0()` once and swept in that order: each hit
+     * not within `window` of the first hit of the current T0 starts a new
+     * one. In each T0, `nhits` and `pes` count the hits and their `peshit`
+     * on each `plane`; the times are the average of the ones of its hits,
+     * and the time uncertainties their standard deviation (`ts0_s_err` is
+     * always `0`).
+     *
+     * Hits separated by a gap longer than `window` can't belong to the same
+     * T0: with more than one thread, the sorted hits are split at those gaps
+     * and the resulting segments are clustered in parallel TBB tasks, with
+     * the same result as the sequential sweep.
+     */
+    CRTTzeroClusters clusterCRTHits
+      (std::vector<CRTHit> const& hits, std::int64_t window, unsigned int nThreads = 1U);
+
+} // namespace sbn::crt
+
+#endif
@@ -3,11 +3,15 @@
 #include "lardataobj/AnalysisBase/T0.h"
 #include "lardataobj/Simulation/AuxDetSimChannel.h"
 #include "sbnobj/Common/CRT/CRTHit.hh"
+#include "sbnobj/Common/CRT/CRTHitCollection.hh"
 #include "sbnobj/Common/CRT/CRTTrack.hh"
+#include "sbnobj/Common/CRT/CRTTimestamps.hh"
 #include "lardataobj/AnalysisBase/T0.h"
 #include "lardataobj/RecoBase/OpFlash.h"
 #include "sbnobj/Common/CRT/CRTTzero.hh"
 #include "sbnobj/Common/CRT/CRTPMTMatching.hh"
+#include "sbnobj/Common/CRT/CRTPMTMatchingCollection.hh"
+#include "sbnobj/Common/CRT/CRTPMTMatchTable.hh"
 #include "sbnobj/Common/CRT/CRTHit_Legacy.hh"
 #include "sbnobj/Common/CRT/CRTTrack_Legacy.hh"
 #include "sbnobj/Common/CRT/CRTTzero_Legacy.hh"
@@ -0,0 +1,110 @@
+#ifndef SBN_TrackCaloSkimmerADCPool
+#define SBN_TrackCaloSkimmerADCPool
+
+#include "sbnobj/Common/Calibration/TrackCaloSkimmerObj.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Storage of the wire ADC snippets of a track in a single buffer: each
+// WireSnippet describes its ADC values as a range of TrackADCPool::adcs,
+// instead of owning a vector of its own like WireInfo does.
+
+namespace sbn {
+  struct WireSnippet {
+    uint16_t wire; //!< Wire number
+    uint16_t plane; //!< Plane number
+    uint16_t tpc; //!< TPC number
+    uint16_t channel; //!< Channel number
+    int16_t tdc0; //!< TDC tick of the first ADC value
+    unsigned offset; //!< Index of the first ADC value in the pool
+    unsigned length; //!< Number of ADC values
+
+    WireSnippet():
+      wire((uint16_t)-1),
+      plane((uint16_t)-1),
+      tpc((uint16_t)-1),
+      channel((uint16_t)-1),
+      tdc0((uint16_t)-1),
+      offset(0),
+      length(0) {}
+
+  };
+
+  struct TrackADCPool {
+    std::vector<short> adcs; //!< ADC values of all the snippets of the track
+    std::vector<WireSnippet> wires0; //!< Snippets on plane 0
+    std::vector<WireSnippet> wires1; //!< Snippets on plane 1
+    std::vector<WireSnippet> wires2; //!< Snippets on plane 2
+
+    std::vector<WireSnippet> &wires(unsigned plane) {
+      return plane == 0 ? wires0 : (plane == 1 ? wires1 : wires2);
+    }
+    const std::vector<WireSnippet> &wires(unsigned plane) const {
+      return plane == 0 ? wires0 : (plane == 1 ? wires1 : wires2);
+    }
+
+    /// Pointer to the first ADC value of the snippet
+    const short *snippet_adcs(const WireSnippet &w) const { return adcs.data() + w.offset; }
+
+    /// Adds a snippet on the given plane (0 to 2), copying its n ADC values
+    WireSnippet &add(unsigned plane, WireSnippet w, const short *values, size_t n) {
+      w.offset = adcs.size();
+      w.length = n;
+      adcs.insert(adcs.end(), values, values + n);
+      std::vector<WireSnippet> &planeWires = wires(plane);
+      planeWires.push_back(w);
+      return planeWires.back();
+    }
+
+    /// Adds a snippet with the content of a wire on the given plane (0 to 2)
+    WireSnippet &add(unsigned plane, const WireInfo &wi) {
+      WireSnippet w;
+      w.wire = wi.wire; w.plane = wi.plane; w.tpc = wi.tpc;
+      w.channel = wi.channel; w.tdc0 = wi.tdc0;
+      return add(plane, w, wi.adcs.data(), wi.adcs.size());
+    }
+
+    /// Returns the snippet as a WireInfo with its own copy of the ADC values
+    WireInfo wire_info(const WireSnippet &w) const {
+      WireInfo wi;
+      wi.wire = w.wire; wi.plane = w.plane; wi.tpc = w.tpc;
+      wi.channel = w.channel; wi.tdc0 = w.tdc0;
+      wi.adcs.assign(snippet_adcs(w), snippet_adcs(w) + w.length);
+      return wi;
+    }
+
+    void clear() {
+      adcs.clear(); wires0.clear(); wires1.clear(); wires2.clear();
+    }
+  };
+
+  /// Returns the wires of the track with their ADC values in a single pool
+  inline TrackADCPool MakeTrackADCPool(const TrackInfo &track) {
+    TrackADCPool pool;
+    size_t nADCs = 0;
+    for (unsigned plane = 0; plane < TrackInfo::NPlanes; plane++) {
+      pool.wires(plane).reserve(track.wires(plane).size());
+      for (const WireInfo &w: track.wires(plane)) nADCs += w.adcs.size();
+    }
+    pool.adcs.reserve(nADCs);
+
+    for (unsigned plane = 0; plane < TrackInfo::NPlanes; plane++) {
+      for (const WireInfo &w: track.wires(plane)) pool.add(plane, w);
+    }
+    return pool;
+  }
+
+  /// Sets the wires of track from the snippets in the pool
+  inline void FillWireInfo(const TrackADCPool &pool, TrackInfo &track) {
+    for (unsigned plane = 0; plane < TrackInfo::NPlanes; plane++) {
+      std::vector<WireInfo> &wires = track.wires(plane);
+      wires.clear();
+      wires.reserve(pool.wires(plane).size());
+      for (const WireSnippet &w: pool.wires(plane)) wires.push_back(pool.wire_info(w));
+    }
+  }
+}
+
+#endif
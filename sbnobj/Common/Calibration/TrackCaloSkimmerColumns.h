@@ -0,0 +1,209 @@
+#ifndef SBN_TrackCaloSkimmerColumns
+#define SBN_TrackCaloSkimmerColumns
+
+#include "sbnobj/Common/Calibration/TrackCaloSkimmerObj.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Columnar ("structure of arrays") variants of the hit and wire information
+// of sbn::TrackInfo. Each member is a plain vector, which ROOT stores in its
+// own branch: readers needing a few fields (e.g. dqdx, rr and pitch) read
+// only those branches.
+
+namespace sbn {
+  struct HitColumns {
+    std::vector<float> integral; //!< Integral of gaussian fit to ADC values in hit [ADC]
+    std::vector<float> sumadc; //!< "SummedADC" -- sum of ADC values under gaussian fit [ADC]
+    std::vector<float> width; //!< Width of fitted gaussian hit [ticks]
+    std::vector<float> sp_x; //!< Space-Point x position of hit [cm]
+    std::vector<float> sp_y; //!< Space-Point y position of hit [cm]
+    std::vector<float> sp_z; //!< Space-Point z position of hit [cm]
+    std::vector<float> time; //!< Peak time of hit [ticks]
+    std::vector<int> id; //!< ID of hit
+    std::vector<uint16_t> channel; //!< Channel number of hit
+    std::vector<uint16_t> wire; //!< Wire number of hit
+    std::vector<uint16_t> plane; //!< Plane number of hit
+    std::vector<uint16_t> tpc; //!< TPC number of hit
+    std::vector<uint16_t> mult; //!< Multiplicity of hit
+    std::vector<int16_t> start; //!< Start tick of hit [ticks]
+    std::vector<int16_t> end; //!< End tick of hit [ticks]
+    std::vector<bool> hasSP; //!< Whether the hit has a SpacePoint
+    std::vector<float> truth_e; //!< True energy of the hit
+    std::vector<float> truth_nelec; //!< True number of electrons of the hit
+
+    size_t size() const { return integral.size(); }
+
+    void reserve(size_t n) {
+      integral.reserve(n); sumadc.reserve(n); width.reserve(n);
+      sp_x.reserve(n); sp_y.reserve(n); sp_z.reserve(n);
+      time.reserve(n); id.reserve(n); channel.reserve(n); wire.reserve(n);
+      plane.reserve(n); tpc.reserve(n); mult.reserve(n);
+      start.reserve(n); end.reserve(n); hasSP.reserve(n);
+      truth_e.reserve(n); truth_nelec.reserve(n);
+    }
+
+    void push_back(const HitInfo &h) {
+      integral.push_back(h.integral); sumadc.push_back(h.sumadc); width.push_back(h.width);
+      sp_x.push_back(h.sp.x); sp_y.push_back(h.sp.y); sp_z.push_back(h.sp.z);
+      time.push_back(h.time); id.push_back(h.id);
+      channel.push_back(h.channel); wire.push_back(h.wire);
+      plane.push_back(h.plane); tpc.push_back(h.tpc); mult.push_back(h.mult);
+      start.push_back(h.start); end.push_back(h.end); hasSP.push_back(h.hasSP);
+      truth_e.push_back(h.truth.e); truth_nelec.push_back(h.truth.nelec);
+    }
+
+    HitInfo at(size_t i) const {
+      HitInfo h;
+      h.integral = integral[i]; h.sumadc = sumadc[i]; h.width = width[i];
+      h.sp.x = sp_x[i]; h.sp.y = sp_y[i]; h.sp.z = sp_z[i];
+      h.time = time[i]; h.id = id[i];
+      h.channel = channel[i]; h.wire = wire[i];
+      h.plane = plane[i]; h.tpc = tpc[i]; h.mult = mult[i];
+      h.start = start[i]; h.end = end[i]; h.hasSP = hasSP[i];
+      h.truth.e = truth_e[i]; h.truth.nelec = truth_nelec[i];
+      return h;
+    }
+  };
+
+  struct TrackHitColumns {
+    HitColumns h; //!< Hit information by itself
+    std::vector<float> pitch; //!< Pitch of track across wire the hit is on [cm]
+    std::vector<float> dqdx; //!< Initial computed dq/dx of hit [ADC/cm]
+    std::vector<float> rr; //!< Residual range of hit along track [cm]
+    std::vector<float> tp_x; //!< Track Trajectory x position of hit [cm]
+    std::vector<float> tp_y; //!< Track Trajectory y position of hit [cm]
+    std::vector<float> tp_z; //!< Track Trajectory z position of hit [cm]
+    std::vector<float> dir_x; //!< x direction of track at hit location
+    std::vector<float> dir_y; //!< y direction of track at hit location
+    std::vector<float> dir_z; //!< z direction of track at hit location
+    std::vector<uint16_t> i_snippet; //!< Index of hit into snippet
+    std::vector<bool> ontraj; //!< Whether the hit is on the track trajectory
+    std::vector<bool> oncalo; //!< Whether the hit is on the track calorimetry
+
+    size_t size() const { return pitch.size(); }
+
+    void reserve(size_t n) {
+      h.reserve(n);
+      pitch.reserve(n); dqdx.reserve(n); rr.reserve(n);
+      tp_x.reserve(n); tp_y.reserve(n); tp_z.reserve(n);
+      dir_x.reserve(n); dir_y.reserve(n); dir_z.reserve(n);
+      i_snippet.reserve(n); ontraj.reserve(n); oncalo.reserve(n);
+    }
+
+    void push_back(const TrackHitInfo &th) {
+      h.push_back(th.h);
+      pitch.push_back(th.pitch); dqdx.push_back(th.dqdx); rr.push_back(th.rr);
+      tp_x.push_back(th.tp.x); tp_y.push_back(th.tp.y); tp_z.push_back(th.tp.z);
+      dir_x.push_back(th.dir.x); dir_y.push_back(th.dir.y); dir_z.push_back(th.dir.z);
+      i_snippet.push_back(th.i_snippet);
+      ontraj.push_back(th.ontraj); oncalo.push_back(th.oncalo);
+    }
+
+    TrackHitInfo at(size_t i) const {
+      TrackHitInfo th;
+      th.h = h.at(i);
+      th.pitch = pitch[i]; th.dqdx = dqdx[i]; th.rr = rr[i];
+      th.tp.x = tp_x[i]; th.tp.y = tp_y[i]; th.tp.z = tp_z[i];
+      th.dir.x = dir_x[i]; th.dir.y = dir_y[i]; th.dir.z = dir_z[i];
+      th.i_snippet = i_snippet[i];
+      th.ontraj = ontraj[i]; th.oncalo = oncalo[i];
+      return th;
+    }
+  };
+
+  struct WireColumns {
+    std::vector<uint16_t> wire; //!< Wire number
+    std::vector<uint16_t> plane; //!< Plane number
+    std::vector<uint16_t> tpc; //!< TPC number
+    std::vector<uint16_t> channel; //!< Channel number
+    std::vector<int16_t> tdc0; //!< TDC tick of the first ADC value
+    std::vector<short> adcs; //!< ADC values of all the wires, one after the other
+    std::vector<unsigned> adc_offsets{0}; //!< Index of the first ADC of each wire in adcs, plus the end
+
+    size_t size() const { return wire.size(); }
+
+    void push_back(const WireInfo &w) {
+      wire.push_back(w.wire); plane.push_back(w.plane); tpc.push_back(w.tpc);
+      channel.push_back(w.channel); tdc0.push_back(w.tdc0);
+      adcs.insert(adcs.end(), w.adcs.begin(), w.adcs.end());
+      adc_offsets.push_back(adcs.size());
+    }
+
+    /// Pointer to the first ADC value of wire i
+    const short *wire_adcs(size_t i) const { return adcs.data() + adc_offsets[i]; }
+
+    /// Number of ADC values of wire i
+    size_t wire_nadcs(size_t i) const { return adc_offsets[i+1] - adc_offsets[i]; }
+
+    WireInfo at(size_t i) const {
+      WireInfo w;
+      w.wire = wire[i]; w.plane = plane[i]; w.tpc = tpc[i];
+      w.channel = channel[i]; w.tdc0 = tdc0[i];
+      w.adcs.assign(wire_adcs(i), wire_adcs(i) + wire_nadcs(i));
+      return w;
+    }
+  };
+
+  // Hit and wire information of a TrackInfo; the other track information
+  // is matched through meta and id
+  struct TrackColumns {
+    MetaInfo meta; //!< Meta-data associated with this track
+    int id; //!< ID of track
+    TrackHitColumns hits0; //!< Hits on plane 0
+    TrackHitColumns hits1; //!< Hits on plane 1
+    TrackHitColumns hits2; //!< Hits on plane 2
+    WireColumns wires0; //!< Wire information on plane 0
+    WireColumns wires1; //!< Wire information on plane 1
+    WireColumns wires2; //!< Wire information on plane 2
+    HitColumns endhits; //!< Hits near the endpoint of the track on the collection plane
+
+    TrackColumns():
+      id(-1) {}
+  };
+
+  /// Returns the hit and wire information of the track in columnar form
+  inline TrackColumns MakeTrackColumns(const TrackInfo &track) {
+    TrackColumns columns;
+    columns.meta = track.meta;
+    columns.id = track.id;
+
+    TrackHitColumns *hitColumns[3] = {&columns.hits0, &columns.hits1, &columns.hits2};
+    WireColumns *wireColumns[3] = {&columns.wires0, &columns.wires1, &columns.wires2};
+    for (unsigned plane = 0; plane < TrackInfo::NPlanes; plane++) {
+      hitColumns[plane]->reserve(track.hits(plane).size());
+      for (const TrackHitInfo &h: track.hits(plane)) hitColumns[plane]->push_back(h);
+      for (const WireInfo &w: track.wires(plane)) wireColumns[plane]->push_back(w);
+    }
+
+    columns.endhits.reserve(track.endhits.size());
+    for (const HitInfo &h: track.endhits) columns.endhits.push_back(h);
+    return columns;
+  }
+
+  /// Sets the hits, wires and end hits of track from their columnar form
+  inline void FillTrackInfo(const TrackColumns &columns, TrackInfo &track) {
+    const TrackHitColumns *hitColumns[3] = {&columns.hits0, &columns.hits1, &columns.hits2};
+    const WireColumns *wireColumns[3] = {&columns.wires0, &columns.wires1, &columns.wires2};
+    for (unsigned plane = 0; plane < TrackInfo::NPlanes; plane++) {
+      std::vector<TrackHitInfo> &hits = track.hits(plane);
+      hits.clear();
+      hits.reserve(hitColumns[plane]->size());
+      for (size_t i = 0; i < hitColumns[plane]->size(); i++)
+        hits.push_back(hitColumns[plane]->at(i));
+      std::vector<WireInfo> &wires = track.wires(plane);
+      wires.clear();
+      wires.reserve(wireColumns[plane]->size());
+      for (size_t i = 0; i < wireColumns[plane]->size(); i++)
+        wires.push_back(wireColumns[plane]->at(i));
+    }
+
+    track.endhits.clear();
+    track.endhits.reserve(columns.endhits.size());
+    for (size_t i = 0; i < columns.endhits.size(); i++)
+      track.endhits.push_back(columns.endhits.at(i));
+  }
+}
+
+#endif
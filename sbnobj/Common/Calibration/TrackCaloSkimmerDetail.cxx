@@ -0,0 +1,95 @@
+#include "sbnobj/Common/Calibration/TrackCaloSkimmerDetail.h"
+
+// ROOT libraries
+#include "TTree.h"
+
+// C/C++ standard libraries
+#include <stdexcept>
+#include <vector>
+
+namespace {
+  // Clears v and releases its memory
+  template<typename T>
+  void Release(std::vector<T> &v) { std::vector<T>().swap(v); }
+
+  void ReleaseTruth(sbn::TrueParticle &particle) {
+    for (unsigned plane = 0; plane < sbn::TrueParticle::NPlanes; plane++)
+      Release(particle.truehits(plane));
+    Release(particle.traj);
+    Release(particle.traj_sce);
+  }
+
+  // Sub-branches (relative to the TrackInfo branch) of each level beyond the summary
+  const std::vector<std::string> HitsBranches{
+    "hits0", "hits1", "hits2", "endhits",
+    "daughter_pdg", "daughter_nsp", "daughter_sp_toend_dist",
+    "tracks_near_end_dist", "tracks_near_end_costh",
+    "tracks_near_start_dist", "tracks_near_start_costh"};
+  const std::vector<std::string> WiresBranches{"wires0", "wires1", "wires2"};
+  const std::vector<std::string> TruthBranches{
+    "truth.p.truehits0", "truth.p.truehits1", "truth.p.truehits2",
+    "truth.p.traj", "truth.p.traj_sce",
+    "truth.michel.truehits0", "truth.michel.truehits1", "truth.michel.truehits2",
+    "truth.michel.traj", "truth.michel.traj_sce"};
+}
+
+namespace sbn {
+  TrackInfoDetail ParseTrackInfoDetail(const std::string &name) {
+    if (name == "summary") return TrackInfoDetail::kSummary;
+    if (name == "hits") return TrackInfoDetail::kHits;
+    if (name == "wires") return TrackInfoDetail::kWires;
+    if (name == "truth") return TrackInfoDetail::kTruth;
+    throw std::runtime_error("TrackInfoDetail: unknown level of detail '" + name + "'");
+  }
+
+  const char *TrackInfoDetailName(TrackInfoDetail detail) {
+    switch (detail) {
+      case TrackInfoDetail::kSummary: return "summary";
+      case TrackInfoDetail::kHits: return "hits";
+      case TrackInfoDetail::kWires: return "wires";
+      case TrackInfoDetail::kTruth: return "truth";
+    }
+    return "unknown";
+  }
+
+  void TrimTrackInfo(TrackInfo &track, TrackInfoDetail detail) {
+    if (detail < TrackInfoDetail::kTruth) {
+      ReleaseTruth(track.truth.p);
+      ReleaseTruth(track.truth.michel);
+    }
+    if (detail < TrackInfoDetail::kWires) {
+      for (unsigned plane = 0; plane < TrackInfo::NPlanes; plane++)
+        Release(track.wires(plane));
+    }
+    if (detail < TrackInfoDetail::kHits) {
+      for (unsigned plane = 0; plane < TrackInfo::NPlanes; plane++)
+        Release(track.hits(plane));
+      Release(track.endhits);
+      Release(track.daughter_pdg);
+      Release(track.daughter_nsp);
+      Release(track.daughter_sp_toend_dist);
+      Release(track.tracks_near_end_dist);
+      Release(track.tracks_near_end_costh);
+      Release(track.tracks_near_start_dist);
+      Release(track.tracks_near_start_costh);
+    }
+  }
+
+  void SelectTrackInfoBranches(TTree *tree, TrackInfoDetail detail, const std::string &branch) {
+    if (!tree) throw std::runtime_error("SelectTrackInfoBranches: no tree");
+    if (!tree->GetBranch(branch.c_str()))
+      throw std::runtime_error("SelectTrackInfoBranches: no branch " + branch + " in tree " + tree->GetName());
+
+    tree->SetBranchStatus((branch + "*").c_str(), true);
+    auto const disable = [tree, &branch](const std::vector<std::string> &names) {
+      // the collection branch with its members; branches not present in
+      // the tree are skipped (ROOT reports no error when found is passed)
+      UInt_t found = 0;
+      for (const std::string &name: names)
+        tree->SetBranchStatus((branch + "." + name + "*").c_str(), false, &found);
+    };
+    if (detail < TrackInfoDetail::kTruth) disable(TruthBranches);
+    if (detail < TrackInfoDetail::kWires) disable(WiresBranches);
+    if (detail < TrackInfoDetail::kHits) disable(HitsBranches);
+  }
+}
@@ -0,0 +1,48 @@
+#ifndef SBN_TrackCaloSkimmerDetail
+#define SBN_TrackCaloSkimmerDetail
+
+#include "sbnobj/Common/Calibration/TrackCaloSkimmerObj.h"
+
+#include <string>
+
+class TTree;
+
+// Levels of detail ("tiers") of the sbn::TrackInfo written by the skimmer.
+// Each level includes the information of the ones before it:
+//  * summary: meta-data, track scalars and the truth-matching scalars
+//             (without true hits nor trajectories)
+//  * hits:    plus the hits on each plane, the end hits and the daughter
+//             and nearby track lists
+//  * wires:   plus the wire ADC snippets on each plane
+//  * truth:   plus the true hits and trajectories of the matched particles
+// The writer trims each track to the requested level (TrimTrackInfo()), so
+// the members beyond it are stored empty; readers select the branches of
+// the levels they need (SelectTrackInfoBranches()), and ROOT does not read
+// the others at all.
+
+namespace sbn {
+  enum class TrackInfoDetail {
+    kSummary = 0, //!< Meta-data and scalars
+    kHits = 1, //!< Plus hits, end hits, daughters and nearby tracks
+    kWires = 2, //!< Plus wire ADC snippets
+    kTruth = 3 //!< Plus true hits and trajectories
+  };
+
+  // Returns the level named "summary", "hits", "wires" or "truth";
+  // throws std::runtime_error on any other name
+  TrackInfoDetail ParseTrackInfoDetail(const std::string &name);
+
+  // Returns the name of the level, as accepted by ParseTrackInfoDetail()
+  const char *TrackInfoDetailName(TrackInfoDetail detail);
+
+  // Releases the members of track beyond the specified level of detail
+  void TrimTrackInfo(TrackInfo &track, TrackInfoDetail detail);
+
+  // Enables only the branches of the TrackInfo branch (e.g. "trk") of a split
+  // tree up to the specified level of detail; the other branches of the
+  // tree are not changed
+  void SelectTrackInfoBranches(TTree *tree, TrackInfoDetail detail,
+                               const std::string &branch = "trk");
+}
+
+#endif
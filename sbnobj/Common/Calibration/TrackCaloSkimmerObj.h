@@ -1,12 +1,20 @@
 #ifndef SBN_TrackCaloSkimmerObj
 #define SBN_TrackCaloSkimmerObj
 
+#include <algorithm> // for std::max
 #include <climits>
+#include <cstddef>
+#include <cstdint>
 #include <limits> // for std::numeric_limits
 
 #include <vector>
 
 namespace sbn {
+  // Tag for the constructors which leave the data members uninitialized,
+  // for bulk fills where every field is assigned right after construction
+  struct NoInit_t {};
+  constexpr NoInit_t NoInit{};
+
   struct Vector3D {
     float x;
     float y;
@@ -18,6 +26,11 @@ namespace sbn {
       z(std::numeric_limits<float>::signaling_NaN())
     {}
 
+    Vector3D(float x, float y, float z):
+      x(x), y(y), z(z) {}
+
+    explicit Vector3D(NoInit_t) {}
+
   };
 
   struct WireInfo {
@@ -41,6 +54,7 @@ namespace sbn {
     float nelec;
   };
 
+  // integral, sumadc and width are written with a 12-bit mantissa (see classes_def.xml)
   struct HitInfo {
     float integral; //!< Integral of gaussian fit to ADC values in hit [ADC]
     float sumadc; //!< "SummedADC" -- sum of ADC values under gaussian fit [ADC]
@@ -72,8 +86,19 @@ namespace sbn {
       mult((uint16_t)-1),
       start(-1),
       end(-1) {}
+
+    explicit HitInfo(NoInit_t):
+      sp(NoInit) {}
+
+    HitInfo(float integral, float sumadc, float width, const Vector3D &sp, float time, int id,
+            uint16_t channel, uint16_t wire, uint16_t plane, uint16_t tpc, uint16_t mult,
+            int16_t start, int16_t end, bool hasSP, const HitTruth &truth):
+      integral(integral), sumadc(sumadc), width(width), sp(sp), time(time), id(id),
+      channel(channel), wire(wire), plane(plane), tpc(tpc), mult(mult),
+      start(start), end(end), hasSP(hasSP), truth(truth) {}
   };
 
+  // pitch, dqdx and rr are written with a 12-bit mantissa (see classes_def.xml)
   struct TrackHitInfo {
     HitInfo h; //!< Hit information by itself
     float pitch; //!< Pitch of track across wire the hit is on [cm]
@@ -111,6 +136,7 @@ namespace sbn {
      iproc(-1) {}
   };
 
+  // nelec, e, pitch, pitch_sce and rr are written with a 12-bit mantissa (see classes_def.xml)
   struct TrueHit {
     int16_t cryo; //!< Cryostat of hit
     int16_t tpc; //!< TPC of hit
@@ -144,25 +170,28 @@ namespace sbn {
       pitch(0.),
       rr(0.),
       itraj(-1),
+      // set the location to 0.
+      p(0, 0, 0),
+      p_scecorr(0, 0, 0),
+      p_width(0, 0, 0),
+      p_scecorr_width(0, 0, 0),
       time(0.)
-      {
-        // set the location to 0.
-        p.x = 0;
-        p.y = 0;
-        p.z = 0;
-
-        p_scecorr.x = 0;
-        p_scecorr.y = 0;
-        p_scecorr.z = 0;
-
-        p_width.x = 0;
-        p_width.y = 0;
-
-        p_scecorr_width.z = 0;
-        p_scecorr_width.x = 0;
-        p_scecorr_width.y = 0;
-        p_scecorr_width.z = 0;
-      }
+      {}
+
+    explicit TrueHit(NoInit_t):
+      p(NoInit),
+      p_scecorr(NoInit),
+      p_width(NoInit),
+      p_scecorr_width(NoInit) {}
+
+    TrueHit(int16_t cryo, int16_t tpc, int16_t plane, int wire, int channel,
+            unsigned ndep, float nelec, float e, float pitch, float pitch_sce,
+            float rr, int itraj, const Vector3D &p, const Vector3D &p_scecorr,
+            const Vector3D &p_width, const Vector3D &p_scecorr_width, float time, float tdrift):
+      cryo(cryo), tpc(tpc), plane(plane), wire(wire), channel(channel),
+      ndep(ndep), nelec(nelec), e(e), pitch(pitch), pitch_sce(pitch_sce),
+      rr(rr), itraj(itraj), p(p), p_scecorr(p_scecorr),
+      p_width(p_width), p_scecorr_width(p_scecorr_width), time(time), tdrift(tdrift) {}
   };
 
   struct TrueParticle {
@@ -234,6 +263,32 @@ namespace sbn {
       start_process(-1),
       end_process(-1)
     {}
+
+    explicit TrueParticle(NoInit_t):
+      genp(NoInit),
+      startp(NoInit),
+      endp(NoInit),
+      gen(NoInit),
+      start(NoInit),
+      end(NoInit) {}
+
+    static constexpr unsigned NPlanes = 3; //!< Number of planes with per-plane information
+
+    // Per-plane access to the truehits*, plane*VisE and plane*nhit members
+    std::vector<TrueHit> &truehits(unsigned plane) { return this->*PlaneTrueHits[plane]; }
+    const std::vector<TrueHit> &truehits(unsigned plane) const { return this->*PlaneTrueHits[plane]; }
+    float &planeVisE(unsigned plane) { return this->*PlaneVisE[plane]; }
+    float planeVisE(unsigned plane) const { return this->*PlaneVisE[plane]; }
+    unsigned &planenhit(unsigned plane) { return this->*PlaneNHit[plane]; }
+    unsigned planenhit(unsigned plane) const { return this->*PlaneNHit[plane]; }
+
+  private:
+    static constexpr std::vector<TrueHit> TrueParticle::*PlaneTrueHits[NPlanes] = {
+      &TrueParticle::truehits0, &TrueParticle::truehits1, &TrueParticle::truehits2};
+    static constexpr float TrueParticle::*PlaneVisE[NPlanes] = {
+      &TrueParticle::plane0VisE, &TrueParticle::plane1VisE, &TrueParticle::plane2VisE};
+    static constexpr unsigned TrueParticle::*PlaneNHit[NPlanes] = {
+      &TrueParticle::plane0nhit, &TrueParticle::plane1nhit, &TrueParticle::plane2nhit};
   };
 
   struct TrackTruth {
@@ -249,6 +304,10 @@ namespace sbn {
       depE(std::numeric_limits<float>::signaling_NaN())
     {}
 
+    explicit TrackTruth(NoInit_t):
+      p(NoInit),
+      michel(NoInit) {}
+
   };
 
   struct TrackInfo {
@@ -335,8 +394,43 @@ namespace sbn {
       n_fit_point(-1),
       selected(-1),
       nprescale(-1) {}
+
+    static constexpr unsigned NPlanes = 3; //!< Number of planes with per-plane information
+
+    // Per-plane access to the hits*, wires* and hit_m*_time_p*_tpc* members;
+    // tpc is 0 for TPC E and 1 for TPC W
+    std::vector<TrackHitInfo> &hits(unsigned plane) { return this->*PlaneHits[plane]; }
+    const std::vector<TrackHitInfo> &hits(unsigned plane) const { return this->*PlaneHits[plane]; }
+    std::vector<WireInfo> &wires(unsigned plane) { return this->*PlaneWires[plane]; }
+    const std::vector<WireInfo> &wires(unsigned plane) const { return this->*PlaneWires[plane]; }
+    float &hit_min_time(unsigned plane, unsigned tpc) { return this->*PlaneMinTime[tpc][plane]; }
+    float hit_min_time(unsigned plane, unsigned tpc) const { return this->*PlaneMinTime[tpc][plane]; }
+    float &hit_max_time(unsigned plane, unsigned tpc) { return this->*PlaneMaxTime[tpc][plane]; }
+    float hit_max_time(unsigned plane, unsigned tpc) const { return this->*PlaneMaxTime[tpc][plane]; }
+
+  private:
+    static constexpr std::vector<TrackHitInfo> TrackInfo::*PlaneHits[NPlanes] = {
+      &TrackInfo::hits0, &TrackInfo::hits1, &TrackInfo::hits2};
+    static constexpr std::vector<WireInfo> TrackInfo::*PlaneWires[NPlanes] = {
+      &TrackInfo::wires0, &TrackInfo::wires1, &TrackInfo::wires2};
+    static constexpr float TrackInfo::*PlaneMinTime[2][NPlanes] = {
+      {&TrackInfo::hit_min_time_p0_tpcE, &TrackInfo::hit_min_time_p1_tpcE, &TrackInfo::hit_min_time_p2_tpcE},
+      {&TrackInfo::hit_min_time_p0_tpcW, &TrackInfo::hit_min_time_p1_tpcW, &TrackInfo::hit_min_time_p2_tpcW}};
+    static constexpr float TrackInfo::*PlaneMaxTime[2][NPlanes] = {
+      {&TrackInfo::hit_max_time_p0_tpcE, &TrackInfo::hit_max_time_p1_tpcE, &TrackInfo::hit_max_time_p2_tpcE},
+      {&TrackInfo::hit_max_time_p0_tpcW, &TrackInfo::hit_max_time_p1_tpcW, &TrackInfo::hit_max_time_p2_tpcW}};
   };
 
+  /// Appends n elements to v with their NoInit constructor; returns the first of them
+  template<typename T>
+  T *AppendNoInit(std::vector<T> &v, size_t n) {
+    const size_t first = v.size();
+    // grow geometrically, so that repeated small appends stay linear
+    if (v.capacity() < first + n) v.reserve(std::max(first + n, 2 * v.capacity()));
+    for (size_t i = 0; i < n; i++) v.emplace_back(NoInit);
+    return v.data() + first;
+  }
+
 }
 
 #endif
@@ -0,0 +1,172 @@
+#include "sbnobj/Common/Calibration/TrackCaloSkimmerReader.h"
+
+// ROOT libraries
+#include "TBranchElement.h"
+#include "TROOT.h"
+#include "TStreamerElement.h"
+#include "TStreamerInfo.h"
+#include "TTree.h"
+#include "TTreeReader.h"
+#include "TTreeReaderArray.h"
+
+// C/C++ standard libraries
+#include <stdexcept>
+#include <utility>
+
+namespace {
+  // Whether the branch holds a float data member, stored either as float or
+  // as Float16_t: ROOT streams both into a float in memory.
+  bool isFloatMember(TBranch *branch) {
+    TBranchElement *element = dynamic_cast<TBranchElement*>(branch);
+    if (!element || !element->GetInfo() || element->GetID() < 0) return false;
+    TStreamerElement *member = element->GetInfo()->GetElement(element->GetID());
+    if (!member) return false;
+    const int type = member->GetType();
+    return (type == TVirtualStreamerInfo::kFloat) || (type == TVirtualStreamerInfo::kFloat16);
+  }
+}
+
+namespace sbn {
+  TrackCaloSkimmerReader::TrackCaloSkimmerReader(TTree *tree, const std::vector<std::string> &fields,
+                                                 unsigned plane, size_t chunkSize, bool prefetch,
+                                                 const std::string &branch):
+    fFields(fields),
+    fChunkSize(chunkSize),
+    fDone(false),
+    fPrefetch(prefetch),
+    fNextReady(false),
+    fStop(false)
+  {
+    if (!tree) throw std::runtime_error("TrackCaloSkimmerReader: no tree");
+    if (fFields.empty()) throw std::runtime_error("TrackCaloSkimmerReader: no fields selected");
+    if (plane > 2) throw std::runtime_error("TrackCaloSkimmerReader: invalid plane " + std::to_string(plane));
+    if (fChunkSize == 0) fChunkSize = 1;
+
+    const std::string prefix = branch + ".hits" + std::to_string(plane) + ".";
+
+    // only the selected branches are read, through a cache of their own
+    tree->SetCacheSize(64 * 1024 * 1024);
+    tree->SetCacheLearnEntries(0);
+    for (const std::string &field: fFields) {
+      const std::string name = prefix + field;
+      TBranch *fieldBranch = tree->GetBranch(name.c_str());
+      if (!fieldBranch)
+        throw std::runtime_error("TrackCaloSkimmerReader: no branch " + name + " in tree " + tree->GetName());
+      if (!isFloatMember(fieldBranch))
+        throw std::runtime_error("TrackCaloSkimmerReader: branch " + name + " is not a float (or Float16_t) member");
+      tree->AddBranchToCache(name.c_str(), true);
+    }
+    tree->StopCacheLearningPhase();
+
+    fReader = std::make_unique<TTreeReader>(tree);
+    for (const std::string &field: fFields)
+      fArrays.push_back(std::make_unique<TTreeReaderArray<float>>(*fReader, (prefix + field).c_str()));
+
+    if (fPrefetch) {
+      ROOT::EnableThreadSafety();
+      fThread = std::thread(&TrackCaloSkimmerReader::Prefetch, this);
+    }
+  }
+
+  TrackCaloSkimmerReader::~TrackCaloSkimmerReader() {
+    if (fThread.joinable()) {
+      {
+        std::lock_guard<std::mutex> lock(fMutex);
+        fStop = true;
+      }
+      fCondition.notify_all();
+      fThread.join();
+    }
+  }
+
+  bool TrackCaloSkimmerReader::Next(TrackHitChunk &chunk) {
+    if (!fPrefetch) {
+      Fill(chunk);
+      return chunk.ntracks() > 0;
+    }
+
+    std::unique_lock<std::mutex> lock(fMutex);
+    fCondition.wait(lock, [this]{ return fNextReady; });
+    if (fError) {
+      chunk.clear();
+      std::rethrow_exception(fError);
+    }
+    // the buffers of chunk are reused by the thread for the following chunk
+    std::swap(chunk, fNext);
+    fNextReady = false;
+    lock.unlock();
+    fCondition.notify_all();
+    return chunk.ntracks() > 0;
+  }
+
+  void TrackCaloSkimmerReader::Fill(TrackHitChunk &chunk) {
+    chunk.columns.resize(fFields.size());
+    chunk.clear();
+    while (!fDone && chunk.ntracks() < fChunkSize) {
+      if (!fReader->Next()) {
+        if (fReader->GetEntryStatus() != TTreeReader::kEntryBeyondEnd)
+          throw std::runtime_error("TrackCaloSkimmerReader: error reading entry "
+                                   + std::to_string(fReader->GetCurrentEntry()));
+        fDone = true;
+        break;
+      }
+      const size_t nHits = fArrays.front()->GetSize();
+      for (size_t i = 0; i < fArrays.size(); i++) {
+        TTreeReaderArray<float> &values = *fArrays[i];
+        if (values.GetSetupStatus() < 0)
+          throw std::runtime_error("TrackCaloSkimmerReader: can't read field " + fFields[i]
+                                   + " (setup status " + std::to_string(values.GetSetupStatus()) + ")");
+        if (values.GetSize() != nHits)
+          throw std::runtime_error("TrackCaloSkimmerReader: field " + fFields[i] + " has "
+                                   + std::to_string(values.GetSize()) + " hits instead of "
+                                   + std::to_string(nHits) + " in entry "
+                                   + std::to_string(fReader->GetCurrentEntry()));
+        std::vector<float> &column = chunk.columns[i];
+        for (size_t j = 0; j < nHits; j++) column.push_back(values[j]);
+      }
+      chunk.offsets.push_back(chunk.columns.front().size());
+      chunk.entries.push_back(fReader->GetCurrentEntry());
+    }
+  }
+
+  void TrackCaloSkimmerReader::Prefetch() {
+    TrackHitChunk chunk;
+    while (true) {
+      // an exception escaping the thread would terminate the program:
+      // it is handed to Next() instead, and reading stops
+      std::exception_ptr error;
+      try {
+        Fill(chunk);
+      }
+      catch (...) {
+        error = std::current_exception();
+      }
+      const bool last = chunk.ntracks() == 0;
+
+      std::unique_lock<std::mutex> lock(fMutex);
+      fCondition.wait(lock, [this]{ return !fNextReady || fStop; });
+      if (fStop) return;
+      if (error) {
+        fDone = true;
+        fError = error;
+      }
+      else std::swap(chunk, fNext);
+      fNextReady = true;
+      lock.unlock();
+      fCondition.notify_all();
+      if (error) return; // fNextReady stays set: every Next() rethrows
+      // after the end, keep delivering empty chunks to callers of Next()
+      if (last) {
+        lock.lock();
+        while (!fStop) {
+          fCondition.wait(lock, [this]{ return !fNextReady || fStop; });
+          if (fStop) return;
+          fNext.clear();
+          fNextReady = true;
+          fCondition.notify_all();
+        }
+        return;
+      }
+    }
+  }
+}
@@ -0,0 +1,83 @@
+#ifndef SBN_TrackCaloSkimmerReader
+#define SBN_TrackCaloSkimmerReader
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+class TTree;
+class TTreeReader;
+template<typename T> class TTreeReaderArray;
+
+// Reader of selected TrackHitInfo fields of one plane from a TrackCaloSkimmer
+// tree. Only the branches of the selected fields are read; their values are
+// copied into preallocated columns, a chunk of tracks at a time, optionally
+// by a thread reading the next chunk while the current one is processed.
+
+namespace sbn {
+  struct TrackHitChunk {
+    std::vector<std::vector<float>> columns; //!< Values of each field, for all the hits of all the tracks
+    std::vector<unsigned> offsets{0}; //!< Index of the first hit of each track in the columns, plus the end
+    std::vector<long long> entries; //!< Tree entry of each track
+
+    size_t ntracks() const { return entries.size(); }
+    size_t nhits() const { return offsets.back(); }
+
+    void clear() {
+      for (std::vector<float> &c: columns) c.clear();
+      offsets.assign(1, 0);
+      entries.clear();
+    }
+  };
+
+  class TrackCaloSkimmerReader {
+  public:
+    // fields are TrackHitInfo members of float type, e.g. "dqdx", "rr" or
+    // "h.integral"; they are in chunk columns in the same order. Members
+    // written as Float16_t are read back as float, like ROOT streams them
+    // into memory; fields of any other type are rejected.
+    // With prefetch, ROOT::EnableThreadSafety() is called, and the tree must
+    // not be used by anybody else until the reader is destroyed.
+    TrackCaloSkimmerReader(TTree *tree, const std::vector<std::string> &fields,
+                           unsigned plane = 2, size_t chunkSize = 4096, bool prefetch = true,
+                           const std::string &branch = "trk");
+    ~TrackCaloSkimmerReader();
+
+    TrackCaloSkimmerReader(const TrackCaloSkimmerReader &) = delete;
+    TrackCaloSkimmerReader &operator=(const TrackCaloSkimmerReader &) = delete;
+
+    const std::vector<std::string> &fields() const { return fFields; }
+
+    // Replaces the content of chunk with the next tracks; returns false if
+    // there are no tracks left (and chunk is then empty). Errors met while
+    // reading, also by the prefetch thread, are thrown from here.
+    bool Next(TrackHitChunk &chunk);
+
+  private:
+    void Fill(TrackHitChunk &chunk);
+    void Prefetch();
+
+    std::vector<std::string> fFields;
+    size_t fChunkSize;
+    std::unique_ptr<TTreeReader> fReader;
+    std::vector<std::unique_ptr<TTreeReaderArray<float>>> fArrays;
+    bool fDone;
+
+    // prefetch: the thread fills fNext while the caller processes its chunk
+    bool fPrefetch;
+    std::thread fThread;
+    std::mutex fMutex;
+    std::condition_variable fCondition;
+    TrackHitChunk fNext;
+    bool fNextReady;
+    bool fStop;
+    std::exception_ptr fError; // error of the thread, for the caller of Next()
+  };
+}
+
+#endif
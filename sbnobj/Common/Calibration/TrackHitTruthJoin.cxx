@@ -0,0 +1,54 @@
+#include "sbnobj/Common/Calibration/TrackHitTruthJoin.h"
+
+// C/C++ standard libraries
+#include <algorithm>
+#include <tuple>
+
+namespace {
+  struct JoinKey {
+    int plane;
+    int channel;
+    float time;
+    unsigned index; //!< Position in the original list
+  };
+
+  bool SameWire(const JoinKey &a, const JoinKey &b) {
+    return a.plane == b.plane && a.channel == b.channel;
+  }
+
+  bool operator<(const JoinKey &a, const JoinKey &b) {
+    return std::tie(a.plane, a.channel, a.time, a.index) < std::tie(b.plane, b.channel, b.time, b.index);
+  }
+}
+
+namespace sbn {
+  std::vector<HitTruthMatch> MatchHitsToTrueHits(const std::vector<TrackHitInfo> &hits,
+                                                 const std::vector<TrueHit> &truehits,
+                                                 float tolerance) {
+    std::vector<JoinKey> hitKeys, trueKeys;
+    hitKeys.reserve(hits.size());
+    for (unsigned i = 0; i < hits.size(); i++)
+      hitKeys.push_back({hits[i].h.plane, hits[i].h.channel, hits[i].h.time, i});
+    trueKeys.reserve(truehits.size());
+    for (unsigned i = 0; i < truehits.size(); i++)
+      trueKeys.push_back({truehits[i].plane, truehits[i].channel, truehits[i].time, i});
+    std::sort(hitKeys.begin(), hitKeys.end());
+    std::sort(trueKeys.begin(), trueKeys.end());
+
+    // the first true hit possibly matching a hit only moves forward, since
+    // hits are visited in (plane, channel, time) order
+    std::vector<HitTruthMatch> matches;
+    auto first = trueKeys.begin();
+    for (const JoinKey &hit: hitKeys) {
+      const JoinKey low{hit.plane, hit.channel, hit.time - tolerance, 0};
+      while (first != trueKeys.end() && *first < low) ++first;
+      for (auto it = first; it != trueKeys.end() && SameWire(*it, hit) && it->time <= hit.time + tolerance; ++it)
+        matches.push_back({hit.index, it->index});
+    }
+
+    std::sort(matches.begin(), matches.end(), [](const HitTruthMatch &a, const HitTruthMatch &b) {
+      return std::tie(a.hit, a.truehit) < std::tie(b.hit, b.truehit);
+    });
+    return matches;
+  }
+}
@@ -0,0 +1,35 @@
+#ifndef SBN_TrackHitTruthJoin
+#define SBN_TrackHitTruthJoin
+
+#include "sbnobj/Common/Calibration/TrackCaloSkimmerObj.h"
+
+#include <vector>
+
+// Matching of the reconstructed hits of a track (TrackHitInfo) to the true
+// hits (TrueHit) on the same plane and channel, with times within a
+// tolerance. Both lists are sorted once by (plane, channel, time) and then
+// merged, instead of comparing every hit with every true hit.
+
+namespace sbn {
+  struct HitTruthMatch {
+    unsigned hit; //!< Index of the hit in its list
+    unsigned truehit; //!< Index of the true hit in its list
+  };
+
+  // Returns all the pairs of a hit and a true hit on the same plane and
+  // channel, with peak times differing by at most tolerance [ticks]; a hit
+  // may match several true hits and vice versa. Pairs are sorted by hit
+  // index, then by true hit index.
+  std::vector<HitTruthMatch> MatchHitsToTrueHits(const std::vector<TrackHitInfo> &hits,
+                                                 const std::vector<TrueHit> &truehits,
+                                                 float tolerance);
+
+  // Matches the hits of track on a plane to the true hits of its matched
+  // particle on the same plane
+  inline std::vector<HitTruthMatch> MatchHitsToTrueHits(const TrackInfo &track, unsigned plane,
+                                                        float tolerance) {
+    return MatchHitsToTrueHits(track.hits(plane), track.truth.p.truehits(plane), tolerance);
+  }
+}
+
+#endif
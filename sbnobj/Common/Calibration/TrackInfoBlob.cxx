@@ -0,0 +1,132 @@
+#include "sbnobj/Common/Calibration/TrackInfoBlob.h"
+
+// ROOT libraries
+#include "TBufferFile.h"
+#include "TClass.h"
+#include "TList.h"
+#include "TObjArray.h"
+#include "TStreamerElement.h"
+#include "TStreamerInfo.h"
+#include "TVirtualCollectionProxy.h"
+
+// C/C++ standard libraries
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+
+namespace {
+  TClass *TrackInfoClass() {
+    static TClass *const cl = TClass::GetClass(typeid(sbn::TrackInfo));
+    if (!cl || !cl->HasDictionary())
+      throw std::runtime_error("TrackInfoBlob: no dictionary for sbn::TrackInfo");
+    return cl;
+  }
+
+  // Adds to infos the streamer information of cl and of all the classes it
+  // contains, skipping the STL containers themselves (as ROOT files do)
+  void CollectStreamerInfos(TClass *cl, TList &infos) {
+    if (!cl) return;
+    if (TVirtualCollectionProxy *proxy = cl->GetCollectionProxy()) {
+      CollectStreamerInfos(proxy->GetValueClass(), infos);
+      return;
+    }
+    if (!cl->HasDictionary() || infos.FindObject(cl->GetName())) return;
+    TVirtualStreamerInfo *info = cl->GetStreamerInfo();
+    if (!info) return;
+    infos.Add(info);
+    for (TObject *obj: *info->GetElements())
+      CollectStreamerInfos(static_cast<TStreamerElement *>(obj)->GetClassPointer(), infos);
+  }
+
+  // Streams the streamer information of the current TrackInfo version
+  std::vector<char> StreamTrackInfoSchema() {
+    TList infos;
+    CollectStreamerInfos(TrackInfoClass(), infos);
+    TBufferFile buffer(TBuffer::kWrite);
+    buffer.WriteObjectAny(&infos, TList::Class());
+    return { buffer.Buffer(), buffer.Buffer() + buffer.Length() };
+  }
+}
+
+namespace sbn {
+  TrackInfoBlob::TrackInfoBlob(const std::vector<TrackInfo> &tracks):
+    fClassVersion(0)
+  {
+    fIDs.reserve(tracks.size());
+    fCryostats.reserve(tracks.size());
+    fOffsets.reserve(tracks.size() + 1);
+    for (const TrackInfo &track: tracks) push_back(track);
+  }
+
+  size_t TrackInfoBlob::Find(int id) const {
+    return std::find(fIDs.begin(), fIDs.end(), id) - fIDs.begin();
+  }
+
+  void TrackInfoBlob::push_back(const TrackInfo &track) {
+    TClass *const cl = TrackInfoClass();
+    if (fClassVersion != cl->GetClassVersion()) {
+      // all the tracks in the blob share the same version and schema
+      if (!empty()) *this = TrackInfoBlob(DecodeAll());
+      else {
+        fClassVersion = cl->GetClassVersion();
+        fSchema = StreamTrackInfoSchema();
+      }
+    }
+
+    TBufferFile buffer(TBuffer::kWrite);
+    buffer.StreamObject(const_cast<TrackInfo *>(&track), cl);
+    fBytes.insert(fBytes.end(), buffer.Buffer(), buffer.Buffer() + buffer.Length());
+    fOffsets.push_back(fBytes.size());
+    fIDs.push_back(track.id);
+    fCryostats.push_back(track.cryostat);
+  }
+
+  TrackInfo TrackInfoBlob::at(size_t i) const {
+    if (i >= size())
+      throw std::out_of_range("TrackInfoBlob: track " + std::to_string(i) + " requested, only " + std::to_string(size()) + " present");
+    TClass *const cl = TrackInfoClass();
+    if (cl->GetClassVersion() != fClassVersion) LoadSchema();
+
+    // the buffer is only read from, and it is not adopted
+    TBufferFile buffer(TBuffer::kRead, NBytes(i), const_cast<char *>(fBytes.data() + fOffsets[i]), false);
+    TrackInfo track;
+    buffer.StreamObject(&track, cl);
+    return track;
+  }
+
+  std::vector<TrackInfo> TrackInfoBlob::DecodeAll() const {
+    std::vector<TrackInfo> tracks;
+    tracks.reserve(size());
+    for (size_t i = 0; i < size(); i++) tracks.push_back(at(i));
+    return tracks;
+  }
+
+  void TrackInfoBlob::LoadSchema() const {
+    // the schema of each TrackInfo version is loaded once per process
+    static std::mutex mutex;
+    static std::set<short> loadedVersions;
+    std::lock_guard<std::mutex> const lock(mutex);
+    if (loadedVersions.count(fClassVersion)) return;
+
+    if (fSchema.empty())
+      throw std::runtime_error("TrackInfoBlob: tracks written with sbn::TrackInfo version " + std::to_string(fClassVersion)
+                               + " without streamer information, reading with version "
+                               + std::to_string(TrackInfoClass()->GetClassVersion()));
+
+    // the buffer is only read from, and it is not adopted
+    TBufferFile buffer(TBuffer::kRead, fSchema.size(), const_cast<char *>(fSchema.data()), false);
+    std::unique_ptr<TList> infos { static_cast<TList *>(buffer.ReadObjectAny(TList::Class())) };
+    if (!infos)
+      throw std::runtime_error("TrackInfoBlob: corrupted streamer information for sbn::TrackInfo version " + std::to_string(fClassVersion));
+
+    // as TFile::ReadStreamerInfo(): ROOT takes over the streamer information
+    // it did not know about yet, the list itself does not own it
+    for (TObject *obj: *infos) static_cast<TStreamerInfo *>(obj)->BuildCheck();
+
+    loadedVersions.insert(fClassVersion);
+  }
+}
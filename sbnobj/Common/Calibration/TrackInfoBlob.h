@@ -0,0 +1,62 @@
+#ifndef SBN_TrackInfoBlob
+#define SBN_TrackInfoBlob
+
+#include "sbnobj/Common/Calibration/TrackCaloSkimmerObj.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Collection of TrackInfo stored as one byte buffer plus the offset of each
+// track in it. Reading the product from a file only reads the buffer (no
+// per-track or per-hit allocation); each track is decoded only when asked
+// for, with the ROOT streamer of TrackInfo. The id and cryostat of each track
+// are kept in plain vectors, so tracks can be selected before decoding them.
+//
+// Tracks are streamed with the TrackInfo class version of the writer. The
+// blob also keeps the ROOT streamer information of that version of TrackInfo
+// and of the classes it contains, the same way a ROOT file does: a reader with
+// a different version of TrackInfo loads it before decoding, and the tracks
+// are converted by the usual ROOT schema evolution (including the I/O rules
+// in classes_def.xml).
+
+namespace sbn {
+  class TrackInfoBlob {
+  public:
+    TrackInfoBlob(): fClassVersion(0) {}
+    explicit TrackInfoBlob(const std::vector<TrackInfo> &tracks);
+
+    size_t size() const { return fIDs.size(); }
+    bool empty() const { return fIDs.empty(); }
+
+    int ID(size_t i) const { return fIDs[i]; } //!< ID of the i-th track
+    int Cryostat(size_t i) const { return fCryostats[i]; } //!< Cryostat of the i-th track
+    size_t NBytes(size_t i) const { return fOffsets[i + 1] - fOffsets[i]; } //!< Streamed size of the i-th track
+
+    // Returns the index of the first track with the given ID, size() if none
+    size_t Find(int id) const;
+
+    // Appends a copy of the track; a blob written with a different TrackInfo
+    // class version is first converted to the current one
+    void push_back(const TrackInfo &track);
+
+    // Returns the i-th track, decoded
+    TrackInfo at(size_t i) const;
+
+    // Returns all the tracks, decoded
+    std::vector<TrackInfo> DecodeAll() const;
+
+  private:
+    short fClassVersion; //!< TrackInfo class version the tracks are streamed with
+    std::vector<char> fSchema; //!< Streamer information of TrackInfo version fClassVersion and its members
+    std::vector<int> fIDs; //!< ID of each track
+    std::vector<int> fCryostats; //!< Cryostat of each track
+    std::vector<uint64_t> fOffsets{0}; //!< Start of each track in fBytes, plus the end
+    std::vector<char> fBytes; //!< Streamed tracks
+
+    // Makes the streamer information in fSchema known to ROOT, if needed
+    void LoadSchema() const;
+  };
+}
+
+#endif
@@ -1,2 +1,5 @@
 #include "sbnobj/Common/Calibration/TrackCaloSkimmerObj.h"
+#include "sbnobj/Common/Calibration/TrackCaloSkimmerADCPool.h"
+#include "sbnobj/Common/Calibration/TrackCaloSkimmerColumns.h"
+#include "sbnobj/Common/Calibration/TrackInfoBlob.h"
 #include <vector>
@@ -0,0 +1,260 @@
+#include "DetectorAcceptanceCache.h"
+
+#include "cetlib_except/exception.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+
+double dot(const double a[3], const double b[3]) {
+  return a[0]*b[0] + a[1]*b[1] + a[2]*b[2];
+}
+
+double distance(const double a[3], const double b[3]) {
+  double const d[3] = {a[0] - b[0], a[1] - b[1], a[2] - b[2]};
+  return std::sqrt(dot(d, d));
+}
+
+// Sets `unit` to `v` normalized; false if `v` is null
+bool normalize(const double v[3], double unit[3]) {
+  double const mag = std::sqrt(dot(v, v));
+  if (!(mag > 0.)) return false;
+  for (int i = 0; i < 3; i++) unit[i] = v[i] / mag;
+  return true;
+}
+
+// Unit direction of the gnomonic coordinates (gx, gy) around `axis`
+void gnomonicDirection(const double axis[3], const double u[3], const double v[3],
+                       double gx, double gy, double dir[3]) {
+  double const d[3] = {
+    axis[0] + gx*u[0] + gy*v[0],
+    axis[1] + gx*u[1] + gy*v[1],
+    axis[2] + gx*u[2] + gy*v[2]
+  };
+  normalize(d, dir);
+}
+
+} // namespace
+
+evgen::ldm::DetectorAcceptanceCache::DetectorAcceptanceCache(
+    const TVector3 &box_lo_, const TVector3 &box_hi_,
+    const TVector3 &region_lo_, const TVector3 &region_hi_,
+    std::array<unsigned, 3> ncells_, unsigned ndirbins_)
+  : ndirbins(ndirbins_)
+{
+  double const region_hi[3] = {region_hi_.X(), region_hi_.Y(), region_hi_.Z()};
+  for (int i = 0; i < 3; i++) {
+    box_lo[i] = box_lo_[i];
+    box_hi[i] = box_hi_[i];
+    region_lo[i] = region_lo_[i];
+    ncells[i] = ncells_[i];
+    if (!(box_hi[i] > box_lo[i]) || !(region_hi[i] > region_lo[i]) || ncells[i] == 0) {
+      throw cet::exception("DetectorAcceptanceCache")
+        << "Invalid configuration on axis " << i << ": box [ " << box_lo[i]
+        << " ; " << box_hi[i] << " ], region [ " << region_lo[i] << " ; "
+        << region_hi[i] << " ] in " << ncells[i] << " cells.\n";
+    }
+    cell_size[i] = (region_hi[i] - region_lo[i]) / ncells[i];
+  }
+  if (ndirbins == 0) {
+    throw cet::exception("DetectorAcceptanceCache")
+      << "At least one direction bin is needed.\n";
+  }
+
+  std::size_t const n = std::size_t(ncells[0]) * ncells[1] * ncells[2];
+  cells.resize(n);
+  bins.resize(n * ndirbins * ndirbins);
+  double const radius = 0.5 * std::sqrt(dot(cell_size, cell_size));
+  for (unsigned iz = 0; iz < ncells[2]; iz++) {
+    for (unsigned iy = 0; iy < ncells[1]; iy++) {
+      for (unsigned ix = 0; ix < ncells[0]; ix++) {
+        double const center[3] = {
+          region_lo[0] + (ix + 0.5) * cell_size[0],
+          region_lo[1] + (iy + 0.5) * cell_size[1],
+          region_lo[2] + (iz + 0.5) * cell_size[2]
+        };
+        buildCell((std::size_t(iz) * ncells[1] + iy) * ncells[0] + ix, center, radius);
+      }
+    }
+  }
+}
+
+void evgen::ldm::DetectorAcceptanceCache::buildCell(std::size_t index, const double center[3], double radius) {
+  Cell &cell = cells[index];
+  std::uint8_t *cell_bins = bins.data() + index * ndirbins * ndirbins;
+
+  double const box_center[3] = {
+    0.5 * (box_lo[0] + box_hi[0]),
+    0.5 * (box_lo[1] + box_hi[1]),
+    0.5 * (box_lo[2] + box_hi[2])
+  };
+  double const box_radius = 0.5 * distance(box_lo, box_hi);
+  double const to_box[3] = {
+    box_center[0] - center[0],
+    box_center[1] - center[1],
+    box_center[2] - center[2]
+  };
+  double const dist = std::sqrt(dot(to_box, to_box));
+
+  // the cone holds the sphere around the box, from anywhere in the cell
+  double const sin_max = (box_radius + radius) / dist;
+  cell.exact = !(sin_max < 0.99);
+  if (cell.exact) {
+    cell.cos_max = -1.;
+    cell.tan_max = 0.;
+    std::fill(cell_bins, cell_bins + ndirbins * ndirbins, kBoundary);
+    return;
+  }
+  cell.cos_max = std::sqrt(1. - sin_max * sin_max);
+  cell.tan_max = sin_max / cell.cos_max;
+  normalize(to_box, cell.axis);
+
+  // projection axes, orthogonal to the cone axis
+  static const double x_axis[3] = {1., 0., 0.};
+  static const double y_axis[3] = {0., 1., 0.};
+  double const *ref = (std::abs(cell.axis[0]) < 0.6)? x_axis: y_axis;
+  double const cross[3] = {
+    cell.axis[1]*ref[2] - cell.axis[2]*ref[1],
+    cell.axis[2]*ref[0] - cell.axis[0]*ref[2],
+    cell.axis[0]*ref[1] - cell.axis[1]*ref[0]
+  };
+  normalize(cross, cell.u);
+  cell.v[0] = cell.axis[1]*cell.u[2] - cell.axis[2]*cell.u[1];
+  cell.v[1] = cell.axis[2]*cell.u[0] - cell.axis[0]*cell.u[2];
+  cell.v[2] = cell.axis[0]*cell.u[1] - cell.axis[1]*cell.u[0];
+
+  // farthest point of the box from the cell
+  double far_dist = radius;
+  for (int corner = 0; corner < 8; corner++) {
+    double const p[3] = {
+      (corner & 1)? box_hi[0]: box_lo[0],
+      (corner & 2)? box_hi[1]: box_lo[1],
+      (corner & 4)? box_hi[2]: box_lo[2]
+    };
+    far_dist = std::max(far_dist, distance(p, center) + radius);
+  }
+
+  // a ray from the cell with a direction in a bin stays, up to the box
+  // distance, closer than `margin` to the ray from the cell center along the
+  // bin center direction: that ray decides for the whole bin if it misses the
+  // box grown by `margin`, or it hits the box shrunk by it
+  double const width = 2. * cell.tan_max / ndirbins;
+  for (unsigned iy = 0; iy < ndirbins; iy++) {
+    for (unsigned ix = 0; ix < ndirbins; ix++) {
+      double const gx = -cell.tan_max + (ix + 0.5) * width;
+      double const gy = -cell.tan_max + (iy + 0.5) * width;
+      double dir[3];
+      gnomonicDirection(cell.axis, cell.u, cell.v, gx, gy, dir);
+
+      // the bin is a spherical quadrilateral: its farthest points are corners
+      double chord = 0.;
+      for (int corner = 0; corner < 4; corner++) {
+        double cdir[3];
+        gnomonicDirection(cell.axis, cell.u, cell.v,
+          gx + ((corner & 1)? 0.5: -0.5) * width, gy + ((corner & 2)? 0.5: -0.5) * width, cdir);
+        chord = std::max(chord, distance(cdir, dir));
+      }
+      double const margin = radius + far_dist * chord + 1e-9 * far_dist;
+
+      double grown_lo[3], grown_hi[3], shrunk_lo[3], shrunk_hi[3];
+      bool shrunk_empty = false;
+      for (int i = 0; i < 3; i++) {
+        grown_lo[i] = box_lo[i] - margin;
+        grown_hi[i] = box_hi[i] + margin;
+        shrunk_lo[i] = box_lo[i] + margin;
+        shrunk_hi[i] = box_hi[i] - margin;
+        if (!(shrunk_lo[i] < shrunk_hi[i])) shrunk_empty = true;
+      }
+
+      double t0, t1;
+      Acceptance acceptance = kBoundary;
+      if (!intersectBox(grown_lo, grown_hi, center, dir, t0, t1)) acceptance = kMiss;
+      else if (!shrunk_empty && intersectBox(shrunk_lo, shrunk_hi, center, dir, t0, t1)) acceptance = kHit;
+      cell_bins[iy * ndirbins + ix] = acceptance;
+    }
+  }
+}
+
+long evgen::ldm::DetectorAcceptanceCache::cellIndex(const double pos[3]) const {
+  if (cells.empty()) return -1;
+  long index = 0;
+  for (int i = 2; i >= 0; i--) {
+    double const x = (pos[i] - region_lo[i]) / cell_size[i];
+    if (!(x >= 0.) || !(x <= ncells[i])) return -1;
+    unsigned const c = std::min(static_cast<unsigned>(x), ncells[i] - 1);
+    index = index * ncells[i] + c;
+  }
+  return index;
+}
+
+evgen::ldm::DetectorAcceptanceCache::Acceptance
+evgen::ldm::DetectorAcceptanceCache::classify(const TVector3 &pos, const TVector3 &dir) const {
+  double const p[3] = {pos.X(), pos.Y(), pos.Z()};
+  long const index = cellIndex(p);
+  if (index < 0) return kBoundary;
+  Cell const &cell = cells[index];
+  if (cell.exact) return kBoundary;
+
+  double const d[3] = {dir.X(), dir.Y(), dir.Z()};
+  double unit[3];
+  if (!normalize(d, unit)) return kMiss;
+  double const cosine = dot(unit, cell.axis);
+  if (!(cosine > cell.cos_max)) return kMiss; // out of the cone
+
+  double const width = 2. * cell.tan_max / ndirbins;
+  double const gx = dot(unit, cell.u) / cosine;
+  double const gy = dot(unit, cell.v) / cosine;
+  long const ix = std::clamp(static_cast<long>(std::floor((gx + cell.tan_max) / width)), 0L, long(ndirbins) - 1);
+  long const iy = std::clamp(static_cast<long>(std::floor((gy + cell.tan_max) / width)), 0L, long(ndirbins) - 1);
+  return static_cast<Acceptance>(bins[(std::size_t(index) * ndirbins + iy) * ndirbins + ix]);
+}
+
+bool evgen::ldm::DetectorAcceptanceCache::hits(const TVector3 &pos, const TVector3 &dir) const {
+  Acceptance const acceptance = classify(pos, dir);
+  if (acceptance != kBoundary) return acceptance == kHit;
+  double const p[3] = {pos.X(), pos.Y(), pos.Z()};
+  double const d[3] = {dir.X(), dir.Y(), dir.Z()};
+  double t0, t1;
+  return intersectBox(box_lo, box_hi, p, d, t0, t1);
+}
+
+bool evgen::ldm::DetectorAcceptanceCache::intersect(const TVector3 &pos, const TVector3 &dir, std::array<TVector3, 2> &inout) const {
+  if (classify(pos, dir) == kMiss) return false;
+  double const p[3] = {pos.X(), pos.Y(), pos.Z()};
+  double const d[3] = {dir.X(), dir.Y(), dir.Z()};
+  double t0, t1;
+  if (!intersectBox(box_lo, box_hi, p, d, t0, t1)) return false;
+  inout[0] = TVector3(p[0] + t0*d[0], p[1] + t0*d[1], p[2] + t0*d[2]);
+  inout[1] = TVector3(p[0] + t1*d[0], p[1] + t1*d[1], p[2] + t1*d[2]);
+  return true;
+}
+
+double evgen::ldm::DetectorAcceptanceCache::maxSolidAngle(const TVector3 &pos) const {
+  double const p[3] = {pos.X(), pos.Y(), pos.Z()};
+  long const index = cellIndex(p);
+  if (index < 0 || cells[index].exact) return 4. * M_PI;
+  return 2. * M_PI * (1. - cells[index].cos_max);
+}
+
+bool evgen::ldm::DetectorAcceptanceCache::intersectBox(const double lo[3], const double hi[3],
+                                                        const double pos[3], const double dir[3],
+                                                        double &t0, double &t1) {
+  // slab method: the ray is in the box where it is within all three slabs
+  t0 = 0.;
+  t1 = std::numeric_limits<double>::infinity();
+  for (int i = 0; i < 3; i++) {
+    if (dir[i] == 0.) {
+      if (pos[i] < lo[i] || pos[i] > hi[i]) return false;
+      continue;
+    }
+    double const inv = 1. / dir[i];
+    double const ta = (lo[i] - pos[i]) * inv;
+    double const tb = (hi[i] - pos[i]) * inv;
+    t0 = std::max(t0, std::min(ta, tb));
+    t1 = std::min(t1, std::max(ta, tb));
+    if (t0 > t1) return false;
+  }
+  return true;
+}
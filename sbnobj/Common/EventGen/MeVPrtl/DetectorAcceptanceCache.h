@@ -0,0 +1,102 @@
+#ifndef _DetectorAcceptanceCache_HH_
+#define _DetectorAcceptanceCache_HH_
+
+#include "TVector3.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace evgen {
+namespace ldm {
+
+// Detector acceptance of rays from the parent decay positions, precomputed.
+//
+// Most of the rays of a MeV-scale particle from its parent decay miss the
+// detector. The cache divides a region of the decay positions (e.g. the decay
+// pipe) in cells, and for each cell it tabulates which ray directions can hit
+// the detector box. The directions allowed from a cell are within the cone
+// containing the detector as seen from anywhere in the cell; the cone is
+// split in bins of its gnomonic projection, and each bin is flagged as a sure
+// miss, a sure hit, or near the box boundary. Rays in miss bins, or outside
+// the cone, are rejected with a table lookup; the exact intersection with the
+// box is computed only for the others, and for decay positions outside the
+// region or too close to the detector.
+//
+// Positions, directions and the box are all in the same frame (e.g. the
+// detector one), with the box aligned to its axes. Rays start at their
+// position and go forward only. Directions need not be normalized.
+class DetectorAcceptanceCache {
+public:
+  enum Acceptance: std::uint8_t {
+    kMiss = 0, // no ray in the bin hits the box
+    kHit = 1, // all rays in the bin hit the box
+    kBoundary = 2 // the exact intersection decides
+  };
+
+  DetectorAcceptanceCache() {} // Default initialize
+
+  // Builds the table of the detector box [box_lo, box_hi] seen from the
+  // region [region_lo, region_hi], split in ncells cells on each axis, with
+  // ndirbins x ndirbins direction bins in each cell. Throws on an empty box
+  // or region, or with no cells or bins.
+  DetectorAcceptanceCache(const TVector3 &box_lo, const TVector3 &box_hi,
+                          const TVector3 &region_lo, const TVector3 &region_hi,
+                          std::array<unsigned, 3> ncells, unsigned ndirbins);
+
+  // Acceptance of the bin of the ray from `pos` along `dir`; kBoundary if
+  // the position is not covered by the table
+  Acceptance classify(const TVector3 &pos, const TVector3 &dir) const;
+
+  // Whether the ray from `pos` along `dir` hits the detector box (exact)
+  bool hits(const TVector3 &pos, const TVector3 &dir) const;
+
+  // Same as `hits()`; on a hit, `inout` is set to the points where the ray
+  // enters and exits the box (the entry is `pos` if it is inside the box)
+  bool intersect(const TVector3 &pos, const TVector3 &dir, std::array<TVector3, 2> &inout) const;
+
+  // Upper bound of the solid angle of the detector seen from `pos`: the one
+  // of the cone of its cell; 4 pi if the position is not covered by the table
+  double maxSolidAngle(const TVector3 &pos) const;
+
+  std::size_t nCells() const { return cells.size(); }
+  unsigned nDirectionBins() const { return ndirbins; }
+  bool empty() const { return cells.empty(); }
+
+  // Parameters `t0` < `t1` along the ray from `pos` along `dir` where it is
+  // in the box [lo, hi], with `t0` not negative; false if it does not hit it
+  static bool intersectBox(const double lo[3], const double hi[3],
+                           const double pos[3], const double dir[3],
+                           double &t0, double &t1);
+
+private:
+  struct Cell {
+    double axis[3]; // direction of the center of the box from the cell center
+    double u[3]; // first axis of the gnomonic projection
+    double v[3]; // second axis of the gnomonic projection
+    double cos_max; // cosine of the half-aperture of the cone
+    double tan_max; // half-size of the direction bin table
+    bool exact; // whether the table is not used (cell too close to the box)
+  };
+
+  double box_lo[3] = {0., 0., 0.};
+  double box_hi[3] = {0., 0., 0.};
+  double region_lo[3] = {0., 0., 0.};
+  double cell_size[3] = {0., 0., 0.};
+  unsigned ncells[3] = {0, 0, 0};
+  unsigned ndirbins = 0;
+
+  std::vector<Cell> cells; // cells, x fastest
+  std::vector<std::uint8_t> bins; // `Acceptance` of the direction bins of each cell
+
+  // Index of the cell of `pos`, -1 if out of the region
+  long cellIndex(const double pos[3]) const;
+  void buildCell(std::size_t index, const double center[3], double radius);
+};
+
+} // end namespace ldm
+
+} // end namespace evgen
+
+#endif
@@ -0,0 +1,169 @@
+#include "MeVPrtlCompact.h"
+
+std::vector<evgen::ldm::Vector3D> evgen::ldm::toVector3D(const std::vector<TVector3> &v) {
+  std::vector<Vector3D> ret;
+  ret.reserve(v.size());
+  for (const TVector3 &p: v) ret.emplace_back(p);
+  return ret;
+}
+
+std::vector<TVector3> evgen::ldm::toTVector3(const std::vector<Vector3D> &v) {
+  std::vector<TVector3> ret;
+  ret.reserve(v.size());
+  for (const Vector3D &p: v) ret.push_back(p.toTVector3());
+  return ret;
+}
+
+evgen::ldm::MeVPrtlFluxCompact::MeVPrtlFluxCompact(const MeVPrtlFlux &flux) :
+  pos_beamcoord(flux.pos_beamcoord),
+  pos(flux.pos),
+  mmom_beamcoord(flux.mmom_beamcoord),
+  mmom(flux.mmom),
+  mom(flux.mom),
+  mom_beamcoord(flux.mom_beamcoord),
+  sec(flux.sec),
+  sec_beamcoord(flux.sec_beamcoord),
+  equiv_enu(flux.equiv_enu),
+  C1(flux.C1),
+  C2(flux.C2),
+  C3(flux.C3),
+  C4(flux.C4),
+  C5(flux.C5),
+  mass(flux.mass),
+  polarization(flux.polarization),
+  meson_pdg(flux.meson_pdg),
+  secondary_pdg(flux.secondary_pdg),
+  generator(flux.generator)
+  {}
+
+evgen::ldm::MeVPrtlFlux evgen::ldm::MeVPrtlFluxCompact::toFlux() const {
+  MeVPrtlFlux flux;
+  flux.pos_beamcoord = pos_beamcoord.toTLorentzVector();
+  flux.pos = pos.toTLorentzVector();
+  flux.mmom_beamcoord = mmom_beamcoord.toTLorentzVector();
+  flux.mmom = mmom.toTLorentzVector();
+  flux.mom = mom.toTLorentzVector();
+  flux.mom_beamcoord = mom_beamcoord.toTLorentzVector();
+  flux.sec = sec.toTLorentzVector();
+  flux.sec_beamcoord = sec_beamcoord.toTLorentzVector();
+  flux.equiv_enu = equiv_enu;
+  flux.C1 = C1;
+  flux.C2 = C2;
+  flux.C3 = C3;
+  flux.C4 = C4;
+  flux.C5 = C5;
+  flux.mass = mass;
+  flux.polarization = polarization;
+  flux.meson_pdg = meson_pdg;
+  flux.secondary_pdg = secondary_pdg;
+  flux.generator = generator;
+  return flux;
+}
+
+evgen::ldm::MeVPrtlDecayCompact::MeVPrtlDecayCompact(const MeVPrtlDecay &decay) :
+  pos(decay.pos),
+  daughter_mom(toVector3D(decay.daughter_mom)),
+  daughter_e(decay.daughter_e),
+  daughter_pdg(decay.daughter_pdg),
+  total_decay_width(decay.total_decay_width),
+  total_mean_lifetime(decay.total_mean_lifetime),
+  total_mean_distance(decay.total_mean_distance),
+  allowed_decay_fraction(decay.allowed_decay_fraction)
+  {}
+
+evgen::ldm::MeVPrtlDecay evgen::ldm::MeVPrtlDecayCompact::toDecay() const {
+  MeVPrtlDecay decay;
+  decay.pos = pos.toTLorentzVector();
+  decay.daughter_mom = toTVector3(daughter_mom);
+  decay.daughter_e = daughter_e;
+  decay.daughter_pdg = daughter_pdg;
+  decay.total_decay_width = total_decay_width;
+  decay.total_mean_lifetime = total_mean_lifetime;
+  decay.total_mean_distance = total_mean_distance;
+  decay.allowed_decay_fraction = allowed_decay_fraction;
+  return decay;
+}
+
+evgen::ldm::MeVPrtlTruthCompact::MeVPrtlTruthCompact(const MeVPrtlTruth &truth) :
+  meson_dmom(truth.meson_dmom),
+  meson_dmom_beamcoord(truth.meson_dmom_beamcoord),
+  meson_dpos_beamcoord(truth.meson_dpos_beamcoord),
+  meson_pdg(truth.meson_pdg),
+  mevprtl_mom_beamcoord(truth.mevprtl_mom_beamcoord),
+  mevprtl_mom(truth.mevprtl_mom),
+  mevprtl_start(truth.mevprtl_start),
+  equiv_enu(truth.equiv_enu),
+  mevprtl_enter(toVector3F(truth.mevprtl_enter)),
+  mevprtl_exit(toVector3F(truth.mevprtl_exit)),
+  decay_pos(truth.decay_pos),
+  daughter_mom(toVector3D(truth.daughter_mom)),
+  daughter_e(truth.daughter_e),
+  daughter_pdg(truth.daughter_pdg),
+  pot(truth.pot),
+  flux_weight(truth.flux_weight),
+  ray_weight(truth.ray_weight),
+  decay_weight(truth.decay_weight),
+  mass(truth.mass),
+  C1(truth.C1),
+  C2(truth.C2),
+  C3(truth.C3),
+  C4(truth.C4),
+  C5(truth.C5),
+  total_decay_width(truth.total_decay_width),
+  total_mean_lifetime(truth.total_mean_lifetime),
+  total_mean_distance(truth.total_mean_distance),
+  allowed_decay_fraction(truth.allowed_decay_fraction),
+  gen(truth.gen)
+  {}
+
+evgen::ldm::MeVPrtlTruth evgen::ldm::MeVPrtlTruthCompact::toTruth() const {
+  MeVPrtlTruth truth;
+  truth.meson_dmom = meson_dmom.toTLorentzVector();
+  truth.meson_dmom_beamcoord = meson_dmom_beamcoord.toTLorentzVector();
+  truth.meson_dpos_beamcoord = meson_dpos_beamcoord.toTLorentzVector();
+  truth.meson_pdg = meson_pdg;
+  truth.mevprtl_mom_beamcoord = mevprtl_mom_beamcoord.toTLorentzVector();
+  truth.mevprtl_mom = mevprtl_mom.toTLorentzVector();
+  truth.mevprtl_start = mevprtl_start.toTLorentzVector();
+  truth.equiv_enu = equiv_enu;
+  truth.mevprtl_enter = toTVector3(mevprtl_enter);
+  truth.mevprtl_exit = toTVector3(mevprtl_exit);
+  truth.decay_pos = decay_pos.toTLorentzVector();
+  truth.daughter_mom = toTVector3(daughter_mom);
+  truth.daughter_e = daughter_e;
+  truth.daughter_pdg = daughter_pdg;
+  truth.pot = pot;
+  truth.flux_weight = flux_weight;
+  truth.ray_weight = ray_weight;
+  truth.decay_weight = decay_weight;
+  truth.mass = mass;
+  truth.C1 = C1;
+  truth.C2 = C2;
+  truth.C3 = C3;
+  truth.C4 = C4;
+  truth.C5 = C5;
+  truth.total_decay_width = total_decay_width;
+  truth.total_mean_lifetime = total_mean_lifetime;
+  truth.total_mean_distance = total_mean_distance;
+  truth.allowed_decay_fraction = allowed_decay_fraction;
+  truth.gen = gen;
+  return truth;
+}
+
+evgen::ldm::MesonParentCompact::MesonParentCompact(const MesonParent &parent) :
+  pos(parent.pos),
+  mom(parent.mom),
+  meson_pdg(parent.meson_pdg),
+  weight(parent.weight),
+  mode(parent.mode)
+  {}
+
+evgen::ldm::MesonParent evgen::ldm::MesonParentCompact::toMesonParent() const {
+  MesonParent parent;
+  parent.pos = pos.toTLorentzVector();
+  parent.mom = mom.toTLorentzVector();
+  parent.meson_pdg = meson_pdg;
+  parent.weight = weight;
+  parent.mode = mode;
+  return parent;
+}
@@ -0,0 +1,187 @@
+#ifndef _MeVPrtlCompact_HH_
+#define _MeVPrtlCompact_HH_
+
+#include "TLorentzVector.h"
+#include "TVector3.h"
+#include "MeVPrtlTruth.h"
+#include "MeVPrtlDecay.h"
+#include "MeVPrtlFlux.h"
+#include "MesonParent.h"
+#include "sbnobj/Common/Reco/Vector3F.h"
+
+#include <cstdlib>
+#include <vector>
+
+/*
+ * Compact counterparts of the MeVPrtl objects.
+ *
+ * `TLorentzVector` and `TVector3` derive from `TObject`, so each of them
+ * carries a virtual table and the `TObject` bookkeeping, and is streamed as
+ * an object of its own. The classes below hold the same information with
+ * plain vectors, and convert from and to the original classes.
+ *
+ * Positions (cm) and times (ns) are in single precision (`sbn::Vector3F` and
+ * `LorentzVectorF`): a `float` still resolves better than 0.1 mm at 1 km.
+ * Momenta and energies (GeV) keep double precision (`Vector3D` and
+ * `LorentzVectorD`), since masses are computed from them by cancellation of
+ * large numbers, which is precise only with doubles (see the note in
+ * `MesonParent(const simb::MCFlux&)`). The scalar members (weights,
+ * couplings, widths) keep their double precision too.
+ */
+
+namespace evgen {
+namespace ldm {
+
+inline sbn::Vector3F toVector3F(const TVector3 &v) { return { float(v.X()), float(v.Y()), float(v.Z()) }; }
+inline TVector3 toTVector3(const sbn::Vector3F &v) { return TVector3(v.x, v.y, v.z); }
+
+// Position and time, in single precision
+struct LorentzVectorF {
+  float x = 0.f;
+  float y = 0.f;
+  float z = 0.f;
+  float t = 0.f;
+
+  LorentzVectorF() = default;
+  LorentzVectorF(float x, float y, float z, float t): x(x), y(y), z(z), t(t) {}
+  explicit LorentzVectorF(const TLorentzVector &v): x(v.X()), y(v.Y()), z(v.Z()), t(v.T()) {}
+
+  sbn::Vector3F vect() const { return { x, y, z }; }
+  TLorentzVector toTLorentzVector() const { return TLorentzVector(x, y, z, t); }
+};
+
+// Momentum, in double precision
+struct Vector3D {
+  double x = 0.;
+  double y = 0.;
+  double z = 0.;
+
+  Vector3D() = default;
+  Vector3D(double x, double y, double z): x(x), y(y), z(z) {}
+  explicit Vector3D(const TVector3 &v): x(v.X()), y(v.Y()), z(v.Z()) {}
+
+  TVector3 toTVector3() const { return TVector3(x, y, z); }
+};
+
+// Momentum and energy, in double precision
+struct LorentzVectorD {
+  double x = 0.;
+  double y = 0.;
+  double z = 0.;
+  double t = 0.;
+
+  LorentzVectorD() = default;
+  LorentzVectorD(double x, double y, double z, double t): x(x), y(y), z(z), t(t) {}
+  explicit LorentzVectorD(const TLorentzVector &v): x(v.X()), y(v.Y()), z(v.Z()), t(v.T()) {}
+
+  Vector3D vect() const { return Vector3D(x, y, z); }
+  TLorentzVector toTLorentzVector() const { return TLorentzVector(x, y, z, t); }
+};
+
+std::vector<Vector3D> toVector3D(const std::vector<TVector3> &v);
+std::vector<TVector3> toTVector3(const std::vector<Vector3D> &v);
+
+class MeVPrtlFluxCompact {
+public:
+  LorentzVectorF pos_beamcoord;
+  LorentzVectorF pos;
+  LorentzVectorD mmom_beamcoord;
+  LorentzVectorD mmom;
+  LorentzVectorD mom;
+  LorentzVectorD mom_beamcoord;
+  LorentzVectorD sec;
+  LorentzVectorD sec_beamcoord;
+  double equiv_enu = 0.;
+  double C1 = 0.;
+  double C2 = 0.;
+  double C3 = 0.;
+  double C4 = 0.;
+  double C5 = 0.;
+  double mass = 0.;
+  double polarization = 0.;
+  int meson_pdg = 0;
+  int secondary_pdg = 0;
+  int generator = kUnknown;
+
+  MeVPrtlFluxCompact() {} // Default initialize
+  explicit MeVPrtlFluxCompact(const MeVPrtlFlux &flux);
+  MeVPrtlFlux toFlux() const;
+};
+
+class MeVPrtlDecayCompact {
+public:
+  LorentzVectorF pos;
+  std::vector<Vector3D> daughter_mom;
+  std::vector<double> daughter_e;
+  std::vector<int> daughter_pdg;
+
+  double total_decay_width = 0.;
+  double total_mean_lifetime = 0.;
+  double total_mean_distance = 0.;
+  double allowed_decay_fraction = 0.;
+
+  MeVPrtlDecayCompact() {} // Default initialize
+  explicit MeVPrtlDecayCompact(const MeVPrtlDecay &decay);
+  MeVPrtlDecay toDecay() const;
+};
+
+class MeVPrtlTruthCompact {
+public:
+  LorentzVectorD meson_dmom;
+  LorentzVectorD meson_dmom_beamcoord;
+  LorentzVectorF meson_dpos_beamcoord;
+  int meson_pdg = 0;
+  LorentzVectorD mevprtl_mom_beamcoord;
+  LorentzVectorD mevprtl_mom;
+  LorentzVectorF mevprtl_start;
+  double equiv_enu = 0.;
+  sbn::Vector3F mevprtl_enter;
+  sbn::Vector3F mevprtl_exit;
+  LorentzVectorF decay_pos;
+
+  std::vector<Vector3D> daughter_mom;
+  std::vector<double> daughter_e;
+  std::vector<int> daughter_pdg;
+  double pot = 0.;
+  double flux_weight = 0.;
+  double ray_weight = 0.;
+  double decay_weight = 0.;
+
+  double mass = 0.;
+  double C1 = 0.;
+  double C2 = 0.;
+  double C3 = 0.;
+  double C4 = 0.;
+  double C5 = 0.;
+
+  double total_decay_width = 0.;
+  double total_mean_lifetime = 0.;
+  double total_mean_distance = 0.;
+  double allowed_decay_fraction = 0.;
+
+  Generator gen = kUnknown;
+
+  MeVPrtlTruthCompact() {} // Default initialize
+  explicit MeVPrtlTruthCompact(const MeVPrtlTruth &truth);
+  MeVPrtlTruth toTruth() const;
+};
+
+class MesonParentCompact {
+public:
+  LorentzVectorF pos;
+  LorentzVectorD mom;
+  int meson_pdg = 0;
+  double weight = 0.;
+  int mode = 0;
+
+  MesonParentCompact() {} // Default initialize
+  explicit MesonParentCompact(const MesonParent &parent);
+  MesonParent toMesonParent() const;
+  bool isKaon() const {return abs(meson_pdg) == 321 || meson_pdg == 130;}
+};
+
+} // end namespace ldm
+
+} // end namespace evgen
+
+#endif
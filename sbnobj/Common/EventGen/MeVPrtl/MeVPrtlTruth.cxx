@@ -1,5 +1,10 @@
 #include "MeVPrtlTruth.h"
 
+#include "cetlib_except/exception.h"
+
+#include <algorithm>
+#include <utility>
+
 evgen::ldm::MeVPrtlTruth::MeVPrtlTruth(const MeVPrtlFlux &flux,
                                        const MeVPrtlDecay &decay,
                                        std::array<TVector3, 2> inout,
@@ -37,3 +42,69 @@ evgen::ldm::MeVPrtlTruth::MeVPrtlTruth(const MeVPrtlFlux &flux,
   {
      gen = (evgen::ldm::Generator)flux.generator;
   }
+
+evgen::ldm::MeVPrtlTruth::MeVPrtlTruth(const MeVPrtlFlux &flux,
+                                       MeVPrtlDecay &&decay,
+                                       std::array<TVector3, 2> inout,
+                                       double flux_weight, double ray_weight,
+                                       double decay_weight, double pot) :
+
+  meson_dmom(flux.mmom),
+  meson_dmom_beamcoord(flux.mmom_beamcoord),
+  meson_dpos_beamcoord(flux.pos_beamcoord),
+  meson_pdg(flux.meson_pdg),
+  mevprtl_mom_beamcoord(flux.mom_beamcoord),
+  mevprtl_mom(flux.mom),
+  mevprtl_start(flux.pos),
+  equiv_enu(flux.equiv_enu),
+  mevprtl_enter(inout[0]),
+  mevprtl_exit(inout[1]),
+  decay_pos(decay.pos),
+  daughter_mom(std::move(decay.daughter_mom)),
+  daughter_e(std::move(decay.daughter_e)),
+  daughter_pdg(std::move(decay.daughter_pdg)),
+  pot(pot),
+  flux_weight(flux_weight),
+  ray_weight(ray_weight),
+  decay_weight(decay_weight),
+  mass(flux.mass),
+  C1(flux.C1),
+  C2(flux.C2),
+  C3(flux.C3),
+  C4(flux.C4),
+  C5(flux.C5),
+  total_decay_width(decay.total_decay_width),
+  total_mean_lifetime(decay.total_mean_lifetime),
+  total_mean_distance(decay.total_mean_distance),
+  allowed_decay_fraction(decay.allowed_decay_fraction)
+  {
+     gen = (evgen::ldm::Generator)flux.generator;
+  }
+
+std::size_t evgen::ldm::appendMeVPrtlTruths(std::vector<MeVPrtlTruth> &truths,
+                                            const std::vector<MeVPrtlFlux> &flux,
+                                            std::vector<MeVPrtlDecay> &&decay,
+                                            const std::vector<std::array<TVector3, 2>> &inout,
+                                            const std::vector<double> &flux_weight,
+                                            const std::vector<double> &ray_weight,
+                                            const std::vector<double> &decay_weight,
+                                            double pot) {
+  std::size_t const n = flux.size();
+  if (decay.size() != n || inout.size() != n || flux_weight.size() != n
+    || ray_weight.size() != n || decay_weight.size() != n) {
+    throw cet::exception("MeVPrtlTruth")
+      << "appendMeVPrtlTruths(): " << n << " fluxes, " << decay.size()
+      << " decays, " << inout.size() << " intersections and "
+      << flux_weight.size() << "/" << ray_weight.size() << "/" << decay_weight.size()
+      << " flux/ray/decay weights.\n";
+  }
+
+  // grow geometrically, so that repeated small appends stay linear
+  if (truths.capacity() < truths.size() + n)
+    truths.reserve(std::max(truths.size() + n, 2 * truths.capacity()));
+  for (std::size_t i = 0; i < n; i++) {
+    truths.emplace_back(flux[i], std::move(decay[i]), inout[i],
+                        flux_weight[i], ray_weight[i], decay_weight[i], pot);
+  }
+  return n;
+}
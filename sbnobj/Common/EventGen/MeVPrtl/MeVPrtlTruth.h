@@ -5,6 +5,8 @@
 #include "MeVPrtlDecay.h"
 #include "MeVPrtlFlux.h"
 #include <array>
+#include <cstddef>
+#include <vector>
 
 namespace evgen {
 namespace ldm {
@@ -60,9 +62,24 @@ public:
   Generator gen;
 
   MeVPrtlTruth(const MeVPrtlFlux &flux, const MeVPrtlDecay &decay, std::array<TVector3, 2> inout, double flux_weight, double ray_weight, double decay_weight, double pot);
+  // Takes over the daughter vectors of the decay instead of copying them
+  MeVPrtlTruth(const MeVPrtlFlux &flux, MeVPrtlDecay &&decay, std::array<TVector3, 2> inout, double flux_weight, double ray_weight, double decay_weight, double pot);
   MeVPrtlTruth() {} // Default initialize
 };
 
+// Appends to `truths` one truth for each entry of the input arrays, which
+// must all have the same size; the decays are moved from, and `truths` grows
+// by at most one allocation. The same `pot` is assigned to all the new truths.
+// Returns the number of truths added.
+std::size_t appendMeVPrtlTruths(std::vector<MeVPrtlTruth> &truths,
+                                const std::vector<MeVPrtlFlux> &flux,
+                                std::vector<MeVPrtlDecay> &&decay,
+                                const std::vector<std::array<TVector3, 2>> &inout,
+                                const std::vector<double> &flux_weight,
+                                const std::vector<double> &ray_weight,
+                                const std::vector<double> &decay_weight,
+                                double pot);
+
 } // end namespace ldm
 
 } // end namespace evgen
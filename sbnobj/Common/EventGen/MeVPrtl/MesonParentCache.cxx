@@ -0,0 +1,123 @@
+#include "MesonParentCache.h"
+
+#include "cetlib_except/exception.h"
+
+#include <cmath>
+
+void evgen::ldm::MesonParentCache::reserve(std::size_t n) {
+  pos_x.reserve(n);
+  pos_y.reserve(n);
+  pos_z.reserve(n);
+  pos_t.reserve(n);
+  mom_x.reserve(n);
+  mom_y.reserve(n);
+  mom_z.reserve(n);
+  mom_e.reserve(n);
+  meson_pdg.reserve(n);
+  weight.reserve(n);
+  mode.reserve(n);
+}
+
+void evgen::ldm::MesonParentCache::add(const MesonParent &parent) {
+  pos_x.push_back(parent.pos.X());
+  pos_y.push_back(parent.pos.Y());
+  pos_z.push_back(parent.pos.Z());
+  pos_t.push_back(parent.pos.T());
+  mom_x.push_back(parent.mom.X());
+  mom_y.push_back(parent.mom.Y());
+  mom_z.push_back(parent.mom.Z());
+  mom_e.push_back(parent.mom.T());
+  meson_pdg.push_back(parent.meson_pdg);
+  weight.push_back(parent.weight);
+  mode.push_back(parent.mode);
+  alias_prob.clear();
+  alias.clear();
+}
+
+bool evgen::ldm::MesonParentCache::add(const simb::MCFlux &flux) {
+  MesonParent parent(flux);
+  if (parent.meson_pdg == 0) return false; // not a kaon decay
+  add(parent);
+  return true;
+}
+
+evgen::ldm::MesonParent evgen::ldm::MesonParentCache::parent(std::size_t i) const {
+  MesonParent ret;
+  ret.pos = TLorentzVector(pos_x[i], pos_y[i], pos_z[i], pos_t[i]);
+  ret.mom = TLorentzVector(mom_x[i], mom_y[i], mom_z[i], mom_e[i]);
+  ret.meson_pdg = meson_pdg[i];
+  ret.weight = weight[i];
+  ret.mode = mode[i];
+  return ret;
+}
+
+void evgen::ldm::MesonParentCache::buildAliasTable() {
+  std::size_t const n = size();
+
+  total_weight = 0.;
+  for (double w: weight) {
+    if (!(w >= 0.)) {
+      throw cet::exception("MesonParentCache")
+        << "buildAliasTable(): invalid parent weight " << w << ".\n";
+    }
+    total_weight += w;
+  }
+  if (!(total_weight > 0.)) {
+    throw cet::exception("MesonParentCache")
+      << "buildAliasTable(): total weight of " << n << " parents is "
+      << total_weight << ".\n";
+  }
+
+  // Vose's method: scaled probabilities are split into the ones below and
+  // above the average; each small entry is topped up by a large one
+  alias_prob.resize(n);
+  alias.resize(n);
+  std::vector<std::uint32_t> small, large;
+  small.reserve(n);
+  large.reserve(n);
+  double const scale = n / total_weight;
+  for (std::size_t i = 0; i < n; i++) {
+    alias_prob[i] = weight[i] * scale;
+    alias[i] = i;
+    (alias_prob[i] < 1.? small: large).push_back(i);
+  }
+  while (!small.empty() && !large.empty()) {
+    std::uint32_t const s = small.back();
+    small.pop_back();
+    std::uint32_t const l = large.back();
+    alias[s] = l;
+    alias_prob[l] -= 1. - alias_prob[s];
+    if (alias_prob[l] < 1.) {
+      large.pop_back();
+      small.push_back(l);
+    }
+  }
+  // what is left is at the average within rounding
+  for (std::uint32_t i: large) alias_prob[i] = 1.;
+  for (std::uint32_t i: small) alias_prob[i] = 1.;
+}
+
+void evgen::ldm::MesonParentCache::checkAliasTable() const {
+  if (!hasAliasTable()) {
+    throw cet::exception("MesonParentCache")
+      << "sample(): the alias table of the " << size()
+      << " parents has not been built.\n";
+  }
+}
+
+std::size_t evgen::ldm::MesonParentCache::sample(double u1, double u2) const {
+  checkAliasTable();
+  std::size_t const n = size();
+  std::size_t i = static_cast<std::size_t>(u1 * n);
+  if (i >= n) i = n - 1;
+  return (u2 < alias_prob[i])? i: alias[i];
+}
+
+std::size_t evgen::ldm::MesonParentCache::sample(double u) const {
+  checkAliasTable();
+  std::size_t const n = size();
+  double const x = u * n;
+  std::size_t i = static_cast<std::size_t>(x);
+  if (i >= n) i = n - 1;
+  return ((x - i) < alias_prob[i])? i: alias[i];
+}
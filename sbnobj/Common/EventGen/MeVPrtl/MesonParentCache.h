@@ -0,0 +1,79 @@
+#ifndef _MesonParentCache_HH_
+#define _MesonParentCache_HH_
+
+#include "MesonParent.h"
+#include "nusimdata/SimulationBase/MCFlux.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace evgen {
+namespace ldm {
+
+// Meson parents of a whole flux file, stored by column.
+//
+// It is meant to be filled once from the `simb::MCFlux` entries (only the
+// ones which `MesonParent` can convert are kept) and then resampled many
+// times. All the columns are contiguous arrays of fixed size types, in the
+// order the parents were added.
+//
+// Weighted sampling uses an alias table (Walker/Vose), built by
+// `buildAliasTable()` after the last parent has been added: each sample then
+// costs one table lookup, independently of the number of parents.
+class MesonParentCache {
+public:
+  MesonParentCache() {} // Default initialize
+
+  std::size_t size() const { return weight.size(); }
+  bool empty() const { return weight.empty(); }
+  void reserve(std::size_t n);
+
+  void add(const MesonParent &parent);
+  // Adds the meson parent of the flux entry; returns false and adds nothing
+  // if it is not a supported meson decay
+  bool add(const simb::MCFlux &flux);
+
+  // Copy of the parent `i` in the `MesonParent` form
+  MesonParent parent(std::size_t i) const;
+
+  double totalWeight() const { return total_weight; }
+
+  // Alias table on the parent weights; throws if the sum of the weights is
+  // not positive. Adding parents invalidates the table.
+  void buildAliasTable();
+  bool hasAliasTable() const { return alias_prob.size() == size() && !empty(); }
+
+  // Index of a parent drawn with probability proportional to its weight,
+  // from two independent uniform variates in [ 0, 1 [
+  std::size_t sample(double u1, double u2) const;
+  // Same as above, from a single uniform variate in [ 0, 1 [
+  std::size_t sample(double u) const;
+
+  // Columns
+  std::vector<double> pos_x;
+  std::vector<double> pos_y;
+  std::vector<double> pos_z;
+  std::vector<double> pos_t;
+  std::vector<double> mom_x;
+  std::vector<double> mom_y;
+  std::vector<double> mom_z;
+  std::vector<double> mom_e;
+  std::vector<int> meson_pdg;
+  std::vector<double> weight;
+  std::vector<int> mode;
+
+  // Alias table
+  std::vector<double> alias_prob;
+  std::vector<std::uint32_t> alias;
+  double total_weight = 0.;
+
+private:
+  void checkAliasTable() const;
+};
+
+} // end namespace ldm
+
+} // end namespace evgen
+
+#endif
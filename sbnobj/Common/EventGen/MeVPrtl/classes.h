@@ -3,6 +3,8 @@
 #include "sbnobj/Common/EventGen/MeVPrtl/MeVPrtlDecay.h"
 #include "sbnobj/Common/EventGen/MeVPrtl/MeVPrtlFlux.h"
 #include "sbnobj/Common/EventGen/MeVPrtl/MesonParent.h"
+#include "sbnobj/Common/EventGen/MeVPrtl/MeVPrtlCompact.h"
+#include "sbnobj/Common/EventGen/MeVPrtl/MesonParentCache.h"
 #include <vector>
 #include <utility>
 #include "TLorentzVector.h"
@@ -11,7 +11,9 @@
 #include "sbnobj/Common/PMT/Data/PMTconfiguration.h"
 
 // C/C++ standard libraries
+#include <atomic> // std::atomic_load(), std::atomic_store()
 #include <ostream>
+#include <limits>
 #include <cassert>
 
 
@@ -76,4 +78,148 @@ void sbn::PMTconfiguration::dump(std::ostream& out,
 } // sbn::PMTconfiguration::dump()
 
 
+//------------------------------------------------------------------------------
+sbn::V1730channelConfiguration const* sbn::PMTconfiguration::channelConfig
+  (raw::Channel_t channel) const
+{
+  std::uint32_t const entry = channelEntry(channel);
+  return (entry == ChannelIndex::NoEntry)
+    ? nullptr: &(boards[entry >> 16].channels[entry & 0xFFFFU]);
+} // sbn::PMTconfiguration::channelConfig()
+
+
+//------------------------------------------------------------------------------
+sbn::V1730Configuration const* sbn::PMTconfiguration::boardConfig
+  (raw::Channel_t channel) const
+{
+  std::uint32_t const entry = channelEntry(channel);
+  return (entry == ChannelIndex::NoEntry)? nullptr: &(boards[entry >> 16]);
+} // sbn::PMTconfiguration::boardConfig()
+
+
+//------------------------------------------------------------------------------
+sbn::V1730Configuration const* sbn::PMTconfiguration::boardConfigByFragment
+  (unsigned int fragmentID) const
+{
+  std::shared_ptr<BoardIndex const> const index = boardIndex();
+  auto const it = index->byFragment.find(fragmentID);
+  return (it == index->byFragment.end())? nullptr: &(boards[it->second]);
+} // sbn::PMTconfiguration::boardConfigByFragment()
+
+
+//------------------------------------------------------------------------------
+sbn::V1730Configuration const* sbn::PMTconfiguration::boardConfigByName
+  (std::string_view name) const
+{
+  std::shared_ptr<BoardIndex const> const index = boardIndex();
+  auto const it = index->byName.find(name);
+  return (it == index->byName.end())? nullptr: &(boards[it->second]);
+} // sbn::PMTconfiguration::boardConfigByName()
+
+
+//------------------------------------------------------------------------------
+void sbn::PMTconfiguration::resetChannelIndex() {
+  std::atomic_store(&fChannelIndex, std::shared_ptr<ChannelIndex const>{});
+  std::atomic_store(&fBoardIndex, std::shared_ptr<BoardIndex const>{});
+} // sbn::PMTconfiguration::resetChannelIndex()
+
+
+//------------------------------------------------------------------------------
+std::uint32_t sbn::PMTconfiguration::channelEntry(raw::Channel_t channel) const
+{
+  std::shared_ptr<ChannelIndex const> index = std::atomic_load(&fChannelIndex);
+  if (!index) {
+    // concurrent first lookups may each build an index: they are all equal
+    index = makeChannelIndex();
+    std::atomic_store(&fChannelIndex, index);
+  }
+  
+  if (channel < index->firstChannel) return ChannelIndex::NoEntry;
+  std::size_t const i = channel - index->firstChannel;
+  return (i < index->entries.size())? index->entries[i]: ChannelIndex::NoEntry;
+} // sbn::PMTconfiguration::channelEntry()
+
+
+//------------------------------------------------------------------------------
+auto sbn::PMTconfiguration::makeChannelIndex() const
+  -> std::shared_ptr<ChannelIndex const>
+{
+  auto index = std::make_shared<ChannelIndex>();
+  
+  // range of the assigned channel IDs
+  bool hasChannels = false;
+  raw::Channel_t minChannel = 0, maxChannel = 0;
+  for (sbn::V1730Configuration const& board: boards) {
+    for (sbn::V1730channelConfiguration const& channel: board.channels) {
+      if (!channel.hasChannelID()) continue;
+      if (!hasChannels || (channel.channelID < minChannel))
+        minChannel = channel.channelID;
+      if (!hasChannels || (channel.channelID > maxChannel))
+        maxChannel = channel.channelID;
+      hasChannels = true;
+    } // for channels
+  } // for boards
+  if (!hasChannels) return index;
+  
+  index->firstChannel = minChannel;
+  index->entries.assign(maxChannel - minChannel + 1, ChannelIndex::NoEntry);
+  for (std::size_t iBoard = 0; iBoard < boards.size(); ++iBoard) {
+    std::vector<sbn::V1730channelConfiguration> const& channels
+      = boards[iBoard].channels;
+    for (std::size_t iChannel = 0; iChannel < channels.size(); ++iChannel) {
+      if (!channels[iChannel].hasChannelID()) continue;
+      std::uint32_t& entry
+        = index->entries[channels[iChannel].channelID - minChannel];
+      // in case of duplicate channel IDs, the first one is kept
+      if (entry == ChannelIndex::NoEntry)
+        entry = static_cast<std::uint32_t>((iBoard << 16) | iChannel);
+    } // for channels
+  } // for boards
+  
+  return index;
+} // sbn::PMTconfiguration::makeChannelIndex()
+
+
+//------------------------------------------------------------------------------
+auto sbn::PMTconfiguration::boardIndex() const
+  -> std::shared_ptr<BoardIndex const>
+{
+  std::shared_ptr<BoardIndex const> index = std::atomic_load(&fBoardIndex);
+  if (!index) {
+    // concurrent first lookups may each build an index: they are all equal
+    index = makeBoardIndex();
+    std::atomic_store(&fBoardIndex, index);
+  }
+  return index;
+} // sbn::PMTconfiguration::boardIndex()
+
+
+//------------------------------------------------------------------------------
+auto sbn::PMTconfiguration::makeBoardIndex() const
+  -> std::shared_ptr<BoardIndex const>
+{
+  // default value of `V1730Configuration::fragmentID`, meaning "not set"
+  static constexpr unsigned int NoFragmentID
+    = std::numeric_limits<unsigned int>::max();
+  
+  auto index = std::make_shared<BoardIndex>();
+  index->byFragment.reserve(boards.size());
+  index->byName.reserve(boards.size());
+  for (std::size_t iBoard = 0; iBoard < boards.size(); ++iBoard) {
+    sbn::V1730Configuration const& board = boards[iBoard];
+    auto const pos = static_cast<std::uint32_t>(iBoard);
+    // in case of duplicate keys, the first board is kept
+    if (board.fragmentID != NoFragmentID)
+      index->byFragment.emplace(board.fragmentID, pos);
+    if (!board.boardName.empty()
+      && (index->byName.count(board.boardName) == 0)
+    ) {
+      index->byName.emplace(index->names.emplace_back(board.boardName), pos);
+    }
+  } // for boards
+  
+  return index;
+} // sbn::PMTconfiguration::makeBoardIndex()
+
+
 //------------------------------------------------------------------------------
@@ -14,8 +14,13 @@
 
 // C/C++ standard libraries
 #include <iosfwd> // std::ostream
+#include <memory> // std::shared_ptr
+#include <deque>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
+#include <cstdint> // std::uint32_t
 
 
 //------------------------------------------------------------------------------
@@ -53,6 +58,56 @@ struct sbn::PMTconfiguration {
   
   // --- END ---- Data members -------------------------------------------------
   
+  
+  // --- BEGIN -- Channel lookup -----------------------------------------------
+  /**
+   * @brief Returns the configuration of the specified offline `channel`.
+   * @param channel offline channel ID (`V1730channelConfiguration::channelID`)
+   * @return the channel configuration, `nullptr` if `channel` is not present
+   * 
+   * The lookup uses an index from channel ID to board and channel, which is
+   * built on the first call and shared among threads.
+   * If `boards` is modified after a lookup, `resetChannelIndex()` must be
+   * called before the next one.
+   */
+  sbn::V1730channelConfiguration const* channelConfig
+    (raw::Channel_t channel) const;
+  
+  /// Returns the configuration of the board with the `channel` (or `nullptr`).
+  /// @see `channelConfig()`
+  sbn::V1730Configuration const* boardConfig(raw::Channel_t channel) const;
+  
+  /// Discards the lookup indices, which are rebuilt at the next lookup.
+  void resetChannelIndex();
+  
+  // --- END ---- Channel lookup -----------------------------------------------
+  
+  
+  // --- BEGIN -- Board lookup -------------------------------------------------
+  /**
+   * @brief Returns the configuration of the board with the specified fragment.
+   * @param fragmentID DAQ fragment ID (`V1730Configuration::fragmentID`)
+   * @return the board configuration, `nullptr` if `fragmentID` is not present
+   * 
+   * The lookup uses a hash index of the boards by fragment ID and by name,
+   * which is built on the first board lookup and shared among threads, like
+   * the channel index (`channelConfig()`).
+   * If `boards` is modified after a lookup, `resetChannelIndex()` must be
+   * called before the next one.
+   * In case of boards with the same fragment ID, the first one is returned.
+   */
+  sbn::V1730Configuration const* boardConfigByFragment
+    (unsigned int fragmentID) const;
+  
+  /// Returns the configuration of the board with the specified `name`
+  /// (`V1730Configuration::boardName`), `nullptr` if not present.
+  /// @see `boardConfigByFragment()`
+  sbn::V1730Configuration const* boardConfigByName
+    (std::string_view name) const;
+  
+  // --- END ---- Board lookup -------------------------------------------------
+  
+  
 #if __cplusplus < 202004L
   //@{
   /// Comparison: all fields need to have the same values.
@@ -128,6 +183,47 @@ struct sbn::PMTconfiguration {
   
   // -- END ---- Dump facility -------------------------------------------------
   
+  
+    private:
+  
+  /// Direct-mapped index from channel ID to position in `boards`.
+  struct ChannelIndex {
+    static constexpr std::uint32_t NoEntry = 0xFFFFFFFFU;
+    
+    raw::Channel_t firstChannel = 0; ///< Channel ID of `entries[0]`.
+    /// Board (upper 16 bits) and channel (lower 16 bits) of each channel ID.
+    std::vector<std::uint32_t> entries;
+  }; // ChannelIndex
+  
+  /// Channel index (transient), built at the first lookup.
+  mutable std::shared_ptr<ChannelIndex const> fChannelIndex;
+  
+  /// Returns the entry for `channel` in the index, building it if needed.
+  std::uint32_t channelEntry(raw::Channel_t channel) const;
+  
+  /// Returns a new index of the current content.
+  std::shared_ptr<ChannelIndex const> makeChannelIndex() const;
+  
+  
+  /// Hash index from fragment ID and board name to position in `boards`.
+  struct BoardIndex {
+    /// Position of the board of each fragment ID.
+    std::unordered_map<unsigned int, std::uint32_t> byFragment;
+    /// Board names, owned by the index (elements are never relocated).
+    std::deque<std::string> names;
+    /// Position of the board of each name (keys refer to `names`).
+    std::unordered_map<std::string_view, std::uint32_t> byName;
+  }; // BoardIndex
+  
+  /// Board index (transient), built at the first board lookup.
+  mutable std::shared_ptr<BoardIndex const> fBoardIndex;
+  
+  /// Returns the board index, building it if needed.
+  std::shared_ptr<BoardIndex const> boardIndex() const;
+  
+  /// Returns a new board index of the current content.
+  std::shared_ptr<BoardIndex const> makeBoardIndex() const;
+  
 }; // sbn::PMTconfiguration
 
 
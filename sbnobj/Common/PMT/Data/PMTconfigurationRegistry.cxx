@@ -0,0 +1,170 @@
+/**
+ * @file   sbnobj/Common/PMT/Data/PMTconfigurationRegistry.cxx
+ * @brief  Registry of unique PMT readout configurations.
+ * @see    sbnobj/Common/PMT/Data/PMTconfigurationRegistry.h
+ */
+
+
+// library header
+#include "sbnobj/Common/PMT/Data/PMTconfigurationRegistry.h"
+
+// C/C++ standard libraries
+#include <cstring> // std::memcpy()
+#include <string>
+#include <type_traits> // std::is_integral_v
+#include <utility> // std::move()
+
+
+//------------------------------------------------------------------------------
+namespace {
+  
+  /// FNV-1a hash, fed one value at a time.
+  class Hasher {
+    std::uint64_t fHash = 0xcbf29ce484222325ULL; // FNV offset basis
+    
+    void addBytes(unsigned char const* bytes, std::size_t n)
+      {
+        for (std::size_t i = 0; i < n; ++i) {
+          fHash ^= bytes[i];
+          fHash *= 0x100000001b3ULL; // FNV prime
+        }
+      }
+    
+      public:
+    template <typename T>
+    Hasher& operator() (T value)
+      {
+        static_assert(std::is_integral_v<T>);
+        addBytes(reinterpret_cast<unsigned char const*>(&value), sizeof(value));
+        return *this;
+      }
+    
+    Hasher& operator() (float value)
+      {
+        // `+0` and `-0` compare equal, so they need the same hash
+        std::uint32_t bits = 0;
+        if (value != 0.0f) std::memcpy(&bits, &value, sizeof(bits));
+        return (*this)(bits);
+      }
+    
+    Hasher& operator() (std::string const& s)
+      {
+        (*this)(s.size());
+        addBytes(reinterpret_cast<unsigned char const*>(s.data()), s.size());
+        return *this;
+      }
+    
+    std::uint64_t hash() const { return fHash; }
+    
+  }; // Hasher
+  
+  
+  void hashInto(Hasher& hasher, sbn::V1730channelConfiguration const& config)
+  {
+    hasher(config.channelNo)(config.channelID)(config.baseline)
+      (config.threshold)(config.enabled);
+  } // hashInto(V1730channelConfiguration)
+  
+  
+  void hashInto(Hasher& hasher, sbn::V1730Configuration const& config) {
+    hasher(config.boardName)(config.boardID)(config.fragmentID)
+      (config.bufferLength)(config.postTriggerFrac)(config.nChannels)
+      (config.useTimeTagForTimeStamp)(config.channels.size());
+    for (sbn::V1730channelConfiguration const& channel: config.channels)
+      hashInto(hasher, channel);
+  } // hashInto(V1730Configuration)
+  
+  
+  void hashInto(Hasher& hasher, sbn::PMTconfiguration const& config) {
+    hasher(config.boards.size());
+    for (sbn::V1730Configuration const& board: config.boards)
+      hashInto(hasher, board);
+  } // hashInto(PMTconfiguration)
+  
+  
+  template <typename Config>
+  std::uint64_t hashOf(Config const& config)
+    { Hasher hasher; hashInto(hasher, config); return hasher.hash(); }
+  
+} // local namespace
+
+
+//------------------------------------------------------------------------------
+std::uint64_t sbn::contentHash(sbn::V1730channelConfiguration const& config)
+  { return hashOf(config); }
+
+std::uint64_t sbn::contentHash(sbn::V1730Configuration const& config)
+  { return hashOf(config); }
+
+std::uint64_t sbn::contentHash(sbn::PMTconfiguration const& config)
+  { return hashOf(config); }
+
+
+//------------------------------------------------------------------------------
+auto sbn::PMTconfigurationRegistry::add(sbn::PMTconfiguration const& config)
+  -> PMTconfigurationHandle
+{
+  std::uint64_t const hash = contentHash(config);
+  
+  // no copy if the configuration is already known
+  if (PMTconfigurationHandle known = find(config, hash)) return known;
+  
+  return insert(std::make_shared<sbn::PMTconfiguration const>(config), hash);
+} // sbn::PMTconfigurationRegistry::add(PMTconfiguration const&)
+
+
+//------------------------------------------------------------------------------
+auto sbn::PMTconfigurationRegistry::add(sbn::PMTconfiguration&& config)
+  -> PMTconfigurationHandle
+{
+  std::uint64_t const hash = contentHash(config);
+  return insert
+    (std::make_shared<sbn::PMTconfiguration const>(std::move(config)), hash);
+} // sbn::PMTconfigurationRegistry::add(PMTconfiguration&&)
+
+
+//------------------------------------------------------------------------------
+std::size_t sbn::PMTconfigurationRegistry::size() const {
+  std::lock_guard const lock { fMutex };
+  return fConfigs.size();
+} // sbn::PMTconfigurationRegistry::size()
+
+
+//------------------------------------------------------------------------------
+void sbn::PMTconfigurationRegistry::clear() {
+  std::lock_guard const lock { fMutex };
+  fConfigs.clear();
+} // sbn::PMTconfigurationRegistry::clear()
+
+
+//------------------------------------------------------------------------------
+auto sbn::PMTconfigurationRegistry::find
+  (sbn::PMTconfiguration const& config, std::uint64_t hash) const
+  -> PMTconfigurationHandle
+{
+  std::lock_guard const lock { fMutex };
+  auto const [ first, last ] = fConfigs.equal_range(hash);
+  for (auto it = first; it != last; ++it) {
+    // deep comparison only for the (rare) configurations with the same hash
+    if (*(it->second) == config) return { it->second, hash };
+  }
+  return {};
+} // sbn::PMTconfigurationRegistry::find()
+
+
+//------------------------------------------------------------------------------
+auto sbn::PMTconfigurationRegistry::insert
+  (std::shared_ptr<sbn::PMTconfiguration const> config, std::uint64_t hash)
+  -> PMTconfigurationHandle
+{
+  std::lock_guard const lock { fMutex };
+  auto const [ first, last ] = fConfigs.equal_range(hash);
+  for (auto it = first; it != last; ++it)
+    if (*(it->second) == *config) return { it->second, hash };
+  
+  fConfigs.emplace(hash, config);
+  return { std::move(config), hash };
+} // sbn::PMTconfigurationRegistry::insert()
+
+
+//------------------------------------------------------------------------------
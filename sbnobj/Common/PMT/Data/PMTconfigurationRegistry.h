@@ -0,0 +1,154 @@
+/**
+ * @file   sbnobj/Common/PMT/Data/PMTconfigurationRegistry.h
+ * @brief  Registry of unique PMT readout configurations.
+ * @see    sbnobj/Common/PMT/Data/PMTconfigurationRegistry.cxx
+ */
+
+#ifndef SBNOBJ_COMMON_PMT_DATA_PMTCONFIGURATIONREGISTRY_H
+#define SBNOBJ_COMMON_PMT_DATA_PMTCONFIGURATIONREGISTRY_H
+
+// SBN libraries
+#include "sbnobj/Common/PMT/Data/PMTconfiguration.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint64_t
+#include <memory> // std::shared_ptr
+#include <mutex>
+#include <unordered_map>
+
+
+//------------------------------------------------------------------------------
+namespace sbn {
+  
+  class PMTconfigurationHandle;
+  class PMTconfigurationRegistry;
+  
+  //@{
+  /**
+   * @brief Returns a hash of all the content of the configuration.
+   * 
+   * Configurations comparing equal (`operator==`) have the same hash.
+   * The hash is not guaranteed to be stable across software releases, and it
+   * should not be stored.
+   */
+  std::uint64_t contentHash(sbn::V1730channelConfiguration const& config);
+  std::uint64_t contentHash(sbn::V1730Configuration const& config);
+  std::uint64_t contentHash(sbn::PMTconfiguration const& config);
+  //@}
+  
+} // namespace sbn
+
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Shared, immutable reference to a configuration in a registry.
+ * 
+ * Handles from the same `sbn::PMTconfigurationRegistry` point to the same
+ * object if and only if the configurations have the same content, so the
+ * comparison of two handles is as cheap as a pointer comparison.
+ * The configuration stays available as long as a handle to it exists, even
+ * after the registry is cleared or destroyed.
+ */
+class sbn::PMTconfigurationHandle {
+  
+    public:
+  
+  /// An empty handle (`has()` is false).
+  PMTconfigurationHandle() = default;
+  
+  /// Returns whether the handle points to a configuration.
+  bool has() const noexcept { return bool(fConfig); }
+  explicit operator bool() const noexcept { return has(); }
+  
+  /// Returns the configuration. Undefined behaviour if `!has()`.
+  sbn::PMTconfiguration const& operator*() const noexcept { return *fConfig; }
+  sbn::PMTconfiguration const* operator->() const noexcept
+    { return fConfig.get(); }
+  
+  /// Returns a pointer to the configuration (`nullptr` if `!has()`).
+  sbn::PMTconfiguration const* get() const noexcept { return fConfig.get(); }
+  
+  /// Returns the shared pointer to the configuration.
+  std::shared_ptr<sbn::PMTconfiguration const> const& shared() const noexcept
+    { return fConfig; }
+  
+  /// Returns the content hash of the configuration (see `contentHash()`).
+  std::uint64_t hash() const noexcept { return fHash; }
+  
+  //@{
+  /// Compares the content of configurations from the same registry.
+  bool operator== (PMTconfigurationHandle const& other) const noexcept
+    { return fConfig == other.fConfig; }
+  bool operator!= (PMTconfigurationHandle const& other) const noexcept
+    { return fConfig != other.fConfig; }
+  //@}
+  
+    private:
+  friend class sbn::PMTconfigurationRegistry;
+  
+  std::shared_ptr<sbn::PMTconfiguration const> fConfig; ///< Configuration.
+  std::uint64_t fHash = 0U; ///< Content hash of the configuration.
+  
+  PMTconfigurationHandle
+    (std::shared_ptr<sbn::PMTconfiguration const> config, std::uint64_t hash)
+    : fConfig{ std::move(config) }, fHash{ hash }
+    {}
+  
+}; // sbn::PMTconfigurationHandle
+
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Stores one copy of each different PMT configuration.
+ * 
+ * A registry is meant to live for a run (e.g. in the module reading the
+ * configuration, cleared at `beginRun()`): each configuration is added with
+ * `add()`, which walks through it only once, to compute its hash and, if
+ * another configuration has the same hash, to compare the two.
+ * The returned handle then replaces the deep comparison (`operator==`) of the
+ * configurations: configuration changes can be detected by comparing the
+ * handle with the previous one.
+ * 
+ * The registry can be shared among threads.
+ */
+class sbn::PMTconfigurationRegistry {
+  
+    public:
+  
+  /// Returns a handle to the configuration with the content of `config`.
+  PMTconfigurationHandle add(sbn::PMTconfiguration const& config);
+  
+  /// Returns a handle to the configuration with the content of `config`.
+  PMTconfigurationHandle add(sbn::PMTconfiguration&& config);
+  
+  /// Number of different configurations in the registry.
+  std::size_t size() const;
+  
+  /// Removes all the configurations (existing handles are still valid).
+  void clear();
+  
+    private:
+  
+  /// Configurations, by content hash.
+  std::unordered_multimap
+    <std::uint64_t, std::shared_ptr<sbn::PMTconfiguration const>>
+    fConfigs;
+  
+  mutable std::mutex fMutex; ///< Protects `fConfigs`.
+  
+  /// Returns a handle to the configuration equal to `config`, if any.
+  PMTconfigurationHandle find
+    (sbn::PMTconfiguration const& config, std::uint64_t hash) const;
+  
+  /// Adds `config` to the registry, unless an equal one is there already.
+  PMTconfigurationHandle insert(
+    std::shared_ptr<sbn::PMTconfiguration const> config, std::uint64_t hash
+    );
+  
+}; // sbn::PMTconfigurationRegistry
+
+
+//------------------------------------------------------------------------------
+
+#endif // SBNOBJ_COMMON_PMT_DATA_PMTCONFIGURATIONREGISTRY_H
@@ -0,0 +1,112 @@
+/**
+ * @file   sbnobj/Common/PMT/Data/V1730Discriminator.cxx
+ * @brief  Emulation of the channel discrimination of a V1730 readout board.
+ * @date   October 14, 2026
+ * @see    sbnobj/Common/PMT/Data/V1730Discriminator.h
+ */
+
+// library header
+#include "sbnobj/Common/PMT/Data/V1730Discriminator.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::min()
+#include <limits>
+#include <cstdint> // std::uint64_t
+
+
+//------------------------------------------------------------------------------
+namespace {
+  
+  /**
+   * @brief Calls `onCrossing(index)` for each sample crossing `level`.
+   * 
+   * The samples are compared 64 at a time: the comparison with the level
+   * fills a bit mask in a branchless loop the compiler can vectorize, and
+   * the transitions are then extracted from the mask.
+   */
+  template <typename ADCCount, typename OnCrossing>
+  void scanCrossings(
+    ADCCount const* samples, std::size_t nSamples, ADCCount level, bool open,
+    OnCrossing onCrossing
+  ) {
+    using Mask_t = std::uint64_t;
+    constexpr std::size_t BlockSize = std::numeric_limits<Mask_t>::digits;
+    
+    // bit `i` of the mask is set if sample `i` of the block is "open";
+    // a sample is a crossing if its bit differs from the one before it
+    Mask_t previous = open? Mask_t{ 1 }: Mask_t{ 0 };
+    for (std::size_t first = 0; first < nSamples; first += BlockSize) {
+      ADCCount const* block = samples + first;
+      std::size_t const nBlock = std::min(BlockSize, nSamples - first);
+      
+      Mask_t mask = 0;
+      if (nBlock == BlockSize) { // the constant trip count helps vectorization
+        for (std::size_t i = 0; i < BlockSize; ++i)
+          mask |= static_cast<Mask_t>(block[i] <= level) << i;
+      }
+      else {
+        for (std::size_t i = 0; i < nBlock; ++i)
+          mask |= static_cast<Mask_t>(block[i] <= level) << i;
+      }
+      
+      Mask_t changes = mask ^ ((mask << 1) | previous);
+      if (nBlock < BlockSize) changes &= (Mask_t{ 1 } << nBlock) - 1;
+      previous = (mask >> (nBlock - 1)) & Mask_t{ 1 };
+      
+      while (changes) {
+        onCrossing(first + __builtin_ctzll(changes));
+        changes &= changes - 1; // clear the lowest change
+      } // while
+      
+    } // for blocks
+    
+  } // scanCrossings()
+  
+} // local namespace
+
+
+//------------------------------------------------------------------------------
+//--- sbn::V1730Discriminator
+//------------------------------------------------------------------------------
+sbn::V1730Discriminator::V1730Discriminator
+  (sbn::V1730channelConfiguration const& config)
+  : fEnabled(config.enabled && (config.threshold >= 0))
+  , fLevel(fEnabled? static_cast<ADCCount_t>(config.threshold): ADCCount_t{ 0 })
+  {}
+
+
+//------------------------------------------------------------------------------
+std::size_t sbn::V1730Discriminator::discriminate(
+  ADCCount_t const* samples, std::size_t nSamples,
+  std::vector<Interval_t>& intervals
+) const {
+  
+  if (!fEnabled) return 0U;
+  
+  std::size_t const nIntervals = intervals.size();
+  bool open = false;
+  scanCrossings(samples, nSamples, fLevel, false,
+    [&intervals, &open](std::size_t index)
+      {
+        if (open) intervals.back().end = index;
+        else      intervals.push_back({ index, index });
+        open = !open;
+      }
+    );
+  if (open) intervals.back().end = nSamples;
+  
+  return intervals.size() - nIntervals;
+} // sbn::V1730Discriminator::discriminate()
+
+
+//------------------------------------------------------------------------------
+void sbn::V1730Discriminator::findCrossings(
+  ADCCount_t const* samples, std::size_t nSamples, ADCCount_t level,
+  bool open, std::vector<std::size_t>& crossings
+) {
+  scanCrossings(samples, nSamples, level, open,
+    [&crossings](std::size_t index){ crossings.push_back(index); });
+} // sbn::V1730Discriminator::findCrossings()
+
+
+//------------------------------------------------------------------------------
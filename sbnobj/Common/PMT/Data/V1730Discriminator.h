@@ -0,0 +1,128 @@
+/**
+ * @file   sbnobj/Common/PMT/Data/V1730Discriminator.h
+ * @brief  Emulation of the channel discrimination of a V1730 readout board.
+ * @date   October 14, 2026
+ * @see    sbnobj/Common/PMT/Data/V1730Discriminator.cxx
+ */
+
+#ifndef SBNOBJ_COMMON_PMT_DATA_V1730DISCRIMINATOR_H
+#define SBNOBJ_COMMON_PMT_DATA_V1730DISCRIMINATOR_H
+
+// SBN libraries
+#include "sbnobj/Common/PMT/Data/V1730channelConfiguration.h"
+
+// LArSoft libraries
+#include "lardataobj/RawData/OpDetWaveform.h"
+
+// C/C++ standard libraries
+#include <vector>
+#include <cstddef> // std::size_t
+
+
+//------------------------------------------------------------------------------
+namespace sbn { class V1730Discriminator; }
+
+/**
+ * @brief Emulates the threshold discrimination of a V1730 channel.
+ * 
+ * The board discriminates each enabled channel against its absolute
+ * threshold (`V1730channelConfiguration::threshold`, which is `baseline`
+ * minus `relativeThreshold()`): PMT pulses are negative, and the channel is
+ * "over threshold" on all the samples at or below the threshold. A disabled
+ * channel never crosses the threshold.
+ * 
+ * The result of the discrimination of a sequence of samples is the list of
+ * the intervals of samples over threshold, `[ begin, end [`, as indices of
+ * the samples; a pulse still over threshold at the last sample ends with
+ * the samples. These intervals can be added to a gate as they are (e.g.
+ * `icarus::trigger::DiscriminatedGateBuilder::add()`).
+ * 
+ * The samples are compared 64 at a time by a branchless loop the compiler can
+ * vectorize, and only the transitions are then extracted (`findCrossings()`).
+ * 
+ * Example:
+ * @code
+ * sbn::V1730Discriminator const discr { boardConfig.channels[channelNo] };
+ * for (sbn::V1730Discriminator::Interval_t const& pulse
+ *   : discr.discriminate(waveform)
+ * ) {
+ *   // ...
+ * }
+ * @endcode
+ */
+class sbn::V1730Discriminator {
+  
+    public:
+  
+  /// Type of a PMT sample.
+  using ADCCount_t = raw::OpDetWaveform::value_type;
+  
+  /// Interval of samples over threshold: [ `begin`, `end` [.
+  struct Interval_t {
+    std::size_t begin; ///< Index of the first sample over threshold.
+    std::size_t end; ///< Index of the first sample after the interval.
+  }; // Interval_t
+  
+  
+  /// Constructor: discriminates as the channel with configuration `config`.
+  explicit V1730Discriminator(sbn::V1730channelConfiguration const& config);
+  
+  /// Returns whether the discriminator can ever cross its threshold.
+  bool enabled() const { return fEnabled; }
+  
+  /// Returns the threshold: samples up to it are over threshold.
+  ADCCount_t level() const { return fLevel; }
+  
+  
+  /**
+   * @brief Appends to `intervals` the intervals of samples over threshold.
+   * @param samples pointer to the first sample
+   * @param nSamples number of samples
+   * @param[out] intervals the list to add the intervals to
+   * @return the number of intervals added
+   */
+  std::size_t discriminate(
+    ADCCount_t const* samples, std::size_t nSamples,
+    std::vector<Interval_t>& intervals
+    ) const;
+  
+  /// Returns the intervals of samples over threshold of `waveform`.
+  std::vector<Interval_t> discriminate(raw::OpDetWaveform const& waveform) const
+    {
+      std::vector<Interval_t> intervals;
+      discriminate(waveform.data(), waveform.size(), intervals);
+      return intervals;
+    }
+  
+  
+  /**
+   * @brief Finds the samples which cross `level`.
+   * @param samples pointer to the first sample
+   * @param nSamples number of samples
+   * @param level discrimination level: samples up to it are "open"
+   * @param open whether the status before the first sample is "open"
+   * @param[out] crossings where to add the index of each changing sample
+   *
+   * The indices appended to `crossings` are the ones of the samples which
+   * have an open status different from their previous sample; they are
+   * alternatively openings and closings, starting with a closing if `open`
+   * is `true`.
+   */
+  static void findCrossings(
+    ADCCount_t const* samples, std::size_t nSamples, ADCCount_t level,
+    bool open, std::vector<std::size_t>& crossings
+    );
+  
+  
+    private:
+  
+  bool fEnabled; ///< Whether the channel discrimination is active.
+  
+  ADCCount_t fLevel; ///< Discrimination level.
+  
+}; // sbn::V1730Discriminator
+
+
+//------------------------------------------------------------------------------
+
+#endif // SBNOBJ_COMMON_PMT_DATA_V1730DISCRIMINATOR_H
@@ -0,0 +1,179 @@
+#include "sbnobj/Common/POTAccounting/BNBSpillQuality.h"
+
+#include "cetlib_except/exception.h"
+
+#include <algorithm>
+#include <bitset>
+#include <limits>
+
+
+// -----------------------------------------------------------------------------
+namespace {
+
+  template <typename Spill>
+  void addSpill(std::array<std::vector<float>, sbn::BNBSpillQualityTable::NVariables>& columns,
+    Spill const& spill)
+  {
+    using Table = sbn::BNBSpillQualityTable;
+    columns[Table::kTOR860].push_back(spill.TOR860);
+    columns[Table::kTOR875].push_back(spill.TOR875);
+    columns[Table::kLM875A].push_back(spill.LM875A);
+    columns[Table::kLM875B].push_back(spill.LM875B);
+    columns[Table::kLM875C].push_back(spill.LM875C);
+    columns[Table::kHP875].push_back(spill.HP875);
+    columns[Table::kVP875].push_back(spill.VP875);
+    columns[Table::kHPTG1].push_back(spill.HPTG1);
+    columns[Table::kVPTG1].push_back(spill.VPTG1);
+    columns[Table::kHPTG2].push_back(spill.HPTG2);
+    columns[Table::kVPTG2].push_back(spill.VPTG2);
+    columns[Table::kTHCURR].push_back(spill.THCURR);
+  }
+
+  /// Throws `cet::exception` if `variable` is not a beam quality monitor.
+  void checkVariable(sbn::BNBSpillQualityTable::Variable variable)
+  {
+    if (variable < sbn::BNBSpillQualityTable::NVariables) return;
+    throw cet::exception("BNBSpillQualityCuts")
+      << "Invalid beam quality variable #" << variable << ".\n";
+  }
+
+} // local namespace
+
+
+// -----------------------------------------------------------------------------
+sbn::BNBSpillQualityTable::BNBSpillQualityTable(std::vector<BNBSpillInfo> const& spills)
+{
+  reserve(spills.size());
+  for (BNBSpillInfo const& spill: spills) add(spill);
+}
+
+
+sbn::BNBSpillQualityTable::BNBSpillQualityTable(std::vector<BNBSpillSummary> const& spills)
+{
+  reserve(spills.size());
+  for (BNBSpillSummary const& spill: spills) add(spill);
+}
+
+
+char const* sbn::BNBSpillQualityTable::name(Variable variable)
+{
+  static constexpr char const* Names[NVariables] = {
+    "TOR860", "TOR875", "LM875A", "LM875B", "LM875C", "HP875", "VP875",
+    "HPTG1", "VPTG1", "HPTG2", "VPTG2", "THCURR"
+  };
+  return (variable < NVariables)? Names[variable]: "";
+}
+
+
+void sbn::BNBSpillQualityTable::reserve(std::size_t nSpills)
+{
+  for (std::vector<float>& column: fColumns) column.reserve(nSpills);
+}
+
+
+void sbn::BNBSpillQualityTable::add(BNBSpillInfo const& spill)
+{
+  addSpill(fColumns, spill);
+}
+
+
+void sbn::BNBSpillQualityTable::add(BNBSpillSummary const& spill)
+{
+  addSpill(fColumns, spill);
+}
+
+
+// -----------------------------------------------------------------------------
+sbn::BNBSpillQualityCuts::BNBSpillQualityCuts()
+{
+  fMin.fill(-std::numeric_limits<float>::infinity());
+  fMax.fill(std::numeric_limits<float>::infinity());
+  fHasCut.fill(false);
+}
+
+
+auto sbn::BNBSpillQualityCuts::setRange(Variable variable, float min, float max)
+  -> BNBSpillQualityCuts&
+{
+  checkVariable(variable);
+  if (!(min <= max)) {
+    throw cet::exception("BNBSpillQualityCuts")
+      << "Invalid range [ " << min << " ; " << max << " ] for "
+      << BNBSpillQualityTable::name(variable) << ".\n";
+  }
+  fMin[variable] = min;
+  fMax[variable] = max;
+  fHasCut[variable] = true;
+  return *this;
+}
+
+
+auto sbn::BNBSpillQualityCuts::setMin(Variable variable, float min)
+  -> BNBSpillQualityCuts&
+{
+  return setRange(variable, min, std::numeric_limits<float>::infinity());
+}
+
+
+auto sbn::BNBSpillQualityCuts::setMax(Variable variable, float max)
+  -> BNBSpillQualityCuts&
+{
+  return setRange(variable, -std::numeric_limits<float>::infinity(), max);
+}
+
+
+auto sbn::BNBSpillQualityCuts::removeCut(Variable variable)
+  -> BNBSpillQualityCuts&
+{
+  checkVariable(variable);
+  fMin[variable] = -std::numeric_limits<float>::infinity();
+  fMax[variable] = std::numeric_limits<float>::infinity();
+  fHasCut[variable] = false;
+  return *this;
+}
+
+
+// -----------------------------------------------------------------------------
+sbn::BNBSpillQualityResult sbn::evaluateBNBSpillQuality
+  (BNBSpillQualityTable const& table, BNBSpillQualityCuts const& cuts)
+{
+  constexpr std::size_t BlockSize = 64;
+  using Table = BNBSpillQualityTable;
+
+  std::size_t const n = table.size();
+  BNBSpillQualityResult result;
+  result.nSpills = n;
+  result.goodMask.assign((n + BlockSize - 1) / BlockSize, 0);
+
+  std::vector<Table::Variable> cutVariables;
+  for (unsigned v = 0; v < Table::NVariables; ++v)
+    if (cuts.hasCut(Table::Variable(v))) cutVariables.push_back(Table::Variable(v));
+
+  float const* pot = table.column(Table::kTOR875).data();
+  for (std::size_t first = 0; first < n; first += BlockSize) {
+    std::size_t const size = std::min(BlockSize, n - first);
+
+    // one flag per spill of the block, and-ed over all the cuts
+    unsigned char good[BlockSize];
+    std::fill(good, good + BlockSize, 1);
+    for (Table::Variable variable: cutVariables) {
+      float const* values = table.column(variable).data() + first;
+      float const min = cuts.min(variable);
+      float const max = cuts.max(variable);
+      for (std::size_t i = 0; i < size; ++i)
+        good[i] &= (values[i] >= min) & (values[i] <= max);
+    }
+
+    std::uint64_t mask = 0;
+    double blockPOT = 0.;
+    for (std::size_t i = 0; i < size; ++i) {
+      mask |= std::uint64_t(good[i]) << i;
+      blockPOT += good[i]? pot[first + i]: 0.f;
+    }
+    result.goodMask[first / BlockSize] = mask;
+    result.nGood += std::bitset<BlockSize>(mask).count();
+    result.goodPOT += blockPOT;
+  }
+
+  return result;
+}
@@ -0,0 +1,142 @@
+#ifndef sbncode_BNBSpillQuality_H
+#define sbncode_BNBSpillQuality_H
+
+/**
+
+ * @file sbnobj/Common/POTAccounting/BNBSpillQuality.h
+ * @brief Beam quality monitors of many BNB spills, and cuts on them.
+ */
+
+#include "sbnobj/Common/POTAccounting/BNBSpillInfo.h"
+#include "sbnobj/Common/POTAccounting/BNBSpillSummary.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace sbn {
+
+  /**
+   * The beam quality monitors of many BNB spills, one column per monitor.
+   *
+   * Each column is a contiguous array of the values of one monitor for all
+   * the spills, in the order they were added, so that a cut on a monitor is
+   * evaluated on all the spills in a tight loop. See `BNBSpillInfo` for the
+   * meaning and units of the monitors.
+   */
+  class BNBSpillQualityTable {
+  public:
+
+    /// Beam quality monitors, one column each.
+    enum Variable: unsigned {
+      kTOR860,
+      kTOR875,
+      kLM875A,
+      kLM875B,
+      kLM875C,
+      kHP875,
+      kVP875,
+      kHPTG1,
+      kVPTG1,
+      kHPTG2,
+      kVPTG2,
+      kTHCURR,
+      NVariables
+    };
+
+    BNBSpillQualityTable() = default;
+    explicit BNBSpillQualityTable(std::vector<BNBSpillInfo> const& spills);
+    explicit BNBSpillQualityTable(std::vector<BNBSpillSummary> const& spills);
+
+    /// Name of the `variable`, as the `BNBSpillInfo` data member.
+    static char const* name(Variable variable);
+
+    void reserve(std::size_t nSpills);
+
+    void add(BNBSpillInfo const& spill);
+    void add(BNBSpillSummary const& spill);
+
+    std::size_t size() const { return fColumns[kTOR875].size(); }
+    bool empty() const { return fColumns[kTOR875].empty(); }
+
+    float value(Variable variable, std::size_t spill) const { return fColumns[variable][spill]; }
+    std::vector<float> const& column(Variable variable) const { return fColumns[variable]; }
+
+    /// POT of spill `spill` (as `BNBSpillInfo::POT()`).
+    double POT(std::size_t spill) const { return fColumns[kTOR875][spill]; }
+
+  private:
+    std::array<std::vector<float>, NVariables> fColumns; ///< Values, by monitor.
+
+  };
+
+
+  /**
+   * An allowed range for each of the beam quality monitors of a BNB spill.
+   *
+   * A spill passes the cuts if the value of each monitor is within
+   * [ `min`, `max` ]. Monitors with no cut (the default) are not checked at
+   * all; a monitor with a cut fails it if its value is NaN.
+   */
+  class BNBSpillQualityCuts {
+  public:
+
+    using Variable = BNBSpillQualityTable::Variable;
+
+    BNBSpillQualityCuts();
+
+    /// Requires `variable` to be within [ `min`, `max` ].
+    BNBSpillQualityCuts& setRange(Variable variable, float min, float max);
+
+    /// Requires `variable` to be at least `min`.
+    BNBSpillQualityCuts& setMin(Variable variable, float min);
+
+    /// Requires `variable` to be at most `max`.
+    BNBSpillQualityCuts& setMax(Variable variable, float max);
+
+    /// Removes the cut on `variable`.
+    BNBSpillQualityCuts& removeCut(Variable variable);
+
+    bool hasCut(Variable variable) const { return fHasCut[variable]; }
+    float min(Variable variable) const { return fMin[variable]; }
+    float max(Variable variable) const { return fMax[variable]; }
+
+  private:
+    std::array<float, BNBSpillQualityTable::NVariables> fMin;
+    std::array<float, BNBSpillQualityTable::NVariables> fMax;
+    std::array<bool, BNBSpillQualityTable::NVariables> fHasCut;
+
+  };
+
+
+  /// Spills of a `BNBSpillQualityTable` passing the cuts, and their POT.
+  class BNBSpillQualityResult {
+  public:
+
+    /// Bit `i % 64` of word `i / 64` is set if spill `i` passed the cuts.
+    std::vector<std::uint64_t> goodMask;
+
+    std::size_t nSpills = 0; ///< Number of spills evaluated.
+    std::size_t nGood = 0; ///< Number of spills passing the cuts.
+    double goodPOT = 0.; ///< Total POT of the spills passing the cuts.
+
+    bool isGood(std::size_t spill) const
+      { return (goodMask[spill / 64] >> (spill % 64)) & 1U; }
+
+  };
+
+
+  /**
+   * Evaluates the `cuts` on all the spills of `table`.
+   *
+   * The spills are evaluated in blocks of 64: each cut is applied to a whole
+   * block before the next one, with no branch, so that the compiler can
+   * vectorize the loops.
+   */
+  BNBSpillQualityResult evaluateBNBSpillQuality
+    (BNBSpillQualityTable const& table, BNBSpillQualityCuts const& cuts);
+
+} // end namespace sbn
+
+#endif
@@ -0,0 +1,104 @@
+#include "sbnobj/Common/POTAccounting/BNBSpillSummary.h"
+
+#include <algorithm>
+#include <utility>
+
+
+sbn::BNBSpillSummary sbn::makeBNBSpillSummary(BNBSpillInfo const& info)
+{
+  BNBSpillSummary summary;
+  summary.spill_time_s = info.spill_time_s;
+  summary.spill_time_ns = info.spill_time_ns;
+  summary.event = info.event;
+  summary.TOR860 = info.TOR860;
+  summary.TOR875 = info.TOR875;
+  summary.LM875A = info.LM875A;
+  summary.LM875B = info.LM875B;
+  summary.LM875C = info.LM875C;
+  summary.HP875 = info.HP875;
+  summary.VP875 = info.VP875;
+  summary.HPTG1 = info.HPTG1;
+  summary.VPTG1 = info.VPTG1;
+  summary.HPTG2 = info.HPTG2;
+  summary.VPTG2 = info.VPTG2;
+  summary.BTJT2 = info.BTJT2;
+  summary.THCURR = info.THCURR;
+  return summary;
+}
+
+
+sbn::BNBMultiwireInfo sbn::makeBNBMultiwireInfo
+  (BNBSpillInfo const& info, std::size_t spill)
+{
+  BNBMultiwireInfo multiwire;
+  multiwire.spill = spill;
+  multiwire.M875BB = info.M875BB;
+  multiwire.M876BB = info.M876BB;
+  multiwire.MMBTBB = info.MMBTBB;
+  multiwire.M875BB_spill_time_diff = info.M875BB_spill_time_diff;
+  multiwire.M876BB_spill_time_diff = info.M876BB_spill_time_diff;
+  multiwire.MMBTBB_spill_time_diff = info.MMBTBB_spill_time_diff;
+  return multiwire;
+}
+
+
+void sbn::splitBNBSpillInfo(std::vector<BNBSpillInfo> const& spills,
+  std::vector<BNBSpillSummary>& summaries,
+  std::vector<BNBMultiwireInfo>& multiwires)
+{
+  summaries.clear();
+  multiwires.clear();
+  summaries.reserve(spills.size());
+  for (std::size_t i = 0; i < spills.size(); ++i) {
+    summaries.push_back(makeBNBSpillSummary(spills[i]));
+    BNBMultiwireInfo multiwire = makeBNBMultiwireInfo(spills[i], i);
+    if (!multiwire.empty()) multiwires.push_back(std::move(multiwire));
+  }
+}
+
+
+sbn::BNBSpillInfo sbn::makeBNBSpillInfo
+  (BNBSpillSummary const& summary, BNBMultiwireInfo const* multiwire)
+{
+  BNBSpillInfo info;
+  info.spill_time_s = summary.spill_time_s;
+  info.spill_time_ns = summary.spill_time_ns;
+  info.event = summary.event;
+  info.TOR860 = summary.TOR860;
+  info.TOR875 = summary.TOR875;
+  info.LM875A = summary.LM875A;
+  info.LM875B = summary.LM875B;
+  info.LM875C = summary.LM875C;
+  info.HP875 = summary.HP875;
+  info.VP875 = summary.VP875;
+  info.HPTG1 = summary.HPTG1;
+  info.VPTG1 = summary.VPTG1;
+  info.HPTG2 = summary.HPTG2;
+  info.VPTG2 = summary.VPTG2;
+  info.BTJT2 = summary.BTJT2;
+  info.THCURR = summary.THCURR;
+  if (multiwire) {
+    info.M875BB = multiwire->M875BB;
+    info.M876BB = multiwire->M876BB;
+    info.MMBTBB = multiwire->MMBTBB;
+    info.M875BB_spill_time_diff = multiwire->M875BB_spill_time_diff;
+    info.M876BB_spill_time_diff = multiwire->M876BB_spill_time_diff;
+    info.MMBTBB_spill_time_diff = multiwire->MMBTBB_spill_time_diff;
+  }
+  else {
+    info.M875BB_spill_time_diff = 0;
+    info.M876BB_spill_time_diff = 0;
+    info.MMBTBB_spill_time_diff = 0;
+  }
+  return info;
+}
+
+
+sbn::BNBMultiwireInfo const* sbn::findBNBMultiwireInfo
+  (std::vector<BNBMultiwireInfo> const& multiwires, std::size_t spill)
+{
+  auto const it = std::lower_bound(multiwires.begin(), multiwires.end(), spill,
+    [](BNBMultiwireInfo const& multiwire, std::size_t spill)
+      { return multiwire.spill < spill; });
+  return ((it == multiwires.end()) || (it->spill != spill))? nullptr: &*it;
+}
@@ -0,0 +1,111 @@
+#ifndef sbncode_BNBSpillSummary_H
+#define sbncode_BNBSpillSummary_H
+
+/**
+
+ * @file sbnobj/Common/POTAccounting/BNBSpillSummary.h
+ * @brief `BNBSpillInfo` split into a fixed size record and multiwire data.
+ */
+
+#include "sbnobj/Common/POTAccounting/BNBSpillInfo.h"
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace sbn {
+
+  /**
+   * All the `BNBSpillInfo` content except the multiwire data.
+   *
+   * The record has a fixed size, so that a collection of them is a single
+   * contiguous block: POT-only consumers read this collection, and the
+   * multiwire data, if needed, from a separate `BNBMultiwireInfo` collection.
+   * See `BNBSpillInfo` for the meaning of each data member.
+   */
+  class BNBSpillSummary {
+  public:
+
+    unsigned long int spill_time_s = 0; //!< The IFDB Beam Spill Time, unit sec
+    unsigned long int spill_time_ns = 0; //!< The IFDB Beam Spill Time, unit nsec
+
+    unsigned int event = 0;
+
+    float TOR860 = 0; //!< Toroid before Mag 875, units e12 Protons
+    float TOR875 = 0; //!< Toroid after Mag 875, units e12 Protons
+
+    float LM875A = 0; //!< Loss Monitor before the RWM, unit R/s
+    float LM875B = 0; //!< Loss Monitor after the RWM, unit R/s
+    float LM875C = 0; //!< Loss Monitor after the RWM, unit R/s
+    float HP875 = 0; //!< Horizontal Position Monitor after Mag 875, units mm
+    float VP875 = 0; //!< Verticle Position Monitor after Mag 875, units mm
+
+    float HPTG1 = 0; //!< Horizontal Position Monitor at Target Station 1, units mm
+    float VPTG1 = 0; //!< Horizontal Position Monitor at Target Station 1, units mm
+
+    float HPTG2 = 0; //!< Horizontal Position Monitor at Target Station 2, closest to target, units mm
+    float VPTG2 = 0; //!< Horizontal Position Monitor at Target Station 2, closest to target, units mm
+
+    float BTJT2 = 0; //!< Temperature of air exiting target, units Deg C
+
+    float THCURR = 0; //!< Current applied to Horn, units kiloAmperes
+
+    double POT() const{return TOR875;}
+
+  };
+
+  /**
+   * Multiwire data of the BNB spill number `spill` of a `BNBSpillSummary`
+   * collection.
+   *
+   * Spills without multiwire data may have no entry; entries are sorted by
+   * `spill`.
+   */
+  class BNBMultiwireInfo {
+  public:
+
+    std::size_t spill = 0; //!< Index of the spill in the `BNBSpillSummary` collection
+
+    std::vector< int > M875BB; //!< Multiwire station before Mag 875...?
+    std::vector< int > M876BB; //!< Multiwire station after Mag 875...?
+    std::vector< int > MMBTBB; //!< Multiwire station at the target station,
+
+    float M875BB_spill_time_diff = 0; //!< the time difference between M875BB and the matched spill
+    float M876BB_spill_time_diff = 0; //!< the time difference between M876BB and the matched spill
+    float MMBTBB_spill_time_diff = 0; //!< the time difference between MMBTBB and the matched spill
+
+    /// Whether there are data from any of the multiwire stations.
+    bool empty() const { return M875BB.empty() && M876BB.empty() && MMBTBB.empty(); }
+
+  };
+
+  /// Returns the content of `info` without the multiwire data.
+  BNBSpillSummary makeBNBSpillSummary(BNBSpillInfo const& info);
+
+  /// Returns the multiwire data of `info`, assigned to the spill number `spill`.
+  BNBMultiwireInfo makeBNBMultiwireInfo(BNBSpillInfo const& info, std::size_t spill);
+
+  /**
+   * Splits the `spills` into fixed size records and multiwire data.
+   *
+   * @param spills the full spill information
+   * @param[out] summaries one record per spill (replaced)
+   * @param[out] multiwires multiwire data of the spills having any (replaced)
+   */
+  void splitBNBSpillInfo(std::vector<BNBSpillInfo> const& spills,
+    std::vector<BNBSpillSummary>& summaries,
+    std::vector<BNBMultiwireInfo>& multiwires);
+
+  /// Reassembles a `BNBSpillInfo` (`multiwire` may be `nullptr`).
+  BNBSpillInfo makeBNBSpillInfo
+    (BNBSpillSummary const& summary, BNBMultiwireInfo const* multiwire = nullptr);
+
+  /// Returns the multiwire data of spill number `spill`, `nullptr` if none.
+  BNBMultiwireInfo const* findBNBMultiwireInfo
+    (std::vector<BNBMultiwireInfo> const& multiwires, std::size_t spill);
+
+  static_assert(std::is_trivially_copyable_v<BNBSpillSummary>);
+
+} // end namespace sbn
+
+#endif
@@ -0,0 +1,65 @@
+#include "sbnobj/Common/POTAccounting/ExposureSummary.h"
+
+#include <algorithm>
+
+namespace {
+
+  std::uint64_t spillTime(unsigned long int s, unsigned long int ns)
+    { return static_cast<std::uint64_t>(s) * 1000000000ULL + ns; }
+
+} // local namespace
+
+
+void sbn::ExposureSummary::SourceExposure::addSpill(std::uint64_t time, double pot)
+{
+  POT += pot;
+  ++nSpills;
+  firstTime = std::min(firstTime, time);
+  lastTime = std::max(lastTime, time);
+}
+
+
+void sbn::ExposureSummary::SourceExposure::addEXT(double gates)
+{
+  EXTGates += gates;
+  ++nEXTCounts;
+}
+
+
+void sbn::ExposureSummary::SourceExposure::merge(SourceExposure const& other)
+{
+  POT += other.POT;
+  nSpills += other.nSpills;
+  EXTGates += other.EXTGates;
+  nEXTCounts += other.nEXTCounts;
+  firstTime = std::min(firstTime, other.firstTime);
+  lastTime = std::max(lastTime, other.lastTime);
+}
+
+
+void sbn::ExposureSummary::addSpill(BNBSpillInfo const& spill)
+{
+  addSpill(sbn::triggerSource::BNB,
+    spillTime(spill.spill_time_s, spill.spill_time_ns), spill.POT());
+}
+
+
+void sbn::ExposureSummary::addSpill(NuMISpillInfo const& spill)
+{
+  addSpill(sbn::triggerSource::NuMI,
+    spillTime(spill.spill_time_s, spill.spill_time_ns), spill.POT());
+}
+
+
+void sbn::ExposureSummary::merge(ExposureSummary const& other)
+{
+  for (std::size_t s = 0; s < NSources; ++s) fSources[s].merge(other.fSources[s]);
+}
+
+
+auto sbn::ExposureSummary::total() const -> SourceExposure
+{
+  SourceExposure sum;
+  for (SourceExposure const& source: fSources) sum.merge(source);
+  return sum;
+}
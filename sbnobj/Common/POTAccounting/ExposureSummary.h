@@ -0,0 +1,100 @@
+#ifndef sbncode_ExposureSummary_H
+#define sbncode_ExposureSummary_H
+
+/**
+
+ * @file sbnobj/Common/POTAccounting/ExposureSummary.h
+ * @brief Exposure (POT, spills, EXT gates) of a subrun, by trigger source.
+ */
+
+#include "sbnobj/Common/POTAccounting/BNBSpillInfo.h"
+#include "sbnobj/Common/POTAccounting/NuMISpillInfo.h"
+#include "sbnobj/Common/POTAccounting/EXTCountInfo.h"
+#include "sbnobj/Common/Trigger/BeamBits.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace sbn {
+
+  /**
+   * Exposure totals of a subrun, one set per trigger source.
+   *
+   * A producer fills it from the `BNBSpillInfo`, `NuMISpillInfo` and
+   * `EXTCountInfo` of the subrun; an exposure calculation then reads only
+   * this object per subrun.
+   *
+   * Summaries are combined with `merge()` (or `+=`), which is associative
+   * and commutative: sums are added and time ranges joined, so partial
+   * summaries can be merged in any order (map-reduce).
+   */
+  class ExposureSummary {
+  public:
+
+    /// Special timestamp value indicating the absence of timestamp.
+    static constexpr std::uint64_t NoTimestamp = std::numeric_limits<std::uint64_t>::max();
+
+    /// Number of trigger sources (`sbn::triggerSource` values).
+    static constexpr std::size_t NSources = sbn::bits::value(sbn::triggerSource::NBits);
+
+    /// Totals from a single trigger source.
+    class SourceExposure {
+    public:
+      double POT = 0.0; //!< Total POT of the spills
+      unsigned long int nSpills = 0; //!< Number of spills
+      double EXTGates = 0.0; //!< Total EXT gates (`EXTCountInfo::gates_since_last_trigger`)
+      unsigned long int nEXTCounts = 0; //!< Number of `EXTCountInfo` records
+      std::uint64_t firstTime = NoTimestamp; //!< Earliest spill [ns]
+      std::uint64_t lastTime = 0; //!< Latest spill [ns]
+
+      /// Whether a spill time was recorded (`firstTime` and `lastTime` valid).
+      bool hasTimes() const { return firstTime != NoTimestamp; }
+
+      void addSpill(std::uint64_t time, double pot);
+      void addEXT(double gates);
+      void merge(SourceExposure const& other);
+    };
+
+    /// Adds a spill from `source` at `time` [ns] with `pot`.
+    void addSpill(sbn::triggerSource source, std::uint64_t time, double pot)
+      { sourceExposure(source).addSpill(time, pot); }
+
+    /// Adds a BNB spill.
+    void addSpill(BNBSpillInfo const& spill);
+
+    /// Adds a NuMI spill.
+    void addSpill(NuMISpillInfo const& spill);
+
+    /// Adds the gates of an EXT count from `source` (e.g. `OffbeamBNB`).
+    void addEXT(sbn::triggerSource source, EXTCountInfo const& count)
+      { sourceExposure(source).addEXT(count.gates_since_last_trigger); }
+
+    /// Adds all the totals from `other`.
+    void merge(ExposureSummary const& other);
+    ExposureSummary& operator+= (ExposureSummary const& other)
+      { merge(other); return *this; }
+
+    /// Totals from `source`.
+    SourceExposure const& exposure(sbn::triggerSource source) const
+      { return fSources.at(sbn::bits::value(source)); }
+
+    /// Totals from all sources.
+    SourceExposure total() const;
+
+  private:
+
+    std::array<SourceExposure, NSources> fSources; //!< Totals by trigger source
+
+    SourceExposure& sourceExposure(sbn::triggerSource source)
+      { return fSources.at(sbn::bits::value(source)); }
+
+  };
+
+  inline ExposureSummary operator+ (ExposureSummary a, ExposureSummary const& b)
+    { return a += b; }
+
+} // end namespace sbn
+
+#endif
@@ -5,20 +5,60 @@
   NuMI spill information for POT accounting work (work in progress)
 */
 
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
 namespace sbn {
   class NuMISpillInfo {
   public:
-    // In all lists -- the first is the average of a couple bunches,
-    // then the last 6 are the elements per-bunch
-    std::vector< double > HP121; //!< List of Horizontal position at start per-bunch
-    std::vector< double > VP121; //!< List of Vertical position at start per-bunch
-    std::vector< double > HPTGT; //!< List of Horizontal position at target per-bunch
-    std::vector< double > VPTGT; //!< List of Vertical position at target per-bunch
-    std::vector< double > HITGT; //!< List of Horizontal-Monitor intensity at target per-bunch
-    std::vector< double > VITGT;  //!< List of Vertical-Monitor intensity at tartget per bunch
-    std::vector< double > MTGTDS; //MULTIWIRES
+
+    /// Per-bunch monitors, stored together in `bunchData`.
+    enum BunchMonitor: unsigned int {
+      kHP121, //!< Horizontal position at start per-bunch
+      kVP121, //!< Vertical position at start per-bunch
+      kHPTGT, //!< Horizontal position at target per-bunch
+      kVPTGT, //!< Vertical position at target per-bunch
+      kHITGT, //!< Horizontal-Monitor intensity at target per-bunch
+      kVITGT, //!< Vertical-Monitor intensity at tartget per bunch
+      NBunchMonitors
+    };
+
+    /// Entries of each per-bunch monitor: the first is the average of a
+    /// couple bunches, then the last 6 are the elements per-bunch.
+    static constexpr std::size_t NBunchEntries = 7;
+
+    /**
+     * Values of a per-bunch monitor.
+     *
+     * Up to class version 13 the monitors were the `std::vector<double>` data
+     * members `HP121`, `VP121`, `HPTGT`, `VPTGT`, `HITGT` and `VITGT`: code
+     * reading e.g. `info.HP121` needs to change into `info.HP121()`, which
+     * supports iteration, `size()` and indexing, and converts to a
+     * `std::vector<double>` for code that needs one.
+     */
+    struct BunchValues {
+      float const* first = nullptr;
+      std::size_t n = 0;
+
+      float const* begin() const { return first; }
+      float const* end() const { return first + n; }
+      std::size_t size() const { return n; }
+      bool empty() const { return n == 0; }
+      float operator[] (std::size_t i) const { return first[i]; }
+      operator std::vector< double >() const { return { begin(), end() }; }
+    };
+
+    /// Values of monitor `m` start at `bunchData[m * NBunchEntries]`.
+    float bunchData[NBunchMonitors * NBunchEntries] = {};
+    /// Values of each monitor in the source; if larger than `NBunchEntries`
+    /// the monitor was truncated, see `isTruncated()`.
+    unsigned char nBunchEntries[NBunchMonitors] = {};
+
+    std::vector< float > MTGTDS; //MULTIWIRES
     float HRNDIR; // horn polarity (based on sign)
     float NSLINA; // horn current /4 
     float NSLINB; // horn current /4  
@@ -37,6 +77,50 @@ namespace sbn {
     unsigned int daq_gates;
 
     double POT() const{return TRTGTD;}
+
+    /// Values of the per-bunch monitor `m`.
+    BunchValues monitor(BunchMonitor m) const
+      {
+        return { bunchData + m * NBunchEntries,
+          std::min<std::size_t>(nBunchEntries[m], NBunchEntries) };
+      }
+
+    /// Whether the source of monitor `m` had more than `NBunchEntries` values
+    /// (only possible for data converted from class version 13 or earlier).
+    bool isTruncated(BunchMonitor m) const
+      { return nBunchEntries[m] > NBunchEntries; }
+
+    BunchValues HP121() const { return monitor(kHP121); }
+    BunchValues VP121() const { return monitor(kVP121); }
+    BunchValues HPTGT() const { return monitor(kHPTGT); }
+    BunchValues VPTGT() const { return monitor(kVPTGT); }
+    BunchValues HITGT() const { return monitor(kHITGT); }
+    BunchValues VITGT() const { return monitor(kVITGT); }
+
+    /// Sets the values of monitor `m`.
+    /// @throw std::length_error if there are more than `NBunchEntries` values
+    void setMonitor(BunchMonitor m, std::vector< double > const& values)
+      {
+        if (values.size() > NBunchEntries) {
+          throw std::length_error("sbn::NuMISpillInfo::setMonitor(): "
+            + std::to_string(values.size()) + " values for monitor #"
+            + std::to_string(m) + ", only " + std::to_string(NBunchEntries)
+            + " supported");
+        }
+        fillMonitor(bunchData, nBunchEntries, m, values);
+      }
+
+    /// Implementation of `setMonitor()`, also used to read older versions:
+    /// values past `NBunchEntries` are dropped, and flagged in `counts`.
+    static void fillMonitor(float* data, unsigned char* counts,
+      BunchMonitor m, std::vector< double > const& values)
+      {
+        std::size_t const n = std::min(values.size(), NBunchEntries);
+        std::copy(values.begin(), values.begin() + n, data + m * NBunchEntries);
+        std::fill(data + m * NBunchEntries + n, data + (m + 1) * NBunchEntries, 0.0f);
+        counts[m] = static_cast<unsigned char>(std::min<std::size_t>
+          (values.size(), std::numeric_limits<unsigned char>::max()));
+      }
   };
 }
 
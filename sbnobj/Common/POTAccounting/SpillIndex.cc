@@ -0,0 +1,116 @@
+#include "sbnobj/Common/POTAccounting/SpillIndex.h"
+
+#include "cetlib_except/exception.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace {
+
+  template <typename Spills>
+  void addAll(sbn::SpillIndex& index, Spills const& spills)
+  {
+    index.reserve(spills.size());
+    for (auto const& spill: spills) index.add(spill);
+    index.finalize();
+  }
+
+} // local namespace
+
+
+sbn::SpillIndex::SpillIndex(std::vector<BNBSpillInfo> const& spills)
+  { addAll(*this, spills); }
+
+sbn::SpillIndex::SpillIndex(std::vector<NuMISpillInfo> const& spills)
+  { addAll(*this, spills); }
+
+
+void sbn::SpillIndex::reserve(std::size_t nSpills)
+{
+  fTimes.reserve(nSpills);
+  fPOT.reserve(nSpills);
+}
+
+
+void sbn::SpillIndex::add(std::uint64_t time, double pot)
+{
+  fTimes.push_back(time);
+  fPOT.push_back(pot);
+  fFinalized = false;
+}
+
+
+void sbn::SpillIndex::finalize()
+{
+  // spills are usually added in time order already
+  if (!std::is_sorted(fTimes.begin(), fTimes.end())) {
+    std::vector<std::size_t> order(fTimes.size());
+    std::iota(order.begin(), order.end(), 0U);
+    std::stable_sort(order.begin(), order.end(),
+      [this](std::size_t a, std::size_t b){ return fTimes[a] < fTimes[b]; });
+
+    std::vector<std::uint64_t> times;
+    std::vector<double> pot;
+    times.reserve(order.size());
+    pot.reserve(order.size());
+    for (std::size_t i: order) {
+      times.push_back(fTimes[i]);
+      pot.push_back(fPOT[i]);
+    }
+    fTimes = std::move(times);
+    fPOT = std::move(pot);
+  }
+
+  fCumulativePOT.resize(fPOT.size() + 1);
+  fCumulativePOT[0] = 0.0;
+  std::partial_sum(fPOT.begin(), fPOT.end(), fCumulativePOT.begin() + 1);
+  fFinalized = true;
+}
+
+
+auto sbn::SpillIndex::window(std::uint64_t start, std::uint64_t stop) const
+  -> Range_t
+{
+  requireFinalized("window");
+  if (stop <= start) return { 0, 0 };
+  auto const first = std::lower_bound(fTimes.begin(), fTimes.end(), start);
+  auto const last = std::lower_bound(first, fTimes.end(), stop);
+  return {
+    static_cast<std::size_t>(first - fTimes.begin()),
+    static_cast<std::size_t>(last - fTimes.begin())
+    };
+}
+
+
+double sbn::SpillIndex::POT(Range_t range) const
+{
+  requireFinalized("POT");
+  if (range.second <= range.first) return 0.0;
+  return fCumulativePOT[range.second] - fCumulativePOT[range.first];
+}
+
+
+double sbn::SpillIndex::totalPOT() const
+{
+  requireFinalized("totalPOT");
+  return fCumulativePOT.back();
+}
+
+
+std::size_t sbn::SpillIndex::closest(std::uint64_t time) const
+{
+  requireFinalized("closest");
+  auto const after = std::lower_bound(fTimes.begin(), fTimes.end(), time);
+  if (after == fTimes.begin()) return fTimes.empty()? size(): 0;
+  if (after == fTimes.end()) return size() - 1;
+  std::size_t const i = after - fTimes.begin();
+  return (*after - time < time - fTimes[i - 1])? i: i - 1;
+}
+
+
+void sbn::SpillIndex::requireFinalized(char const* caller) const
+{
+  if (fFinalized) return;
+  throw cet::exception("SpillIndex")
+    << "sbn::SpillIndex::" << caller << "(): index not finalized\n";
+}
@@ -0,0 +1,102 @@
+#ifndef sbncode_SpillIndex_H
+#define sbncode_SpillIndex_H
+
+/**
+
+ * @file sbnobj/Common/POTAccounting/SpillIndex.h
+ * @brief Time-sorted index of the spills of a subrun, for POT accounting.
+ */
+
+#include "sbnobj/Common/POTAccounting/BNBSpillInfo.h"
+#include "sbnobj/Common/POTAccounting/NuMISpillInfo.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace sbn {
+
+  /**
+   * Timestamps and POT of the spills of a subrun, sorted by time.
+   *
+   * The spills are added with `add()`, then `finalize()` sorts them and
+   * computes the cumulative POT, so that the POT in any time range is the
+   * difference of two cumulative values found by binary search.
+   * A POT accounting job can then read one `SpillIndex` per subrun instead
+   * of all the `BNBSpillInfo` or `NuMISpillInfo` records.
+   *
+   * Timestamps are in nanoseconds (`spill_time_s * 1000000000 + spill_time_ns`)
+   * and POT in the units of `BNBSpillInfo::POT()` and `NuMISpillInfo::POT()`.
+   * Queries on an index not finalized throw `cet::exception`.
+   */
+  class SpillIndex {
+  public:
+
+    /// Range of spill indices, from `first` (included) to `second` (excluded).
+    using Range_t = std::pair<std::size_t, std::size_t>;
+
+    SpillIndex() = default;
+
+    /// Creates and finalizes an index of the BNB `spills`.
+    explicit SpillIndex(std::vector<BNBSpillInfo> const& spills);
+
+    /// Creates and finalizes an index of the NuMI `spills`.
+    explicit SpillIndex(std::vector<NuMISpillInfo> const& spills);
+
+    /// Returns the timestamp of a spill in nanoseconds.
+    static std::uint64_t timestamp(unsigned long int s, unsigned long int ns)
+      { return static_cast<std::uint64_t>(s) * 1000000000ULL + ns; }
+
+    void reserve(std::size_t nSpills);
+
+    /// Adds a spill at `time` [ns] with `pot`.
+    void add(std::uint64_t time, double pot);
+    void add(BNBSpillInfo const& spill)
+      { add(timestamp(spill.spill_time_s, spill.spill_time_ns), spill.POT()); }
+    void add(NuMISpillInfo const& spill)
+      { add(timestamp(spill.spill_time_s, spill.spill_time_ns), spill.POT()); }
+
+    /// Sorts the spills by time and computes the cumulative POT.
+    void finalize();
+
+    bool isFinalized() const { return fFinalized; }
+
+    std::size_t size() const { return fTimes.size(); }
+    bool empty() const { return fTimes.empty(); }
+
+    std::uint64_t time(std::size_t i) const { return fTimes[i]; } //!< Spill `i` time [ns]
+    double POT(std::size_t i) const { return fPOT[i]; } //!< POT of spill `i`
+
+    std::vector<std::uint64_t> const& times() const { return fTimes; }
+    std::vector<double> const& POTs() const { return fPOT; }
+
+    /// Spills with time in [ `start`, `stop` [.
+    Range_t window(std::uint64_t start, std::uint64_t stop) const;
+
+    /// Total POT of the spills in [ `first`, `last` [ (indices).
+    double POT(Range_t range) const;
+
+    /// Total POT of the spills with time in [ `start`, `stop` [.
+    double POT(std::uint64_t start, std::uint64_t stop) const
+      { return POT(window(start, stop)); }
+
+    /// Total POT of all the spills.
+    double totalPOT() const;
+
+    /// Index of the spill closest in time to `time` (`size()` if empty).
+    std::size_t closest(std::uint64_t time) const;
+
+  private:
+
+    std::vector<std::uint64_t> fTimes; //!< Spill times, sorted [ns]
+    std::vector<double> fPOT; //!< POT of each spill
+    std::vector<double> fCumulativePOT; //!< POT of spills before each one, plus the total
+    bool fFinalized = false; //!< Whether spills are sorted and summed
+
+    void requireFinalized(char const* caller) const;
+
+  };
+} // end namespace sbn
+
+#endif
@@ -2,8 +2,11 @@
 #include "canvas/Persistency/Common/Wrapper.h"
 #include "canvas/Persistency/Common/Assns.h"
 #include "sbnobj/Common/POTAccounting/BNBSpillInfo.h"
+#include "sbnobj/Common/POTAccounting/BNBSpillSummary.h"
 #include "sbnobj/Common/POTAccounting/NuMISpillInfo.h"
 #include "sbnobj/Common/POTAccounting/EXTCountInfo.h"
+#include "sbnobj/Common/POTAccounting/ExposureSummary.h"
+#include "sbnobj/Common/POTAccounting/SpillIndex.h"
 
 
 
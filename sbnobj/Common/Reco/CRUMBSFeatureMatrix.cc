@@ -0,0 +1,149 @@
+#include "sbnobj/Common/Reco/CRUMBSFeatureMatrix.h"
+
+#include "cetlib_except/exception.h"
+
+#include <cmath>
+#include <limits>
+
+
+namespace {
+
+  constexpr float NoFeature = std::numeric_limits<float>::quiet_NaN();
+
+  constexpr char const* FeatureNames[sbn::CRUMBSFeatureMatrix::NFeatures] = {
+    "tpc_CRFracHitsInLongestTrack",
+    "tpc_CRLongestTrackDeflection",
+    "tpc_CRLongestTrackDirY",
+    "tpc_CRNHitsMax",
+    "tpc_NuEigenRatioInSphere",
+    "tpc_NuNFinalStatePfos",
+    "tpc_NuNHitsTotal",
+    "tpc_NuNSpacePointsInSphere",
+    "tpc_NuVertexY",
+    "tpc_NuWeightedDirZ",
+    "tpc_StoppingChi2CosmicRatio",
+    "pds_FMTotalScore",
+    "pds_FMPE",
+    "pds_FMTime",
+    "pds_OpT0Score",
+    "pds_OpT0MeasuredPE",
+    "crt_TrackScore",
+    "crt_SPScore",
+    "crt_TrackTime",
+    "crt_SPTime"
+  };
+
+}
+
+
+char const* sbn::CRUMBSFeatureMatrix::FeatureName(Feature feature)
+{
+  return (feature < NFeatures)? FeatureNames[feature]: "";
+}
+
+
+std::size_t sbn::CRUMBSFeatureMatrix::addRow()
+{
+  std::size_t const row = size();
+  fFeatures.resize(fFeatures.size() + NFeatures, NoFeature);
+  return row;
+}
+
+
+std::size_t sbn::CRUMBSFeatureMatrix::addRow(CRUMBSResult const& r)
+{
+  std::size_t const row = addRow();
+  set(row, k_tpc_CRFracHitsInLongestTrack, r.tpc_CRFracHitsInLongestTrack);
+  set(row, k_tpc_CRLongestTrackDeflection, r.tpc_CRLongestTrackDeflection);
+  set(row, k_tpc_CRLongestTrackDirY, r.tpc_CRLongestTrackDirY);
+  setInt(row, k_tpc_CRNHitsMax, r.tpc_CRNHitsMax);
+  set(row, k_tpc_NuEigenRatioInSphere, r.tpc_NuEigenRatioInSphere);
+  setInt(row, k_tpc_NuNFinalStatePfos, r.tpc_NuNFinalStatePfos);
+  setInt(row, k_tpc_NuNHitsTotal, r.tpc_NuNHitsTotal);
+  setInt(row, k_tpc_NuNSpacePointsInSphere, r.tpc_NuNSpacePointsInSphere);
+  set(row, k_tpc_NuVertexY, r.tpc_NuVertexY);
+  set(row, k_tpc_NuWeightedDirZ, r.tpc_NuWeightedDirZ);
+  set(row, k_tpc_StoppingChi2CosmicRatio, r.tpc_StoppingChi2CosmicRatio);
+  set(row, k_pds_FMTotalScore, r.pds_FMTotalScore);
+  set(row, k_pds_FMPE, r.pds_FMPE);
+  set(row, k_pds_FMTime, r.pds_FMTime);
+  set(row, k_pds_OpT0Score, r.pds_OpT0Score);
+  set(row, k_pds_OpT0MeasuredPE, r.pds_OpT0MeasuredPE);
+  set(row, k_crt_TrackScore, r.crt_TrackScore);
+  set(row, k_crt_SPScore, r.crt_SPScore);
+  set(row, k_crt_TrackTime, r.crt_TrackTime);
+  set(row, k_crt_SPTime, r.crt_SPTime);
+  return row;
+}
+
+
+void sbn::CRUMBSFeatureMatrix::setInt(std::size_t row, Feature feature, int value)
+{
+  set(row, feature, (value == default_int)? NoFeature: static_cast<float>(value));
+}
+
+
+int sbn::CRUMBSFeatureMatrix::getInt(std::size_t row, Feature feature) const
+{
+  float const value = get(row, feature);
+  return std::isnan(value)? default_int: static_cast<int>(std::lround(value));
+}
+
+
+std::vector<float> sbn::CRUMBSFeatureMatrix::evaluate(BatchEvaluator_t const& evaluator) const
+{
+  if (!evaluator) {
+    throw cet::exception("CRUMBSFeatureMatrix")
+      << "No evaluator provided to score " << size() << " slices.\n";
+  }
+  std::vector<float> scores(size(), NoFeature);
+  if (!empty()) evaluator(data(), size(), NFeatures, scores.data());
+  return scores;
+}
+
+
+std::vector<float> sbn::CRUMBSFeatureMatrix::evaluate(RowEvaluator_t const& evaluator) const
+{
+  if (!evaluator) {
+    throw cet::exception("CRUMBSFeatureMatrix")
+      << "No evaluator provided to score " << size() << " slices.\n";
+  }
+  std::vector<float> scores;
+  scores.reserve(size());
+  for (std::size_t i = 0; i < size(); ++i) scores.push_back(evaluator(row(i)));
+  return scores;
+}
+
+
+sbn::CRUMBSResult sbn::CRUMBSFeatureMatrix::makeResult(std::size_t row, float score,
+  float ccnumuscore, float ccnuescore, float ncscore) const
+{
+  // NaN scores never win
+  float bestscore = ccnumuscore;
+  int bestid = 14;
+  if (!(ccnuescore <= bestscore)) { bestscore = ccnuescore; bestid = 12; }
+  if (!(ncscore <= bestscore)) { bestscore = ncscore; bestid = 1; }
+  if (std::isnan(bestscore)) bestid = default_int;
+
+  return CRUMBSResult(score, ccnumuscore, ccnuescore, ncscore, bestscore, bestid,
+    get(row, k_tpc_CRFracHitsInLongestTrack),
+    get(row, k_tpc_CRLongestTrackDeflection),
+    get(row, k_tpc_CRLongestTrackDirY),
+    getInt(row, k_tpc_CRNHitsMax),
+    get(row, k_tpc_NuEigenRatioInSphere),
+    getInt(row, k_tpc_NuNFinalStatePfos),
+    getInt(row, k_tpc_NuNHitsTotal),
+    getInt(row, k_tpc_NuNSpacePointsInSphere),
+    get(row, k_tpc_NuVertexY),
+    get(row, k_tpc_NuWeightedDirZ),
+    get(row, k_tpc_StoppingChi2CosmicRatio),
+    get(row, k_pds_FMTotalScore),
+    get(row, k_pds_FMPE),
+    get(row, k_pds_FMTime),
+    get(row, k_pds_OpT0Score),
+    get(row, k_pds_OpT0MeasuredPE),
+    get(row, k_crt_TrackScore),
+    get(row, k_crt_SPScore),
+    get(row, k_crt_TrackTime),
+    get(row, k_crt_SPTime));
+}
@@ -0,0 +1,131 @@
+#ifndef sbnobj_CRUMBSFeatureMatrix_H
+#define sbnobj_CRUMBSFeatureMatrix_H
+
+#include "sbnobj/Common/Reco/CRUMBSResult.h"
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace sbn {
+
+  /**
+   * @brief Input features of the CRUMBS classifier of many slices.
+   *
+   * The features of all the slices are stored in a single contiguous block of
+   * single precision values, one row per slice and one column per feature
+   * (row-major), so that a classifier can score all the slices of an event
+   * in one call instead of filling its input variables slice by slice:
+   *
+   *     sbn::CRUMBSFeatureMatrix features;
+   *     for (auto const& slice: slices) {
+   *       std::size_t const row = features.addRow();
+   *       features.set(row, sbn::CRUMBSFeatureMatrix::k_tpc_NuVertexY, vertexY);
+   *       // ...
+   *     }
+   *     std::vector<float> const scores = features.evaluate(bdt);
+   *
+   * The columns follow the order of the features in `CRUMBSResult`, and
+   * `FeatureName()` gives their names as in there. Integral features are
+   * stored as `float`; features not set, or with the `CRUMBSResult` default
+   * value, are NaN.
+   */
+  class CRUMBSFeatureMatrix {
+  public:
+
+    /// Feature columns, in the order of `CRUMBSResult`.
+    enum Feature: unsigned {
+      k_tpc_CRFracHitsInLongestTrack,
+      k_tpc_CRLongestTrackDeflection,
+      k_tpc_CRLongestTrackDirY,
+      k_tpc_CRNHitsMax,
+      k_tpc_NuEigenRatioInSphere,
+      k_tpc_NuNFinalStatePfos,
+      k_tpc_NuNHitsTotal,
+      k_tpc_NuNSpacePointsInSphere,
+      k_tpc_NuVertexY,
+      k_tpc_NuWeightedDirZ,
+      k_tpc_StoppingChi2CosmicRatio,
+      k_pds_FMTotalScore,
+      k_pds_FMPE,
+      k_pds_FMTime,
+      k_pds_OpT0Score,
+      k_pds_OpT0MeasuredPE,
+      k_crt_TrackScore,
+      k_crt_SPScore,
+      k_crt_TrackTime,
+      k_crt_SPTime,
+      NFeatures
+    };
+
+    /**
+     * @brief Scores many rows of features in one call.
+     *
+     * Arguments are the first feature of the first row, the number of rows,
+     * the number of features of each row (`NFeatures`) and the first of the
+     * scores to be written, one per row.
+     */
+    using BatchEvaluator_t
+      = std::function<void(float const*, std::size_t, std::size_t, float*)>;
+
+    /// Scores one row of `NFeatures` features.
+    using RowEvaluator_t = std::function<float(float const*)>;
+
+    /// Name of the `feature`, as the data member of `CRUMBSResult`.
+    static char const* FeatureName(Feature feature);
+
+    /// Number of rows (slices).
+    std::size_t size() const { return fFeatures.size() / NFeatures; }
+    bool empty() const { return fFeatures.empty(); }
+
+    /// Reserves room for `n` rows.
+    void reserve(std::size_t n) { fFeatures.reserve(n * NFeatures); }
+    void clear() { fFeatures.clear(); }
+
+    /// Adds a row with all the features not set; returns its index.
+    std::size_t addRow();
+
+    /// Adds a row with the features in `result`; returns its index.
+    std::size_t addRow(CRUMBSResult const& result);
+
+    void set(std::size_t row, Feature feature, float value)
+      { fFeatures[row * NFeatures + feature] = value; }
+
+    /// Sets an integral feature (`default_int` is stored as not set).
+    void setInt(std::size_t row, Feature feature, int value);
+
+    float get(std::size_t row, Feature feature) const
+      { return fFeatures[row * NFeatures + feature]; }
+
+    /// The `NFeatures` features of `row`.
+    float const* row(std::size_t row) const { return fFeatures.data() + row * NFeatures; }
+
+    /// All the features, row after row.
+    float const* data() const { return fFeatures.data(); }
+
+    /// Returns the score of each row, from a single call to `evaluator`.
+    std::vector<float> evaluate(BatchEvaluator_t const& evaluator) const;
+
+    /// Returns the score of each row, calling `evaluator` on each row.
+    std::vector<float> evaluate(RowEvaluator_t const& evaluator) const;
+
+    /**
+     * @brief Returns a `CRUMBSResult` with the features of `row` and the scores.
+     *
+     * The best score and its ID (14 for CCNuMu, 12 for CCNuE, 1 for NC) are
+     * chosen among the three signal-specific scores.
+     */
+    CRUMBSResult makeResult(std::size_t row, float score,
+      float ccnumuscore, float ccnuescore, float ncscore) const;
+
+  private:
+    std::vector<float> fFeatures; ///< All features, `NFeatures` per row.
+
+    /// Integral value of a feature stored as `float`.
+    int getInt(std::size_t row, Feature feature) const;
+
+  };
+
+}
+
+#endif
@@ -0,0 +1,139 @@
+#include "sbnobj/Common/Reco/FlashHypothesisScorer.h"
+
+#include "cetlib_except/exception.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+
+  constexpr std::size_t Lanes = sbn::FlashHypothesisScorer::Lanes;
+
+  std::size_t paddedSize(std::size_t n) { return (n + Lanes - 1) / Lanes * Lanes; }
+
+  // sum of the lanes, always in the same order
+  double sumLanes(float const* lane)
+  {
+    double sum = 0.;
+    for (std::size_t k = 0; k < Lanes; ++k) sum += lane[k];
+    return sum;
+  }
+
+  double scoreFromMetric(double sum, std::size_t nUsed)
+  {
+    if (nUsed == 0) return 0.;
+    return (sum > 0.)? nUsed / sum: std::numeric_limits<double>::max();
+  }
+
+} // local namespace
+
+
+sbn::FlashHypothesisScorer::FlashHypothesisScorer(
+  std::vector<double> const& measPESpec, std::vector<int> const& opch,
+  Mode mode, float minError, float hypoThreshold)
+  : fMode(mode)
+  , fNChannels(measPESpec.size())
+  , fHypoThreshold(hypoThreshold)
+{
+  if (!opch.empty() && opch.size() != measPESpec.size()) {
+    throw cet::exception("FlashHypothesisScorer")
+      << "Used channel list has " << opch.size() << " entries, measured spectrum "
+      << measPESpec.size() << ".\n";
+  }
+  if (!(minError > 0.f) || !(hypoThreshold > 0.f)) {
+    throw cet::exception("FlashHypothesisScorer")
+      << "Invalid minimum error (" << minError << ") or hypothesis threshold ("
+      << hypoThreshold << ").\n";
+  }
+
+  std::size_t const n = paddedSize(fNChannels);
+  fMeas.assign(n, 0.f);
+  fWeight.assign(n, 0.f);
+  fInvError.assign(n, 0.f);
+  fLogFactMeas.assign(n, 0.f);
+  for (std::size_t c = 0; c < fNChannels; ++c) {
+    if (!opch.empty() && !opch[c]) continue;
+    float const O = measPESpec[c];
+    ++fNUsed;
+    fMeas[c] = O;
+    fWeight[c] = 1.f;
+    fInvError[c] = 1.f / std::max(O, minError);
+    fLogFactMeas[c] = std::lgamma(O + 1.f);
+  }
+}
+
+
+void sbn::FlashHypothesisScorer::scores
+  (float const* hypoPE, std::size_t nSlices, double* score) const
+{
+  for (std::size_t s = 0; s < nSlices; ++s)
+    score[s] = this->score(hypoPE + s * fNChannels);
+}
+
+
+std::vector<double> sbn::FlashHypothesisScorer::scores
+  (std::vector<float> const& hypoPE) const
+{
+  if (fNChannels == 0) return {};
+  if (hypoPE.size() % fNChannels != 0) {
+    throw cet::exception("FlashHypothesisScorer")
+      << "Hypothesis matrix of " << hypoPE.size() << " entries is not made of rows of "
+      << fNChannels << " channels.\n";
+  }
+  std::vector<double> score(hypoPE.size() / fNChannels);
+  scores(hypoPE.data(), score.size(), score.data());
+  return score;
+}
+
+
+double sbn::FlashHypothesisScorer::score(float const* hypoPE) const
+{
+  double const sum = (fMode == Mode::LLH)? metricLLH(hypoPE): metricChi2(hypoPE);
+  return scoreFromMetric(sum, fNUsed);
+}
+
+
+double sbn::FlashHypothesisScorer::metricChi2(float const* __restrict__ H) const
+{
+  float const* __restrict__ O = fMeas.data();
+  float const* __restrict__ invErr = fInvError.data();
+
+  float lane[Lanes] = {};
+  std::size_t const nBlocks = fNChannels / Lanes * Lanes;
+  for (std::size_t c = 0; c < nBlocks; c += Lanes) {
+    for (std::size_t k = 0; k < Lanes; ++k) {
+      float const d = H[c + k] - O[c + k];
+      lane[k] += d * d * invErr[c + k];
+    }
+  }
+  for (std::size_t c = nBlocks; c < fNChannels; ++c) {
+    float const d = H[c] - O[c];
+    lane[c - nBlocks] += d * d * invErr[c];
+  }
+  return sumLanes(lane);
+}
+
+
+double sbn::FlashHypothesisScorer::metricLLH(float const* __restrict__ H) const
+{
+  // -log10 Poisson(O | H) = (H - O ln H + ln O!) / ln 10
+  float const* __restrict__ O = fMeas.data();
+  float const* __restrict__ w = fWeight.data();
+  float const* __restrict__ logFactO = fLogFactMeas.data();
+  float const thr = fHypoThreshold;
+
+  float lane[Lanes] = {};
+  std::size_t const nBlocks = fNChannels / Lanes * Lanes;
+  for (std::size_t c = 0; c < nBlocks; c += Lanes) {
+    for (std::size_t k = 0; k < Lanes; ++k) {
+      float const h = std::max(H[c + k], thr);
+      lane[k] += w[c + k] * h - O[c + k] * std::log(h) + logFactO[c + k];
+    }
+  }
+  for (std::size_t c = nBlocks; c < fNChannels; ++c) {
+    float const h = std::max(H[c], thr);
+    lane[c - nBlocks] += w[c] * h - O[c] * std::log(h) + logFactO[c];
+  }
+  return sumLanes(lane) / std::log(10.);
+}
@@ -0,0 +1,73 @@
+#ifndef sbnobj_FlashHypothesisScorer_H
+#define sbnobj_FlashHypothesisScorer_H
+
+#include <cstddef>
+#include <vector>
+
+namespace sbn
+{
+  /**
+   * @brief Scores many flash hypotheses against one measured flash.
+   *
+   * The measured PE spectrum and the channels used for the matching are set
+   * at construction; `scores()` then compares a whole matrix of hypotheses
+   * (one row of `nChannels()` PE per TPC slice) against it.
+   *
+   * The metric of a hypothesis is averaged over the `N` used channels:
+   *  * `Chi2`: sum of `(H - O)^2 / max(O, minError)`, over `N`;
+   *  * `LLH`: sum of `-log10 Poisson(O | max(H, hypoThreshold))`, over `N`;
+   * where `O` and `H` are the measured and hypothesis PE of each channel.
+   * The score is its reciprocal (as `OpT0Finder::score`), and
+   * `std::numeric_limits<double>::max()` for a perfect match; with no used
+   * channel, all scores are 0.
+   *
+   * The channel terms are accumulated into a fixed number of lanes, so that
+   * the loop is vectorized without any reordering of the floating point
+   * sums: results do not depend on the instruction set.
+   */
+  class FlashHypothesisScorer
+  {
+  public:
+
+    enum class Mode { Chi2, LLH };
+
+    static constexpr std::size_t Lanes = 8; // width of the accumulation blocks
+
+    // `opch` flags the channels used for the matching (all of them if empty)
+    FlashHypothesisScorer(
+      std::vector<double> const& measPESpec, std::vector<int> const& opch,
+      Mode mode = Mode::Chi2, float minError = 1.0, float hypoThreshold = 1.0e-6);
+
+    std::size_t nChannels() const { return fNChannels; }
+    std::size_t nUsedChannels() const { return fNUsed; }
+    Mode mode() const { return fMode; }
+
+    // `hypoPE` holds `nSlices` rows of `nChannels()` PE; fills `score[nSlices]`
+    void scores(float const* hypoPE, std::size_t nSlices, double* score) const;
+
+    // `hypoPE` holds the rows of all slices; returns one score per slice
+    std::vector<double> scores(std::vector<float> const& hypoPE) const;
+
+    // score of a single hypothesis of `nChannels()` PE
+    double score(float const* hypoPE) const;
+
+  private:
+
+    Mode fMode;
+    std::size_t fNChannels = 0;
+    std::size_t fNUsed = 0;
+    float fHypoThreshold;
+
+    // per-channel terms, padded to a multiple of `Lanes`
+    std::vector<float> fMeas;       // measured PE
+    std::vector<float> fWeight;     // 1 for used channels, 0 otherwise
+    std::vector<float> fInvError;   // chi2: weight / max(O, minError)
+    std::vector<float> fLogFactMeas; // LLH: weight * log(O!)
+
+    double metricChi2(float const* hypoPE) const;
+    double metricLLH(float const* hypoPE) const;
+
+  };
+}
+
+#endif
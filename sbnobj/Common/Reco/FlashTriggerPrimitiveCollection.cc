@@ -0,0 +1,93 @@
+#include "sbnobj/Common/Reco/FlashTriggerPrimitiveCollection.hh"
+
+#include "cetlib_except/exception.h"
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <numeric>
+
+sbn::FlashTriggerPrimitiveCollection::FlashTriggerPrimitiveCollection
+  (std::vector<FlashTriggerPrimitive> const& primitives)
+{
+  std::size_t nTrigs = 0;
+  for (FlashTriggerPrimitive const& primitive: primitives) nTrigs += primitive.triggers.size();
+  reserve(primitives.size(), nTrigs);
+  for (FlashTriggerPrimitive const& primitive: primitives) push_back(primitive);
+}
+
+
+void sbn::FlashTriggerPrimitiveCollection::reserve
+  (std::size_t nPrimitives, std::size_t nTriggers)
+{
+  fEntries.reserve(nPrimitives);
+  fADC.reserve(nTriggers);
+  fTDC.reserve(nTriggers);
+  fTimeOrder.reserve(nTriggers);
+}
+
+
+void sbn::FlashTriggerPrimitiveCollection::push_back(FlashTriggerPrimitive const& primitive)
+{
+  for (FlashTriggerPrimitive::Trig const& trig: primitive.triggers) {
+    if (trig.adc < std::numeric_limits<ADC_t>::min()
+      || trig.adc > std::numeric_limits<ADC_t>::max()) {
+      throw cet::exception("FlashTriggerPrimitiveCollection")
+        << "ADC " << trig.adc << " of channel " << primitive.channel
+        << " does not fit the packed storage.\n";
+    }
+  }
+
+  std::uint32_t const first = fTDC.size();
+  fEntries.push_back({ primitive.channel, first, static_cast<std::uint32_t>(primitive.triggers.size()) });
+  for (FlashTriggerPrimitive::Trig const& trig: primitive.triggers) {
+    fADC.push_back(static_cast<ADC_t>(trig.adc));
+    fTDC.push_back(static_cast<TDC_t>(trig.tdc));
+  }
+
+  // sort the new triggers and merge them into the time index
+  auto const byTime = [this](std::uint32_t a, std::uint32_t b){ return fTDC[a] < fTDC[b]; };
+  std::size_t const nOld = fTimeOrder.size();
+  fTimeOrder.resize(fTDC.size());
+  std::iota(fTimeOrder.begin() + nOld, fTimeOrder.end(), first);
+  std::stable_sort(fTimeOrder.begin() + nOld, fTimeOrder.end(), byTime);
+  std::inplace_merge(fTimeOrder.begin(), fTimeOrder.begin() + nOld, fTimeOrder.end(), byTime);
+}
+
+
+sbn::FlashTriggerPrimitive sbn::FlashTriggerPrimitiveCollection::primitive(std::size_t i) const
+{
+  Entry const& e = fEntries[i];
+  FlashTriggerPrimitive primitive;
+  primitive.channel = e.channel;
+  primitive.triggers.reserve(e.count);
+  for (std::uint32_t t = e.offset; t < e.offset + e.count; ++t)
+    primitive.triggers.push_back({ fADC[t], fTDC[t] });
+  return primitive;
+}
+
+
+std::vector<sbn::FlashTriggerPrimitive> sbn::FlashTriggerPrimitiveCollection::toPrimitives() const
+{
+  std::vector<FlashTriggerPrimitive> primitives;
+  primitives.reserve(size());
+  for (std::size_t i = 0; i < size(); ++i) primitives.push_back(primitive(i));
+  return primitives;
+}
+
+
+std::size_t sbn::FlashTriggerPrimitiveCollection::primitiveOf(std::size_t t) const
+{
+  // the first primitive ending after `t` owns it (empty ones end where they start)
+  auto const it = std::upper_bound(fEntries.begin(), fEntries.end(), t,
+    [](std::size_t t, Entry const& e){ return t < e.offset + e.count; });
+  return std::distance(fEntries.begin(), it);
+}
+
+
+sbn::FlashTriggerPrimitiveCollection::ChannelTrig
+sbn::FlashTriggerPrimitiveCollection::timeOrdered(std::size_t k) const
+{
+  std::uint32_t const t = fTimeOrder[k];
+  return { fEntries[primitiveOf(t)].channel, fADC[t], fTDC[t] };
+}
@@ -0,0 +1,107 @@
+/**
+ * \class FlashTriggerPrimitiveCollection
+ *
+ * \brief Flash trigger primitives of all channels in contiguous storage
+ *
+ */
+
+#ifndef FlashTriggerPrimitiveCollection_SBN_hh_
+#define FlashTriggerPrimitiveCollection_SBN_hh_
+
+#include "sbnobj/Common/Reco/FlashTriggerPrimitive.hh"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace sbn {
+
+  /**
+   * @brief Collection of `FlashTriggerPrimitive` with all the triggers in
+   *        one array.
+   *
+   * The triggers of all the primitives are concatenated, with 16-bit ADC and
+   * 32-bit TDC values, and each primitive is indexed by its channel, the
+   * offset of its first trigger and its number of triggers.
+   *
+   * An index of all the triggers sorted by TDC (triggers with the same TDC
+   * in insertion order) is kept up to date, for sweeps in time across all
+   * channels.
+   */
+  class FlashTriggerPrimitiveCollection {
+
+  public:
+
+    using ADC_t = std::int16_t;
+    using TDC_t = std::int32_t;
+
+    /// Index entry of a primitive.
+    struct Entry {
+      unsigned channel = 0;
+      std::uint32_t offset = 0; ///< First trigger of the primitive.
+      std::uint32_t count = 0;  ///< Number of triggers of the primitive.
+    };
+
+    /// A trigger with its channel.
+    struct ChannelTrig {
+      unsigned channel;
+      ADC_t adc;
+      TDC_t tdc;
+    };
+
+    FlashTriggerPrimitiveCollection() = default;
+
+    /// Creates a collection with a copy of all the `primitives`.
+    explicit FlashTriggerPrimitiveCollection(std::vector<FlashTriggerPrimitive> const& primitives);
+
+    /// Number of primitives in the collection.
+    std::size_t size() const { return fEntries.size(); }
+    bool empty() const { return fEntries.empty(); }
+
+    /// Total number of triggers, from all primitives.
+    std::size_t nTriggers() const { return fTDC.size(); }
+
+    /// Reserves room for `nPrimitives` primitives with `nTriggers` triggers in total.
+    void reserve(std::size_t nPrimitives, std::size_t nTriggers = 0);
+
+    /// Adds a copy of the `primitive`; throws if an ADC does not fit 16 bits.
+    void push_back(FlashTriggerPrimitive const& primitive);
+
+    /// Index entry of primitive `i`.
+    Entry const& entry(std::size_t i) const { return fEntries[i]; }
+    unsigned channel(std::size_t i) const { return fEntries[i].channel; }
+
+    /// Returns a copy of primitive `i`.
+    FlashTriggerPrimitive primitive(std::size_t i) const;
+
+    /// Returns a copy of all the primitives.
+    std::vector<FlashTriggerPrimitive> toPrimitives() const;
+
+    // --- trigger columns; primitive `i` owns
+    //     [ entry(i).offset, entry(i).offset + entry(i).count [
+    std::vector<ADC_t> const& adc() const { return fADC; }
+    std::vector<TDC_t> const& tdc() const { return fTDC; }
+    std::vector<Entry> const& entries() const { return fEntries; }
+
+    /// Index of the primitive owning trigger `t`.
+    std::size_t primitiveOf(std::size_t t) const;
+
+    // --- time index
+    /// Trigger indices in ascending TDC.
+    std::vector<std::uint32_t> const& timeOrder() const { return fTimeOrder; }
+
+    /// The `k`-th trigger in time order, with its channel.
+    ChannelTrig timeOrdered(std::size_t k) const;
+
+  private:
+
+    std::vector<ADC_t> fADC;    ///< ADC of all triggers.
+    std::vector<TDC_t> fTDC;    ///< TDC of all triggers.
+    std::vector<Entry> fEntries; ///< Index of the primitives.
+    std::vector<std::uint32_t> fTimeOrder; ///< Trigger indices sorted by TDC.
+
+  };
+
+} // namespace sbn
+
+#endif
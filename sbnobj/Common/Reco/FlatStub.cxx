@@ -0,0 +1,90 @@
+#include "sbnobj/Common/Reco/FlatStub.h"
+
+sbn::FlatStub::FlatStub(const sbn::Stub &stub):
+  vtx(stub.vtx),
+  end(stub.end),
+  efield_end(stub.efield_end),
+  efield_vtx(stub.efield_vtx),
+  plane(stub.plane),
+  pitch(stub.pitch),
+  trkpitch(stub.trkpitch),
+  vtx_w(stub.vtx_w),
+  hit_w(stub.hit_w)
+{
+  unsigned const nplanes = plane.size();
+
+  std::size_t nhits = 0;
+  for (unsigned i_p = 0; i_p < nplanes; i_p++) nhits += stub.hits[i_p].size();
+
+  hits.reserve(nplanes, nhits);
+  core_charge.reserve(nplanes);
+  core_nhit.reserve(nplanes);
+  for (unsigned i_p = 0; i_p < nplanes; i_p++) {
+    hits.push_back(stub.hits[i_p]);
+    core_charge.push_back(stub.CoreCharge(i_p));
+    core_nhit.push_back(stub.CoreNHit(i_p));
+  }
+
+  // the first plane index with a given plane number wins, as in `Stub::PlaneIndex()`
+  plane_slot.fill(-1);
+  for (unsigned i_p = nplanes; i_p-- > 0;) {
+    if (plane[i_p].Plane < MaxPlaneNumber) plane_slot[plane[i_p].Plane] = i_p;
+  }
+}
+
+sbn::Stub sbn::FlatStub::ToStub() const {
+  sbn::Stub stub;
+  stub.vtx = vtx;
+  stub.end = end;
+  stub.efield_end = efield_end;
+  stub.efield_vtx = efield_vtx;
+  stub.plane = plane;
+  stub.pitch = pitch;
+  stub.trkpitch = trkpitch;
+  stub.vtx_w = vtx_w;
+  stub.hit_w = hit_w;
+  stub.hits.reserve(plane.size());
+  for (unsigned i_p = 0; i_p < plane.size(); i_p++) {
+    stub.hits.emplace_back(HitsBegin(i_p), HitsEnd(i_p));
+  }
+  return stub;
+}
+
+int sbn::FlatStub::PlaneIndex(const geo::PlaneID &p) const {
+  if (p.Plane < MaxPlaneNumber) {
+    int const slot = plane_slot[p.Plane];
+    if (slot >= 0 && plane[slot] == p) return slot;
+  }
+
+  // planes with the same number in different TPC's, or beyond the table
+  for (unsigned i_p = 0; i_p < plane.size(); i_p++) {
+    if (plane[i_p] == p) return i_p;
+  }
+
+  return -1;
+}
+
+float sbn::FlatStub::CoreCharge(const geo::PlaneID &p) const {
+  int plane_index = PlaneIndex(p);
+  if (plane_index < 0) return 0.;
+
+  return core_charge[plane_index];
+}
+
+int sbn::FlatStub::CoreNHit(const geo::PlaneID &p) const {
+  int plane_index = PlaneIndex(p);
+  if (plane_index < 0) return 0;
+
+  return core_nhit[plane_index];
+}
+
+bool sbn::FlatStub::OnCore(const geo::WireID &w) const {
+  int plane_index = PlaneIndex(w);
+  if (plane_index < 0) return false;
+
+  int stubdir = vtx_w[plane_index] <= hit_w[plane_index] ? 1 : -1;
+  bool before_vtx = (((int)w.Wire - vtx_w[plane_index]) * stubdir) < 0;
+  bool after_hit = (((int)w.Wire - hit_w[plane_index]) * stubdir) > 0;
+
+  return !before_vtx && !after_hit;
+}
@@ -0,0 +1,75 @@
+#ifndef sbncode_FlatStub_HH
+#define sbncode_FlatStub_HH
+
+#include <array>
+#include <cstddef>
+#include <vector>
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_vectors.h"
+#include "sbnobj/Common/Reco/Stub.h"
+#include "sbnobj/Common/Utilities/JaggedArray.h"
+
+namespace sbn {
+  /**
+   * @brief `Stub` with the hits of all planes in a single array.
+   *
+   * The hits of plane index `i` are the row `i` of `hits`, i.e. the range
+   * [ `HitOffset(i)`, `HitOffset(i+1)` [ of `hits.values()`. The core charge and number of core hits of each plane are
+   * computed once at construction, and the plane index of a `geo::PlaneID`
+   * is looked up by its plane number.
+   * Per-plane information keeps the order of the source `Stub`
+   * ("best" plane first).
+   */
+  class FlatStub {
+  public:
+    static constexpr unsigned MaxPlaneNumber = 3; //!< Plane numbers with direct lookup
+
+    geo::Point_t vtx; //!< Interaction Vertex / Start of Stub. Space charge corrected. [cm]
+    geo::Point_t end; //!< End of Stub. Space charge corrected. [cm]
+
+    float efield_end; //!< The E-Field at the stub end point
+    float efield_vtx; //!< The E-Field at the reconstructed vertex
+
+    // Per-plane information
+    std::vector<geo::PlaneID> plane; //!< The plane ID
+    std::vector<float> pitch; //!< Pitch of stub on each wire [cm]
+    std::vector<float> trkpitch; //!< Pitch of the matched track on each wire [cm]
+    std::vector<float> vtx_w; //!< Wire coordinate of the vertex on this plane
+    std::vector<short> hit_w; //!< Wire of the end point hit on this plane
+    std::vector<float> core_charge; //!< Charge along the core of the stub on this plane
+    std::vector<int> core_nhit; //!< Number of hits along the core of the stub on this plane
+
+    sbn::JaggedArray<sbn::StubHit> hits; //!< Hits of each plane index. Ordered vtx->end
+
+    std::array<short, MaxPlaneNumber> plane_slot; //!< Plane index by plane number (-1 if none)
+
+    FlatStub(): efield_end(0.), efield_vtx(0.) { plane_slot.fill(-1); }
+    explicit FlatStub(const sbn::Stub &stub);
+
+    /// Returns a copy in the `Stub` form.
+    sbn::Stub ToStub() const;
+
+    unsigned NPlanes() const { return plane.size(); }
+
+    /// Helper functions, with the same results as the `Stub` ones
+    float CoreCharge(unsigned plane_index=0) const //!< Returns the charge along the core of the stub on the given plane index
+      { return plane_index < plane.size()? core_charge[plane_index]: -1; }
+    int CoreNHit(unsigned plane_index=0) const //!< Returns the number of hits along the core of the stub on the given plane index
+      { return plane_index < plane.size()? core_nhit[plane_index]: -1; }
+    float CoreCharge(const geo::PlaneID &p) const;
+    int CoreNHit(const geo::PlaneID &p) const;
+
+    int PlaneIndex(const geo::PlaneID &p) const;
+
+    bool OnCore(const geo::WireID &w) const; //!< Returns whether the input wire-ID is on the core of the stub (false if not on a stub plane)
+
+    // Hits of the given plane index
+    std::size_t HitOffset(unsigned plane_index) const { return hits.rowOffset(plane_index); }
+    std::size_t NHits(unsigned plane_index) const { return hits.rowSize(plane_index); }
+    const sbn::StubHit *HitsBegin(unsigned plane_index) const { return hits[plane_index].begin(); }
+    const sbn::StubHit *HitsEnd(unsigned plane_index) const { return hits[plane_index].end(); }
+
+  };
+} // end namespace sbn
+
+#endif
@@ -0,0 +1,107 @@
+#include "sbnobj/Common/Reco/HitCNNScore.h"
+
+#include "cetlib_except/exception.h"
+
+#include <cstring>
+
+
+sbn::HitCNNScores::Half_t sbn::HitCNNScores::toHalf(float value)
+{
+  std::uint32_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  Half_t const sign = (bits >> 16) & 0x8000U;
+  bits &= 0x7FFFFFFFU;
+
+  if (bits > 0x7F800000U) return sign | NoScore; // NaN
+  if (bits >= 0x47800000U) return sign | 0x7C00U; // too large: infinity
+  if (bits < 0x38800000U) {
+    // half precision subnormal, or zero: adding 0.5 aligns the mantissa
+    // and rounds it to the nearest even
+    float absValue;
+    std::memcpy(&absValue, &bits, sizeof(absValue));
+    absValue += 0.5f;
+    std::memcpy(&bits, &absValue, sizeof(bits));
+    return sign | Half_t(bits - 0x3F000000U);
+  }
+
+  // normal: rebias the exponent and round the mantissa to the nearest even
+  std::uint32_t const odd = (bits >> 13) & 1U;
+  bits -= (127U - 15U) << 23;
+  bits += 0xFFFU + odd;
+  return sign | Half_t(bits >> 13);
+}
+
+
+auto sbn::HitCNNScores::scores(Key_t key) const -> Scores_t
+{
+  Scores_t s;
+  for (unsigned c = 0; c < NClasses; ++c) s[c] = toFloat(fScores[key * NClasses + c]);
+  return s;
+}
+
+
+void sbn::HitCNNScores::setScores(Key_t key, Scores_t const& scores)
+{
+  if (key >= size()) fScores.resize((key + 1) * NClasses, NoScore);
+  for (unsigned c = 0; c < NClasses; ++c) fScores[key * NClasses + c] = toHalf(scores[c]);
+}
+
+
+//------------------------------------------------------------------------------
+std::vector<sbn::PFPCNNScore> sbn::makePFPCNNScores(
+  HitCNNScores const& scores,
+  std::vector<HitCNNScores::Key_t> const& hitKeys,
+  std::vector<std::size_t> const& pfpOffsets
+) {
+  constexpr unsigned NClasses = HitCNNScores::NClasses;
+
+  if (pfpOffsets.empty()) return {};
+  if (pfpOffsets.back() > hitKeys.size()) {
+    throw cet::exception("HitCNNScores")
+      << "PFP hit offsets end at " << pfpOffsets.back() << " but only "
+      << hitKeys.size() << " hit keys are provided.\n";
+  }
+  for (HitCNNScores::Key_t key: hitKeys) {
+    if (key >= scores.size()) {
+      throw cet::exception("HitCNNScores")
+        << "Hit key " << key << " out of range (" << scores.size() << " hits).\n";
+    }
+  }
+
+  HitCNNScores::Half_t const* data = scores.data().data();
+  std::size_t const nPFPs = pfpOffsets.size() - 1;
+  std::vector<PFPCNNScore> pfpScores;
+  pfpScores.reserve(nPFPs);
+  for (std::size_t i = 0; i < nPFPs; ++i) {
+    if (pfpOffsets[i + 1] < pfpOffsets[i]) {
+      throw cet::exception("HitCNNScores")
+        << "PFP hit offsets decrease at PFP " << i << ".\n";
+    }
+
+    // all classes of a hit are summed together, with no branches: hits with
+    // no scores add zero and are not counted
+    float sums[NClasses] = {};
+    float nScored = 0.f;
+    for (std::size_t j = pfpOffsets[i]; j < pfpOffsets[i + 1]; ++j) {
+      HitCNNScores::Half_t const* hit = data + hitKeys[j] * NClasses;
+      float const scored = HitCNNScores::isNaN(hit[0])? 0.f: 1.f;
+      for (unsigned c = 0; c < NClasses; ++c) {
+        float const s = HitCNNScores::toFloat(hit[c]);
+        sums[c] += (scored != 0.f)? s: 0.f;
+      }
+      nScored += scored;
+    }
+
+    if (nScored == 0.f) {
+      pfpScores.emplace_back();
+      continue;
+    }
+    pfpScores.emplace_back(
+      sums[HitCNNScores::kTrack] / nScored,
+      sums[HitCNNScores::kShower] / nScored,
+      sums[HitCNNScores::kNoise] / nScored,
+      sums[HitCNNScores::kMichel] / nScored
+      );
+  }
+  return pfpScores;
+}
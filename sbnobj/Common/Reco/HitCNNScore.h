@@ -0,0 +1,126 @@
+#ifndef sbnobj_HitCNNScore_H
+#define sbnobj_HitCNNScore_H
+
+#include "sbnobj/Common/Reco/CNNScore.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace sbn {
+
+  /**
+   * @brief CNN scores of all the hits of a hit data product.
+   *
+   * The scores of each hit are stored in half precision (IEEE 754 binary16),
+   * one value per class, in the position of the key of the hit in its data
+   * product (`art::Ptr::key()`); hits without scores hold NaN. Scores in
+   * [0, 1] keep a relative precision of about 5e-4, and four classes take
+   * 8 bytes per hit.
+   *
+   * `makePFPCNNScores()` averages them into `PFPCNNScore`, so that PFP scores
+   * can be derived again (e.g. with a different hit selection) without running
+   * the network again.
+   */
+  class HitCNNScores {
+  public:
+
+    using Key_t = std::size_t;      ///< Type of key of the hits.
+    using Half_t = std::uint16_t;   ///< Type of a score in half precision.
+
+    /// Score classes, in the order they are stored for each hit.
+    enum Class: unsigned {
+      kTrack,
+      kShower,
+      kNoise,
+      kMichel,
+      NClasses
+    };
+
+    using Scores_t = std::array<float, NClasses>; ///< Scores of a hit.
+
+    static constexpr Half_t NoScore = 0x7E00; ///< Score of hits not scored (NaN).
+
+    HitCNNScores() {} // default constructor
+    explicit HitCNNScores(std::size_t nHits): fScores(nHits * NClasses, NoScore) {}
+
+    /// Number of hits (scored or not) in the product.
+    std::size_t size() const { return fScores.size() / NClasses; }
+    bool empty() const { return fScores.empty(); }
+
+    /// Whether the hit with the given `key` has scores.
+    bool hasScores(Key_t key) const
+      { return key < size() && !isNaN(fScores[key * NClasses]); }
+
+    /// Score of the hit with the given `key` (NaN if not scored).
+    float score(Key_t key, Class c) const { return toFloat(fScores[key * NClasses + c]); }
+
+    /// All the scores of the hit with the given `key`.
+    Scores_t scores(Key_t key) const;
+
+    /// Stores the scores of the hit with the given `key`, extending the
+    /// product as needed.
+    void setScores(Key_t key, Scores_t const& scores);
+
+    /// Scores of all hits, `NClasses` per hit, in half precision.
+    std::vector<Half_t> const& data() const { return fScores; }
+
+    /// Returns `value` in half precision, rounded to the nearest.
+    static Half_t toHalf(float value);
+
+    /// Returns the single precision value of the half precision `h`.
+    static float toFloat(Half_t h);
+
+    /// Whether the half precision `h` is NaN.
+    static bool isNaN(Half_t h) { return (h & 0x7FFFU) > 0x7C00U; }
+
+  private:
+    std::vector<Half_t> fScores; ///< Scores of all the hits, by key then class.
+
+  };
+
+
+  /**
+   * @brief Averages the hit scores of each PFP.
+   * @param scores CNN scores of the hits
+   * @param hitKeys keys of the hits of all the PFPs, one PFP after the other
+   * @param pfpOffsets first entry in `hitKeys` of each PFP, plus the end
+   * @return the score of each PFP, in the order of `pfpOffsets`
+   * @throw cet::exception if offsets or hit keys are out of range
+   *
+   * The hits of the PFP `i` have keys from `hitKeys[pfpOffsets[i]]` to
+   * `hitKeys[pfpOffsets[i + 1] - 1]`, as from an association PFP to hit sorted
+   * by PFP. Hits without scores are skipped; PFPs with no scored hits get
+   * NaN scores. `pfpEndMichelScore` and `nClusters` are not hit averages,
+   * and they are left to their default value.
+   */
+  std::vector<PFPCNNScore> makePFPCNNScores(
+    HitCNNScores const& scores,
+    std::vector<HitCNNScores::Key_t> const& hitKeys,
+    std::vector<std::size_t> const& pfpOffsets
+    );
+
+}
+
+//------------------------------------------------------------------------------
+inline float sbn::HitCNNScores::toFloat(Half_t h)
+{
+  // branchless, so that loops over many scores can be vectorized
+  std::uint32_t const sign = std::uint32_t(h & 0x8000U) << 16;
+  std::uint32_t const absBits = h & 0x7FFFU;
+  std::uint32_t bits = (absBits << 13) + ((127U - 15U) << 23); // rebias exponent
+  bits += (absBits >= 0x7C00U)? ((128U - 16U) << 23): 0U; // infinity and NaN
+  float normal;
+  std::memcpy(&normal, &bits, sizeof(normal));
+  float const subnormal = float(absBits) * 5.9604645e-8f; // 2^-24
+  float value = (absBits < 0x0400U)? subnormal: normal;
+  std::uint32_t valueBits;
+  std::memcpy(&valueBits, &value, sizeof(value));
+  valueBits |= sign;
+  std::memcpy(&value, &valueBits, sizeof(value));
+  return value;
+}
+
+#endif
@@ -4,22 +4,99 @@
 #include "messagefacility/MessageLogger/MessageLogger.h"
 
 #include <algorithm>
-#include <limits> // for std::numeric_limits
+#include <iterator>
 
 void sbn::MVAPID::AddScore(int pdg, float score)
 {
-  if (!mvaScoreMap.try_emplace(pdg, score).second)
-    throw cet::exception("MVAPID") << "Failed to add entry: " << pdg << " to MVA PID score map as it already exists" << std::endl;
+  AddScore(pdg, score, mvaScores, mvaScoreMask, mvaExtraPDG, mvaExtraScores, bestPDG, bestScore);
 }
 
-std::pair<int, float> sbn::MVAPID::BestIter() const
+void sbn::MVAPID::AddScore(int pdg, float score,
+  std::array<float, NHypotheses>& scores, unsigned char& scoreMask,
+  std::vector<int>& extraPDG, std::vector<float>& extraScores,
+  int& bestPDG, float& bestScore)
 {
-  auto iter = std::max_element(mvaScoreMap.begin(), mvaScoreMap.end(), [](auto const& lhs, auto const& rhs) { return lhs.second < rhs.second; });
+  bool const first = (scoreMask == 0) && extraPDG.empty();
+  int const slot = HypothesisSlot(pdg);
+  if (slot != NoSlot) {
+    if (scoreMask & (1U << slot))
+      throw cet::exception("MVAPID") << "Failed to add entry: " << pdg << " to MVA PID score map as it already exists" << std::endl;
+    scores[slot] = score;
+    scoreMask |= (1U << slot);
+  }
+  else {
+    if (std::find(extraPDG.begin(), extraPDG.end(), pdg) != extraPDG.end())
+      throw cet::exception("MVAPID") << "Failed to add entry: " << pdg << " to MVA PID score map as it already exists" << std::endl;
+    extraPDG.push_back(pdg);
+    extraScores.push_back(score);
+  }
 
-  if (iter == mvaScoreMap.end()) {
+  // the first (lowest PDG) of the hypotheses with the highest score wins
+  if (first || score > bestScore || (score == bestScore && pdg < bestPDG)) {
+    bestPDG = pdg;
+    bestScore = score;
+  }
+}
+
+void sbn::MVAPID::FillScores(std::map<int, float> const& scoreMap,
+  std::array<float, NHypotheses>& scores, unsigned char& scoreMask,
+  std::vector<int>& extraPDG, std::vector<float>& extraScores,
+  int& bestPDG, float& bestScore)
+{
+  scores.fill(0.f);
+  scoreMask = 0;
+  extraPDG.clear();
+  extraScores.clear();
+  bestPDG = -1;
+  bestScore = std::numeric_limits<float>::lowest();
+  for (auto const& [pdg, score]: scoreMap)
+    AddScore(pdg, score, scores, scoreMask, extraPDG, extraScores, bestPDG, bestScore);
+}
+
+bool sbn::MVAPID::HasScore(int pdg) const
+{
+  int const slot = HypothesisSlot(pdg);
+  if (slot != NoSlot) return mvaScoreMask & (1U << slot);
+  return std::find(mvaExtraPDG.begin(), mvaExtraPDG.end(), pdg) != mvaExtraPDG.end();
+}
+
+float sbn::MVAPID::Score(int pdg) const
+{
+  int const slot = HypothesisSlot(pdg);
+  if (slot != NoSlot) {
+    if (mvaScoreMask & (1U << slot)) return mvaScores[slot];
+  }
+  else {
+    auto const it = std::find(mvaExtraPDG.begin(), mvaExtraPDG.end(), pdg);
+    if (it != mvaExtraPDG.end()) return mvaExtraScores[std::distance(mvaExtraPDG.begin(), it)];
+  }
+  throw cet::exception("MVAPID") << "No MVA PID score for hypothesis " << pdg << std::endl;
+}
+
+std::size_t sbn::MVAPID::NScores() const
+{
+  std::size_t n = mvaExtraPDG.size();
+  for (std::size_t slot = 0; slot < NHypotheses; ++slot)
+    if (mvaScoreMask & (1U << slot)) ++n;
+  return n;
+}
+
+std::map<int, float> sbn::MVAPID::ScoreMap() const
+{
+  std::map<int, float> scoreMap;
+  for (std::size_t slot = 0; slot < NHypotheses; ++slot)
+    if (mvaScoreMask & (1U << slot)) scoreMap.emplace(HypothesisPDG[slot], mvaScores[slot]);
+  for (std::size_t i = 0; i < mvaExtraPDG.size(); ++i)
+    scoreMap.emplace(mvaExtraPDG[i], mvaExtraScores[i]);
+  return scoreMap;
+}
+
+std::pair<int, float> sbn::MVAPID::BestIter() const
+{
+  if (mvaScoreMask == 0 && mvaExtraPDG.empty()) {
     mf::LogError("MVAPID") << "Failed to find max element in map" << std::endl;
     return {-1, std::numeric_limits<float>::lowest()};
   }
 
-  return *iter;
+  return {bestPDG, bestScore};
 }
@@ -3,20 +3,71 @@
 #ifndef sbncode_MVAPID_H
 #define sbncode_MVAPID_H
 
+#include <array>
+#include <cstddef>
+#include <limits>
 #include <map>
+#include <utility>
+#include <vector>
 
 namespace sbn {
 class MVAPID {
   public:
   MVAPID() {}
 
-  std::map<int, float> mvaScoreMap; // MVA Scores: Key is PDG of hypothesis and value is the MVA score
+  // Hypotheses with a fixed score slot, in ascending PDG order ("other" is 0)
+  static constexpr std::size_t NHypotheses = 6;
+  static constexpr std::array<int, NHypotheses> HypothesisPDG { 0, 11, 13, 22, 211, 2212 };
+  static constexpr int NoSlot = -1;
 
-  void AddScore(int pdg, float score); // Add a new score to the map
+  // Returns the score slot of the PDG hypothesis, NoSlot if it does not have one
+  static constexpr int HypothesisSlot(int pdg)
+  {
+    switch (pdg) {
+      case 0:    return 0;
+      case 11:   return 1;
+      case 13:   return 2;
+      case 22:   return 3;
+      case 211:  return 4;
+      case 2212: return 5;
+      default:   return NoSlot;
+    }
+  }
 
-  std::pair<int, float> BestIter() const;                             // Returns the map iterator with the highest score
+  void AddScore(int pdg, float score); // Add a new score; throws if the hypothesis already has one
+
+  bool HasScore(int pdg) const; // Whether the hypothesis has a score
+  float Score(int pdg) const;   // The score of the hypothesis; throws if it has none
+  std::size_t NScores() const;  // Number of hypotheses with a score
+  std::map<int, float> ScoreMap() const; // All scores, keyed by PDG of hypothesis
+
+  // Replacement of the public `mvaScoreMap` data member of version 11 and earlier:
+  // code reading `pid.mvaScoreMap` needs to change into `pid.mvaScoreMap()`;
+  // the returned map is a copy, use AddScore() to add scores
+  inline std::map<int, float> mvaScoreMap() const { return ScoreMap(); }
+
+  std::pair<int, float> BestIter() const;                             // Returns the hypothesis with the highest score and its score
   inline int BestPDG() const { return this->BestIter().first; };      // Returns the hypothesis with the highest score
   inline float BestScore() const { return this->BestIter().second; }; // Returns the highest score from any hypothesis
+
+  // Fills the storage from the scores keyed by PDG (used to read the old map form)
+  static void FillScores(std::map<int, float> const& scoreMap,
+    std::array<float, NHypotheses>& scores, unsigned char& scoreMask,
+    std::vector<int>& extraPDG, std::vector<float>& extraScores,
+    int& bestPDG, float& bestScore);
+
+  private:
+  std::array<float, NHypotheses> mvaScores {}; // MVA scores of the hypotheses with a slot
+  unsigned char mvaScoreMask = 0;              // Bit `slot` set if that slot has a score
+  std::vector<int> mvaExtraPDG;                // Hypotheses without a slot...
+  std::vector<float> mvaExtraScores;           // ... and their scores
+  int bestPDG = -1;                            // Cached hypothesis with the highest score
+  float bestScore = std::numeric_limits<float>::lowest(); // Cached highest score
+
+  static void AddScore(int pdg, float score,
+    std::array<float, NHypotheses>& scores, unsigned char& scoreMask,
+    std::vector<int>& extraPDG, std::vector<float>& extraScores,
+    int& bestPDG, float& bestScore);
 };
 }
 
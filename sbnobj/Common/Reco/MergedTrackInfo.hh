@@ -1,15 +1,26 @@
 #ifndef sbncode_MergedTrack_HH
 #define sbncode_MergedTrack_HH
 
+#include "sbnobj/Common/Reco/Vector3F.h"
+
 #include "TVector3.h"
 
 namespace sbn {
+  /// Plain data: `vertex` and `direction` were `TVector3` up to class
+  /// version 11. Code using the `TVector3` interface on them (`Unit()`,
+  /// `Angle()`, ...) needs to go through `toTVector3()`, and code filling
+  /// them from a `TVector3` through `toVector3F()`.
   class MergedTrackInfo {
   public:
+    static sbn::Vector3F toVector3F(TVector3 const& v)
+      { return { float(v.X()), float(v.Y()), float(v.Z()) }; }
+    static TVector3 toTVector3(sbn::Vector3F const& v)
+      { return { v.x, v.y, v.z }; }
+
     // std::array<bool, 3> trunk_wire_direction_is_ascending;
     // std::array<int, 3> branch_wire_start;
-    TVector3 vertex;
-    TVector3 direction;
+    sbn::Vector3F vertex;
+    sbn::Vector3F direction;
     int trunk;
     int branch;
     float branch_overlap;
@@ -0,0 +1,61 @@
+#include "sbnobj/Common/Reco/OpT0FinderSparse.h"
+
+#include "cetlib_except/exception.h"
+
+#include <algorithm>
+#include <limits>
+
+sbn::OpT0FinderSparse::OpT0FinderSparse(OpT0Finder const& result)
+  : tpc(result.tpc)
+  , time(result.time)
+  , score(result.score)
+  , measPE(result.measPE)
+  , hypoPE(result.hypoPE)
+{
+  std::size_t const n
+    = std::max({ result.measPESpec.size(), result.hypoPESpec.size(), result.opch.size() });
+  if (n > std::numeric_limits<std::uint16_t>::max() + std::size_t(1)) {
+    throw cet::exception("OpT0FinderSparse")
+      << "Too many optical channels (" << n << ") for the sparse form.\n";
+  }
+  nChannels = n;
+
+  opchMask.assign((n + 63) / 64, 0);
+  for (std::size_t c = 0; c < result.opch.size(); ++c)
+    if (result.opch[c]) opchMask[c / 64] |= (std::uint64_t{ 1 } << (c % 64));
+
+  for (std::size_t c = 0; c < n; ++c) {
+    double const meas = (c < result.measPESpec.size())? result.measPESpec[c]: 0.;
+    double const hypo = (c < result.hypoPESpec.size())? result.hypoPESpec[c]: 0.;
+    if (meas == 0. && hypo == 0.) continue;
+    channels.push_back(c);
+    measPESparse.push_back(meas);
+    hypoPESparse.push_back(hypo);
+  }
+}
+
+unsigned int sbn::OpT0FinderSparse::nUsedChannels() const
+{
+  unsigned int n = 0;
+  for (std::uint64_t word: opchMask) n += __builtin_popcountll(word);
+  return n;
+}
+
+std::vector<int> sbn::OpT0FinderSparse::opch() const
+{
+  std::vector<int> used(nChannels, 0);
+  for (unsigned int c = 0; c < nChannels; ++c) used[c] = usedChannel(c);
+  return used;
+}
+
+std::vector<double> sbn::OpT0FinderSparse::expand(std::vector<float> const& sparse) const
+{
+  std::vector<double> full(nChannels, 0.);
+  for (std::size_t i = 0; i < channels.size(); ++i) full[channels[i]] = sparse[i];
+  return full;
+}
+
+sbn::OpT0Finder sbn::OpT0FinderSparse::toOpT0Finder() const
+{
+  return { tpc, time, score, measPE, hypoPE, measPESpec(), hypoPESpec(), opch() };
+}
@@ -0,0 +1,56 @@
+#ifndef sbnobj_OpT0FinderSparse_H
+#define sbnobj_OpT0FinderSparse_H
+
+#include "sbnobj/Common/Reco/OpT0FinderResult.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace sbn
+{
+  /**
+   * @brief `OpT0Finder` with the per-channel information stored sparsely.
+   *
+   * Only the channels where either the measured or the hypothesis PE is not
+   * zero are stored, their PE in single precision; the channels used for the
+   * matching (`OpT0Finder::opch`) are stored as a bit mask.
+   * The full-length per-channel vectors are rebuilt on demand.
+   */
+  class OpT0FinderSparse
+  {
+  public:
+
+    int    tpc = -1;     // tpc that the matching was performed in
+    double time = 0.;    // flash-matched t0
+    double score = 0.;   // OpT0 score of the match; is the reciprocal of the LLH score or chi-squared score
+    double measPE = 0.;  // total PE of the measured flash
+    double hypoPE = 0.;  // total PE of the hypothetical flash
+
+    unsigned int               nChannels = 0;  // number of channels of the full-length vectors
+    std::vector<std::uint64_t> opchMask;       // bit `c % 64` of word `c / 64` set if channel `c` was used for the matching
+    std::vector<std::uint16_t> channels;       // channels with non-zero measured or hypothesis PE, ascending
+    std::vector<float>         measPESparse;   // measured PE of each of the `channels`
+    std::vector<float>         hypoPESparse;   // hypothesis PE of each of the `channels`
+
+    OpT0FinderSparse() {} // default constructor
+    explicit OpT0FinderSparse(OpT0Finder const& result);
+
+    bool usedChannel(unsigned int c) const  // whether channel `c` was used for the matching
+      { return c < nChannels && ((opchMask[c / 64] >> (c % 64)) & 1U); }
+    unsigned int nUsedChannels() const;
+
+    // full-length vectors, as in `OpT0Finder`
+    std::vector<double> measPESpec() const { return expand(measPESparse); }
+    std::vector<double> hypoPESpec() const { return expand(hypoPESparse); }
+    std::vector<int>    opch() const;
+
+    OpT0Finder toOpT0Finder() const; // returns a copy in the full-length form
+
+  private:
+    std::vector<double> expand(std::vector<float> const& sparse) const;
+
+  };
+}
+
+#endif
@@ -0,0 +1,374 @@
+#include "sbnobj/Common/Reco/ScoreTable.h"
+
+#include <algorithm>
+#include <iterator>
+
+
+std::size_t sbn::ScoreTable::row(Key_t key) const
+{
+  auto const it = std::lower_bound(fKeys.begin(), fKeys.end(), key);
+  return (it != fKeys.end() && *it == key)? std::distance(fKeys.begin(), it): NoRow;
+}
+
+
+void sbn::ScoreTable::reserve(std::size_t n)
+{
+  fKeys.reserve(n);
+  fSources.reserve(n);
+  for (std::vector<float>& column: fFloatColumns) column.reserve(n);
+  for (std::vector<int>& column: fIntColumns) column.reserve(n);
+}
+
+
+std::size_t sbn::ScoreTable::findOrAddRow(Key_t key)
+{
+  // objects are usually filled in key order: check the last row first
+  if (!fKeys.empty() && fKeys.back() == key) return fKeys.size() - 1;
+
+  auto const it = std::lower_bound(fKeys.begin(), fKeys.end(), key);
+  std::size_t const row = std::distance(fKeys.begin(), it);
+  if (it != fKeys.end() && *it == key) return row;
+
+  fKeys.insert(it, key);
+  fSources.insert(fSources.begin() + row, 0);
+  for (std::vector<float>& column: fFloatColumns) column.insert(column.begin() + row, NoFloat);
+  for (std::vector<int>& column: fIntColumns) column.insert(column.begin() + row, NoInt);
+  return row;
+}
+
+
+// -----------------------------------------------------------------------------
+void sbn::SliceScoreTable::setCRUMBS(Key_t key, CRUMBSResult const& r)
+{
+  std::size_t const row = findOrAddRow(key);
+  setFloat(kCRUMBS_score, row, r.score);
+  setFloat(kCRUMBS_ccnumuscore, row, r.ccnumuscore);
+  setFloat(kCRUMBS_ccnuescore, row, r.ccnuescore);
+  setFloat(kCRUMBS_ncscore, row, r.ncscore);
+  setFloat(kCRUMBS_bestscore, row, r.bestscore);
+  setInt(kCRUMBS_bestid, row, r.bestid);
+  setFloat(kCRUMBS_tpc_CRFracHitsInLongestTrack, row, r.tpc_CRFracHitsInLongestTrack);
+  setFloat(kCRUMBS_tpc_CRLongestTrackDeflection, row, r.tpc_CRLongestTrackDeflection);
+  setFloat(kCRUMBS_tpc_CRLongestTrackDirY, row, r.tpc_CRLongestTrackDirY);
+  setInt(kCRUMBS_tpc_CRNHitsMax, row, r.tpc_CRNHitsMax);
+  setFloat(kCRUMBS_tpc_NuEigenRatioInSphere, row, r.tpc_NuEigenRatioInSphere);
+  setInt(kCRUMBS_tpc_NuNFinalStatePfos, row, r.tpc_NuNFinalStatePfos);
+  setInt(kCRUMBS_tpc_NuNHitsTotal, row, r.tpc_NuNHitsTotal);
+  setInt(kCRUMBS_tpc_NuNSpacePointsInSphere, row, r.tpc_NuNSpacePointsInSphere);
+  setFloat(kCRUMBS_tpc_NuVertexY, row, r.tpc_NuVertexY);
+  setFloat(kCRUMBS_tpc_NuWeightedDirZ, row, r.tpc_NuWeightedDirZ);
+  setFloat(kCRUMBS_tpc_StoppingChi2CosmicRatio, row, r.tpc_StoppingChi2CosmicRatio);
+  setFloat(kCRUMBS_pds_FMTotalScore, row, r.pds_FMTotalScore);
+  setFloat(kCRUMBS_pds_FMPE, row, r.pds_FMPE);
+  setFloat(kCRUMBS_pds_FMTime, row, r.pds_FMTime);
+  setFloat(kCRUMBS_pds_OpT0Score, row, r.pds_OpT0Score);
+  setFloat(kCRUMBS_pds_OpT0MeasuredPE, row, r.pds_OpT0MeasuredPE);
+  setFloat(kCRUMBS_crt_TrackScore, row, r.crt_TrackScore);
+  setFloat(kCRUMBS_crt_SPScore, row, r.crt_SPScore);
+  setFloat(kCRUMBS_crt_TrackTime, row, r.crt_TrackTime);
+  setFloat(kCRUMBS_crt_SPTime, row, r.crt_SPTime);
+  markSource(row, kCRUMBS);
+}
+
+
+sbn::CRUMBSResult sbn::SliceScoreTable::crumbs(std::size_t row) const
+{
+  CRUMBSResult r{};
+  if (!hasSource(row, kCRUMBS)) return r;
+  r.score = floatValue(kCRUMBS_score, row);
+  r.ccnumuscore = floatValue(kCRUMBS_ccnumuscore, row);
+  r.ccnuescore = floatValue(kCRUMBS_ccnuescore, row);
+  r.ncscore = floatValue(kCRUMBS_ncscore, row);
+  r.bestscore = floatValue(kCRUMBS_bestscore, row);
+  r.bestid = intValue(kCRUMBS_bestid, row);
+  r.tpc_CRFracHitsInLongestTrack = floatValue(kCRUMBS_tpc_CRFracHitsInLongestTrack, row);
+  r.tpc_CRLongestTrackDeflection = floatValue(kCRUMBS_tpc_CRLongestTrackDeflection, row);
+  r.tpc_CRLongestTrackDirY = floatValue(kCRUMBS_tpc_CRLongestTrackDirY, row);
+  r.tpc_CRNHitsMax = intValue(kCRUMBS_tpc_CRNHitsMax, row);
+  r.tpc_NuEigenRatioInSphere = floatValue(kCRUMBS_tpc_NuEigenRatioInSphere, row);
+  r.tpc_NuNFinalStatePfos = intValue(kCRUMBS_tpc_NuNFinalStatePfos, row);
+  r.tpc_NuNHitsTotal = intValue(kCRUMBS_tpc_NuNHitsTotal, row);
+  r.tpc_NuNSpacePointsInSphere = intValue(kCRUMBS_tpc_NuNSpacePointsInSphere, row);
+  r.tpc_NuVertexY = floatValue(kCRUMBS_tpc_NuVertexY, row);
+  r.tpc_NuWeightedDirZ = floatValue(kCRUMBS_tpc_NuWeightedDirZ, row);
+  r.tpc_StoppingChi2CosmicRatio = floatValue(kCRUMBS_tpc_StoppingChi2CosmicRatio, row);
+  r.pds_FMTotalScore = floatValue(kCRUMBS_pds_FMTotalScore, row);
+  r.pds_FMPE = floatValue(kCRUMBS_pds_FMPE, row);
+  r.pds_FMTime = floatValue(kCRUMBS_pds_FMTime, row);
+  r.pds_OpT0Score = floatValue(kCRUMBS_pds_OpT0Score, row);
+  r.pds_OpT0MeasuredPE = floatValue(kCRUMBS_pds_OpT0MeasuredPE, row);
+  r.crt_TrackScore = floatValue(kCRUMBS_crt_TrackScore, row);
+  r.crt_SPScore = floatValue(kCRUMBS_crt_SPScore, row);
+  r.crt_TrackTime = floatValue(kCRUMBS_crt_TrackTime, row);
+  r.crt_SPTime = floatValue(kCRUMBS_crt_SPTime, row);
+  return r;
+}
+
+
+void sbn::SliceScoreTable::setSimpleFlashMatch(Key_t key, SimpleFlashMatch const& m)
+{
+  std::size_t const row = findOrAddRow(key);
+  setInt(kSimpleFlashMatch_present, row, m.present);
+  setFloat(kSimpleFlashMatch_time, row, m.time);
+  setFloat(kSimpleFlashMatch_chargeQ, row, m.charge.q);
+  setFloat(kSimpleFlashMatch_chargeCenterX, row, m.charge.center.X());
+  setFloat(kSimpleFlashMatch_chargeCenterY, row, m.charge.center.Y());
+  setFloat(kSimpleFlashMatch_chargeCenterZ, row, m.charge.center.Z());
+  setFloat(kSimpleFlashMatch_chargeWidthX, row, m.charge.width.X());
+  setFloat(kSimpleFlashMatch_chargeWidthY, row, m.charge.width.Y());
+  setFloat(kSimpleFlashMatch_chargeWidthZ, row, m.charge.width.Z());
+  setFloat(kSimpleFlashMatch_lightPE, row, m.light.pe);
+  setFloat(kSimpleFlashMatch_lightCenterX, row, m.light.center.X());
+  setFloat(kSimpleFlashMatch_lightCenterY, row, m.light.center.Y());
+  setFloat(kSimpleFlashMatch_lightCenterZ, row, m.light.center.Z());
+  setFloat(kSimpleFlashMatch_lightWidthX, row, m.light.width.X());
+  setFloat(kSimpleFlashMatch_lightWidthY, row, m.light.width.Y());
+  setFloat(kSimpleFlashMatch_lightWidthZ, row, m.light.width.Z());
+  setFloat(kSimpleFlashMatch_score_total, row, m.score.total);
+  setFloat(kSimpleFlashMatch_score_y, row, m.score.y);
+  setFloat(kSimpleFlashMatch_score_z, row, m.score.z);
+  setFloat(kSimpleFlashMatch_score_rr, row, m.score.rr);
+  setFloat(kSimpleFlashMatch_score_ratio, row, m.score.ratio);
+  setFloat(kSimpleFlashMatch_score_slope, row, m.score.slope);
+  setFloat(kSimpleFlashMatch_score_petoq, row, m.score.petoq);
+  markSource(row, kSimpleFlashMatch);
+}
+
+
+sbn::SimpleFlashMatch sbn::SliceScoreTable::simpleFlashMatch(std::size_t row) const
+{
+  SimpleFlashMatch m{};
+  if (!hasSource(row, kSimpleFlashMatch)) return m;
+  m.present = intValue(kSimpleFlashMatch_present, row);
+  m.time = floatValue(kSimpleFlashMatch_time, row);
+  m.charge.q = floatValue(kSimpleFlashMatch_chargeQ, row);
+  m.charge.center = sbn::Vector3F{
+    floatValue(kSimpleFlashMatch_chargeCenterX, row),
+    floatValue(kSimpleFlashMatch_chargeCenterY, row),
+    floatValue(kSimpleFlashMatch_chargeCenterZ, row)
+    };
+  m.charge.width = sbn::Vector3F{
+    floatValue(kSimpleFlashMatch_chargeWidthX, row),
+    floatValue(kSimpleFlashMatch_chargeWidthY, row),
+    floatValue(kSimpleFlashMatch_chargeWidthZ, row)
+    };
+  m.light.pe = floatValue(kSimpleFlashMatch_lightPE, row);
+  m.light.center = sbn::Vector3F{
+    floatValue(kSimpleFlashMatch_lightCenterX, row),
+    floatValue(kSimpleFlashMatch_lightCenterY, row),
+    floatValue(kSimpleFlashMatch_lightCenterZ, row)
+    };
+  m.light.width = sbn::Vector3F{
+    floatValue(kSimpleFlashMatch_lightWidthX, row),
+    floatValue(kSimpleFlashMatch_lightWidthY, row),
+    floatValue(kSimpleFlashMatch_lightWidthZ, row)
+    };
+  m.score.total = floatValue(kSimpleFlashMatch_score_total, row);
+  m.score.y = floatValue(kSimpleFlashMatch_score_y, row);
+  m.score.z = floatValue(kSimpleFlashMatch_score_z, row);
+  m.score.rr = floatValue(kSimpleFlashMatch_score_rr, row);
+  m.score.ratio = floatValue(kSimpleFlashMatch_score_ratio, row);
+  m.score.slope = floatValue(kSimpleFlashMatch_score_slope, row);
+  m.score.petoq = floatValue(kSimpleFlashMatch_score_petoq, row);
+  return m;
+}
+
+
+void sbn::SliceScoreTable::setBarycenter(Key_t key, TPCPMTBarycenterMatch const& b)
+{
+  std::size_t const row = findOrAddRow(key);
+  setFloat(kBarycenter_chargeTotal, row, b.chargeTotal);
+  setFloat(kBarycenter_chargeCenterXLocal, row, b.chargeCenterXLocal);
+  setFloat(kBarycenter_chargeCenterX, row, b.chargeCenter.X());
+  setFloat(kBarycenter_chargeCenterY, row, b.chargeCenter.Y());
+  setFloat(kBarycenter_chargeCenterZ, row, b.chargeCenter.Z());
+  setFloat(kBarycenter_chargeWidthX, row, b.chargeWidth.X());
+  setFloat(kBarycenter_chargeWidthY, row, b.chargeWidth.Y());
+  setFloat(kBarycenter_chargeWidthZ, row, b.chargeWidth.Z());
+  setFloat(kBarycenter_flashTime, row, b.flashTime);
+  setFloat(kBarycenter_flashFirstHit, row, b.flashFirstHit);
+  setFloat(kBarycenter_flashPEs, row, b.flashPEs);
+  setFloat(kBarycenter_flashAsymmetry, row, b.flashAsymmetry);
+  setFloat(kBarycenter_flashCenterX, row, b.flashCenter.X());
+  setFloat(kBarycenter_flashCenterY, row, b.flashCenter.Y());
+  setFloat(kBarycenter_flashCenterZ, row, b.flashCenter.Z());
+  setFloat(kBarycenter_flashWidthX, row, b.flashWidth.X());
+  setFloat(kBarycenter_flashWidthY, row, b.flashWidth.Y());
+  setFloat(kBarycenter_flashWidthZ, row, b.flashWidth.Z());
+  setFloat(kBarycenter_deltaY, row, b.deltaY);
+  setFloat(kBarycenter_deltaZ, row, b.deltaZ);
+  setFloat(kBarycenter_radius, row, b.radius);
+  setFloat(kBarycenter_deltaT, row, b.deltaT);
+  setFloat(kBarycenter_overlapY, row, b.overlapY);
+  setFloat(kBarycenter_overlapZ, row, b.overlapZ);
+  setFloat(kBarycenter_deltaZ_Trigger, row, b.deltaZ_Trigger);
+  setFloat(kBarycenter_deltaY_Trigger, row, b.deltaY_Trigger);
+  setFloat(kBarycenter_radius_Trigger, row, b.radius_Trigger);
+  markSource(row, kBarycenter);
+}
+
+
+sbn::TPCPMTBarycenterMatch sbn::SliceScoreTable::barycenterMatch(std::size_t row) const
+{
+  TPCPMTBarycenterMatch b{};
+  if (!hasSource(row, kBarycenter)) return b;
+  b.chargeTotal = floatValue(kBarycenter_chargeTotal, row);
+  b.chargeCenterXLocal = floatValue(kBarycenter_chargeCenterXLocal, row);
+  b.chargeCenter.SetX(floatValue(kBarycenter_chargeCenterX, row));
+  b.chargeCenter.SetY(floatValue(kBarycenter_chargeCenterY, row));
+  b.chargeCenter.SetZ(floatValue(kBarycenter_chargeCenterZ, row));
+  b.chargeWidth.SetX(floatValue(kBarycenter_chargeWidthX, row));
+  b.chargeWidth.SetY(floatValue(kBarycenter_chargeWidthY, row));
+  b.chargeWidth.SetZ(floatValue(kBarycenter_chargeWidthZ, row));
+  b.flashTime = floatValue(kBarycenter_flashTime, row);
+  b.flashFirstHit = floatValue(kBarycenter_flashFirstHit, row);
+  b.flashPEs = floatValue(kBarycenter_flashPEs, row);
+  b.flashAsymmetry = floatValue(kBarycenter_flashAsymmetry, row);
+  b.flashCenter.SetX(floatValue(kBarycenter_flashCenterX, row));
+  b.flashCenter.SetY(floatValue(kBarycenter_flashCenterY, row));
+  b.flashCenter.SetZ(floatValue(kBarycenter_flashCenterZ, row));
+  b.flashWidth.SetX(floatValue(kBarycenter_flashWidthX, row));
+  b.flashWidth.SetY(floatValue(kBarycenter_flashWidthY, row));
+  b.flashWidth.SetZ(floatValue(kBarycenter_flashWidthZ, row));
+  b.deltaY = floatValue(kBarycenter_deltaY, row);
+  b.deltaZ = floatValue(kBarycenter_deltaZ, row);
+  b.radius = floatValue(kBarycenter_radius, row);
+  b.deltaT = floatValue(kBarycenter_deltaT, row);
+  b.overlapY = floatValue(kBarycenter_overlapY, row);
+  b.overlapZ = floatValue(kBarycenter_overlapZ, row);
+  b.deltaZ_Trigger = floatValue(kBarycenter_deltaZ_Trigger, row);
+  b.deltaY_Trigger = floatValue(kBarycenter_deltaY_Trigger, row);
+  b.radius_Trigger = floatValue(kBarycenter_radius_Trigger, row);
+  return b;
+}
+
+
+
+// -----------------------------------------------------------------------------
+void sbn::PFPScoreTable::setCNNScore(Key_t key, PFPCNNScore const& s)
+{
+  std::size_t const row = findOrAddRow(key);
+  setFloat(kCNNScore_pfpTrackScore, row, s.pfpTrackScore);
+  setFloat(kCNNScore_pfpShowerScore, row, s.pfpShowerScore);
+  setFloat(kCNNScore_pfpNoiseScore, row, s.pfpNoiseScore);
+  setFloat(kCNNScore_pfpMichelScore, row, s.pfpMichelScore);
+  setFloat(kCNNScore_pfpEndMichelScore, row, s.pfpEndMichelScore);
+  setInt(kCNNScore_nClusters, row, s.nClusters);
+  markSource(row, kCNNScore);
+}
+
+
+sbn::PFPCNNScore sbn::PFPScoreTable::cnnScore(std::size_t row) const
+{
+  PFPCNNScore s{};
+  if (!hasSource(row, kCNNScore)) return s;
+  s.pfpTrackScore = floatValue(kCNNScore_pfpTrackScore, row);
+  s.pfpShowerScore = floatValue(kCNNScore_pfpShowerScore, row);
+  s.pfpNoiseScore = floatValue(kCNNScore_pfpNoiseScore, row);
+  s.pfpMichelScore = floatValue(kCNNScore_pfpMichelScore, row);
+  s.pfpEndMichelScore = floatValue(kCNNScore_pfpEndMichelScore, row);
+  s.nClusters = intValue(kCNNScore_nClusters, row);
+  return s;
+}
+
+
+void sbn::PFPScoreTable::setStoppingChi2Fit(Key_t key, StoppingChi2Fit const& f)
+{
+  std::size_t const row = findOrAddRow(key);
+  setFloat(kStoppingChi2Fit_pol0Chi2, row, f.pol0Chi2);
+  setFloat(kStoppingChi2Fit_expChi2, row, f.expChi2);
+  setFloat(kStoppingChi2Fit_pol0Fit, row, f.pol0Fit);
+  markSource(row, kStoppingChi2Fit);
+}
+
+
+sbn::StoppingChi2Fit sbn::PFPScoreTable::stoppingChi2Fit(std::size_t row) const
+{
+  StoppingChi2Fit f{};
+  if (!hasSource(row, kStoppingChi2Fit)) return f;
+  f.pol0Chi2 = floatValue(kStoppingChi2Fit_pol0Chi2, row);
+  f.expChi2 = floatValue(kStoppingChi2Fit_expChi2, row);
+  f.pol0Fit = floatValue(kStoppingChi2Fit_pol0Fit, row);
+  return f;
+}
+
+
+void sbn::PFPScoreTable::setScatterClosestApproach(Key_t key, ScatterClosestApproach const& c)
+{
+  std::size_t const row = findOrAddRow(key);
+  setFloat(kScatterClosestApproach_mean, row, c.mean);
+  setFloat(kScatterClosestApproach_stdDev, row, c.stdDev);
+  setFloat(kScatterClosestApproach_max, row, c.max);
+  markSource(row, kScatterClosestApproach);
+}
+
+
+sbn::ScatterClosestApproach sbn::PFPScoreTable::scatterClosestApproach(std::size_t row) const
+{
+  ScatterClosestApproach c{};
+  if (!hasSource(row, kScatterClosestApproach)) return c;
+  c.mean = floatValue(kScatterClosestApproach_mean, row);
+  c.stdDev = floatValue(kScatterClosestApproach_stdDev, row);
+  c.max = floatValue(kScatterClosestApproach_max, row);
+  return c;
+}
+
+
+void sbn::PFPScoreTable::setShowerDensityFit(Key_t key, ShowerDensityFit const& d)
+{
+  std::size_t const row = findOrAddRow(key);
+  setFloat(kShowerDensityFit_mDensityGrad, row, d.mDensityGrad);
+  setFloat(kShowerDensityFit_mDensityPow, row, d.mDensityPow);
+  markSource(row, kShowerDensityFit);
+}
+
+
+sbn::ShowerDensityFit sbn::PFPScoreTable::showerDensityFit(std::size_t row) const
+{
+  ShowerDensityFit d{};
+  if (!hasSource(row, kShowerDensityFit)) return d;
+  d.mDensityGrad = floatValue(kShowerDensityFit_mDensityGrad, row);
+  d.mDensityPow = floatValue(kShowerDensityFit_mDensityPow, row);
+  return d;
+}
+
+
+void sbn::PFPScoreTable::setShowerTrackFit(Key_t key, ShowerTrackFit const& t)
+{
+  std::size_t const row = findOrAddRow(key);
+  setFloat(kShowerTrackFit_mTrackLength, row, t.mTrackLength);
+  setFloat(kShowerTrackFit_mTrackWidth, row, t.mTrackWidth);
+  setInt(kShowerTrackFit_mNumHits, row, t.mNumHits);
+  markSource(row, kShowerTrackFit);
+}
+
+
+sbn::ShowerTrackFit sbn::PFPScoreTable::showerTrackFit(std::size_t row) const
+{
+  ShowerTrackFit t{};
+  if (!hasSource(row, kShowerTrackFit)) return t;
+  t.mTrackLength = floatValue(kShowerTrackFit_mTrackLength, row);
+  t.mTrackWidth = floatValue(kShowerTrackFit_mTrackWidth, row);
+  t.mNumHits = intValue(kShowerTrackFit_mNumHits, row);
+  return t;
+}
+
+
+void sbn::PFPScoreTable::setRangeP(Key_t key, RangeP const& p)
+{
+  std::size_t const row = findOrAddRow(key);
+  setFloat(kRangeP_range_p, row, p.range_p);
+  setInt(kRangeP_trackID, row, p.trackID);
+  markSource(row, kRangeP);
+}
+
+
+sbn::RangeP sbn::PFPScoreTable::rangeP(std::size_t row) const
+{
+  RangeP p{};
+  if (!hasSource(row, kRangeP)) return p;
+  p.range_p = floatValue(kRangeP_range_p, row);
+  p.trackID = intValue(kRangeP_trackID, row);
+  return p;
+}
+
@@ -0,0 +1,317 @@
+/**
+ * @file   sbnobj/Common/Reco/ScoreTable.h
+ * @brief  Columnar tables of the slice and PFP reconstruction scores
+ */
+
+#ifndef SBNOBJ_COMMON_RECO_SCORETABLE_H
+#define SBNOBJ_COMMON_RECO_SCORETABLE_H
+
+#include "sbnobj/Common/Reco/CRUMBSResult.h"
+#include "sbnobj/Common/Reco/CNNScore.h"
+#include "sbnobj/Common/Reco/RangeP.h"
+#include "sbnobj/Common/Reco/ScatterClosestApproach.h"
+#include "sbnobj/Common/Reco/ShowerSelectionVars.h"
+#include "sbnobj/Common/Reco/SimpleFlashMatchVars.h"
+#include "sbnobj/Common/Reco/StoppingChi2Fit.h"
+#include "sbnobj/Common/Reco/TPCPMTBarycenterMatch.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace sbn {
+
+  /**
+   * @brief Scores of many reconstructed objects, one column per score.
+   *
+   * Each row describes one object (slice or PFP), identified by the key
+   * (`art::Ptr::key()`) of the object in its data product; rows are kept
+   * sorted by key. A row holds a value for every column: the ones of sources
+   * which were not stored for that object hold `NoFloat` (NaN) or `NoInt`,
+   * and the bits of `sources()` tell which sources are present.
+   *
+   * The columns are defined by `SliceScoreTable` and `PFPScoreTable`.
+   */
+  class ScoreTable {
+
+  public:
+
+    using Key_t = std::size_t; ///< Type of key of the objects.
+
+    static constexpr std::size_t NoRow = std::numeric_limits<std::size_t>::max();
+    static constexpr float NoFloat = std::numeric_limits<float>::signaling_NaN();
+    static constexpr int NoInt = std::numeric_limits<int>::max();
+
+    /// Number of rows (objects) in the table.
+    std::size_t size() const { return fKeys.size(); }
+    bool empty() const { return fKeys.empty(); }
+
+    std::size_t nFloatColumns() const { return fFloatColumns.size(); }
+    std::size_t nIntColumns() const { return fIntColumns.size(); }
+
+    /// Keys of the objects in all rows, ascending.
+    std::vector<Key_t> const& keys() const { return fKeys; }
+    Key_t key(std::size_t row) const { return fKeys[row]; }
+
+    /// Row of the object with the given `key`, `NoRow` if not in the table.
+    std::size_t row(Key_t key) const;
+
+    /// Bit mask of the sources stored in `row`.
+    std::uint32_t sources(std::size_t row) const { return fSources[row]; }
+    bool hasSource(std::size_t row, unsigned source) const
+      { return (fSources[row] >> source) & 1U; }
+
+    float floatValue(unsigned column, std::size_t row) const { return fFloatColumns[column][row]; }
+    int intValue(unsigned column, std::size_t row) const { return fIntColumns[column][row]; }
+
+    std::vector<float> const& floatColumn(unsigned column) const { return fFloatColumns[column]; }
+    std::vector<int> const& intColumn(unsigned column) const { return fIntColumns[column]; }
+
+    /// Reserves room for `n` rows.
+    void reserve(std::size_t n);
+
+  protected:
+
+    ScoreTable() = default;
+    ScoreTable(std::size_t nFloatColumns, std::size_t nIntColumns)
+      : fFloatColumns(nFloatColumns), fIntColumns(nIntColumns) {}
+
+    /// Row of `key`, added with no value if not present yet.
+    std::size_t findOrAddRow(Key_t key);
+
+    void setFloat(unsigned column, std::size_t row, float value) { fFloatColumns[column][row] = value; }
+    void setInt(unsigned column, std::size_t row, int value) { fIntColumns[column][row] = value; }
+    void markSource(std::size_t row, unsigned source) { fSources[row] |= (1U << source); }
+
+  private:
+
+    std::vector<Key_t> fKeys; ///< Key of the object of each row.
+    std::vector<std::uint32_t> fSources; ///< Sources stored in each row.
+    std::vector<std::vector<float>> fFloatColumns; ///< Float scores, by column.
+    std::vector<std::vector<int>> fIntColumns; ///< Integral scores, by column.
+
+  };
+
+
+  /**
+   * @brief Scores of the slices of an event.
+   *
+   * Sources are `CRUMBSResult`, `SimpleFlashMatch` and
+   * `TPCPMTBarycenterMatch`. All scores are stored in single precision.
+   */
+  class SliceScoreTable: public ScoreTable {
+
+  public:
+
+    /// Float score columns.
+    enum FloatColumn: unsigned {
+      kCRUMBS_score,
+      kCRUMBS_ccnumuscore,
+      kCRUMBS_ccnuescore,
+      kCRUMBS_ncscore,
+      kCRUMBS_bestscore,
+      kCRUMBS_tpc_CRFracHitsInLongestTrack,
+      kCRUMBS_tpc_CRLongestTrackDeflection,
+      kCRUMBS_tpc_CRLongestTrackDirY,
+      kCRUMBS_tpc_NuEigenRatioInSphere,
+      kCRUMBS_tpc_NuVertexY,
+      kCRUMBS_tpc_NuWeightedDirZ,
+      kCRUMBS_tpc_StoppingChi2CosmicRatio,
+      kCRUMBS_pds_FMTotalScore,
+      kCRUMBS_pds_FMPE,
+      kCRUMBS_pds_FMTime,
+      kCRUMBS_pds_OpT0Score,
+      kCRUMBS_pds_OpT0MeasuredPE,
+      kCRUMBS_crt_TrackScore,
+      kCRUMBS_crt_SPScore,
+      kCRUMBS_crt_TrackTime,
+      kCRUMBS_crt_SPTime,
+      kSimpleFlashMatch_time,
+      kSimpleFlashMatch_chargeQ,
+      kSimpleFlashMatch_chargeCenterX,
+      kSimpleFlashMatch_chargeCenterY,
+      kSimpleFlashMatch_chargeCenterZ,
+      kSimpleFlashMatch_chargeWidthX,
+      kSimpleFlashMatch_chargeWidthY,
+      kSimpleFlashMatch_chargeWidthZ,
+      kSimpleFlashMatch_lightPE,
+      kSimpleFlashMatch_lightCenterX,
+      kSimpleFlashMatch_lightCenterY,
+      kSimpleFlashMatch_lightCenterZ,
+      kSimpleFlashMatch_lightWidthX,
+      kSimpleFlashMatch_lightWidthY,
+      kSimpleFlashMatch_lightWidthZ,
+      kSimpleFlashMatch_score_total,
+      kSimpleFlashMatch_score_y,
+      kSimpleFlashMatch_score_z,
+      kSimpleFlashMatch_score_rr,
+      kSimpleFlashMatch_score_ratio,
+      kSimpleFlashMatch_score_slope,
+      kSimpleFlashMatch_score_petoq,
+      kBarycenter_chargeTotal,
+      kBarycenter_chargeCenterXLocal,
+      kBarycenter_chargeCenterX,
+      kBarycenter_chargeCenterY,
+      kBarycenter_chargeCenterZ,
+      kBarycenter_chargeWidthX,
+      kBarycenter_chargeWidthY,
+      kBarycenter_chargeWidthZ,
+      kBarycenter_flashTime,
+      kBarycenter_flashFirstHit,
+      kBarycenter_flashPEs,
+      kBarycenter_flashAsymmetry,
+      kBarycenter_flashCenterX,
+      kBarycenter_flashCenterY,
+      kBarycenter_flashCenterZ,
+      kBarycenter_flashWidthX,
+      kBarycenter_flashWidthY,
+      kBarycenter_flashWidthZ,
+      kBarycenter_deltaY,
+      kBarycenter_deltaZ,
+      kBarycenter_radius,
+      kBarycenter_deltaT,
+      kBarycenter_overlapY,
+      kBarycenter_overlapZ,
+      kBarycenter_deltaZ_Trigger,
+      kBarycenter_deltaY_Trigger,
+      kBarycenter_radius_Trigger,
+      NFloatColumns
+    };
+
+    /// Integral score columns.
+    enum IntColumn: unsigned {
+      kCRUMBS_bestid,
+      kCRUMBS_tpc_CRNHitsMax,
+      kCRUMBS_tpc_NuNFinalStatePfos,
+      kCRUMBS_tpc_NuNHitsTotal,
+      kCRUMBS_tpc_NuNSpacePointsInSphere,
+      kSimpleFlashMatch_present,
+      NIntColumns
+    };
+
+    /// Sources of the scores, as bits of `sources()`.
+    enum Source: unsigned {
+      kCRUMBS = 0,
+      kSimpleFlashMatch,
+      kBarycenter,
+      NSources
+    };
+
+    SliceScoreTable(): ScoreTable(NFloatColumns, NIntColumns) {}
+
+    /// Stores the `CRUMBSResult` of the slice with the given `key`.
+    void setCRUMBS(Key_t key, CRUMBSResult const& r);
+
+    /// `CRUMBSResult` of `row` (default constructed if not stored).
+    CRUMBSResult crumbs(std::size_t row) const;
+
+    /// Stores the `SimpleFlashMatch` of the slice with the given `key`.
+    void setSimpleFlashMatch(Key_t key, SimpleFlashMatch const& m);
+
+    /// `SimpleFlashMatch` of `row` (default constructed if not stored).
+    SimpleFlashMatch simpleFlashMatch(std::size_t row) const;
+
+    /// Stores the `TPCPMTBarycenterMatch` of the slice with the given `key`.
+    void setBarycenter(Key_t key, TPCPMTBarycenterMatch const& b);
+
+    /// `TPCPMTBarycenterMatch` of `row` (default constructed if not stored).
+    TPCPMTBarycenterMatch barycenterMatch(std::size_t row) const;
+
+  };
+
+
+  /**
+   * @brief Scores of the PFParticles of an event.
+   *
+   * Sources are `PFPCNNScore`, `StoppingChi2Fit`, `ScatterClosestApproach`,
+   * `ShowerDensityFit`, `ShowerTrackFit` and `RangeP`. All scores are stored
+   * in single precision.
+   */
+  class PFPScoreTable: public ScoreTable {
+
+  public:
+
+    /// Float score columns.
+    enum FloatColumn: unsigned {
+      kCNNScore_pfpTrackScore,
+      kCNNScore_pfpShowerScore,
+      kCNNScore_pfpNoiseScore,
+      kCNNScore_pfpMichelScore,
+      kCNNScore_pfpEndMichelScore,
+      kStoppingChi2Fit_pol0Chi2,
+      kStoppingChi2Fit_expChi2,
+      kStoppingChi2Fit_pol0Fit,
+      kScatterClosestApproach_mean,
+      kScatterClosestApproach_stdDev,
+      kScatterClosestApproach_max,
+      kShowerDensityFit_mDensityGrad,
+      kShowerDensityFit_mDensityPow,
+      kShowerTrackFit_mTrackLength,
+      kShowerTrackFit_mTrackWidth,
+      kRangeP_range_p,
+      NFloatColumns
+    };
+
+    /// Integral score columns.
+    enum IntColumn: unsigned {
+      kCNNScore_nClusters,
+      kShowerTrackFit_mNumHits,
+      kRangeP_trackID,
+      NIntColumns
+    };
+
+    /// Sources of the scores, as bits of `sources()`.
+    enum Source: unsigned {
+      kCNNScore = 0,
+      kStoppingChi2Fit,
+      kScatterClosestApproach,
+      kShowerDensityFit,
+      kShowerTrackFit,
+      kRangeP,
+      NSources
+    };
+
+    PFPScoreTable(): ScoreTable(NFloatColumns, NIntColumns) {}
+
+    /// Stores the `PFPCNNScore` of the PFP with the given `key`.
+    void setCNNScore(Key_t key, PFPCNNScore const& s);
+
+    /// `PFPCNNScore` of `row` (default constructed if not stored).
+    PFPCNNScore cnnScore(std::size_t row) const;
+
+    /// Stores the `StoppingChi2Fit` of the PFP with the given `key`.
+    void setStoppingChi2Fit(Key_t key, StoppingChi2Fit const& f);
+
+    /// `StoppingChi2Fit` of `row` (default constructed if not stored).
+    StoppingChi2Fit stoppingChi2Fit(std::size_t row) const;
+
+    /// Stores the `ScatterClosestApproach` of the PFP with the given `key`.
+    void setScatterClosestApproach(Key_t key, ScatterClosestApproach const& c);
+
+    /// `ScatterClosestApproach` of `row` (default constructed if not stored).
+    ScatterClosestApproach scatterClosestApproach(std::size_t row) const;
+
+    /// Stores the `ShowerDensityFit` of the PFP with the given `key`.
+    void setShowerDensityFit(Key_t key, ShowerDensityFit const& d);
+
+    /// `ShowerDensityFit` of `row` (default constructed if not stored).
+    ShowerDensityFit showerDensityFit(std::size_t row) const;
+
+    /// Stores the `ShowerTrackFit` of the PFP with the given `key`.
+    void setShowerTrackFit(Key_t key, ShowerTrackFit const& t);
+
+    /// `ShowerTrackFit` of `row` (default constructed if not stored).
+    ShowerTrackFit showerTrackFit(std::size_t row) const;
+
+    /// Stores the `RangeP` of the PFP with the given `key`.
+    void setRangeP(Key_t key, RangeP const& p);
+
+    /// `RangeP` of `row` (default constructed if not stored).
+    RangeP rangeP(std::size_t row) const;
+
+  };
+
+} // namespace sbn
+
+#endif
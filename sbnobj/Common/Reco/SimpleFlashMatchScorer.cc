@@ -0,0 +1,146 @@
+#include "sbnobj/Common/Reco/SimpleFlashMatchScorer.h"
+
+#include "cetlib_except/exception.h"
+
+#include <cmath>
+#include <algorithm>
+
+namespace {
+
+  void setTerm(char const* name, std::size_t nBins,
+    sbn::SimpleFlashMatchScorer::TermParams const& params,
+    std::vector<float>& mean, std::vector<float>& invSpread)
+  {
+    if (params.mean.size() != nBins || params.spread.size() != nBins) {
+      throw cet::exception("SimpleFlashMatchScorer")
+        << "Term '" << name << "' has " << params.mean.size() << " means and "
+        << params.spread.size() << " spreads, " << nBins << " expected.\n";
+    }
+    mean = params.mean;
+    invSpread.resize(nBins);
+    for (std::size_t b = 0; b < nBins; ++b) {
+      if (!(params.spread[b] > 0.f)) {
+        throw cet::exception("SimpleFlashMatchScorer")
+          << "Term '" << name << "' has invalid spread " << params.spread[b]
+          << " in bin " << b << ".\n";
+      }
+      invSpread[b] = 1.f / params.spread[b];
+    }
+  }
+
+} // local namespace
+
+
+sbn::SimpleFlashMatch::Score sbn::SimpleFlashMatchScorer::Scores::score
+  (std::size_t slice, std::size_t flash) const
+{
+  std::size_t const i = index(slice, flash);
+  return { total[i], y[i], z[i], rr[i], ratio[i] };
+}
+
+
+std::size_t sbn::SimpleFlashMatchScorer::Scores::bestFlash(std::size_t slice) const
+{
+  std::size_t best = nFlashes;
+  for (std::size_t f = 0; f < nFlashes; ++f) {
+    if (best == nFlashes || total[index(slice, f)] < total[index(slice, best)])
+      best = f;
+  }
+  return best;
+}
+
+
+sbn::SimpleFlashMatchScorer::SimpleFlashMatchScorer(
+  float xMin, float xMax, std::size_t nBins,
+  TermParams y, TermParams z, TermParams rr, TermParams ratio)
+  : fXMin(xMin)
+  , fInvBinWidth(nBins / (xMax - xMin))
+  , fNBins(nBins)
+{
+  if (nBins == 0 || !(xMax > xMin)) {
+    throw cet::exception("SimpleFlashMatchScorer")
+      << "Invalid drift binning: " << nBins << " bins in [ " << xMin << " ; "
+      << xMax << " ].\n";
+  }
+  setTerm("y", nBins, y, fMeanY, fInvSpreadY);
+  setTerm("z", nBins, z, fMeanZ, fInvSpreadZ);
+  setTerm("rr", nBins, rr, fMeanRR, fInvSpreadRR);
+  setTerm("ratio", nBins, ratio, fMeanRatio, fInvSpreadRatio);
+}
+
+
+std::size_t sbn::SimpleFlashMatchScorer::bin(float x) const
+{
+  float const b = (x - fXMin) * fInvBinWidth;
+  if (!(b > 0.f)) return 0; // also NaN
+  return std::min(static_cast<std::size_t>(b), fNBins - 1);
+}
+
+
+void sbn::SimpleFlashMatchScorer::score(std::size_t nSlices, float const* q,
+  float const* chargeX, float const* chargeY, float const* chargeZ,
+  std::size_t nFlashes, float const* pe,
+  float const* flashY, float const* flashZ,
+  Scores& scores) const
+{
+  std::size_t const n = nSlices * nFlashes;
+  scores.nSlices = nSlices;
+  scores.nFlashes = nFlashes;
+  scores.total.resize(n);
+  scores.y.resize(n);
+  scores.z.resize(n);
+  scores.rr.resize(n);
+  scores.ratio.resize(n);
+
+  for (std::size_t s = 0; s < nSlices; ++s) {
+    std::size_t const offset = s * nFlashes;
+    scoreSlice(bin(chargeX[s]), q[s], chargeY[s], chargeZ[s],
+      nFlashes, pe, flashY, flashZ,
+      scores.total.data() + offset, scores.y.data() + offset,
+      scores.z.data() + offset, scores.rr.data() + offset,
+      scores.ratio.data() + offset);
+  }
+}
+
+
+sbn::SimpleFlashMatchScorer::Scores sbn::SimpleFlashMatchScorer::score(
+  std::size_t nSlices, float const* q,
+  float const* chargeX, float const* chargeY, float const* chargeZ,
+  std::size_t nFlashes, float const* pe,
+  float const* flashY, float const* flashZ) const
+{
+  Scores scores;
+  score(nSlices, q, chargeX, chargeY, chargeZ, nFlashes, pe, flashY, flashZ, scores);
+  return scores;
+}
+
+
+void sbn::SimpleFlashMatchScorer::scoreSlice(
+  std::size_t bin, float q, float chargeY, float chargeZ,
+  std::size_t nFlashes, float const* __restrict__ pe,
+  float const* __restrict__ flashY, float const* __restrict__ flashZ,
+  float* __restrict__ total, float* __restrict__ y, float* __restrict__ z,
+  float* __restrict__ rr, float* __restrict__ ratio) const
+{
+  float const meanY = fMeanY[bin], invSpreadY = fInvSpreadY[bin];
+  float const meanZ = fMeanZ[bin], invSpreadZ = fInvSpreadZ[bin];
+  float const meanRR = fMeanRR[bin], invSpreadRR = fInvSpreadRR[bin];
+  float const meanRatio = fMeanRatio[bin], invSpreadRatio = fInvSpreadRatio[bin];
+  float const invQ = (q > 0.f)? 1.f / q: 0.f;
+
+  for (std::size_t f = 0; f < nFlashes; ++f) {
+    float const dy = flashY[f] - chargeY, dz = flashZ[f] - chargeZ;
+    y[f] = std::abs(dy - meanY) * invSpreadY;
+    z[f] = std::abs(dz - meanZ) * invSpreadZ;
+    ratio[f] = std::abs(pe[f] * invQ - meanRatio) * invSpreadRatio;
+    rr[f] = dy * dy + dz * dz; // squared for now
+  }
+
+  // center distances from the squared ones
+  for (std::size_t f = 0; f < nFlashes; ++f) rr[f] = std::sqrt(rr[f]);
+
+  for (std::size_t f = 0; f < nFlashes; ++f) {
+    rr[f] = std::abs(rr[f] - meanRR) * invSpreadRR;
+    total[f] = y[f] + z[f] + rr[f] + ratio[f];
+  }
+}
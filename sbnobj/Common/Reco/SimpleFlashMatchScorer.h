@@ -0,0 +1,92 @@
+#ifndef sbnobj_SimpleFlashMatchScorer_H
+#define sbnobj_SimpleFlashMatchScorer_H
+
+#include "sbnobj/Common/Reco/SimpleFlashMatchVars.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace sbn
+{
+  /**
+   * @brief Scores all the (slice, flash) pairs of a readout window.
+   *
+   * Each term of `SimpleFlashMatch::Score` is `|O - mean| / spread`, where the
+   * observable `O` of a pair is:
+   *  * `y`: flash center y minus charge center y;
+   *  * `z`: flash center z minus charge center z;
+   *  * `rr`: distance between the flash and charge centers on the y-z plane;
+   *  * `ratio`: flash PE over slice charge (0 for a slice without charge);
+   * and the expected `mean` and `spread` of each term are tabulated in bins of
+   * the drift coordinate (the charge center x) of the slice.
+   * The total score is the sum of the four terms; `slope` and `petoq` are
+   * not evaluated.
+   *
+   * Slices and flashes are passed as arrays of their components; the flashes
+   * of each slice are scored in vectorizable loops.
+   */
+  class SimpleFlashMatchScorer
+  {
+  public:
+
+    /// Expected mean and spread of a term, in drift coordinate bins.
+    struct TermParams {
+      std::vector<float> mean;
+      std::vector<float> spread;
+    };
+
+    /// Scores of `nSlices` x `nFlashes` pairs, flash index running fastest.
+    struct Scores {
+      std::size_t nSlices = 0;
+      std::size_t nFlashes = 0;
+      std::vector<float> total;
+      std::vector<float> y;
+      std::vector<float> z;
+      std::vector<float> rr;
+      std::vector<float> ratio;
+
+      std::size_t index(std::size_t slice, std::size_t flash) const
+        { return slice * nFlashes + flash; }
+      SimpleFlashMatch::Score score(std::size_t slice, std::size_t flash) const;
+      std::size_t bestFlash(std::size_t slice) const; // lowest total; `nFlashes` if none
+    };
+
+    // all terms need as many bins as `nBins`, each with positive spread
+    SimpleFlashMatchScorer(float xMin, float xMax, std::size_t nBins,
+      TermParams y, TermParams z, TermParams rr, TermParams ratio);
+
+    std::size_t nBins() const { return fNBins; }
+    std::size_t bin(float x) const; // clamped to the valid bins
+
+    // fills `scores` (resized as needed) for all pairs
+    void score(std::size_t nSlices, float const* q,
+      float const* chargeX, float const* chargeY, float const* chargeZ,
+      std::size_t nFlashes, float const* pe,
+      float const* flashY, float const* flashZ,
+      Scores& scores) const;
+
+    Scores score(std::size_t nSlices, float const* q,
+      float const* chargeX, float const* chargeY, float const* chargeZ,
+      std::size_t nFlashes, float const* pe,
+      float const* flashY, float const* flashZ) const;
+
+  private:
+
+    float fXMin;
+    float fInvBinWidth;
+    std::size_t fNBins;
+
+    // per bin: mean and inverse spread of each term
+    std::vector<float> fMeanY, fInvSpreadY;
+    std::vector<float> fMeanZ, fInvSpreadZ;
+    std::vector<float> fMeanRR, fInvSpreadRR;
+    std::vector<float> fMeanRatio, fInvSpreadRatio;
+
+    void scoreSlice(std::size_t bin, float q, float chargeY, float chargeZ,
+      std::size_t nFlashes, float const* pe, float const* flashY, float const* flashZ,
+      float* total, float* y, float* z, float* rr, float* ratio) const;
+
+  };
+}
+
+#endif
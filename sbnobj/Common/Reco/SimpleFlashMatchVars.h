@@ -1,30 +1,47 @@
 #ifndef sbncode_Simpleflashmatchvars_H
 #define sbncode_Simpleflashmatchvars_H
 
+#include "sbnobj/Common/Reco/Vector3F.h"
+
 #include "TVector3.h"
 
 namespace sbn
 {
+  /// Plain data: the `center` and `width` of `Charge` and `Flash` were
+  /// `TVector3` up to their class version 12. Code using the `TVector3`
+  /// interface on them (`SetX()`, `Mag()`, ...) needs to go through
+  /// `toTVector3()`, or to assign a whole `sbn::Vector3F`.
   class SimpleFlashMatch
   {
   public:
+    static sbn::Vector3F toVector3F(TVector3 const& v)
+      { return { float(v.X()), float(v.Y()), float(v.Z()) }; }
+    static TVector3 toTVector3(sbn::Vector3F const& v)
+      { return { v.x, v.y, v.z }; }
+
     struct Charge {
-      double q;        //!< charge in slc
-      TVector3 center; //!< Weighted center position [cm]
-      TVector3 width;  //!< Weighted width [cm]
-      Charge(double q_ = -1., TVector3 center_ = TVector3(-999, -999, -999),
-             TVector3 width_ = TVector3(-999, -999, -999)) :
+      double q;             //!< charge in slc
+      sbn::Vector3F center; //!< Weighted center position [cm]
+      sbn::Vector3F width;  //!< Weighted width [cm]
+      Charge(double q_ = -1., sbn::Vector3F center_ = { -999, -999, -999 },
+             sbn::Vector3F width_ = { -999, -999, -999 }) :
         q(q_), center(center_), width(width_)
         {}
+      Charge(double q_, TVector3 const& center_, TVector3 const& width_) :
+        q(q_), center(toVector3F(center_)), width(toVector3F(width_))
+        {}
     };
     struct Flash {
-      double pe;       //!< photo-electrons on flash
-      TVector3 center; //!< Weighted center position [cm]
-      TVector3 width;  //!< Weighted width [cm]
-      Flash(double pe_ = -1., TVector3 center_ = TVector3(-999, -999, -999),
-            TVector3 width_ = TVector3(-999, -999, -999)) :
+      double pe;            //!< photo-electrons on flash
+      sbn::Vector3F center; //!< Weighted center position [cm]
+      sbn::Vector3F width;  //!< Weighted width [cm]
+      Flash(double pe_ = -1., sbn::Vector3F center_ = { -999, -999, -999 },
+            sbn::Vector3F width_ = { -999, -999, -999 }) :
         pe(pe_), center(center_), width(width_)
         {}
+      Flash(double pe_, TVector3 const& center_, TVector3 const& width_) :
+        pe(pe_), center(toVector3F(center_)), width(toVector3F(width_))
+        {}
     };
     struct Score {
       double total; //!< total score, sum of terms
@@ -1,5 +1,9 @@
 #include "sbnobj/Common/Reco/Stub.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 int sbn::Stub::PlaneIndex(const geo::PlaneID &p) const {
   for (unsigned i_p = 0; i_p < plane.size(); i_p++) {
     if (plane[i_p] == p) return i_p;
@@ -55,12 +59,83 @@ int sbn::Stub::CoreNHit(unsigned plane_index) const {
 }
     
 bool sbn::Stub::OnCore(const geo::WireID &w) const {
-  int plane_index = PlaneIndex(w);
-  if (plane_index < 0) return -1;
+  return OnCore(GetCoreIndex(), w);
+}
 
-  int stubdir = vtx_w[plane_index] <= hit_w[plane_index] ? 1 : -1;
-  bool before_vtx = (((int)w.Wire - vtx_w[plane_index]) * stubdir) < 0;
-  bool after_hit = (((int)w.Wire - hit_w[plane_index]) * stubdir) > 0;
+void sbn::Stub::OnCore(const geo::WireID *wires, std::size_t n, bool *oncore) const {
+  const CoreIndex &index = GetCoreIndex();
+  for (std::size_t i = 0; i < n; i++) oncore[i] = OnCore(index, wires[i]);
+}
+
+void sbn::Stub::ResetCoreIndex() {
+  fCoreIndex.reset();
+}
+
+bool sbn::Stub::OnCore(const CoreIndex &index, const geo::WireID &w) {
+  if (!w.isValid) return false;
+  // unsigned differences also reject IDs below the first one
+  unsigned const c = w.Cryostat - index.firstCryostat;
+  unsigned const t = w.TPC - index.firstTPC;
+  unsigned const p = w.Plane - index.firstPlane;
+  if (c >= index.nCryostats || t >= index.nTPCs || p >= index.nPlanes) return false;
+
+  int const plane_index = index.slot[(c * index.nTPCs + t) * index.nPlanes + p];
+  if (plane_index < 0) return false;
+
+  int const wire = (int)w.Wire;
+  return wire >= index.min_w[plane_index] && wire <= index.max_w[plane_index];
+}
+
+const sbn::Stub::CoreIndex &sbn::Stub::GetCoreIndex() const {
+  return fCoreIndex.get([this](){ return MakeCoreIndex(); });
+}
+
+sbn::Stub::CoreIndex sbn::Stub::MakeCoreIndex() const {
+  CoreIndex index;
+
+  // range of the plane IDs of the stub
+  bool first = true;
+  unsigned lastCryostat = 0, lastTPC = 0, lastPlane = 0;
+  for (const geo::PlaneID &p: plane) {
+    if (!p.isValid) continue;
+    if (first || p.Cryostat < index.firstCryostat) index.firstCryostat = p.Cryostat;
+    if (first || p.TPC < index.firstTPC) index.firstTPC = p.TPC;
+    if (first || p.Plane < index.firstPlane) index.firstPlane = p.Plane;
+    if (first || p.Cryostat > lastCryostat) lastCryostat = p.Cryostat;
+    if (first || p.TPC > lastTPC) lastTPC = p.TPC;
+    if (first || p.Plane > lastPlane) lastPlane = p.Plane;
+    first = false;
+  }
+  if (first) return index; // no valid plane: nothing is on the core
+
+  index.nCryostats = lastCryostat - index.firstCryostat + 1;
+  index.nTPCs = lastTPC - index.firstTPC + 1;
+  index.nPlanes = lastPlane - index.firstPlane + 1;
+  index.slot.assign(index.nCryostats * index.nTPCs * index.nPlanes, -1);
+
+  // the core is between the vertex and the end hit wires, both included
+  index.min_w.resize(plane.size());
+  index.max_w.resize(plane.size());
+  for (unsigned i_p = 0; i_p < plane.size(); i_p++) {
+    const geo::PlaneID &p = plane[i_p];
+    if (p.isValid) {
+      int &slot = index.slot[((p.Cryostat - index.firstCryostat) * index.nTPCs
+        + (p.TPC - index.firstTPC)) * index.nPlanes + (p.Plane - index.firstPlane)];
+      if (slot < 0) slot = i_p; // the first plane with the ID is used
+    }
+
+    float const vtx = vtx_w[i_p];
+    float const hit = hit_w[i_p];
+    if (std::isnan(vtx)) {
+      // no vertex bound: as the direct check, from the end hit upward
+      index.min_w[i_p] = hit_w[i_p];
+      index.max_w[i_p] = std::numeric_limits<int>::max();
+    }
+    else {
+      index.min_w[i_p] = (int)std::ceil(std::min(vtx, hit));
+      index.max_w[i_p] = (int)std::floor(std::max(vtx, hit));
+    }
+  }
 
-  return !before_vtx && !after_hit;
+  return index;
 }
@@ -1,9 +1,11 @@
 #ifndef sbncode_Stub_HH
 #define sbncode_Stub_HH
 
+#include <cstddef>
 #include <vector>
 #include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
 #include "larcoreobj/SimpleTypesAndConstants/geo_vectors.h"
+#include "sbnobj/Common/Utilities/LazyCached.h"
 
 namespace sbn {
   class StubHit {
@@ -39,7 +41,41 @@ namespace sbn {
 
     int PlaneIndex(const geo::PlaneID &p) const;
 
-    bool OnCore(const geo::WireID &w) const; //!< Returns whether the input wire-ID is on the core of the stub 
+    /**
+     * @brief Returns whether the input wire-ID is on the core of the stub.
+     *
+     * The lookup uses the core wire range of each plane, which is built on
+     * the first call and shared among threads. If `plane`,
+     * `vtx_w` or `hit_w` are modified after a lookup, `ResetCoreIndex()`
+     * must be called before the next one. Wires on planes not in the stub are
+     * not on the core.
+     */
+    bool OnCore(const geo::WireID &w) const;
+
+    /// Sets `oncore[i]` to whether `wires[i]` is on the core, for `n` wires.
+    void OnCore(const geo::WireID *wires, std::size_t n, bool *oncore) const;
+
+    /// Discards the core wire ranges, which are rebuilt at the next lookup.
+    void ResetCoreIndex();
+
+    /// Core wire range of each plane, with a direct-mapped plane lookup.
+    /// Implementation detail, public only for the dictionary read rule.
+    struct CoreIndex {
+      unsigned firstCryostat = 0, firstTPC = 0, firstPlane = 0; //!< First ID of the table
+      unsigned nCryostats = 0, nTPCs = 0, nPlanes = 0; //!< Size of the table
+      std::vector<int> slot; //!< Plane index of each plane ID in the table, or -1
+      std::vector<int> min_w; //!< First core wire of each plane index
+      std::vector<int> max_w; //!< Last core wire of each plane index
+    };
+
+  private:
+    /// Core wire ranges (transient). Copies of a stub start without them, and
+    /// reading a stub from file discards them (rule in `classes_def.xml`).
+    sbn::lazy_cached<CoreIndex> fCoreIndex;
+
+    const CoreIndex &GetCoreIndex() const; //!< Returns the core ranges, building them if needed
+    CoreIndex MakeCoreIndex() const; //!< Returns new core ranges of the current content
+    static bool OnCore(const CoreIndex &index, const geo::WireID &w);
 
   };
 } // end namespace sbn
@@ -1 +1,71 @@
 #include "sbnobj/Common/Reco/TPCPMTBarycenterMatch.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+  constexpr std::size_t Lanes = 8; // width of the accumulation blocks
+} // local namespace
+
+
+sbn::ChargeBarycenter sbn::computeChargeBarycenter(std::size_t n,
+  float const* __restrict__ x, float const* __restrict__ y,
+  float const* __restrict__ z, float const* __restrict__ charge)
+{
+  ChargeBarycenter result;
+  if (n == 0) return result;
+
+  // moments relative to the first point, to limit cancellations in the width
+  double const x0 = x[0], y0 = y[0], z0 = z[0];
+  double sw[Lanes] = {}, swx[Lanes] = {}, swy[Lanes] = {}, swz[Lanes] = {};
+  double swxx[Lanes] = {}, swyy[Lanes] = {}, swzz[Lanes] = {};
+
+  auto accumulate = [&](std::size_t i, std::size_t k) {
+    double const w = charge[i];
+    double const dx = x[i] - x0, dy = y[i] - y0, dz = z[i] - z0; // in double precision
+    sw[k] += w;
+    swx[k] += w * dx;
+    swy[k] += w * dy;
+    swz[k] += w * dz;
+    swxx[k] += w * dx * dx;
+    swyy[k] += w * dy * dy;
+    swzz[k] += w * dz * dz;
+  };
+  std::size_t const nBlocks = n / Lanes * Lanes;
+  for (std::size_t i = 0; i < nBlocks; i += Lanes)
+    for (std::size_t k = 0; k < Lanes; ++k) accumulate(i + k, k);
+  for (std::size_t i = nBlocks; i < n; ++i) accumulate(i, i - nBlocks);
+
+  double W = 0., WX = 0., WY = 0., WZ = 0., WXX = 0., WYY = 0., WZZ = 0.;
+  for (std::size_t k = 0; k < Lanes; ++k) {
+    W += sw[k];
+    WX += swx[k];
+    WY += swy[k];
+    WZ += swz[k];
+    WXX += swxx[k];
+    WYY += swyy[k];
+    WZZ += swzz[k];
+  }
+
+  result.chargeTotal = W;
+  if (!(W > 0.)) return result;
+
+  double const mx = WX / W, my = WY / W, mz = WZ / W;
+  result.center = geo::Point_t(x0 + mx, y0 + my, z0 + mz);
+  result.width = geo::Vector_t(
+    std::sqrt(std::max(WXX / W - mx * mx, 0.)),
+    std::sqrt(std::max(WYY / W - my * my, 0.)),
+    std::sqrt(std::max(WZZ / W - mz * mz, 0.))
+    );
+  return result;
+}
+
+
+void sbn::fillChargeBarycenter(TPCPMTBarycenterMatch& match, std::size_t n,
+  float const* x, float const* y, float const* z, float const* charge)
+{
+  ChargeBarycenter const barycenter = computeChargeBarycenter(n, x, y, z, charge);
+  match.chargeTotal = barycenter.chargeTotal;
+  match.chargeCenter = barycenter.center;
+  match.chargeWidth = barycenter.width;
+}
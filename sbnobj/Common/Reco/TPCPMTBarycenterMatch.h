@@ -5,6 +5,7 @@
  * 
  */
 
+#include <cstddef>
 #include <limits>
 #include "larcoreobj/SimpleTypesAndConstants/geo_vectors.h"
 
@@ -56,6 +57,29 @@ namespace sbn {
   /// @}
 
   };
+
+  /// Charge-weighted barycenter and width of a set of spacepoints.
+  struct ChargeBarycenter {
+    float         chargeTotal { TPCPMTBarycenterMatch::fDefault };  ///< Total charge (integrated ADC counts)
+    geo::Point_t  center { TPCPMTBarycenterMatch::fDefault, TPCPMTBarycenterMatch::fDefault, TPCPMTBarycenterMatch::fDefault }; ///< Weighted mean position (cm)
+    geo::Vector_t width  { TPCPMTBarycenterMatch::fDefault, TPCPMTBarycenterMatch::fDefault, TPCPMTBarycenterMatch::fDefault }; ///< Weighted standard deviation of the position (cm)
+  };
+
+  /**
+   * @brief Computes the charge barycenter of `n` spacepoints in one pass.
+   *
+   * The spacepoint coordinates and charges are taken from the arrays `x`,
+   * `y`, `z` and `charge`. The moments are accumulated in double precision
+   * relative to the first spacepoint, over a fixed number of lanes so that
+   * the loop is vectorized. Center and width are left `fDefault` if the total
+   * charge is not positive.
+   */
+  ChargeBarycenter computeChargeBarycenter(std::size_t n,
+    float const* x, float const* y, float const* z, float const* charge);
+
+  /// Sets `chargeTotal`, `chargeCenter` and `chargeWidth` of `match` from `n` spacepoints.
+  void fillChargeBarycenter(TPCPMTBarycenterMatch& match, std::size_t n,
+    float const* x, float const* y, float const* z, float const* charge);
 }
 
 #endif
@@ -0,0 +1,57 @@
+#include "sbnobj/Common/Reco/TPCPMTBarycenterMatchCompact.h"
+
+namespace {
+
+  template <typename Vect>
+  sbn::Vector3F toVector3F(Vect const& v) { return { float(v.X()), float(v.Y()), float(v.Z()) }; }
+
+} // local namespace
+
+
+sbn::TPCPMTBarycenterMatchCompact::TPCPMTBarycenterMatchCompact(TPCPMTBarycenterMatch const& match)
+  : chargeTotal       (match.chargeTotal)
+  , chargeCenterXLocal(match.chargeCenterXLocal)
+  , chargeCenter      (toVector3F(match.chargeCenter))
+  , chargeWidth       (toVector3F(match.chargeWidth))
+  , flashTime         (match.flashTime)
+  , flashFirstHit     (match.flashFirstHit)
+  , flashPEs          (match.flashPEs)
+  , flashAsymmetry    (match.flashAsymmetry)
+  , flashCenter       (toVector3F(match.flashCenter))
+  , flashWidth        (toVector3F(match.flashWidth))
+  , deltaY            (match.deltaY)
+  , deltaZ            (match.deltaZ)
+  , radius            (match.radius)
+  , deltaT            (match.deltaT)
+  , overlapY          (match.overlapY)
+  , overlapZ          (match.overlapZ)
+  , deltaZ_Trigger    (match.deltaZ_Trigger)
+  , deltaY_Trigger    (match.deltaY_Trigger)
+  , radius_Trigger    (match.radius_Trigger)
+{}
+
+
+sbn::TPCPMTBarycenterMatch sbn::TPCPMTBarycenterMatchCompact::toMatch() const
+{
+  TPCPMTBarycenterMatch match;
+  match.chargeTotal        = chargeTotal;
+  match.chargeCenterXLocal = chargeCenterXLocal;
+  match.chargeCenter       = geo::Point_t(chargeCenter.x, chargeCenter.y, chargeCenter.z);
+  match.chargeWidth        = geo::Vector_t(chargeWidth.x, chargeWidth.y, chargeWidth.z);
+  match.flashTime          = flashTime;
+  match.flashFirstHit      = flashFirstHit;
+  match.flashPEs           = flashPEs;
+  match.flashAsymmetry     = flashAsymmetry;
+  match.flashCenter        = geo::Point_t(flashCenter.x, flashCenter.y, flashCenter.z);
+  match.flashWidth         = geo::Vector_t(flashWidth.x, flashWidth.y, flashWidth.z);
+  match.deltaY             = deltaY;
+  match.deltaZ             = deltaZ;
+  match.radius             = radius;
+  match.deltaT             = deltaT;
+  match.overlapY           = overlapY;
+  match.overlapZ           = overlapZ;
+  match.deltaZ_Trigger     = deltaZ_Trigger;
+  match.deltaY_Trigger     = deltaY_Trigger;
+  match.radius_Trigger     = radius_Trigger;
+  return match;
+}
@@ -0,0 +1,67 @@
+/**
+ * @file   sbnobj/Common/Reco/TPCPMTBarycenterMatchCompact.h
+ * @brief  Single precision form of `sbn::TPCPMTBarycenterMatch`.
+ */
+
+#ifndef SBNOBJ_COMMON_RECO_TPCPMTBARYCENTERMATCHCOMPACT_H
+#define SBNOBJ_COMMON_RECO_TPCPMTBARYCENTERMATCHCOMPACT_H
+
+#include "sbnobj/Common/Reco/TPCPMTBarycenterMatch.h"
+#include "sbnobj/Common/Reco/Vector3F.h"
+
+namespace sbn {
+
+  /**
+   * @brief `TPCPMTBarycenterMatch` with all the members in single precision.
+   *
+   * The content is the same as `TPCPMTBarycenterMatch`, with the positions and
+   * widths stored as `Vector3F` instead of the double precision `geo::Point_t`
+   * and `geo::Vector_t`, which halves their size.
+   */
+  class TPCPMTBarycenterMatchCompact {
+  public:
+
+  static constexpr float fDefault = std::numeric_limits<float>::signaling_NaN();
+
+  TPCPMTBarycenterMatchCompact() = default;
+  explicit TPCPMTBarycenterMatchCompact(TPCPMTBarycenterMatch const& match);
+
+  /// Returns a copy in the `TPCPMTBarycenterMatch` form.
+  TPCPMTBarycenterMatch toMatch() const;
+
+  /// @name Data members related to the slice barycenter determination
+  /// @{
+  float        chargeTotal        { fDefault }; ///< Total charge in slice contributing to barycenter (integrated ADC counts)
+  float        chargeCenterXLocal { fDefault }; ///< Weighted mean X position of spacepoints, measured with respect to the cathode (cm)
+  Vector3F     chargeCenter;                    ///< Weighted mean spacepoint position in X,Y,Z (cm)
+  Vector3F     chargeWidth;                     ///< Weighted standard devitation of spacepoint position in X,Y,Z (cm)
+  /// @}
+
+  /// @name Data members related to matched recob::OpFlash, also reachable by association
+  /// @{
+  float        flashTime          { fDefault }; ///< Matched OpFlash time (us)
+  float        flashFirstHit      { fDefault }; ///< Time of first OpHit in matched OpFlash (us)
+  float        flashPEs           { fDefault }; ///< Total PEs in matched flash
+  float        flashAsymmetry     { fDefault }; ///< East-West asymmetry of PEs in matched flash
+  Vector3F     flashCenter;                     ///< Weighted mean ophit position in X,Y,Z [no meaingful X info for ophits] (cm)
+  Vector3F     flashWidth;                      ///< Weighted standard devitation of ophit position in X,Y,Z [no meaingful X info for ophits] (cm)
+  /// @}
+
+  /// @name Data members related to quality of match
+  /// @{
+  float        deltaY             { fDefault }; ///< | Matched flash Y center - charge Y center | (cm)
+  float        deltaZ             { fDefault }; ///< | Matched flash Z center - charge Z center | (cm)
+  float        radius             { fDefault }; ///< Hypotenuse of DeltaY and DeltaZ (cm)
+  float        deltaT             { fDefault }; ///< | Matched flash time - anab::T0 | when available (us)
+  float        overlapY           { fDefault }; ///< Spatial overlap of flash and charge centroids in Y [>0] OR distance apart if no overlap [<0] (cm)
+  float        overlapZ           { fDefault }; ///< Spatial overlap of flash and charge centroids in Z [>0] OR distance apart if no overlap [<0] (cm)
+  float        deltaZ_Trigger     { fDefault }; ///< | Triggering flash Z center - charge Z center | (cm)
+  float        deltaY_Trigger     { fDefault }; ///< | Triggering flash Y center - charge Y center | (cm)
+  float        radius_Trigger     { fDefault }; ///< Hypotenuse of DeltaY_Trigger and DeltaZ_Trigger (cm)
+  /// @}
+
+  };
+
+}
+
+#endif
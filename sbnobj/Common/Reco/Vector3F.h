@@ -0,0 +1,28 @@
+/**
+ * @file   sbnobj/Common/Reco/Vector3F.h
+ * @brief  Plain single precision 3D vector for compact data products.
+ */
+
+#ifndef SBNOBJ_COMMON_RECO_VECTOR3F_H
+#define SBNOBJ_COMMON_RECO_VECTOR3F_H
+
+#include <limits>
+
+namespace sbn {
+
+  /// Plain single precision 3D vector.
+  struct Vector3F {
+    static constexpr float fDefault = std::numeric_limits<float>::signaling_NaN();
+
+    float x { fDefault };
+    float y { fDefault };
+    float z { fDefault };
+
+    float X() const { return x; }
+    float Y() const { return y; }
+    float Z() const { return z; }
+  };
+
+} // namespace sbn
+
+#endif // SBNOBJ_COMMON_RECO_VECTOR3F_H
@@ -0,0 +1,147 @@
+#ifndef sbncode_VertexHitCalorimetry_HH
+#define sbncode_VertexHitCalorimetry_HH
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+/*
+ * Batch computation of the `sbn::VertexHit` calorimetry (`proj_dist_to_vertex`,
+ * `pitch`, `dqdx` and `dedx`) for all the hits of a plane around a vertex.
+ *
+ * The inputs and outputs are arrays with one entry per hit. The geometric
+ * part and the recombination correction run as separate loops, so that
+ * the geometry is vectorized (but for the square roots) and the correction
+ * is vectorized when the recombination model allows it (e.g.
+ * `BirksRecombination`; the exponential of `ModBoxRecombination` needs a
+ * vector math library).
+ *
+ * A recombination model is any type with a
+ * `float operator() (float dqdx) const` returning dE/dx [MeV/cm] from
+ * dQ/dx [#elec/cm].
+ */
+
+namespace sbn {
+
+  /// Modified box recombination model (ArgoNeuT).
+  struct ModBoxRecombination {
+    float alpha = 0.93f;     //!< Modified box A parameter
+    float beta = 0.212f;     //!< Modified box B parameter [(kV/cm)(g/cm^2)/MeV]
+    float efield = 0.5f;     //!< Electric field [kV/cm]
+    float density = 1.383f;  //!< Argon density [g/cm^3]
+    float wion = 23.6e-6f;   //!< Energy to create an ionization electron [MeV]
+
+    float operator() (float dqdx) const
+      {
+        float const b = beta / (density * efield);
+        return (std::exp(b * wion * dqdx) - alpha) / b;
+      }
+  };
+
+  /// Birks recombination model (ICARUS).
+  struct BirksRecombination {
+    float A = 0.800f;        //!< Birks A parameter
+    float k = 0.0486f;       //!< Birks k parameter [(kV/cm)(g/cm^2)/MeV]
+    float efield = 0.5f;     //!< Electric field [kV/cm]
+    float density = 1.383f;  //!< Argon density [g/cm^3]
+    float wion = 23.6e-6f;   //!< Energy to create an ionization electron [MeV]
+
+    float operator() (float dqdx) const
+      {
+        float const dq = dqdx * wion;
+        return dq / (A - k / (density * efield) * dq);
+      }
+  };
+
+  /// Plane information needed by the vertex hit calorimetry.
+  struct VertexHitPlane {
+    float wirePitch; //!< Distance between wires [cm]
+    float wireDirY; //!< Y component of the direction of increasing wire coordinate
+    float wireDirZ; //!< Z component of the direction of increasing wire coordinate
+    float minCos = 1e-3f; //!< Lower limit to the direction cosine in the pitch
+  };
+
+  /// Vertex the hits are measured from.
+  struct VertexHitVertex {
+    float w; //!< Wire coordinate of the vertex on the plane. Not space charge corrected. [cm]
+    float x; //!< X-Position of the vertex as seen by the plane. Not space charge corrected. [cm]
+    float posX; //!< 3D location of the vertex (x). Space charge corrected. [cm]
+    float posY; //!< 3D location of the vertex (y). Space charge corrected. [cm]
+    float posZ; //!< 3D location of the vertex (z). Space charge corrected. [cm]
+  };
+
+  /**
+   * @brief Computes the geometric calorimetry of `n` hits of one plane.
+   * @param charge charge of each hit [#elec]
+   * @param hitW wire coordinate of each hit [cm]
+   * @param hitX x position of each hit as seen by the plane [cm]
+   * @param spX 3D position (x) of the space point of each hit [cm]
+   * @param spY 3D position (y) of the space point of each hit [cm]
+   * @param spZ 3D position (z) of the space point of each hit [cm]
+   * @param[out] projDist distance from the vertex on the wire plane [cm]
+   * @param[out] pitch pitch of a track from the vertex to the hit [cm]
+   * @param[out] dqdx charge over pitch [#elec/cm]
+   *
+   * The pitch is the wire pitch over the cosine between the vertex-to-hit
+   * direction and the direction of increasing wire coordinate, which is
+   * limited to `plane.minCos` from below. A space point at the vertex gets the
+   * wire pitch.
+   */
+  inline void computeVertexHitPitch(std::size_t n,
+    float const* __restrict__ charge,
+    float const* __restrict__ hitW, float const* __restrict__ hitX,
+    float const* __restrict__ spX, float const* __restrict__ spY,
+    float const* __restrict__ spZ,
+    VertexHitVertex const& vtx, VertexHitPlane const& plane,
+    float* __restrict__ projDist, float* __restrict__ pitch,
+    float* __restrict__ dqdx)
+  {
+    for (std::size_t i = 0; i < n; ++i) {
+      float const dw = hitW[i] - vtx.w, dxw = hitX[i] - vtx.x;
+      projDist[i] = dw * dw + dxw * dxw; // squared for now
+
+      float const dx = spX[i] - vtx.posX, dy = spY[i] - vtx.posY, dz = spZ[i] - vtx.posZ;
+      float const d2 = dx * dx + dy * dy + dz * dz;
+      float const along = dy * plane.wireDirY + dz * plane.wireDirZ;
+      // cos^2 = along^2 / |d|^2, limited from below; `atVertex` turns |d| = 0
+      // into cos = 1 without a branch, which would prevent the vectorization
+      float const atVertex = (d2 > 0.f)? 0.f: 1.f;
+      pitch[i] = (std::max(along * along, plane.minCos * plane.minCos * d2) + atVertex)
+        / (d2 + atVertex); // cos^2 for now
+    }
+
+    // distances, and pitches from cos^2
+    for (std::size_t i = 0; i < n; ++i) {
+      projDist[i] = std::sqrt(projDist[i]);
+      pitch[i] = plane.wirePitch / std::sqrt(pitch[i]);
+    }
+
+    for (std::size_t i = 0; i < n; ++i) dqdx[i] = charge[i] / pitch[i];
+  }
+
+  /// Fills `dedx` of `n` hits from their `dqdx` with the `recombination` model.
+  template <typename Recombination>
+  void computeVertexHitdEdx(std::size_t n,
+    float const* __restrict__ dqdx, Recombination const& recombination,
+    float* __restrict__ dedx)
+  {
+    for (std::size_t i = 0; i < n; ++i) dedx[i] = recombination(dqdx[i]);
+  }
+
+  /// Computes `projDist`, `pitch`, `dqdx` and `dedx` of `n` hits of one plane.
+  template <typename Recombination>
+  void computeVertexHitCalorimetry(std::size_t n,
+    float const* charge, float const* hitW, float const* hitX,
+    float const* spX, float const* spY, float const* spZ,
+    VertexHitVertex const& vtx, VertexHitPlane const& plane,
+    Recombination const& recombination,
+    float* projDist, float* pitch, float* dqdx, float* dedx)
+  {
+    computeVertexHitPitch
+      (n, charge, hitW, hitX, spX, spY, spZ, vtx, plane, projDist, pitch, dqdx);
+    computeVertexHitdEdx(n, dqdx, recombination, dedx);
+  }
+
+} // end namespace sbn
+
+#endif
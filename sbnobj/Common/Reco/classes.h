@@ -12,6 +12,7 @@
 
 #include "sbnobj/Common/CRT/CRTHit.hh"
 #include "sbnobj/Common/Reco/FlashTriggerPrimitive.hh"
+#include "sbnobj/Common/Reco/FlashTriggerPrimitiveCollection.hh"
 #include "sbnobj/Common/Reco/MergedTrackInfo.hh"
 #include "sbnobj/Common/Reco/RangeP.h"
 #include "sbnobj/Common/Reco/ShowerSelectionVars.h"
@@ -22,12 +23,17 @@
 #include "sbnobj/Common/Reco/ScatterClosestApproach.h"
 #include "sbnobj/Common/Reco/StoppingChi2Fit.h"
 #include "sbnobj/Common/Reco/Stub.h"
+#include "sbnobj/Common/Reco/FlatStub.h"
 #include "sbnobj/Common/Reco/VertexHit.h"
 #include "sbnobj/Common/Reco/MVAPID.h"
 #include "sbnobj/Common/Reco/CRUMBSResult.h"
 #include "sbnobj/Common/Reco/OpT0FinderResult.h"
+#include "sbnobj/Common/Reco/OpT0FinderSparse.h"
 #include "sbnobj/Common/Reco/CNNScore.h"
+#include "sbnobj/Common/Reco/HitCNNScore.h"
 #include "sbnobj/Common/Reco/TPCPMTBarycenterMatch.h"
+#include "sbnobj/Common/Reco/TPCPMTBarycenterMatchCompact.h"
+#include "sbnobj/Common/Reco/ScoreTable.h"
 
 #include <utility>
 #include <vector>
@@ -1,2 +1,53 @@
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
 #include "sbnobj/Common/SBNEventWeight/EventWeightMap.h"
 
+namespace sbn {
+  namespace evwgh {
+
+void MergeEventWeightMap(EventWeightMap& target, EventWeightMap&& source) {
+  std::string collisions;
+  for (auto const& it : source) {
+    if (target.count(it.first)) collisions += " '" + it.first + "'";
+  }
+  if (!collisions.empty()) {
+    throw std::runtime_error("MergeEventWeightMap: calculators already present:"
+                             + collisions);
+  }
+  target.merge(source);
+}
+
+
+EventWeightMap MergeEventWeightMaps(std::vector<EventWeightMap>&& sources) {
+  // first producer of each calculator name; the names are owned by `sources`
+  std::unordered_map<std::string_view, size_t> owners;
+  size_t nNames = 0;
+  for (auto const& source : sources) nNames += source.size();
+  owners.reserve(nNames);
+
+  std::string collisions;
+  for (size_t i=0; i<sources.size(); i++) {
+    for (auto const& it : sources[i]) {
+      auto const [ owner, inserted ] = owners.emplace(it.first, i);
+      if (inserted) continue;
+      collisions += " '" + it.first + "' (#" + std::to_string(owner->second)
+        + " and #" + std::to_string(i) + ")";
+    }
+  }
+  if (!collisions.empty()) {
+    throw std::runtime_error("MergeEventWeightMaps: calculators from more"
+                             " than one producer:" + collisions);
+  }
+
+  EventWeightMap merged;
+  if (sources.empty()) return merged;
+  merged.swap(sources.front());
+  for (size_t i=1; i<sources.size(); i++) merged.merge(sources[i]);
+  return merged;
+}
+
+  }  // namespace evwgh
+}  // namespace sbn
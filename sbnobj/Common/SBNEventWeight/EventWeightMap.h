@@ -17,6 +17,34 @@ namespace sbn {
  */
 typedef std::map<std::string, std::vector<float> > EventWeightMap;
 
+/**
+ * Moves all the weights of `source` into `target`.
+ *
+ * The entries of `source` are spliced into `target` (`std::map::merge()`):
+ * no weight vector is copied or reallocated, and `source` is left empty.
+ * If any calculator is in both maps, a `std::runtime_error` is thrown
+ * listing all of them, and neither map is changed.
+ *
+ * @param target The map to receive the weights
+ * @param source The map to take the weights from
+ */
+void MergeEventWeightMap(EventWeightMap& target, EventWeightMap&& source);
+
+/**
+ * Merges the weights from many producers into a single map.
+ *
+ * The weights are moved as in `MergeEventWeightMap()`, and `sources` is left
+ * with empty maps.
+ * All the names are checked for collisions before any weight is moved: if
+ * any calculator is in more than one map, a `std::runtime_error` is thrown
+ * listing them together with the position of the maps they are in, and
+ * `sources` is not changed.
+ *
+ * @param sources The weights from all the producers
+ * @return All the weights
+ */
+EventWeightMap MergeEventWeightMaps(std::vector<EventWeightMap>&& sources);
+
   }  // namespace evwgh
 }  // namespace sbn
 
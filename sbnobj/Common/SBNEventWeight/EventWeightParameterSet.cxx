@@ -1,10 +1,17 @@
+#include <algorithm>
 #include <cassert>
+#include <iostream>
 #include <string>
 #include <map>
 #include <vector>
 #include "TMatrixD.h"
+#include "TDecompChol.h"
 #include "CLHEP/Random/RandGaussQ.h"
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
+#include "tbb/task_arena.h"
 #include "EventWeightParameterSet.h"
+#include "Philox.h"
 
 namespace sbn {
   namespace evwgh {
@@ -66,47 +73,182 @@ void EventWeightParameterSet::Sample(CLHEP::HepRandomEngine& engine) {
     assert(false);
   }
 
+  if (fRWType != kMultisim) {
+    if (fCovarianceMatrix) {
+      std::cerr << "EventWeightParameterSet: Correlated sampling requires multisim reweighting." << std::endl;
+      assert(false);
+    }
+    FillDeterministicValues();
+  }
+
   // No covariance matrix, uncorrelated sampling
-  if (!fCovarianceMatrix) {
+  else if (!fCovarianceMatrix) {
+    std::vector<double> throws(fNuniverses);
     for (auto& it : fParameterMap) {
       const EventWeightParameter& p = it.first;
 
-      if (fRWType == kMultisim) {
-        for (size_t i=0; i<fNuniverses; i++) {
-          float r = p.fWidth*CLHEP::RandGaussQ::shoot(&engine, p.fMean, 1);
-          it.second.push_back(r);
+      // same throws, in the same order, as one shoot() per universe
+      CLHEP::RandGaussQ::shootArray(&engine, fNuniverses, throws.data(), p.fMean, 1);
+      const size_t offset = it.second.size();
+      it.second.resize(offset + fNuniverses);
+      float* values = it.second.data() + offset;
+      const float width = p.fWidth;
+      for (size_t i=0; i<fNuniverses; i++) values[i] = width * throws[i];
+    }
+  }
+
+  // Multivariate Gaussian sampling
+  else {
+    const size_t n = fCovarianceMatrix->GetNrows();
+    const std::vector<double> L = CholeskyFactor();
+    for (auto& it : fParameterMap) it.second.reserve(it.second.size() + fNuniverses);
+
+    // Universes are thrown in blocks: z holds a standard normal vector per
+    // universe, x = L z the correlated offsets, both stored parameter-major
+    // so that the product runs on contiguous universes
+    const size_t kBlockSize = 64;
+    std::vector<double> z(n * kBlockSize), x(n * kBlockSize);
+    for (size_t first=0; first<fNuniverses; first+=kBlockSize) {
+      const size_t nBlock = std::min(kBlockSize, fNuniverses - first);
+      CLHEP::RandGaussQ::shootArray(&engine, n * nBlock, z.data(), 0.0, 1.0);
+
+      std::fill(x.begin(), x.end(), 0.0);
+      for (size_t i=0; i<n; i++) {
+        double* xi = x.data() + i * nBlock;
+        for (size_t k=0; k<=i; k++) {
+          const double lik = L[i*n+k];
+          const double* zk = z.data() + k * nBlock;
+          for (size_t u=0; u<nBlock; u++) xi[u] += lik * zk[u];
         }
       }
 
-      else if (fRWType == kPMNSigma) {
-        it.second.push_back(p.fMean + p.fWidth);
-        it.second.push_back(p.fMean - p.fWidth);
+      for (auto& it : fParameterMap) {
+        const EventWeightParameter& p = it.first;
+        const double* xi = x.data() + p.fCovIndex * nBlock;
+        for (size_t u=0; u<nBlock; u++) it.second.push_back(p.fMean + xi[u]);
       }
+    }
+  }
+}
 
-      else if (fRWType == kMultisigma) {
+void EventWeightParameterSet::SampleCounterBased(std::uint64_t seed, unsigned int nThreads) {
+  if (fRWType == kDefault) {
+    std::cerr << "EventWeightParameterSet: Must be configured before sampling." << std::endl;
+    assert(false);
+  }
 
-        for(size_t j=0; j<p.fWidths.size(); j++){
-          it.second.push_back(p.fMean + p.fWidths.at(j));
-        }
+  if (fRWType != kMultisim) {
+    if (fCovarianceMatrix) {
+      std::cerr << "EventWeightParameterSet: Correlated sampling requires multisim reweighting." << std::endl;
+      assert(false);
+    }
+    FillDeterministicValues();
+    return;
+  }
 
-      }
+  const EventWeightUniverseGenerator generator(*this, seed);
 
-      else if (fRWType == kFixed) {
-        it.second.push_back(p.fMean + p.fWidth);
+  // each task writes its own universes of each parameter
+  std::vector<float*> values;
+  for (auto& it : fParameterMap) {
+    const size_t offset = it.second.size();
+    it.second.resize(offset + fNuniverses);
+    values.push_back(it.second.data() + offset);
+  }
+
+  auto sampleUniverses = [&generator, &values]
+    (tbb::blocked_range<size_t> const& range)
+    {
+      std::vector<float> universe(values.size());
+      for (size_t u=range.begin(); u!=range.end(); u++) {
+        generator.Universe(u, universe.data());
+        for (size_t i=0; i<values.size(); i++) values[i][u] = universe[i];
       }
+    };
+
+  tbb::task_arena arena{
+    (nThreads > 0U)
+      ? static_cast<int>(nThreads): int(tbb::task_arena::automatic)
+    };
+  arena.execute([this, &sampleUniverses]()
+    {
+      tbb::parallel_for(tbb::blocked_range<size_t>(0U, fNuniverses, 64U),
+                        sampleUniverses);
+    });
+}
+
+void EventWeightParameterSet::SetRegenerable(std::uint64_t seed) {
+  if (fRWType == kDefault) {
+    std::cerr << "EventWeightParameterSet: Must be configured before sampling." << std::endl;
+    assert(false);
+  }
+
+  if (fRWType != kMultisim) {
+    if (fCovarianceMatrix) {
+      std::cerr << "EventWeightParameterSet: Correlated sampling requires multisim reweighting." << std::endl;
+      assert(false);
+    }
+    FillDeterministicValues();
+    return;
+  }
+
+  for (auto& it : fParameterMap) std::vector<float>().swap(it.second);
+  fRegenerable = true;
+  fSeed = seed;
+}
 
-      else {
-        std::cerr << "EventWeightParameterSet: Unknown reweight type " << fRWType << std::endl;
-        assert(false);
+void EventWeightParameterSet::FillDeterministicValues() {
+  for (auto& it : fParameterMap) {
+    const EventWeightParameter& p = it.first;
+
+    if (fRWType == kPMNSigma) {
+      it.second.push_back(p.fMean + p.fWidth);
+      it.second.push_back(p.fMean - p.fWidth);
+    }
+
+    else if (fRWType == kMultisigma) {
+
+      it.second.reserve(it.second.size() + p.fWidths.size());
+      for(size_t j=0; j<p.fWidths.size(); j++){
+        it.second.push_back(p.fMean + p.fWidths.at(j));
       }
+
+    }
+
+    else if (fRWType == kFixed) {
+      it.second.push_back(p.fMean + p.fWidth);
+    }
+
+    else {
+      std::cerr << "EventWeightParameterSet: Unknown reweight type " << fRWType << std::endl;
+      assert(false);
     }
   }
+}
 
-  // Multivariate Gaussian sampling
-  else {
-    std::cerr << "EventWeightParameterSet: Multivariate Gaussian sampling is not implemented." << std::endl;
+std::vector<double> EventWeightParameterSet::CholeskyFactor() const {
+  const size_t n = fCovarianceMatrix->GetNrows();
+  for (auto const& it : fParameterMap) {
+    if (it.first.fCovIndex >= n) {
+      std::cerr << "EventWeightParameterSet: Parameter " << it.first.fName
+                << " has covariance index " << it.first.fCovIndex
+                << " beyond the " << n << "x" << n << " covariance matrix" << std::endl;
+      assert(false);
+    }
+  }
+
+  // C = L L^T, computed once for all the universes
+  TDecompChol decomposition(*fCovarianceMatrix);
+  if (!decomposition.Decompose()) {
+    std::cerr << "EventWeightParameterSet: Covariance matrix is not positive definite." << std::endl;
     assert(false);
   }
+  const TMatrixD& U = decomposition.GetU();  // upper triangular, L = U^T
+  std::vector<double> L(n * n, 0.0);
+  for (size_t i=0; i<n; i++) {
+    for (size_t k=0; k<=i; k++) L[i*n+k] = U(k, i);
+  }
+  return L;
 }
 
 void EventWeightParameterSet::FillKnobValues() {
@@ -120,7 +262,69 @@ void EventWeightParameterSet::FillKnobValues() {
 }
 
 
+EventWeightUniverseGenerator::EventWeightUniverseGenerator(
+    const EventWeightParameterSet& parameterSet)
+  : EventWeightUniverseGenerator(parameterSet, parameterSet.fSeed,
+                                 parameterSet.fRegenerable) {}
+
+EventWeightUniverseGenerator::EventWeightUniverseGenerator(
+    const EventWeightParameterSet& parameterSet, std::uint64_t seed)
+  : EventWeightUniverseGenerator(parameterSet, seed,
+      parameterSet.fRWType == EventWeightParameterSet::kMultisim) {}
+
+EventWeightUniverseGenerator::EventWeightUniverseGenerator(
+    const EventWeightParameterSet& parameterSet, std::uint64_t seed,
+    bool counterBased)
+  : fNuniverses(parameterSet.fNuniverses),
+    fCounterBased(counterBased),
+    fKey(Philox4x32::MakeKey(seed, parameterSet.fName)),
+    fNcov(0) {
+  for (auto const& it : parameterSet.fParameterMap) {
+    fParameters.push_back(&it.first);
+    fStoredValues.push_back(&it.second);
+  }
+  if (fCounterBased && parameterSet.fCovarianceMatrix) {
+    fNcov = parameterSet.fCovarianceMatrix->GetNrows();
+    fCholesky = parameterSet.CholeskyFactor();
+  }
+}
+
+void EventWeightUniverseGenerator::Universe(size_t universe, float* values) const {
+  if (!fCounterBased) {
+    for (size_t i=0; i<fParameters.size(); i++) values[i] = (*fStoredValues[i])[universe];
+    return;
+  }
+
+  // No covariance matrix: the stream of each parameter is its position in the set
+  if (fNcov == 0) {
+    for (size_t i=0; i<fParameters.size(); i++) {
+      const EventWeightParameter& p = *fParameters[i];
+      values[i] = p.fWidth * (p.fMean + Philox4x32::Gaussian(fKey, universe, i));
+    }
+    return;
+  }
+
+  // Correlated throws: the stream of each component is its covariance index
+  const size_t n = fNcov;
+  thread_local std::vector<double> z, x;  // scratch, reused by each thread
+  z.resize(n);
+  x.resize(n);
+  for (size_t k=0; k<n; k++) z[k] = Philox4x32::Gaussian(fKey, universe, k);
+  for (size_t i=0; i<n; i++) {
+    double xi = 0;
+    for (size_t k=0; k<=i; k++) xi += fCholesky[i*n+k] * z[k];
+    x[i] = xi;
+  }
+  for (size_t i=0; i<fParameters.size(); i++)
+    values[i] = fParameters[i]->fMean + x[fParameters[i]->fCovIndex];
+}
+
+std::vector<float> EventWeightUniverseGenerator::Universe(size_t universe) const {
+  std::vector<float> values(fParameters.size());
+  Universe(universe, values.data());
+  return values;
+}
+
 
   }  // namespace evwgh
 }  // namespace sbn
-
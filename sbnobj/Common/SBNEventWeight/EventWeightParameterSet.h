@@ -1,10 +1,12 @@
 #ifndef _SBN_EVENTWEIGHTPARAMETERSET_H_
 #define _SBN_EVENTWEIGHTPARAMETERSET_H_
 
+#include <cstdint>
 #include <string>
 #include <map>
 #include <vector>
 #include "TMatrixD.h"
+#include "sbnobj/Common/SBNEventWeight/Philox.h"
 
 namespace CLHEP { class HepRandomEngine; }
 
@@ -72,7 +74,8 @@ public:
   } ReweightType;
 
   /** Default constructor. */
-  EventWeightParameterSet() : fCovarianceMatrix(nullptr), fRWType(kDefault) {}
+  EventWeightParameterSet()
+    : fCovarianceMatrix(nullptr), fRWType(kDefault), fRegenerable(false), fSeed(0) {}
 
   /** Equality operator, testing equality of all members. */
   inline friend bool operator==(const EventWeightParameterSet& lhs,
@@ -81,7 +84,9 @@ public:
             lhs.fCovarianceMatrix == rhs.fCovarianceMatrix &&
             lhs.fName == rhs.fName &&
             lhs.fRWType == rhs.fRWType &&
-            lhs.fNuniverses == rhs.fNuniverses);
+            lhs.fNuniverses == rhs.fNuniverses &&
+            lhs.fRegenerable == rhs.fRegenerable &&
+            lhs.fSeed == rhs.fSeed);
   }
 
   /**
@@ -121,6 +126,13 @@ public:
    * Note: use the covIndex argument to AddParameter to specify the index
    * in the covariance matrix that corresponds to a particular parameter.
    *
+   * Correlated throws are supported for multisim reweighting only. The
+   * covariance matrix is in the units of the parameters, so the widths of
+   * the parameters are not used: each universe value is the parameter mean
+   * plus the element at its covIndex of L z, where L is the Cholesky factor
+   * of the matrix (computed once per Sample() call) and z a vector of
+   * standard normal throws.
+   *
    * @param cov The covariance matrix
    */
   void SetCovarianceMatrix(TMatrixD* cov) { fCovarianceMatrix = cov; }
@@ -141,12 +153,144 @@ public:
    */
   void Sample(CLHEP::HepRandomEngine& engine);
 
+  /**
+   * Perform the random sampling with a counter-based generator.
+   *
+   * This is equivalent to Sample(), except that random numbers are not drawn
+   * from a shared engine: the Gaussian throws of each universe are computed
+   * by a Philox4x32 generator keyed on the seed and the name of the
+   * parameter set, with the universe and the parameter (or covariance
+   * index) as counter. The result depends only on the seed and on the
+   * configuration of the set, not on the number of threads nor on the order
+   * in which sets are sampled, so different parameter sets can be sampled
+   * concurrently and universes are themselves sampled in parallel blocks.
+   *
+   * The throws differ from the ones of Sample() with any engine.
+   *
+   * @param seed Seed of the generator
+   * @param nThreads Maximum number of threads to use (0: no limit)
+   */
+  void SampleCounterBased(std::uint64_t seed, unsigned int nThreads=0);
+
+  /**
+   * Set up the parameter set to regenerate its universes on demand.
+   *
+   * For multisim reweighting, no universe is sampled nor stored: only the
+   * seed is kept, and the values of any universe are computed when needed
+   * by an EventWeightUniverseGenerator. They are the same values that
+   * SampleCounterBased() with the same seed would store. The size of the
+   * set does not depend on the number of universes, so the set can be
+   * cheaply stored (e.g. in an EventWeightParameterSetRegistry) by
+   * calculators which are cheap to re-evaluate. Values previously sampled
+   * are discarded.
+   *
+   * The other reweight types have only a few values, which are filled as in
+   * Sample().
+   *
+   * This function should be called only after the parameter set has been
+   * configured and all parameters have been added.
+   *
+   * @param seed Seed of the counter-based generator
+   */
+  void SetRegenerable(std::uint64_t seed);
+
+  /** Returns whether the universes are regenerated on demand. */
+  bool IsRegenerable() const { return fRegenerable; }
+
+private:
+  friend class EventWeightUniverseGenerator;
+
+  /** Fills the values of the reweight types without random throws. */
+  void FillDeterministicValues();
+
+  /** Returns the Cholesky factor (row-major n x n) of the covariance matrix. */
+  std::vector<double> CholeskyFactor() const;
+
 public:
   std::map<EventWeightParameter, std::vector<float> > fParameterMap;  //!< Mapping of definitions to the set of values
   TMatrixD* fCovarianceMatrix;  //!< Covariance matrix for correlated throws (optional)
   std::string fName;  //!< Name of the parameter set
   ReweightType fRWType;  //!< Type of throws (the same for all parameters in a set)
   size_t fNuniverses;  //!< Number of universes (i.e. random throws)
+  bool fRegenerable;  //!< Whether universes are regenerated from fSeed instead of stored
+  std::uint64_t fSeed;  //!< Seed of the regenerated universes (see SetRegenerable())
+};
+
+
+/**
+ * @class EventWeightUniverseGenerator
+ * @brief Computes the parameter values of single universes of a set.
+ *
+ * For a regenerable parameter set (EventWeightParameterSet::SetRegenerable())
+ * the values of each universe are computed from the seed of the set, with the
+ * counter-based generator of EventWeightParameterSet::SampleCounterBased():
+ * each universe is independent of the others, so universes can be computed
+ * in any order and from any thread. For the other sets, the stored values
+ * are returned.
+ *
+ * Example:
+ *
+ *     sbn::evwgh::EventWeightUniverseGenerator const generator(parameterSet);
+ *     std::vector<float> values(generator.NParameters());
+ *     for (size_t u=0; u<generator.NUniverses(); u++) {
+ *       generator.Universe(u, values.data());
+ *       // ...
+ *     }
+ *
+ * The generator refers to the parameter set, which must not be changed or
+ * destroyed while the generator is in use.
+ */
+class EventWeightUniverseGenerator {
+public:
+  /**
+   * Constructor: universes of the specified parameter set.
+   *
+   * @param parameterSet The parameter set (stored or regenerable)
+   */
+  explicit EventWeightUniverseGenerator(const EventWeightParameterSet& parameterSet);
+
+  /**
+   * Constructor: universes thrown with the specified seed.
+   *
+   * The multisim universes are the ones SampleCounterBased(seed) would fill,
+   * whether the set stores values or not. For the other reweight types, the
+   * stored values are returned.
+   *
+   * @param parameterSet The parameter set
+   * @param seed Seed of the counter-based generator
+   */
+  EventWeightUniverseGenerator(const EventWeightParameterSet& parameterSet,
+                               std::uint64_t seed);
+
+  /** Returns the number of parameters. */
+  size_t NParameters() const { return fParameters.size(); }
+
+  /** Returns the number of universes. */
+  size_t NUniverses() const { return fNuniverses; }
+
+  /**
+   * Computes the values of all the parameters for one universe.
+   *
+   * @param universe Index of the universe (less than NUniverses())
+   * @param values Room for NParameters() values, in the order of fParameterMap
+   */
+  void Universe(size_t universe, float* values) const;
+
+  /** Returns the values of all the parameters for one universe. */
+  std::vector<float> Universe(size_t universe) const;
+
+private:
+  /** Constructor: counter-based universes with the seed, or stored ones. */
+  EventWeightUniverseGenerator(const EventWeightParameterSet& parameterSet,
+                               std::uint64_t seed, bool counterBased);
+
+  std::vector<const EventWeightParameter*> fParameters;  //!< Parameters, in map order
+  std::vector<const std::vector<float>*> fStoredValues;  //!< Values of stored sets
+  size_t fNuniverses;  //!< Number of universes
+  bool fCounterBased;  //!< Whether values are computed (or stored)
+  Philox4x32::Key fKey;  //!< Key of the counter-based generator
+  size_t fNcov;  //!< Size of the covariance matrix (0 if uncorrelated)
+  std::vector<double> fCholesky;  //!< Cholesky factor of the covariance matrix
 };
 
   }  // namespace evwgh
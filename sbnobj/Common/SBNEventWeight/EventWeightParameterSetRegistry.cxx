@@ -0,0 +1,37 @@
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "EventWeightParameterSetRegistry.h"
+
+namespace sbn {
+  namespace evwgh {
+
+EventWeightParameterSetID EventWeightParameterSetRegistry::Find(
+    const std::string& name) const {
+  EventWeightParameterSetID id;
+  for (size_t i=0; i<fSets.size(); i++) {
+    if (fSets[i].fName == name) {
+      id.fIndex = i;
+      break;
+    }
+  }
+  return id;
+}
+
+
+EventWeightParameterSetID EventWeightParameterSetRegistry::Add(
+    const EventWeightParameterSet& parameterSet) {
+  EventWeightParameterSetID id = Find(parameterSet.fName);
+  if (id.IsValid()) {
+    if (fSets[id.fIndex] == parameterSet) return id;
+    throw std::runtime_error("EventWeightParameterSetRegistry: a different "
+                             "parameter set named " + parameterSet.fName
+                             + " is already registered");
+  }
+  fSets.push_back(parameterSet);
+  id.fIndex = fSets.size() - 1;
+  return id;
+}
+
+  }  // namespace evwgh
+}  // namespace sbn
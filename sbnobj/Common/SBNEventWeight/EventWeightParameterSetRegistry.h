@@ -0,0 +1,81 @@
+#ifndef _SBN_EVENTWEIGHTPARAMETERSETREGISTRY_H_
+#define _SBN_EVENTWEIGHTPARAMETERSETREGISTRY_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "sbnobj/Common/SBNEventWeight/EventWeightParameterSet.h"
+
+namespace sbn {
+  namespace evwgh {
+
+/**
+ * @struct EventWeightParameterSetID
+ * @brief Per-event reference to a parameter set in a registry.
+ */
+struct EventWeightParameterSetID {
+  /** Value of an invalid reference. */
+  static constexpr unsigned int kInvalid = static_cast<unsigned int>(-1);
+
+  unsigned int fIndex = kInvalid;  //!< Index of the set in the registry
+
+  bool IsValid() const { return fIndex != kInvalid; }
+
+  inline friend bool operator==(const EventWeightParameterSetID& lhs,
+                                const EventWeightParameterSetID& rhs) {
+    return lhs.fIndex == rhs.fIndex;
+  }
+};
+
+
+/**
+ * @class EventWeightParameterSetRegistry
+ * @brief Collection of the parameter sets sampled for a whole job.
+ *
+ * The sampled values of a parameter set are fixed for the whole job.
+ * Instead of storing a copy of each set in every event (e.g. through an
+ * `art::Assns<simb::MCTruth, EventWeightParameterSet>`), a producer can
+ * store this registry once per run or subrun and, in each event, only an
+ * `EventWeightParameterSetID` per set (e.g. through an
+ * `art::Assns<simb::MCTruth, EventWeightParameterSetID>`).
+ */
+class EventWeightParameterSetRegistry {
+public:
+  /** Returns the number of registered parameter sets. */
+  size_t size() const { return fSets.size(); }
+
+  /**
+   * Returns the parameter set with the specified ID.
+   *
+   * @throw std::out_of_range if the ID does not refer to a registered set
+   */
+  const EventWeightParameterSet& Get(EventWeightParameterSetID id) const {
+    return fSets.at(id.fIndex);
+  }
+
+  /** Returns the ID of the named parameter set (invalid if not present). */
+  EventWeightParameterSetID Find(const std::string& name) const;
+
+  /**
+   * Registers a parameter set, and returns its ID.
+   *
+   * Registering again a set identical to a registered one returns the ID of
+   * that one.
+   *
+   * @throw std::runtime_error if a different set with the same name is
+   *        already registered
+   */
+  EventWeightParameterSetID Add(const EventWeightParameterSet& parameterSet);
+
+  inline friend bool operator==(const EventWeightParameterSetRegistry& lhs,
+                                const EventWeightParameterSetRegistry& rhs) {
+    return lhs.fSets == rhs.fSets;
+  }
+
+  std::vector<EventWeightParameterSet> fSets;  //!< The registered sets, by ID
+};
+
+  }  // namespace evwgh
+}  // namespace sbn
+
+#endif  // _SBN_EVENTWEIGHTPARAMETERSETREGISTRY_H_
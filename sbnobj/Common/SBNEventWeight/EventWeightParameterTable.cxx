@@ -0,0 +1,72 @@
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "EventWeightParameterTable.h"
+
+namespace sbn {
+  namespace evwgh {
+
+EventWeightParameterTable::EventWeightParameterTable(
+    const EventWeightParameterSet& parameterSet) {
+
+  const size_t n = parameterSet.fParameterMap.size();
+  fNames.reserve(n);
+  fMeans.reserve(n);
+  fWidths.reserve(n);
+  fCovIndices.reserve(n);
+  fMultiWidths.reserve(n);
+  fIndex.reserve(n);
+
+  fNuniverses = n ? parameterSet.fParameterMap.begin()->second.size() : 0;
+  fValues.resize(n * fNuniverses);
+
+  size_t i = 0;
+  for (auto const& it : parameterSet.fParameterMap) {
+    const EventWeightParameter& p = it.first;
+    if (it.second.size() != fNuniverses) {
+      throw std::runtime_error("EventWeightParameterTable: parameter " + p.fName
+                               + " has " + std::to_string(it.second.size())
+                               + " values, while other parameters have "
+                               + std::to_string(fNuniverses));
+    }
+    fNames.push_back(p.fName);
+    fMeans.push_back(p.fMean);
+    fWidths.push_back(p.fWidth);
+    fCovIndices.push_back(p.fCovIndex);
+    fMultiWidths.push_back(p.fWidths);
+    fIndex.emplace(p.fName, i);
+    for (size_t u=0; u<fNuniverses; u++) fValues[u * n + i] = it.second[u];
+    i++;
+  }
+}
+
+
+size_t EventWeightParameterTable::Index(const std::string& name) const {
+  auto it = fIndex.find(name);
+  return (it == fIndex.end()) ? kInvalidIndex : it->second;
+}
+
+
+EventWeightParameterSet EventWeightParameterTable::ToParameterSet(
+    const std::string& name, EventWeightParameterSet::ReweightType rwtype) const {
+
+  EventWeightParameterSet parameterSet;
+  parameterSet.Configure(name, rwtype, fNuniverses);
+  parameterSet.fNuniverses = fNuniverses;
+
+  for (size_t i=0; i<NParameters(); i++) {
+    EventWeightParameter p = fMultiWidths[i].empty()
+      ? EventWeightParameter(fNames[i], fMeans[i], fWidths[i], fCovIndices[i])
+      : EventWeightParameter(fNames[i], fMeans[i], fMultiWidths[i], fCovIndices[i]);
+    p.fWidth = fWidths[i];
+
+    std::vector<float> values(fNuniverses);
+    for (size_t u=0; u<fNuniverses; u++) values[u] = Value(u, i);
+    parameterSet.fParameterMap.emplace(std::move(p), std::move(values));
+  }
+  return parameterSet;
+}
+
+  }  // namespace evwgh
+}  // namespace sbn
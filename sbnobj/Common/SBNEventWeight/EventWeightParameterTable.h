@@ -0,0 +1,111 @@
+#ifndef _SBN_EVENTWEIGHTPARAMETERTABLE_H_
+#define _SBN_EVENTWEIGHTPARAMETERTABLE_H_
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "sbnobj/Common/SBNEventWeight/EventWeightParameterSet.h"
+
+namespace sbn {
+  namespace evwgh {
+
+/**
+ * @class EventWeightParameterTable
+ * @brief Flat, index-based view of the parameters of a parameter set.
+ *
+ * The parameters of an `EventWeightParameterSet` are identified by a
+ * position (in name order, as in `fParameterMap`) and their properties are
+ * stored each in its own array. The sampled values are stored in a single
+ * universe-major matrix: the values of all the parameters for one universe
+ * are contiguous. The position of a parameter is found by name once (with
+ * `Index()`), and all the other accessors take constant time.
+ *
+ * Example:
+ *
+ *     sbn::evwgh::EventWeightParameterTable table(parameterSet);
+ *     size_t iMA = table.Index("MaCCQE");
+ *     for (size_t u=0; u<table.NUniverses(); u++) {
+ *       float MA = table.Value(u, iMA);
+ *       // ...
+ *     }
+ *
+ * The table is not meant to be persisted: `ToParameterSet()` converts it back
+ * into the persistent `EventWeightParameterSet`.
+ */
+class EventWeightParameterTable {
+public:
+  /** Index of a parameter not in the table. */
+  static constexpr size_t kInvalidIndex = static_cast<size_t>(-1);
+
+  /** Default constructor: no parameters. */
+  EventWeightParameterTable() = default;
+
+  /**
+   * Constructor: copies the parameters and values of a parameter set.
+   *
+   * All the parameters must have the same number of values (universes).
+   *
+   * @param parameterSet The parameter set to be copied
+   */
+  explicit EventWeightParameterTable(const EventWeightParameterSet& parameterSet);
+
+  /** Returns the number of parameters. */
+  size_t NParameters() const { return fNames.size(); }
+
+  /** Returns the number of universes. */
+  size_t NUniverses() const { return fNuniverses; }
+
+  /** Returns the index of the named parameter, kInvalidIndex if not present. */
+  size_t Index(const std::string& name) const;
+
+  /** Returns the name of the i-th parameter. */
+  const std::string& Name(size_t i) const { return fNames[i]; }
+
+  /** Returns the Gaussian mean of the i-th parameter. */
+  float Mean(size_t i) const { return fMeans[i]; }
+
+  /** Returns the Gaussian sigma of the i-th parameter. */
+  float Width(size_t i) const { return fWidths[i]; }
+
+  /** Returns the covariance matrix index of the i-th parameter. */
+  size_t CovIndex(size_t i) const { return fCovIndices[i]; }
+
+  /** Returns the widths of the i-th parameter for multi sigma modes. */
+  const std::vector<float>& MultiWidths(size_t i) const { return fMultiWidths[i]; }
+
+  /** Returns the value of the i-th parameter in the specified universe. */
+  float Value(size_t universe, size_t i) const {
+    return fValues[universe * NParameters() + i];
+  }
+
+  /** Returns a pointer to the values of all parameters in a universe. */
+  const float* UniverseValues(size_t universe) const {
+    return fValues.data() + universe * NParameters();
+  }
+
+  /**
+   * Returns a parameter set with the content of this table.
+   *
+   * @param name Name of the parameter set
+   * @param rwtype Type of throws of the parameter set
+   */
+  EventWeightParameterSet ToParameterSet(
+      const std::string& name, EventWeightParameterSet::ReweightType rwtype) const;
+
+private:
+  std::vector<std::string> fNames;  //!< Parameter names
+  std::vector<float> fMeans;  //!< Gaussian means
+  std::vector<float> fWidths;  //!< Gaussian sigmas
+  std::vector<size_t> fCovIndices;  //!< Indices in the covariance matrix
+  std::vector<std::vector<float> > fMultiWidths;  //!< Widths for multi sigma modes
+  size_t fNuniverses = 0;  //!< Number of universes
+  std::vector<float> fValues;  //!< Values, universe-major
+
+  std::unordered_map<std::string, size_t> fIndex;  //!< Position of each name
+};
+
+  }  // namespace evwgh
+}  // namespace sbn
+
+#endif  // _SBN_EVENTWEIGHTPARAMETERTABLE_H_
@@ -0,0 +1,215 @@
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "FlatEventWeightMap.h"
+
+namespace sbn {
+  namespace evwgh {
+
+size_t EventWeightCalculatorRegistry::Find(const std::string& name) const {
+  auto it = std::find(fNames.begin(), fNames.end(), name);
+  return (it == fNames.end()) ? kInvalidIndex : (it - fNames.begin());
+}
+
+
+EventWeightCalculatorHandle EventWeightCalculatorRegistry::Handle(
+    const std::string& name) const {
+  EventWeightCalculatorHandle handle;
+  size_t index = Find(name);
+  if (index != kInvalidIndex) handle.fIndex = index;
+  return handle;
+}
+
+
+size_t EventWeightCalculatorRegistry::Add(const std::string& name) {
+  size_t index = Find(name);
+  if (index != kInvalidIndex) return index;
+  fNames.push_back(name);
+  return fNames.size() - 1;
+}
+
+
+WeightSpan FlatEventWeightMap::WeightsOf(size_t calculator) const {
+  auto it = std::lower_bound(fCalculators.begin(), fCalculators.end(), calculator);
+  if (it == fCalculators.end() || *it != calculator) return {};
+  return Weights(it - fCalculators.begin());
+}
+
+
+WeightSpan FlatEventWeightMap::Weights(EventWeightCalculatorHandle calculator) const {
+  if (!calculator.IsValid()) return {};
+  // calculators are sorted by unique index: if the event has all the
+  // calculators before this one, it's at the position of its index
+  const size_t index = calculator.fIndex;
+  if (index < fCalculators.size() && fCalculators[index] == index) {
+    return Weights(index);
+  }
+  return WeightsOf(index);
+}
+
+
+void FlatEventWeightMap::Add(size_t calculator, const float* first, size_t n) {
+  if (!fCalculators.empty() && calculator <= fCalculators.back()) {
+    throw std::runtime_error("FlatEventWeightMap: calculator "
+                             + std::to_string(calculator)
+                             + " added after calculator "
+                             + std::to_string(fCalculators.back()));
+  }
+  fCalculators.push_back(calculator);
+  fWeights.insert(fWeights.end(), first, first + n);
+  fOffsets.push_back(fWeights.size());
+}
+
+
+FlatEventWeightMap MakeFlatEventWeightMap(const EventWeightMap& weights,
+                                          EventWeightCalculatorRegistry& registry) {
+  // registry indices of the calculators, sorted as they need to be added
+  std::vector<std::pair<size_t, const std::vector<float>*> > columns;
+  columns.reserve(weights.size());
+  size_t nWeights = 0;
+  for (auto const& it : weights) {
+    columns.emplace_back(registry.Add(it.first), &it.second);
+    nWeights += it.second.size();
+  }
+  std::sort(columns.begin(), columns.end());
+
+  FlatEventWeightMap flat;
+  flat.fCalculators.reserve(columns.size());
+  flat.fOffsets.reserve(columns.size() + 1);
+  flat.fWeights.reserve(nWeights);
+  for (auto const& column : columns) {
+    flat.Add(column.first, column.second->data(), column.second->size());
+  }
+  return flat;
+}
+
+
+EventWeightMap MakeEventWeightMap(const FlatEventWeightMap& weights,
+                                  const EventWeightCalculatorRegistry& registry) {
+  EventWeightMap map;
+  for (size_t i=0; i<weights.size(); i++) {
+    WeightSpan w = weights.Weights(i);
+    map.emplace(registry.Name(weights.Calculator(i)),
+                std::vector<float>(w.begin(), w.end()));
+  }
+  return map;
+}
+
+
+FlatEventWeightMerger::FlatEventWeightMerger(
+    const std::vector<const EventWeightCalculatorRegistry*>& registries) {
+  // producer of each calculator name
+  std::unordered_map<std::string_view, size_t> owners;
+  size_t nNames = 0;
+  for (auto const* registry : registries) nNames += registry->size();
+  owners.reserve(nNames);
+  fRegistry.fNames.reserve(nNames);
+  fIndices.reserve(registries.size());
+
+  std::string collisions;
+  for (size_t i=0; i<registries.size(); i++) {
+    std::vector<unsigned int>& indices = fIndices.emplace_back();
+    indices.reserve(registries[i]->size());
+    for (auto const& name : registries[i]->fNames) {
+      auto const [ owner, inserted ] = owners.emplace(name, i);
+      if (!inserted) {
+        collisions += " '" + name + "' (#" + std::to_string(owner->second)
+          + " and #" + std::to_string(i) + ")";
+        continue;
+      }
+      indices.push_back(fRegistry.fNames.size());
+      fRegistry.fNames.push_back(name);
+    }
+  }
+  if (!collisions.empty()) {
+    throw std::runtime_error("FlatEventWeightMerger: calculators from more"
+                             " than one producer:" + collisions);
+  }
+}
+
+
+FlatEventWeightMap FlatEventWeightMerger::Merge(
+    const std::vector<const FlatEventWeightMap*>& weights) const {
+  CheckProducers(weights.size());
+
+  size_t nCalculators = 0, nWeights = 0;
+  for (auto const* w : weights) {
+    if (!w) continue;
+    nCalculators += w->size();
+    nWeights += w->fWeights.size();
+  }
+
+  FlatEventWeightMap merged;
+  merged.fCalculators.reserve(nCalculators);
+  merged.fOffsets.reserve(nCalculators + 1);
+  merged.fWeights.reserve(nWeights);
+  for (size_t i=0; i<weights.size(); i++) {
+    if (weights[i]) Append(merged, i, *weights[i]);
+  }
+  return merged;
+}
+
+
+FlatEventWeightMap FlatEventWeightMerger::Merge(
+    std::vector<FlatEventWeightMap>&& weights) const {
+  CheckProducers(weights.size());
+  if (weights.empty()) return {};
+
+  size_t nCalculators = 0, nWeights = 0;
+  for (auto const& w : weights) {
+    nCalculators += w.size();
+    nWeights += w.fWeights.size();
+  }
+
+  // the first producer has the lowest merged indices: its weights stay put
+  FlatEventWeightMap merged = std::move(weights.front());
+  std::vector<unsigned int> const& indices = fIndices.front();
+  for (unsigned int& calculator : merged.fCalculators) {
+    if (calculator >= indices.size()) {
+      throw std::runtime_error("FlatEventWeightMerger: calculator "
+                               + std::to_string(calculator)
+                               + " not in the registry of producer #0");
+    }
+    calculator = indices[calculator];
+  }
+  merged.fCalculators.reserve(nCalculators);
+  merged.fOffsets.reserve(nCalculators + 1);
+  merged.fWeights.reserve(nWeights);
+  for (size_t i=1; i<weights.size(); i++) Append(merged, i, weights[i]);
+  return merged;
+}
+
+
+void FlatEventWeightMerger::Append(FlatEventWeightMap& merged, size_t producer,
+                                   const FlatEventWeightMap& weights) const {
+  std::vector<unsigned int> const& indices = fIndices[producer];
+  unsigned int const base = merged.fWeights.size();
+  for (size_t i=0; i<weights.size(); i++) {
+    unsigned int const calculator = weights.fCalculators[i];
+    if (calculator >= indices.size()) {
+      throw std::runtime_error("FlatEventWeightMerger: calculator "
+                               + std::to_string(calculator)
+                               + " not in the registry of producer #"
+                               + std::to_string(producer));
+    }
+    merged.fCalculators.push_back(indices[calculator]);
+    merged.fOffsets.push_back(base + weights.fOffsets[i + 1]);
+  }
+  merged.fWeights.insert(merged.fWeights.end(),
+                         weights.fWeights.begin(), weights.fWeights.end());
+}
+
+
+void FlatEventWeightMerger::CheckProducers(size_t nProducers) const {
+  if (nProducers == fIndices.size()) return;
+  throw std::runtime_error("FlatEventWeightMerger: weights from "
+                           + std::to_string(nProducers) + " producers, "
+                           + std::to_string(fIndices.size()) + " expected");
+}
+
+  }  // namespace evwgh
+}  // namespace sbn
@@ -0,0 +1,274 @@
+#ifndef _SBN_FLATEVENTWEIGHTMAP_H_
+#define _SBN_FLATEVENTWEIGHTMAP_H_
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include "sbnobj/Common/SBNEventWeight/EventWeightMap.h"
+
+namespace sbn {
+  namespace evwgh {
+
+/**
+ * @struct WeightSpan
+ * @brief Non-owning view of the weights of one calculator, one per universe.
+ */
+struct WeightSpan {
+  const float* fFirst = nullptr;  //!< Pointer to the first weight
+  size_t fSize = 0;  //!< Number of weights
+
+  const float* begin() const { return fFirst; }
+  const float* end() const { return fFirst + fSize; }
+  size_t size() const { return fSize; }
+  bool empty() const { return fSize == 0; }
+  float operator[](size_t i) const { return fFirst[i]; }
+};
+
+
+/**
+ * @struct EventWeightCalculatorHandle
+ * @brief Reference to a weight calculator, resolved once from its name.
+ *
+ * A handle is obtained from the calculator name with
+ * `EventWeightCalculatorRegistry::Handle()`, typically once per job (or
+ * whenever a new registry is read), and then used on each event to access
+ * the weights of that calculator with `FlatEventWeightMap::Weights()`,
+ * with no string comparison:
+ *
+ *     sbn::evwgh::EventWeightCalculatorHandle const genie
+ *       = registry.Handle("genie_multisim");
+ *     // ... for each event:
+ *     sbn::evwgh::WeightSpan const weights = flatWeights.Weights(genie);
+ *
+ * A handle is valid only with the registry it was obtained from.
+ */
+struct EventWeightCalculatorHandle {
+  /** Value of an invalid handle. */
+  static constexpr unsigned int kInvalid = static_cast<unsigned int>(-1);
+
+  unsigned int fIndex = kInvalid;  //!< Index of the calculator in the registry
+
+  bool IsValid() const { return fIndex != kInvalid; }
+
+  inline friend bool operator==(const EventWeightCalculatorHandle& lhs,
+                                const EventWeightCalculatorHandle& rhs) {
+    return lhs.fIndex == rhs.fIndex;
+  }
+};
+
+
+/**
+ * @class EventWeightCalculatorRegistry
+ * @brief List of weight calculator names, shared by many events.
+ *
+ * Each name is stored once, and identified by its index in the list.
+ * This is meant to be stored once per subrun (or run), next to the
+ * `FlatEventWeightMap` of each event which refers to these indices.
+ */
+class EventWeightCalculatorRegistry {
+public:
+  /** Index of a calculator not in the registry. */
+  static constexpr size_t kInvalidIndex = static_cast<size_t>(-1);
+
+  /** Returns the number of registered calculators. */
+  size_t size() const { return fNames.size(); }
+
+  /** Returns the name of the calculator with the specified index. */
+  const std::string& Name(size_t index) const { return fNames.at(index); }
+
+  /** Returns the index of the named calculator, kInvalidIndex if not present. */
+  size_t Find(const std::string& name) const;
+
+  /** Returns a handle to the named calculator (invalid if not present). */
+  EventWeightCalculatorHandle Handle(const std::string& name) const;
+
+  /** Returns the index of the named calculator, registering it if needed. */
+  size_t Add(const std::string& name);
+
+  inline friend bool operator==(const EventWeightCalculatorRegistry& lhs,
+                                const EventWeightCalculatorRegistry& rhs) {
+    return lhs.fNames == rhs.fNames;
+  }
+
+  std::vector<std::string> fNames;  //!< Calculator names, by index
+};
+
+
+/**
+ * @class FlatEventWeightMap
+ * @brief Columnar container for event-level weights.
+ *
+ * This holds the same information as an `EventWeightMap`, with all the
+ * weights of the event in a single contiguous vector: the weights of the
+ * calculator `fCalculators[i]` are the ones from `fOffsets[i]` to
+ * `fOffsets[i + 1]`. Calculators are identified by their index in an
+ * `EventWeightCalculatorRegistry` rather than by name, and they are sorted
+ * by that index.
+ *
+ * Use `MakeFlatEventWeightMap()` and `MakeEventWeightMap()` to convert
+ * from and to `EventWeightMap`.
+ */
+class FlatEventWeightMap {
+public:
+  /** Returns the number of calculators in the event. */
+  size_t size() const { return fCalculators.size(); }
+
+  /** Returns the registry index of the i-th calculator of the event. */
+  size_t Calculator(size_t i) const { return fCalculators[i]; }
+
+  /** Returns the weights of the i-th calculator of the event. */
+  WeightSpan Weights(size_t i) const {
+    return { fWeights.data() + fOffsets[i], fOffsets[i + 1] - fOffsets[i] };
+  }
+
+  /**
+   * Returns the weights of the calculator with the specified registry index.
+   * An empty span is returned if that calculator is not in the event.
+   */
+  WeightSpan WeightsOf(size_t calculator) const;
+
+  /**
+   * Returns the weights of the calculator with the specified handle.
+   * An empty span is returned if that calculator is not in the event, or if
+   * the handle is invalid.
+   *
+   * When the event has all the calculators registered up to the requested
+   * one, as it is usually the case, the calculator is found in constant
+   * time; otherwise, with a binary search on the registry indices.
+   */
+  WeightSpan Weights(EventWeightCalculatorHandle calculator) const;
+
+  /**
+   * Appends the weights of a calculator.
+   *
+   * Calculators must be added in increasing registry index.
+   *
+   * @param calculator Registry index of the calculator
+   * @param first Pointer to the first weight
+   * @param n Number of weights
+   */
+  void Add(size_t calculator, const float* first, size_t n);
+
+  inline friend bool operator==(const FlatEventWeightMap& lhs,
+                                const FlatEventWeightMap& rhs) {
+    return (lhs.fCalculators == rhs.fCalculators &&
+            lhs.fOffsets == rhs.fOffsets &&
+            lhs.fWeights == rhs.fWeights);
+  }
+
+  std::vector<unsigned int> fCalculators;  //!< Registry index of calculators
+  std::vector<unsigned int> fOffsets{ 0 };  //!< Start of weights, plus end
+  std::vector<float> fWeights;  //!< Weights of all calculators and universes
+};
+
+
+/**
+ * Converts an `EventWeightMap` into columnar form.
+ *
+ * Calculators not yet in the registry are added to it.
+ *
+ * @param weights The weights to be converted
+ * @param registry The registry of calculator names
+ * @return The same weights, in columnar form
+ */
+FlatEventWeightMap MakeFlatEventWeightMap(const EventWeightMap& weights,
+                                          EventWeightCalculatorRegistry& registry);
+
+/**
+ * Converts columnar weights back into an `EventWeightMap`.
+ *
+ * @param weights The weights to be converted
+ * @param registry The registry of calculator names used for `weights`
+ * @return The same weights, keyed by calculator name
+ */
+EventWeightMap MakeEventWeightMap(const FlatEventWeightMap& weights,
+                                  const EventWeightCalculatorRegistry& registry);
+
+
+/**
+ * @class FlatEventWeightMerger
+ * @brief Merges the columnar weights from many producers into one.
+ *
+ * Each producer has its own `EventWeightCalculatorRegistry`. The merger is
+ * created once from all of them (typically, once per subrun), and it checks
+ * there that no calculator name comes from more than one producer. The
+ * merged registry has the calculators of the first producer, then the ones
+ * of the second, and so on, so that on each event the weights of the
+ * producers are merged by appending each one in turn, with no lookup and
+ * no sorting:
+ *
+ *     sbn::evwgh::FlatEventWeightMerger const merger
+ *       { { &fluxRegistry, &genieRegistry, &geant4Registry } };
+ *     // ... for each event:
+ *     sbn::evwgh::FlatEventWeightMap const weights
+ *       = merger.Merge({ &fluxWeights, &genieWeights, &geant4Weights });
+ *
+ * The weights of the whole event are copied once into the contiguous storage
+ * of the result; the version of `Merge()` taking the producer maps by value
+ * reuses the storage of the first one instead.
+ */
+class FlatEventWeightMerger {
+public:
+  /**
+   * Builds the merged registry.
+   *
+   * @param registries The registries of all the producers, in order
+   * @throw std::runtime_error if a name is in more than one registry
+   */
+  explicit FlatEventWeightMerger(
+    const std::vector<const EventWeightCalculatorRegistry*>& registries);
+
+  /** Returns the number of producers. */
+  size_t NProducers() const { return fIndices.size(); }
+
+  /** Returns the registry of the merged weights. */
+  const EventWeightCalculatorRegistry& Registry() const { return fRegistry; }
+
+  /**
+   * Returns the merged registry index of a calculator of a producer.
+   *
+   * @param producer Position of the producer in the merger
+   * @param calculator Registry index of the calculator in its producer
+   */
+  unsigned int Index(size_t producer, size_t calculator) const {
+    return fIndices.at(producer).at(calculator);
+  }
+
+  /**
+   * Merges the weights of one event.
+   *
+   * @param weights The weights of each producer, in the order of the
+   *                registries at construction; `nullptr` for a producer
+   *                with no weights in this event
+   * @return All the weights, referring to `Registry()`
+   * @throw std::runtime_error if the number of producers does not match,
+   *        or a calculator is not in the registry of its producer
+   */
+  FlatEventWeightMap Merge(
+    const std::vector<const FlatEventWeightMap*>& weights) const;
+
+  /**
+   * Merges the weights of one event, reusing the storage of the first one.
+   *
+   * @see Merge(const std::vector<const FlatEventWeightMap*>&) const
+   */
+  FlatEventWeightMap Merge(std::vector<FlatEventWeightMap>&& weights) const;
+
+private:
+  EventWeightCalculatorRegistry fRegistry;  //!< Merged calculator names
+
+  /** Merged registry index of each calculator, by producer. */
+  std::vector<std::vector<unsigned int> > fIndices;
+
+  /** Appends the weights of a producer to `merged`. */
+  void Append(FlatEventWeightMap& merged, size_t producer,
+              const FlatEventWeightMap& weights) const;
+
+  /** Throws unless there are weights for all the producers. */
+  void CheckProducers(size_t nProducers) const;
+};
+
+  }  // namespace evwgh
+}  // namespace sbn
+
+#endif  // _SBN_FLATEVENTWEIGHTMAP_H_
@@ -0,0 +1,103 @@
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "KnobResponseSplines.h"
+
+namespace sbn {
+  namespace evwgh {
+
+size_t KnobResponseSplines::Find(size_t parameter) const {
+  auto it = std::lower_bound(fParameters.begin(), fParameters.end(), parameter);
+  if (it == fParameters.end() || *it != parameter) return kInvalidIndex;
+  return it - fParameters.begin();
+}
+
+
+float KnobResponseSplines::Weight(size_t i, float knob) const {
+  if (i >= size()) {
+    throw std::out_of_range("KnobResponseSplines: no parameter with index "
+                            + std::to_string(i) + " (" + std::to_string(size())
+                            + " available)");
+  }
+
+  const float* x = fKnobs.data() + fOffsets[i];
+  const float* y = fWeights.data() + fOffsets[i];
+  const float* d = fSlopes.data() + fOffsets[i];
+  const size_t n = NKnobs(i);
+
+  if (knob <= x[0]) return y[0];
+  if (knob >= x[n-1]) return y[n-1];
+
+  // cubic Hermite interpolation in the interval [ x[k], x[k+1] [
+  const size_t k = std::upper_bound(x, x + n, knob) - x - 1;
+  const float h = x[k+1] - x[k];
+  const float t = (knob - x[k]) / h;
+  const float s = 1 - t;
+  return s * s * ((1 + 2 * t) * y[k] + t * h * d[k])
+    + t * t * ((3 - 2 * t) * y[k+1] - s * h * d[k+1]);
+}
+
+
+void KnobResponseSplines::Add(size_t parameter, const float* knobs,
+                              const float* weights, size_t n) {
+  if (!fParameters.empty() && parameter <= fParameters.back()) {
+    throw std::runtime_error("KnobResponseSplines: parameter "
+                             + std::to_string(parameter)
+                             + " added after parameter "
+                             + std::to_string(fParameters.back()));
+  }
+  if (n == 0) {
+    throw std::runtime_error("KnobResponseSplines: no knob value for parameter "
+                             + std::to_string(parameter));
+  }
+
+  std::vector<size_t> order(n);
+  std::iota(order.begin(), order.end(), size_t(0));
+  std::sort(order.begin(), order.end(),
+            [knobs](size_t a, size_t b){ return knobs[a] < knobs[b]; });
+  std::vector<double> x(n), y(n);
+  for (size_t j=0; j<n; j++) {
+    x[j] = knobs[order[j]];
+    y[j] = weights[order[j]];
+    if (j > 0 && x[j] == x[j-1]) {
+      throw std::runtime_error("KnobResponseSplines: knob value "
+                               + std::to_string(x[j])
+                               + " repeated for parameter "
+                               + std::to_string(parameter));
+    }
+  }
+
+  // second derivatives of the natural spline (zero at the ends), from the
+  // tridiagonal system solved with forward elimination and back substitution
+  std::vector<double> m(n, 0.0), c(n, 0.0);
+  for (size_t j=1; j+1<n; j++) {
+    const double h0 = x[j] - x[j-1], h1 = x[j+1] - x[j];
+    const double r = 6 * ((y[j+1] - y[j]) / h1 - (y[j] - y[j-1]) / h0);
+    const double b = 2 * (h0 + h1) - h0 * c[j-1];
+    c[j] = h1 / b;
+    m[j] = (r - h0 * m[j-1]) / b;
+  }
+  for (size_t j=n-1; j-->1; ) m[j] -= c[j] * m[j+1];
+
+  fParameters.push_back(parameter);
+  for (size_t j=0; j<n; j++) {
+    double slope = 0;
+    if (j + 1 < n) {
+      const double h = x[j+1] - x[j];
+      slope = (y[j+1] - y[j]) / h - h * (2 * m[j] + m[j+1]) / 6;
+    }
+    else if (n > 1) {
+      const double h = x[j] - x[j-1];
+      slope = (y[j] - y[j-1]) / h + h * (m[j-1] + 2 * m[j]) / 6;
+    }
+    fKnobs.push_back(x[j]);
+    fWeights.push_back(y[j]);
+    fSlopes.push_back(slope);
+  }
+  fOffsets.push_back(fKnobs.size());
+}
+
+  }  // namespace evwgh
+}  // namespace sbn
@@ -0,0 +1,95 @@
+#ifndef _SBN_KNOBRESPONSESPLINES_H_
+#define _SBN_KNOBRESPONSESPLINES_H_
+
+#include <cstddef>
+#include <vector>
+
+namespace sbn {
+  namespace evwgh {
+
+/**
+ * @class KnobResponseSplines
+ * @brief Event weight as a function of the knob value of each parameter.
+ *
+ * For parameter sets of discrete knob shifts (`kMultisigma` and `kPMNSigma`
+ * reweighting), a calculator evaluates the weight of the event at each of
+ * the knob values of a parameter (`fMean + fWidths[j]`). This object keeps,
+ * for each parameter, a natural cubic spline through those weights, so that
+ * the weight at any knob value is computed in a few operations, without
+ * storing more universes nor running the calculator again.
+ *
+ * Parameters are identified by their position in the parameter set (as in
+ * `EventWeightParameterTable`), and they are sorted by it. The spline of
+ * each parameter is stored in Hermite form: for each knob value, the weight
+ * and the derivative of the spline there. Outside the range of the knob
+ * values, the weight at the closest knob value is returned.
+ *
+ * Example, with `knobs` the values of the parameter in position `iParam`
+ * of a multisigma parameter set (from its `fParameterMap`), and `weights`
+ * the weights of the event at each of them:
+ *
+ *     sbn::evwgh::KnobResponseSplines splines;
+ *     splines.Add(iParam, knobs.data(), weights.data(), knobs.size());
+ *     // ... later:
+ *     size_t const i = splines.Find(iParam);
+ *     float w = (i == sbn::evwgh::KnobResponseSplines::kInvalidIndex)
+ *       ? 1.0f: splines.Weight(i, 0.5);
+ */
+class KnobResponseSplines {
+public:
+  /** Index of a parameter not in the splines. */
+  static constexpr size_t kInvalidIndex = static_cast<size_t>(-1);
+
+  /** Returns the number of parameters with a spline. */
+  size_t size() const { return fParameters.size(); }
+
+  /** Returns the position in the parameter set of the i-th parameter. */
+  size_t Parameter(size_t i) const { return fParameters[i]; }
+
+  /** Returns the index of the spline of a parameter, kInvalidIndex if none. */
+  size_t Find(size_t parameter) const;
+
+  /** Returns the number of knob values of the i-th parameter. */
+  size_t NKnobs(size_t i) const { return fOffsets[i + 1] - fOffsets[i]; }
+
+  /**
+   * Returns the weight of the i-th parameter at the specified knob value.
+   *
+   * @throw std::out_of_range if there is no i-th parameter (e.g. `i` is
+   *        `kInvalidIndex`, returned by `Find()` for a missing parameter)
+   */
+  float Weight(size_t i, float knob) const;
+
+  /**
+   * Appends the spline of the weights of a parameter.
+   *
+   * The knob values are sorted, and must be all different. Parameters must
+   * be added in increasing position.
+   *
+   * @param parameter Position of the parameter in the parameter set
+   * @param knobs Pointer to the first knob value
+   * @param weights Pointer to the weight at the first knob value
+   * @param n Number of knob values (and weights), at least one
+   */
+  void Add(size_t parameter, const float* knobs, const float* weights, size_t n);
+
+  inline friend bool operator==(const KnobResponseSplines& lhs,
+                                const KnobResponseSplines& rhs) {
+    return (lhs.fParameters == rhs.fParameters &&
+            lhs.fOffsets == rhs.fOffsets &&
+            lhs.fKnobs == rhs.fKnobs &&
+            lhs.fWeights == rhs.fWeights &&
+            lhs.fSlopes == rhs.fSlopes);
+  }
+
+  std::vector<unsigned int> fParameters;  //!< Position of parameters in their set
+  std::vector<unsigned int> fOffsets{ 0 };  //!< Start of knobs, plus end
+  std::vector<float> fKnobs;  //!< Sorted knob values of all parameters
+  std::vector<float> fWeights;  //!< Weight at each knob value
+  std::vector<float> fSlopes;  //!< Derivative of the spline at each knob value
+};
+
+  }  // namespace evwgh
+}  // namespace sbn
+
+#endif  // _SBN_KNOBRESPONSESPLINES_H_
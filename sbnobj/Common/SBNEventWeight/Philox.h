@@ -0,0 +1,75 @@
+#ifndef _SBN_PHILOX_H_
+#define _SBN_PHILOX_H_
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <string>
+
+namespace sbn {
+  namespace evwgh {
+
+/**
+ * @struct Philox4x32
+ * @brief Philox4x32-10 counter-based random number generator.
+ *
+ * The output is a pure function of a 128-bit counter and a 64-bit key
+ * (J. K. Salmon et al., "Parallel random numbers: as easy as 1, 2, 3",
+ * SC11), so any number of the sequence can be computed independently of
+ * the others, in any order and from any thread, with identical results.
+ */
+struct Philox4x32 {
+  typedef std::array<std::uint32_t, 4> Counter;
+  typedef std::array<std::uint32_t, 2> Key;
+
+  /** Returns the four random words for the specified counter and key. */
+  static Counter Generate(Counter ctr, Key key) {
+    for (int round=0; round<10; round++) {
+      const std::uint64_t p0 = std::uint64_t(0xD2511F53) * ctr[0];
+      const std::uint64_t p1 = std::uint64_t(0xCD9E8D57) * ctr[2];
+      ctr = {{ std::uint32_t(p1 >> 32) ^ ctr[1] ^ key[0], std::uint32_t(p1),
+               std::uint32_t(p0 >> 32) ^ ctr[3] ^ key[1], std::uint32_t(p0) }};
+      key[0] += 0x9E3779B9;
+      key[1] += 0xBB67AE85;
+    }
+    return ctr;
+  }
+
+  /**
+   * Returns a key from a seed and a name.
+   *
+   * The name is hashed (64-bit FNV-1a) and combined with the seed.
+   */
+  static Key MakeKey(std::uint64_t seed, const std::string& name) {
+    std::uint64_t h = 0xCBF29CE484222325ULL;
+    for (unsigned char c : name) {
+      h ^= c;
+      h *= 0x100000001B3ULL;
+    }
+    h ^= seed * 0x9E3779B97F4A7C15ULL;
+    return {{ std::uint32_t(h), std::uint32_t(h >> 32) }};
+  }
+
+  /**
+   * Returns a standard normal number for the specified key and indices.
+   *
+   * The two random 64-bit words for `(index, stream)` are turned into
+   * a normal number with the Box-Muller transformation.
+   */
+  static double Gaussian(Key key, std::uint64_t index, std::uint32_t stream) {
+    const Counter r = Generate(
+      {{ std::uint32_t(index), std::uint32_t(index >> 32), stream, 0 }}, key);
+    // uniform in ]0, 1] and [0, 1[, with 53 bits each
+    const double kScale = 1.0 / 9007199254740992.0;  // 2^-53
+    const double kTwoPi = 6.283185307179586;
+    const double u1
+      = ((((std::uint64_t(r[0]) << 32) | r[1]) >> 11) + 1) * kScale;
+    const double u2 = (((std::uint64_t(r[2]) << 32) | r[3]) >> 11) * kScale;
+    return std::sqrt(-2.0 * std::log(u1)) * std::cos(kTwoPi * u2);
+  }
+};
+
+  }  // namespace evwgh
+}  // namespace sbn
+
+#endif  // _SBN_PHILOX_H_
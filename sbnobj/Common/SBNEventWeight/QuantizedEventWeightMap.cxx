@@ -0,0 +1,108 @@
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "QuantizedEventWeightMap.h"
+
+namespace sbn {
+  namespace evwgh {
+
+namespace {
+  constexpr std::uint16_t kSignBit = 0x8000;  // sign of the weight
+  constexpr std::uint16_t kMaxLevel = 0x7FFF;  // largest magnitude code
+}
+
+
+double QuantizedEventWeightMap::MaxRelativeError(size_t i) const {
+  return std::expm1(fLogStep[i] / 2);
+}
+
+
+void QuantizedEventWeightMap::Decode(size_t i, float* buffer) const {
+  const std::uint16_t* codes = fCodes.data() + fOffsets[i];
+  size_t n = NWeights(i);
+  double logMin = fLogMin[i];
+  double logStep = fLogStep[i];
+  for (size_t j=0; j<n; j++) {
+    std::uint16_t level = codes[j] & kMaxLevel;
+    float w = (level == 0) ? 0.f : std::exp(logMin + (level - 1) * logStep);
+    buffer[j] = (codes[j] & kSignBit) ? -w : w;
+  }
+}
+
+
+std::vector<float> QuantizedEventWeightMap::Decode(size_t i) const {
+  std::vector<float> weights(NWeights(i));
+  Decode(i, weights.data());
+  return weights;
+}
+
+
+void QuantizedEventWeightMap::Add(size_t calculator, const float* first, size_t n) {
+  if (!fCalculators.empty() && calculator <= fCalculators.back()) {
+    throw std::runtime_error("QuantizedEventWeightMap: calculator "
+                             + std::to_string(calculator)
+                             + " added after calculator "
+                             + std::to_string(fCalculators.back()));
+  }
+
+  // range of the magnitudes of the non-zero weights
+  double logMin = 0, logMax = 0;
+  bool any = false;
+  for (size_t j=0; j<n; j++) {
+    if (!std::isfinite(first[j])) {
+      throw std::runtime_error("QuantizedEventWeightMap: weight #"
+                               + std::to_string(j) + " of calculator "
+                               + std::to_string(calculator) + " is not finite");
+    }
+    if (first[j] == 0) continue;
+    double l = std::log(std::abs(double(first[j])));
+    if (!any || l < logMin) logMin = l;
+    if (!any || l > logMax) logMax = l;
+    any = true;
+  }
+  double logStep = (logMax - logMin) / (kMaxLevel - 1);
+
+  fCalculators.push_back(calculator);
+  fLogMin.push_back(logMin);
+  fLogStep.push_back(logStep);
+  fCodes.reserve(fCodes.size() + n);
+  for (size_t j=0; j<n; j++) {
+    std::uint16_t code = 0;
+    if (first[j] != 0) {
+      double l = std::log(std::abs(double(first[j])));
+      double level = (logStep > 0) ? std::round((l - logMin) / logStep) : 0;
+      code = 1 + static_cast<std::uint16_t>(std::min(level, kMaxLevel - 1.));
+      if (first[j] < 0) code |= kSignBit;
+    }
+    fCodes.push_back(code);
+  }
+  fOffsets.push_back(fCodes.size());
+}
+
+
+QuantizedEventWeightMap Quantize(const FlatEventWeightMap& weights) {
+  QuantizedEventWeightMap quantized;
+  quantized.fCodes.reserve(weights.fWeights.size());
+  for (size_t i=0; i<weights.size(); i++) {
+    WeightSpan w = weights.Weights(i);
+    quantized.Add(weights.Calculator(i), w.begin(), w.size());
+  }
+  return quantized;
+}
+
+
+FlatEventWeightMap Dequantize(const QuantizedEventWeightMap& weights) {
+  FlatEventWeightMap flat;
+  flat.fCalculators = weights.fCalculators;
+  flat.fOffsets = weights.fOffsets;
+  flat.fWeights.resize(weights.fCodes.size());
+  for (size_t i=0; i<weights.size(); i++) {
+    weights.Decode(i, flat.fWeights.data() + weights.fOffsets[i]);
+  }
+  return flat;
+}
+
+  }  // namespace evwgh
+}  // namespace sbn
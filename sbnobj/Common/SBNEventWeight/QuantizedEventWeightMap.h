@@ -0,0 +1,97 @@
+#ifndef _SBN_QUANTIZEDEVENTWEIGHTMAP_H_
+#define _SBN_QUANTIZEDEVENTWEIGHTMAP_H_
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include "sbnobj/Common/SBNEventWeight/FlatEventWeightMap.h"
+
+namespace sbn {
+  namespace evwgh {
+
+/**
+ * @class QuantizedEventWeightMap
+ * @brief Event-level weights stored as 16-bit codes.
+ *
+ * This holds the same structure as a `FlatEventWeightMap` (calculators
+ * identified by their index in an `EventWeightCalculatorRegistry`, all
+ * weights in one vector), with each weight stored in 16 bits instead of 32.
+ *
+ * The code of a weight `w` holds its sign in the highest bit and the
+ * logarithm of its magnitude in the other 15, scaled linearly between the
+ * smallest and largest magnitude among the weights of the same calculator:
+ * code `0` is exactly `0`, codes `1` to `32767` span `[ ln min, ln max ]` in
+ * steps of `s = (ln max - ln min) / 32766`.
+ *
+ * Error bound: zero weights are exact, and the smallest and largest
+ * magnitude of each calculator are exact to float precision; any other
+ * weight is decoded with a relative error not larger than `exp(s / 2) - 1`
+ * (plus float rounding), that is about `1.5e-5 * ln(max / min)`.
+ * For weights between 0.5 and 2 the bound is 2.1e-5; between 1e-3 and 1e3,
+ * 2.1e-4. `MaxRelativeError()` returns the bound for each calculator.
+ *
+ * Weights must be finite.
+ */
+class QuantizedEventWeightMap {
+public:
+  /** Returns the number of calculators in the event. */
+  size_t size() const { return fCalculators.size(); }
+
+  /** Returns the registry index of the i-th calculator of the event. */
+  size_t Calculator(size_t i) const { return fCalculators[i]; }
+
+  /** Returns the number of weights (universes) of the i-th calculator. */
+  size_t NWeights(size_t i) const { return fOffsets[i + 1] - fOffsets[i]; }
+
+  /** Returns the bound of the relative error on the i-th calculator weights. */
+  double MaxRelativeError(size_t i) const;
+
+  /**
+   * Decodes the weights of the i-th calculator.
+   *
+   * @param i Index of the calculator in the event
+   * @param buffer Room for at least `NWeights(i)` weights
+   */
+  void Decode(size_t i, float* buffer) const;
+
+  /** Returns the decoded weights of the i-th calculator. */
+  std::vector<float> Decode(size_t i) const;
+
+  /**
+   * Appends the weights of a calculator, quantizing them.
+   *
+   * Calculators must be added in increasing registry index.
+   *
+   * @param calculator Registry index of the calculator
+   * @param first Pointer to the first weight
+   * @param n Number of weights
+   */
+  void Add(size_t calculator, const float* first, size_t n);
+
+  inline friend bool operator==(const QuantizedEventWeightMap& lhs,
+                                const QuantizedEventWeightMap& rhs) {
+    return (lhs.fCalculators == rhs.fCalculators &&
+            lhs.fOffsets == rhs.fOffsets &&
+            lhs.fLogMin == rhs.fLogMin &&
+            lhs.fLogStep == rhs.fLogStep &&
+            lhs.fCodes == rhs.fCodes);
+  }
+
+  std::vector<unsigned int> fCalculators;  //!< Registry index of calculators
+  std::vector<unsigned int> fOffsets{ 0 };  //!< Start of codes, plus end
+  std::vector<double> fLogMin;  //!< Logarithm of smallest magnitude, per calculator
+  std::vector<double> fLogStep;  //!< Logarithm step of the codes, per calculator
+  std::vector<std::uint16_t> fCodes;  //!< Codes of all calculators and universes
+};
+
+
+/** Quantizes columnar weights. */
+QuantizedEventWeightMap Quantize(const FlatEventWeightMap& weights);
+
+/** Decodes quantized weights into columnar form. */
+FlatEventWeightMap Dequantize(const QuantizedEventWeightMap& weights);
+
+  }  // namespace evwgh
+}  // namespace sbn
+
+#endif  // _SBN_QUANTIZEDEVENTWEIGHTMAP_H_
@@ -0,0 +1,63 @@
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "WeightMatrix.h"
+
+namespace sbn {
+  namespace evwgh {
+
+void TransposeWeights(const float* in, size_t nRows, size_t nCols, float* out) {
+  // 32x32 floats (4 kiB) for each of the input and output tiles
+  const size_t kTile = 32;
+  for (size_t r0=0; r0<nRows; r0+=kTile) {
+    const size_t rEnd = std::min(r0 + kTile, nRows);
+    for (size_t c0=0; c0<nCols; c0+=kTile) {
+      const size_t cEnd = std::min(c0 + kTile, nCols);
+      for (size_t r=r0; r<rEnd; r++) {
+        for (size_t c=c0; c<cEnd; c++) out[c * nRows + r] = in[r * nCols + c];
+      }
+    }
+  }
+}
+
+
+WeightMatrix WeightMatrix::InLayout(WeightLayout layout) const {
+  if (layout == fLayout) return *this;
+
+  WeightMatrix result;
+  result.fNEvents = fNEvents;
+  result.fNUniverses = fNUniverses;
+  result.fLayout = layout;
+  result.fWeights.resize(fWeights.size());
+  if (fLayout == WeightLayout::kEventMajor)
+    TransposeWeights(fWeights.data(), fNEvents, fNUniverses, result.fWeights.data());
+  else
+    TransposeWeights(fWeights.data(), fNUniverses, fNEvents, result.fWeights.data());
+  return result;
+}
+
+
+WeightMatrix WeightMatrix::FromEvents(const std::vector<FlatEventWeightMap>& events,
+                                      size_t calculator) {
+  if (events.empty()) return {};
+
+  const size_t nUniverses = events.front().WeightsOf(calculator).size();
+  WeightMatrix matrix(events.size(), nUniverses, WeightLayout::kEventMajor);
+  float* row = matrix.fWeights.data();
+  for (size_t i=0; i<events.size(); i++, row+=nUniverses) {
+    WeightSpan w = events[i].WeightsOf(calculator);
+    if (w.size() != nUniverses) {
+      throw std::runtime_error("WeightMatrix: event #" + std::to_string(i)
+                               + " has " + std::to_string(w.size())
+                               + " weights for calculator "
+                               + std::to_string(calculator) + ", event #0 has "
+                               + std::to_string(nUniverses));
+    }
+    std::copy(w.begin(), w.end(), row);
+  }
+  return matrix;
+}
+
+  }  // namespace evwgh
+}  // namespace sbn
@@ -0,0 +1,134 @@
+#ifndef _SBN_WEIGHTMATRIX_H_
+#define _SBN_WEIGHTMATRIX_H_
+
+#include <cstddef>
+#include <vector>
+#include "sbnobj/Common/SBNEventWeight/FlatEventWeightMap.h"
+
+namespace sbn {
+  namespace evwgh {
+
+/** Order of the weights of many events and universes in memory. */
+enum class WeightLayout {
+  kEventMajor,  //!< All universes of an event are contiguous
+  kUniverseMajor,  //!< All events of a universe are contiguous
+};
+
+
+/**
+ * @class WeightMatrixView
+ * @brief Non-owning view of the weights of many events in many universes.
+ *
+ * The same weights can be laid out event-major (for filling histograms
+ * event by event) or universe-major (for covariance building, one universe
+ * at a time); the element access `(event, universe)` is the same in either
+ * case, while `Event()` and `Universe()` give contiguous access in the
+ * respective layouts only.
+ */
+class WeightMatrixView {
+public:
+  WeightMatrixView() = default;
+
+  /**
+   * Constructor.
+   *
+   * @param data Pointer to the `nEvents x nUniverses` weights
+   * @param nEvents Number of events
+   * @param nUniverses Number of universes
+   * @param layout Order of the weights in `data`
+   */
+  WeightMatrixView(const float* data, size_t nEvents, size_t nUniverses,
+                   WeightLayout layout)
+      : fData(data), fNEvents(nEvents), fNUniverses(nUniverses), fLayout(layout) {}
+
+  size_t NEvents() const { return fNEvents; }
+  size_t NUniverses() const { return fNUniverses; }
+  WeightLayout Layout() const { return fLayout; }
+  const float* data() const { return fData; }
+
+  /** Returns the weight of an event in a universe. */
+  float operator()(size_t event, size_t universe) const {
+    return (fLayout == WeightLayout::kEventMajor)
+      ? fData[event * fNUniverses + universe]
+      : fData[universe * fNEvents + event];
+  }
+
+  /** Returns the weights of an event in all universes (event-major only). */
+  WeightSpan Event(size_t event) const {
+    return { fData + event * fNUniverses, fNUniverses };
+  }
+
+  /** Returns the weights of all events in a universe (universe-major only). */
+  WeightSpan Universe(size_t universe) const {
+    return { fData + universe * fNEvents, fNEvents };
+  }
+
+private:
+  const float* fData = nullptr;  //!< The weights
+  size_t fNEvents = 0;  //!< Number of events
+  size_t fNUniverses = 0;  //!< Number of universes
+  WeightLayout fLayout = WeightLayout::kEventMajor;  //!< Order of the weights
+};
+
+
+/**
+ * @class WeightMatrix
+ * @brief Weights of many events in many universes, in either layout.
+ */
+class WeightMatrix {
+public:
+  WeightMatrix() = default;
+
+  /** Constructor: all weights set to 1. */
+  WeightMatrix(size_t nEvents, size_t nUniverses,
+               WeightLayout layout = WeightLayout::kEventMajor)
+      : fNEvents(nEvents), fNUniverses(nUniverses), fLayout(layout),
+        fWeights(nEvents * nUniverses, 1.f) {}
+
+  size_t NEvents() const { return fNEvents; }
+  size_t NUniverses() const { return fNUniverses; }
+  WeightLayout Layout() const { return fLayout; }
+  float* data() { return fWeights.data(); }
+  const float* data() const { return fWeights.data(); }
+
+  /** Returns a view of the weights. */
+  WeightMatrixView View() const {
+    return { fWeights.data(), fNEvents, fNUniverses, fLayout };
+  }
+
+  /** Returns a copy of these weights in the requested layout. */
+  WeightMatrix InLayout(WeightLayout layout) const;
+
+  /**
+   * Collects the weights of one calculator from many events, event-major.
+   *
+   * All the events must have the same number of weights for the calculator.
+   *
+   * @param events The weights of each event
+   * @param calculator Registry index of the calculator
+   */
+  static WeightMatrix FromEvents(const std::vector<FlatEventWeightMap>& events,
+                                 size_t calculator);
+
+private:
+  size_t fNEvents = 0;  //!< Number of events
+  size_t fNUniverses = 0;  //!< Number of universes
+  WeightLayout fLayout = WeightLayout::kEventMajor;  //!< Order of the weights
+  std::vector<float> fWeights;  //!< The weights
+};
+
+
+/**
+ * Transposes a row-major matrix, in cache-sized tiles.
+ *
+ * @param in The `nRows x nCols` input matrix, row-major
+ * @param nRows Number of rows of the input matrix
+ * @param nCols Number of columns of the input matrix
+ * @param out Room for the `nCols x nRows` transposed matrix
+ */
+void TransposeWeights(const float* in, size_t nRows, size_t nCols, float* out);
+
+  }  // namespace evwgh
+}  // namespace sbn
+
+#endif  // _SBN_WEIGHTMATRIX_H_
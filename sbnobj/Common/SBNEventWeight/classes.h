@@ -4,6 +4,10 @@
 #include "canvas/Persistency/Common/Wrapper.h"
 #include "canvas/Persistency/Common/Assns.h"
 #include "sbnobj/Common/SBNEventWeight/EventWeightMap.h"
+#include "sbnobj/Common/SBNEventWeight/FlatEventWeightMap.h"
+#include "sbnobj/Common/SBNEventWeight/KnobResponseSplines.h"
+#include "sbnobj/Common/SBNEventWeight/QuantizedEventWeightMap.h"
 #include "sbnobj/Common/SBNEventWeight/EventWeightParameterSet.h"
+#include "sbnobj/Common/SBNEventWeight/EventWeightParameterSetRegistry.h"
 #include "nusimdata/SimulationBase/MCTruth.h"
 
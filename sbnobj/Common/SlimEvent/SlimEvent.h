@@ -0,0 +1,179 @@
+/**
+ * @file   sbnobj/Common/SlimEvent/SlimEvent.h
+ * @brief  Compact copy of the small per-event summaries used by analyses.
+ * @see    `sbnobj/Common/SlimEvent/SlimEventBuilder.h`
+ */
+
+#ifndef SBNOBJ_COMMON_SLIMEVENT_SLIMEVENT_H
+#define SBNOBJ_COMMON_SLIMEVENT_SLIMEVENT_H
+
+#include "sbnobj/Common/SBNEventWeight/FlatEventWeightMap.h"
+#include "sbnobj/Common/Trigger/BeamBits.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace sbn {
+
+  /// Trigger summary of a `SlimEvent`, from `sbn::ExtraTriggerInfo`.
+  struct SlimTrigger {
+
+    static constexpr unsigned int NoID = std::numeric_limits<unsigned int>::max();
+    static constexpr std::uint64_t NoTimestamp = std::numeric_limits<std::uint64_t>::max();
+
+    sbn::triggerSource sourceType { sbn::triggerSource::NBits }; ///< Beam of the gate (`NBits` if no trigger information).
+    sbn::triggerType triggerType { sbn::triggerType::NBits };   ///< Type of trigger logic.
+    std::uint64_t triggerTimestamp { NoTimestamp };   ///< Trigger timestamp [ns]
+    std::uint64_t beamGateTimestamp { NoTimestamp };  ///< Beam gate opening timestamp [ns]
+    unsigned int triggerID { NoID };                  ///< Trigger number in the run.
+    unsigned int gateID { 0 };                        ///< Gate number in the run.
+    unsigned int gateCountFromPreviousTrigger { 0 };  ///< Gates of this source since its previous trigger.
+    unsigned int triggerLocationBits { 0U };          ///< Where the trigger happened (`sbn::bits::triggerLocation`).
+    std::array<unsigned int, 2> triggerLogicBits { 0U, 0U }; ///< Trigger logic, per cryostat (`sbn::bits::triggerLogic`).
+
+    bool isValid() const { return sourceType != sbn::triggerSource::NBits; }
+
+    /// Trigger time with respect to the opening of the beam gate [ns]
+    std::int64_t triggerFromBeamGate() const
+      {
+        return static_cast<std::int64_t>(triggerTimestamp)
+          - static_cast<std::int64_t>(beamGateTimestamp);
+      }
+
+  };
+
+
+  /**
+   * Summary of all the slices of a `SlimEvent`, one entry per slice in each
+   * column.
+   *
+   * `key` is the index of the slice in its data product (as
+   * `art::Ptr::key()`). A slice with no result of one of the algorithms has
+   * `NoValue` (a quiet NaN) and `NoInt` in the columns of that algorithm.
+   */
+  struct SlimSlices {
+
+    static constexpr float NoValue = std::numeric_limits<float>::quiet_NaN();
+    static constexpr int NoInt = std::numeric_limits<int>::max();
+
+    std::vector<std::uint32_t> key; ///< Index of the slice in its data product.
+
+    /// @name CRUMBS scores (`sbn::CRUMBSResult`)
+    /// @{
+    std::vector<float> crumbsScore;       ///< Score for the inclusive neutrino signal.
+    std::vector<float> crumbsCCNuMuScore; ///< Score for the CC numu signal.
+    std::vector<float> crumbsCCNuEScore;  ///< Score for the CC nue signal.
+    std::vector<float> crumbsNCScore;     ///< Score for the NC signal.
+    std::vector<float> crumbsBestScore;   ///< Best of the three signal-specific scores.
+    std::vector<int>   crumbsBestID;      ///< Signal of the best score: 14 CC numu, 12 CC nue, 1 NC.
+    /// @}
+
+    /// @name Flash match from OpT0Finder (`sbn::OpT0Finder`), without the per-channel spectra
+    /// @{
+    std::vector<int>   opT0TPC;    ///< TPC the matching was performed in.
+    std::vector<float> opT0Time;   ///< Flash-matched t0 [us]
+    std::vector<float> opT0Score;  ///< Score of the match.
+    std::vector<float> opT0MeasPE; ///< Total PE of the measured flash.
+    std::vector<float> opT0HypoPE; ///< Total PE of the hypothetical flash.
+    /// @}
+
+    /// @name Barycenter flash match (`sbn::TPCPMTBarycenterMatch`)
+    /// @{
+    std::vector<float> baryChargeTotal; ///< Total charge in the slice (integrated ADC counts).
+    std::vector<float> baryFlashTime;   ///< Matched flash time [us]
+    std::vector<float> baryFlashPEs;    ///< Total PEs in the matched flash.
+    std::vector<float> baryDeltaY;      ///< | Flash Y center - charge Y center | [cm]
+    std::vector<float> baryDeltaZ;      ///< | Flash Z center - charge Z center | [cm]
+    std::vector<float> baryRadius;      ///< Hypotenuse of `baryDeltaY` and `baryDeltaZ` [cm]
+    std::vector<float> baryDeltaT;      ///< | Flash time - slice t0 | when available [us]
+    /// @}
+
+    std::size_t size() const { return key.size(); }
+    bool empty() const { return key.empty(); }
+
+  };
+
+
+  /**
+   * Summary of the CRT matching of all the flashes of a `SlimEvent`, one
+   * entry per flash in each column.
+   *
+   * The matched CRT hits of all the flashes are stored in single columns:
+   * the hits of flash `i` are the ones from `firstHit[i]` to
+   * `firstHit[i + 1]`. Times are in single precision, in microseconds from
+   * the global trigger; `NoTime` stands for no time information.
+   */
+  struct SlimFlashes {
+
+    static constexpr float NoTime = std::numeric_limits<float>::lowest();
+    static constexpr unsigned int NoCount = std::numeric_limits<unsigned int>::max();
+
+    static constexpr std::uint8_t InGateBit = 0x01; ///< Flash within the gate.
+    static constexpr std::uint8_t InBeamBit = 0x02; ///< Flash within the beam window.
+
+    std::vector<int>           flashID;        ///< ID of the optical flash.
+    std::vector<float>         time;           ///< Flash time w.r.t. the global trigger [us]
+    std::vector<float>         gateTime;       ///< Flash time w.r.t. the beam gate opening [us]
+    std::vector<float>         PE;             ///< Total reconstructed light in the flash [photoelectrons]
+    std::vector<std::uint8_t>  flags;          ///< `InGateBit` and `InBeamBit` flags.
+    std::vector<int>           classification; ///< CRT classification (`sbn::crt::MatchType`).
+    std::vector<unsigned int>  nTopCRTHitsBefore;  ///< Top CRT hits before the flash.
+    std::vector<unsigned int>  nTopCRTHitsAfter;   ///< Top CRT hits after the flash.
+    std::vector<unsigned int>  nSideCRTHitsBefore; ///< Side CRT hits before the flash.
+    std::vector<unsigned int>  nSideCRTHitsAfter;  ///< Side CRT hits after the flash.
+
+    std::vector<std::uint32_t> firstHit { 0 }; ///< First matched CRT hit of each flash, plus the end.
+    std::vector<float>         hitPMTTimeDiff;  ///< CRT hit time minus flash time [us]
+    std::vector<int>           hitSys;          ///< CRT subdetector of the hit.
+    std::vector<int>           hitRegion;       ///< CRT region of the hit.
+
+    std::size_t size() const { return flashID.size(); }
+    bool empty() const { return flashID.empty(); }
+
+    bool inGate(std::size_t flash) const { return flags[flash] & InGateBit; }
+    bool inBeam(std::size_t flash) const { return flags[flash] & InBeamBit; }
+
+    /// Number of CRT hits matched to the flash `flash`.
+    std::size_t nMatchedHits(std::size_t flash) const
+      { return firstHit[flash + 1] - firstHit[flash]; }
+
+  };
+
+
+  /**
+   * @brief The small per-event summaries used by analyses, in one product.
+   *
+   * This bundles compact copies of the trigger information
+   * (`sbn::ExtraTriggerInfo`), of the per-slice CRUMBS scores, OpT0Finder
+   * and barycenter flash matches, of the CRT matching of the flashes
+   * (`sbn::crt::CRTPMTMatching`) and of the event weights, so that a
+   * selection can be re-run by reading a single data product instead of
+   * six.
+   * All the per-slice and per-flash information is in columns (one vector
+   * per quantity): with the default _art_ split level each column is a
+   * sub-branch of the product branch, so ROOT reads only the columns that
+   * are used.
+   *
+   * The weights are in the columnar form, one entry per interaction in the
+   * order of the generator truth, referring to a calculator registry
+   * which is stored once per subrun.
+   *
+   * Use `sbn::SlimEventBuilder` to fill it.
+   */
+  struct SlimEvent {
+
+    SlimTrigger trigger; ///< Trigger summary.
+    SlimSlices slices; ///< Per-slice summaries.
+    SlimFlashes flashes; ///< CRT matching of the flashes.
+
+    /// Event weights, one entry per interaction.
+    std::vector<evwgh::FlatEventWeightMap> weights;
+
+  };
+
+} // namespace sbn
+
+#endif // SBNOBJ_COMMON_SLIMEVENT_SLIMEVENT_H
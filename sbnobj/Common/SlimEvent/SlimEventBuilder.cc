@@ -0,0 +1,146 @@
+#include "sbnobj/Common/SlimEvent/SlimEventBuilder.h"
+
+#include <utility>
+
+namespace {
+
+  /// Single precision copy of a CRT-PMT matching time, preserving `NoTime`.
+  float slimTime(double t)
+    {
+      return (t == sbn::crt::CRTPMTMatching::NoTime)
+        ? sbn::SlimFlashes::NoTime: static_cast<float>(t);
+    }
+
+} // local namespace
+
+
+sbn::SlimEventBuilder& sbn::SlimEventBuilder::setTrigger(ExtraTriggerInfo const& info)
+{
+  SlimTrigger& trigger = fEvent.trigger;
+  trigger.sourceType = info.sourceType;
+  trigger.triggerType = info.triggerType;
+  trigger.triggerTimestamp = info.triggerTimestamp;
+  trigger.beamGateTimestamp = info.beamGateTimestamp;
+  trigger.triggerID = info.triggerID;
+  trigger.gateID = info.gateID;
+  trigger.gateCountFromPreviousTrigger = info.gateCountFromPreviousTrigger;
+  trigger.triggerLocationBits = info.triggerLocationBits;
+  for (std::size_t cryo = 0; cryo < trigger.triggerLogicBits.size(); ++cryo)
+    trigger.triggerLogicBits[cryo] = info.cryostats[cryo].triggerLogicBits;
+  return *this;
+}
+
+
+sbn::SlimEventBuilder& sbn::SlimEventBuilder::addSlice(std::size_t key,
+  CRUMBSResult const* crumbs,
+  OpT0Finder const* opT0,
+  TPCPMTBarycenterMatch const* barycenter)
+{
+  constexpr float NoValue = SlimSlices::NoValue;
+  SlimSlices& slices = fEvent.slices;
+
+  slices.key.push_back(key);
+
+  slices.crumbsScore.push_back(crumbs? crumbs->score: NoValue);
+  slices.crumbsCCNuMuScore.push_back(crumbs? crumbs->ccnumuscore: NoValue);
+  slices.crumbsCCNuEScore.push_back(crumbs? crumbs->ccnuescore: NoValue);
+  slices.crumbsNCScore.push_back(crumbs? crumbs->ncscore: NoValue);
+  slices.crumbsBestScore.push_back(crumbs? crumbs->bestscore: NoValue);
+  slices.crumbsBestID.push_back(crumbs? crumbs->bestid: SlimSlices::NoInt);
+
+  slices.opT0TPC.push_back(opT0? opT0->tpc: SlimSlices::NoInt);
+  slices.opT0Time.push_back(opT0? static_cast<float>(opT0->time): NoValue);
+  slices.opT0Score.push_back(opT0? static_cast<float>(opT0->score): NoValue);
+  slices.opT0MeasPE.push_back(opT0? static_cast<float>(opT0->measPE): NoValue);
+  slices.opT0HypoPE.push_back(opT0? static_cast<float>(opT0->hypoPE): NoValue);
+
+  slices.baryChargeTotal.push_back(barycenter? barycenter->chargeTotal: NoValue);
+  slices.baryFlashTime.push_back(barycenter? barycenter->flashTime: NoValue);
+  slices.baryFlashPEs.push_back(barycenter? barycenter->flashPEs: NoValue);
+  slices.baryDeltaY.push_back(barycenter? barycenter->deltaY: NoValue);
+  slices.baryDeltaZ.push_back(barycenter? barycenter->deltaZ: NoValue);
+  slices.baryRadius.push_back(barycenter? barycenter->radius: NoValue);
+  slices.baryDeltaT.push_back(barycenter? barycenter->deltaT: NoValue);
+
+  return *this;
+}
+
+
+sbn::SlimEventBuilder& sbn::SlimEventBuilder::addFlash(crt::CRTPMTMatching const& matching)
+{
+  SlimFlashes& flashes = fEvent.flashes;
+
+  flashes.flashID.push_back(matching.flashID);
+  flashes.time.push_back(slimTime(matching.flashTime));
+  flashes.gateTime.push_back(slimTime(matching.flashGateTime));
+  flashes.PE.push_back(static_cast<float>(matching.flashPE));
+  flashes.flags.push_back(static_cast<std::uint8_t>(
+      (matching.flashInGate? SlimFlashes::InGateBit: 0)
+    | (matching.flashInBeam? SlimFlashes::InBeamBit: 0)
+    ));
+  flashes.classification.push_back(static_cast<int>(matching.flashClassification));
+  flashes.nTopCRTHitsBefore.push_back(matching.nTopCRTHitsBefore);
+  flashes.nTopCRTHitsAfter.push_back(matching.nTopCRTHitsAfter);
+  flashes.nSideCRTHitsBefore.push_back(matching.nSideCRTHitsBefore);
+  flashes.nSideCRTHitsAfter.push_back(matching.nSideCRTHitsAfter);
+
+  for (crt::MatchedCRT const& hit: matching.matchedCRTHits) {
+    flashes.hitPMTTimeDiff.push_back(slimTime(hit.PMTTimeDiff));
+    flashes.hitSys.push_back(hit.sys);
+    flashes.hitRegion.push_back(hit.region);
+  }
+  flashes.firstHit.push_back(flashes.hitPMTTimeDiff.size());
+
+  return *this;
+}
+
+
+sbn::SlimEventBuilder& sbn::SlimEventBuilder::addWeights
+  (evwgh::EventWeightMap const& weights, evwgh::EventWeightCalculatorRegistry& registry)
+{
+  fEvent.weights.push_back(evwgh::MakeFlatEventWeightMap(weights, registry));
+  return *this;
+}
+
+
+sbn::SlimEventBuilder& sbn::SlimEventBuilder::addWeights(evwgh::FlatEventWeightMap weights)
+{
+  fEvent.weights.push_back(std::move(weights));
+  return *this;
+}
+
+
+void sbn::SlimEventBuilder::reserve(std::size_t nSlices, std::size_t nFlashes)
+{
+  SlimSlices& slices = fEvent.slices;
+  for (auto* column: { &slices.crumbsScore, &slices.crumbsCCNuMuScore,
+    &slices.crumbsCCNuEScore, &slices.crumbsNCScore, &slices.crumbsBestScore,
+    &slices.opT0Time, &slices.opT0Score, &slices.opT0MeasPE, &slices.opT0HypoPE,
+    &slices.baryChargeTotal, &slices.baryFlashTime, &slices.baryFlashPEs,
+    &slices.baryDeltaY, &slices.baryDeltaZ, &slices.baryRadius, &slices.baryDeltaT })
+  {
+    column->reserve(nSlices);
+  }
+  slices.key.reserve(nSlices);
+  slices.crumbsBestID.reserve(nSlices);
+  slices.opT0TPC.reserve(nSlices);
+
+  SlimFlashes& flashes = fEvent.flashes;
+  flashes.flashID.reserve(nFlashes);
+  flashes.time.reserve(nFlashes);
+  flashes.gateTime.reserve(nFlashes);
+  flashes.PE.reserve(nFlashes);
+  flashes.flags.reserve(nFlashes);
+  flashes.classification.reserve(nFlashes);
+  flashes.nTopCRTHitsBefore.reserve(nFlashes);
+  flashes.nTopCRTHitsAfter.reserve(nFlashes);
+  flashes.nSideCRTHitsBefore.reserve(nFlashes);
+  flashes.nSideCRTHitsAfter.reserve(nFlashes);
+  flashes.firstHit.reserve(nFlashes + 1);
+}
+
+
+sbn::SlimEvent sbn::SlimEventBuilder::finish()
+{
+  return std::exchange(fEvent, SlimEvent{});
+}
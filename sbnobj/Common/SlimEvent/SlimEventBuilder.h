@@ -0,0 +1,92 @@
+/**
+ * @file   sbnobj/Common/SlimEvent/SlimEventBuilder.h
+ * @brief  Fills a `sbn::SlimEvent` from the full data products.
+ * @see    `sbnobj/Common/SlimEvent/SlimEvent.h`
+ */
+
+#ifndef SBNOBJ_COMMON_SLIMEVENT_SLIMEVENTBUILDER_H
+#define SBNOBJ_COMMON_SLIMEVENT_SLIMEVENTBUILDER_H
+
+#include "sbnobj/Common/SlimEvent/SlimEvent.h"
+#include "sbnobj/Common/CRT/CRTPMTMatching.hh"
+#include "sbnobj/Common/Reco/CRUMBSResult.h"
+#include "sbnobj/Common/Reco/OpT0FinderResult.h"
+#include "sbnobj/Common/Reco/TPCPMTBarycenterMatch.h"
+#include "sbnobj/Common/SBNEventWeight/EventWeightMap.h"
+#include "sbnobj/Common/SBNEventWeight/FlatEventWeightMap.h"
+#include "sbnobj/Common/Trigger/ExtraTriggerInfo.h"
+
+#include <cstddef>
+
+namespace sbn {
+
+  /**
+   * Collects the summaries of one event into a `SlimEvent`.
+   *
+   * Typical use in a producer, for each event:
+   *
+   *     sbn::SlimEventBuilder builder;
+   *     builder.setTrigger(*triggerInfo);
+   *     for (art::Ptr<recob::Slice> const& slice: slices) {
+   *       builder.addSlice(slice.key(),
+   *         firstOrNull(crumbsAssns.at(slice.key())),
+   *         firstOrNull(opT0Assns.at(slice.key())),
+   *         firstOrNull(baryAssns.at(slice.key()))
+   *         );
+   *     }
+   *     for (sbn::crt::CRTPMTMatching const& match: *crtPMTMatches)
+   *       builder.addFlash(match);
+   *     for (sbn::evwgh::EventWeightMap const& weights: *eventWeights)
+   *       builder.addWeights(weights, registry);
+   *     event.put(std::make_unique<sbn::SlimEvent>(builder.finish()));
+   *
+   * where `firstOrNull()` returns a pointer to the first associated object,
+   * or `nullptr` if there is none, and `registry` is the weight calculator
+   * registry of the subrun.
+   *
+   * The builder can be reused after `finish()`.
+   */
+  class SlimEventBuilder {
+  public:
+
+    /// Copies the trigger summary.
+    SlimEventBuilder& setTrigger(ExtraTriggerInfo const& info);
+
+    /**
+     * Adds a slice with the results of the algorithms on it.
+     *
+     * @param key Index of the slice in its data product
+     * @param crumbs CRUMBS result of the slice (`nullptr` if none)
+     * @param opT0 OpT0Finder flash match of the slice (`nullptr` if none)
+     * @param barycenter Barycenter flash match of the slice (`nullptr` if none)
+     */
+    SlimEventBuilder& addSlice(std::size_t key,
+      CRUMBSResult const* crumbs,
+      OpT0Finder const* opT0,
+      TPCPMTBarycenterMatch const* barycenter);
+
+    /// Adds the CRT matching of the next flash, with all its matched hits.
+    SlimEventBuilder& addFlash(crt::CRTPMTMatching const& matching);
+
+    /// Adds the weights of the next interaction, registering new calculators.
+    SlimEventBuilder& addWeights
+      (evwgh::EventWeightMap const& weights, evwgh::EventWeightCalculatorRegistry& registry);
+
+    /// Adds the weights of the next interaction, already in columnar form.
+    SlimEventBuilder& addWeights(evwgh::FlatEventWeightMap weights);
+
+    /// Preallocates the columns for `nSlices` slices and `nFlashes` flashes.
+    void reserve(std::size_t nSlices, std::size_t nFlashes);
+
+    /// Returns the event collected so far, and starts a new one.
+    SlimEvent finish();
+
+  private:
+
+    SlimEvent fEvent; ///< The event being filled.
+
+  };
+
+} // namespace sbn
+
+#endif // SBNOBJ_COMMON_SLIMEVENT_SLIMEVENTBUILDER_H
@@ -0,0 +1,3 @@
+#include "canvas/Persistency/Common/Wrapper.h"
+#include "sbnobj/Common/SlimEvent/SlimEvent.h"
+#include <vector>
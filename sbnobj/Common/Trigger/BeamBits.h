@@ -15,8 +15,12 @@
 
 
 // C/C++ standard libraries
+#include <array>
+#include <cstddef> // std::size_t
+#include <iterator> // std::forward_iterator_tag
 #include <stdexcept> // std::runtime_error
 #include <string>
+#include <string_view>
 #include <vector>
 #include <initializer_list>
 #include <type_traits> // std::underlying_type_t
@@ -85,6 +89,88 @@ namespace sbn {
     template <typename EnumType>
     std::vector<std::string> names(mask_t<EnumType> mask);
     
+    /**
+     * @brief Table of the names of the bits of `EnumType`.
+     * 
+     * Specializations provide a `names` array with the name of each bit,
+     * indexed by bit value, and including the `NBits` entry.
+     */
+    template <typename EnumType>
+    struct bitNameTable;
+    
+    /**
+     * @brief Returns the name of the specified `bit`, without allocations.
+     * 
+     * Bits beyond `EnumType::NBits` are named `"<unsupported>"`.
+     */
+    template <typename EnumType>
+    constexpr std::string_view nameView(EnumType bit);
+    
+    /// Returns the position of the lowest bit set in `bits` (`bits` not `0`).
+    template <typename T>
+    constexpr unsigned int lowestBitSet(T bits);
+    
+    /// Returns the number of bits set in `bits`.
+    template <typename T>
+    constexpr unsigned int countBitsSet(T bits);
+    
+    /**
+     * @brief Range of the bits set in a mask, as `EnumType` values.
+     * 
+     * The bits are visited from the lowest, and nothing is allocated:
+     * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+     * for (sbn::triggerLocation bit: sbn::bits::setBits(info.triggerLocation()))
+     *   out << " " << sbn::bits::nameView(bit);
+     * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+     */
+    template <typename EnumType>
+    class setBitRange {
+      using maskbits_t = typename mask_t<EnumType>::maskbits_t;
+      
+      maskbits_t fBits { 0 };
+      
+        public:
+      
+      /// Iterator to the set bits, holding the bits still to be visited.
+      class iterator {
+        maskbits_t fBits { 0 };
+        
+          public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = EnumType;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = EnumType;
+        
+        constexpr iterator() = default;
+        constexpr explicit iterator(maskbits_t bits): fBits{ bits } {}
+        
+        constexpr EnumType operator* () const
+          { return static_cast<EnumType>(lowestBitSet(fBits)); }
+        constexpr iterator& operator++ ()
+          { fBits &= fBits - 1; return *this; } // clears the lowest bit
+        constexpr iterator operator++ (int)
+          { iterator old { *this }; ++*this; return old; }
+        
+        constexpr bool operator== (iterator const& other) const
+          { return fBits == other.fBits; }
+        constexpr bool operator!= (iterator const& other) const
+          { return fBits != other.fBits; }
+      }; // iterator
+      
+      constexpr explicit setBitRange(mask_t<EnumType> mask): fBits{ mask.bits } {}
+      
+      constexpr iterator begin() const { return iterator{ fBits }; }
+      constexpr iterator end() const { return iterator{}; }
+      constexpr bool empty() const { return fBits == 0; }
+      
+    }; // setBitRange
+    
+    /// Returns a range of the bits set in `mask` (see `setBitRange`).
+    template <typename EnumType>
+    constexpr setBitRange<EnumType> setBits(mask_t<EnumType> mask)
+      { return setBitRange<EnumType>{ mask }; }
+    
     /// @}
     // --- END ---- Generic bit functions --------------------------------------
     
@@ -267,10 +353,11 @@ std::vector<std::string> sbn::bits::names(mask_t<EnumType> mask) {
   constexpr std::size_t MaxBits = sizeof(mask) * 8U;
   constexpr std::size_t NSupportedBits = value(EnumType::NBits);
   
+  static_assert(NSupportedBits < MaxBits);
+  
   std::vector<std::string> names;
-  for (std::size_t bit = 0U; bit < MaxBits; ++bit) {
-    auto const typedBit = static_cast<EnumType>(bit);
-    if (!hasBitSet(mask, typedBit)) continue;
+  for (EnumType const typedBit: setBits(mask)) {
+    std::size_t const bit = value(typedBit);
     names.push_back((bit > NSupportedBits)
       ? "<unsupported ["s + std::to_string(bit) + "]>"s: name(typedBit)
       );
@@ -280,118 +367,221 @@ std::vector<std::string> sbn::bits::names(mask_t<EnumType> mask) {
 } // sbn::bits::names()
 
 
+// -----------------------------------------------------------------------------
+template <typename T>
+constexpr unsigned int sbn::bits::lowestBitSet(T bits) {
+  static_assert(std::is_unsigned_v<T>);
+  // C++20:
+  //   return std::countr_zero(bits);
+#if defined(__GNUC__) || defined(__clang__)
+  if constexpr (sizeof(T) <= sizeof(unsigned int))
+    return __builtin_ctz(bits);
+  else
+    return __builtin_ctzll(bits);
+#else
+  unsigned int n = 0;
+  while (!(bits & 1U)) { bits >>= 1; ++n; }
+  return n;
+#endif
+} // sbn::bits::lowestBitSet()
+
+
+// -----------------------------------------------------------------------------
+template <typename T>
+constexpr unsigned int sbn::bits::countBitsSet(T bits) {
+  static_assert(std::is_unsigned_v<T>);
+  // C++20:
+  //   return std::popcount(bits);
+#if defined(__GNUC__) || defined(__clang__)
+  if constexpr (sizeof(T) <= sizeof(unsigned int))
+    return __builtin_popcount(bits);
+  else
+    return __builtin_popcountll(bits);
+#else
+  unsigned int n = 0;
+  for (; bits; bits &= bits - 1) ++n;
+  return n;
+#endif
+} // sbn::bits::countBitsSet()
+
+
+// -----------------------------------------------------------------------------
+template <typename EnumType>
+constexpr std::string_view sbn::bits::nameView(EnumType bit) {
+  constexpr auto const& names = bitNameTable<EnumType>::names;
+  static_assert(names.size() == value(EnumType::NBits) + 1U);
+  
+  std::size_t const index = value(bit);
+  return (index < names.size())? names[index]: "<unsupported>";
+} // sbn::bits::nameView()
+
+
+// -----------------------------------------------------------------------------
+template <>
+struct sbn::bits::bitNameTable<sbn::bits::triggerSource> {
+  static constexpr std::array<std::string_view, value(triggerSource::NBits) + 1U> names {
+      "unknown",     // Unknown
+      "BNB",         // BNB
+      "NuMI",        // NuMI
+      "OffbeamBNB",  // OffbeamBNB
+      "OffbeamNuMI", // OffbeamNuMI
+      "Calib",       // Calib
+      "<invalid>"    // NBits
+    };
+}; // sbn::bits::bitNameTable<triggerSource>
+
+
+// -----------------------------------------------------------------------------
+template <>
+struct sbn::bits::bitNameTable<sbn::bits::triggerLocation> {
+  static constexpr std::array<std::string_view, value(triggerLocation::NBits) + 1U> names {
+      "Cryo E",    // CryoEast
+      "Cryo W",    // CryoWest
+      "TPC EE",    // TPCEE
+      "TPC EW",    // TPCEW
+      "TPC WE",    // TPCWE
+      "TPC WW",    // TPCWW
+      "<invalid>"  // NBits
+    };
+}; // sbn::bits::bitNameTable<triggerLocation>
+
+
+// -----------------------------------------------------------------------------
+template <>
+struct sbn::bits::bitNameTable<sbn::bits::triggerLogic> {
+  static constexpr std::array<std::string_view, value(triggerLogic::NBits) + 1U> names {
+      "PMT analog sum",    // PMTAnalogSum
+      "PMT pair majority", // PMTPairMajority
+      "<invalid>"          // NBits
+    };
+}; // sbn::bits::bitNameTable<triggerLogic>
+
+
+// -----------------------------------------------------------------------------
+template <>
+struct sbn::bits::bitNameTable<sbn::bits::triggerType> {
+  static constexpr std::array<std::string_view, value(triggerType::NBits) + 1U> names {
+      "majority",     // Majority
+      "minimum bias", // MinimumBias
+      "<invalid>"     // NBits
+    };
+}; // sbn::bits::bitNameTable<triggerType>
+
+
+// -----------------------------------------------------------------------------
+template <>
+struct sbn::bits::bitNameTable<sbn::bits::triggerWindowMode> {
+  static constexpr std::array<std::string_view, value(triggerWindowMode::NBits) + 1U> names {
+      "Separated Window",   // Separated
+      "Overlapping Window", // Overlapping
+      "Separated Both",     // SeparatedPlusAdders
+      "Overlapping Both",   // OverlappingPlusAdders
+      "Adders",             // Adders
+      "<invalid>"           // NBits
+    };
+}; // sbn::bits::bitNameTable<triggerWindowMode>
+
+
+// -----------------------------------------------------------------------------
+template <>
+struct sbn::bits::bitNameTable<sbn::bits::gateSelection> {
+  static constexpr std::array<std::string_view, value(gateSelection::NBits) + 1U> names {
+      "GateBNB",                     // GateBNB
+      "DriftGateBNB",                // DriftGateBNB
+      "GateNuMI",                    // GateNuMI
+      "DriftGateNuMI",               // DriftGateNuMI
+      "GateOffbeamBNB",              // GateOffbeamBNB
+      "DriftGateOffbeamBNB",         // DriftGateOffbeamBNB
+      "GateOffbeamNuMI",             // GateOffbeamNuMI
+      "DriftGateOffbeamNuMI",        // DriftGateOffbeamNuMI
+      "GateCalibration",             // GateCalibration
+      "DriftGateCalibration",        // DriftGateCalibration
+      "MinbiasGateBNB",              // MinbiasGateBNB
+      "MinbiasGateNuMI",             // MinbiasGateNuMI
+      "MinbiasGateOffbeamBNB",       // MinbiasGateOffbeamBNB
+      "MinbiasGateOffbeamNuMI",      // MinbiasGateOffbeamNuMI
+      "MinbiasGateCalibration",      // MinbiasGateCalibration
+      "MinbiasDriftGateBNB",         // MinbiasDriftGateBNB
+      "MinbiasDriftGateNuMI",        // MinbiasDriftGateNuMI
+      "MinbiasDriftGateOffbeamBNB",  // MinbiasDriftGateOffbeamBNB
+      "MinbiasDriftGateOffbeamNuMI", // MinbiasDriftGateOffbeamNuMI
+      "MinbiasDriftGateCalibration", // MinbiasDriftGateCalibration
+      "NBits"                        // NBits
+    };
+}; // sbn::bits::bitNameTable<gateSelection>
+
+
 // -----------------------------------------------------------------------------
 /// @todo Move into an implementation file once this header in the final location.
 inline std::string sbn::bits::bitName(triggerSource bit) {
-  
+
   using namespace std::string_literals;
-  switch (bit) {
-    case triggerSource::Unknown:     return "unknown"s;
-    case triggerSource::BNB:         return "BNB"s;
-    case triggerSource::NuMI:        return "NuMI"s;
-    case triggerSource::OffbeamBNB:  return "OffbeamBNB"s;
-    case triggerSource::OffbeamNuMI: return "OffbeamNuMI"s;
-    case triggerSource::Calib:       return "Calib"s;
-    case triggerSource::NBits:       return "<invalid>"s;
-  } // switch
-  throw std::runtime_error("sbn::bits::bitName(triggerSource{ "s
-    + std::to_string(value(bit)) + " }): unknown bit"s);
-} // sbn::bitName()
+  if (value(bit) > value(triggerSource::NBits)) {
+    throw std::runtime_error("sbn::bits::bitName(triggerSource{ "s
+      + std::to_string(value(bit)) + " }): unknown bit"s);
+  }
+  return std::string{ nameView(bit) };
+} // sbn::bits::bitName(triggerSource)
 
 
 // -----------------------------------------------------------------------------
 inline std::string sbn::bits::bitName(triggerLocation bit) {
 
   using namespace std::string_literals;
-  switch (bit) {
-    case triggerLocation::CryoEast: return "Cryo E"s;
-    case triggerLocation::CryoWest: return "Cryo W"s;
-    case triggerLocation::TPCEE:    return "TPC EE"s;
-    case triggerLocation::TPCEW:    return "TPC EW"s;
-    case triggerLocation::TPCWE:    return "TPC WE"s;
-    case triggerLocation::TPCWW:    return "TPC WW"s;
-    case triggerLocation::NBits:    return "<invalid>"s;
-  } // switch
-  throw std::runtime_error("sbn::bits::bitName(triggerLocation{ "s
-    + std::to_string(value(bit)) + " }): unknown bit"s);
-} // sbn::bitName(triggerLocation)
+  if (value(bit) > value(triggerLocation::NBits)) {
+    throw std::runtime_error("sbn::bits::bitName(triggerLocation{ "s
+      + std::to_string(value(bit)) + " }): unknown bit"s);
+  }
+  return std::string{ nameView(bit) };
+} // sbn::bits::bitName(triggerLocation)
 
 
 // -----------------------------------------------------------------------------
 inline std::string sbn::bits::bitName(triggerLogic bit) {
 
   using namespace std::string_literals;
-  switch (bit) {
-    case triggerLogic::PMTPairMajority: return "PMT pair majority"s;
-    case triggerLogic::PMTAnalogSum:    return "PMT analog sum"s;
-    case triggerLogic::NBits:           return "<invalid>"s;
-  } // switch
-  throw std::runtime_error("sbn::bits::bitName(triggerLogic{ "s
-    + std::to_string(value(bit)) + " }): unknown bit"s);
-} // sbn::bitName(triggerLogic)
+  if (value(bit) > value(triggerLogic::NBits)) {
+    throw std::runtime_error("sbn::bits::bitName(triggerLogic{ "s
+      + std::to_string(value(bit)) + " }): unknown bit"s);
+  }
+  return std::string{ nameView(bit) };
+} // sbn::bits::bitName(triggerLogic)
 
 
 // -----------------------------------------------------------------------------
 inline std::string sbn::bits::bitName(triggerType bit) {
 
   using namespace std::string_literals;
-  switch (bit) {
-    case triggerType::Majority:    return "majority"s;
-    case triggerType::MinimumBias: return "minimum bias"s;
-    case triggerType::NBits:       return "<invalid>"s;
-  } // switch
-  throw std::runtime_error("sbn::bits::bitName(triggerType{ "s
-    + std::to_string(value(bit)) + " }): unknown bit"s);
-} // sbn::bitName(triggerType)
+  if (value(bit) > value(triggerType::NBits)) {
+    throw std::runtime_error("sbn::bits::bitName(triggerType{ "s
+      + std::to_string(value(bit)) + " }): unknown bit"s);
+  }
+  return std::string{ nameView(bit) };
+} // sbn::bits::bitName(triggerType)
 
 
 // -----------------------------------------------------------------------------
 inline std::string sbn::bits::bitName(triggerWindowMode bit) {
 
   using namespace std::string_literals;
-  switch (bit) {
-    case sbn::bits::triggerWindowMode::Separated:             return "Separated Window"s;
-    case sbn::bits::triggerWindowMode::Overlapping:           return "Overlapping Window"s;
-    case sbn::bits::triggerWindowMode::SeparatedPlusAdders:   return "Separated Both"s;
-    case sbn::bits::triggerWindowMode::OverlappingPlusAdders: return "Overlapping Both"s;
-    case sbn::bits::triggerWindowMode::Adders:                return "Adders"s;
-    case sbn::bits::triggerWindowMode::NBits:    return "<invalid>"s;
-  } // switch
-  throw std::runtime_error("sbn::bits::bitName(triggerWindowMode{ "s
-    + std::to_string(value(bit)) + " }): unknown bit"s);
-} // triggerWindowMode
+  if (value(bit) > value(triggerWindowMode::NBits)) {
+    throw std::runtime_error("sbn::bits::bitName(triggerWindowMode{ "s
+      + std::to_string(value(bit)) + " }): unknown bit"s);
+  }
+  return std::string{ nameView(bit) };
+} // sbn::bits::bitName(triggerWindowMode)
 
 
 // -----------------------------------------------------------------------------
 inline std::string sbn::bits::bitName(gateSelection bit) {
 
   using namespace std::string_literals;
-  switch (bit) {
-    case gateSelection::GateBNB:                     return "GateBNB"s;
-    case gateSelection::DriftGateBNB:                return "DriftGateBNB"s;
-    case gateSelection::GateNuMI:                    return "GateNuMI"s;
-    case gateSelection::DriftGateNuMI:               return "DriftGateNuMI"s;
-    case gateSelection::GateOffbeamBNB:              return "GateOffbeamBNB"s;
-    case gateSelection::DriftGateOffbeamBNB:         return "DriftGateOffbeamBNB"s;
-    case gateSelection::GateOffbeamNuMI:             return "GateOffbeamNuMI"s;
-    case gateSelection::DriftGateOffbeamNuMI:        return "DriftGateOffbeamNuMI"s;
-    case gateSelection::GateCalibration:             return "GateCalibration"s;
-    case gateSelection::DriftGateCalibration:        return "DriftGateCalibration"s;
-    case gateSelection::MinbiasGateBNB:              return "MinbiasGateBNB"s;
-    case gateSelection::MinbiasGateNuMI:             return "MinbiasGateNuMI"s;
-    case gateSelection::MinbiasGateOffbeamBNB:       return "MinbiasGateOffbeamBNB"s;
-    case gateSelection::MinbiasGateOffbeamNuMI:      return "MinbiasGateOffbeamNuMI"s;
-    case gateSelection::MinbiasGateCalibration:      return "MinbiasGateCalibration"s;
-    case gateSelection::MinbiasDriftGateBNB:         return "MinbiasDriftGateBNB"s;
-    case gateSelection::MinbiasDriftGateNuMI:        return "MinbiasDriftGateNuMI"s;
-    case gateSelection::MinbiasDriftGateOffbeamBNB:  return "MinbiasDriftGateOffbeamBNB"s;
-    case gateSelection::MinbiasDriftGateOffbeamNuMI: return "MinbiasDriftGateOffbeamNuMI"s;
-    case gateSelection::MinbiasDriftGateCalibration: return "MinbiasDriftGateCalibration"s;
-    case gateSelection::NBits:                       return "NBits"s;
-  } // switch
-  throw std::runtime_error("sbn::bits::bitName(gateSelection{ "s
-    + std::to_string(value(bit)) + " }): unknown bit"s);
-} // sbn::bitName()
+  if (value(bit) > value(gateSelection::NBits)) {
+    throw std::runtime_error("sbn::bits::bitName(gateSelection{ "s
+      + std::to_string(value(bit)) + " }): unknown bit"s);
+  }
+  return std::string{ nameView(bit) };
+} // sbn::bits::bitName(gateSelection)
 
 
 // -----------------------------------------------------------------------------
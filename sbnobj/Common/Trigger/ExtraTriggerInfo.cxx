@@ -144,6 +144,83 @@ namespace {
 } // local namespace
 
 
+// -----------------------------------------------------------------------------
+namespace {
+  
+  /// Returns `f(cryostatInfo, wall)` for the `cryostat` of each of the `infos`.
+  template <typename F>
+  std::vector<unsigned int> transformCryostats(
+    std::vector<sbn::ExtraTriggerInfo> const& infos,
+    std::size_t cryostat, std::size_t wall, F f
+  ) {
+    std::vector<unsigned int> values;
+    values.reserve(infos.size());
+    for (sbn::ExtraTriggerInfo const& info: infos)
+      values.push_back(f(info.cryostats[cryostat], wall));
+    return values;
+  } // transformCryostats()
+  
+} // local namespace
+
+
+// -----------------------------------------------------------------------------
+std::vector<unsigned int> sbn::LVDScounts(
+  std::vector<ExtraTriggerInfo> const& infos,
+  std::size_t cryostat, std::size_t wall
+) {
+  return transformCryostats(infos, cryostat, wall,
+    [](ExtraTriggerInfo::CryostatInfo const& cryo, std::size_t wall)
+      { return cryo.LVDScount(wall); }
+    );
+} // sbn::LVDScounts()
+
+
+// -----------------------------------------------------------------------------
+std::vector<unsigned int> sbn::longestLVDSruns(
+  std::vector<ExtraTriggerInfo> const& infos,
+  std::size_t cryostat, std::size_t wall
+) {
+  return transformCryostats(infos, cryostat, wall,
+    [](ExtraTriggerInfo::CryostatInfo const& cryo, std::size_t wall)
+      { return cryo.longestLVDSrun(wall); }
+    );
+} // sbn::longestLVDSruns()
+
+
+// -----------------------------------------------------------------------------
+std::vector<unsigned int> sbn::longestSectorRuns(
+  std::vector<ExtraTriggerInfo> const& infos,
+  std::size_t cryostat, std::size_t wall
+) {
+  return transformCryostats(infos, cryostat, wall,
+    [](ExtraTriggerInfo::CryostatInfo const& cryo, std::size_t wall)
+      { return cryo.longestSectorRun(wall); }
+    );
+} // sbn::longestSectorRuns()
+
+
+// -----------------------------------------------------------------------------
+std::array<unsigned long int, sbn::ExtraTriggerInfo::CryostatInfo::NLVDSpairs>
+sbn::LVDSpairActivity(
+  std::vector<ExtraTriggerInfo> const& infos,
+  std::size_t cryostat, std::size_t wall
+) {
+  using CryostatInfo = ExtraTriggerInfo::CryostatInfo;
+  
+  // counts by bit of `LVDSstatus`, without decoding each entry
+  std::array<unsigned long int, 64> bitCounts {};
+  for (ExtraTriggerInfo const& info: infos) {
+    std::uint64_t const bits = info.cryostats[cryostat].LVDSstatus[wall];
+    for (unsigned int bit = 0; bit < 64; ++bit) bitCounts[bit] += (bits >> bit) & 1U;
+  }
+  
+  std::array<unsigned long int, CryostatInfo::NLVDSpairs> counts {};
+  for (std::size_t pair = 0; pair < CryostatInfo::NLVDSpairs; ++pair)
+    counts[pair] = bitCounts[CryostatInfo::LVDSbitOfPair(pair)];
+  return counts;
+} // sbn::LVDSpairActivity()
+
+
 // -----------------------------------------------------------------------------
 std::ostream& sbn::operator<< (std::ostream& out, ExtraTriggerInfo const& info)
 {
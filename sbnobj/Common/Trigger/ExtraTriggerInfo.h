@@ -13,10 +13,12 @@
 
 // SBN libraries
 #include "sbnobj/Common/Trigger/BeamBits.h"
+#include "sbnobj/Common/Utilities/TimeNs.h"
 
 // C/C++ standard libraries
 #include <array>
 #include <iosfwd> // std::ostream
+#include <vector>
 #include <limits> // std::numeric_limits<>
 #include <cstdint> // std::uint64_t
 
@@ -270,6 +272,96 @@ struct sbn::ExtraTriggerInfo {
     /// Returns whether there is some recorded activity (LVDS or sector).
     constexpr bool hasAnyActivity() const;
     
+    
+    // --- BEGIN -- LVDS and sector analysis -----------------------------------
+    /**
+     * @name LVDS and sector analysis
+     * 
+     * LVDS pairs of a wall are numbered along _z_ from south (`0`) to north
+     * (`NLVDSpairs - 1`), following the ICARUS layout in `LVDSstatus`
+     * documentation: pair `p` is LVDS channel `p % 8` of PMT readout board
+     * `p / 8`, which is also the sector (adder board) number of the pair.
+     * The PMT serving each pair are in the configuration of the trigger
+     * emulation and are not known here.
+     */
+    /// @{
+    
+    /// Number of LVDS pairs in a PMT wall.
+    static constexpr std::size_t NLVDSpairs { 48 };
+    
+    /// Number of sectors in a PMT wall.
+    static constexpr std::size_t NSectors { 6 };
+    
+    /// Bits of `sectorStatus` assigned to sectors.
+    static constexpr std::uint16_t SectorBits { (1U << NSectors) - 1U };
+    
+    /// Number of LVDS pairs in each PMT readout board (and sector).
+    static constexpr std::size_t NLVDSpairsPerBoard { 8 };
+    
+    /// Value of `LVDSpairOfBit()` for bits not assigned to any pair.
+    static constexpr std::uint8_t NoPair { 0xFF };
+    
+    /// Returns the bit of `LVDSstatus` holding LVDS `pair` (`NLVDSpairs` pairs).
+    static constexpr unsigned int LVDSbitOfPair(std::size_t pair)
+      {
+        // south half at bits [ 32, 56 [, north at [ 0, 24 [; lowest pair at MSB
+        return (pair < 24)
+          ? static_cast<unsigned int>(55 - pair)
+          : static_cast<unsigned int>(23 - (pair - 24));
+      }
+    
+    /// Returns the LVDS pair in `bit` of `LVDSstatus` (`NoPair` if not used).
+    /// The lookup table is built once, at compile time.
+    static constexpr std::uint8_t LVDSpairOfBit(unsigned int bit);
+    
+    /// Builds the table of `LVDSpairOfBit()` for all the 64 bits.
+    static constexpr std::array<std::uint8_t, 64> LVDSpairTable()
+      {
+        std::array<std::uint8_t, 64> table {};
+        for (std::uint8_t& pair: table) pair = NoPair;
+        for (std::size_t pair = 0; pair < NLVDSpairs; ++pair)
+          table[LVDSbitOfPair(pair)] = static_cast<std::uint8_t>(pair);
+        return table;
+      }
+    
+    /// Returns the LVDS status of `wall` with bit `p` set for active pair `p`.
+    constexpr std::uint64_t LVDSpairMask(std::size_t wall) const;
+    
+    /// Returns the number of active LVDS pairs in `wall`.
+    constexpr unsigned int LVDScount(std::size_t wall) const
+      { return sbn::bits::countBitsSet(LVDSstatus[wall]); }
+    
+    /// Returns the number of active LVDS pairs in the cryostat.
+    constexpr unsigned int LVDScount() const;
+    
+    /// Returns the number of active sectors in `wall`.
+    constexpr unsigned int sectorCount(std::size_t wall) const
+      {
+        return sbn::bits::countBitsSet
+          (static_cast<unsigned int>(sectorStatus[wall] & SectorBits));
+      }
+    
+    /// Returns the length of the longest run of adjacent active LVDS pairs
+    /// in `wall`.
+    constexpr unsigned int longestLVDSrun(std::size_t wall) const
+      { return longestRun(LVDSpairMask(wall)); }
+    
+    /// Returns the length of the longest run of adjacent active sectors
+    /// in `wall`.
+    constexpr unsigned int longestSectorRun(std::size_t wall) const
+      { return longestRun(sectorStatus[wall] & SectorBits); }
+    
+    /// Returns the length of the longest run of contiguous bits set in `bits`.
+    static constexpr unsigned int longestRun(std::uint64_t bits)
+      {
+        unsigned int n = 0;
+        for (; bits; bits &= bits << 1) ++n; // each step shortens all runs by 1
+        return n;
+      }
+    
+    /// @}
+    // --- END ---- LVDS and sector analysis -----------------------------------
+    
   }; // CryostatInfo
   
   
@@ -323,6 +415,22 @@ struct sbn::ExtraTriggerInfo {
         - static_cast<std::int64_t>(beamGateTimestamp);
     }  
   
+  /// Returns the timestamp `ts` as `sbn::TimeNs_t`, invalid if `NoTimestamp`.
+  static constexpr sbn::TimeNs_t timestampTime(std::uint64_t ts) noexcept
+    { return sbn::TimeNs_t::fromUnsigned(ts, NoTimestamp); }
+  
+  /// Returns the trigger time (`triggerTimestamp`).
+  constexpr sbn::TimeNs_t triggerTime() const noexcept
+    { return timestampTime(triggerTimestamp); }
+  
+  /// Returns the beam gate opening time (`beamGateTimestamp`).
+  constexpr sbn::TimeNs_t beamGateTime() const noexcept
+    { return timestampTime(beamGateTimestamp); }
+  
+  /// Returns the enable gate opening time (`enableGateTimestamp`).
+  constexpr sbn::TimeNs_t enableGateTime() const noexcept
+    { return timestampTime(enableGateTimestamp); }
+  
   /// Returns whether this object contains any valid information.
   constexpr bool isValid() const noexcept
     { return sourceType != sbn::triggerSource::NBits; }
@@ -346,6 +454,41 @@ struct sbn::ExtraTriggerInfo {
 
 namespace sbn {
   std::ostream& operator<< (std::ostream& out, ExtraTriggerInfo const& info);
+  
+  // --- BEGIN -- Bulk LVDS and sector analysis --------------------------------
+  /**
+   * @name Bulk LVDS and sector analysis
+   * 
+   * These functions apply the `ExtraTriggerInfo::CryostatInfo` analysis to
+   * the specified `cryostat` and PMT `wall` of all the `infos`, with one
+   * result per entry in `infos` (invalid entries included).
+   */
+  /// @{
+  
+  /// Number of active LVDS pairs (`CryostatInfo::LVDScount()`).
+  std::vector<unsigned int> LVDScounts(std::vector<ExtraTriggerInfo> const& infos,
+    std::size_t cryostat, std::size_t wall);
+  
+  /// Longest run of active LVDS pairs (`CryostatInfo::longestLVDSrun()`).
+  std::vector<unsigned int> longestLVDSruns(
+    std::vector<ExtraTriggerInfo> const& infos,
+    std::size_t cryostat, std::size_t wall
+    );
+  
+  /// Longest run of active sectors (`CryostatInfo::longestSectorRun()`).
+  std::vector<unsigned int> longestSectorRuns(
+    std::vector<ExtraTriggerInfo> const& infos,
+    std::size_t cryostat, std::size_t wall
+    );
+  
+  /// Number of `infos` with each LVDS pair active, by pair number.
+  std::array<unsigned long int, ExtraTriggerInfo::CryostatInfo::NLVDSpairs>
+  LVDSpairActivity(std::vector<ExtraTriggerInfo> const& infos,
+    std::size_t cryostat, std::size_t wall);
+  
+  /// @}
+  // --- END ---- Bulk LVDS and sector analysis --------------------------------
+  
 }
 
 
@@ -375,6 +518,44 @@ inline constexpr bool sbn::ExtraTriggerInfo::CryostatInfo::hasAnyActivity()
 } // sbn::ExtraTriggerInfo::CryostatInfo::hasAnyActivity()
 
 
+// -----------------------------------------------------------------------------
+namespace sbn::details {
+  
+  /// Table of `ExtraTriggerInfo::CryostatInfo::LVDSpairOfBit()`.
+  inline constexpr std::array<std::uint8_t, 64> LVDSpairOfBitTable
+    = sbn::ExtraTriggerInfo::CryostatInfo::LVDSpairTable();
+  
+} // namespace sbn::details
+
+
+inline constexpr std::uint8_t
+sbn::ExtraTriggerInfo::CryostatInfo::LVDSpairOfBit(unsigned int bit)
+  { return details::LVDSpairOfBitTable[bit]; }
+
+
+// -----------------------------------------------------------------------------
+inline constexpr std::uint64_t sbn::ExtraTriggerInfo::CryostatInfo::LVDSpairMask
+  (std::size_t wall) const
+{
+  std::uint64_t mask = 0;
+  for (std::uint64_t bits = LVDSstatus[wall]; bits; bits &= bits - 1) {
+    std::uint8_t const pair = LVDSpairOfBit(sbn::bits::lowestBitSet(bits));
+    if (pair != NoPair) mask |= std::uint64_t{ 1 } << pair;
+  }
+  return mask;
+} // sbn::ExtraTriggerInfo::CryostatInfo::LVDSpairMask()
+
+
+// -----------------------------------------------------------------------------
+inline constexpr unsigned int sbn::ExtraTriggerInfo::CryostatInfo::LVDScount()
+  const
+{
+  unsigned int n = 0;
+  for (std::size_t wall = 0; wall < MaxWalls; ++wall) n += LVDScount(wall);
+  return n;
+} // sbn::ExtraTriggerInfo::CryostatInfo::LVDScount()
+
+
 // -----------------------------------------------------------------------------
 
 
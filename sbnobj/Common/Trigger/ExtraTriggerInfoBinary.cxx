@@ -0,0 +1,198 @@
+/**
+ * @file sbnobj/Common/Trigger/ExtraTriggerInfoBinary.cxx
+ * @brief Fixed layout binary encoding of `sbn::ExtraTriggerInfo`.
+ * @see sbnobj/Common/Trigger/ExtraTriggerInfoBinary.h
+ */
+
+#include "sbnobj/Common/Trigger/ExtraTriggerInfoBinary.h"
+
+// C/C++ standard library
+#include <stdexcept> // std::runtime_error
+#include <string>
+#include <type_traits> // std::underlying_type_t
+
+
+// -----------------------------------------------------------------------------
+namespace {
+  
+  // ---------------------------------------------------------------------------
+  using Info_t = sbn::ExtraTriggerInfo;
+  
+  // the encoded types must hold the data members without loss
+  static_assert(sizeof(unsigned int) <= sizeof(std::uint32_t));
+  static_assert(sizeof(unsigned long int) <= sizeof(std::uint64_t));
+  static_assert
+    (sizeof(std::underlying_type_t<sbn::triggerSource>) <= sizeof(std::uint32_t));
+  static_assert
+    (sizeof(std::underlying_type_t<sbn::triggerType>) <= sizeof(std::uint32_t));
+  
+  constexpr std::size_t HeaderSize = 4 + 2 + 2;
+  constexpr std::size_t ScalarSize
+    = 4 + 4       // sourceType, triggerType
+    + 8 + 8 + 8   // enable gate, trigger and beam gate timestamps
+    + 4 * 4       // triggerID, gateID, triggerCount, gateCount
+    + 3 * 4       // counts from previous trigger of the same source
+    + 4 + 4       // type of and gate count from previous trigger of any source
+    + 8 + 8       // previous trigger timestamps
+    + 8           // WRtimeToTriggerTime
+    + 4           // triggerLocationBits
+    ;
+  constexpr std::size_t CryostatSize
+    = 8 + Info_t::MaxWalls * 8 + Info_t::MaxWalls * 2 + 4;
+  
+  static_assert(
+    HeaderSize + ScalarSize + Info_t::MaxCryostats * CryostatSize
+      == sbn::ExtraTriggerInfoBinary::Size,
+    "ExtraTriggerInfoBinary::Size does not match the record layout"
+    );
+  
+  
+  // ---------------------------------------------------------------------------
+  /// Writes little endian values one after the other.
+  class RecordWriter {
+    std::uint8_t* fPos;
+    
+      public:
+    RecordWriter(std::uint8_t* buffer): fPos{ buffer } {}
+    
+    template <typename T>
+    void write(std::uint64_t value)
+      {
+        for (std::size_t i = 0; i < sizeof(T); ++i)
+          *fPos++ = static_cast<std::uint8_t>(value >> (8 * i));
+      }
+    
+  }; // RecordWriter
+  
+  
+  /// Reads little endian values one after the other.
+  class RecordReader {
+    std::uint8_t const* fPos;
+    
+      public:
+    RecordReader(std::uint8_t const* buffer): fPos{ buffer } {}
+    
+    template <typename T>
+    T read()
+      {
+        std::uint64_t value = 0;
+        for (std::size_t i = 0; i < sizeof(T); ++i)
+          value |= static_cast<std::uint64_t>(*fPos++) << (8 * i);
+        return static_cast<T>(value);
+      }
+    
+  }; // RecordReader
+  
+  
+  // ---------------------------------------------------------------------------
+  
+} // local namespace
+
+
+// -----------------------------------------------------------------------------
+void sbn::ExtraTriggerInfoBinary::encode
+  (ExtraTriggerInfo const& info, std::uint8_t* buffer)
+{
+  RecordWriter out { buffer };
+  
+  out.write<std::uint32_t>(Magic);
+  out.write<std::uint16_t>(Version);
+  out.write<std::uint16_t>(Size);
+  
+  out.write<std::uint32_t>(sbn::bits::value(info.sourceType));
+  out.write<std::uint32_t>(sbn::bits::value(info.triggerType));
+  out.write<std::uint64_t>(info.enableGateTimestamp);
+  out.write<std::uint64_t>(info.triggerTimestamp);
+  out.write<std::uint64_t>(info.beamGateTimestamp);
+  out.write<std::uint32_t>(info.triggerID);
+  out.write<std::uint32_t>(info.gateID);
+  out.write<std::uint32_t>(info.triggerCount);
+  out.write<std::uint32_t>(info.gateCount);
+  out.write<std::uint32_t>(info.gateCountFromPreviousTrigger);
+  out.write<std::uint32_t>(info.anyTriggerCountFromPreviousTrigger);
+  out.write<std::uint32_t>(info.anyGateCountFromPreviousTrigger);
+  out.write<std::uint32_t>(sbn::bits::value(info.anyPreviousTriggerSourceType));
+  out.write<std::uint32_t>(info.anyGateCountFromAnyPreviousTrigger);
+  out.write<std::uint64_t>(info.previousTriggerTimestamp);
+  out.write<std::uint64_t>(info.anyPreviousTriggerTimestamp);
+  out.write<std::uint64_t>(static_cast<std::uint64_t>(info.WRtimeToTriggerTime));
+  out.write<std::uint32_t>(info.triggerLocationBits);
+  
+  for (ExtraTriggerInfo::CryostatInfo const& cryo: info.cryostats) {
+    out.write<std::uint64_t>(cryo.triggerCount);
+    for (std::uint64_t bits: cryo.LVDSstatus) out.write<std::uint64_t>(bits);
+    for (std::uint16_t bits: cryo.sectorStatus) out.write<std::uint16_t>(bits);
+    out.write<std::uint32_t>(cryo.triggerLogicBits);
+  } // for cryostats
+  
+} // sbn::ExtraTriggerInfoBinary::encode()
+
+
+// -----------------------------------------------------------------------------
+sbn::ExtraTriggerInfo sbn::ExtraTriggerInfoBinary::decode
+  (std::uint8_t const* buffer, std::size_t size)
+{
+  if (size < HeaderSize) {
+    throw std::runtime_error{
+      "sbn::ExtraTriggerInfoBinary::decode(): record of " + std::to_string(size)
+      + " bytes is too short"
+      };
+  }
+  
+  RecordReader in { buffer };
+  
+  std::uint32_t const magic = in.read<std::uint32_t>();
+  std::uint16_t const version = in.read<std::uint16_t>();
+  std::uint16_t const recordSize = in.read<std::uint16_t>();
+  if (magic != Magic) {
+    throw std::runtime_error{
+      "sbn::ExtraTriggerInfoBinary::decode(): not an ExtraTriggerInfo record"
+      };
+  }
+  if (version != Version) {
+    throw std::runtime_error{
+      "sbn::ExtraTriggerInfoBinary::decode(): record version "
+      + std::to_string(version) + " not supported (only "
+      + std::to_string(Version) + ")"
+      };
+  }
+  if ((recordSize != Size) || (size < Size)) {
+    throw std::runtime_error{
+      "sbn::ExtraTriggerInfoBinary::decode(): record of " + std::to_string(size)
+      + " bytes (declared: " + std::to_string(recordSize) + "), expected "
+      + std::to_string(Size)
+      };
+  }
+  
+  ExtraTriggerInfo info;
+  info.sourceType = in.read<sbn::triggerSource>();
+  info.triggerType = in.read<sbn::triggerType>();
+  info.enableGateTimestamp = in.read<std::uint64_t>();
+  info.triggerTimestamp = in.read<std::uint64_t>();
+  info.beamGateTimestamp = in.read<std::uint64_t>();
+  info.triggerID = in.read<std::uint32_t>();
+  info.gateID = in.read<std::uint32_t>();
+  info.triggerCount = in.read<std::uint32_t>();
+  info.gateCount = in.read<std::uint32_t>();
+  info.gateCountFromPreviousTrigger = in.read<std::uint32_t>();
+  info.anyTriggerCountFromPreviousTrigger = in.read<std::uint32_t>();
+  info.anyGateCountFromPreviousTrigger = in.read<std::uint32_t>();
+  info.anyPreviousTriggerSourceType = in.read<sbn::triggerSource>();
+  info.anyGateCountFromAnyPreviousTrigger = in.read<std::uint32_t>();
+  info.previousTriggerTimestamp = in.read<std::uint64_t>();
+  info.anyPreviousTriggerTimestamp = in.read<std::uint64_t>();
+  info.WRtimeToTriggerTime = static_cast<std::int64_t>(in.read<std::uint64_t>());
+  info.triggerLocationBits = in.read<std::uint32_t>();
+  
+  for (ExtraTriggerInfo::CryostatInfo& cryo: info.cryostats) {
+    cryo.triggerCount = in.read<std::uint64_t>();
+    for (std::uint64_t& bits: cryo.LVDSstatus) bits = in.read<std::uint64_t>();
+    for (std::uint16_t& bits: cryo.sectorStatus) bits = in.read<std::uint16_t>();
+    cryo.triggerLogicBits = in.read<std::uint32_t>();
+  } // for cryostats
+  
+  return info;
+} // sbn::ExtraTriggerInfoBinary::decode()
+
+
+// -----------------------------------------------------------------------------
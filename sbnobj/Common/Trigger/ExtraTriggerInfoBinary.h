@@ -0,0 +1,83 @@
+/**
+ * @file sbnobj/Common/Trigger/ExtraTriggerInfoBinary.h
+ * @brief Fixed layout binary encoding of `sbn::ExtraTriggerInfo`.
+ * @see sbnobj/Common/Trigger/ExtraTriggerInfoBinary.cxx
+ */
+
+#ifndef SBNOBJ_COMMON_TRIGGER_EXTRATRIGGERINFOBINARY_H
+#define SBNOBJ_COMMON_TRIGGER_EXTRATRIGGERINFOBINARY_H
+
+
+// SBN libraries
+#include "sbnobj/Common/Trigger/ExtraTriggerInfo.h"
+
+// C/C++ standard libraries
+#include <array>
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint8_t, std::uint16_t, std::uint32_t
+
+
+// -----------------------------------------------------------------------------
+namespace sbn {
+  
+  /**
+   * @brief Binary record of `sbn::ExtraTriggerInfo`, not requiring ROOT.
+   * 
+   * The record has always the same size (`Size` bytes) and layout, and it can
+   * be passed as it is through shared memory or sockets.
+   * All values are little endian, independently of the host:
+   * 
+   * | offset | size | content                                               |
+   * | -----: | ---: | ----------------------------------------------------- |
+   * |      0 |    4 | `Magic`                                               |
+   * |      4 |    2 | format version (`Version`)                            |
+   * |      6 |    2 | record size (`Size`)                                  |
+   * |      8 |   92 | the scalar data members, in declaration order: enums |
+   * |        |      | and `unsigned int` in 4 bytes, timestamps in 8 bytes  |
+   * |    100 |    4 | `triggerLocationBits`                                 |
+   * |    104 |   64 | `cryostats`, 32 bytes each: `triggerCount` (8),       |
+   * |        |      | `LVDSstatus` (2 x 8), `sectorStatus` (2 x 2),         |
+   * |        |      | `triggerLogicBits` (4)                                |
+   * 
+   * A change of `sbn::ExtraTriggerInfo` content requires a new `Version`.
+   */
+  struct ExtraTriggerInfoBinary {
+    
+    /// Record signature (`"SBTI"` in memory order).
+    static constexpr std::uint32_t Magic { 0x49544253U };
+    
+    /// Version of the record layout.
+    static constexpr std::uint16_t Version { 1U };
+    
+    /// Size of the record [bytes].
+    static constexpr std::size_t Size { 168U };
+    
+    /// Record buffer type.
+    using Record_t = std::array<std::uint8_t, Size>;
+    
+    /// Writes `info` into the `Size` bytes starting at `buffer`.
+    static void encode(ExtraTriggerInfo const& info, std::uint8_t* buffer);
+    
+    /// Returns the record of `info`.
+    static Record_t encode(ExtraTriggerInfo const& info)
+      { Record_t record; encode(info, record.data()); return record; }
+    
+    /**
+     * @brief Decodes the record of `size` bytes at `buffer`.
+     * @throws std::runtime_error if the signature, version or size do not match
+     */
+    static ExtraTriggerInfo decode(std::uint8_t const* buffer, std::size_t size);
+    
+    /// Decodes the `record`.
+    static ExtraTriggerInfo decode(Record_t const& record)
+      { return decode(record.data(), record.size()); }
+    
+  }; // ExtraTriggerInfoBinary
+  
+} // namespace sbn
+
+
+// -----------------------------------------------------------------------------
+
+
+#endif // SBNOBJ_COMMON_TRIGGER_EXTRATRIGGERINFOBINARY_H
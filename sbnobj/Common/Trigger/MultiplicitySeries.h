@@ -0,0 +1,396 @@
+/**
+ * @file   sbnobj/Common/Trigger/MultiplicitySeries.h
+ * @brief  Detector-neutral PMT multiplicity as a function of time.
+ * @date   October 14, 2026
+ *
+ * This is a header-only library.
+ *
+ * The representation follows the one of `icarus::trigger::TriggerGateData`
+ * (a list of level changes in tick order), so that SBND `pmtTrigger`
+ * multiplicity series and ICARUS trigger gates can be converted into it and
+ * share its summing and threshold scan algorithms.
+ */
+
+#ifndef SBNOBJ_COMMON_TRIGGER_MULTIPLICITYSERIES_H
+#define SBNOBJ_COMMON_TRIGGER_MULTIPLICITYSERIES_H
+
+
+// C/C++ standard libraries
+#include <algorithm> // std::max(), std::min(), std::push_heap(), ...
+#include <iterator> // std::distance()
+#include <limits>
+#include <optional>
+#include <stdexcept> // std::runtime_error
+#include <string> // std::to_string()
+#include <type_traits> // std::make_signed_t
+#include <utility> // std::pair
+#include <vector>
+#include <cstddef> // std::size_t
+
+
+// -----------------------------------------------------------------------------
+namespace sbn {
+
+  template <typename Tick = int, typename Level = unsigned int>
+  class MultiplicitySeries;
+
+} // namespace sbn
+
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief Multiplicity (e.g. number of PMT over threshold) versus time.
+ * @tparam Tick type of the time ticks
+ * @tparam Level type of the multiplicity
+ *
+ * The series is a step function: each change sets the level from its tick on,
+ * until the next change. The first change is at the lowest `Tick` value and
+ * sets the starting level (`0` by default). Consecutive changes have
+ * different levels.
+ *
+ * Conversions:
+ *  * `fromBinned()`/`toBinned()` from and to one level per time bin, as the
+ *    `numPassed` member of SBND `sbnd::comm::pmtTrigger`;
+ *  * `setLevelFrom()` appends changes in tick order, which is what
+ *    `icarus::trigger::toMultiplicitySeries()` uses for ICARUS gates.
+ *
+ * `Sum()` adds many series with a single merge of their (already sorted)
+ * changes, and the queries (`maxInWindow()`, `ticksAtLeast()`,
+ * `ticksAtLevels()`, `firstAtLeast()`) locate the window with a binary search
+ * and then visit only the changes inside of it.
+ */
+template <typename Tick, typename Level>
+class sbn::MultiplicitySeries {
+
+    public:
+
+  using Tick_t = Tick; ///< Type of time tick.
+  using Level_t = Level; ///< Type of multiplicity.
+
+  static constexpr Tick_t MinTick = std::numeric_limits<Tick_t>::lowest();
+
+  /// A change of level.
+  struct Change_t {
+    Tick_t tick; ///< From when the level is valid.
+    Level_t level; ///< The new level.
+  }; // Change_t
+
+  /// Constructor: level `0` at all times.
+  MultiplicitySeries(): fChanges{ { MinTick, Level_t{ 0 } } } {}
+
+  /**
+   * @brief Returns a series with one level per bin.
+   * @param counts level of each bin; must not be negative
+   * @param start tick where the first bin starts
+   * @param binWidth ticks in each bin
+   * @throw std::runtime_error on a negative count or non-positive bin width
+   *
+   * The level is `counts[i]` in [ `start + i binWidth`,
+   * `start + (i+1) binWidth` [, and `0` before and after the bins.
+   */
+  template <typename Counts>
+  static MultiplicitySeries fromBinned
+    (Counts const& counts, Tick_t start = Tick_t{ 0 }, Tick_t binWidth = 1);
+
+  /**
+   * @brief Returns the level of each of `nBins` bins.
+   * @param start tick where the first bin starts
+   * @param nBins number of bins
+   * @param binWidth ticks in each bin
+   * @return the level at the first tick of each bin
+   *
+   * This is the inverse of `fromBinned()` with the same binning.
+   */
+  std::vector<int> toBinned
+    (Tick_t start, std::size_t nBins, Tick_t binWidth = 1) const;
+
+  /**
+   * @brief Sets the level from `tick` on.
+   * @throw std::runtime_error if `tick` is before the last change
+   *
+   * Changes are appended in constant time, and a change not altering the
+   * level is not recorded.
+   */
+  void setLevelFrom(Tick_t tick, Level_t level);
+
+  /// Returns all the changes, in tick order.
+  std::vector<Change_t> const& changes() const { return fChanges; }
+
+  /// Returns the number of changes (including the starting level).
+  std::size_t size() const { return fChanges.size(); }
+
+  /// Returns the level at `tick`.
+  Level_t level(Tick_t tick) const { return changeAt(tick)->level; }
+
+  /// Returns the highest level in the ticks [ `first`, `last` [.
+  Level_t maxInWindow(Tick_t first, Tick_t last) const;
+
+  /// Returns the number of ticks in [ `first`, `last` [ with level at least
+  /// `threshold`.
+  Tick_t ticksAtLeast(Level_t threshold, Tick_t first, Tick_t last) const;
+
+  /**
+   * @brief Returns the number of ticks spent at each level.
+   * @return element `l` holds the ticks at level `l` in [ `first`, `last` [
+   *
+   * The ticks at or above each threshold, for a whole scan of thresholds,
+   * are the cumulative sums of the result from the highest level down.
+   */
+  std::vector<Tick_t> ticksAtLevels(Tick_t first, Tick_t last) const;
+
+  /// Returns the first tick from `from` on with level at least `threshold`.
+  std::optional<Tick_t> firstAtLeast(Level_t threshold, Tick_t from) const;
+
+  /**
+   * @brief Returns the sum of many series.
+   * @tparam Series type of range of `MultiplicitySeries`
+   * @tparam Delays type of range of delays, one per series
+   * @param series the series to be added
+   * @param delays ticks to be added to each of the series
+   * @throw std::runtime_error if `delays` is neither empty nor has one entry
+   *        per series
+   *
+   * The changes of the series are merged in tick order with a heap, and the
+   * result is the running sum of their level differences. The starting levels
+   * are not delayed.
+   */
+  template <typename Series, typename Delays>
+  static MultiplicitySeries Sum(Series const& series, Delays const& delays);
+
+  /// Returns the sum of many series with no delay.
+  template <typename Series>
+  static MultiplicitySeries Sum(Series const& series)
+    { return Sum(series, std::vector<Tick_t>{}); }
+
+
+    private:
+
+  std::vector<Change_t> fChanges; ///< Level changes, in tick order.
+
+  /// Returns an iterator to the change setting the level at `tick`.
+  typename std::vector<Change_t>::const_iterator changeAt(Tick_t tick) const
+    {
+      return std::prev(std::upper_bound(fChanges.begin(), fChanges.end(), tick,
+        [](Tick_t t, Change_t const& c){ return t < c.tick; }));
+    }
+
+  /// Returns the last tick of the change pointed by `it`, capped to `last`.
+  template <typename It>
+  Tick_t endOf(It it, Tick_t last) const
+    { return (std::next(it) == fChanges.end())? last: std::min(std::next(it)->tick, last); }
+
+}; // sbn::MultiplicitySeries
+
+
+// -----------------------------------------------------------------------------
+// --- template implementation
+// -----------------------------------------------------------------------------
+template <typename Tick, typename Level>
+template <typename Counts>
+auto sbn::MultiplicitySeries<Tick, Level>::fromBinned
+  (Counts const& counts, Tick_t start, Tick_t binWidth) -> MultiplicitySeries
+{
+  using std::to_string;
+  if (!(binWidth > Tick_t{ 0 })) {
+    throw std::runtime_error(
+      "sbn::MultiplicitySeries::fromBinned(): invalid bin width "
+      + to_string(binWidth)
+      );
+  }
+
+  MultiplicitySeries series;
+  series.fChanges.reserve(std::distance(std::begin(counts), std::end(counts)) + 2U);
+  Tick_t tick = start;
+  for (auto const count: counts) {
+    if (count < 0) {
+      throw std::runtime_error(
+        "sbn::MultiplicitySeries::fromBinned(): negative count "
+        + to_string(count) + " at tick " + to_string(tick)
+        );
+    }
+    series.setLevelFrom(tick, static_cast<Level_t>(count));
+    tick += binWidth;
+  } // for
+  series.setLevelFrom(tick, Level_t{ 0 });
+  return series;
+} // sbn::MultiplicitySeries<>::fromBinned()
+
+
+// -----------------------------------------------------------------------------
+template <typename Tick, typename Level>
+std::vector<int> sbn::MultiplicitySeries<Tick, Level>::toBinned
+  (Tick_t start, std::size_t nBins, Tick_t binWidth /* = 1 */) const
+{
+  std::vector<int> counts;
+  counts.reserve(nBins);
+  auto iChange = changeAt(start);
+  Tick_t tick = start;
+  for (std::size_t bin = 0; bin < nBins; ++bin, tick += binWidth) {
+    while ((std::next(iChange) != fChanges.end()) && (std::next(iChange)->tick <= tick))
+      ++iChange;
+    counts.push_back(static_cast<int>(iChange->level));
+  } // for
+  return counts;
+} // sbn::MultiplicitySeries<>::toBinned()
+
+
+// -----------------------------------------------------------------------------
+template <typename Tick, typename Level>
+void sbn::MultiplicitySeries<Tick, Level>::setLevelFrom
+  (Tick_t tick, Level_t level)
+{
+  using std::to_string;
+  Change_t& lastChange = fChanges.back();
+  if (tick < lastChange.tick) {
+    throw std::runtime_error(
+      "sbn::MultiplicitySeries::setLevelFrom(): tick " + to_string(tick)
+      + " is before the last change (" + to_string(lastChange.tick) + ")"
+      );
+  }
+
+  if (tick == lastChange.tick) {
+    lastChange.level = level;
+    // the first change is kept even when it matches the starting level
+    if ((fChanges.size() > 1U) && (fChanges[fChanges.size() - 2U].level == level))
+      fChanges.pop_back();
+  }
+  else if (level != lastChange.level) fChanges.push_back({ tick, level });
+
+} // sbn::MultiplicitySeries<>::setLevelFrom()
+
+
+// -----------------------------------------------------------------------------
+template <typename Tick, typename Level>
+auto sbn::MultiplicitySeries<Tick, Level>::maxInWindow
+  (Tick_t first, Tick_t last) const -> Level_t
+{
+  if (!(first < last)) return Level_t{ 0 };
+
+  Level_t maxLevel = Level_t{ 0 };
+  for (auto it = changeAt(first); (it != fChanges.end()) && (it->tick < last); ++it)
+    maxLevel = std::max(maxLevel, it->level);
+  return maxLevel;
+} // sbn::MultiplicitySeries<>::maxInWindow()
+
+
+// -----------------------------------------------------------------------------
+template <typename Tick, typename Level>
+auto sbn::MultiplicitySeries<Tick, Level>::ticksAtLeast
+  (Level_t threshold, Tick_t first, Tick_t last) const -> Tick_t
+{
+  Tick_t ticks { 0 };
+  if (!(first < last)) return ticks;
+
+  for (auto it = changeAt(first); (it != fChanges.end()) && (it->tick < last); ++it) {
+    if (it->level < threshold) continue;
+    ticks += endOf(it, last) - std::max(it->tick, first);
+  }
+  return ticks;
+} // sbn::MultiplicitySeries<>::ticksAtLeast()
+
+
+// -----------------------------------------------------------------------------
+template <typename Tick, typename Level>
+auto sbn::MultiplicitySeries<Tick, Level>::ticksAtLevels
+  (Tick_t first, Tick_t last) const -> std::vector<Tick_t>
+{
+  std::vector<Tick_t> ticks;
+  if (!(first < last)) return ticks;
+
+  for (auto it = changeAt(first); (it != fChanges.end()) && (it->tick < last); ++it) {
+    std::size_t const level = it->level;
+    if (ticks.size() <= level) ticks.resize(level + 1U, Tick_t{ 0 });
+    ticks[level] += endOf(it, last) - std::max(it->tick, first);
+  }
+  return ticks;
+} // sbn::MultiplicitySeries<>::ticksAtLevels()
+
+
+// -----------------------------------------------------------------------------
+template <typename Tick, typename Level>
+auto sbn::MultiplicitySeries<Tick, Level>::firstAtLeast
+  (Level_t threshold, Tick_t from) const -> std::optional<Tick_t>
+{
+  for (auto it = changeAt(from); it != fChanges.end(); ++it)
+    if (it->level >= threshold) return std::max(it->tick, from);
+  return std::nullopt;
+} // sbn::MultiplicitySeries<>::firstAtLeast()
+
+
+// -----------------------------------------------------------------------------
+template <typename Tick, typename Level>
+template <typename Series, typename Delays>
+auto sbn::MultiplicitySeries<Tick, Level>::Sum
+  (Series const& series, Delays const& delays) -> MultiplicitySeries
+{
+  /*
+   * The changes of each series (after the starting one) are already sorted:
+   * a heap keeps the next change of each series, and the earliest one is
+   * applied to the running level until all are consumed.
+   */
+  using std::begin, std::end, std::to_string;
+  using Diff_t = std::make_signed_t<Level_t>;
+
+  std::size_t const nSeries = std::distance(begin(series), end(series));
+  std::size_t const nDelays = std::distance(begin(delays), end(delays));
+  if ((nDelays != 0U) && (nDelays != nSeries)) {
+    throw std::runtime_error(
+      "sbn::MultiplicitySeries::Sum(): " + to_string(nDelays)
+      + " delays specified for " + to_string(nSeries) + " series"
+      );
+  }
+
+  struct Cursor_t {
+    Change_t const* next; ///< Next change to be applied.
+    Change_t const* end; ///< End of the changes of this series.
+    Tick_t delay; ///< Delay of the series.
+
+    Tick_t tick() const { return next->tick + delay; }
+  }; // Cursor_t
+
+  auto const later
+    = [](Cursor_t const& a, Cursor_t const& b){ return a.tick() > b.tick(); };
+
+  MultiplicitySeries result;
+  Diff_t level { 0 };
+  std::vector<Cursor_t> heap;
+  heap.reserve(nSeries);
+  std::size_t nChanges = 0U;
+  auto iDelay = begin(delays);
+  for (MultiplicitySeries const& s: series) {
+    Tick_t const delay = (nDelays == 0U)? Tick_t{ 0 }: *(iDelay++);
+    std::vector<Change_t> const& changes = s.fChanges;
+    level += static_cast<Diff_t>(changes.front().level);
+    nChanges += changes.size() - 1U;
+    if (changes.size() > 1U)
+      heap.push_back({ changes.data() + 1, changes.data() + changes.size(), delay });
+  } // for
+  std::make_heap(heap.begin(), heap.end(), later);
+
+  result.fChanges.front().level = static_cast<Level_t>(level);
+  result.fChanges.reserve(nChanges + 1U);
+  while (!heap.empty()) {
+
+    // apply all the changes happening at this tick
+    Tick_t const tick = heap.front().tick();
+    do {
+      std::pop_heap(heap.begin(), heap.end(), later);
+      Cursor_t& cursor = heap.back();
+      level += static_cast<Diff_t>(cursor.next->level)
+        - static_cast<Diff_t>(std::prev(cursor.next)->level);
+      if (++cursor.next == cursor.end) heap.pop_back();
+      else std::push_heap(heap.begin(), heap.end(), later);
+    } while (!heap.empty() && (heap.front().tick() == tick));
+
+    if (static_cast<Level_t>(level) != result.fChanges.back().level)
+      result.fChanges.push_back({ tick, static_cast<Level_t>(level) });
+
+  } // while
+
+  return result;
+} // sbn::MultiplicitySeries<>::Sum()
+
+
+// -----------------------------------------------------------------------------
+
+#endif // SBNOBJ_COMMON_TRIGGER_MULTIPLICITYSERIES_H
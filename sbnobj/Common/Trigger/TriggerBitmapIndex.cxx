@@ -0,0 +1,262 @@
+/**
+ * @file sbnobj/Common/Trigger/TriggerBitmapIndex.cxx
+ * @brief Data product indexing the events of a subrun by trigger type.
+ * @see sbnobj/Common/Trigger/TriggerBitmapIndex.h
+ */
+
+#include "sbnobj/Common/Trigger/TriggerBitmapIndex.h"
+
+// C/C++ standard library
+#include <algorithm> // std::stable_sort(), std::adjacent_find()
+#include <limits>
+#include <stdexcept> // std::logic_error, std::runtime_error, std::out_of_range
+#include <string>
+#include <utility> // std::move()
+
+
+// -----------------------------------------------------------------------------
+namespace {
+
+  // word-aligned hybrid (WAH) words: a literal has the highest bit clear and
+  // 31 entry bits; a fill has the highest bit set, the fill value in the next
+  // one and the number of 31-bit groups in the others
+  constexpr std::uint32_t FillFlag = 0x80000000U;
+  constexpr std::uint32_t FillOnes = 0x40000000U;
+  constexpr std::uint32_t MaxFillGroups = FillOnes - 1U;
+  constexpr std::uint32_t LiteralMask = 0x7FFFFFFFU;
+
+  /// Compresses entries set in increasing order into a WAH bitmap.
+  class WAHEncoder {
+
+    std::vector<std::uint32_t> fWords;
+    std::size_t fGroup = 0U; ///< Group of the current literal.
+    std::uint32_t fLiteral = 0U; ///< Bits of the current group.
+
+    void appendFill(bool ones, std::size_t nGroups)
+      {
+        std::uint32_t const fill = FillFlag | (ones? FillOnes: 0U);
+        while (nGroups > 0U) {
+          if (!fWords.empty() && ((fWords.back() & ~MaxFillGroups) == fill)
+            && ((fWords.back() & MaxFillGroups) < MaxFillGroups)
+          ) {
+            std::size_t const room = MaxFillGroups - (fWords.back() & MaxFillGroups);
+            std::size_t const n = std::min(room, nGroups);
+            fWords.back() += static_cast<std::uint32_t>(n);
+            nGroups -= n;
+          }
+          else {
+            std::size_t const n = std::min<std::size_t>(MaxFillGroups, nGroups);
+            fWords.push_back(fill | static_cast<std::uint32_t>(n));
+            nGroups -= n;
+          }
+        } // while
+      }
+
+    void appendGroup(std::uint32_t literal)
+      {
+        if (literal == 0U) appendFill(false, 1U);
+        else if (literal == LiteralMask) appendFill(true, 1U);
+        else fWords.push_back(literal);
+      }
+
+      public:
+
+    /// Sets `entry`, not lower than the ones already set.
+    void set(std::uint32_t entry)
+      {
+        std::size_t const group = entry / 31U;
+        if (group != fGroup) {
+          appendGroup(fLiteral);
+          appendFill(false, group - fGroup - 1U);
+          fGroup = group;
+          fLiteral = 0U;
+        }
+        fLiteral |= std::uint32_t{ 1U } << (entry % 31U);
+      }
+
+    /// Returns the words of the bitmap (trailing empty groups are omitted).
+    std::vector<std::uint32_t> finish()
+      {
+        if (fLiteral != 0U) appendGroup(fLiteral);
+        fLiteral = 0U;
+        return std::move(fWords);
+      }
+
+  }; // WAHEncoder
+
+} // local namespace
+
+
+// -----------------------------------------------------------------------------
+void sbn::TriggerBitmapIndex::add
+  (Entry_t entry, ExtraTriggerInfo const& info, sbn::bits::gateSelectionMask gates)
+{
+  if (fFinalized) {
+    throw std::logic_error
+      { "sbn::TriggerBitmapIndex::add(): index already finalized" };
+  }
+  if (entry == std::numeric_limits<Entry_t>::max()) {
+    throw std::out_of_range{ "sbn::TriggerBitmapIndex::add(): entry "
+      + std::to_string(entry) + " not supported" };
+  }
+
+  unsigned int const source = info.isValid()
+    ? sbn::bits::value(info.sourceType)
+    : sbn::bits::value(sbn::triggerSource::NBits);
+  unsigned int const type = info.isValid()
+    ? sbn::bits::value(info.triggerType)
+    : sbn::bits::value(sbn::triggerType::NBits);
+  fPending.push_back({
+    entry,
+    static_cast<std::uint8_t>(group(source, NSources)),
+    static_cast<std::uint8_t>(group(type, NTypes)),
+    gates.bits
+    });
+} // sbn::TriggerBitmapIndex::add()
+
+
+// -----------------------------------------------------------------------------
+void sbn::TriggerBitmapIndex::finalize() {
+
+  if (fFinalized) return;
+
+  std::stable_sort(fPending.begin(), fPending.end(),
+    [](Pending_t const& a, Pending_t const& b){ return a.entry < b.entry; });
+  auto const dup = std::adjacent_find(fPending.begin(), fPending.end(),
+    [](Pending_t const& a, Pending_t const& b){ return a.entry == b.entry; });
+  if (dup != fPending.end()) {
+    throw std::runtime_error{ "sbn::TriggerBitmapIndex::finalize(): entry "
+      + std::to_string(dup->entry) + " added more than once" };
+  }
+
+  std::vector<WAHEncoder> encoders(NBitmaps);
+  for (Pending_t const& event: fPending) {
+    encoders[event.source].set(event.entry);
+    encoders[NSources + event.type].set(event.entry);
+    for (std::size_t g = 0; g < NGates; ++g)
+      if (event.gates & (1U << g)) encoders[NSources + NTypes + g].set(event.entry);
+  } // for
+
+  fWords.clear();
+  fOffsets.assign(1U, 0U);
+  for (WAHEncoder& encoder: encoders) {
+    std::vector<std::uint32_t> const words = encoder.finish();
+    fWords.insert(fWords.end(), words.begin(), words.end());
+    fOffsets.push_back(static_cast<std::uint32_t>(fWords.size()));
+  }
+
+  fNEntries = fPending.empty()? 0U: fPending.back().entry + 1U;
+  fPending.clear();
+  fPending.shrink_to_fit();
+  fFinalized = true;
+} // sbn::TriggerBitmapIndex::finalize()
+
+
+// -----------------------------------------------------------------------------
+auto sbn::TriggerBitmapIndex::entries(sbn::triggerSource source) const
+  -> std::vector<Entry_t>
+{
+  requireFinalized("entries");
+  std::vector<std::uint32_t> groups(nGroups(), 0U);
+  orInto(group(sbn::bits::value(source), NSources), groups);
+  return entriesOf(groups);
+} // sbn::TriggerBitmapIndex::entries(triggerSource)
+
+
+// -----------------------------------------------------------------------------
+auto sbn::TriggerBitmapIndex::entries(sbn::triggerType type) const
+  -> std::vector<Entry_t>
+{
+  requireFinalized("entries");
+  std::vector<std::uint32_t> groups(nGroups(), 0U);
+  orInto(NSources + group(sbn::bits::value(type), NTypes), groups);
+  return entriesOf(groups);
+} // sbn::TriggerBitmapIndex::entries(triggerType)
+
+
+// -----------------------------------------------------------------------------
+auto sbn::TriggerBitmapIndex::entries(sbn::gateSelection gate) const
+  -> std::vector<Entry_t>
+{
+  requireFinalized("entries");
+  std::vector<std::uint32_t> groups(nGroups(), 0U);
+  unsigned int const g = sbn::bits::value(gate);
+  if (g < NGates) orInto(NSources + NTypes + g, groups);
+  return entriesOf(groups);
+} // sbn::TriggerBitmapIndex::entries(gateSelection)
+
+
+// -----------------------------------------------------------------------------
+auto sbn::TriggerBitmapIndex::select(
+  sbn::triggerSourceMask sources,
+  sbn::triggerTypeMask types,
+  sbn::bits::gateSelectionMask gates
+) const -> std::vector<Entry_t> {
+  requireFinalized("select");
+
+  // every event has a source bitmap: with no source requirement, all of them
+  std::vector<std::uint32_t> selected = unionOf
+    (0U, NSources, sources.bits? sources.bits: ((1U << NSources) - 1U));
+  auto const restrictTo = [&selected](std::vector<std::uint32_t> const& other)
+    { for (std::size_t i = 0; i < selected.size(); ++i) selected[i] &= other[i]; };
+  if (types.bits) restrictTo(unionOf(NSources, NTypes, types.bits));
+  if (gates.bits) restrictTo(unionOf(NSources + NTypes, NGates, gates.bits));
+
+  return entriesOf(selected);
+} // sbn::TriggerBitmapIndex::select()
+
+
+// -----------------------------------------------------------------------------
+void sbn::TriggerBitmapIndex::orInto
+  (std::size_t bitmap, std::vector<std::uint32_t>& groups) const
+{
+  std::size_t g = 0U;
+  for (std::size_t i = fOffsets[bitmap]; i < fOffsets[bitmap + 1U]; ++i) {
+    std::uint32_t const word = fWords[i];
+    if (!(word & FillFlag)) {
+      groups[g++] |= word;
+      continue;
+    }
+    std::size_t const n = word & MaxFillGroups;
+    if (word & FillOnes)
+      for (std::size_t k = 0; k < n; ++k) groups[g + k] = LiteralMask;
+    g += n;
+  } // for
+} // sbn::TriggerBitmapIndex::orInto()
+
+
+// -----------------------------------------------------------------------------
+std::vector<std::uint32_t> sbn::TriggerBitmapIndex::unionOf
+  (std::size_t firstBitmap, std::size_t nBitmaps, unsigned int mask) const
+{
+  std::vector<std::uint32_t> groups(nGroups(), 0U);
+  for (std::size_t b = 0; (b < nBitmaps) && (mask != 0U); ++b, mask >>= 1U)
+    if (mask & 1U) orInto(firstBitmap + b, groups);
+  return groups;
+} // sbn::TriggerBitmapIndex::unionOf()
+
+
+// -----------------------------------------------------------------------------
+auto sbn::TriggerBitmapIndex::entriesOf
+  (std::vector<std::uint32_t> const& groups) -> std::vector<Entry_t>
+{
+  std::vector<Entry_t> entries;
+  for (std::size_t g = 0; g < groups.size(); ++g) {
+    for (std::uint32_t bits = groups[g]; bits; bits &= bits - 1U) {
+      entries.push_back(static_cast<Entry_t>
+        (g * GroupBits + sbn::bits::lowestBitSet(bits)));
+    }
+  } // for
+  return entries;
+} // sbn::TriggerBitmapIndex::entriesOf()
+
+
+// -----------------------------------------------------------------------------
+void sbn::TriggerBitmapIndex::requireFinalized(char const* caller) const {
+  if (fFinalized) return;
+  throw std::logic_error{ "sbn::TriggerBitmapIndex::" + std::string{ caller }
+    + "(): index not finalized (call finalize() first)" };
+} // sbn::TriggerBitmapIndex::requireFinalized()
+
+
+// -----------------------------------------------------------------------------
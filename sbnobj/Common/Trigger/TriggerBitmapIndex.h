@@ -0,0 +1,190 @@
+/**
+ * @file sbnobj/Common/Trigger/TriggerBitmapIndex.h
+ * @brief Data product indexing the events of a subrun by trigger type.
+ * @see sbnobj/Common/Trigger/TriggerBitmapIndex.cxx
+ */
+
+#ifndef SBNOBJ_COMMON_TRIGGER_TRIGGERBITMAPINDEX_H
+#define SBNOBJ_COMMON_TRIGGER_TRIGGERBITMAPINDEX_H
+
+
+// SBN libraries
+#include "sbnobj/Common/Trigger/ExtraTriggerInfo.h"
+#include "sbnobj/Common/Trigger/BeamBits.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint32_t, std::uint8_t
+#include <vector>
+
+
+// -----------------------------------------------------------------------------
+namespace sbn { class TriggerBitmapIndex; }
+/**
+ * @brief Compressed bitmaps of the events of each trigger source, type and
+ *        gate selection.
+ *
+ * This subrun-level (or file-level) product lists, for each value of
+ * `sbn::triggerSource`, `sbn::triggerType` and `sbn::gateSelection`, the
+ * events with that value, so that a skimming job can select the matching
+ * events without reading the `sbn::ExtraTriggerInfo` of all of them:
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * std::vector<std::uint32_t> const entries = index.select(
+ *   sbn::bits::mask(sbn::triggerSource::BNB, sbn::triggerSource::OffbeamBNB),
+ *   sbn::bits::mask(sbn::triggerType::Majority)
+ *   );
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * Events are identified by an entry number chosen by the producer (e.g. the
+ * position of the event in its file or subrun), which must be unique.
+ * Events are added with `add()`, and `finalize()` must be called after the
+ * last one: it sorts the events and compresses the bitmaps. Queries on an
+ * index not finalized throw `std::logic_error`, and so does adding more
+ * events after it.
+ *
+ * Events with invalid trigger information are indexed under
+ * `sbn::triggerSource::NBits` and `sbn::triggerType::NBits`.
+ *
+ * The bitmaps use word-aligned hybrid compression: each 32-bit word is
+ * either a literal of 31 entries, or a run of groups of 31 entries all with
+ * the same value. Sparse bitmaps (e.g. calibration triggers) and long runs
+ * of the same trigger take a few words; the others take about one bit per
+ * event.
+ */
+class sbn::TriggerBitmapIndex {
+
+    public:
+
+  using Entry_t = std::uint32_t; ///< Type of event entry number.
+
+
+  TriggerBitmapIndex() = default;
+
+  /**
+   * @brief Adds the event at `entry`, with its trigger information.
+   * @param entry the entry number of the event
+   * @param info the trigger information of the event
+   * @param gates the gates enabled for the event
+   * @throw std::logic_error if the index is already finalized
+   * @throw std::out_of_range if `entry` is the largest `Entry_t` value
+   */
+  void add
+    (Entry_t entry, ExtraTriggerInfo const& info, sbn::bits::gateSelectionMask gates = {});
+
+  /**
+   * @brief Sorts the events and creates the compressed bitmaps.
+   * @throw std::runtime_error if the same entry was added more than once
+   */
+  void finalize();
+
+  /// Returns whether the index is complete (`finalize()`).
+  bool isFinalized() const noexcept { return fFinalized; }
+
+  /// One past the highest entry number in the index (`0` if empty).
+  Entry_t nEntries() const noexcept { return fNEntries; }
+
+  /// Number of words of all the compressed bitmaps.
+  std::size_t nWords() const noexcept { return fWords.size(); }
+
+
+  // --- BEGIN -- Queries ------------------------------------------------------
+  /// @name Queries
+  /// @{
+
+  /// Returns the entries with the specified trigger `source`, sorted.
+  std::vector<Entry_t> entries(sbn::triggerSource source) const;
+
+  /// Returns the entries with the specified trigger `type`, sorted.
+  std::vector<Entry_t> entries(sbn::triggerType type) const;
+
+  /// Returns the entries with the specified `gate` enabled, sorted.
+  std::vector<Entry_t> entries(sbn::gateSelection gate) const;
+
+  /**
+   * @brief Returns the entries matching all the specified masks, sorted.
+   * @param sources the entry must have any of these trigger sources
+   * @param types the entry must have any of these trigger types
+   * @param gates the entry must have any of these gates enabled
+   *
+   * An empty mask is no requirement: with all the masks empty, all the
+   * entries in the index are returned.
+   */
+  std::vector<Entry_t> select(
+    sbn::triggerSourceMask sources,
+    sbn::triggerTypeMask types = {},
+    sbn::bits::gateSelectionMask gates = {}
+    ) const;
+
+  /// @}
+  // --- END ---- Queries ------------------------------------------------------
+
+
+    private:
+
+  /// Entry bits in each word of the bitmaps.
+  static constexpr unsigned int GroupBits = 31U;
+
+  /// Number of source bitmaps (including the invalid one).
+  static constexpr std::size_t NSources
+    = sbn::bits::value(sbn::triggerSource::NBits) + 1U;
+
+  /// Number of type bitmaps (including the invalid one).
+  static constexpr std::size_t NTypes
+    = sbn::bits::value(sbn::triggerType::NBits) + 1U;
+
+  /// Number of gate selection bitmaps.
+  static constexpr std::size_t NGates
+    = sbn::bits::value(sbn::gateSelection::NBits);
+
+  /// Total number of bitmaps: sources, then types, then gates.
+  static constexpr std::size_t NBitmaps = NSources + NTypes + NGates;
+
+  /// An event added and not yet indexed.
+  struct Pending_t {
+    Entry_t entry;
+    std::uint8_t source; ///< Source bitmap.
+    std::uint8_t type; ///< Type bitmap.
+    unsigned int gates; ///< Bits of the gate selection mask.
+  }; // Pending_t
+
+  std::vector<std::uint32_t> fWords; ///< All the compressed bitmaps.
+
+  /// First word in `fWords` of each bitmap, plus the end.
+  std::vector<std::uint32_t> fOffsets;
+
+  Entry_t fNEntries = 0U; ///< One past the highest entry.
+
+  bool fFinalized = false; ///< Whether bitmaps are complete.
+
+  std::vector<Pending_t> fPending; ///< Events added (not stored).
+
+  /// Throws `std::logic_error` if not finalized.
+  void requireFinalized(char const* caller) const;
+
+  /// Returns the number of 31-entry groups covering all the entries.
+  std::size_t nGroups() const noexcept
+    { return (std::size_t{ fNEntries } + GroupBits - 1U) / GroupBits; }
+
+  /// Adds the bits of `bitmap` to the uncompressed `groups` (bitwise or).
+  void orInto(std::size_t bitmap, std::vector<std::uint32_t>& groups) const;
+
+  /// Returns the uncompressed union of the bitmaps of the bits in `mask`,
+  /// among the `nBitmaps` starting at `firstBitmap`.
+  std::vector<std::uint32_t> unionOf
+    (std::size_t firstBitmap, std::size_t nBitmaps, unsigned int mask) const;
+
+  /// Returns the entries of the uncompressed `groups`.
+  static std::vector<Entry_t> entriesOf
+    (std::vector<std::uint32_t> const& groups);
+
+  /// Index of the bitmap of `value`, among `n` (the last one for overflows).
+  static std::size_t group(unsigned int value, std::size_t n) noexcept
+    { return (value < n)? value: n - 1U; }
+
+}; // sbn::TriggerBitmapIndex
+
+
+// -----------------------------------------------------------------------------
+
+
+#endif // SBNOBJ_COMMON_TRIGGER_TRIGGERBITMAPINDEX_H
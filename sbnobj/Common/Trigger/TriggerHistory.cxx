@@ -0,0 +1,197 @@
+/**
+ * @file sbnobj/Common/Trigger/TriggerHistory.cxx
+ * @brief Data product holding the sequence of the triggers of a subrun.
+ * @see sbnobj/Common/Trigger/TriggerHistory.h
+ */
+
+#include "sbnobj/Common/Trigger/TriggerHistory.h"
+
+// C/C++ standard library
+#include <algorithm> // std::upper_bound(), std::stable_sort()
+#include <numeric> // std::iota()
+#include <stdexcept> // std::logic_error
+#include <string>
+
+
+// -----------------------------------------------------------------------------
+namespace {
+  
+  /// Returns the elements of `column` in the order of the indices in `order`.
+  template <typename T>
+  std::vector<T> reorder
+    (std::vector<T> const& column, std::vector<std::uint32_t> const& order)
+  {
+    std::vector<T> sorted;
+    sorted.reserve(column.size());
+    for (std::uint32_t i: order) sorted.push_back(column[i]);
+    return sorted;
+  } // reorder()
+  
+} // local namespace
+
+
+// -----------------------------------------------------------------------------
+sbn::TriggerHistory::TriggerHistory(std::vector<ExtraTriggerInfo> const& infos)
+{
+  reserve(infos.size());
+  for (ExtraTriggerInfo const& info: infos) add(info);
+  finalize();
+} // sbn::TriggerHistory::TriggerHistory()
+
+
+// -----------------------------------------------------------------------------
+void sbn::TriggerHistory::reserve(std::size_t nTriggers) {
+  fTriggerTimestamps.reserve(nTriggers);
+  fBeamGateTimestamps.reserve(nTriggers);
+  fTriggerIDs.reserve(nTriggers);
+  fGateIDs.reserve(nTriggers);
+  fGateCounts.reserve(nTriggers);
+  fTriggerCounts.reserve(nTriggers);
+  fSources.reserve(nTriggers);
+} // sbn::TriggerHistory::reserve()
+
+
+// -----------------------------------------------------------------------------
+void sbn::TriggerHistory::add(ExtraTriggerInfo const& info) {
+  if (!info.isValid()) return;
+  fTriggerTimestamps.push_back(info.triggerTimestamp);
+  fBeamGateTimestamps.push_back(info.beamGateTimestamp);
+  fTriggerIDs.push_back(info.triggerID);
+  fGateIDs.push_back(info.gateID);
+  fGateCounts.push_back(info.gateCount);
+  fTriggerCounts.push_back(info.triggerCount);
+  fSources.push_back(static_cast<std::uint8_t>(sbn::bits::value(info.sourceType)));
+  
+  // the earliest trigger of each source links to the previous subruns
+  std::size_t const group = sourceGroup(fSources.back());
+  if ((fFirstTimestamps[group] == ExtraTriggerInfo::NoTimestamp)
+    || (info.triggerTimestamp < fFirstTimestamps[group])
+  ) {
+    fFirstTimestamps[group] = info.triggerTimestamp;
+    fPreviousTimestamps[group] = info.previousTriggerTimestamp;
+    fFirstGateCountsFromPrevious[group] = info.gateCountFromPreviousTrigger;
+    fFirstAnyGateCountsFromPrevious[group] = info.anyGateCountFromPreviousTrigger;
+  }
+  
+  fFinalized = false;
+} // sbn::TriggerHistory::add()
+
+
+// -----------------------------------------------------------------------------
+void sbn::TriggerHistory::finalize() {
+  
+  std::size_t const n = size();
+  
+  // triggers are usually added in time order already
+  if (!std::is_sorted(fTriggerTimestamps.begin(), fTriggerTimestamps.end())) {
+    std::vector<std::uint32_t> order(n);
+    std::iota(order.begin(), order.end(), 0U);
+    std::stable_sort(order.begin(), order.end(),
+      [this](std::uint32_t a, std::uint32_t b)
+        { return fTriggerTimestamps[a] < fTriggerTimestamps[b]; }
+      );
+    fTriggerTimestamps = reorder(fTriggerTimestamps, order);
+    fBeamGateTimestamps = reorder(fBeamGateTimestamps, order);
+    fTriggerIDs = reorder(fTriggerIDs, order);
+    fGateIDs = reorder(fGateIDs, order);
+    fGateCounts = reorder(fGateCounts, order);
+    fTriggerCounts = reorder(fTriggerCounts, order);
+    fSources = reorder(fSources, order);
+  }
+  
+  // counting sort by source keeps each group in time order
+  fSourceOffsets.assign(NSources + 1U, 0U);
+  for (std::uint8_t source: fSources) ++fSourceOffsets[sourceGroup(source) + 1U];
+  for (std::size_t s = 0; s < NSources; ++s)
+    fSourceOffsets[s + 1U] += fSourceOffsets[s];
+  
+  std::vector<std::uint32_t> next
+    { fSourceOffsets.begin(), fSourceOffsets.end() - 1 };
+  fSourceOrder.resize(n);
+  for (std::size_t i = 0; i < n; ++i)
+    fSourceOrder[next[sourceGroup(fSources[i])]++] = static_cast<std::uint32_t>(i);
+  
+  fFinalized = true;
+} // sbn::TriggerHistory::finalize()
+
+
+// -----------------------------------------------------------------------------
+std::size_t sbn::TriggerHistory::find(std::uint64_t timestamp) const {
+  requireFinalized("find");
+  auto const it = std::lower_bound
+    (fTriggerTimestamps.begin(), fTriggerTimestamps.end(), timestamp);
+  return ((it == fTriggerTimestamps.end()) || (*it != timestamp))
+    ? NoIndex: static_cast<std::size_t>(it - fTriggerTimestamps.begin());
+} // sbn::TriggerHistory::find()
+
+
+// -----------------------------------------------------------------------------
+std::size_t sbn::TriggerHistory::previousTrigger
+  (std::uint64_t timestamp, sbn::triggerSource source) const
+{
+  requireFinalized("previousTrigger");
+  std::size_t const group
+    = sourceGroup(static_cast<std::uint8_t>(sbn::bits::value(source)));
+  auto const first = fSourceOrder.begin() + fSourceOffsets[group];
+  auto const last = fSourceOrder.begin() + fSourceOffsets[group + 1U];
+  
+  // first trigger of the source at or after `timestamp`
+  auto const it = std::lower_bound(first, last, timestamp,
+    [this](std::uint32_t i, std::uint64_t t){ return fTriggerTimestamps[i] < t; }
+    );
+  return (it == first)? NoIndex: *(it - 1);
+} // sbn::TriggerHistory::previousTrigger(source)
+
+
+// -----------------------------------------------------------------------------
+std::size_t sbn::TriggerHistory::previousTrigger(std::uint64_t timestamp) const
+{
+  requireFinalized("previousTrigger");
+  auto const it = std::lower_bound
+    (fTriggerTimestamps.begin(), fTriggerTimestamps.end(), timestamp);
+  return (it == fTriggerTimestamps.begin())
+    ? NoIndex: static_cast<std::size_t>(it - fTriggerTimestamps.begin()) - 1U;
+} // sbn::TriggerHistory::previousTrigger()
+
+
+// -----------------------------------------------------------------------------
+std::uint64_t sbn::TriggerHistory::previousTriggerTimestamp
+  (std::size_t i) const
+{
+  std::size_t const prev = previousTriggerOfSameSource(i);
+  return (prev == NoIndex)
+    ? fPreviousTimestamps[sourceGroup(fSources[i])]: fTriggerTimestamps[prev];
+} // sbn::TriggerHistory::previousTriggerTimestamp()
+
+
+// -----------------------------------------------------------------------------
+unsigned int sbn::TriggerHistory::gateCountFromPreviousTrigger
+  (std::size_t i) const
+{
+  std::size_t const prev = previousTriggerOfSameSource(i);
+  return (prev == NoIndex)
+    ? fFirstGateCountsFromPrevious[sourceGroup(fSources[i])]
+    : fGateCounts[i] - fGateCounts[prev];
+} // sbn::TriggerHistory::gateCountFromPreviousTrigger()
+
+
+// -----------------------------------------------------------------------------
+unsigned int sbn::TriggerHistory::anyGateCountFromPreviousTrigger
+  (std::size_t i) const
+{
+  std::size_t const prev = previousTriggerOfSameSource(i);
+  return (prev == NoIndex)
+    ? fFirstAnyGateCountsFromPrevious[sourceGroup(fSources[i])]
+    : fGateIDs[i] - fGateIDs[prev];
+} // sbn::TriggerHistory::anyGateCountFromPreviousTrigger()
+
+
+// -----------------------------------------------------------------------------
+void sbn::TriggerHistory::requireFinalized(char const* caller) const {
+  if (fFinalized) return;
+  throw std::logic_error{ "sbn::TriggerHistory::" + std::string{ caller }
+    + "(): history not finalized (call finalize() first)" };
+} // sbn::TriggerHistory::requireFinalized()
+
+
+// -----------------------------------------------------------------------------
@@ -0,0 +1,230 @@
+/**
+ * @file sbnobj/Common/Trigger/TriggerHistory.h
+ * @brief Data product holding the sequence of the triggers of a subrun.
+ * @see sbnobj/Common/Trigger/TriggerHistory.cxx
+ */
+
+#ifndef SBNOBJ_COMMON_TRIGGER_TRIGGERHISTORY_H
+#define SBNOBJ_COMMON_TRIGGER_TRIGGERHISTORY_H
+
+
+// SBN libraries
+#include "sbnobj/Common/Trigger/ExtraTriggerInfo.h"
+#include "sbnobj/Common/Trigger/BeamBits.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint64_t, std::uint32_t, std::uint8_t
+#include <limits>
+#include <vector>
+
+
+// -----------------------------------------------------------------------------
+namespace sbn { class TriggerHistory; }
+/**
+ * @brief Sequence of all the triggers of a subrun, stored by column.
+ * 
+ * This subrun-level product collects from `sbn::ExtraTriggerInfo` the run
+ * history information of each trigger: timestamps, identifiers and gate
+ * counters. The history information of `sbn::ExtraTriggerInfo` that refers
+ * to previous triggers (e.g. `previousTriggerTimestamp` or
+ * `gateCountFromPreviousTrigger`) can be derived from it with a binary
+ * search, and an event needs only the index of its own trigger
+ * (see `find()`).
+ * 
+ * Triggers are added with `add()`, and `finalize()` must be called after the
+ * last one: it sorts the triggers by timestamp and indexes them by source.
+ * Queries on a history not finalized throw `std::logic_error`.
+ * 
+ * Indices of triggers always refer to the sorted sequence.
+ * 
+ * The history does not end at the subrun boundary: for the first trigger of
+ * each source in the subrun, the counters and the timestamp relative to the
+ * previous trigger of that source (which belongs to an earlier subrun) are
+ * taken from its `sbn::ExtraTriggerInfo` and kept in the history.
+ * Therefore `gateCountFromPreviousTrigger()`,
+ * `anyGateCountFromPreviousTrigger()` and `previousTriggerTimestamp()` match
+ * the values in `sbn::ExtraTriggerInfo` for all the triggers.
+ * `previousTrigger()` instead returns an index in this history, and it is
+ * `NoIndex` when the previous trigger is in an earlier subrun: use
+ * `isFirstOfSource()` to tell that case apart.
+ */
+class sbn::TriggerHistory {
+  
+    public:
+  
+  /// Special index value indicating the absence of a trigger.
+  static constexpr std::size_t NoIndex = std::numeric_limits<std::size_t>::max();
+  
+  
+  TriggerHistory() = default;
+  
+  /// Creates and finalizes a history of all the triggers in `infos`.
+  explicit TriggerHistory(std::vector<ExtraTriggerInfo> const& infos);
+  
+  /// Reserves room for `nTriggers` triggers.
+  void reserve(std::size_t nTriggers);
+  
+  /// Adds the trigger described by `info` (invalid `info` are ignored).
+  void add(ExtraTriggerInfo const& info);
+  
+  /// Sorts the triggers by timestamp and creates the index of sources.
+  void finalize();
+  
+  /// Returns whether the history is sorted and indexed (`finalize()`).
+  bool isFinalized() const noexcept { return fFinalized; }
+  
+  /// Number of triggers in the history.
+  std::size_t size() const noexcept { return fTriggerTimestamps.size(); }
+  bool empty() const noexcept { return fTriggerTimestamps.empty(); }
+  
+  
+  // --- BEGIN -- Trigger information ------------------------------------------
+  /// @name Trigger information
+  /// @{
+  
+  /// Absolute timestamp of trigger `i` [ns].
+  std::uint64_t triggerTimestamp(std::size_t i) const
+    { return fTriggerTimestamps[i]; }
+  
+  /// Absolute timestamp of the beam gate of trigger `i` [ns].
+  std::uint64_t beamGateTimestamp(std::size_t i) const
+    { return fBeamGateTimestamps[i]; }
+  
+  /// Identifier of trigger `i` (`ExtraTriggerInfo::triggerID`).
+  unsigned int triggerID(std::size_t i) const { return fTriggerIDs[i]; }
+  
+  /// Gates from any source from start of the run (`ExtraTriggerInfo::gateID`).
+  unsigned int gateID(std::size_t i) const { return fGateIDs[i]; }
+  
+  /// Gates from the source of trigger `i` from start of the run.
+  unsigned int gateCount(std::size_t i) const { return fGateCounts[i]; }
+  
+  /// Triggers from the source of trigger `i` from start of the run.
+  unsigned int triggerCount(std::size_t i) const { return fTriggerCounts[i]; }
+  
+  /// Source of trigger `i`.
+  sbn::triggerSource source(std::size_t i) const
+    { return static_cast<sbn::triggerSource>(fSources[i]); }
+  
+  /// Triggers sorted by time (all the absolute timestamps) [ns].
+  std::vector<std::uint64_t> const& triggerTimestamps() const
+    { return fTriggerTimestamps; }
+  
+  /// @}
+  // --- END ---- Trigger information ------------------------------------------
+  
+  
+  // --- BEGIN -- Queries ------------------------------------------------------
+  /// @name Queries
+  /// @{
+  
+  /// Returns the index of the trigger at `timestamp`, `NoIndex` if none.
+  std::size_t find(std::uint64_t timestamp) const;
+  
+  /// Returns the index of the last trigger from `source` before `timestamp`
+  /// (excluded), `NoIndex` if none.
+  std::size_t previousTrigger
+    (std::uint64_t timestamp, sbn::triggerSource source) const;
+  
+  /// Returns the index of the last trigger from any source before
+  /// `timestamp` (excluded), `NoIndex` if none.
+  std::size_t previousTrigger(std::uint64_t timestamp) const;
+  
+  /// Returns the index of the trigger from the same source preceding trigger
+  /// `i`, `NoIndex` if none in this history.
+  std::size_t previousTriggerOfSameSource(std::size_t i) const
+    { return previousTrigger(triggerTimestamp(i), source(i)); }
+  
+  /// Returns whether trigger `i` is the first one of its source in the history
+  /// (its previous trigger, if any, is in an earlier subrun).
+  bool isFirstOfSource(std::size_t i) const
+    { return previousTriggerOfSameSource(i) == NoIndex; }
+  
+  /**
+   * @brief Timestamp of the previous trigger from the same source [ns]
+   * @return the timestamp, `ExtraTriggerInfo::NoTimestamp` if none in the run
+   * @see `ExtraTriggerInfo::previousTriggerTimestamp`
+   * 
+   * The previous trigger may belong to an earlier subrun.
+   */
+  std::uint64_t previousTriggerTimestamp(std::size_t i) const;
+  
+  /**
+   * @brief Gates from the same source since the previous trigger of it.
+   * @return the count, as in `ExtraTriggerInfo::gateCountFromPreviousTrigger`
+   * @see `ExtraTriggerInfo::gateCountFromPreviousTrigger`
+   * 
+   * The previous trigger may belong to an earlier subrun.
+   */
+  unsigned int gateCountFromPreviousTrigger(std::size_t i) const;
+  
+  /**
+   * @brief Gates from any source since the previous trigger of the same source.
+   * @return the count, as in `ExtraTriggerInfo::anyGateCountFromPreviousTrigger`
+   * @see `ExtraTriggerInfo::anyGateCountFromPreviousTrigger`
+   * 
+   * The previous trigger may belong to an earlier subrun.
+   */
+  unsigned int anyGateCountFromPreviousTrigger(std::size_t i) const;
+  
+  /// @}
+  // --- END ---- Queries ------------------------------------------------------
+  
+  
+    private:
+  
+  /// Number of source groups (including the invalid one).
+  static constexpr std::size_t NSources
+    = sbn::bits::value(sbn::triggerSource::NBits) + 1U;
+  
+  // all columns are sorted by trigger timestamp after `finalize()`
+  std::vector<std::uint64_t> fTriggerTimestamps; ///< Trigger times [ns].
+  std::vector<std::uint64_t> fBeamGateTimestamps; ///< Beam gate times [ns].
+  std::vector<unsigned int> fTriggerIDs; ///< Trigger identifiers.
+  std::vector<unsigned int> fGateIDs; ///< Gate counter (any source).
+  std::vector<unsigned int> fGateCounts; ///< Gate counter (same source).
+  std::vector<unsigned int> fTriggerCounts; ///< Trigger counter (same source).
+  std::vector<std::uint8_t> fSources; ///< Trigger source values.
+  
+  /// Trigger indices grouped by source, each group sorted by time.
+  std::vector<std::uint32_t> fSourceOrder;
+  
+  /// First entry in `fSourceOrder` of each source, plus the end.
+  std::vector<std::uint32_t> fSourceOffsets;
+  
+  // history across the subrun boundary, one entry per source group, from the
+  // first trigger of each source in the history
+  
+  /// Timestamp of the first trigger of each source [ns].
+  std::vector<std::uint64_t> fFirstTimestamps
+    = std::vector<std::uint64_t>(NSources, ExtraTriggerInfo::NoTimestamp);
+  
+  /// Timestamp of the trigger of each source preceding the history [ns].
+  std::vector<std::uint64_t> fPreviousTimestamps
+    = std::vector<std::uint64_t>(NSources, ExtraTriggerInfo::NoTimestamp);
+  
+  /// Gates of the source, from the trigger preceding the history to the first.
+  std::vector<unsigned int> fFirstGateCountsFromPrevious
+    = std::vector<unsigned int>(NSources, 0U);
+  
+  /// Gates of any source, from the trigger preceding the history to the first.
+  std::vector<unsigned int> fFirstAnyGateCountsFromPrevious
+    = std::vector<unsigned int>(NSources, 0U);
+  
+  bool fFinalized = false; ///< Whether columns are sorted and indexed.
+  
+  /// Throws `std::logic_error` if not finalized.
+  void requireFinalized(char const* caller) const;
+  
+  /// Index of the source group of `source`.
+  static std::size_t sourceGroup(std::uint8_t source) noexcept
+    { return (source < NSources)? source: NSources - 1U; }
+  
+}; // sbn::TriggerHistory
+
+
+// -----------------------------------------------------------------------------
+
+
+#endif // SBNOBJ_COMMON_TRIGGER_TRIGGERHISTORY_H
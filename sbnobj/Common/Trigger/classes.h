@@ -6,12 +6,16 @@
  * Enables dictionary definitions for:
  * 
  * * `sbn::ExtraTriggerInfo`
+ * * `sbn::TriggerHistory`
+ * * `sbn::TriggerBitmapIndex`
  * 
  * See also `sbnobj/Common/Trigger/classes_def.xml`.
  */
 
 // SBN libraries
 #include "sbnobj/Common/Trigger/ExtraTriggerInfo.h"
+#include "sbnobj/Common/Trigger/TriggerHistory.h"
+#include "sbnobj/Common/Trigger/TriggerBitmapIndex.h"
 
 // framework libraries
 #include "canvas/Persistency/Common/Ptr.h"
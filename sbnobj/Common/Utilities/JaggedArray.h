@@ -0,0 +1,333 @@
+/**
+ * @file   sbnobj/Common/Utilities/JaggedArray.h
+ * @brief  A sequence of variable-length rows in a single flat buffer.
+ * @date   October 14, 2026
+ *
+ * This is a header-only library.
+ *
+ * `sbn::JaggedArray` is meant as a data product member replacing
+ * `std::vector<std::vector<T>>`: ROOT can split it (it only has two plain
+ * vectors), the values of all the rows are compressed together, and the
+ * rows can be read as a column.
+ * Each data product using it needs a dictionary of the specific
+ * instantiation, in its own `classes_def.xml`.
+ */
+
+#ifndef SBNOBJ_COMMON_UTILITIES_JAGGEDARRAY_H
+#define SBNOBJ_COMMON_UTILITIES_JAGGEDARRAY_H
+
+
+// C/C++ standard libraries
+#include <iterator> // std::random_access_iterator_tag, std::begin(), std::end()
+#include <stdexcept> // std::out_of_range, std::invalid_argument
+#include <string> // std::to_string()
+#include <type_traits> // std::remove_cv_t, std::remove_reference_t
+#include <utility> // std::move()
+#include <vector>
+#include <cstddef> // std::size_t, std::ptrdiff_t
+#include <cstdint> // std::uint32_t
+
+
+// -----------------------------------------------------------------------------
+namespace sbn {
+
+  template <typename Ptr> class JaggedRange;
+
+  template <typename T, typename Offset = std::uint32_t>
+  class JaggedArray;
+
+} // namespace sbn
+
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief A non-owning view of a contiguous range of values.
+ * @tparam Ptr type of pointer to the values (`T*` or `T const*`)
+ *
+ * This is the type of a row of a `sbn::JaggedArray`. It stays valid until
+ * the values of the array are reallocated (e.g. by adding values).
+ */
+template <typename Ptr>
+class sbn::JaggedRange {
+ public:
+  using pointer = Ptr;
+  using iterator = Ptr;
+  using reference = decltype(*std::declval<Ptr>());
+  using size_type = std::size_t;
+
+  JaggedRange() = default;
+  JaggedRange(Ptr begin, Ptr end): fBegin(begin), fEnd(end) {}
+
+  iterator begin() const { return fBegin; }
+  iterator end() const { return fEnd; }
+  pointer data() const { return fBegin; }
+
+  size_type size() const { return static_cast<size_type>(fEnd - fBegin); }
+  bool empty() const { return fBegin == fEnd; }
+
+  reference operator[] (size_type i) const { return fBegin[i]; }
+  reference front() const { return *fBegin; }
+  reference back() const { return *(fEnd - 1); }
+
+  /// Returns a copy of the values of the range.
+  template <typename Cont = std::vector<std::remove_cv_t<std::remove_reference_t<reference>>>>
+  Cont copy() const { return Cont(fBegin, fEnd); }
+
+ private:
+  Ptr fBegin = nullptr;
+  Ptr fEnd = nullptr;
+}; // sbn::JaggedRange
+
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief List of rows of values with different length, stored contiguously.
+ * @tparam T type of the values
+ * @tparam Offset type of the index of the values (limits the total count)
+ *
+ * The values of the row `i` are the ones in [ `offsets()[i]`,
+ * `offsets()[i + 1]` [ of `values()`. Rows are added at the end, either
+ * whole, with `push_back()`, or value by value, with `addRow()` followed by
+ * `append()` calls.
+ *
+ * Example:
+ * @code
+ * sbn::JaggedArray<float> weights;
+ * weights.push_back(std::vector<float>{ 1.0, 0.9, 1.1 });
+ * weights.addRow();
+ * weights.append(0.5);
+ *
+ * for (auto const& row: weights) // JaggedRange<float const*>
+ *   for (float w: row) std::cout << " " << w;
+ * @endcode
+ *
+ * The conversions from and to `std::vector<std::vector<T>>`,
+ * `fromNested()` and `toNested()`, are provided for schema evolution rules
+ * of data products migrating to this layout.
+ */
+template <typename T, typename Offset /* = std::uint32_t */>
+class sbn::JaggedArray {
+ public:
+  using value_type = T;
+  using offset_type = Offset;
+  using size_type = std::size_t;
+  using row_type = JaggedRange<T*>; ///< Mutable view of a row.
+  using const_row_type = JaggedRange<T const*>; ///< View of a row.
+
+  /// Random access iterator on the rows of the array.
+  class const_iterator {
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = const_row_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = const_row_type;
+
+    const_iterator() = default;
+    const_iterator(JaggedArray const* array, size_type row)
+      : fArray(array), fRow(row) {}
+
+    reference operator* () const { return (*fArray)[fRow]; }
+    reference operator[] (difference_type n) const
+      { return (*fArray)[fRow + n]; }
+
+    const_iterator& operator++ () { ++fRow; return *this; }
+    const_iterator operator++ (int) { auto old = *this; ++fRow; return old; }
+    const_iterator& operator-- () { --fRow; return *this; }
+    const_iterator operator-- (int) { auto old = *this; --fRow; return old; }
+    const_iterator& operator+= (difference_type n) { fRow += n; return *this; }
+    const_iterator& operator-= (difference_type n) { fRow -= n; return *this; }
+    const_iterator operator+ (difference_type n) const
+      { return { fArray, fRow + n }; }
+    const_iterator operator- (difference_type n) const
+      { return { fArray, fRow - n }; }
+    difference_type operator- (const_iterator const& other) const
+      { return static_cast<difference_type>(fRow - other.fRow); }
+
+    bool operator== (const_iterator const& other) const
+      { return fRow == other.fRow; }
+    bool operator!= (const_iterator const& other) const
+      { return fRow != other.fRow; }
+    bool operator< (const_iterator const& other) const
+      { return fRow < other.fRow; }
+
+   private:
+    JaggedArray const* fArray = nullptr;
+    size_type fRow = 0;
+  }; // const_iterator
+
+
+  /// Constructor: an array with no rows.
+  JaggedArray() = default;
+
+
+  // --- BEGIN -- Access -------------------------------------------------------
+  /// @name Access
+  /// @{
+
+  /// Returns the number of rows.
+  size_type size() const { return fOffsets.size() - 1; }
+
+  /// Returns whether there are no rows.
+  bool empty() const { return size() == 0; }
+
+  /// Returns the number of values in all the rows.
+  size_type nValues() const { return fValues.size(); }
+
+  /// Returns the number of values in the specified row.
+  size_type rowSize(size_type row) const
+    { return fOffsets[row + 1] - fOffsets[row]; }
+
+  /// Returns the index in `values()` of the first value of `row`.
+  size_type rowOffset(size_type row) const { return fOffsets[row]; }
+
+  //@{
+  /// Returns a view of the values of the specified row (no range check).
+  const_row_type operator[] (size_type row) const
+    { return { fValues.data() + fOffsets[row], fValues.data() + fOffsets[row + 1] }; }
+  row_type operator[] (size_type row)
+    { return { fValues.data() + fOffsets[row], fValues.data() + fOffsets[row + 1] }; }
+  //@}
+
+  //@{
+  /// Returns a view of the specified row.
+  /// @throw std::out_of_range if there is no such row
+  const_row_type at(size_type row) const
+    { checkRow(row); return (*this)[row]; }
+  row_type at(size_type row) { checkRow(row); return (*this)[row]; }
+  //@}
+
+  /// @{
+  /// @name Iteration on the rows
+  const_iterator begin() const { return { this, 0 }; }
+  const_iterator end() const { return { this, size() }; }
+  /// @}
+
+  /// Returns all the values, row after row.
+  std::vector<T> const& values() const { return fValues; }
+
+  /// Returns the start of each row in `values()`, plus the end of the last.
+  std::vector<Offset> const& offsets() const { return fOffsets; }
+
+  /// @}
+  // --- END ---- Access -------------------------------------------------------
+
+
+  // --- BEGIN -- Modification -------------------------------------------------
+  /// @name Modification
+  /// @{
+
+  /// Prepares room for `rows` rows with a total of `values` values.
+  void reserve(size_type rows, size_type values)
+    { fOffsets.reserve(rows + 1); fValues.reserve(values); }
+
+  /// Removes all the rows.
+  void clear() { fValues.clear(); fOffsets.assign(1U, Offset{ 0 }); }
+
+  /// Adds a new row with the values in [ `first`, `last` [.
+  template <typename Iter>
+  row_type push_back(Iter first, Iter last)
+    {
+      fValues.insert(fValues.end(), first, last);
+      fOffsets.push_back(static_cast<Offset>(fValues.size()));
+      return (*this)[size() - 1];
+    }
+
+  /// Adds a new row with all the values in `row` (any iterable).
+  template <typename Row>
+  row_type push_back(Row const& row)
+    { using std::begin, std::end; return push_back(begin(row), end(row)); }
+
+  /// Adds a new, empty row, to be filled with `append()`.
+  void addRow() { fOffsets.push_back(fOffsets.back()); }
+
+  /// Adds a value at the end of the last row (which must exist).
+  void append(T value)
+    { fValues.push_back(std::move(value)); ++fOffsets.back(); }
+
+  /// @}
+  // --- END ---- Modification -------------------------------------------------
+
+
+  // --- BEGIN -- Conversions --------------------------------------------------
+  /// @name Conversions
+  /// @{
+
+  /// Returns an array with the same rows as `nested`.
+  static JaggedArray fromNested(std::vector<std::vector<T>> const& nested)
+    {
+      size_type nValues = 0;
+      for (std::vector<T> const& row: nested) nValues += row.size();
+      JaggedArray array;
+      array.reserve(nested.size(), nValues);
+      for (std::vector<T> const& row: nested) array.push_back(row);
+      return array;
+    }
+
+  /**
+   * @brief Returns an array taking the specified values and offsets.
+   * @param values all the values, row after row
+   * @param offsets start of each row in `values`, plus the end of the last
+   * @throw std::invalid_argument if `offsets` is not consistent with `values`
+   *
+   * An empty `offsets` is accepted if `values` is also empty, and it means
+   * no rows.
+   */
+  static JaggedArray fromColumns
+    (std::vector<T> values, std::vector<Offset> offsets)
+    {
+      if (offsets.empty()) offsets.push_back(Offset{ 0 });
+      bool ordered = (offsets.front() == Offset{ 0 });
+      for (size_type i = 1; ordered && (i < offsets.size()); ++i)
+        ordered = (offsets[i - 1] <= offsets[i]);
+      if (!ordered || (static_cast<size_type>(offsets.back()) != values.size())) {
+        throw std::invalid_argument{
+          "sbn::JaggedArray::fromColumns(): "
+          + std::to_string(offsets.size()) + " offsets are not consistent with "
+          + std::to_string(values.size()) + " values"
+          };
+      }
+      JaggedArray array;
+      array.fValues = std::move(values);
+      array.fOffsets = std::move(offsets);
+      return array;
+    }
+
+  /// Returns a copy of the rows as nested vectors.
+  std::vector<std::vector<T>> toNested() const
+    {
+      std::vector<std::vector<T>> nested;
+      nested.reserve(size());
+      for (const_row_type const row: *this) nested.emplace_back(row.begin(), row.end());
+      return nested;
+    }
+
+  /// @}
+  // --- END ---- Conversions --------------------------------------------------
+
+
+  friend bool operator== (JaggedArray const& a, JaggedArray const& b)
+    { return (a.fOffsets == b.fOffsets) && (a.fValues == b.fValues); }
+  friend bool operator!= (JaggedArray const& a, JaggedArray const& b)
+    { return !(a == b); }
+
+
+ private:
+  std::vector<T> fValues; ///< Values of all the rows, row after row.
+  std::vector<Offset> fOffsets { Offset{ 0 } }; ///< Row starts, plus the end.
+
+  void checkRow(size_type row) const
+    {
+      if (row < size()) return;
+      throw std::out_of_range{
+        "sbn::JaggedArray: row " + std::to_string(row) + " requested, only "
+        + std::to_string(size()) + " present"
+        };
+    }
+
+}; // sbn::JaggedArray
+
+
+// -----------------------------------------------------------------------------
+
+#endif // SBNOBJ_COMMON_UTILITIES_JAGGEDARRAY_H
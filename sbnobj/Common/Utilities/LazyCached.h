@@ -0,0 +1,136 @@
+/**
+ * @file   sbnobj/Common/Utilities/LazyCached.h
+ * @brief  A value computed on first use, safe for concurrent `const` access.
+ * @date   October 14, 2026
+ *
+ * This is a header-only library.
+ *
+ * `sbn::lazy_cached` is meant as a data product member holding a quantity
+ * derived from the persistent ones (an index, a sum, a length), so that
+ * `const` accessors compute it only once even when several art schedules
+ * read the same product at the same time.
+ * The member must not be written by ROOT: each data product using it marks
+ * it as transient in its own `classes_def.xml`. ROOT may also read an entry
+ * into an object which already holds a value computed from the previous
+ * one, so the same file needs a rule discarding it on every read:
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.xml}
+ * <class name="sbn::MyProduct" ClassVersion="11">
+ *   <version ClassVersion="11" checksum="..."/>
+ *   <field name="fLength" transient="true" />
+ * </class>
+ * <ioread
+ *   sourceClass="sbn::MyProduct" version="[1-]" targetClass="sbn::MyProduct"
+ *   source="" target="fLength"
+ *   >
+ * <![CDATA[ fLength.reset(); ]]>
+ * </ioread>
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+
+#ifndef SBNOBJ_COMMON_UTILITIES_LAZYCACHED_H
+#define SBNOBJ_COMMON_UTILITIES_LAZYCACHED_H
+
+
+// C/C++ standard libraries
+#include <atomic>
+#include <memory> // std::unique_ptr
+#include <utility> // std::forward()
+
+
+// -----------------------------------------------------------------------------
+namespace sbn { template <typename T> class lazy_cached; }
+
+/**
+ * @brief A value of type `T` computed by the first `get()` which needs it.
+ * @tparam T type of the cached value
+ *
+ * The value is computed by the function passed to `get()`, and published with
+ * an atomic pointer: `get()` never takes locks nor waits for another thread.
+ * Threads calling `get()` concurrently on an empty cache may each compute the
+ * value; the first one to finish stores it, the others discard theirs and
+ * return the stored one. So the computation must depend only on the content
+ * of the object (as `const` accessors do), and be cheap enough to be repeated
+ * in that rare case.
+ *
+ * Example:
+ * @code
+ * class Track {
+ *   std::vector<geo::Point_t> fPoints;
+ *   sbn::lazy_cached<double> fLength; // transient
+ *  public:
+ *   double length() const
+ *     { return fLength.get([this](){ return computeLength(fPoints); }); }
+ * };
+ * @endcode
+ *
+ * A copy of a cache is empty, and so is a cache after copy assignment: the
+ * content of the copy may be changed independently of the original, and an
+ * inherited value could silently go stale. The copy computes its own value
+ * at its first `get()`. Moving transfers the value instead, together with
+ * the content it was derived from.
+ * `reset()` discards the value, and it must be called when the content the
+ * value is derived from changes; like that change, it is not thread-safe.
+ */
+template <typename T>
+class sbn::lazy_cached {
+ public:
+  using value_type = T;
+
+  /// Constructor: an empty cache.
+  lazy_cached() noexcept = default;
+
+  /// Copy constructor: an empty cache (the value is not copied).
+  lazy_cached(lazy_cached const&) noexcept {}
+  lazy_cached(lazy_cached&& other) noexcept: fValue{ other.release() } {}
+
+  /// Copy assignment: discards the value (and does not copy the other one).
+  lazy_cached& operator= (lazy_cached const&) noexcept
+    { reset(); return *this; }
+  lazy_cached& operator= (lazy_cached&& other) noexcept
+    { if (&other != this) replace(other.release()); return *this; }
+
+  ~lazy_cached() { delete fValue.load(std::memory_order_acquire); }
+
+  /**
+   * @brief Returns the value, computing it with `compute()` if needed.
+   * @param compute callable with no argument returning the value
+   * @return the cached value, valid until `reset()` or destruction
+   */
+  template <typename F>
+  T const& get(F&& compute) const
+    {
+      T* value = fValue.load(std::memory_order_acquire);
+      if (value) return *value;
+
+      auto computed = std::make_unique<T>(std::forward<F>(compute)());
+      if (fValue.compare_exchange_strong(value, computed.get(),
+        std::memory_order_acq_rel, std::memory_order_acquire)
+      ) {
+        return *computed.release();
+      }
+      return *value; // another thread got there first, with the same value
+    }
+
+  /// Returns the cached value, `nullptr` if not computed yet.
+  T const* peek() const noexcept { return fValue.load(std::memory_order_acquire); }
+
+  /// Returns whether the value has been computed.
+  bool has_value() const noexcept { return peek() != nullptr; }
+
+  /// Discards the cached value (not thread-safe).
+  void reset() noexcept { replace(nullptr); }
+
+ private:
+  mutable std::atomic<T*> fValue{ nullptr }; ///< Owned value, if computed.
+
+  T* release() noexcept { return fValue.exchange(nullptr, std::memory_order_acq_rel); }
+
+  void replace(T* value) noexcept
+    { delete fValue.exchange(value, std::memory_order_acq_rel); }
+
+}; // sbn::lazy_cached
+
+
+// -----------------------------------------------------------------------------
+
+#endif // SBNOBJ_COMMON_UTILITIES_LAZYCACHED_H
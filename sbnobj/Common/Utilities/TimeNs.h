@@ -0,0 +1,127 @@
+/**
+ * @file   sbnobj/Common/Utilities/TimeNs.h
+ * @brief  A time in integral nanoseconds, common to all the SBN data products.
+ * @date   October 14, 2026
+ *
+ * This is a header-only library.
+ *
+ * Data products store times in many forms: `double` microseconds, `double`
+ * or `float` nanoseconds, separate seconds and nanoseconds, `uint64_t`
+ * nanoseconds. `sbn::TimeNs_t` is the common form all of them can be converted
+ * to (products provide accessors returning it), so that times from different
+ * sources are compared as integers, with no floating point rounding.
+ * It is not meant to be stored in data products.
+ */
+
+#ifndef SBNOBJ_COMMON_UTILITIES_TIMENS_H
+#define SBNOBJ_COMMON_UTILITIES_TIMENS_H
+
+
+// C/C++ standard libraries
+#include <limits> // std::numeric_limits
+#include <cstdint> // std::int64_t, std::uint64_t
+
+
+// -----------------------------------------------------------------------------
+namespace sbn { class TimeNs_t; }
+
+/**
+ * @brief A time (or a time difference) as a signed count of nanoseconds.
+ *
+ * The same type is used for absolute times (e.g. since The Epoch) and for
+ * relative ones (e.g. from the trigger); which one is meant is documented by
+ * the accessor returning it.
+ *
+ * A default-constructed time is invalid (`isValid()` is `false`). The
+ * conversions from floating point values round to the closest nanosecond,
+ * and return an invalid time for values which are not finite or out of range
+ * (which covers the "no time" special values used in the products, like
+ * `std::numeric_limits<double>::lowest()`).
+ * Arithmetic does not propagate invalid times: check them first.
+ *
+ * Example:
+ * @code
+ * sbn::TimeNs_t const window = sbn::TimeNs_t::fromMicroseconds(0.1);
+ * if (abs(matchedCRT.timeNs() - flash.flashTimeNs()) < window) ...
+ * @endcode
+ */
+class sbn::TimeNs_t {
+ public:
+  using rep = std::int64_t; ///< Type of the count of nanoseconds.
+
+  /// Special count of nanoseconds of an invalid time.
+  static constexpr rep NoTime = std::numeric_limits<rep>::min();
+
+  /// Constructor: an invalid time.
+  constexpr TimeNs_t() = default;
+
+  /// Constructor: the specified number of nanoseconds.
+  constexpr explicit TimeNs_t(rep ns): fNs(ns) {}
+
+  /// Returns an invalid time.
+  static constexpr TimeNs_t none() { return TimeNs_t{}; }
+
+  /// Returns the time from a floating point count of nanoseconds.
+  static constexpr TimeNs_t fromNanoseconds(double ns)
+    { return TimeNs_t{ roundToNs(ns, 1.0) }; }
+
+  /// Returns the time from a floating point count of microseconds.
+  static constexpr TimeNs_t fromMicroseconds(double us)
+    { return TimeNs_t{ roundToNs(us, 1e3) }; }
+
+  /// Returns the time from separate seconds and nanoseconds.
+  static constexpr TimeNs_t fromSeconds(std::uint64_t s, std::uint64_t ns)
+    { return TimeNs_t{ static_cast<rep>(s * 1'000'000'000ULL + ns) }; }
+
+  /// Returns the time from unsigned nanoseconds, invalid if `ns` is `noTime`.
+  static constexpr TimeNs_t fromUnsigned(std::uint64_t ns, std::uint64_t noTime)
+    { return (ns == noTime)? none(): TimeNs_t{ static_cast<rep>(ns) }; }
+
+  /// Returns whether this time is valid.
+  constexpr bool isValid() const { return fNs != NoTime; }
+
+  /// Returns the count of nanoseconds.
+  constexpr rep ns() const { return fNs; }
+
+  /// Returns the time in (floating point) nanoseconds.
+  constexpr double nanoseconds() const { return static_cast<double>(fNs); }
+
+  /// Returns the time in (floating point) microseconds.
+  constexpr double microseconds() const { return static_cast<double>(fNs) / 1e3; }
+
+  constexpr TimeNs_t& operator+= (TimeNs_t other) { fNs += other.fNs; return *this; }
+  constexpr TimeNs_t& operator-= (TimeNs_t other) { fNs -= other.fNs; return *this; }
+
+  constexpr TimeNs_t operator- () const { return TimeNs_t{ -fNs }; }
+
+  friend constexpr TimeNs_t operator+ (TimeNs_t a, TimeNs_t b) { return a += b; }
+  friend constexpr TimeNs_t operator- (TimeNs_t a, TimeNs_t b) { return a -= b; }
+  friend constexpr TimeNs_t abs(TimeNs_t t) { return (t.fNs < 0)? -t: t; }
+
+  friend constexpr bool operator== (TimeNs_t a, TimeNs_t b) { return a.fNs == b.fNs; }
+  friend constexpr bool operator!= (TimeNs_t a, TimeNs_t b) { return a.fNs != b.fNs; }
+  friend constexpr bool operator<  (TimeNs_t a, TimeNs_t b) { return a.fNs <  b.fNs; }
+  friend constexpr bool operator<= (TimeNs_t a, TimeNs_t b) { return a.fNs <= b.fNs; }
+  friend constexpr bool operator>  (TimeNs_t a, TimeNs_t b) { return a.fNs >  b.fNs; }
+  friend constexpr bool operator>= (TimeNs_t a, TimeNs_t b) { return a.fNs >= b.fNs; }
+
+ private:
+  rep fNs = NoTime; ///< Count of nanoseconds.
+
+  /// Rounds `value * scale` to the closest nanosecond; `NoTime` if not finite
+  /// or too large.
+  static constexpr rep roundToNs(double value, double scale)
+    {
+      constexpr double limit = 9.2e18; // a bit less than the range of `rep`
+      // also catches NaN; checked before scaling, which might overflow
+      if (!(value > -limit / scale && value < limit / scale)) return NoTime;
+      double const ns = value * scale;
+      return (ns >= 0.0)
+        ? static_cast<rep>(ns + 0.5): -static_cast<rep>(-ns + 0.5);
+    }
+}; // sbn::TimeNs_t
+
+
+// -----------------------------------------------------------------------------
+
+#endif // SBNOBJ_COMMON_UTILITIES_TIMENS_H
@@ -1,3 +1,66 @@
 #include "sbnobj/ICARUS/CRT/CRTData.hh"
 
-//nothing to do here
+#include <algorithm>
+#include <iterator>
+
+
+std::vector<std::uint64_t> icarus::crt::flagBitmask
+  (CRTData const* hits, std::size_t n, std::uint32_t flags, bool invert)
+{
+  std::vector<std::uint64_t> mask((n + 63) / 64, 0);
+  std::uint64_t const flip = invert;
+
+  // each word is filled from comparisons only, with no branch in the loop
+  for (std::size_t w = 0; w < mask.size(); ++w) {
+    std::size_t const first = w * 64;
+    std::size_t const nBits = std::min<std::size_t>(64, n - first);
+    std::uint64_t word = 0;
+    for (std::size_t b = 0; b < nBits; ++b) {
+      std::uint64_t const pass = ((hits[first + b].fFlags & flags) != 0) ^ flip;
+      word |= pass << b;
+    }
+    mask[w] = word;
+  }
+  return mask;
+} // icarus::crt::flagBitmask()
+
+
+void icarus::crt::partitionByFlags(
+  CRTData const* hits, std::size_t n, std::uint32_t flags, bool invert,
+  std::vector<std::uint32_t>& passed, std::vector<std::uint32_t>& failed
+) {
+  // both lists are written at every step, and only the cursors move:
+  // there is no branch on the test result
+  passed.resize(n);
+  failed.resize(n);
+  std::size_t nPassed = 0, nFailed = 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    std::size_t const pass = ((hits[i].fFlags & flags) != 0) != invert;
+    passed[nPassed] = static_cast<std::uint32_t>(i);
+    failed[nFailed] = static_cast<std::uint32_t>(i);
+    nPassed += pass;
+    nFailed += 1 - pass;
+  }
+  passed.resize(nPassed);
+  failed.resize(nFailed);
+} // icarus::crt::partitionByFlags()
+
+
+std::uint64_t icarus::crt::adcFingerprint(CRTData const& hit) {
+  std::uint64_t h = 0xCBF29CE484222325ULL;
+  for (std::size_t ch = 0; ch < CRTData::NADCs; ++ch) {
+    std::uint16_t const adc = hit.ADC(ch);
+    h = (h ^ (adc & 0xFF)) * 0x100000001B3ULL;
+    h = (h ^ (adc >> 8)) * 0x100000001B3ULL;
+  }
+  return h;
+} // icarus::crt::adcFingerprint()
+
+
+bool icarus::crt::sameADCs(CRTData const& a, CRTData const& b) {
+  if (!std::equal(std::begin(a.fAdc), std::end(a.fAdc), std::begin(b.fAdc)))
+    return false;
+  for (std::size_t ch = CRTData::NInlineADCs; ch < CRTData::NADCs; ++ch)
+    if (a.ADC(ch) != b.ADC(ch)) return false;
+  return true;
+} // icarus::crt::sameADCs()
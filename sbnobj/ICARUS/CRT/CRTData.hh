@@ -1,7 +1,11 @@
 #ifndef ICCRTData_hh_
 #define ICCRTData_hh_
 
+#include <cstddef>
 #include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 /// icarus::crt::CRTData flag mnemonics
 namespace icarus::crt::CRTDataFlags {
@@ -21,6 +25,9 @@ namespace icarus::crt {
    * All timestamps are absolute Unix timestamps
    * with 1 ns step.
    *
+   * ADC values of channels 0-31 are stored inline, the ones of channels
+   * 32-63 (never used by CAEN/Bern FEBs) only if any is not zero:
+   * `ADC()` and `SetADC()` access all of them the same way.
    */
 
   struct CRTData {
@@ -29,7 +36,11 @@ namespace icarus::crt {
       uint32_t fEntry;         ///< Hit index for given FEB in an event (starts from 0 for each event).
       uint64_t fTs0     { 0 }; ///< Absolute hit timestamp [ns]
       uint64_t fTs1     { 0 }; ///< Trigger time, not well defined as of Apr 14, 2021.
-      uint16_t fAdc[64] {};    ///< ADC readout for each channel. CAEN (Bern) CRT FEBs use only indices 0-31.
+      static constexpr std::size_t NADCs = 64;       ///< Number of ADC channels.
+      static constexpr std::size_t NInlineADCs = 32; ///< Number of ADC channels stored inline.
+
+      uint16_t fAdc[NInlineADCs] {}; ///< ADC readout for channels 0-31, the only ones CAEN (Bern) CRT FEBs use.
+      std::vector<uint16_t> fAdcHigh; ///< ADC readout for channels 32-63; empty if they are all 0.
 
       uint32_t fFlags    { 0 }; ///< DAQ uses 8 bits, remaining bits reserved for future use
       uint64_t fThisPollStart         { 0 }; ///< Absolute timestamp [ns] of the start of the data transfer from FEB
@@ -46,9 +57,101 @@ namespace icarus::crt {
       bool IsOverflow_TS1()  const { return !(fFlags & CRTDataFlags::TS1Present); }
       bool IsReference_TS0() const { return   fFlags & CRTDataFlags::TS0Reference; }
       bool IsReference_TS1() const { return   fFlags & CRTDataFlags::TS1Reference; }
+
+      /**
+       * @brief ADC readout of channel `ch` (0 to `NADCs - 1`).
+       * @throw std::out_of_range if `ch` is not smaller than `NADCs`
+       *
+       * `fAdc` has only the first `NInlineADCs` channels: use this accessor
+       * instead of `fAdc[ch]` for any channel which may be above those.
+       */
+      uint16_t ADC(std::size_t ch) const
+        {
+          if (ch < NInlineADCs) return fAdc[ch];
+          checkADCchannel(ch);
+          return (ch - NInlineADCs < fAdcHigh.size())? fAdcHigh[ch - NInlineADCs]: 0;
+        }
+
+      /**
+       * @brief Sets the ADC readout of channel `ch` (0 to `NADCs - 1`).
+       * @throw std::out_of_range if `ch` is not smaller than `NADCs`
+       */
+      void SetADC(std::size_t ch, uint16_t adc)
+        {
+          if (ch < NInlineADCs) { fAdc[ch] = adc; return; }
+          checkADCchannel(ch);
+          if (fAdcHigh.empty()) {
+            if (adc == 0) return;
+            fAdcHigh.resize(NADCs - NInlineADCs, 0);
+          }
+          fAdcHigh[ch - NInlineADCs] = adc;
+        }
+
+    private:
+
+      static void checkADCchannel(std::size_t ch)
+        {
+          if (ch < NADCs) return;
+          throw std::out_of_range("icarus::crt::CRTData: ADC channel "
+            + std::to_string(ch) + " requested, only " + std::to_string(NADCs)
+            + " available");
+        }
       
   };
 
+
+  // --- batch flag tests -------------------------------------------------------
+  /**
+   * @brief Tests the flags of `n` hits at once.
+   * @param hits pointer to the first hit
+   * @param n number of hits
+   * @param flags `CRTDataFlags` bits to test
+   * @param invert whether to select the hits with none of the `flags`
+   * @return bit mask: bit `i % 64` of word `i / 64` is set if hit `i` passes
+   *
+   * A hit passes if any of the `flags` is set (none, if `invert`).
+   * `IsOverflow_TS0()` test is, for example, `TS0Present` with `invert`.
+   */
+  std::vector<std::uint64_t> flagBitmask
+    (CRTData const* hits, std::size_t n, std::uint32_t flags, bool invert = false);
+
+  /**
+   * @brief Splits the indices of `n` hits by a flag test.
+   * @param hits pointer to the first hit
+   * @param n number of hits
+   * @param flags `CRTDataFlags` bits to test
+   * @param invert whether to select the hits with none of the `flags`
+   * @param[out] passed indices of the hits passing the test (replaced)
+   * @param[out] failed indices of the other hits (replaced)
+   *
+   * The test is the same as in `flagBitmask()`; indices are in ascending order.
+   */
+  void partitionByFlags(
+    CRTData const* hits, std::size_t n, std::uint32_t flags, bool invert,
+    std::vector<std::uint32_t>& passed, std::vector<std::uint32_t>& failed
+    );
+
+  /// Hits with `IsOverflow_TS0()`, as a bit mask (see `flagBitmask()`).
+  inline std::vector<std::uint64_t> overflowTS0Bitmask(std::vector<CRTData> const& hits)
+    { return flagBitmask(hits.data(), hits.size(), CRTDataFlags::TS0Present, true); }
+  /// Hits with `IsOverflow_TS1()`, as a bit mask (see `flagBitmask()`).
+  inline std::vector<std::uint64_t> overflowTS1Bitmask(std::vector<CRTData> const& hits)
+    { return flagBitmask(hits.data(), hits.size(), CRTDataFlags::TS1Present, true); }
+  /// Hits with `IsReference_TS0()`, as a bit mask (see `flagBitmask()`).
+  inline std::vector<std::uint64_t> referenceTS0Bitmask(std::vector<CRTData> const& hits)
+    { return flagBitmask(hits.data(), hits.size(), CRTDataFlags::TS0Reference); }
+  /// Hits with `IsReference_TS1()`, as a bit mask (see `flagBitmask()`).
+  inline std::vector<std::uint64_t> referenceTS1Bitmask(std::vector<CRTData> const& hits)
+    { return flagBitmask(hits.data(), hits.size(), CRTDataFlags::TS1Reference); }
+
+
+  // --- duplicate detection ----------------------------------------------------
+  /// Fingerprint (64-bit FNV-1a hash) of the ADC readout of all the channels.
+  std::uint64_t adcFingerprint(CRTData const& hit);
+
+  /// Whether `a` and `b` have the same ADC readout on all the channels.
+  bool sameADCs(CRTData const& a, CRTData const& b);
+
 } // namespace icarus::crt
 
 
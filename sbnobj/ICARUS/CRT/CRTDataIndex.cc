@@ -0,0 +1,129 @@
+#include "sbnobj/ICARUS/CRT/CRTDataIndex.hh"
+
+#include <algorithm>
+#include <utility>
+
+icarus::crt::CRTDataIndex::CRTDataIndex(std::vector<CRTData> const& hits) {
+
+  // counting sort on the FEB address
+  std::array<std::uint32_t, NMac5> counts {};
+  for (CRTData const& hit: hits) ++counts[hit.fMac5];
+
+  fOffsets[0] = 0;
+  for (std::size_t mac5 = 0; mac5 < NMac5; ++mac5) {
+    fOffsets[mac5 + 1] = fOffsets[mac5] + counts[mac5];
+    if (counts[mac5] > 0) fFEBs.push_back(static_cast<std::uint8_t>(mac5));
+  }
+
+  fOrder.resize(hits.size());
+  std::array<std::uint32_t, NMac5> next;
+  std::copy(fOffsets.begin(), fOffsets.end() - 1, next.begin());
+  for (std::size_t i = 0; i < hits.size(); ++i)
+    fOrder[next[hits[i].fMac5]++] = static_cast<std::uint32_t>(i);
+
+  // time order within each FEB, usually already there
+  auto const byTime = [&hits](std::uint32_t a, std::uint32_t b)
+    { return hits[a].fTs0 < hits[b].fTs0; };
+  for (std::uint8_t const mac5: fFEBs) {
+    auto const b = fOrder.begin() + fOffsets[mac5];
+    auto const e = fOrder.begin() + fOffsets[mac5 + 1];
+    if (!std::is_sorted(b, e, byTime)) std::stable_sort(b, e, byTime);
+  }
+
+} // icarus::crt::CRTDataIndex::CRTDataIndex()
+
+
+auto icarus::crt::CRTDataIndex::checkPolls(std::vector<CRTData> const& hits) const
+  -> std::vector<PollCheck>
+{
+  std::vector<PollCheck> checks;
+  checks.reserve(fFEBs.size());
+
+  for (std::uint8_t const mac5: fFEBs) {
+    Range const range = feb(mac5);
+    std::uint32_t const* idx = range.begin();
+    std::size_t const n = range.size();
+
+    PollCheck check;
+    check.mac5 = mac5;
+    check.nHits = n;
+    check.nPolls = 1;
+    check.nLostHits = hits[idx[0]].fLostHits;
+
+    // counters are accumulated from comparisons, with no branch in the loop
+    for (std::size_t k = 1; k < n; ++k) {
+      CRTData const& prev = hits[idx[k - 1]];
+      CRTData const& hit = hits[idx[k]];
+      bool const newPoll = hit.fThisPollStart != prev.fThisPollStart;
+      check.nPolls += newPoll;
+      check.nPollGaps += newPoll && (hit.fLastPollStart != prev.fThisPollStart);
+      check.nTimestampGaps += (hit.fLastAcceptedTimestamp != prev.fTs0);
+      check.nLostHits += hit.fLostHits;
+    }
+    checks.push_back(check);
+  }
+  return checks;
+
+} // icarus::crt::CRTDataIndex::checkPolls()
+
+
+std::vector<std::uint32_t> icarus::crt::CRTDataIndex::duplicates
+  (std::vector<CRTData> const& hits) const
+{
+  std::vector<std::uint32_t> repeated;
+  std::vector<std::pair<std::uint64_t, std::uint32_t>> run; // (fingerprint, hit)
+
+  for (std::uint8_t const mac5: fFEBs) {
+    Range const range = feb(mac5);
+    std::uint32_t const* idx = range.begin();
+    std::size_t const n = range.size();
+
+    for (std::size_t first = 0; first < n; ) {
+      std::uint64_t const ts0 = hits[idx[first]].fTs0;
+      std::size_t last = first + 1;
+      while ((last < n) && (hits[idx[last]].fTs0 == ts0)) ++last;
+
+      // hits with the same time: the stable sort kept them in original order
+      if (last - first > 1) {
+        run.clear();
+        for (std::size_t k = first; k < last; ++k) {
+          CRTData const& hit = hits[idx[k]];
+          std::uint64_t const fingerprint = adcFingerprint(hit);
+          bool const copy = std::any_of(run.begin(), run.end(),
+            [&](auto const& other){
+              return (other.first == fingerprint) && sameADCs(hits[other.second], hit);
+            });
+          if (copy) repeated.push_back(idx[k]);
+          else run.emplace_back(fingerprint, idx[k]);
+        }
+      }
+      first = last;
+    }
+  }
+
+  std::sort(repeated.begin(), repeated.end());
+  return repeated;
+
+} // icarus::crt::CRTDataIndex::duplicates()
+
+
+std::size_t icarus::crt::removeDuplicateHits(std::vector<CRTData>& hits) {
+
+  std::vector<std::uint32_t> const repeated = CRTDataIndex{ hits }.duplicates(hits);
+  if (repeated.empty()) return 0;
+
+  // compaction in place, skipping the (sorted) repeated indices
+  std::size_t dest = 0;
+  auto nextRepeated = repeated.begin();
+  for (std::size_t i = 0; i < hits.size(); ++i) {
+    if ((nextRepeated != repeated.end()) && (*nextRepeated == i)) {
+      ++nextRepeated;
+      continue;
+    }
+    if (dest != i) hits[dest] = std::move(hits[i]);
+    ++dest;
+  }
+  hits.resize(dest);
+  return repeated.size();
+
+} // icarus::crt::removeDuplicateHits()
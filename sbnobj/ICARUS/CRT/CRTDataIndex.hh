@@ -0,0 +1,116 @@
+#ifndef ICCRTDataIndex_hh_
+#define ICCRTDataIndex_hh_
+
+#include "sbnobj/ICARUS/CRT/CRTData.hh"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace icarus::crt {
+
+  /**
+   * @brief Index of the `CRTData` of an event by FEB, in time order.
+   *
+   * The index refers to the hits by their position in the collection it is
+   * built from, which must be kept unchanged while the index is used.
+   *
+   * Hits are grouped by `fMac5` with a single counting sort pass, which
+   * keeps the original order within each FEB; hits of a FEB are then sorted
+   * by `fTs0` only if they are not already (the DAQ delivers them in order).
+   */
+  class CRTDataIndex {
+
+  public:
+
+    static constexpr std::size_t NMac5 = 256; ///< Number of possible `fMac5` values.
+
+    /// Range of hit indices of one FEB, in ascending `fTs0`.
+    struct Range {
+      std::uint32_t const* first = nullptr;
+      std::uint32_t const* last = nullptr;
+
+      std::uint32_t const* begin() const { return first; }
+      std::uint32_t const* end() const { return last; }
+      std::size_t size() const { return last - first; }
+      bool empty() const { return first == last; }
+    };
+
+    /// Result of the consistency check of the hits of one FEB.
+    struct PollCheck {
+      std::uint8_t  mac5 = 0;              ///< FEB address.
+      std::uint32_t nHits = 0;             ///< Number of hits.
+      std::uint32_t nPolls = 0;            ///< Number of distinct data transfers.
+      std::uint32_t nPollGaps = 0;         ///< Polls whose `fLastPollStart` is not the previous poll.
+      std::uint32_t nTimestampGaps = 0;    ///< Hits whose `fLastAcceptedTimestamp` is not the previous hit.
+      std::uint64_t nLostHits = 0;         ///< Sum of `fLostHits`.
+
+      /// Whether no gap was found.
+      bool isContinuous() const { return (nPollGaps == 0) && (nTimestampGaps == 0); }
+    };
+
+    CRTDataIndex() = default;
+
+    /// Indexes the `hits`.
+    explicit CRTDataIndex(std::vector<CRTData> const& hits);
+
+    /// Number of indexed hits.
+    std::size_t size() const { return fOrder.size(); }
+
+    /// Hits of the FEB with address `mac5`, in ascending `fTs0`.
+    Range feb(std::uint8_t mac5) const
+      { return { fOrder.data() + fOffsets[mac5], fOrder.data() + fOffsets[mac5 + 1] }; }
+
+    /// Addresses of the FEBs with at least one hit, in ascending order.
+    std::vector<std::uint8_t> const& febs() const { return fFEBs; }
+
+    /**
+     * @brief Checks the continuity of polls and hits of each FEB.
+     * @param hits the collection the index was built from
+     * @return one check result per FEB in `febs()`
+     *
+     * Within each FEB, the first hit of each poll (change of
+     * `fThisPollStart`) is expected to have as `fLastPollStart` the poll
+     * start of the previous hit, and each hit to have as
+     * `fLastAcceptedTimestamp` the `fTs0` of the previous one.
+     * The first hit of each FEB is not checked.
+     */
+    std::vector<PollCheck> checkPolls(std::vector<CRTData> const& hits) const;
+
+    /**
+     * @brief Finds the hits which are repeated copies of a previous one.
+     * @param hits the collection the index was built from
+     * @return indices of the repeated hits, in ascending order
+     *
+     * Two hits are copies when they are from the same FEB, with the same
+     * `fTs0` and the same ADC readout, as it happens when the same hit is
+     * delivered by two consecutive polls. Within each FEB, the time-sorted
+     * hits are visited once: only hits sharing their `fTs0` with others are
+     * compared, first by `adcFingerprint()`, then by `sameADCs()`.
+     * Of each set of copies, the first in `hits` is not reported.
+     */
+    std::vector<std::uint32_t> duplicates(std::vector<CRTData> const& hits) const;
+
+  private:
+
+    std::vector<std::uint32_t> fOrder; ///< Hit indices grouped by FEB, in time.
+    std::array<std::uint32_t, NMac5 + 1> fOffsets {}; ///< First entry of each FEB in `fOrder`, plus the end.
+    std::vector<std::uint8_t> fFEBs; ///< FEBs with hits.
+
+  };
+
+
+  /**
+   * @brief Removes from `hits` the repeated copies of the same hit.
+   * @return the number of removed hits
+   * @see `CRTDataIndex::duplicates()`
+   *
+   * The order of the remaining hits is preserved.
+   */
+  std::size_t removeDuplicateHits(std::vector<CRTData>& hits);
+
+} // namespace icarus::crt
+
+
+#endif
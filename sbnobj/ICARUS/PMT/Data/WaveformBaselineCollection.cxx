@@ -0,0 +1,74 @@
+/**
+ * @file   sbnobj/ICARUS/PMT/Data/WaveformBaselineCollection.cxx
+ * @brief  Baselines of all the waveforms of an event, and their subtraction.
+ * @see    sbnobj/ICARUS/PMT/Data/WaveformBaselineCollection.h
+ */
+
+// library header
+#include "sbnobj/ICARUS/PMT/Data/WaveformBaselineCollection.h"
+
+// C/C++ standard library
+#include <limits>
+
+
+// -----------------------------------------------------------------------------
+namespace {
+  
+  // the kernels take non-aliasing pointers so that the loops are vectorized
+  
+  void subtractKernel(float baseline,
+    std::int16_t const* __restrict__ samples, std::size_t n,
+    float* __restrict__ out)
+  {
+    for (std::size_t i = 0; i < n; ++i) out[i] = samples[i] - baseline;
+  } // subtractKernel(float)
+  
+  
+  void subtractKernel(float baseline,
+    std::int16_t const* __restrict__ samples, std::size_t n,
+    std::int16_t* __restrict__ out)
+  {
+    constexpr float Min = std::numeric_limits<std::int16_t>::min();
+    constexpr float Max = std::numeric_limits<std::int16_t>::max();
+    for (std::size_t i = 0; i < n; ++i) {
+      float const diff = samples[i] - baseline;
+      // round half away from zero with a truncating conversion
+      float rounded = diff + ((diff < 0.0f)? -0.5f: 0.5f);
+      rounded = (rounded < Min)? Min: rounded;
+      rounded = (rounded > Max)? Max: rounded;
+      out[i] = static_cast<std::int16_t>(static_cast<int>(rounded));
+    } // for
+  } // subtractKernel(int16_t)
+  
+} // local namespace
+
+
+// -----------------------------------------------------------------------------
+void icarus::subtract(WaveformBaseline baseline,
+  std::int16_t const* samples, std::size_t n, float* out)
+  { subtractKernel(baseline.baseline(), samples, n, out); }
+
+
+void icarus::subtract(WaveformBaseline baseline,
+  std::int16_t const* samples, std::size_t n, std::int16_t* out)
+  { subtractKernel(baseline.baseline(), samples, n, out); }
+
+
+// -----------------------------------------------------------------------------
+void icarus::subtract(WaveformBaseline baseline,
+  std::vector<std::int16_t> const& waveform, std::vector<float>& out)
+{
+  out.resize(waveform.size());
+  subtract(baseline, waveform.data(), waveform.size(), out.data());
+} // icarus::subtract(float)
+
+
+void icarus::subtract(WaveformBaseline baseline,
+  std::vector<std::int16_t> const& waveform, std::vector<std::int16_t>& out)
+{
+  out.resize(waveform.size());
+  subtract(baseline, waveform.data(), waveform.size(), out.data());
+} // icarus::subtract(int16_t)
+
+
+// -----------------------------------------------------------------------------
@@ -0,0 +1,140 @@
+/**
+ * @file   sbnobj/ICARUS/PMT/Data/WaveformBaselineCollection.h
+ * @brief  Baselines of all the waveforms of an event, and their subtraction.
+ * @see    sbnobj/ICARUS/PMT/Data/WaveformBaselineCollection.cxx
+ */
+
+#ifndef SBNOBJ_ICARUS_PMT_DATA_WAVEFORMBASELINECOLLECTION_H
+#define SBNOBJ_ICARUS_PMT_DATA_WAVEFORMBASELINECOLLECTION_H
+
+
+// ICARUS libraries
+#include "sbnobj/ICARUS/PMT/Data/WaveformBaseline.h"
+
+// C/C++ standard libraries
+#include <cstddef> // std::size_t
+#include <cstdint> // std::int16_t
+#include <utility> // std::move()
+#include <vector>
+
+
+//------------------------------------------------------------------------------
+namespace icarus {
+  
+  class WaveformBaselineCollection;
+  
+  // --- BEGIN -- Baseline subtraction -----------------------------------------
+  /**
+   * @name Baseline subtraction
+   * 
+   * The subtracted samples are `sample - baseline`, regardless of the
+   * polarity of the signal (negative pulses stay negative).
+   * Samples are of the type of ADC counts in `raw::OpDetWaveform`
+   * (`raw::ADC_Count_t`, a 16-bit signed integer), which can be passed as
+   * `raw::OpDetWaveform` directly to the `std::vector` forms.
+   * The output must have room for all the samples; the `std::vector` forms
+   * resize it. The loops are written to be vectorized by the compiler.
+   */
+  /// @{
+  
+  /// Writes into `out` the `n` `samples` minus the `baseline`.
+  void subtract(WaveformBaseline baseline,
+    std::int16_t const* samples, std::size_t n, float* out);
+  
+  /// Writes into `out` the `n` `samples` minus the `baseline`, rounded
+  /// to the closest integer (and saturated to the 16-bit range).
+  void subtract(WaveformBaseline baseline,
+    std::int16_t const* samples, std::size_t n, std::int16_t* out);
+  
+  /// Sets `out` to the `waveform` samples minus the `baseline`.
+  void subtract(WaveformBaseline baseline,
+    std::vector<std::int16_t> const& waveform, std::vector<float>& out);
+  
+  /// Sets `out` to the `waveform` samples minus the `baseline`, rounded.
+  void subtract(WaveformBaseline baseline,
+    std::vector<std::int16_t> const& waveform, std::vector<std::int16_t>& out);
+  
+  /// @}
+  // --- END ---- Baseline subtraction -----------------------------------------
+  
+} // namespace icarus
+
+
+/**
+ * @brief Baselines of all the waveforms of a collection.
+ * 
+ * The baseline `i` belongs to the waveform `i` of the `raw::OpDetWaveform`
+ * collection it was computed from, so that no association between the two
+ * is needed.
+ * The producer of this collection must document which waveform collection
+ * it refers to; `matches()` can be used as a consistency check.
+ * 
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * std::vector<raw::OpDetWaveform> const& waveforms = ...;
+ * icarus::WaveformBaselineCollection const& baselines = ...;
+ * 
+ * std::vector<float> subtracted;
+ * for (std::size_t i = 0; i < waveforms.size(); ++i) {
+ *   baselines.subtract(i, waveforms[i], subtracted);
+ *   // ...
+ * }
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+class icarus::WaveformBaselineCollection {
+  
+    public:
+  
+  using Baseline_t = icarus::WaveformBaseline::Baseline_t;
+  
+  
+  /// Constructor: no baselines.
+  WaveformBaselineCollection() = default;
+  
+  /// Constructor: takes the baselines of all the waveforms, in order.
+  explicit WaveformBaselineCollection(std::vector<Baseline_t> baselines)
+    : fBaselines(std::move(baselines)) {}
+  
+  
+  /// Reserves room for `n` baselines.
+  void reserve(std::size_t n) { fBaselines.reserve(n); }
+  
+  /// Adds the baseline of the next waveform.
+  void push_back(icarus::WaveformBaseline baseline)
+    { fBaselines.push_back(baseline.baseline()); }
+  
+  
+  /// Number of baselines (and of waveforms).
+  std::size_t size() const { return fBaselines.size(); }
+  bool empty() const { return fBaselines.empty(); }
+  
+  /// Returns whether there is one baseline for each of `nWaveforms`.
+  bool matches(std::size_t nWaveforms) const { return size() == nWaveforms; }
+  
+  /// Baseline of waveform `i`.
+  icarus::WaveformBaseline operator[] (std::size_t i) const
+    { return { fBaselines[i] }; }
+  
+  /// Baseline value of waveform `i`.
+  Baseline_t baseline(std::size_t i) const { return fBaselines[i]; }
+  
+  /// All the baseline values, by waveform.
+  std::vector<Baseline_t> const& baselines() const { return fBaselines; }
+  
+  
+  /// Sets `out` to the samples of `waveform` (number `i`) minus its baseline.
+  template <typename Out>
+  void subtract(std::size_t i,
+    std::vector<std::int16_t> const& waveform, std::vector<Out>& out) const
+    { icarus::subtract((*this)[i], waveform, out); }
+  
+  
+    private:
+  
+  std::vector<Baseline_t> fBaselines; ///< Baseline of each waveform.
+  
+}; // icarus::WaveformBaselineCollection
+
+
+//------------------------------------------------------------------------------
+
+#endif // SBNOBJ_ICARUS_PMT_DATA_WAVEFORMBASELINECOLLECTION_H
@@ -7,12 +7,14 @@
  * 
  * * `icarus::WaveformBaseline`
  *   (and its associations with `raw::OpDetWaveform`)
+ * * `icarus::WaveformBaselineCollection`
  * 
  * See also `sbnobj/ICARUS/PMT/Data/classes_def.xml`.
  */
 
 // ICARUS libraries
 #include "sbnobj/ICARUS/PMT/Data/WaveformBaseline.h"
+#include "sbnobj/ICARUS/PMT/Data/WaveformBaselineCollection.h"
 
 // LArSoft libraries
 #include "lardataobj/RawData/OpDetWaveform.h"
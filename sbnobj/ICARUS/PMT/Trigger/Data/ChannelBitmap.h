@@ -0,0 +1,258 @@
+/**
+ * @file   sbnobj/ICARUS/PMT/Trigger/Data/ChannelBitmap.h
+ * @brief  A set of channels from a small, dense range, stored as bits.
+ * @date   October 14, 2026
+ *
+ * This is a header-only library.
+ */
+
+#ifndef SBNOBJ_ICARUS_PMT_TRIGGER_DATA_CHANNELBITMAP_H
+#define SBNOBJ_ICARUS_PMT_TRIGGER_DATA_CHANNELBITMAP_H
+
+
+// C/C++ standard libraries
+#include <array>
+#include <initializer_list>
+#include <iterator> // std::forward_iterator_tag
+#include <string> // std::to_string()
+#include <stdexcept> // std::out_of_range
+#include <cstdint> // std::uint64_t
+#include <cstddef> // std::size_t, std::ptrdiff_t
+
+
+//------------------------------------------------------------------------------
+namespace icarus::trigger {
+
+  template <std::size_t NChannels, typename ChannelID = unsigned int>
+  class ChannelBitmap;
+
+  /**
+   * @brief Channel ID policy: channels stored as a `ChannelBitmap`.
+   * @tparam NChannels number of channels (IDs from `0` to `NChannels - 1`)
+   * @tparam ChannelID type of channel ID
+   *
+   * Used as `ChannelIDType` argument of `icarus::trigger::ReadoutTriggerGate`,
+   * it makes the gate use `ChannelID` as channel ID and store the associated
+   * channels in a `ChannelBitmap<NChannels, ChannelID>`.
+   */
+  template <std::size_t NChannels, typename ChannelID = unsigned int>
+  struct BitmapChannelID {};
+
+} // namespace icarus::trigger
+
+
+//------------------------------------------------------------------------------
+/**
+ * @brief A set of channel IDs in a fixed range, one bit per channel.
+ * @tparam NChannels number of channels (IDs from `0` to `NChannels - 1`)
+ * @tparam ChannelID type of channel ID
+ *
+ * This set is equivalent to a sorted list of unique channel IDs, but
+ * insertion, removal and membership tests take constant time, and the union
+ * (`|=`) and intersection (`&=`) of two sets are performed on 64 channels at
+ * a time. Iteration yields the channel IDs in increasing order.
+ *
+ * It is suitable for channel IDs which are dense and bounded, like the ones of
+ * the ICARUS PMT.
+ */
+template <std::size_t NChannels, typename ChannelID /* = unsigned int */>
+class icarus::trigger::ChannelBitmap {
+
+  using Word_t = std::uint64_t; ///< Type of the storage unit.
+
+  static constexpr std::size_t WordBits = 64U; ///< Bits in a storage unit.
+
+  /// Number of storage units.
+  static constexpr std::size_t NWords = (NChannels + WordBits - 1) / WordBits;
+
+    public:
+
+  using ChannelID_t = ChannelID; ///< Type of channel ID.
+  using value_type = ChannelID_t; ///< Type of the elements of the set.
+
+  /// Number of channels which can be stored.
+  static constexpr std::size_t MaxChannels = NChannels;
+
+
+  /// Iterator through channels in the set, in increasing ID order.
+  class const_iterator {
+
+    ChannelBitmap const* fSet = nullptr;
+    std::size_t fChannel = MaxChannels;
+
+      public:
+
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = ChannelID_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = ChannelID_t;
+
+    const_iterator() = default;
+    const_iterator(ChannelBitmap const& set, std::size_t channel)
+      : fSet(&set), fChannel(channel) {}
+
+    ChannelID_t operator*() const { return static_cast<ChannelID_t>(fChannel); }
+
+    const_iterator& operator++()
+      { fChannel = fSet->nextFrom(fChannel + 1); return *this; }
+    const_iterator operator++(int)
+      { auto const old = *this; ++(*this); return old; }
+
+    bool operator== (const_iterator const& other) const
+      { return fChannel == other.fChannel; }
+    bool operator!= (const_iterator const& other) const
+      { return fChannel != other.fChannel; }
+
+  }; // const_iterator
+
+  using iterator = const_iterator;
+
+
+  /// Constructor: an empty set.
+  ChannelBitmap() = default;
+
+  /// Constructor: a set with the specified channels.
+  ChannelBitmap(std::initializer_list<ChannelID_t> channels)
+    { insert(channels.begin(), channels.end()); }
+
+  /// Constructor: a set with the channels from `b` to `e`.
+  template <typename BIter, typename EIter>
+  ChannelBitmap(BIter b, EIter e) { insert(b, e); }
+
+
+  // --- BEGIN Query -----------------------------------------------------------
+  /// Returns whether `channel` is in the set.
+  bool contains(ChannelID_t channel) const
+    {
+      std::size_t const bit = channel;
+      return (bit < MaxChannels) && (fWords[bit / WordBits] & mask(bit));
+    }
+
+  /// Returns the number of channels in the set.
+  std::size_t size() const
+    {
+      std::size_t n = 0U;
+      for (Word_t const word: fWords) n += __builtin_popcountll(word);
+      return n;
+    }
+
+  /// Returns whether there is no channel in the set.
+  bool empty() const
+    {
+      for (Word_t const word: fWords) if (word) return false;
+      return true;
+    }
+
+  /// Returns the lowest channel ID in the set (undefined if empty).
+  ChannelID_t front() const { return *begin(); }
+
+  const_iterator begin() const { return { *this, nextFrom(0U) }; }
+  const_iterator end() const { return { *this, MaxChannels }; }
+  // --- END Query -------------------------------------------------------------
+
+
+  // --- BEGIN Modification ----------------------------------------------------
+  /**
+   * @brief Adds `channel` to the set.
+   * @return whether the channel was not already in the set
+   * @throw std::out_of_range if `channel` is not smaller than `MaxChannels`
+   */
+  bool insert(ChannelID_t channel)
+    {
+      std::size_t const bit = checkedBit(channel);
+      Word_t& word = fWords[bit / WordBits];
+      bool const added = !(word & mask(bit));
+      word |= mask(bit);
+      return added;
+    }
+
+  /// Adds all the channels from `b` to `e` to the set.
+  template <typename BIter, typename EIter>
+  void insert(BIter b, EIter e) { while (b != e) insert(*b++); }
+
+  /// Removes `channel` from the set; returns whether it was there.
+  bool erase(ChannelID_t channel)
+    {
+      if (!contains(channel)) return false;
+      std::size_t const bit = channel;
+      fWords[bit / WordBits] &= ~mask(bit);
+      return true;
+    }
+
+  /// Removes all the channels from the set.
+  void clear() { fWords.fill(Word_t{ 0 }); }
+
+  /// Adds all the channels in `other` to this set.
+  ChannelBitmap& operator|= (ChannelBitmap const& other)
+    {
+      for (std::size_t i = 0; i < NWords; ++i) fWords[i] |= other.fWords[i];
+      return *this;
+    }
+
+  /// Removes from this set all the channels which are not in `other`.
+  ChannelBitmap& operator&= (ChannelBitmap const& other)
+    {
+      for (std::size_t i = 0; i < NWords; ++i) fWords[i] &= other.fWords[i];
+      return *this;
+    }
+  // --- END Modification ------------------------------------------------------
+
+
+  /// Returns the union of two sets.
+  friend ChannelBitmap operator|
+    (ChannelBitmap const& a, ChannelBitmap const& b)
+    { auto result { a }; return result |= b; }
+
+  /// Returns the intersection of two sets.
+  friend ChannelBitmap operator&
+    (ChannelBitmap const& a, ChannelBitmap const& b)
+    { auto result { a }; return result &= b; }
+
+  bool operator== (ChannelBitmap const& other) const
+    { return fWords == other.fWords; }
+  bool operator!= (ChannelBitmap const& other) const
+    { return fWords != other.fWords; }
+
+
+    private:
+
+  std::array<Word_t, NWords> fWords {}; ///< The bits of the set.
+
+
+  /// Returns the mask of the specified bit within its storage unit.
+  static constexpr Word_t mask(std::size_t bit)
+    { return Word_t{ 1 } << (bit % WordBits); }
+
+  /// Returns the bit of `channel`.
+  /// @throw std::out_of_range if `channel` is not smaller than `MaxChannels`
+  static std::size_t checkedBit(ChannelID_t channel)
+    {
+      std::size_t const bit = channel;
+      if (bit < MaxChannels) return bit;
+      throw std::out_of_range(
+        "icarus::trigger::ChannelBitmap: channel " + std::to_string(channel)
+        + " out of the supported range [ 0, "
+        + std::to_string(MaxChannels) + " ["
+        );
+    }
+
+  /// Returns the first channel in the set from `bit` on (or `MaxChannels`)
+  std::size_t nextFrom(std::size_t bit) const
+    {
+      if (bit >= MaxChannels) return MaxChannels;
+      std::size_t iWord = bit / WordBits;
+      Word_t word = fWords[iWord] & (~Word_t{ 0 } << (bit % WordBits));
+      while (word == 0) {
+        if (++iWord == NWords) return MaxChannels;
+        word = fWords[iWord];
+      }
+      return iWord * WordBits + __builtin_ctzll(word);
+    }
+
+}; // class icarus::trigger::ChannelBitmap<>
+
+
+//------------------------------------------------------------------------------
+
+#endif // SBNOBJ_ICARUS_PMT_TRIGGER_DATA_CHANNELBITMAP_H
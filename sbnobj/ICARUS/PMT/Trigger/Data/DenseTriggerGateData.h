@@ -0,0 +1,665 @@
+/**
+ * @file   sbnobj/ICARUS/PMT/Trigger/Data/DenseTriggerGateData.h
+ * @brief  A logical multilevel gate for triggering, with one value per tick.
+ * @date   October 14, 2026
+ * @see    `sbnobj/ICARUS/PMT/Trigger/Data/TriggerGateData.h`
+ *
+ * This is a header-only library.
+ */
+
+#ifndef SBNOBJ_ICARUS_PMT_TRIGGER_DATA_DENSETRIGGERGATEDATA_H
+#define SBNOBJ_ICARUS_PMT_TRIGGER_DATA_DENSETRIGGERGATEDATA_H
+
+
+// ICARUS libraries
+#include "sbnobj/ICARUS/PMT/Trigger/Data/TriggerGateData.h"
+
+// C/C++ standard libraries
+#include <vector>
+#include <string> // std::to_string()
+#include <algorithm> // std::min(), std::max()
+#include <utility> // std::pair
+#include <stdexcept> // std::runtime_error
+#include <type_traits> // std::conditional_t, std::false_type, ...
+#include <cstddef> // std::size_t
+
+
+//------------------------------------------------------------------------------
+namespace icarus::trigger {
+
+  template <typename Tick, typename TickInterval>
+  class DenseTriggerGateData;
+
+
+  /// Type traits: `Gate` is a `DenseTriggerGateData` instance.
+  template <typename Gate>
+  struct isDenseTriggerGate: std::false_type {};
+
+  template <typename Tick, typename TickInterval>
+  struct isDenseTriggerGate<DenseTriggerGateData<Tick, TickInterval>>
+    : std::true_type {};
+
+  /// Flag: `true` if `Gate` is a `DenseTriggerGateData` instance.
+  template <typename Gate>
+  constexpr bool isDenseTriggerGate_v = isDenseTriggerGate<Gate>::value;
+
+
+  /**
+   * @brief Chooses the representation of a trigger gate at compile time.
+   * @tparam Tick type used to count the ticks
+   * @tparam TickInterval type used to quantify tick difference
+   * @tparam Dense whether to use the dense representation
+   *
+   * The selected type is `TriggerGateData` (sparse, event list) if `Dense` is
+   * `false`, `DenseTriggerGateData` otherwise. The two classes share the query
+   * and combination interface, so that code templated on the gate type can
+   * use either.
+   */
+  template <typename Tick, typename TickInterval, bool Dense>
+  using TriggerGateRepresentation_t = std::conditional_t<Dense,
+    DenseTriggerGateData<Tick, TickInterval>,
+    TriggerGateData<Tick, TickInterval>
+    >;
+
+} // namespace icarus::trigger
+
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Logical multi-level gate with the opening stored for each tick.
+ * @tparam Tick type used to count the ticks
+ * @tparam TickInterval type used to quantify tick difference
+ * @see `icarus::trigger::TriggerGateData`
+ *
+ * This gate holds the same information as `TriggerGateData`, but instead of
+ * a list of changes it stores the opening at each tick of a fixed window.
+ * Before the start of the window and after its end the opening is constant.
+ *
+ * For gates spanning a few thousand ticks with many changes, this is faster
+ * than the sparse representation: combinations (`Min()`, `Max()`, `Sum()`,
+ * `Mul()`) are simple loops over two contiguous arrays of the same length,
+ * which the compiler vectorizes, and queries are direct array access.
+ * The memory is proportional to the length of the window instead of the
+ * number of changes, so this is not meant to be a data product.
+ *
+ * Conversion from a sparse gate (constructor) and back (`toSparse()`) are
+ * provided. The conversion from a sparse gate is lossless only if that gate
+ * never changes outside the chosen window.
+ *
+ * A "change" of the gate happens at each tick where the opening is different
+ * from the one at the previous tick; this is what `findOpen()` and
+ * `findClose()` look for, in the same way as for `TriggerGateData`. Unlike
+ * `TriggerGateData::setOpeningAt()`, `setOpeningAt()` here sets the opening
+ * from the specified tick on, since the gate does not keep memory of how the
+ * openings were set.
+ *
+ * Combinations are allowed only among gates with the same window.
+ */
+template <typename Tick, typename TickInterval>
+class icarus::trigger::DenseTriggerGateData {
+
+    public:
+
+  /// Type of this class.
+  using densetriggergatedata_t = DenseTriggerGateData<Tick, TickInterval>;
+
+  /// Type of the equivalent sparse gate.
+  using SparseGate_t = icarus::trigger::TriggerGateData<Tick, TickInterval>;
+
+  /// Type of a point in time, measured in ticks.
+  using ClockTick_t = typename SparseGate_t::ClockTick_t;
+
+  /// Type of a time interval, measured in ticks.
+  using ClockTicks_t = typename SparseGate_t::ClockTicks_t;
+
+  /// Type of count of number of open channels.
+  using OpeningCount_t = typename SparseGate_t::OpeningCount_t;
+
+  /// Type representing a variation of open channels.
+  using OpeningDiff_t = typename SparseGate_t::OpeningDiff_t;
+
+  /// An unbearably small tick number.
+  static constexpr ClockTick_t MinTick = SparseGate_t::MinTick;
+
+  /// An unbearably large tick number.
+  static constexpr ClockTick_t MaxTick = SparseGate_t::MaxTick;
+
+
+  /// Constructor: a closed gate with an empty window.
+  DenseTriggerGateData() = default;
+
+  /// Constructor: a closed gate covering `nTicks` ticks from `start` on.
+  DenseTriggerGateData(ClockTick_t start, std::size_t nTicks)
+    : fStart(start), fOpening(nTicks, OpeningCount_t{ 0 }) {}
+
+  /**
+   * @brief Constructor: converts a sparse gate.
+   * @param gate the gate to be converted
+   * @param start the first tick of the window
+   * @param nTicks the number of ticks in the window
+   *
+   * The opening before the window is the one of `gate` at the tick just
+   * before `start`, and the one after the window is the one at the end of it.
+   */
+  DenseTriggerGateData
+    (SparseGate_t const& gate, ClockTick_t start, std::size_t nTicks);
+
+
+  // --- BEGIN Query -----------------------------------------------------------
+  /// @name Query
+  /// @{
+
+  /// Returns the first tick of the window.
+  ClockTick_t startTick() const { return fStart; }
+
+  /// Returns the first tick after the end of the window.
+  ClockTick_t endTick() const { return fStart + nTicks(); }
+
+  /// Returns the number of ticks in the window.
+  std::size_t nTicks() const { return fOpening.size(); }
+
+  /// Returns the opening of the gate at each tick of the window.
+  std::vector<OpeningCount_t> const& openings() const { return fOpening; }
+
+  /// Returns the tick of the last change of the gate.
+  ClockTick_t lastTick() const;
+
+  /// Returns the opening count of the gate at the specified `tick`.
+  OpeningCount_t openingCount(ClockTick_t tick) const;
+
+  /// Returns whether this gate never opened.
+  bool alwaysClosed() const;
+
+  /// Returns whether the gate is open at all at the specified `tick`.
+  bool isOpen(ClockTick_t tick) const { return openingCount(tick) > 0U; }
+
+  /// Returns the tick at which the gate opened.
+  /// @see `TriggerGateData::findOpen()`
+  ClockTick_t findOpen(
+    OpeningCount_t minOpening = 1U,
+    ClockTick_t start = MinTick, ClockTick_t end = MaxTick
+    ) const;
+
+  /// Returns the tick at which the gate closed.
+  /// @see `TriggerGateData::findClose()`
+  ClockTick_t findClose(
+    OpeningCount_t minOpening = 1U,
+    ClockTick_t start = MinTick, ClockTick_t end = MaxTick
+    ) const;
+
+  /// Returns the tick at which the gate has the maximum opening.
+  /// @see `TriggerGateData::findMaxOpen()`
+  ClockTick_t findMaxOpen
+    (ClockTick_t start = MinTick, ClockTick_t end = MaxTick) const;
+
+  /// Returns the range of trigger opening values in the specified range.
+  /// @see `TriggerGateData::openingRange()`
+  std::pair<OpeningCount_t, OpeningCount_t> openingRange
+    (ClockTick_t start, ClockTick_t end) const;
+
+  /// @}
+  // --- END Query -------------------------------------------------------------
+
+
+  // --- BEGIN Gate opening and closing operations -----------------------------
+  /**
+   * @name Gate opening and closing operations
+   *
+   * These operations follow the ones of `TriggerGateData`. Changes which
+   * would make the opening outside of the window not constant are not
+   * supported, and they throw a `std::runtime_error` exception.
+   */
+  /// @{
+
+  /// Changes the opening to `openingCount` from `tick` on.
+  void setOpeningAt(ClockTick_t tick, OpeningCount_t openingCount);
+
+  /// Open this gate at the specified time (increase the opening by `count`).
+  void openAt(ClockTick_t tick, OpeningDiff_t count)
+    { openBetween(tick, MaxTick, count); }
+
+  /// Open this gate at the specified time (increase the opening by 1).
+  void openAt(ClockTick_t tick) { openAt(tick, 1); }
+
+  /// Open this gate at specified `start` tick, and close it at `end` tick.
+  void openBetween(ClockTick_t start, ClockTick_t end, OpeningDiff_t count = 1);
+
+  /// Open this gate at the specified time, and close it `length` ticks later.
+  void openFor(ClockTick_t tick, ClockTicks_t length, OpeningDiff_t count = 1)
+    { openBetween(tick, tick + length, count); }
+
+  /// Close this gate at the specified time (decrease the opening by `count`).
+  void closeAt(ClockTick_t tick, OpeningDiff_t count) { openAt(tick, -count); }
+
+  /// Close this gate at the specified time.
+  void closeAt(ClockTick_t tick) { closeAt(tick, 1); }
+
+  /// Completely close this gate at the specified time.
+  void closeAllAt(ClockTick_t tick) { setOpeningAt(tick, 0U); }
+
+  /// Closes the gate everywhere, keeping the window.
+  void clear();
+
+  /// @}
+  // --- END Gate opening and closing operations -------------------------------
+
+
+  // --- BEGIN Combination operations ------------------------------------------
+  /**
+   * @name Combination operations
+   *
+   * These are the equivalent of the ones of `TriggerGateData`.
+   * The two gates must have the same window, or a `std::runtime_error`
+   * exception is thrown.
+   */
+  /// @{
+
+  /// Combines with a gate, keeping the minimum opening among the two.
+  densetriggergatedata_t& Min(densetriggergatedata_t const& other);
+
+  /// Combines with a gate, keeping the maximum opening among the two.
+  densetriggergatedata_t& Max(densetriggergatedata_t const& other);
+
+  /// Combines with a gate, keeping the sum of openings of the two.
+  densetriggergatedata_t& Sum(densetriggergatedata_t const& other);
+
+  /// Combines with a gate, keeping the product of openings of the two.
+  densetriggergatedata_t& Mul(densetriggergatedata_t const& other);
+
+  /// Returns a gate with the minimum opening between the specified two.
+  static densetriggergatedata_t Min
+    (densetriggergatedata_t const& a, densetriggergatedata_t const& b)
+    { auto combination { a }; combination.Min(b); return combination; }
+
+  /// Returns a gate with the maximum opening between the specified two.
+  static densetriggergatedata_t Max
+    (densetriggergatedata_t const& a, densetriggergatedata_t const& b)
+    { auto combination { a }; combination.Max(b); return combination; }
+
+  /// Returns a gate with opening sum of the specified two.
+  static densetriggergatedata_t Sum
+    (densetriggergatedata_t const& a, densetriggergatedata_t const& b)
+    { auto combination { a }; combination.Sum(b); return combination; }
+
+  /// Returns a gate with opening product of the specified two.
+  static densetriggergatedata_t Mul
+    (densetriggergatedata_t const& a, densetriggergatedata_t const& b)
+    { auto combination { a }; combination.Mul(b); return combination; }
+
+  /**
+   * @brief Combines with a gate via the specified operation.
+   * @tparam Op binary operation: `OpeningCount_t` (x2) to `OpeningCount_t`
+   * @param op binary combination operation
+   * @param other the gate to combine with
+   * @return this object
+   *
+   * The operation is applied tick by tick, as `op(this, other)`.
+   */
+  template <typename Op>
+  densetriggergatedata_t& combine(Op op, densetriggergatedata_t const& other);
+
+  /// @}
+  // --- END Combination operations --------------------------------------------
+
+
+  /// Returns a sparse gate with the same opening at each tick.
+  SparseGate_t toSparse() const;
+
+
+  // standard comparison operators: all must be the same
+  bool operator== (DenseTriggerGateData const& other) const
+    {
+      return (fStart == other.fStart) && (fBefore == other.fBefore)
+        && (fAfter == other.fAfter) && (fOpening == other.fOpening);
+    }
+  bool operator!= (DenseTriggerGateData const& other) const
+    { return !(*this == other); }
+
+
+    private:
+
+  ClockTick_t fStart { 0 }; ///< First tick of the window.
+
+  std::vector<OpeningCount_t> fOpening; ///< Opening at each window tick.
+
+  OpeningCount_t fBefore { 0 }; ///< Opening before the window.
+
+  OpeningCount_t fAfter { 0 }; ///< Opening after the window.
+
+
+  /// Returns the opening at the tick preceding `tick`
+  /// (`tick` must be in [ `startTick()`, `endTick()` ]).
+  OpeningCount_t previousOpening(ClockTick_t tick) const
+    { return (tick == fStart)? fBefore: fOpening[tick - fStart - 1]; }
+
+  /// Returns the first change at or after `start` and before `end` with
+  /// an opening satisfying `op`, or `end` if none.
+  template <typename Op>
+  ClockTick_t findChange(Op op, ClockTick_t start, ClockTick_t end) const;
+
+  /// Throws an exception if `other` does not have the same window.
+  void checkSameWindow(densetriggergatedata_t const& other) const;
+
+  /// Throws an exception describing the unsupported `what` operation.
+  [[noreturn]] static void throwOutOfWindow(std::string const& what);
+
+}; // class icarus::trigger::DenseTriggerGateData<>
+
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+template <typename Tick, typename TickInterval>
+icarus::trigger::DenseTriggerGateData<Tick, TickInterval>::DenseTriggerGateData
+  (SparseGate_t const& gate, ClockTick_t start, std::size_t nTicks)
+  : fStart(start)
+{
+  fOpening.reserve(nTicks);
+  auto cursor = gate.cursor();
+  fBefore = (start > MinTick)? cursor.openingCount(start - 1): 0U;
+  for (std::size_t i = 0; i < nTicks; ++i)
+    fOpening.push_back(cursor.openingCount(start + i));
+  fAfter = cursor.openingCount(endTick());
+} // icarus::trigger::DenseTriggerGateData<>::DenseTriggerGateData(Sparse)
+
+
+//------------------------------------------------------------------------------
+template <typename Tick, typename TickInterval>
+auto icarus::trigger::DenseTriggerGateData<Tick, TickInterval>::lastTick() const
+  -> ClockTick_t
+{
+  if (fOpening.empty() || (fAfter != fOpening.back())) return endTick();
+  for (std::size_t i = nTicks() - 1; i > 0; --i)
+    if (fOpening[i] != fOpening[i - 1]) return fStart + i;
+  return (fOpening.front() != fBefore)? fStart: MinTick;
+} // icarus::trigger::DenseTriggerGateData<>::lastTick()
+
+
+//------------------------------------------------------------------------------
+template <typename Tick, typename TickInterval>
+auto icarus::trigger::DenseTriggerGateData<Tick, TickInterval>::openingCount
+  (ClockTick_t tick) const -> OpeningCount_t
+{
+  if (tick < fStart) return fBefore;
+  if (tick >= endTick()) return fAfter;
+  return fOpening[tick - fStart];
+} // icarus::trigger::DenseTriggerGateData<>::openingCount()
+
+
+//------------------------------------------------------------------------------
+template <typename Tick, typename TickInterval>
+bool icarus::trigger::DenseTriggerGateData<Tick, TickInterval>::alwaysClosed
+  () const
+{
+  OpeningCount_t any = fBefore | fAfter;
+  for (OpeningCount_t const opening: fOpening) any |= opening;
+  return any == 0U;
+} // icarus::trigger::DenseTriggerGateData<>::alwaysClosed()
+
+
+//------------------------------------------------------------------------------
+template <typename Tick, typename TickInterval>
+auto icarus::trigger::DenseTriggerGateData<Tick, TickInterval>::findOpen(
+  OpeningCount_t minOpening /* = 1U */,
+  ClockTick_t start /* = MinTick */, ClockTick_t end /* = MaxTick */
+) const -> ClockTick_t
+{
+  return findChange
+    ([minOpening](OpeningCount_t opening){ return opening >= minOpening; },
+     start, end);
+} // icarus::trigger::DenseTriggerGateData<>::findOpen()
+
+
+//------------------------------------------------------------------------------
+template <typename Tick, typename TickInterval>
+auto icarus::trigger::DenseTriggerGateData<Tick, TickInterval>::findClose(
+  OpeningCount_t minOpening /* = 1U */,
+  ClockTick_t start /* = MinTick */, ClockTick_t end /* = MaxTick */
+) const -> ClockTick_t
+{
+  return findChange
+    ([minOpening](OpeningCount_t opening){ return opening < minOpening; },
+     start, end);
+} // icarus::trigger::DenseTriggerGateData<>::findClose()
+
+
+//------------------------------------------------------------------------------
+template <typename Tick, typename TickInterval>
+auto icarus::trigger::DenseTriggerGateData<Tick, TickInterval>::findMaxOpen
+  (ClockTick_t start /* = MinTick */, ClockTick_t end /* = MaxTick */) const
+  -> ClockTick_t
+{
+  // the opening at `start` is the first candidate; then only changes count
+  ClockTick_t maxTick = start;
+  OpeningCount_t maxOpening = openingCount(start);
+  ClockTick_t const last = std::min(end, endTick() + 1);
+  for (ClockTick_t tick = std::max(start + 1, fStart); tick < last; ++tick) {
+    OpeningCount_t const opening = openingCount(tick);
+    if (opening <= maxOpening) continue;
+    maxOpening = opening;
+    maxTick = tick;
+  } // for
+  return maxTick;
+} // icarus::trigger::DenseTriggerGateData<>::findMaxOpen()
+
+
+//------------------------------------------------------------------------------
+template <typename Tick, typename TickInterval>
+auto icarus::trigger::DenseTriggerGateData<Tick, TickInterval>::openingRange
+  (ClockTick_t start, ClockTick_t end) const
+  -> std::pair<OpeningCount_t, OpeningCount_t>
+{
+  if (start >= end) return { {}, {} };
+
+  OpeningCount_t const startOpening = openingCount(start);
+  std::pair<OpeningCount_t, OpeningCount_t> limits
+    { startOpening, startOpening };
+  ClockTick_t const last = std::min(end, endTick() + 1);
+  for (ClockTick_t tick = std::max(start + 1, fStart); tick < last; ++tick) {
+    OpeningCount_t const opening = openingCount(tick);
+    limits.first = std::min(limits.first, opening);
+    limits.second = std::max(limits.second, opening);
+  } // for
+  ++limits.second;
+  return limits;
+} // icarus::trigger::DenseTriggerGateData<>::openingRange()
+
+
+//------------------------------------------------------------------------------
+template <typename Tick, typename TickInterval>
+void icarus::trigger::DenseTriggerGateData<Tick, TickInterval>::setOpeningAt
+  (ClockTick_t tick, OpeningCount_t openingCount)
+{
+  if (tick < fStart) {
+    if (tick > MinTick) throwOutOfWindow("setOpeningAt()");
+    fBefore = openingCount;
+  }
+  ClockTick_t const first = std::max(tick, fStart);
+  for (ClockTick_t t = first; t < endTick(); ++t)
+    fOpening[t - fStart] = openingCount;
+  fAfter = openingCount;
+} // icarus::trigger::DenseTriggerGateData<>::setOpeningAt()
+
+
+//------------------------------------------------------------------------------
+template <typename Tick, typename TickInterval>
+void icarus::trigger::DenseTriggerGateData<Tick, TickInterval>::openBetween
+  (ClockTick_t start, ClockTick_t end, OpeningDiff_t count /* = 1 */)
+{
+  if (start >= end) return; // weird, yet valid
+
+  // the region before (after) the window must be either fully or not at all
+  // affected
+  bool const changeBefore = (start < fStart);
+  if (changeBefore && ((start > MinTick) || (end < fStart)))
+    throwOutOfWindow("openBetween()");
+  bool const changeAfter = (end > endTick());
+  if (changeAfter && ((end < MaxTick) || (start > endTick())))
+    throwOutOfWindow("openBetween()");
+
+  auto const shift = [count, start](OpeningCount_t& opening, ClockTick_t tick)
+    {
+      if ((count < 0) && (opening < OpeningCount_t(-count))) {
+        throw std::runtime_error(
+          "icarus::trigger::DenseTriggerGateData::openBetween(): "
+          "asked to close " + std::to_string(-count)
+          + " gate counts starting at " + std::to_string(start)
+          + " but at time " + std::to_string(tick) + " only "
+          + std::to_string(opening) + " are still open"
+          );
+      }
+      opening += count;
+    };
+
+  if (changeBefore) shift(fBefore, start);
+  ClockTick_t const first = std::max(start, fStart);
+  ClockTick_t const last = std::min(end, endTick());
+  for (ClockTick_t tick = first; tick < last; ++tick)
+    shift(fOpening[tick - fStart], tick);
+  if (changeAfter) shift(fAfter, endTick());
+
+} // icarus::trigger::DenseTriggerGateData<>::openBetween()
+
+
+//------------------------------------------------------------------------------
+template <typename Tick, typename TickInterval>
+void icarus::trigger::DenseTriggerGateData<Tick, TickInterval>::clear() {
+  std::fill(fOpening.begin(), fOpening.end(), OpeningCount_t{ 0 });
+  fBefore = fAfter = 0U;
+} // icarus::trigger::DenseTriggerGateData<>::clear()
+
+
+//------------------------------------------------------------------------------
+template <typename Tick, typename TickInterval>
+auto icarus::trigger::DenseTriggerGateData<Tick, TickInterval>::Min
+  (densetriggergatedata_t const& other) -> densetriggergatedata_t&
+{
+  return combine
+    ([](OpeningCount_t a, OpeningCount_t b){ return std::min(a, b); }, other);
+} // icarus::trigger::DenseTriggerGateData<>::Min()
+
+
+//------------------------------------------------------------------------------
+template <typename Tick, typename TickInterval>
+auto icarus::trigger::DenseTriggerGateData<Tick, TickInterval>::Max
+  (densetriggergatedata_t const& other) -> densetriggergatedata_t&
+{
+  return combine
+    ([](OpeningCount_t a, OpeningCount_t b){ return std::max(a, b); }, other);
+} // icarus::trigger::DenseTriggerGateData<>::Max()
+
+
+//------------------------------------------------------------------------------
+template <typename Tick, typename TickInterval>
+auto icarus::trigger::DenseTriggerGateData<Tick, TickInterval>::Sum
+  (densetriggergatedata_t const& other) -> densetriggergatedata_t&
+{
+  return combine
+    ([](OpeningCount_t a, OpeningCount_t b){ return a + b; }, other);
+} // icarus::trigger::DenseTriggerGateData<>::Sum()
+
+
+//------------------------------------------------------------------------------
+template <typename Tick, typename TickInterval>
+auto icarus::trigger::DenseTriggerGateData<Tick, TickInterval>::Mul
+  (densetriggergatedata_t const& other) -> densetriggergatedata_t&
+{
+  return combine
+    ([](OpeningCount_t a, OpeningCount_t b){ return a * b; }, other);
+} // icarus::trigger::DenseTriggerGateData<>::Mul()
+
+
+//------------------------------------------------------------------------------
+template <typename Tick, typename TickInterval>
+template <typename Op>
+auto icarus::trigger::DenseTriggerGateData<Tick, TickInterval>::combine
+  (Op op, densetriggergatedata_t const& other) -> densetriggergatedata_t&
+{
+  checkSameWindow(other);
+
+  // plain loop on contiguous memory: the compiler can vectorize it
+  std::size_t const n = fOpening.size();
+  OpeningCount_t* dest = fOpening.data();
+  OpeningCount_t const* src = other.fOpening.data();
+  for (std::size_t i = 0; i < n; ++i) dest[i] = op(dest[i], src[i]);
+
+  fBefore = op(fBefore, other.fBefore);
+  fAfter = op(fAfter, other.fAfter);
+  return *this;
+} // icarus::trigger::DenseTriggerGateData<>::combine()
+
+
+//------------------------------------------------------------------------------
+template <typename Tick, typename TickInterval>
+auto icarus::trigger::DenseTriggerGateData<Tick, TickInterval>::toSparse() const
+  -> SparseGate_t
+{
+  using Status_t = typename SparseGate_t::Status;
+  using EventType = typename SparseGate_t::EventType;
+
+  SparseGate_t gate;
+  auto& gateLevel = gate.fGateLevel;
+  gateLevel.front().opening = fBefore;
+
+  OpeningCount_t prevOpening = fBefore;
+  for (std::size_t i = 0; i <= nTicks(); ++i) {
+    OpeningCount_t const opening = (i < nTicks())? fOpening[i]: fAfter;
+    if (opening == prevOpening) continue;
+    ClockTick_t const tick = fStart + i;
+    if (tick == gateLevel.back().tick) gateLevel.back().opening = opening;
+    else gateLevel.push_back(Status_t{ EventType::Shift, tick, opening });
+    prevOpening = opening;
+  } // for
+
+  return gate;
+} // icarus::trigger::DenseTriggerGateData<>::toSparse()
+
+
+//------------------------------------------------------------------------------
+template <typename Tick, typename TickInterval>
+template <typename Op>
+auto icarus::trigger::DenseTriggerGateData<Tick, TickInterval>::findChange
+  (Op op, ClockTick_t start, ClockTick_t end) const -> ClockTick_t
+{
+  // the start of the gate counts as a change, like in the sparse gate
+  if ((start == MinTick) && (end > MinTick) && op(openingCount(MinTick)))
+    return MinTick;
+
+  // changes can happen only in the window or right at its end
+  ClockTick_t const last = std::min(end, endTick() + 1);
+  for (ClockTick_t tick = std::max(start, fStart); tick < last; ++tick) {
+    OpeningCount_t const opening = openingCount(tick);
+    if ((opening != previousOpening(tick)) && op(opening)) return tick;
+  }
+  return end;
+} // icarus::trigger::DenseTriggerGateData<>::findChange()
+
+
+//------------------------------------------------------------------------------
+template <typename Tick, typename TickInterval>
+void icarus::trigger::DenseTriggerGateData<Tick, TickInterval>::checkSameWindow
+  (densetriggergatedata_t const& other) const
+{
+  if ((fStart == other.fStart) && (nTicks() == other.nTicks())) return;
+  throw std::runtime_error(
+    "icarus::trigger::DenseTriggerGateData: can't combine a gate with window ["
+    + std::to_string(fStart) + ", " + std::to_string(endTick())
+    + "[ with one with window [" + std::to_string(other.startTick())
+    + ", " + std::to_string(other.endTick()) + "["
+    );
+} // icarus::trigger::DenseTriggerGateData<>::checkSameWindow()
+
+
+//------------------------------------------------------------------------------
+template <typename Tick, typename TickInterval>
+void icarus::trigger::DenseTriggerGateData<Tick, TickInterval>::throwOutOfWindow
+  (std::string const& what)
+{
+  throw std::runtime_error("icarus::trigger::DenseTriggerGateData::" + what
+    + ": change of opening outside of the gate window is not supported");
+} // icarus::trigger::DenseTriggerGateData<>::throwOutOfWindow()
+
+
+//------------------------------------------------------------------------------
+
+#endif // SBNOBJ_ICARUS_PMT_TRIGGER_DATA_DENSETRIGGERGATEDATA_H
@@ -0,0 +1,159 @@
+/**
+ * @file   sbnobj/ICARUS/PMT/Trigger/Data/DiscriminatedGateBuilder.cxx
+ * @brief  Builds a single channel optical trigger gate from PMT samples.
+ * @date   October 14, 2026
+ * @see    `sbnobj/ICARUS/PMT/Trigger/Data/DiscriminatedGateBuilder.h`
+ *
+ */
+
+// class header
+#include "sbnobj/ICARUS/PMT/Trigger/Data/DiscriminatedGateBuilder.h"
+
+// framework libraries
+#include "cetlib_except/exception.h"
+
+// C/C++ standard libraries
+#include <limits>
+
+
+//------------------------------------------------------------------------------
+//--- icarus::trigger::DiscriminatedGateBuilder
+//------------------------------------------------------------------------------
+icarus::trigger::DiscriminatedGateBuilder::DiscriminatedGateBuilder
+  (int baseline, int threshold)
+  : fLevel(checkedLevel(baseline - threshold))
+  {}
+
+
+//------------------------------------------------------------------------------
+icarus::trigger::DiscriminatedGateBuilder::DiscriminatedGateBuilder
+  (sbn::V1730channelConfiguration const& config)
+  : DiscriminatedGateBuilder(config.baseline, config.relativeThreshold())
+  {}
+
+
+//------------------------------------------------------------------------------
+void icarus::trigger::DiscriminatedGateBuilder::add
+  (raw::OpDetWaveform const& waveform, ClockTick_t firstTick)
+{
+  if (!fWaveforms.empty()
+    && (fWaveforms.front()->ChannelNumber() != waveform.ChannelNumber())
+  ) {
+    throw cet::exception("DiscriminatedGateBuilder")
+      << "icarus::trigger::DiscriminatedGateBuilder::add(): "
+      << "can't add a waveform on channel " << waveform.ChannelNumber()
+      << " to a gate on channel " << fWaveforms.front()->ChannelNumber()
+      << "\n";
+  }
+  add(firstTick, waveform.data(), waveform.size());
+  fWaveforms.push_back(&waveform);
+} // icarus::trigger::DiscriminatedGateBuilder::add(OpDetWaveform)
+
+
+//------------------------------------------------------------------------------
+void icarus::trigger::DiscriminatedGateBuilder::add
+  (ClockTick_t firstTick, ADCCount_t const* samples, std::size_t nSamples)
+{
+  startChunk(firstTick);
+  if (nSamples == 0U) return;
+
+  fCrossings.clear();
+  findCrossings(samples, nSamples, fLevel, fOpen, fCrossings);
+  for (std::size_t const crossing: fCrossings) {
+    fOpen = !fOpen;
+    appendChange(firstTick + crossing, fOpen);
+  }
+
+  fEndTick = firstTick + nSamples;
+
+} // icarus::trigger::DiscriminatedGateBuilder::add(samples)
+
+
+//------------------------------------------------------------------------------
+void icarus::trigger::DiscriminatedGateBuilder::add(
+  ClockTick_t firstTick, std::size_t nSamples,
+  std::vector<Interval_t> const& intervals
+) {
+  startChunk(firstTick);
+  if (nSamples == 0U) return;
+
+  // a gate still open from the previous chunk closes unless the first
+  // interval starts right away
+  if (intervals.empty() || (intervals.front().begin > 0U))
+    setOpen(firstTick, false);
+  for (Interval_t const& interval: intervals) {
+    setOpen(firstTick + interval.begin, true);
+    if (interval.end < nSamples) setOpen(firstTick + interval.end, false);
+  }
+
+  fEndTick = firstTick + nSamples;
+
+} // icarus::trigger::DiscriminatedGateBuilder::add(intervals)
+
+
+//------------------------------------------------------------------------------
+auto icarus::trigger::DiscriminatedGateBuilder::finish() -> Gate_t {
+
+  if (fOpen) {
+    fOpen = false;
+    appendChange(fEndTick, fOpen);
+  }
+
+  Gate_t gate = fWaveforms.empty()
+    ? Gate_t{ raw::InvalidChannel }: Gate_t{ *fWaveforms.front() };
+  for (raw::OpDetWaveform const* waveform: fWaveforms) gate.add(*waveform);
+  Gate_t::GateData_t& readoutGate = gate;
+  readoutGate.gateLevels() = std::move(fLevels);
+
+  // reset
+  fLevels = GateData_t{};
+  fWaveforms.clear();
+  fEndTick = GateData_t::MinTick;
+
+  return gate;
+} // icarus::trigger::DiscriminatedGateBuilder::finish()
+
+
+//------------------------------------------------------------------------------
+void icarus::trigger::DiscriminatedGateBuilder::startChunk
+  (ClockTick_t firstTick)
+{
+  if (firstTick < fEndTick) {
+    throw cet::exception("DiscriminatedGateBuilder")
+      << "icarus::trigger::DiscriminatedGateBuilder::add(): "
+      << "samples starting at tick " << firstTick
+      << " precede the end of the previous ones (" << fEndTick << ")\n";
+  }
+
+  // the gate is closed between non-contiguous chunks
+  if (firstTick > fEndTick) setOpen(fEndTick, false);
+
+} // icarus::trigger::DiscriminatedGateBuilder::startChunk()
+
+
+//------------------------------------------------------------------------------
+void icarus::trigger::DiscriminatedGateBuilder::appendChange
+  (ClockTick_t tick, bool open)
+{
+  // stati are in tick order by construction: no search needed
+  fLevels.fGateLevel.emplace_back
+    (GateData_t::EventType::Shift, tick, open? 1U: 0U);
+} // icarus::trigger::DiscriminatedGateBuilder::appendChange()
+
+
+//------------------------------------------------------------------------------
+auto icarus::trigger::DiscriminatedGateBuilder::checkedLevel(int level)
+  -> ADCCount_t
+{
+  if ((level < std::numeric_limits<ADCCount_t>::min())
+    || (level > std::numeric_limits<ADCCount_t>::max())
+  ) {
+    throw cet::exception("DiscriminatedGateBuilder")
+      << "icarus::trigger::DiscriminatedGateBuilder: discrimination level "
+      << level << " is not a valid ADC count\n";
+  }
+  return static_cast<ADCCount_t>(level);
+} // icarus::trigger::DiscriminatedGateBuilder::checkedLevel()
+
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,196 @@
+/**
+ * @file   sbnobj/ICARUS/PMT/Trigger/Data/DiscriminatedGateBuilder.h
+ * @brief  Builds a single channel optical trigger gate from PMT samples.
+ * @date   October 14, 2026
+ * @see    `sbnobj/ICARUS/PMT/Trigger/Data/DiscriminatedGateBuilder.cxx`
+ *
+ */
+
+#ifndef SBNOBJ_ICARUS_PMT_TRIGGER_DATA_DISCRIMINATEDGATEBUILDER_H
+#define SBNOBJ_ICARUS_PMT_TRIGGER_DATA_DISCRIMINATEDGATEBUILDER_H
+
+
+// ICARUS libraries
+#include "sbnobj/ICARUS/PMT/Trigger/Data/SingleChannelOpticalTriggerGate.h"
+#include "sbnobj/Common/PMT/Data/V1730channelConfiguration.h"
+#include "sbnobj/Common/PMT/Data/V1730Discriminator.h"
+
+// LArSoft libraries
+#include "lardataobj/RawData/OpDetWaveform.h"
+
+// C/C++ standard libraries
+#include <vector>
+#include <cstddef> // std::size_t
+
+
+//------------------------------------------------------------------------------
+namespace icarus::trigger { class DiscriminatedGateBuilder; }
+
+/**
+ * @brief Builds the gate of a PMT channel by discriminating its samples.
+ *
+ * The gate is open (opening `1`) on all the ticks where the sample is at or
+ * below the discrimination level, `baseline - threshold` (PMT pulses are
+ * negative), and closed elsewhere, including the ticks not covered by any
+ * sample.
+ *
+ * Samples are added in chunks (typically, one `raw::OpDetWaveform` each),
+ * in increasing tick order. Each chunk is scanned 64 samples at a time: the
+ * comparison with the level fills a bit mask in a branchless loop the
+ * compiler can vectorize, and the level transitions are then extracted from
+ * the mask. The gate stati are appended at the end of the gate, without any
+ * search or insertion in the middle. The result is the same as opening the
+ * gate tick by tick with `openFor()`.
+ *
+ * Example:
+ * @code
+ * icarus::trigger::DiscriminatedGateBuilder builder { config };
+ * for (raw::OpDetWaveform const& waveform: channelWaveforms)
+ *   builder.add(waveform, tickOf(waveform));
+ * icarus::trigger::SingleChannelOpticalTriggerGate gate = builder.finish();
+ * @endcode
+ * where `config` is the `sbn::V1730channelConfiguration` of the channel and
+ * `tickOf()` returns the tick of the first sample of the waveform.
+ *
+ * The intervals over threshold found by `sbn::V1730Discriminator` can also be
+ * added directly, with `add(firstTick, nSamples, intervals)`.
+ *
+ * The builder can be reused after `finish()`.
+ */
+class icarus::trigger::DiscriminatedGateBuilder {
+
+    public:
+
+  /// Type of gate being built.
+  using Gate_t = icarus::trigger::SingleChannelOpticalTriggerGate;
+
+  /// Type of gate level data.
+  using GateData_t = Gate_t::GateData_t::GateData_t;
+
+  using ClockTick_t = GateData_t::ClockTick_t; ///< Tick point.
+
+  /// Type of a PMT sample.
+  using ADCCount_t = raw::OpDetWaveform::value_type;
+
+  /// Type of interval of samples over threshold.
+  using Interval_t = sbn::V1730Discriminator::Interval_t;
+
+
+  /**
+   * @brief Constructor: discriminates at `threshold` below `baseline`.
+   * @param baseline the baseline of the channel [ADC]
+   * @param threshold the amplitude of the threshold above baseline [ADC]
+   * @throw cet::exception if the resulting level is not a valid sample
+   */
+  DiscriminatedGateBuilder(int baseline, int threshold);
+
+  /// Constructor: uses baseline and threshold from the channel `config`.
+  DiscriminatedGateBuilder(sbn::V1730channelConfiguration const& config);
+
+
+  /// Returns the discrimination level: samples up to it open the gate.
+  ADCCount_t level() const { return fLevel; }
+
+
+  /**
+   * @brief Discriminates the samples of `waveform` into the gate.
+   * @param waveform the waveform to be added
+   * @param firstTick tick of the first sample of the waveform
+   * @throw cet::exception if `firstTick` precedes the end of the samples
+   *        already added, or if `waveform` is not on the channel of the gate
+   *
+   * The waveform is also associated to the gate.
+   */
+  void add(raw::OpDetWaveform const& waveform, ClockTick_t firstTick);
+
+  /**
+   * @brief Discriminates `nSamples` samples starting at `firstTick`.
+   * @param firstTick tick of the first sample
+   * @param samples pointer to the first sample
+   * @param nSamples number of samples
+   * @throw cet::exception if `firstTick` precedes the end of the samples
+   *        already added
+   *
+   * This only affects the gate levels: no waveform is associated to the gate.
+   */
+  void add
+    (ClockTick_t firstTick, ADCCount_t const* samples, std::size_t nSamples);
+
+  /**
+   * @brief Adds `nSamples` samples already discriminated into `intervals`.
+   * @param firstTick tick of the first sample
+   * @param nSamples number of samples
+   * @param intervals the intervals of samples over threshold, sorted
+   * @throw cet::exception if `firstTick` precedes the end of the samples
+   *        already added
+   * @see `sbn::V1730Discriminator::discriminate()`
+   *
+   * The gate is open on the intervals, and closed on the rest of the samples;
+   * the discrimination level of the builder is not used.
+   * This only affects the gate levels: no waveform is associated to the gate.
+   */
+  void add(
+    ClockTick_t firstTick, std::size_t nSamples,
+    std::vector<Interval_t> const& intervals
+    );
+
+  /**
+   * @brief Closes and returns the gate, and resets the builder.
+   * @return the gate with all the discriminated samples
+   *
+   * If no waveform was added, the gate is on `raw::InvalidChannel`.
+   */
+  Gate_t finish();
+
+
+  /**
+   * @brief Finds the ticks where samples cross `level`.
+   * @see `sbn::V1730Discriminator::findCrossings()`
+   */
+  static void findCrossings(
+    ADCCount_t const* samples, std::size_t nSamples, ADCCount_t level,
+    bool open, std::vector<std::size_t>& crossings
+    )
+    {
+      sbn::V1730Discriminator::findCrossings
+        (samples, nSamples, level, open, crossings);
+    }
+
+
+    private:
+
+  ADCCount_t fLevel; ///< Discrimination level.
+
+  GateData_t fLevels; ///< The levels of the gate being built.
+
+  /// The waveforms added to the gate being built.
+  std::vector<raw::OpDetWaveform const*> fWaveforms;
+
+  bool fOpen = false; ///< Whether the gate is open after the last sample.
+
+  /// Tick after the last sample added.
+  ClockTick_t fEndTick = GateData_t::MinTick;
+
+  std::vector<std::size_t> fCrossings; ///< Buffer for the crossings.
+
+
+  /// Appends to the gate a change of opening to `open` at `tick`.
+  void appendChange(ClockTick_t tick, bool open);
+
+  /// Sets the gate opening at `tick` to `open`, if it's not already.
+  void setOpen(ClockTick_t tick, bool open)
+    { if (open != fOpen) { fOpen = open; appendChange(tick, open); } }
+
+  /// Checks that `firstTick` follows the samples, and closes the gate if
+  /// they are not contiguous.
+  void startChunk(ClockTick_t firstTick);
+
+  /// Returns `level` if it is a valid sample value, throws otherwise.
+  static ADCCount_t checkedLevel(int level);
+
+}; // class icarus::trigger::DiscriminatedGateBuilder
+
+
+//------------------------------------------------------------------------------
+
+#endif // SBNOBJ_ICARUS_PMT_TRIGGER_DATA_DISCRIMINATEDGATEBUILDER_H
@@ -0,0 +1,280 @@
+/**
+ * @file   sbnobj/ICARUS/PMT/Trigger/Data/GateCombinationCache.h
+ * @brief  Reuse of trigger gate combinations within an event.
+ * @date   October 14, 2026
+ *
+ * This is a header-only library.
+ */
+
+#ifndef SBNOBJ_ICARUS_PMT_TRIGGER_DATA_GATECOMBINATIONCACHE_H
+#define SBNOBJ_ICARUS_PMT_TRIGGER_DATA_GATECOMBINATIONCACHE_H
+
+
+// ICARUS libraries
+#include "sbnobj/ICARUS/PMT/Trigger/Data/ReadoutTriggerGate.h"
+
+// C/C++ standard libraries
+#include <map>
+#include <memory> // std::shared_ptr, std::make_shared()
+#include <vector>
+#include <algorithm> // std::min(), std::max(), std::sort()
+#include <functional> // std::reference_wrapper, std::plus, std::multiplies
+#include <iterator> // std::distance()
+#include <stdexcept> // std::runtime_error
+#include <string> // std::to_string()
+#include <tuple> // std::tie()
+#include <cstddef> // std::size_t
+
+
+//------------------------------------------------------------------------------
+namespace icarus::trigger {
+
+  /// Combination operations supported by `GateCombinationCache`.
+  enum class GateCombination { Min, Max, Sum, Mul };
+
+  template <typename Tick, typename TickInterval, typename ChannelIDType>
+  class GateCombinationCache;
+
+} // namespace icarus::trigger
+
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Cache of the combinations of readout gates computed in an event.
+ * @tparam Tick type used to count the ticks
+ * @tparam TickInterval type used to quantify tick difference
+ * @tparam ChannelIDType type of channel ID
+ *
+ * Trigger emulation often computes the same combination of the same gates
+ * many times, e.g. the `Max()` of the PMT pairs of each LVDS channel, once
+ * for each majority level and window definition being scanned.
+ * This object computes each combination once, and then returns the same
+ * immutable result, shared, when the same combination is requested again.
+ *
+ * Combinations are identified by the operation and, for each of the combined
+ * gates, by its channels and its delay; the order of the gates does not
+ * matter, since all the supported operations are symmetric and associative.
+ * Within an event, gates are therefore assumed to be identified by their
+ * channels: the cache must be `clear()`-ed at the start of each event, and
+ * two different gates with the same channels must not be combined through
+ * the same cache.
+ * Gates without channels can't be identified and can't be combined through
+ * the cache.
+ *
+ * Example:
+ * @code
+ * icarus::trigger::GateCombinationCache<TK, TI, ChannelID> cache;
+ * // at each event:
+ * cache.clear();
+ * for (auto const& config: scanConfigurations) {
+ *   for (auto const& [ first, second ]: config.pairs) {
+ *     auto const pairGate = cache.combine
+ *       (icarus::trigger::GateCombination::Max, gates[first], gates[second]);
+ *     // ...
+ *   }
+ * }
+ * @endcode
+ * The returned gates stay valid after `clear()` for as long as the caller
+ * holds them.
+ */
+template <typename Tick, typename TickInterval, typename ChannelIDType>
+class icarus::trigger::GateCombinationCache {
+
+    public:
+
+  /// Type of gates this cache combines.
+  using Gate_t = icarus::trigger::ReadoutTriggerGate
+    <Tick, TickInterval, ChannelIDType>;
+
+  using ClockTicks_t = typename Gate_t::ClockTicks_t; ///< Tick interval.
+  using ChannelID_t = typename Gate_t::ChannelID_t; ///< Channel ID type.
+
+  /// Type of the result of the combinations (shared and immutable).
+  using Result_t = std::shared_ptr<Gate_t const>;
+
+
+  /**
+   * @brief Returns the combination of `gates`, each with its delay.
+   * @tparam Gates type of range of gates (convertible to `Gate_t const&`)
+   * @tparam Delays type of range of delays, one per gate
+   * @param op the combination operation
+   * @param gates the gates to be combined
+   * @param delays ticks of delay to be added to each of the gates
+   * @return the combined gate, associated to all the channels of `gates`
+   * @throw std::runtime_error if `delays` is neither empty nor has one entry
+   *        per gate
+   * @throw ReadoutTriggerGateError if any of the gates has no channel
+   * @see `TriggerGateData::Combine()`
+   *
+   * If no delay is specified, no delay is applied to any of the gates.
+   */
+  template <typename Gates, typename Delays>
+  Result_t combine
+    (GateCombination op, Gates const& gates, Delays const& delays);
+
+  /// Returns the combination of `gates`, with no delay.
+  template <typename Gates>
+  Result_t combine(GateCombination op, Gates const& gates)
+    { return combine(op, gates, std::vector<ClockTicks_t>{}); }
+
+  /// Returns the combination of two gates, each with its delay.
+  Result_t combine(
+    GateCombination op, Gate_t const& a, Gate_t const& b,
+    ClockTicks_t aDelay = ClockTicks_t{}, ClockTicks_t bDelay = ClockTicks_t{}
+    )
+    {
+      std::reference_wrapper<Gate_t const> const gates[2] { a, b };
+      ClockTicks_t const delays[2] { aDelay, bDelay };
+      return combine(op, gates, delays);
+    }
+
+  /// Forgets all the combinations (to be called at the start of each event).
+  void clear() { fCache.clear(); }
+
+  /// Returns the number of combinations currently cached.
+  std::size_t size() const { return fCache.size(); }
+
+  /// Returns the number of requests served from the cache so far.
+  std::size_t hits() const { return fHits; }
+
+  /// Returns the number of requests which required a new combination so far.
+  std::size_t misses() const { return fMisses; }
+
+
+    private:
+
+  /// Identification of one of the combined gates.
+  struct Input_t {
+    std::vector<ChannelID_t> channels; ///< Sorted channels of the gate.
+    ClockTicks_t delay; ///< Delay applied to the gate.
+
+    bool operator< (Input_t const& other) const
+      {
+        return std::tie(channels, delay)
+          < std::tie(other.channels, other.delay);
+      }
+  }; // Input_t
+
+  /// Identification of a combination.
+  struct Key_t {
+    GateCombination op; ///< Combination operation.
+    std::vector<Input_t> inputs; ///< Combined gates, sorted.
+
+    bool operator< (Key_t const& other) const
+      { return std::tie(op, inputs) < std::tie(other.op, other.inputs); }
+  }; // Key_t
+
+  std::map<Key_t, Result_t> fCache; ///< Combinations of the current event.
+
+  std::size_t fHits = 0U; ///< Number of requests served from the cache.
+  std::size_t fMisses = 0U; ///< Number of requests computed anew.
+
+
+  using GateData_t = typename Gate_t::GateData_t; ///< Gate level data type.
+
+  /// Returns the combination of the gate levels of `gates`.
+  template <typename Gates, typename Delays>
+  static GateData_t computeLevels
+    (GateCombination op, Gates const& gates, Delays const& delays);
+
+}; // class icarus::trigger::GateCombinationCache<>
+
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+template <typename Tick, typename TickInterval, typename ChannelIDType>
+template <typename Gates, typename Delays>
+auto icarus::trigger::GateCombinationCache
+  <Tick, TickInterval, ChannelIDType>::combine
+  (GateCombination op, Gates const& gates, Delays const& delays) -> Result_t
+{
+  using std::begin, std::end;
+
+  std::size_t const nGates = std::distance(begin(gates), end(gates));
+  std::size_t const nDelays = std::distance(begin(delays), end(delays));
+  if ((nDelays != 0U) && (nDelays != nGates)) {
+    throw std::runtime_error(
+      "icarus::trigger::GateCombinationCache::combine(): "
+      + std::to_string(nDelays) + " delays specified for "
+      + std::to_string(nGates) + " gates"
+      );
+  }
+
+  Key_t key { op, {} };
+  key.inputs.reserve(nGates);
+  auto iDelay = begin(delays);
+  for (Gate_t const& gate: gates) {
+    if (!gate.hasChannels()) {
+      throw ReadoutTriggerGateError(
+        "icarus::trigger::GateCombinationCache::combine(): gate #"
+        + std::to_string(key.inputs.size())
+        + " has no channel and can't be identified"
+        );
+    }
+    auto const& channels = gate.channels(); // might be a temporary
+    Input_t input;
+    input.channels.assign(channels.begin(), channels.end());
+    std::sort(input.channels.begin(), input.channels.end());
+    input.delay = (nDelays == 0U)? ClockTicks_t{}: *(iDelay++);
+    key.inputs.push_back(std::move(input));
+  } // for
+  std::sort(key.inputs.begin(), key.inputs.end());
+
+  auto const iCached = fCache.find(key);
+  if (iCached != fCache.end()) {
+    ++fHits;
+    return iCached->second;
+  }
+  ++fMisses;
+
+  auto result = std::make_shared<Gate_t>();
+  *result = computeLevels(op, gates, delays);
+  for (Input_t const& input: key.inputs)
+    for (ChannelID_t const channel: input.channels) result->addChannel(channel);
+
+  return fCache.emplace(std::move(key), std::move(result)).first->second;
+
+} // icarus::trigger::GateCombinationCache<>::combine()
+
+
+//------------------------------------------------------------------------------
+template <typename Tick, typename TickInterval, typename ChannelIDType>
+template <typename Gates, typename Delays>
+auto icarus::trigger::GateCombinationCache
+  <Tick, TickInterval, ChannelIDType>::computeLevels
+  (GateCombination op, Gates const& gates, Delays const& delays)
+  -> GateData_t
+{
+  using OpeningCount_t = typename GateData_t::OpeningCount_t;
+
+  std::vector<std::reference_wrapper<GateData_t const>> levels;
+  for (Gate_t const& gate: gates) levels.emplace_back(gate.gateLevels());
+
+  switch (op) {
+    case GateCombination::Min:
+      return GateData_t::Combine(
+        [](OpeningCount_t a, OpeningCount_t b){ return std::min(a, b); },
+        levels, delays
+        );
+    case GateCombination::Max:
+      return GateData_t::Combine(
+        [](OpeningCount_t a, OpeningCount_t b){ return std::max(a, b); },
+        levels, delays
+        );
+    case GateCombination::Sum:
+      return GateData_t::Combine(std::plus<OpeningCount_t>(), levels, delays);
+    case GateCombination::Mul:
+      return
+        GateData_t::Combine(std::multiplies<OpeningCount_t>(), levels, delays);
+  } // switch
+  throw std::runtime_error(
+    "icarus::trigger::GateCombinationCache::combine(): unsupported operation "
+    + std::to_string(static_cast<int>(op))
+    );
+} // icarus::trigger::GateCombinationCache<>::computeLevels()
+
+
+//------------------------------------------------------------------------------
+
+#endif // SBNOBJ_ICARUS_PMT_TRIGGER_DATA_GATECOMBINATIONCACHE_H
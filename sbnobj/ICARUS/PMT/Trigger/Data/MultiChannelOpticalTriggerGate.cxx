@@ -14,8 +14,14 @@
 // ICARUS libraries
 #include "sbnobj/ICARUS/PMT/Trigger/Data/SingleChannelOpticalTriggerGate.h"
 
+// framework libraries
+#include "tbb/task_arena.h"
+#include "tbb/parallel_for.h"
+#include "tbb/blocked_range.h"
+
 // C/C++ standard libraries
 #include <ostream>
+#include <cstddef> // std::size_t
 
 
 //------------------------------------------------------------------------------
@@ -25,12 +31,52 @@ icarus::trigger::MultiChannelOpticalTriggerGate
 icarus::trigger::sumTriggerGates
   (std::vector<icarus::trigger::SingleChannelOpticalTriggerGate> const& gates)
 {
+  using TriggerGateData_t
+    = icarus::trigger::MultiChannelOpticalTriggerGate::GateData_t::GateData_t;
+  
   icarus::trigger::MultiChannelOpticalTriggerGate sum;
-  for (auto const& gate: gates) {
-    sum.Sum(gate);
-  } // for
+  
+  // all the gate levels are summed in a single sweep
+  sum.gateLevels() = TriggerGateData_t::Multiplicity(gates);
+  
+  for (auto const& gate: gates) sum.mergeWaveformsFromGate(gate);
+  
   return sum;
 } // icarus::trigger::sumTriggerGates()
 
 
+//------------------------------------------------------------------------------
+std::vector<icarus::trigger::MultiChannelOpticalTriggerGate>
+icarus::trigger::sumTriggerGatesByGroup(
+  std::vector<std::vector<icarus::trigger::SingleChannelOpticalTriggerGate>>
+    const& groups,
+  unsigned int nThreads /* = 0U */
+) {
+  
+  // each task writes only its own element, so the order is preserved
+  std::vector<icarus::trigger::MultiChannelOpticalTriggerGate> sums
+    (groups.size());
+  
+  tbb::task_arena arena{
+    (nThreads > 0U)
+      ? static_cast<int>(nThreads): int(tbb::task_arena::automatic)
+    };
+  arena.execute([&groups, &sums]()
+    {
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0U, groups.size()),
+        [&groups, &sums](tbb::blocked_range<std::size_t> const& range)
+        {
+          for (std::size_t iGroup = range.begin(); iGroup != range.end();
+            ++iGroup
+          ) {
+            sums[iGroup] = sumTriggerGates(groups[iGroup]);
+          }
+        }
+        );
+    });
+  
+  return sums;
+} // icarus::trigger::sumTriggerGatesByGroup()
+
+
 //------------------------------------------------------------------------------
@@ -19,6 +19,7 @@
 #include "lardataobj/RawData/OpDetWaveform.h"
 
 // C/C++ standard libraries
+#include <vector>
 #include <utility> // std::move()
 #include <iosfwd> // std::ostream
 
@@ -37,6 +38,25 @@ namespace icarus::trigger {
   MultiChannelOpticalTriggerGate sumTriggerGates
     (std::vector<SingleChannelOpticalTriggerGate> const& gates);
   
+  /**
+   * @brief Sums the gates of each group, processing groups in parallel.
+   * @param groups list of groups of gates, each to be summed
+   * @param nThreads maximum number of threads to use (`0`: no limit)
+   * @return the sum of the gates of each group, in the same order as `groups`
+   * @see `sumTriggerGates()`
+   * 
+   * Each group (e.g. all the gates of a cryostat with a given threshold) is
+   * summed with `sumTriggerGates()`, as a separate task in a TBB task arena.
+   * Since each sum is computed serially, the result is the same as calling
+   * `sumTriggerGates()` on each group in order.
+   * When running in a multi-threaded _art_ job, the tasks share the threads
+   * with the rest of the job, unless `nThreads` restricts them further.
+   */
+  std::vector<MultiChannelOpticalTriggerGate> sumTriggerGatesByGroup(
+    std::vector<std::vector<SingleChannelOpticalTriggerGate>> const& groups,
+    unsigned int nThreads = 0U
+    );
+  
   
   // ---------------------------------------------------------------------------
   
@@ -73,6 +93,9 @@ class icarus::trigger::MultiChannelOpticalTriggerGate
   /// Do not support single-channel interface.
   ChannelID_t channel() const = delete;
   
+  friend MultiChannelOpticalTriggerGate sumTriggerGates
+    (std::vector<SingleChannelOpticalTriggerGate> const& gates);
+  
 }; // class icarus::trigger::MultiChannelOpticalTriggerGate
 
 
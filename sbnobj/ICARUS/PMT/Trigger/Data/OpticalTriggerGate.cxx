@@ -12,7 +12,9 @@
 
 // C/C++ standard libraries
 #include <ostream>
-#include <algorithm> // std::inplace_merge(), std::unique(), ...
+#include <algorithm> // std::set_union(), std::lower_bound(), ...
+#include <iterator> // std::back_inserter()
+#include <functional> // std::less, std::plus, std::multiplies, std::mem_fn()
 
 
 //------------------------------------------------------------------------------
@@ -36,9 +38,14 @@ namespace {
     (raw::OpDetWaveform const& a, raw::OpDetWaveform const& b) const
     { return less(a, b); }
     
+    /// Returns whether `a < b`; equivalent waveforms are sorted by address.
     bool operator()
     (raw::OpDetWaveform const* a, raw::OpDetWaveform const* b) const
-    { return less(*a, *b); }
+    {
+      if (less(*a, *b)) return true;
+      if (less(*b, *a)) return false;
+      return std::less<raw::OpDetWaveform const*>()(a, b);
+    }
     
   }; // OpDetWaveformComp
   
@@ -55,43 +62,42 @@ void icarus::trigger::OpticalTriggerGate::registerWaveforms
 (Waveforms_t const& moreWaveforms)
 {
   //
-  // add channels
+  // add channels (extracted from a sorted list, they are sorted too)
   //
-  associateChannels(extractChannels(moreWaveforms));
+  associateSortedChannels(extractChannels(moreWaveforms));
 
   //
-  // merge the two lists, then sort them
+  // merge the two lists (duplicate pointers are not added)
   //
-  auto const middle = fWaveforms.insert
-    (fWaveforms.end(), moreWaveforms.begin(), moreWaveforms.end());
-  std::inplace_merge
-    (fWaveforms.begin(), middle, fWaveforms.end(), ::OpDetWaveformComp());
+  details::mergeSortedUniqueInto(
+    fWaveforms, moreWaveforms.begin(), moreWaveforms.end(),
+    ::OpDetWaveformComp()
+    );
 
-  // finally remove any duplicate (there should be none, should it?)
-  auto const actualEnd
-    = std::unique(fWaveforms.begin(), fWaveforms.end()); // pointer comparison
-  fWaveforms.erase(actualEnd, fWaveforms.end());
+} // OpticalTriggerGate::registerWaveforms()
 
 
-} // OpticalTriggerGate::registerWaveforms()
+//------------------------------------------------------------------------------
+void icarus::trigger::OpticalTriggerGate::registerWaveformIndices
+(WaveformIndices_t const& moreIndices)
+{
+  details::mergeSortedUniqueInto
+    (fWaveformIndices, moreIndices.begin(), moreIndices.end());
+} // OpticalTriggerGate::registerWaveformIndices()
 
 
 //------------------------------------------------------------------------------
 auto icarus::trigger::OpticalTriggerGate::mergeWaveforms
 (Waveforms_t const& a, Waveforms_t const& b) -> Waveforms_t
 {
+  // both lists are sorted and unique, and so is their union
   Waveforms_t merged;
   merged.reserve(a.size() + b.size());
-  std::merge(
+  std::set_union(
 	     a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(merged),
 	     ::OpDetWaveformComp()
 	     );
   
-  // finally remove any duplicate (there should be non, should it?)
-  auto const actualEnd
-    = std::unique(merged.begin(), merged.end()); // pointer comparison
-  merged.erase(actualEnd, merged.end());
-  
   return merged;
 } // icarus::trigger::OpticalTriggerGate::mergeWaveforms()
 
@@ -169,21 +175,77 @@ icarus::trigger::OpticalTriggerGate::SymmetricCombination(
 							  TriggerGateTicks_t bDelay /* = TriggerGateTicks_t{ 0 } */
 							  )
 {
-  return { 
-    GateData_t::SymmetricCombination
-      (std::forward<Op>(op), a, b, aDelay, bDelay),
-      OpticalTriggerGate::mergeWaveforms(a.waveforms(), b.waveforms())
-      };
+  OpticalTriggerGate combination;
+  combination.gateLevels() = GateData_t::SymmetricCombination
+    (std::forward<Op>(op), a, b, aDelay, bDelay);
+  combination.fWaveforms
+    = OpticalTriggerGate::mergeWaveforms(a.waveformList(), b.waveformList());
+  combination.fWaveformIndices.reserve
+    (a.waveformIndices().size() + b.waveformIndices().size());
+  std::set_union(
+    a.waveformIndices().begin(), a.waveformIndices().end(),
+    b.waveformIndices().begin(), b.waveformIndices().end(),
+    std::back_inserter(combination.fWaveformIndices)
+    );
+  return combination;
   
 } // icarus::trigger::OpticalTriggerGate::SymmetricCombination()
 
 
+//------------------------------------------------------------------------------
+icarus::trigger::OpticalTriggerGate icarus::trigger::OpticalTriggerGate::Min(
+  DelayedGate<OpticalTriggerGate> const& a,
+  DelayedGate<OpticalTriggerGate> const& b
+) {
+  return SymmetricCombination(
+    [](OpeningCount_t a, OpeningCount_t b){ return std::min(a, b); },
+    a.gate(), b.gate(), a.delay(), b.delay()
+    );
+} // icarus::trigger::OpticalTriggerGate::Min(DelayedGate)
+
+
+//------------------------------------------------------------------------------
+icarus::trigger::OpticalTriggerGate icarus::trigger::OpticalTriggerGate::Max(
+  DelayedGate<OpticalTriggerGate> const& a,
+  DelayedGate<OpticalTriggerGate> const& b
+) {
+  return SymmetricCombination(
+    [](OpeningCount_t a, OpeningCount_t b){ return std::max(a, b); },
+    a.gate(), b.gate(), a.delay(), b.delay()
+    );
+} // icarus::trigger::OpticalTriggerGate::Max(DelayedGate)
+
+
+//------------------------------------------------------------------------------
+icarus::trigger::OpticalTriggerGate icarus::trigger::OpticalTriggerGate::Sum(
+  DelayedGate<OpticalTriggerGate> const& a,
+  DelayedGate<OpticalTriggerGate> const& b
+) {
+  return SymmetricCombination
+    (std::plus<OpeningCount_t>(), a.gate(), b.gate(), a.delay(), b.delay());
+} // icarus::trigger::OpticalTriggerGate::Sum(DelayedGate)
+
+
+//------------------------------------------------------------------------------
+icarus::trigger::OpticalTriggerGate icarus::trigger::OpticalTriggerGate::Mul(
+  DelayedGate<OpticalTriggerGate> const& a,
+  DelayedGate<OpticalTriggerGate> const& b
+) {
+  return SymmetricCombination(
+    std::multiplies<OpeningCount_t>(),
+    a.gate(), b.gate(), a.delay(), b.delay()
+    );
+} // icarus::trigger::OpticalTriggerGate::Mul(DelayedGate)
+
+
 //------------------------------------------------------------------------------
 bool icarus::trigger::OpticalTriggerGate::operator==
 (OpticalTriggerGate const& other) const
 {
   return
-    (gateLevels() == other.gateLevels()) && (waveforms() == other.waveforms());
+    (gateLevels() == other.gateLevels())
+    && (waveformList() == other.waveformList())
+    && (waveformIndices() == other.waveformIndices());
 } // icarus::trigger::OpticalTriggerGate::operator==()
 
 
@@ -192,7 +254,9 @@ bool icarus::trigger::OpticalTriggerGate::operator!=
 (OpticalTriggerGate const& other) const
 {
   return
-    (gateLevels() != other.gateLevels()) || (waveforms() != other.waveforms());
+    (gateLevels() != other.gateLevels())
+    || (waveformList() != other.waveformList())
+    || (waveformIndices() != other.waveformIndices());
 } // icarus::trigger::OpticalTriggerGate::operator==()
 
 
@@ -211,6 +275,19 @@ bool icarus::trigger::OpticalTriggerGate::add
 } // icarus::trigger::OpticalTriggerGate::add()
 
 
+//------------------------------------------------------------------------------
+bool icarus::trigger::OpticalTriggerGate::insertWaveformIndex
+(WaveformIndex_t index)
+{
+  auto const insertionPoint = std::lower_bound
+    (fWaveformIndices.begin(), fWaveformIndices.end(), index);
+  if ((insertionPoint != fWaveformIndices.end()) && (*insertionPoint == index))
+    return false;
+  fWaveformIndices.insert(insertionPoint, index);
+  return true;
+} // icarus::trigger::OpticalTriggerGate::insertWaveformIndex()
+
+
 //------------------------------------------------------------------------------
 auto icarus::trigger::OpticalTriggerGate::extractChannels
 (Waveforms_t const& waveforms) -> GateData_t::ChannelList_t
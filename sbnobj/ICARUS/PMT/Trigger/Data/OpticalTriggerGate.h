@@ -22,6 +22,7 @@
 #include <iosfwd> // std::ostream
 #include <vector>
 #include <utility> // std::move()
+#include <cstdint> // std::int32_t, std::uint16_t, std::uint32_t
 
 
 //------------------------------------------------------------------------------
@@ -40,16 +41,67 @@ namespace icarus::trigger {
   using OpticalTriggerGateData_t = icarus::trigger::ReadoutTriggerGate
     <TriggerGateTick_t, TriggerGateTicks_t, raw::Channel_t>
     ;
+  
+  using CompactTriggerGateTick_t = std::int32_t; ///< Compact tick point.
+  using CompactTriggerGateTicks_t = std::int32_t; ///< Compact tick interval.
+  
+  /// Compact opening count (`std::uint16_t`).
+  using CompactTriggerGateOpeningCount_t = icarus::trigger::TriggerGateOpeningCount_t
+    <CompactTriggerGateTick_t, CompactTriggerGateTicks_t>;
+  
+  /**
+   * @brief Type of compact trigger gate level data (32-bit ticks, 16-bit
+   *        opening counts).
+   * 
+   * Each status of the gate takes 12 bytes instead of the 24 of
+   * `OpticalTriggerGateData_t::GateData_t`, with ticks limited to about
+   * two billions and openings limited to 65535.
+   * It can be stored in _art_ data products; since it carries no channel
+   * information, it is usually accompanied by an association or a parallel
+   * collection.
+   * Conversion from and to the standard gate level data is performed
+   * by `convertFrom()`, e.g.:
+   * @code
+   * auto const compact = icarus::trigger::CompactTriggerGateData_t::convertFrom
+   *   (gate.gateLevels());
+   * @endcode
+   */
+  using CompactTriggerGateData_t = icarus::trigger::TriggerGateData
+    <CompactTriggerGateTick_t, CompactTriggerGateTicks_t>;
 
 } // namespace icarus::trigger
 
 
+//
+// the gate types above are instantiated once, in `TriggerGateInstances.cxx`
+//
+extern template class icarus::trigger::TriggerGateData
+  <icarus::trigger::TriggerGateTick_t, icarus::trigger::TriggerGateTicks_t>;
+extern template class icarus::trigger::ReadoutTriggerGate<
+  icarus::trigger::TriggerGateTick_t, icarus::trigger::TriggerGateTicks_t,
+  raw::Channel_t
+  >;
+extern template class icarus::trigger::TriggerGateData<
+  icarus::trigger::CompactTriggerGateTick_t,
+  icarus::trigger::CompactTriggerGateTicks_t
+  >;
+
+
 //------------------------------------------------------------------------------
 /**
  * @brief Logical multi-level gate associated to one or more waveforms.
  * 
  * This object is a trigger gate associated with one or more optical waveforms.
  * 
+ * The waveforms are tracked by pointer (`waveformList()`), and optionally also
+ * by their index in the event waveform collection (`waveformIndices()`),
+ * when they are added together with their index (`add(waveform, index)`).
+ * Indices, unlike pointers, can be written into a data product and compared
+ * across threads and jobs, and their merging in combinations is a plain union
+ * of sorted integers.
+ * The conversion between indices and waveforms is performed by
+ * `icarus::trigger::WaveformIndexResolver`.
+ * 
  * @note This object should be parametrized with optical ticks
  *       (`detinfo::timescales::optical_tick`). But currently the quantities
  *       (`util::quantity` derived objects) are not well suited to be serialized
@@ -69,6 +121,12 @@ class icarus::trigger::OpticalTriggerGate
   
   using ChannelID_t = GateData_t::ChannelID_t; ///< Type of channel identifier.
   
+  /// Type of index of a waveform in the event waveform collection.
+  using WaveformIndex_t = std::uint32_t;
+  
+  /// Sorted list of unique waveform indices.
+  using WaveformIndices_t = std::vector<WaveformIndex_t>;
+  
   /// Constructor: a closed gate with no associated waveform (`add()` them).
   OpticalTriggerGate() = default;
   
@@ -83,6 +141,11 @@ class icarus::trigger::OpticalTriggerGate
     , fWaveforms({ &waveform })
     {}
 
+  /// Constructor: a closed gate for `waveform`, with index `index`.
+  OpticalTriggerGate(raw::OpDetWaveform const& waveform, WaveformIndex_t index)
+    : OpticalTriggerGate(waveform)
+    { fWaveformIndices.push_back(index); }
+
   /// Constructor: a closed gate for the specified channel.
  OpticalTriggerGate(ChannelID_t channel): GateData_t{ channel } {}
 
@@ -90,6 +153,23 @@ class icarus::trigger::OpticalTriggerGate
   /// Adds another waveform to the gate (unless it has already been added).
   bool add(raw::OpDetWaveform const& waveform);
 
+  /// Adds another waveform, with its index in the waveform collection.
+  /// @return whether the waveform was not already present
+  bool add(raw::OpDetWaveform const& waveform, WaveformIndex_t index)
+    { insertWaveformIndex(index); return add(waveform); }
+
+  /**
+   * @brief Adds the index of a waveform, without the waveform itself.
+   * @param index index of the waveform in the event waveform collection
+   * @param channel the channel of the waveform
+   * @return whether the index was not already present
+   * 
+   * This is the way to rebuild a gate from stored indices when the waveforms
+   * are not available; `waveformList()` is not affected.
+   */
+  bool addWaveformIndex(WaveformIndex_t index, ChannelID_t channel)
+    { addChannel(channel); return insertWaveformIndex(index); }
+
   //@{
   /// Copies/steals all the levels and channels from the specified data.
   OpticalTriggerGate& operator= (GateData_t const& data)
@@ -111,9 +191,23 @@ class icarus::trigger::OpticalTriggerGate
   
   /// Returns a list of pointers to the waveforms associated to the gate,
   /// sorted.
+  /// @see `waveformList()`
   std::vector<raw::OpDetWaveform const*> waveforms() const
     { return fWaveforms; }
   
+  /// Returns the sorted list of pointers to the waveforms associated to the
+  /// gate, without copying it.
+  std::vector<raw::OpDetWaveform const*> const& waveformList() const
+    { return fWaveforms; }
+  
+  /// Returns whether indices of waveforms have been registered in the gate.
+  bool hasWaveformIndices() const { return !fWaveformIndices.empty(); }
+  
+  /// Returns the sorted list of indices of the waveforms of the gate.
+  /// @see `icarus::trigger::WaveformIndexResolver`
+  WaveformIndices_t const& waveformIndices() const
+    { return fWaveformIndices; }
+  
   // --- END Query -------------------------------------------------------------
   
   
@@ -201,6 +295,34 @@ class icarus::trigger::OpticalTriggerGate
   static OpticalTriggerGate Mul
     (OpticalTriggerGate const& a, OpticalTriggerGate const& b);
 
+  //@{
+  /**
+   * @brief Returns a combination of two gates, each with its own delay.
+   * @param a first gate and its delay
+   * @param b second gate and its delay
+   * @return gate with at every tick the combination of the delayed openings,
+   *         associated to the waveforms of both gates
+   * @see `icarus::trigger::delayed()`,
+   *      `TriggerGateData::Min(DelayedGate, DelayedGate)`
+   */
+  static OpticalTriggerGate Min(
+    DelayedGate<OpticalTriggerGate> const& a,
+    DelayedGate<OpticalTriggerGate> const& b
+    );
+  static OpticalTriggerGate Max(
+    DelayedGate<OpticalTriggerGate> const& a,
+    DelayedGate<OpticalTriggerGate> const& b
+    );
+  static OpticalTriggerGate Sum(
+    DelayedGate<OpticalTriggerGate> const& a,
+    DelayedGate<OpticalTriggerGate> const& b
+    );
+  static OpticalTriggerGate Mul(
+    DelayedGate<OpticalTriggerGate> const& a,
+    DelayedGate<OpticalTriggerGate> const& b
+    );
+  //@}
+
 
   /**
    * @brief Returns a gate combination of the openings of two other gates.
@@ -242,12 +364,26 @@ class icarus::trigger::OpticalTriggerGate
     {}
   
   
-  /// Registers the waveforms from the specified list.
+  /**
+   * @brief Registers the waveforms from the specified list.
+   * @param moreWaveforms sorted list of the waveforms to be added
+   * 
+   * The list is merged into the existing one in a single pass, reusing its
+   * memory when possible. Waveforms already present are not added again.
+   */
   void registerWaveforms(Waveforms_t const& moreWaveforms);
   
-  /// Registers the waveforms from the `other` gate into this one.
+  /// Registers the indices from the specified sorted list.
+  void registerWaveformIndices(WaveformIndices_t const& moreIndices);
+  
+  /// Registers the waveforms (and their indices) from the `other` gate into
+  /// this one.
   void mergeWaveformsFromGate(OpticalTriggerGate const& other)
-  { registerWaveforms(other.waveforms()); }
+  {
+    if (&other == this) return;
+    registerWaveforms(other.waveformList());
+    registerWaveformIndices(other.waveformIndices());
+  }
   
   
   /// Registers the waveforms from the `other` gate into this one.
@@ -258,6 +394,13 @@ class icarus::trigger::OpticalTriggerGate
   /// List of waveforms involved in this channel.
   std::vector<raw::OpDetWaveform const*> fWaveforms;
   
+  /// Sorted indices of the waveforms, when known.
+  WaveformIndices_t fWaveformIndices;
+  
+  
+  /// Adds `index` to the sorted list of indices; returns whether it was new.
+  bool insertWaveformIndex(WaveformIndex_t index);
+  
   
   /// Returns the list of all channels from the `waveforms` (duplicate allowed).
   static GateData_t::ChannelList_t extractChannels
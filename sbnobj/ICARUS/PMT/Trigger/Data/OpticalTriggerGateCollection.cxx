@@ -0,0 +1,172 @@
+/**
+ * @file   sbnobj/ICARUS/PMT/Trigger/Data/OpticalTriggerGateCollection.cxx
+ * @brief  A collection of optical trigger gates sharing their memory.
+ * @date   October 14, 2026
+ * @see    `sbnobj/ICARUS/PMT/Trigger/Data/OpticalTriggerGateCollection.h`
+ *
+ */
+
+// class header
+#include "sbnobj/ICARUS/PMT/Trigger/Data/OpticalTriggerGateCollection.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::upper_bound(), std::lower_bound()
+#include <iterator> // std::prev()
+#include <cassert>
+
+
+//------------------------------------------------------------------------------
+//--- icarus::trigger::OpticalTriggerGateCollection::GateView
+//------------------------------------------------------------------------------
+auto icarus::trigger::OpticalTriggerGateCollection::GateView::openingCount
+  (ClockTick_t tick) const -> OpeningCount_t
+{
+  Range<Status_t> const gateStati = stati();
+  assert(!gateStati.empty()); // by construction we always have a first status
+  auto const iNext = std::upper_bound(
+    gateStati.begin(), gateStati.end(), tick,
+    [](ClockTick_t tick, Status_t const& status){ return tick < status.tick; }
+    );
+  return (iNext == gateStati.begin())
+    ? OpeningCount_t{ 0 }: std::prev(iNext)->opening;
+} // icarus::trigger::OpticalTriggerGateCollection::GateView::openingCount()
+
+
+//------------------------------------------------------------------------------
+auto icarus::trigger::OpticalTriggerGateCollection::GateView::findOpen(
+  OpeningCount_t minOpening /* = 1U */,
+  ClockTick_t start /* = MinTick */, ClockTick_t end /* = MaxTick */
+) const -> ClockTick_t
+{
+  Range<Status_t> const gateStati = stati();
+  auto iStatus = std::lower_bound(
+    gateStati.begin(), gateStati.end(), start,
+    [](Status_t const& status, ClockTick_t tick){ return status.tick < tick; }
+    );
+  for (; iStatus != gateStati.end(); ++iStatus) {
+    if (iStatus->tick >= end) break;
+    if (iStatus->opening >= minOpening) return iStatus->tick;
+  } // for
+  return end;
+} // icarus::trigger::OpticalTriggerGateCollection::GateView::findOpen()
+
+
+//------------------------------------------------------------------------------
+//--- icarus::trigger::OpticalTriggerGateCollection
+//------------------------------------------------------------------------------
+void icarus::trigger::OpticalTriggerGateCollection::reserve(
+  std::size_t nGates, std::size_t nStati,
+  std::size_t nChannels, std::size_t nWaveforms
+) {
+  fGates.reserve(nGates);
+  fStati.reserve(nStati);
+  fChannels.reserve(nChannels);
+  fWaveforms.reserve(nWaveforms);
+} // icarus::trigger::OpticalTriggerGateCollection::reserve()
+
+
+//------------------------------------------------------------------------------
+std::size_t icarus::trigger::OpticalTriggerGateCollection::add
+  (Gate_t const& gate)
+{
+  fGates.push_back({ fStati.size(), fChannels.size(), fWaveforms.size() });
+
+  auto const& gateLevels = gate.gateLevels().fGateLevel;
+  fStati.insert(fStati.end(), gateLevels.begin(), gateLevels.end());
+
+  auto const& channels = gate.channels();
+  fChannels.insert(fChannels.end(), channels.begin(), channels.end());
+
+  auto const& waveforms = gate.waveformList();
+  fWaveforms.insert(fWaveforms.end(), waveforms.begin(), waveforms.end());
+
+  return fGates.size() - 1U;
+} // icarus::trigger::OpticalTriggerGateCollection::add()
+
+
+//------------------------------------------------------------------------------
+void icarus::trigger::OpticalTriggerGateCollection::clear() {
+  fGates.clear();
+  fStati.clear();
+  fChannels.clear();
+  fWaveforms.clear();
+} // icarus::trigger::OpticalTriggerGateCollection::clear()
+
+
+//------------------------------------------------------------------------------
+auto icarus::trigger::OpticalTriggerGateCollection::gate
+  (std::size_t index) const -> Gate_t
+{
+  Gate_t gate;
+  gate = gateData(index);
+  // waveforms are sorted: each one is added at the end of the list
+  for (WaveformPtr_t const waveform: waveforms(index)) gate.add(*waveform);
+  return gate;
+} // icarus::trigger::OpticalTriggerGateCollection::gate()
+
+
+//------------------------------------------------------------------------------
+auto icarus::trigger::OpticalTriggerGateCollection::gateData
+  (std::size_t index) const -> GateData_t
+{
+  GateData_t data;
+  data.gateLevels() = levels(index);
+  // channels are sorted: each one is added at the end of the list
+  for (ChannelID_t const channel: channels(index)) data.addChannel(channel);
+  return data;
+} // icarus::trigger::OpticalTriggerGateCollection::gateData()
+
+
+//------------------------------------------------------------------------------
+auto icarus::trigger::OpticalTriggerGateCollection::toGateData() const
+  -> std::vector<GateData_t>
+{
+  std::vector<GateData_t> data;
+  data.reserve(size());
+  for (std::size_t iGate = 0; iGate < size(); ++iGate)
+    data.push_back(gateData(iGate));
+  return data;
+} // icarus::trigger::OpticalTriggerGateCollection::toGateData()
+
+
+//------------------------------------------------------------------------------
+auto icarus::trigger::OpticalTriggerGateCollection::stati
+  (std::size_t index) const -> Range<Status_t>
+{
+  std::size_t const next = (index + 1 < size())
+    ? fGates[index + 1].firstStatus: fStati.size();
+  return range(fStati, fGates[index].firstStatus, next);
+} // icarus::trigger::OpticalTriggerGateCollection::stati()
+
+
+//------------------------------------------------------------------------------
+auto icarus::trigger::OpticalTriggerGateCollection::channels
+  (std::size_t index) const -> Range<ChannelID_t>
+{
+  std::size_t const next = (index + 1 < size())
+    ? fGates[index + 1].firstChannel: fChannels.size();
+  return range(fChannels, fGates[index].firstChannel, next);
+} // icarus::trigger::OpticalTriggerGateCollection::channels()
+
+
+//------------------------------------------------------------------------------
+auto icarus::trigger::OpticalTriggerGateCollection::waveforms
+  (std::size_t index) const -> Range<WaveformPtr_t>
+{
+  std::size_t const next = (index + 1 < size())
+    ? fGates[index + 1].firstWaveform: fWaveforms.size();
+  return range(fWaveforms, fGates[index].firstWaveform, next);
+} // icarus::trigger::OpticalTriggerGateCollection::waveforms()
+
+
+//------------------------------------------------------------------------------
+auto icarus::trigger::OpticalTriggerGateCollection::levels
+  (std::size_t index) const -> TriggerGateData_t
+{
+  Range<Status_t> const gateStati = stati(index);
+  return TriggerGateData_t
+    { TriggerGateData_t::GateEvolution_t(gateStati.begin(), gateStati.end()) };
+} // icarus::trigger::OpticalTriggerGateCollection::levels()
+
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,215 @@
+/**
+ * @file   sbnobj/ICARUS/PMT/Trigger/Data/OpticalTriggerGateCollection.h
+ * @brief  A collection of optical trigger gates sharing their memory.
+ * @date   October 14, 2026
+ * @see    `sbnobj/ICARUS/PMT/Trigger/Data/OpticalTriggerGateCollection.cxx`
+ *
+ */
+
+#ifndef SBNOBJ_ICARUS_PMT_TRIGGER_DATA_OPTICALTRIGGERGATECOLLECTION_H
+#define SBNOBJ_ICARUS_PMT_TRIGGER_DATA_OPTICALTRIGGERGATECOLLECTION_H
+
+
+// ICARUS libraries
+#include "sbnobj/ICARUS/PMT/Trigger/Data/OpticalTriggerGate.h"
+
+// LArSoft libraries
+#include "lardataobj/RawData/OpDetWaveform.h"
+
+// C/C++ standard libraries
+#include <vector>
+#include <cstddef> // std::size_t
+
+
+//------------------------------------------------------------------------------
+namespace icarus::trigger { class OpticalTriggerGateCollection; }
+
+/**
+ * @brief A list of optical trigger gates with all their data in shared memory.
+ *
+ * A `std::vector<OpticalTriggerGate>` holds three small vectors per gate
+ * (gate stati, channels and waveforms), which means many small allocations
+ * each event. This collection keeps instead all the stati of all gates in a
+ * single list, and the same for channels and waveforms. The gates are
+ * accessed via lightweight views (`GateView`), which offer the most common
+ * queries.
+ *
+ * The collection can't be stored: the gates can be converted into the
+ * persistent type (`toGateData()`) or back into `OpticalTriggerGate` objects
+ * (`gate()`) when needed.
+ *
+ * `clear()` keeps the memory, so that a collection reused from event to event
+ * stops allocating after the first few events.
+ *
+ * Example:
+ * @code
+ * icarus::trigger::OpticalTriggerGateCollection gates;
+ * for (auto const& gate: inputGates) gates.add(gate);
+ * for (std::size_t iGate = 0; iGate < gates.size(); ++iGate) {
+ *   if (gates[iGate].findOpen(5U) == gates.MaxTick) continue;
+ *   // ...
+ * }
+ * std::vector<icarus::trigger::OpticalTriggerGateData_t> products
+ *   = gates.toGateData();
+ * @endcode
+ */
+class icarus::trigger::OpticalTriggerGateCollection {
+
+    public:
+
+  /// Type of gate being collected.
+  using Gate_t = icarus::trigger::OpticalTriggerGate;
+
+  /// Type of persistent gate data.
+  using GateData_t = icarus::trigger::OpticalTriggerGateData_t;
+
+  /// Type of gate level data.
+  using TriggerGateData_t = GateData_t::GateData_t;
+
+  using ClockTick_t = TriggerGateData_t::ClockTick_t; ///< Tick point.
+  using ChannelID_t = GateData_t::ChannelID_t; ///< Channel identifier.
+
+  /// Type of count of number of open channels.
+  using OpeningCount_t = TriggerGateData_t::OpeningCount_t;
+
+  /// Type of status of a gate.
+  using Status_t = details::TriggerGateStatus<ClockTick_t, OpeningCount_t>;
+
+  /// Type of pointer to an associated waveform.
+  using WaveformPtr_t = raw::OpDetWaveform const*;
+
+  /// An unbearably small tick number.
+  static constexpr ClockTick_t MinTick = TriggerGateData_t::MinTick;
+
+  /// An unbearably large tick number.
+  static constexpr ClockTick_t MaxTick = TriggerGateData_t::MaxTick;
+
+
+  /// A contiguous range of elements of the collection.
+  template <typename T>
+  class Range {
+    T const* fBegin = nullptr;
+    T const* fEnd = nullptr;
+
+      public:
+    Range(T const* begin, T const* end): fBegin(begin), fEnd(end) {}
+
+    T const* begin() const { return fBegin; }
+    T const* end() const { return fEnd; }
+    std::size_t size() const { return fEnd - fBegin; }
+    bool empty() const { return fBegin == fEnd; }
+    T const& operator[] (std::size_t i) const { return fBegin[i]; }
+  }; // Range
+
+
+  /// View of a gate in the collection, invalidated by adding more gates.
+  class GateView {
+
+    OpticalTriggerGateCollection const* fCollection;
+    std::size_t fIndex;
+
+      public:
+
+    GateView(OpticalTriggerGateCollection const& collection, std::size_t index)
+      : fCollection(&collection), fIndex(index) {}
+
+    /// Returns the index of this gate in the collection.
+    std::size_t index() const { return fIndex; }
+
+    /// Returns the time evolution of this gate.
+    Range<Status_t> stati() const { return fCollection->stati(fIndex); }
+
+    /// Returns the sorted list of channels associated to this gate.
+    Range<ChannelID_t> channels() const
+      { return fCollection->channels(fIndex); }
+
+    /// Returns the sorted list of waveforms associated to this gate.
+    Range<WaveformPtr_t> waveforms() const
+      { return fCollection->waveforms(fIndex); }
+
+    /// Returns the opening count of the gate at the specified `tick`.
+    /// @see `TriggerGateData::openingCount()`
+    OpeningCount_t openingCount(ClockTick_t tick) const;
+
+    /// Returns whether the gate is open at all at the specified `tick`.
+    bool isOpen(ClockTick_t tick) const { return openingCount(tick) > 0U; }
+
+    /// Returns the tick at which the gate opened.
+    /// @see `TriggerGateData::findOpen()`
+    ClockTick_t findOpen(
+      OpeningCount_t minOpening = 1U,
+      ClockTick_t start = MinTick, ClockTick_t end = MaxTick
+      ) const;
+
+  }; // GateView
+
+
+  /// Reserves memory for the specified number of elements.
+  void reserve(
+    std::size_t nGates, std::size_t nStati,
+    std::size_t nChannels, std::size_t nWaveforms
+    );
+
+  /// Adds a copy of the specified gate to the collection; returns its index.
+  std::size_t add(Gate_t const& gate);
+
+  /// Removes all the gates, keeping the allocated memory.
+  void clear();
+
+  /// Returns the number of gates in the collection.
+  std::size_t size() const { return fGates.size(); }
+
+  /// Returns whether there is no gate in the collection.
+  bool empty() const { return fGates.empty(); }
+
+  /// Returns a view of the gate with the specified index.
+  GateView operator[] (std::size_t index) const { return { *this, index }; }
+
+
+  /// Returns a copy of the gate with the specified index.
+  Gate_t gate(std::size_t index) const;
+
+  /// Returns the persistent data of the gate with the specified index.
+  GateData_t gateData(std::size_t index) const;
+
+  /// Returns the persistent data of all gates, in order.
+  std::vector<GateData_t> toGateData() const;
+
+
+    private:
+
+  /// Position of the data of a gate in the shared lists.
+  struct GateOffsets_t {
+    std::size_t firstStatus; ///< Index of the first status.
+    std::size_t firstChannel; ///< Index of the first channel.
+    std::size_t firstWaveform; ///< Index of the first waveform pointer.
+  }; // GateOffsets_t
+
+  std::vector<Status_t> fStati; ///< Stati of all gates.
+  std::vector<ChannelID_t> fChannels; ///< Channels of all gates.
+  std::vector<WaveformPtr_t> fWaveforms; ///< Waveforms of all gates.
+  std::vector<GateOffsets_t> fGates; ///< Where each gate starts.
+
+
+  //@{
+  /// Returns the data of the gate with the specified index.
+  Range<Status_t> stati(std::size_t index) const;
+  Range<ChannelID_t> channels(std::size_t index) const;
+  Range<WaveformPtr_t> waveforms(std::size_t index) const;
+  //@}
+
+  /// Returns the gate level data of the gate with the specified index.
+  TriggerGateData_t levels(std::size_t index) const;
+
+  /// Returns the elements of `data` from index `first` to `next` (excluded).
+  template <typename T>
+  Range<T> range
+    (std::vector<T> const& data, std::size_t first, std::size_t next) const
+    { return { data.data() + first, data.data() + next }; }
+
+}; // class icarus::trigger::OpticalTriggerGateCollection
+
+
+//------------------------------------------------------------------------------
+
+#endif // SBNOBJ_ICARUS_PMT_TRIGGER_DATA_OPTICALTRIGGERGATECOLLECTION_H
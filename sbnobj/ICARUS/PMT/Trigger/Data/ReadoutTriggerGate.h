@@ -13,6 +13,7 @@
 
 // ICARUS libraries
 #include "sbnobj/ICARUS/PMT/Trigger/Data/TriggerGateData.h"
+#include "sbnobj/ICARUS/PMT/Trigger/Data/ChannelBitmap.h"
 
 
 // LArSoft libraries
@@ -24,6 +25,7 @@
 #include <string>
 #include <stdexcept> // std::runtime_error
 #include <utility> // std::move()
+#include <functional> // std::less<>
 #include <cstddef> // std::size_t
 
 
@@ -77,6 +79,52 @@ namespace icarus::trigger {
   template <typename Gate>
     constexpr bool isReadoutTriggerGate_v = isReadoutTriggerGate<Gate>::value;
   
+  namespace details {
+    
+    /**
+     * @brief Merges the sorted range `b` to `e` into the sorted `dest`.
+     * @tparam T type of the elements
+     * @tparam Iter type of bidirectional iterator to the elements to add
+     * @tparam Comp type of the strict ordering of the elements
+     * @param dest sorted list with no duplicates, where to add elements
+     * @param b iterator to the first element to add
+     * @param e iterator past the last element to add
+     * @param comp ordering of the elements (also used for equivalence)
+     * 
+     * The result in `dest` is the sorted union of the two lists, with no
+     * duplicates (also the ones in the added range are removed).
+     * The union is performed in place in a single linear pass, from the end
+     * backward, so that the only allocation happens when `dest` needs to grow
+     * beyond its current capacity.
+     */
+    template <typename T, typename Iter, typename Comp = std::less<>>
+    void mergeSortedUniqueInto
+      (std::vector<T>& dest, Iter b, Iter e, Comp comp = {});
+    
+    /**
+     * @brief Channel ID and channel list types for a `ChannelIDType` policy.
+     * @tparam ChannelIDType the channel ID type of `ReadoutTriggerGate`
+     * 
+     * By default, `ChannelIDType` is the channel ID and the channels are
+     * stored in a sorted `std::vector`. With the `BitmapChannelID` policy, the
+     * channels are stored in a `ChannelBitmap` instead.
+     */
+    template <typename ChannelIDType>
+    struct ReadoutChannelTraits {
+      using ChannelID_t = ChannelIDType;
+      using ChannelList_t = std::vector<ChannelID_t>;
+      static constexpr bool isBitmap = false;
+    }; // ReadoutChannelTraits
+    
+    template <std::size_t NChannels, typename ChannelID>
+    struct ReadoutChannelTraits<BitmapChannelID<NChannels, ChannelID>> {
+      using ChannelID_t = ChannelID;
+      using ChannelList_t = ChannelBitmap<NChannels, ChannelID>;
+      static constexpr bool isBitmap = true;
+    }; // ReadoutChannelTraits<BitmapChannelID>
+    
+  } // namespace details
+  
 } // namespace icarus::trigger
 
 
@@ -90,6 +138,13 @@ namespace icarus::trigger {
  * This object is a trigger gate associated with one or more readout channels.
  * The channels are expressed as channel identifiers.
  * 
+ * By default the channels are kept in a sorted vector of `ChannelIDType`.
+ * If `ChannelIDType` is `icarus::trigger::BitmapChannelID<N, ID>`, channel
+ * IDs are of type `ID` and are stored in a fixed-size bitmap
+ * (`icarus::trigger::ChannelBitmap<N, ID>`), which makes channel merging in
+ * gate combinations word-parallel; only channels smaller than `N` can then be
+ * associated. Only the default representation is meant for persistency.
+ * 
  * @note This object should be parametrized with optical ticks
  *       (`detinfo::timescales::optical_tick`). But currently the quantities
  *       (`util::quantity` derived objects) are not well suited to be serialized
@@ -115,13 +170,16 @@ template <typename Tick, typename TickInterval, typename ChannelIDType>
   
   using ClockTick_t = Tick; ///< Tick point.
   using ClockTicks_t = TickInterval; ///< Tick interval.
-  using ChannelID_t = ChannelIDType; ///< Type of stored channel ID.
+  /// Type of stored channel ID.
+  using ChannelID_t
+    = typename details::ReadoutChannelTraits<ChannelIDType>::ChannelID_t;
   
   /// Type for gate data access.
   using GateData_t = Base_t;
   
   /// Type of list of associated channels.
-  using ChannelList_t = std::vector<ChannelID_t>;
+  using ChannelList_t
+    = typename details::ReadoutChannelTraits<ChannelIDType>::ChannelList_t;
   
   
   /// Constructor: a closed gate with no associated channels
@@ -260,6 +318,35 @@ template <typename Tick, typename TickInterval, typename ChannelIDType>
    */
   ReadoutTriggerGate& Mul(ReadoutTriggerGate const& other);
 
+  //@{
+  /**
+   * @brief Combines with a gate, using the memory of `buffer` for the result.
+   * @param other gate to combine to
+   * @param buffer caller-owned scratch memory
+   * @return this object
+   * @see `TriggerGateData::Sum(TriggerGateData const&, CombinationBuffer&)`
+   * 
+   * These are equivalent to the single argument versions, but reuse the memory
+   * of `buffer` as the `TriggerGateData` operations with a buffer do.
+   */
+  ReadoutTriggerGate& Min(
+    ReadoutTriggerGate const& other,
+    typename GateData_t::CombinationBuffer& buffer
+    );
+  ReadoutTriggerGate& Max(
+    ReadoutTriggerGate const& other,
+    typename GateData_t::CombinationBuffer& buffer
+    );
+  ReadoutTriggerGate& Sum(
+    ReadoutTriggerGate const& other,
+    typename GateData_t::CombinationBuffer& buffer
+    );
+  ReadoutTriggerGate& Mul(
+    ReadoutTriggerGate const& other,
+    typename GateData_t::CombinationBuffer& buffer
+    );
+  //@}
+
   /**
    * @brief Returns a gate with the minimum opening between the specified two.
    * @param a first gate
@@ -304,6 +391,34 @@ template <typename Tick, typename TickInterval, typename ChannelIDType>
   static ReadoutTriggerGate Mul
     (ReadoutTriggerGate const& a, ReadoutTriggerGate const& b);
 
+  //@{
+  /**
+   * @brief Returns a combination of two gates, each with its own delay.
+   * @param a first gate and its delay
+   * @param b second gate and its delay
+   * @return gate with at every tick the combination of the delayed openings,
+   *         associated to the channels of both gates
+   * @see `icarus::trigger::delayed()`,
+   *      `TriggerGateData::Min(DelayedGate, DelayedGate)`
+   */
+  static ReadoutTriggerGate Min(
+    DelayedGate<ReadoutTriggerGate> const& a,
+    DelayedGate<ReadoutTriggerGate> const& b
+    );
+  static ReadoutTriggerGate Max(
+    DelayedGate<ReadoutTriggerGate> const& a,
+    DelayedGate<ReadoutTriggerGate> const& b
+    );
+  static ReadoutTriggerGate Sum(
+    DelayedGate<ReadoutTriggerGate> const& a,
+    DelayedGate<ReadoutTriggerGate> const& b
+    );
+  static ReadoutTriggerGate Mul(
+    DelayedGate<ReadoutTriggerGate> const& a,
+    DelayedGate<ReadoutTriggerGate> const& b
+    );
+  //@}
+
 
   /**
    * @brief Returns a gate combination of the openings of two other gates.
@@ -358,10 +473,22 @@ template <typename Tick, typename TickInterval, typename ChannelIDType>
   void associateChannels(ChannelList_t const& moreChannels);
   //@}
   
+  /// Associates this data with the channels from the specified sorted list.
+  void associateSortedChannels(ChannelList_t const& moreChannels)
+  {
+    mergeSortedChannelsInto
+      (fChannels, moreChannels.begin(), moreChannels.end());
+  }
+  
   /// Associates this data with the channels from the `other` gate.
   void associateChannelsFromGate(ReadoutTriggerGate const& other)
-  { associateChannels(other.channels()); }
+  {
+    if (&other == this) return;
+    if constexpr (BitmapChannels) fChannels |= other.fChannels;
+    else associateSortedChannels(other.channels());
+  }
   
+  /// Adds the sorted channels from `b` to `e` into `channels` (returned).
   template <typename BIter, typename EIter>
   static ChannelList_t& mergeSortedChannelsInto
     (ChannelList_t& channels, BIter b, EIter e);
@@ -388,6 +515,10 @@ template <typename Tick, typename TickInterval, typename ChannelIDType>
   
   private:
   
+  /// Whether channels are stored in a `ChannelBitmap`.
+  static constexpr bool BitmapChannels
+    = details::ReadoutChannelTraits<ChannelIDType>::isBitmap;
+  
   /// List of readout channels associated to this data.
   ChannelList_t fChannels;
   
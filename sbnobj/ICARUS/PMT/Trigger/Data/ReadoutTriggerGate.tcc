@@ -12,9 +12,10 @@
 // C/C++ standard libraries
 #include <ostream>
 #include <string> // std::to_string()
-#include <algorithm> // std::unique(), std::lower_bound(), std::sort()...
-#include <iterator> // std::next()
+#include <algorithm> // std::unique(), std::lower_bound(), std::set_union()...
+#include <iterator> // std::prev(), std::distance(), std::back_inserter()
 #include <type_traits> // std::is_base_of_v, std::enable_if_t, std::decay_t
+#include <functional> // std::plus<>, std::multiplies<>
 
 
 // make "sure" this header is not included directly
@@ -68,10 +69,15 @@ template <typename Tick, typename TickInterval, typename ChannelIDType>
 auto icarus::trigger::ReadoutTriggerGate<Tick, TickInterval, ChannelIDType>::addChannel
   (ChannelID_t const channel) -> This_t&
 {
-  auto const iNearest
-    = std::lower_bound(fChannels.begin(), fChannels.end(), channel);
-  if ((iNearest == fChannels.end()) || (*iNearest != channel))
-    fChannels.insert(iNearest, channel);
+  if constexpr (BitmapChannels) {
+    fChannels.insert(channel);
+  }
+  else {
+    auto const iNearest
+      = std::lower_bound(fChannels.begin(), fChannels.end(), channel);
+    if ((iNearest == fChannels.end()) || (*iNearest != channel))
+      fChannels.insert(iNearest, channel);
+  }
   return *this;
 } // icarus::trigger::ReadoutTriggerGate<>::addChannel()
 
@@ -81,10 +87,15 @@ template <typename Tick, typename TickInterval, typename ChannelIDType>
 auto icarus::trigger::ReadoutTriggerGate<Tick, TickInterval, ChannelIDType>::removeChannel
   (ChannelID_t const channel) -> This_t&
 {
-  auto const iNearest
-    = std::lower_bound(fChannels.begin(), fChannels.end(), channel);
-  if ((iNearest != fChannels.end()) && (*iNearest == channel))
-    fChannels.erase(iNearest);
+  if constexpr (BitmapChannels) {
+    fChannels.erase(channel);
+  }
+  else {
+    auto const iNearest
+      = std::lower_bound(fChannels.begin(), fChannels.end(), channel);
+    if ((iNearest != fChannels.end()) && (*iNearest == channel))
+      fChannels.erase(iNearest);
+  }
   return *this;
 } // icarus::trigger::ReadoutTriggerGate<>::removeChannel()
 
@@ -136,7 +147,7 @@ auto
 icarus::trigger::ReadoutTriggerGate<Tick, TickInterval, ChannelIDType>::normalizeChannels
   (ChannelList_t& channels) -> ChannelList_t&
 {
-  std::sort(channels.begin(), channels.end());
+  if constexpr (!BitmapChannels) std::sort(channels.begin(), channels.end());
   return normalizeSortedChannels(channels);
 } // icarus::trigger::ReadoutTriggerGate<>::normalizeChannels()
 
@@ -147,7 +158,7 @@ auto
 icarus::trigger::ReadoutTriggerGate<Tick, TickInterval, ChannelIDType>::normalizeChannels
   (ChannelList_t&& channels) -> ChannelList_t
 {
-  std::sort(channels.begin(), channels.end());
+  if constexpr (!BitmapChannels) std::sort(channels.begin(), channels.end());
   normalizeSortedChannels(channels);
   return std::move(channels);
 } // icarus::trigger::ReadoutTriggerGate<>::normalizeChannels()
@@ -159,10 +170,12 @@ auto
 icarus::trigger::ReadoutTriggerGate<Tick, TickInterval, ChannelIDType>::normalizeSortedChannels
   (ChannelList_t& channels) -> ChannelList_t&
 {
-  // move non-unique elements to the end, and delete them afterwards
-  channels.erase
-    (std::unique(channels.begin(), channels.end()), channels.end());
-  channels.shrink_to_fit();
+  if constexpr (!BitmapChannels) { // a bitmap is always sorted and unique
+    // move non-unique elements to the end, and delete them afterwards
+    channels.erase
+      (std::unique(channels.begin(), channels.end()), channels.end());
+    channels.shrink_to_fit();
+  }
   return channels;
 } // icarus::trigger::ReadoutTriggerGate<>::normalizeChannels()
 
@@ -174,13 +187,9 @@ auto
 icarus::trigger::ReadoutTriggerGate<Tick, TickInterval, ChannelIDType>::mergeSortedChannelsInto
   (ChannelList_t& channels, BIter b, EIter e) -> ChannelList_t&
 {
-  // non-optimized implementation:
-  std::size_t nOrigChannels = channels.size();
-  channels.insert(channels.end(), b, e);
-  std::inplace_merge(
-    channels.begin(), std::next(channels.begin(), nOrigChannels), channels.end()
-    );
-  return normalizeSortedChannels(channels);
+  if constexpr (BitmapChannels) channels.insert(b, e);
+  else details::mergeSortedUniqueInto(channels, b, e);
+  return channels;
 } // icarus::trigger::ReadoutTriggerGate<>::mergeSortedChannelsInto()
 
 
@@ -191,9 +200,15 @@ auto
 icarus::trigger::ReadoutTriggerGate<Tick, TickInterval, ChannelIDType>::mergeChannelsInto
   (ChannelList_t& channels, BIter b, EIter e) -> ChannelList_t&
 {
-  // non-optimized implementation:
-  channels.insert(channels.end(), b, e);
-  return normalizeChannels(channels);
+  if constexpr (BitmapChannels) {
+    channels.insert(b, e);
+    return channels;
+  }
+  else {
+    // non-optimized implementation:
+    channels.insert(channels.end(), b, e);
+    return normalizeChannels(channels);
+  }
 } // icarus::trigger::ReadoutTriggerGate<>::mergeChannelsInto()
 
 
@@ -203,9 +218,17 @@ auto
 icarus::trigger::ReadoutTriggerGate<Tick, TickInterval, ChannelIDType>::mergeChannels
   (ChannelList_t const& a, ChannelList_t const& b) -> ChannelList_t
 {
-  // non-optimized implementation:
-  ChannelID_t merged { a };
-  return mergeChannelsInto(a, b.begin(), b.end());
+  if constexpr (BitmapChannels) {
+    return a | b;
+  }
+  else {
+    // both lists are sorted and unique already
+    ChannelList_t merged;
+    merged.reserve(a.size() + b.size());
+    std::set_union
+      (a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(merged));
+    return merged;
+  }
 } // icarus::trigger::ReadoutTriggerGate<>::mergeChannels()
 
 
@@ -215,7 +238,7 @@ auto icarus::trigger::ReadoutTriggerGate<Tick, TickInterval, ChannelIDType>::Min
   (This_t const& other) -> This_t& 
 {
   GateData_t::Min(other);
-  associateChannels(other.channels());
+  associateChannelsFromGate(other);
   return *this;
 } // icarus::trigger::ReadoutTriggerGate<>::Min()
 
@@ -226,7 +249,7 @@ auto icarus::trigger::ReadoutTriggerGate<Tick, TickInterval, ChannelIDType>::Max
   (This_t const& other) -> This_t& 
 {
   GateData_t::Max(other);
-  associateChannels(other.channels());
+  associateChannelsFromGate(other);
   return *this;
 } // icarus::trigger::ReadoutTriggerGate<>::Max()
 
@@ -237,7 +260,7 @@ auto icarus::trigger::ReadoutTriggerGate<Tick, TickInterval, ChannelIDType>::Sum
   (This_t const& other) -> This_t& 
 {
   GateData_t::Sum(other);
-  associateChannels(other.channels());
+  associateChannelsFromGate(other);
   return *this;
 } // icarus::trigger::ReadoutTriggerGate<>::Sum()
 
@@ -248,11 +271,59 @@ auto icarus::trigger::ReadoutTriggerGate<Tick, TickInterval, ChannelIDType>::Mul
   (This_t const& other) -> This_t& 
 {
   GateData_t::Mul(other);
-  associateChannels(other.channels());
+  associateChannelsFromGate(other);
   return *this;
 } // icarus::trigger::ReadoutTriggerGate<>::Mul()
 
 
+//------------------------------------------------------------------------------
+template <typename Tick, typename TickInterval, typename ChannelIDType>
+auto icarus::trigger::ReadoutTriggerGate<Tick, TickInterval, ChannelIDType>::Min
+  (This_t const& other, typename GateData_t::CombinationBuffer& buffer)
+  -> This_t&
+{
+  GateData_t::Min(other, buffer);
+  associateChannelsFromGate(other);
+  return *this;
+} // icarus::trigger::ReadoutTriggerGate<>::Min(buffer)
+
+
+//------------------------------------------------------------------------------
+template <typename Tick, typename TickInterval, typename ChannelIDType>
+auto icarus::trigger::ReadoutTriggerGate<Tick, TickInterval, ChannelIDType>::Max
+  (This_t const& other, typename GateData_t::CombinationBuffer& buffer)
+  -> This_t&
+{
+  GateData_t::Max(other, buffer);
+  associateChannelsFromGate(other);
+  return *this;
+} // icarus::trigger::ReadoutTriggerGate<>::Max(buffer)
+
+
+//------------------------------------------------------------------------------
+template <typename Tick, typename TickInterval, typename ChannelIDType>
+auto icarus::trigger::ReadoutTriggerGate<Tick, TickInterval, ChannelIDType>::Sum
+  (This_t const& other, typename GateData_t::CombinationBuffer& buffer)
+  -> This_t&
+{
+  GateData_t::Sum(other, buffer);
+  associateChannelsFromGate(other);
+  return *this;
+} // icarus::trigger::ReadoutTriggerGate<>::Sum(buffer)
+
+
+//------------------------------------------------------------------------------
+template <typename Tick, typename TickInterval, typename ChannelIDType>
+auto icarus::trigger::ReadoutTriggerGate<Tick, TickInterval, ChannelIDType>::Mul
+  (This_t const& other, typename GateData_t::CombinationBuffer& buffer)
+  -> This_t&
+{
+  GateData_t::Mul(other, buffer);
+  associateChannelsFromGate(other);
+  return *this;
+} // icarus::trigger::ReadoutTriggerGate<>::Mul(buffer)
+
+
 //------------------------------------------------------------------------------
 template <typename Tick, typename TickInterval, typename ChannelIDType>
 auto icarus::trigger::ReadoutTriggerGate<Tick, TickInterval, ChannelIDType>::Min
@@ -291,15 +362,73 @@ icarus::trigger::ReadoutTriggerGate<Tick, TickInterval, ChannelIDType>::Symmetri
   ClockTicks_t bDelay /* = ClockTicks_t{ 0 } */
   ) -> This_t
 {
-  return {
-    GateData_t::SymmetricCombination
-      (std::forward<Op>(op), a, b, aDelay, bDelay),
-    mergeChannels(a.channels(), b.channels())
-  };
+  This_t combination;
+  combination.gateLevels() = GateData_t::SymmetricCombination
+    (std::forward<Op>(op), a, b, aDelay, bDelay);
+  combination.fChannels = mergeChannels(a.channels(), b.channels());
+  return combination;
   
 } // icarus::trigger::ReadoutTriggerGate<>::SymmetricCombination()
 
 
+//------------------------------------------------------------------------------
+template <typename Tick, typename TickInterval, typename ChannelIDType>
+auto icarus::trigger::ReadoutTriggerGate<Tick, TickInterval, ChannelIDType>::Min(
+  DelayedGate<ReadoutTriggerGate> const& a,
+  DelayedGate<ReadoutTriggerGate> const& b
+) -> This_t
+{
+  using OpeningCount_t = typename GateData_t::OpeningCount_t;
+  return SymmetricCombination(
+    [](OpeningCount_t a, OpeningCount_t b){ return std::min(a, b); },
+    a.gate(), b.gate(), a.delay(), b.delay()
+    );
+} // icarus::trigger::ReadoutTriggerGate<>::Min(DelayedGate)
+
+
+//------------------------------------------------------------------------------
+template <typename Tick, typename TickInterval, typename ChannelIDType>
+auto icarus::trigger::ReadoutTriggerGate<Tick, TickInterval, ChannelIDType>::Max(
+  DelayedGate<ReadoutTriggerGate> const& a,
+  DelayedGate<ReadoutTriggerGate> const& b
+) -> This_t
+{
+  using OpeningCount_t = typename GateData_t::OpeningCount_t;
+  return SymmetricCombination(
+    [](OpeningCount_t a, OpeningCount_t b){ return std::max(a, b); },
+    a.gate(), b.gate(), a.delay(), b.delay()
+    );
+} // icarus::trigger::ReadoutTriggerGate<>::Max(DelayedGate)
+
+
+//------------------------------------------------------------------------------
+template <typename Tick, typename TickInterval, typename ChannelIDType>
+auto icarus::trigger::ReadoutTriggerGate<Tick, TickInterval, ChannelIDType>::Sum(
+  DelayedGate<ReadoutTriggerGate> const& a,
+  DelayedGate<ReadoutTriggerGate> const& b
+) -> This_t
+{
+  using OpeningCount_t = typename GateData_t::OpeningCount_t;
+  return SymmetricCombination
+    (std::plus<OpeningCount_t>(), a.gate(), b.gate(), a.delay(), b.delay());
+} // icarus::trigger::ReadoutTriggerGate<>::Sum(DelayedGate)
+
+
+//------------------------------------------------------------------------------
+template <typename Tick, typename TickInterval, typename ChannelIDType>
+auto icarus::trigger::ReadoutTriggerGate<Tick, TickInterval, ChannelIDType>::Mul(
+  DelayedGate<ReadoutTriggerGate> const& a,
+  DelayedGate<ReadoutTriggerGate> const& b
+) -> This_t
+{
+  using OpeningCount_t = typename GateData_t::OpeningCount_t;
+  return SymmetricCombination(
+    std::multiplies<OpeningCount_t>(),
+    a.gate(), b.gate(), a.delay(), b.delay()
+    );
+} // icarus::trigger::ReadoutTriggerGate<>::Mul(DelayedGate)
+
+
 //------------------------------------------------------------------------------
 template <typename Tick, typename TickInterval, typename ChannelIDType>
 bool icarus::trigger::ReadoutTriggerGate<Tick, TickInterval, ChannelIDType>::operator==
@@ -364,6 +493,49 @@ namespace icarus::trigger {
 } // namespace icarus::trigger
 
 
+//------------------------------------------------------------------------------
+template <typename T, typename Iter, typename Comp /* = std::less<> */>
+void icarus::trigger::details::mergeSortedUniqueInto
+  (std::vector<T>& dest, Iter b, Iter e, Comp comp /* = {} */)
+{
+  /*
+   * The merged list is written from the back of `dest`, which is first
+   * extended to fit all the new elements. The writing position is always
+   * after the next element of `dest` to be read, so no element is overwritten
+   * before it's moved. Duplicates leave a gap between the original elements
+   * which were not moved and the merged ones, which is removed at the end.
+   */
+  std::size_t const nAdd = std::distance(b, e);
+  if (nAdd == 0) return;
+  
+  std::size_t iDest = dest.size();
+  std::size_t const end = iDest + nAdd;
+  dest.resize(end);
+  std::size_t iWrite = end;
+  
+  auto const write = [&dest,&iWrite,end,&comp](T const& value)
+    {
+      if ((iWrite < end) && !comp(value, dest[iWrite])) return; // duplicate
+      dest[--iWrite] = value;
+    };
+  
+  while (e != b) {
+    auto const iAdd = std::prev(e);
+    if ((iDest > 0) && comp(*iAdd, dest[iDest - 1])) write(dest[--iDest]);
+    else { write(*iAdd); e = iAdd; }
+  } // while
+  
+  // the rest of `dest` is in place, unless duplicate of the last written one
+  while (iDest > 0) {
+    if ((iWrite == iDest) && comp(dest[iDest - 1], dest[iWrite])) break;
+    write(dest[--iDest]);
+  } // while
+  
+  dest.erase(dest.begin() + iDest, dest.begin() + iWrite);
+  
+} // icarus::trigger::details::mergeSortedUniqueInto()
+
+
 //------------------------------------------------------------------------------
 
 #endif // SBNOBJ_ICARUS_PMT_TRIGGER_DATA_READOUTTRIGGERGATE_H
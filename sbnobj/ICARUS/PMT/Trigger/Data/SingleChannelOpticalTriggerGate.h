@@ -75,6 +75,14 @@ class icarus::trigger::SingleChannelOpticalTriggerGate
   /// Adds another waveform to the channel (unless it has just been added).
   bool add(raw::OpDetWaveform const& waveform);
   
+  /// Adds another waveform to the channel, with its index in the collection.
+  bool add(raw::OpDetWaveform const& waveform, WaveformIndex_t index)
+    {
+      bool const added = add(waveform); // checks the channel
+      registerWaveformIndices({ index });
+      return added;
+    }
+  
   //@{
   /// Copies/steals all the levels from the specified data.
   SingleChannelOpticalTriggerGate& operator= (GateData_t const& data)
@@ -0,0 +1,300 @@
+/**
+ * @file   sbnobj/ICARUS/PMT/Trigger/Data/SlidingWindowTriggerGate.h
+ * @brief  Incremental sum of trigger gates in a sliding window.
+ * @date   October 14, 2026
+ *
+ * This is a header-only library.
+ */
+
+#ifndef SBNOBJ_ICARUS_PMT_TRIGGER_DATA_SLIDINGWINDOWTRIGGERGATE_H
+#define SBNOBJ_ICARUS_PMT_TRIGGER_DATA_SLIDINGWINDOWTRIGGERGATE_H
+
+
+// ICARUS libraries
+#include "sbnobj/ICARUS/PMT/Trigger/Data/ReadoutTriggerGate.h"
+
+// C/C++ standard libraries
+#include <vector>
+#include <string> // std::to_string()
+#include <algorithm> // std::upper_bound(), std::lower_bound(), ...
+#include <utility> // std::swap(), std::pair
+#include <cstddef> // std::size_t
+
+
+//------------------------------------------------------------------------------
+namespace icarus::trigger {
+
+  template <typename Tick, typename TickInterval, typename ChannelIDType>
+  class SlidingWindowTriggerGate;
+
+} // namespace icarus::trigger
+
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Sum of the gates in a window, updated one gate at a time.
+ * @tparam Tick type used to count the ticks
+ * @tparam TickInterval type used to quantify tick difference
+ * @tparam ChannelIDType type of channel ID
+ *
+ * This object keeps track of the sum of the openings of a set of
+ * `icarus::trigger::ReadoutTriggerGate` gates (the "window"). Gates can be
+ * added to and removed from the window at any time, and the sum of the
+ * gates currently in the window is available via `gate()`.
+ *
+ * It is designed for the common pattern of a window sliding over a list of
+ * gates (e.g. the gates of pairs of PMT), where two adjacent windows share
+ * most of their gates: moving the window by one position with `slide()`
+ * costs one addition and one removal, instead of the sum of all the gates
+ * in the new window.
+ *
+ * Internally, the window is stored as the list of the changes of opening
+ * ("deltas"), sorted by tick. Adding or removing a gate merges its own
+ * deltas (with a sign) into that list in a single linear pass, with no
+ * allocation after the first few operations.
+ *
+ * Example, for a majority of 5 in windows of 6 gates:
+ * @code
+ * icarus::trigger::SlidingWindowTriggerGate<TK, TI, ChannelID> window;
+ * for (std::size_t i = 0; i < gates.size(); ++i) {
+ *   if (i >= 6) window.slide(gates[i - 6], gates[i]);
+ *   else        window.add(gates[i]);
+ *   if (i + 1 < 6) continue;
+ *   auto const windowGate = window.gate();
+ *   auto const triggerTick = windowGate.findOpen(5U);
+ *   // ...
+ * }
+ * @endcode
+ *
+ * The gate returned by `gate()` has the same opening at each tick as the sum
+ * of all the gates in the window, and it's associated to all their channels.
+ * Its evolution is also the same that summing all the gates with `Sum()`
+ * would produce.
+ */
+template <typename Tick, typename TickInterval, typename ChannelIDType>
+class icarus::trigger::SlidingWindowTriggerGate {
+
+    public:
+
+  /// Type of gates this window combines.
+  using Gate_t = icarus::trigger::ReadoutTriggerGate
+    <Tick, TickInterval, ChannelIDType>;
+
+  using ClockTick_t = typename Gate_t::ClockTick_t; ///< Tick point.
+  using ChannelID_t = typename Gate_t::ChannelID_t; ///< Channel ID type.
+
+  /// Type of count of number of open channels.
+  using OpeningCount_t = typename Gate_t::OpeningCount_t;
+
+  /// Type representing a variation of open channels.
+  using OpeningDiff_t = typename Gate_t::OpeningDiff_t;
+
+
+  /// Adds the openings and channels of `gate` to the window.
+  void add(Gate_t const& gate) { mergeGate(gate, +1); addChannels(gate); }
+
+  /**
+   * @brief Removes the openings and channels of `gate` from the window.
+   * @throw ReadoutTriggerGateError if any of the channels of `gate` is not in
+   *        the window
+   *
+   * The gate must have been previously added with `add()`.
+   */
+  void remove(Gate_t const& gate)
+    { removeChannels(gate); mergeGate(gate, -1); }
+
+  /// Moves the window, removing the gate `leaving` and adding `entering`.
+  void slide(Gate_t const& leaving, Gate_t const& entering)
+    { remove(leaving); add(entering); }
+
+  /// Removes all gates from the window.
+  void clear() { fDeltas.clear(); fChannels.clear(); }
+
+  /// Returns whether there is no gate change nor channel in the window.
+  bool empty() const { return fDeltas.empty() && fChannels.empty(); }
+
+  /**
+   * @brief Returns the sum of all the gates currently in the window.
+   * @throw ReadoutTriggerGateError if the opening becomes negative (it happens
+   *        when removing gates that had not been added)
+   */
+  Gate_t gate() const;
+
+  /// Returns the opening of the window at the specified `tick`.
+  OpeningCount_t openingCount(ClockTick_t tick) const;
+
+
+    private:
+
+  /// A change of opening at a given tick.
+  using Delta_t = std::pair<ClockTick_t, OpeningDiff_t>;
+
+  std::vector<Delta_t> fDeltas; ///< Changes of opening, sorted by tick.
+
+  std::vector<Delta_t> fBuffer; ///< Memory for the next merge.
+
+  /// All channels in the window, sorted, with repetitions.
+  std::vector<ChannelID_t> fChannels;
+
+
+  using GateData_t = typename Gate_t::GateData_t; ///< Gate level data type.
+  using EventType = typename GateData_t::EventType; ///< Gate event type.
+
+  //@{
+  /// Returns the evolution of the levels of the specified `gate`.
+  static auto& levelsOf(GateData_t& gate) { return gate.fGateLevel; }
+  static auto const& levelsOf(GateData_t const& gate)
+    { return gate.fGateLevel; }
+  //@}
+
+  /// Merges the changes of opening of `gate`, multiplied by `sign`.
+  void mergeGate(Gate_t const& gate, OpeningDiff_t sign);
+
+  /// Adds the channels of `gate` to the list.
+  void addChannels(Gate_t const& gate);
+
+  /// Removes one instance of each of the channels of `gate` from the list.
+  void removeChannels(Gate_t const& gate);
+
+}; // class icarus::trigger::SlidingWindowTriggerGate<>
+
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+template <typename Tick, typename TickInterval, typename ChannelIDType>
+auto icarus::trigger::SlidingWindowTriggerGate
+  <Tick, TickInterval, ChannelIDType>::gate() const -> Gate_t
+{
+  Gate_t result;
+  auto& resultLevels = levelsOf(result);
+  resultLevels.reserve(fDeltas.size() + 1U);
+
+  OpeningDiff_t level = 0;
+  for (auto const& [ tick, delta ]: fDeltas) {
+    level += delta;
+    if (level < 0) {
+      throw ReadoutTriggerGateError(
+        "icarus::trigger::SlidingWindowTriggerGate::gate(): opening at tick "
+        + std::to_string(tick) + " is negative (" + std::to_string(level)
+        + "); were gates removed without being added?"
+        );
+    }
+    // the starting status at the earliest tick is already there
+    if (tick == resultLevels.back().tick)
+      resultLevels.back().opening = static_cast<OpeningCount_t>(level);
+    else {
+      resultLevels.emplace_back
+        (EventType::Shift, tick, static_cast<OpeningCount_t>(level));
+    }
+  } // for
+
+  // channels are sorted: each new one is appended at the end
+  for (ChannelID_t const channel: fChannels) result.addChannel(channel);
+
+  return result;
+} // icarus::trigger::SlidingWindowTriggerGate<>::gate()
+
+
+//------------------------------------------------------------------------------
+template <typename Tick, typename TickInterval, typename ChannelIDType>
+auto icarus::trigger::SlidingWindowTriggerGate
+  <Tick, TickInterval, ChannelIDType>::openingCount(ClockTick_t tick) const
+  -> OpeningCount_t
+{
+  OpeningDiff_t level = 0;
+  for (auto const& [ deltaTick, delta ]: fDeltas) {
+    if (deltaTick > tick) break;
+    level += delta;
+  }
+  return (level > 0)? static_cast<OpeningCount_t>(level): OpeningCount_t{ 0 };
+} // icarus::trigger::SlidingWindowTriggerGate<>::openingCount()
+
+
+//------------------------------------------------------------------------------
+template <typename Tick, typename TickInterval, typename ChannelIDType>
+void icarus::trigger::SlidingWindowTriggerGate
+  <Tick, TickInterval, ChannelIDType>::mergeGate
+  (Gate_t const& gate, OpeningDiff_t sign)
+{
+  /*
+   * This is a merge of two sorted lists, the current changes and the ones
+   * from the gate (extracted on the fly from its evolution).
+   * Changes at the same tick are added together, and when they cancel each
+   * other they are removed from the merged list.
+   */
+  auto const& gateLevels = levelsOf(gate);
+
+  fBuffer.clear();
+  fBuffer.reserve(fDeltas.size() + gateLevels.size());
+
+  auto const append = [this](ClockTick_t tick, OpeningDiff_t delta)
+    {
+      if (delta == 0) return;
+      if (!fBuffer.empty() && (fBuffer.back().first == tick)) {
+        if ((fBuffer.back().second += delta) == 0) fBuffer.pop_back();
+      }
+      else fBuffer.emplace_back(tick, delta);
+    };
+
+  auto iDelta = fDeltas.cbegin();
+  auto const dend = fDeltas.cend();
+
+  OpeningDiff_t prevLevel = 0;
+  for (auto const& status: gateLevels) {
+    // copy all the existing changes up to this tick
+    while ((iDelta != dend) && (iDelta->first <= status.tick)) {
+      append(iDelta->first, iDelta->second);
+      ++iDelta;
+    }
+    OpeningDiff_t const level = static_cast<OpeningDiff_t>(status.opening);
+    append(status.tick, sign * (level - prevLevel));
+    prevLevel = level;
+  } // for
+
+  while (iDelta != dend) {
+    append(iDelta->first, iDelta->second);
+    ++iDelta;
+  }
+
+  std::swap(fDeltas, fBuffer);
+
+} // icarus::trigger::SlidingWindowTriggerGate<>::mergeGate()
+
+
+//------------------------------------------------------------------------------
+template <typename Tick, typename TickInterval, typename ChannelIDType>
+void icarus::trigger::SlidingWindowTriggerGate
+  <Tick, TickInterval, ChannelIDType>::addChannels(Gate_t const& gate)
+{
+  for (ChannelID_t const channel: gate.channels()) {
+    fChannels.insert
+      (std::upper_bound(fChannels.begin(), fChannels.end(), channel), channel);
+  }
+} // icarus::trigger::SlidingWindowTriggerGate<>::addChannels()
+
+
+//------------------------------------------------------------------------------
+template <typename Tick, typename TickInterval, typename ChannelIDType>
+void icarus::trigger::SlidingWindowTriggerGate
+  <Tick, TickInterval, ChannelIDType>::removeChannels(Gate_t const& gate)
+{
+  // check first, so that on failure the window is left untouched
+  for (ChannelID_t const channel: gate.channels()) {
+    if (std::binary_search(fChannels.begin(), fChannels.end(), channel))
+      continue;
+    throw ReadoutTriggerGateError(
+      "icarus::trigger::SlidingWindowTriggerGate::remove(): channel "
+      + std::to_string(channel) + " is not in the window"
+      );
+  } // for
+  for (ChannelID_t const channel: gate.channels()) {
+    fChannels.erase
+      (std::lower_bound(fChannels.begin(), fChannels.end(), channel));
+  }
+} // icarus::trigger::SlidingWindowTriggerGate<>::removeChannels()
+
+
+//------------------------------------------------------------------------------
+
+#endif // SBNOBJ_ICARUS_PMT_TRIGGER_DATA_SLIDINGWINDOWTRIGGERGATE_H
@@ -0,0 +1,280 @@
+/**
+ * @file   sbnobj/ICARUS/PMT/Trigger/Data/TriggerGateCapture.cxx
+ * @brief  Stores the optical trigger gates of many events in a compact file.
+ * @date   October 14, 2026
+ * @see    `sbnobj/ICARUS/PMT/Trigger/Data/TriggerGateCapture.h`
+ *
+ */
+
+// class header
+#include "sbnobj/ICARUS/PMT/Trigger/Data/TriggerGateCapture.h"
+
+// framework libraries
+#include "cetlib_except/exception.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::equal(), std::min()
+#include <iterator> // std::begin(), std::end()
+#include <limits>
+#include <utility> // std::move()
+
+
+//------------------------------------------------------------------------------
+namespace {
+
+  /// Characters at the start of each capture file.
+  constexpr char Magic[8] = { 'S', 'B', 'N', 'T', 'G', 'C', 'A', 'P' };
+
+  /// Version of the capture file format.
+  constexpr std::uint64_t FormatVersion = 1U;
+
+  /// First byte of each event record.
+  constexpr std::uint8_t EventMarker = 0x45; // 'E'
+
+  /// Gates preallocated when reading an event (more are allowed).
+  constexpr std::uint64_t MaxReservedGates = 4096U;
+
+  /// Largest gate accepted when reading (1 GiB).
+  constexpr std::uint64_t MaxPackedGateSize = 1ULL << 30;
+
+
+  /// Appends `value` to `buffer` as variable length integer.
+  void writeVarInt(std::vector<std::uint8_t>& buffer, std::uint64_t value) {
+    while (value >= 0x80) {
+      buffer.push_back(static_cast<std::uint8_t>(value | 0x80));
+      value >>= 7;
+    }
+    buffer.push_back(static_cast<std::uint8_t>(value));
+  } // writeVarInt()
+
+} // local namespace
+
+
+//------------------------------------------------------------------------------
+//--- icarus::trigger::TriggerGateCaptureWriter
+//------------------------------------------------------------------------------
+icarus::trigger::TriggerGateCaptureWriter::TriggerGateCaptureWriter
+  (std::string const& path)
+  : fPath{ path }
+  , fFile{ path, std::ios::binary | std::ios::trunc }
+{
+  if (!fFile) {
+    throw cet::exception("TriggerGateCapture")
+      << "Can't create the trigger gate capture file '" << fPath << "'.\n";
+  }
+
+  std::vector<std::uint8_t> header{ std::begin(Magic), std::end(Magic) };
+  writeVarInt(header, FormatVersion);
+  writeBytes(header.data(), header.size());
+
+} // icarus::trigger::TriggerGateCaptureWriter::TriggerGateCaptureWriter()
+
+
+//------------------------------------------------------------------------------
+void icarus::trigger::TriggerGateCaptureWriter::close() {
+
+  if (!fFile.is_open()) return;
+  fFile.close();
+  if (!fFile) {
+    throw cet::exception("TriggerGateCapture")
+      << "Error closing the trigger gate capture file '" << fPath << "'.\n";
+  }
+
+} // icarus::trigger::TriggerGateCaptureWriter::close()
+
+
+//------------------------------------------------------------------------------
+void icarus::trigger::TriggerGateCaptureWriter::addGate(Gate_t const& gate) {
+
+  auto const& channels = gate.channels();
+  writeVarInt(fRecord, channels.size());
+  for (Gate_t::ChannelID_t const channel: channels)
+    writeVarInt(fRecord, channel);
+
+  Gate_t::GateData_t::PackedGate_t const packed = gate.pack();
+  writeVarInt(fRecord, packed.size());
+  fRecord.insert(fRecord.end(), packed.begin(), packed.end());
+
+  ++fNRecordGates;
+
+} // icarus::trigger::TriggerGateCaptureWriter::addGate()
+
+
+//------------------------------------------------------------------------------
+void icarus::trigger::TriggerGateCaptureWriter::writeRecord
+  (unsigned int run, unsigned int subRun, unsigned int event)
+{
+  std::vector<std::uint8_t> header{ EventMarker };
+  writeVarInt(header, run);
+  writeVarInt(header, subRun);
+  writeVarInt(header, event);
+  writeVarInt(header, fNRecordGates);
+
+  writeBytes(header.data(), header.size());
+  writeBytes(fRecord.data(), fRecord.size());
+  ++fNEvents;
+
+  fRecord.clear(); // keeps the memory for the next event
+  fNRecordGates = 0U;
+
+} // icarus::trigger::TriggerGateCaptureWriter::writeRecord()
+
+
+//------------------------------------------------------------------------------
+void icarus::trigger::TriggerGateCaptureWriter::writeBytes
+  (std::uint8_t const* data, std::size_t nBytes)
+{
+  if (!fFile.is_open()) {
+    throw cet::exception("TriggerGateCapture")
+      << "Trigger gate capture file '" << fPath << "' already closed.\n";
+  }
+  fFile.write(reinterpret_cast<char const*>(data), nBytes);
+  if (!fFile) {
+    throw cet::exception("TriggerGateCapture")
+      << "Error writing " << nBytes << " bytes into the trigger gate capture"
+      " file '" << fPath << "'.\n";
+  }
+  fNBytes += nBytes;
+} // icarus::trigger::TriggerGateCaptureWriter::writeBytes()
+
+
+//------------------------------------------------------------------------------
+//--- icarus::trigger::TriggerGateCaptureReader
+//------------------------------------------------------------------------------
+icarus::trigger::TriggerGateCaptureReader::TriggerGateCaptureReader
+  (std::string const& path)
+  : fPath{ path }
+  , fFile{ path, std::ios::binary }
+{
+  if (!fFile) {
+    throw cet::exception("TriggerGateCapture")
+      << "Can't open the trigger gate capture file '" << fPath << "'.\n";
+  }
+
+  char magic[sizeof(Magic)];
+  fFile.read(magic, sizeof(magic));
+  if (!fFile || !std::equal(std::begin(magic), std::end(magic), Magic)) {
+    throw cet::exception("TriggerGateCapture")
+      << "'" << fPath << "' is not a trigger gate capture file.\n";
+  }
+  fNBytes += sizeof(magic);
+
+  std::uint64_t const version = readVarInt();
+  if (version != FormatVersion) {
+    throw cet::exception("TriggerGateCapture")
+      << "Trigger gate capture file '" << fPath << "' has format version "
+      << version << ", only version " << FormatVersion << " is supported.\n";
+  }
+
+} // icarus::trigger::TriggerGateCaptureReader::TriggerGateCaptureReader()
+
+
+//------------------------------------------------------------------------------
+bool icarus::trigger::TriggerGateCaptureReader::next
+  (TriggerGateCaptureEvent& event)
+{
+  using Gate_t = TriggerGateCaptureEvent::Gate_t;
+
+  std::uint8_t marker;
+  if (!readByte(marker, true)) return false;
+  if (marker != EventMarker) throwCorrupted("event marker not found");
+
+  auto const readUInt = [this](char const* what){
+    std::uint64_t const value = readVarInt();
+    if (value > std::numeric_limits<unsigned int>::max()) throwCorrupted(what);
+    return static_cast<unsigned int>(value);
+  };
+
+  event.run = readUInt("invalid run number");
+  event.subRun = readUInt("invalid subrun number");
+  event.event = readUInt("invalid event number");
+  std::uint64_t const nGates = readVarInt();
+
+  event.gates.clear();
+  // a corrupted count should not trigger a huge allocation
+  event.gates.reserve(std::min<std::uint64_t>(nGates, MaxReservedGates));
+  for (std::uint64_t iGate = 0U; iGate < nGates; ++iGate) {
+    Gate_t& gate = event.gates.emplace_back();
+
+    std::uint64_t const nChannels = readVarInt();
+    for (std::uint64_t iChannel = 0U; iChannel < nChannels; ++iChannel) {
+      std::uint64_t const channel = readVarInt();
+      if (channel > std::numeric_limits<Gate_t::ChannelID_t>::max())
+        throwCorrupted("invalid channel number");
+      gate.addChannel(static_cast<Gate_t::ChannelID_t>(channel));
+    } // for channels
+
+    std::uint64_t const nPacked = readVarInt();
+    if (nPacked > MaxPackedGateSize) throwCorrupted("invalid gate size");
+    fPacked.resize(nPacked);
+    fFile.read(reinterpret_cast<char*>(fPacked.data()), nPacked);
+    if (!fFile) throwCorrupted("truncated gate");
+    fNBytes += nPacked;
+
+    try {
+      gate = Gate_t::GateData_t::unpack(fPacked);
+    }
+    catch (std::runtime_error const& e) {
+      throwCorrupted(e.what());
+    }
+  } // for gates
+
+  ++fNEvents;
+  return true;
+} // icarus::trigger::TriggerGateCaptureReader::next()
+
+
+//------------------------------------------------------------------------------
+auto icarus::trigger::TriggerGateCaptureReader::readAll()
+  -> std::vector<TriggerGateCaptureEvent>
+{
+  std::vector<TriggerGateCaptureEvent> events;
+  TriggerGateCaptureEvent event;
+  while (next(event)) events.push_back(std::move(event));
+  return events;
+} // icarus::trigger::TriggerGateCaptureReader::readAll()
+
+
+//------------------------------------------------------------------------------
+bool icarus::trigger::TriggerGateCaptureReader::readByte
+  (std::uint8_t& byte, bool endAllowed /* = false */)
+{
+  using Traits_t = std::ifstream::traits_type;
+
+  Traits_t::int_type const c = fFile.rdbuf()->sbumpc();
+  if (Traits_t::eq_int_type(c, Traits_t::eof())) {
+    if (endAllowed) return false;
+    throwCorrupted("truncated file");
+  }
+  byte = static_cast<std::uint8_t>(Traits_t::to_char_type(c));
+  ++fNBytes;
+  return true;
+} // icarus::trigger::TriggerGateCaptureReader::readByte()
+
+
+//------------------------------------------------------------------------------
+std::uint64_t icarus::trigger::TriggerGateCaptureReader::readVarInt() {
+
+  std::uint64_t value = 0U;
+  for (unsigned int shift = 0U; shift < 64U; shift += 7U) {
+    std::uint8_t byte;
+    readByte(byte);
+    value |= std::uint64_t(byte & 0x7F) << shift;
+    if ((byte & 0x80) == 0) return value;
+  } // for
+  throwCorrupted("invalid integer");
+
+} // icarus::trigger::TriggerGateCaptureReader::readVarInt()
+
+
+//------------------------------------------------------------------------------
+void icarus::trigger::TriggerGateCaptureReader::throwCorrupted
+  (std::string const& what) const
+{
+  throw cet::exception("TriggerGateCapture")
+    << "Trigger gate capture file '" << fPath << "' is corrupted (" << what
+    << ") after " << fNEvents << " events.\n";
+} // icarus::trigger::TriggerGateCaptureReader::throwCorrupted()
+
+
+//------------------------------------------------------------------------------
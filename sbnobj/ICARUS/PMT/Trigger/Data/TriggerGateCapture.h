@@ -0,0 +1,219 @@
+/**
+ * @file   sbnobj/ICARUS/PMT/Trigger/Data/TriggerGateCapture.h
+ * @brief  Stores the optical trigger gates of many events in a compact file.
+ * @date   October 14, 2026
+ * @see    `sbnobj/ICARUS/PMT/Trigger/Data/TriggerGateCapture.cxx`
+ *
+ */
+
+#ifndef SBNOBJ_ICARUS_PMT_TRIGGER_DATA_TRIGGERGATECAPTURE_H
+#define SBNOBJ_ICARUS_PMT_TRIGGER_DATA_TRIGGERGATECAPTURE_H
+
+
+// ICARUS libraries
+#include "sbnobj/ICARUS/PMT/Trigger/Data/OpticalTriggerGate.h"
+
+// C/C++ standard libraries
+#include <fstream>
+#include <string>
+#include <vector>
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint8_t, std::uint64_t
+
+
+//------------------------------------------------------------------------------
+namespace icarus::trigger {
+
+  struct TriggerGateCaptureEvent;
+  class TriggerGateCaptureWriter;
+  class TriggerGateCaptureReader;
+
+} // namespace icarus::trigger
+
+
+/**
+ * @brief The optical trigger gates of one event, as stored in a capture file.
+ *
+ * The gates are in the order they were written. A gate written from a
+ * `icarus::trigger::SingleChannelOpticalTriggerGate` is read back with its
+ * single channel and its full opening evolution, but without its waveforms.
+ */
+struct icarus::trigger::TriggerGateCaptureEvent {
+
+  using Gate_t = icarus::trigger::OpticalTriggerGateData_t; ///< Gate type.
+
+  unsigned int run = 0U; ///< Run number.
+  unsigned int subRun = 0U; ///< Subrun number.
+  unsigned int event = 0U; ///< Event number.
+
+  std::vector<Gate_t> gates; ///< All the gates of the event.
+
+}; // icarus::trigger::TriggerGateCaptureEvent
+
+
+/**
+ * @brief Writes the optical trigger gates of events into a capture file.
+ *
+ * A capture file is meant to replay the gates of real events through trigger
+ * logic outside the framework, e.g. to measure the cost of a combination.
+ * Its format is a header followed by one record per event:
+ * * header: the 8 characters `SBNTGCAP` and the format version;
+ * * event record: a marker byte, run, subrun and event numbers and number of
+ *   gates, followed by each gate: number of channels, the channels, and the
+ *   size and content of the compact representation of the gate
+ *   (`TriggerGateData::pack()`).
+ *
+ * All integers are stored as variable length integers (7 bits per byte), so
+ * the file is independent of the architecture, and a typical gate status
+ * takes 3 bytes.
+ *
+ * Example:
+ * @code
+ * icarus::trigger::TriggerGateCaptureWriter capture { "gates.tgcap" };
+ * for (auto const& [ id, gates ]: events)
+ *   capture.write(id.run(), id.subRun(), id.event(), gates);
+ * capture.close();
+ * @endcode
+ * where `gates` can be e.g. a
+ * `std::vector<icarus::trigger::SingleChannelOpticalTriggerGate>` or the
+ * `std::vector<icarus::trigger::OpticalTriggerGateData_t>` data product.
+ */
+class icarus::trigger::TriggerGateCaptureWriter {
+
+    public:
+
+  using Gate_t = TriggerGateCaptureEvent::Gate_t; ///< Type of stored gate.
+
+  /**
+   * @brief Creates the capture file `path` (overwriting it) and its header.
+   * @throw cet::exception (category `TriggerGateCapture`) on I/O error
+   */
+  explicit TriggerGateCaptureWriter(std::string const& path);
+
+  /**
+   * @brief Writes all the `gates` of an event.
+   * @tparam Gates a range of objects convertible to `Gate_t const&`
+   * @throw cet::exception (category `TriggerGateCapture`) on I/O error
+   */
+  template <typename Gates>
+  void write(
+    unsigned int run, unsigned int subRun, unsigned int event,
+    Gates const& gates
+    );
+
+  /// Writes all the gates of `event`.
+  void write(TriggerGateCaptureEvent const& event)
+    { write(event.run, event.subRun, event.event, event.gates); }
+
+  /// Flushes and closes the file. Nothing can be written after that.
+  void close();
+
+  std::size_t nEvents() const { return fNEvents; } ///< Events written.
+  std::uint64_t nBytes() const { return fNBytes; } ///< Bytes written.
+
+    private:
+
+  std::string fPath; ///< Path of the capture file.
+  std::ofstream fFile; ///< Output stream.
+
+  std::vector<std::uint8_t> fRecord; ///< Buffer of the current event record.
+  std::size_t fNRecordGates = 0U; ///< Gates in the current event record.
+
+  std::size_t fNEvents = 0U; ///< Number of events written.
+  std::uint64_t fNBytes = 0U; ///< Number of bytes written.
+
+  /// Adds a gate to the current event record.
+  void addGate(Gate_t const& gate);
+
+  /// Writes the current event record into the file.
+  void writeRecord(unsigned int run, unsigned int subRun, unsigned int event);
+
+  /// Writes `nBytes` from `data` into the file, throwing on failure.
+  void writeBytes(std::uint8_t const* data, std::size_t nBytes);
+
+}; // icarus::trigger::TriggerGateCaptureWriter
+
+
+/**
+ * @brief Reads back the events of a capture file, one at a time.
+ * @see `icarus::trigger::TriggerGateCaptureWriter`
+ *
+ * Example:
+ * @code
+ * icarus::trigger::TriggerGateCaptureReader capture { "gates.tgcap" };
+ * icarus::trigger::TriggerGateCaptureEvent event;
+ * while (capture.next(event)) {
+ *   auto const multiplicity
+ *     = icarus::trigger::OpticalTriggerGateData_t::Multiplicity(event.gates);
+ *   // ...
+ * }
+ * @endcode
+ */
+class icarus::trigger::TriggerGateCaptureReader {
+
+    public:
+
+  /**
+   * @brief Opens the capture file `path` and checks its header.
+   * @throw cet::exception (category `TriggerGateCapture`) if the file can't
+   *        be read or it is not a capture file
+   */
+  explicit TriggerGateCaptureReader(std::string const& path);
+
+  /**
+   * @brief Reads the next event into `event`.
+   * @return whether an event was read (`false` at the end of the file)
+   * @throw cet::exception (category `TriggerGateCapture`) if the file is
+   *        truncated or corrupted
+   *
+   * The memory of `event` is reused where possible.
+   */
+  bool next(TriggerGateCaptureEvent& event);
+
+  /// Reads all the remaining events.
+  std::vector<TriggerGateCaptureEvent> readAll();
+
+  std::size_t nEvents() const { return fNEvents; } ///< Events read so far.
+  std::uint64_t nBytes() const { return fNBytes; } ///< Bytes read so far.
+
+    private:
+
+  std::string fPath; ///< Path of the capture file.
+  std::ifstream fFile; ///< Input stream.
+
+  std::vector<std::uint8_t> fPacked; ///< Buffer for a packed gate.
+
+  std::size_t fNEvents = 0U; ///< Number of events read.
+  std::uint64_t fNBytes = 0U; ///< Number of bytes read.
+
+  /// Reads one byte; returns `false` at end of file only if `endAllowed`.
+  bool readByte(std::uint8_t& byte, bool endAllowed = false);
+
+  /// Reads a variable length integer.
+  std::uint64_t readVarInt();
+
+  [[noreturn]] void throwCorrupted(std::string const& what) const;
+
+}; // icarus::trigger::TriggerGateCaptureReader
+
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+template <typename Gates>
+void icarus::trigger::TriggerGateCaptureWriter::write(
+  unsigned int run, unsigned int subRun, unsigned int event,
+  Gates const& gates
+) {
+  // drop leftovers from a previous write interrupted by an exception
+  fRecord.clear();
+  fNRecordGates = 0U;
+  for (Gate_t const& gate: gates) addGate(gate);
+  writeRecord(run, subRun, event);
+} // icarus::trigger::TriggerGateCaptureWriter::write()
+
+
+//------------------------------------------------------------------------------
+
+
+#endif // SBNOBJ_ICARUS_PMT_TRIGGER_DATA_TRIGGERGATECAPTURE_H
@@ -15,6 +15,9 @@
 #ifndef SBNOBJ_ICARUS_PMT_TRIGGER_DATA_TRIGGERGATEDATA_H
 #define SBNOBJ_ICARUS_PMT_TRIGGER_DATA_TRIGGERGATEDATA_H
 
+// ICARUS libraries
+#include "sbnobj/ICARUS/PMT/Trigger/Data/TriggerGateStats.h"
+
 // C/C++ standard libraries
 #include <vector>
 #include <iosfwd> // std::ostream
@@ -22,6 +25,8 @@
 #include <limits>
 #include <utility> // std::pair, std::move()
 #include <type_traits> // std::make_signed_t
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint8_t, std::int32_t, std::uint16_t
 
 
 // --- BEGIN -- Preliminary declarations and definitions -----------------------
@@ -82,6 +87,25 @@ namespace icarus::trigger {
   //
   // declarations
   //
+  /**
+   * @brief Type of the opening count of `TriggerGateData<Tick, TickInterval>`.
+   * 
+   * It is `unsigned int`, except for the compact gates with 32-bit ticks and
+   * intervals, which count openings with 16 bits. The opening count is not a
+   * template parameter of `TriggerGateData`, so that the name of the class
+   * (and of its stored data products) stays the same.
+   */
+  template <typename Tick, typename TickInterval>
+  struct TriggerGateOpeningCount { using type = unsigned int; };
+  
+  template <>
+  struct TriggerGateOpeningCount<std::int32_t, std::int32_t>
+    { using type = std::uint16_t; };
+  
+  template <typename Tick, typename TickInterval>
+  using TriggerGateOpeningCount_t
+    = typename TriggerGateOpeningCount<Tick, TickInterval>::type;
+  
   template <typename Tick, typename TickInterval>
   class TriggerGateData;
   
@@ -93,6 +117,24 @@ namespace icarus::trigger {
   std::ostream& operator<<
     (std::ostream&, typename TriggerGateData<TK, TI>::Status const&);
   
+  template <typename Tick, typename TickInterval, typename ChannelIDType>
+  class SlidingWindowTriggerGate;
+  
+  template <typename Tick, typename TickInterval>
+  class DenseTriggerGateData;
+  
+  template <typename Gate>
+  class DelayedGate;
+  
+  class OpticalTriggerGateCollection;
+  
+  class DiscriminatedGateBuilder;
+  
+  /// Returns a view of `gate` delayed by `delay` ticks (@see `DelayedGate`).
+  template <typename Gate>
+  DelayedGate<Gate> delayed
+    (Gate const& gate, typename Gate::ClockTicks_t delay);
+  
   
 } // namespace icarus::trigger
 // --- END -- Preliminary declarations and definitions -------------------------
@@ -104,6 +146,8 @@ namespace icarus::trigger {
  * @tparam Tick type used to count the ticks
  * @tparam TickInterval type used to quantify tick difference
  * 
+ * The type of the opening count is chosen by `TriggerGateOpeningCount`.
+ * 
  * A `TriggerGate` object tracks a logical multi-level gate, that is a gate
  * whose level can be not only `0` or `1`, but an arbitrary integral number.
  * The gate level is defined as a positive number. The general convention is
@@ -127,6 +171,19 @@ namespace icarus::trigger {
  * opening event (that is an increase in level) and a closing one (a shift of
  * the same amount in the opposite direction).
  * 
+ * Opening and closing operations may leave behind events which do not change
+ * the level of the gate. These are periodically removed ("compaction") when
+ * the number of events added since the last compaction becomes a sizeable
+ * fraction of the total, so that the cost of compaction is spread over many
+ * operations. Compaction can also be requested explicitly with `compact()`,
+ * for example before storing the gate. Queries never compact the gate, so
+ * that they are safe to be called concurrently.
+ * 
+ * Opening and closing operations starting at or after the last event of the
+ * gate just append events at its end, without any search: filling a gate in
+ * increasing tick order (as from time-ordered discriminator output) takes
+ * amortized constant time per operation.
+ * 
  */
 template <typename Tick, typename TickInterval>
 class icarus::trigger::TriggerGateData {
@@ -143,11 +200,23 @@ class icarus::trigger::TriggerGateData {
   using ClockTicks_t = TickInterval;
   
   /// Type of count of number of open channels.
-  using OpeningCount_t = unsigned int;
+  using OpeningCount_t = TriggerGateOpeningCount_t<Tick, TickInterval>;
   
   /// Type representing a variation of open channels.
   using OpeningDiff_t = std::make_signed_t<OpeningCount_t>;
   
+  /// Caller-owned memory to be reused by combination operations.
+  class CombinationBuffer;
+  
+  /// Query object remembering its position in the gate (@see `cursor()`).
+  class Cursor;
+  
+  /// View of the gate in a tick range (@see `range()`).
+  class RangeView;
+  
+  /// Summary of the opening of the gate in a range (@see `openingStats()`).
+  struct OpeningStats;
+  
   // --- END -- Data type definitions ------------------------------------------
   
   
@@ -163,6 +232,24 @@ class icarus::trigger::TriggerGateData {
   /// Constructor: a closed gate for the channel in `waveform`.
   TriggerGateData(): fGateLevel{ startingGateLevel() } {}
   
+  /**
+   * @brief Returns a copy of `other` with the types of this gate.
+   * @tparam TK type of tick of the `other` gate
+   * @tparam TI type of tick interval of the `other` gate
+   * @param other the gate to be converted
+   * @return a gate with the same time evolution as `other`
+   * @throw std::runtime_error if a tick or an opening of `other` can't be
+   *        represented in this gate
+   * 
+   * The limits of the ticks (`MinTick` and `MaxTick`) of `other` are
+   * converted into the limits of this gate type.
+   * This allows e.g. to convert gates from and to a compact representation
+   * with 32-bit ticks and 16-bit openings.
+   */
+  template <typename TK, typename TI>
+  static triggergatedata_t convertFrom
+    (TriggerGateData<TK, TI> const& other);
+  
   
   // --- BEGIN Query -----------------------------------------------------------
   /// @name Query
@@ -174,6 +261,44 @@ class icarus::trigger::TriggerGateData {
   /// Returns the opening count of the gate at the specified `tick`.
   OpeningCount_t openingCount(ClockTick_t tick) const;
   
+  /**
+   * @brief Writes the opening count of the gate at each of the `ticks`.
+   * @param ticks pointer to the first of the ticks, sorted in increasing order
+   * @param nTicks number of ticks
+   * @param counts pointer to room for `nTicks` opening counts
+   * @throw std::runtime_error if the first tick is before the gate start
+   * @see `openingCountsUnsorted()`
+   * 
+   * The result is the same as calling `openingCount()` on each tick, but all
+   * the ticks are found in a single pass merging them with the gate stati,
+   * instead of a binary search for each of them.
+   * The result is undefined if the ticks are not sorted.
+   */
+  void openingCounts
+    (ClockTick_t const* ticks, std::size_t nTicks, OpeningCount_t* counts)
+    const;
+  
+  /**
+   * @brief Writes the opening count of the gate at each of the `ticks`.
+   * @param ticks pointer to the first of the ticks, in any order
+   * @param nTicks number of ticks
+   * @param counts pointer to room for `nTicks` opening counts
+   * @throw std::runtime_error if any of the ticks is before the gate start
+   * @see `openingCounts()`
+   * 
+   * Each tick is looked up with a binary search where each step is a
+   * conditional move rather than a branch, and with the same number of steps
+   * for all the ticks; the compiler can then interleave the searches of
+   * consecutive ticks. If the ticks are sorted, `openingCounts()` is faster.
+   */
+  void openingCountsUnsorted
+    (ClockTick_t const* ticks, std::size_t nTicks, OpeningCount_t* counts)
+    const;
+  
+  /// Returns the opening count at each of the `ticks`, sorted or not.
+  std::vector<OpeningCount_t> openingCounts
+    (std::vector<ClockTick_t> const& ticks) const;
+  
   /// Returns whether this gate never opened.
   bool alwaysClosed() const { return findOpenStatus() == fGateLevel.end(); }
   
@@ -245,6 +370,65 @@ class icarus::trigger::TriggerGateData {
   std::pair<OpeningCount_t, OpeningCount_t> openingRange
     (ClockTick_t start, ClockTick_t end) const;
   
+  /**
+   * @brief Returns a summary of the opening of the gate in a tick range.
+   * @param start the first tick of the range
+   * @param end the first tick after the range
+   * @param minOpening the opening required for the gate to be "open"
+   * @return a `OpeningStats` object with the summary
+   * @see `OpeningStats`
+   * 
+   * The summary includes the number of ticks the gate spent at each opening
+   * level, the number of times the gate opened (i.e. its opening became at
+   * least `minOpening`) and the maximum opening, all collected in a single
+   * pass through the gate. An opening which is already in place at `start`
+   * is not counted as an opening.
+   * Time over threshold for any opening requirement can then be obtained with
+   * `OpeningStats::ticksAtLeast()`.
+   * 
+   * If `start` is not smaller than `end`, the summary is empty.
+   */
+  OpeningStats openingStats
+    (ClockTick_t start, ClockTick_t end, OpeningCount_t minOpening = 1U) const;
+  
+  /**
+   * @brief Returns an object to query this gate at nearby ticks.
+   * @return a new cursor pointing to the start of this gate
+   * @see `Cursor`
+   * 
+   * The cursor offers the same queries as the gate (`openingCount()`,
+   * `findOpen()`, etc.) but it remembers where the last query landed, and
+   * starts the next search from there. It is most efficient when scanning
+   * the gate in increasing (or decreasing) tick order.
+   * 
+   * The cursor is invalidated by any change to this gate.
+   */
+  Cursor cursor() const;
+  
+  /**
+   * @brief Returns a view of this gate in the tick range [ `start`, `end` [.
+   * @param start first tick of the range
+   * @param end first tick after the range
+   * @return a view of this gate, closed outside the range
+   * @see `RangeView`
+   * 
+   * The view behaves like a copy of this gate closed before `start` and from
+   * `end` on, without copying the gate. It is invalidated by any change to
+   * this gate.
+   */
+  RangeView range(ClockTick_t start, ClockTick_t end) const;
+  
+  /**
+   * @brief Calls `f(tick, opening)` for each status of the gate, in tick order.
+   * 
+   * The first status is at the lowest tick and sets the starting opening.
+   * Statuses not changing the opening may be reported if the gate has not been
+   * compacted.
+   */
+  template <typename F>
+  void forEachStatus(F&& f) const
+    { for (Status const& status: fGateLevel) f(status.tick, status.opening); }
+  
   // --- END Query -------------------------------------------------------------
   
   
@@ -280,7 +464,10 @@ class icarus::trigger::TriggerGateData {
   void closeAllAt(ClockTick_t tick) { setOpeningAt(tick, 0U); }
   
   /// Sets the gate levels in the state at construction.
-  void clear() { fGateLevel = startingGateLevel(); }
+  void clear() { fGateLevel = startingGateLevel(); fNewStati = 0U; }
+  
+  /// Removes stati which do not change the gate level.
+  void compact() { compact(fGateLevel); fNewStati = 0U; }
   
   /// @}
   // --- END Gate opening and closing operations -------------------------------
@@ -329,6 +516,32 @@ class icarus::trigger::TriggerGateData {
    */
   triggergatedata_t& Mul(triggergatedata_t const& other);
 
+  //@{
+  /**
+   * @brief Combines with a gate, using the memory of `buffer` for the result.
+   * @param other gate to combine to
+   * @param buffer caller-owned scratch memory
+   * @return this object
+   * @see `Min()`, `Max()`, `Sum()`, `Mul()`
+   * 
+   * These are equivalent to the single argument versions, but the combination
+   * is written into `buffer`, which is then swapped with the levels of this
+   * gate. The previous levels are left in `buffer`, and their memory is used
+   * by the next combination. Once `buffer` has grown enough, repeated
+   * combinations in an event loop do not allocate any memory.
+   * 
+   * The same buffer must not be used by two combinations at the same time.
+   */
+  triggergatedata_t& Min
+    (triggergatedata_t const& other, CombinationBuffer& buffer);
+  triggergatedata_t& Max
+    (triggergatedata_t const& other, CombinationBuffer& buffer);
+  triggergatedata_t& Sum
+    (triggergatedata_t const& other, CombinationBuffer& buffer);
+  triggergatedata_t& Mul
+    (triggergatedata_t const& other, CombinationBuffer& buffer);
+  //@}
+
   /**
    * @brief Returns a gate with the minimum opening between the specified two.
    * @param a first gate
@@ -373,6 +586,44 @@ class icarus::trigger::TriggerGateData {
   static triggergatedata_t Mul
     (triggergatedata_t const& a, triggergatedata_t const& b);
 
+  //@{
+  /**
+   * @brief Returns a combination of two gates, each with its own delay.
+   * @param a first gate and its delay
+   * @param b second gate and its delay
+   * @return gate with at every tick the combination of the delayed openings
+   * @see `icarus::trigger::delayed()`, `SymmetricCombination()`
+   * 
+   * These are the equivalent of the two-gate versions of `Min()`, `Max()`,
+   * `Sum()` and `Mul()`, with each gate shifted later in time by its delay.
+   * No shifted copy of the gates is made, so that e.g. a coincidence of a gate
+   * with itself can be scanned over many delays:
+   * @code
+   * for (ClockTicks_t delay = 0; delay < maxDelay; ++delay) {
+   *   auto const coinc = TriggerGateData_t::Min
+   *     (delayed(gate, 0), delayed(gate, delay));
+   *   // ...
+   * }
+   * @endcode
+   */
+  static triggergatedata_t Min(
+    DelayedGate<triggergatedata_t> const& a,
+    DelayedGate<triggergatedata_t> const& b
+    );
+  static triggergatedata_t Max(
+    DelayedGate<triggergatedata_t> const& a,
+    DelayedGate<triggergatedata_t> const& b
+    );
+  static triggergatedata_t Sum(
+    DelayedGate<triggergatedata_t> const& a,
+    DelayedGate<triggergatedata_t> const& b
+    );
+  static triggergatedata_t Mul(
+    DelayedGate<triggergatedata_t> const& a,
+    DelayedGate<triggergatedata_t> const& b
+    );
+  //@}
+
 
   /**
    * @brief Returns a gate combination of the openings of two other gates.
@@ -395,10 +646,121 @@ class icarus::trigger::TriggerGateData {
     ClockTicks_t aDelay = ClockTicks_t{},
     ClockTicks_t bDelay = ClockTicks_t{}
     );
-  
+
+  /**
+   * @brief Returns a gate combination of the openings of many gates.
+   * @tparam Op binary operation: `OpeningCount_t` (x2) to `OpeningCount_t`
+   * @tparam Gates type of range of gates to be combined
+   * @tparam Delays type of range of delays, one per gate
+   * @param op symmetric and associative binary combination operation
+   * @param gates the gates to be combined
+   * @param delays ticks of delay to be added to each of the gates
+   * @return gate with opening combination of all `gates`
+   * @throw std::runtime_error if `delays` is neither empty nor has one entry
+   *        per gate
+   *
+   * This is the N-way equivalent of `SymmetricCombination()`: all gates are
+   * combined at once with a single merge of their time evolutions, rather
+   * than folding them one after the other, and a single output is created.
+   *
+   * `Gates` must be a forward range of objects which can be converted into
+   * a `triggergatedata_t` constant reference, e.g. a
+   * `std::vector<icarus::trigger::OpticalTriggerGate>`. If `delays` is empty,
+   * no delay is applied to any of the gates; otherwise it must hold the delay
+   * of each gate, in the same order as `gates`.
+   *
+   * For this algorithm to work, the operation needs to be symmetric
+   * (`op(c1, c2) == op(c2, c1)`) and associative
+   * (`op(op(c1, c2), c3) == op(c1, op(c2, c3))`), which is the case for
+   * minimum, maximum, sum and product. The opening of the combined gate is
+   * kept up to date in logarithmic time in the number of gates on every
+   * change of any of the input gates.
+   * If no gate is specified, a closed gate is returned.
+   */
+  template <typename Op, typename Gates, typename Delays>
+  static triggergatedata_t Combine
+    (Op&& op, Gates const& gates, Delays const& delays);
+
+  /// Returns a combination of the openings of many gates, with no delay.
+  /// @see `Combine(Op&&, Gates const&, Delays const&)`
+  template <typename Op, typename Gates>
+  static triggergatedata_t Combine(Op&& op, Gates const& gates)
+    {
+      return
+        Combine(std::forward<Op>(op), gates, std::vector<ClockTicks_t>{});
+    }
+
+  /**
+   * @brief Returns the sum of the openings of many gates.
+   * @tparam Gates type of range of gates to be summed
+   * @tparam Delays type of range of delays, one per gate
+   * @param gates the gates to be summed
+   * @param delays ticks of delay to be added to each of the gates
+   * @return gate with at every tick the total opening of all `gates`
+   * @throw std::runtime_error if `delays` is neither empty nor has one entry
+   *        per gate
+   * @see `Combine()`
+   *
+   * The result is the same as `Combine(std::plus<>{}, gates, delays)`, with
+   * the same requirements on `gates` and `delays`, but the algorithm is
+   * specific to the sum: all the opening changes of all the gates are sorted
+   * by tick, and then swept once with a running counter.
+   * This is designed for the multiplicity of discriminated gates: when all
+   * the openings are `0` or `1`, the result is the number of open gates.
+   */
+  template <typename Gates, typename Delays>
+  static triggergatedata_t Multiplicity
+    (Gates const& gates, Delays const& delays);
+
+  /// Returns the sum of the openings of many gates, with no delay.
+  /// @see `Multiplicity(Gates const&, Delays const&)`
+  template <typename Gates>
+  static triggergatedata_t Multiplicity(Gates const& gates)
+    { return Multiplicity(gates, std::vector<ClockTicks_t>{}); }
+
   /// @}
   // --- END Combination operations --------------------------------------------
   
+  
+  // --- BEGIN Compact representation ------------------------------------------
+  /**
+   * @name Compact representation
+   * 
+   * The gate can be converted into a compact sequence of bytes and back.
+   * Each status is encoded as a byte with the event type and the sign of the
+   * change of opening, followed by the tick and the opening change, each
+   * relative to the previous status and as a variable length integer
+   * (7 bits per byte). A typical status takes 3 bytes instead of the
+   * 16 bytes of its in-memory (and ROOT streamed) form.
+   * 
+   * The format is independent of the architecture. The content of the gate
+   * is fully preserved: `unpack(gate.pack()) == gate`.
+   *
+   * The ticks must be integral numbers.
+   *
+   * This is an in-memory codec, not the format of the gate data products,
+   * which are still written as the full list of stati (`fGateLevel`).
+   * `icarus::trigger::TriggerGateCaptureWriter` stores gates in this format.
+   */
+  /// @{
+  
+  /// Type of the compact representation of a gate.
+  using PackedGate_t = std::vector<std::uint8_t>;
+  
+  /// Returns the compact representation of this gate.
+  PackedGate_t pack() const;
+  
+  /**
+   * @brief Returns the gate from its compact representation.
+   * @param packed compact representation, as returned by `pack()`
+   * @return the gate encoded in `packed`
+   * @throw std::runtime_error if the representation is corrupted
+   */
+  static triggergatedata_t unpack(PackedGate_t const& packed);
+  
+  /// @}
+  // --- END Compact representation --------------------------------------------
+  
 
   // standard comparison operators: all must be the same
   bool operator== (TriggerGateData const&) const;
@@ -423,6 +785,24 @@ class icarus::trigger::TriggerGateData {
   friend std::ostream& operator<< <ClockTick_t, ClockTicks_t>
     (std::ostream&, Status const&);
   
+  /// Conversions access the gate evolution of the other types directly.
+  template <typename TK, typename TI>
+  friend class TriggerGateData;
+  
+  /// The sliding window accesses the gate evolution directly.
+  template <typename TK, typename TI, typename CID>
+  friend class SlidingWindowTriggerGate;
+  
+  /// The dense gate converts itself by writing the gate evolution directly.
+  template <typename TK, typename TI>
+  friend class DenseTriggerGateData;
+  
+  /// The gate collection copies the gate evolution in and out of its storage.
+  friend class OpticalTriggerGateCollection;
+  
+  /// The discriminator appends the gate evolution directly.
+  friend class DiscriminatedGateBuilder;
+  
   
     private:
   
@@ -448,8 +828,18 @@ class icarus::trigger::TriggerGateData {
   static Status const NewGateStatus;
   
   
+  /// Minimum number of new stati before a lazy compaction is considered.
+  static constexpr std::size_t LazyCompactionMinStati = 16U;
+  
+  /// Lazy compaction happens when new stati are at least 1/N of the total.
+  static constexpr std::size_t LazyCompactionFraction = 4U;
+  
+  
   GateEvolution_t fGateLevel; ///< Evolution of the gate in time.
   
+  /// Number of stati added since the last compaction (not persistent).
+  std::size_t fNewStati = 0U;
+  
   
   /// Returns a const-iterator to the status current at `tick`, or no value.
   std::optional<status_const_iterator> findLastStatusFor
@@ -470,6 +860,23 @@ class icarus::trigger::TriggerGateData {
   template <typename Op>
   status_const_iterator findStatus
     (Op op, ClockTick_t start = MinTick, ClockTick_t end = MaxTick) const;
+  
+  /**
+   * @brief Returns an iterator to the first status for which `op(status)` is
+   *        true.
+   * @param iStartStatus the last status at or before `start`
+   * @see `findStatus()`
+   */
+  template <typename Op>
+  status_const_iterator findStatusFrom(
+    Op op, status_const_iterator iStartStatus,
+    ClockTick_t start, ClockTick_t end
+    ) const;
+  
+  /// Implementation of `openingRange()` starting from the status `iStatus`,
+  /// current at the start of the range.
+  std::pair<OpeningCount_t, OpeningCount_t> openingRangeFrom
+    (status_const_iterator iStatus, ClockTick_t end) const;
 
   /// Returns an iterator to the first open status (@see `findOpen()`).
   status_const_iterator findOpenStatus(
@@ -487,8 +894,32 @@ class icarus::trigger::TriggerGateData {
   status_const_iterator findMaxOpenStatus
     (ClockTick_t start = MinTick, ClockTick_t end = MaxTick) const;
 
-  /// Maintenance operation: removes unconsequential stati.
-  void compact();
+  /// Records that `nNew` stati were added, and compacts lazily.
+  void registerNewStati(std::size_t nNew);
+  
+  /// Removes unconsequential stati from the specified gate evolution.
+  static void compact(GateEvolution_t& gateLevel);
+  
+  /**
+   * @brief Writes into `result` a combination of the openings of two gates.
+   * @param result the gate evolution to be filled (its content is replaced)
+   * @see `SymmetricCombination()`
+   * 
+   * The memory already allocated in `result` is reused. `result` must not be
+   * the evolution of either `a` or `b`.
+   */
+  template <typename Op>
+  static void SymmetricCombinationInto(
+    GateEvolution_t& result,
+    Op&& op, triggergatedata_t const& a, triggergatedata_t const& b,
+    ClockTicks_t aDelay = ClockTicks_t{},
+    ClockTicks_t bDelay = ClockTicks_t{}
+    );
+  
+  /// Combines `other` into this gate via `op`, using `buffer` memory.
+  template <typename Op>
+  triggergatedata_t& combineWithBuffer
+    (Op&& op, triggergatedata_t const& other, CombinationBuffer& buffer);
   
   
   /// Helper returning the starting state of the levels at construction time.
@@ -497,6 +928,345 @@ class icarus::trigger::TriggerGateData {
 }; // class icarus::trigger::TriggerGateData<>
 
 
+//------------------------------------------------------------------------------
+/**
+ * @brief Memory for the result of `TriggerGateData` combinations.
+ * 
+ * This object owns some memory which the combination operations of
+ * `TriggerGateData` (e.g. `TriggerGateData::Sum(other, buffer)`) fill
+ * with their result, and then swap with the levels of the target gate.
+ * The content of the buffer has no meaning for the caller.
+ */
+template <typename Tick, typename TickInterval>
+class icarus::trigger::TriggerGateData<Tick, TickInterval>
+  ::CombinationBuffer {
+  
+  friend triggergatedata_t;
+  
+  GateEvolution_t fLevels; ///< The buffer memory.
+  
+    public:
+  
+  /// Ensures the memory for a combination of `nStatus` stati is allocated.
+  void reserve(std::size_t nStatus) { fLevels.reserve(nStatus); }
+  
+  /// Returns the number of stati the buffer can currently hold.
+  std::size_t capacity() const { return fLevels.capacity(); }
+  
+}; // icarus::trigger::TriggerGateData<>::CombinationBuffer
+
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Summary of the opening of a gate in a tick range.
+ * @see `TriggerGateData::openingStats()`
+ */
+template <typename Tick, typename TickInterval>
+struct icarus::trigger::TriggerGateData<Tick, TickInterval>
+  ::OpeningStats {
+  
+  /// Number of ticks spent at each opening level (index is the opening).
+  std::vector<ClockTicks_t> ticksAtLevel;
+  
+  /// Number of times the gate opened within the range.
+  unsigned int nOpenings = 0U;
+  
+  /// Maximum opening within the range.
+  OpeningCount_t maxOpening = 0U;
+  
+  /// First tick (in the range) with the maximum opening.
+  ClockTick_t maxOpeningTick = MinTick;
+  
+  /// Returns the number of ticks with opening of at least `minOpening`.
+  ClockTicks_t ticksAtLeast(OpeningCount_t minOpening = 1U) const
+    {
+      ClockTicks_t ticks { 0 };
+      for (std::size_t level = minOpening; level < ticksAtLevel.size(); ++level)
+        ticks += ticksAtLevel[level];
+      return ticks;
+    }
+  
+}; // icarus::trigger::TriggerGateData<>::OpeningStats
+
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Query object for sequential access to a `TriggerGateData`.
+ * 
+ * The cursor keeps track of the status of the gate which was current at the
+ * last queried tick. New queries start from there, looking for the status at
+ * the new tick with a galloping search: the distance from the last position
+ * is doubled until the target is surpassed, and then a binary search is
+ * performed in the last (small) range. A scan over the gate at increasing
+ * ticks costs overall linear time in the number of stati instead of
+ * `O(n log n)`.
+ * 
+ * The cursor is invalidated by any change of the gate it was created from.
+ * 
+ * Example:
+ * @code
+ * auto cursor = gate.cursor();
+ * for (auto tick = start; tick < stop; ++tick)
+ *   if (cursor.openingCount(tick) >= threshold) ++nTicksAboveThreshold;
+ * @endcode
+ */
+template <typename Tick, typename TickInterval>
+class icarus::trigger::TriggerGateData<Tick, TickInterval>
+  ::Cursor {
+  
+    public:
+  
+  /// Constructor: points to the start of the gate.
+  explicit Cursor(triggergatedata_t const& gate)
+    : fGate(&gate), fCurrent(gate.fGateLevel.begin()) {}
+  
+  /// Returns the gate this cursor is scanning.
+  triggergatedata_t const& gate() const { return *fGate; }
+  
+  /// Returns the opening count of the gate at the specified `tick`.
+  /// @see `TriggerGateData::openingCount()`
+  OpeningCount_t openingCount(ClockTick_t tick)
+    { return seek(tick)->opening; }
+  
+  /// Returns whether the gate is open at all at the specified `tick`.
+  bool isOpen(ClockTick_t tick) { return openingCount(tick) > 0U; }
+  
+  /// Returns the tick at which the gate opened.
+  /// @see `TriggerGateData::findOpen()`
+  ClockTick_t findOpen(
+    OpeningCount_t minOpening = 1U,
+    ClockTick_t start = MinTick, ClockTick_t end = MaxTick
+    );
+  
+  /// Returns the tick at which the gate closed.
+  /// @see `TriggerGateData::findClose()`
+  ClockTick_t findClose(
+    OpeningCount_t minOpening = 1U,
+    ClockTick_t start = MinTick, ClockTick_t end = MaxTick
+    );
+  
+  /// Returns the range of opening values in the specified tick range.
+  /// @see `TriggerGateData::openingRange()`
+  std::pair<OpeningCount_t, OpeningCount_t> openingRange
+    (ClockTick_t start, ClockTick_t end);
+  
+  /// Moves the cursor back to the start of the gate.
+  void reset() { fCurrent = fGate->fGateLevel.begin(); }
+  
+    private:
+  
+  triggergatedata_t const* fGate; ///< The gate being scanned.
+  
+  status_const_iterator fCurrent; ///< Status current at the last query.
+  
+  /// Moves the cursor to the status current at `tick` and returns it.
+  /// @throw std::runtime_error if `tick` is before the start of the gate
+  status_const_iterator seek(ClockTick_t tick);
+  
+  /// Moves to the first status after `start` (included) satisfying `op`.
+  template <typename Op>
+  ClockTick_t find(Op op, ClockTick_t start, ClockTick_t end);
+  
+}; // icarus::trigger::TriggerGateData<>::Cursor
+
+
+//------------------------------------------------------------------------------
+/**
+ * @brief View of the part of a `TriggerGateData` in a tick range.
+ * 
+ * The view refers to an existing gate (which must outlive it, unchanged) and
+ * behaves like a gate which is closed outside the range [ `start()`,
+ * `end()` [ and follows the viewed gate inside it. Specifically, its stati
+ * are:
+ * * a status at `start()` with the opening of the gate at that tick;
+ * * all the stati of the gate after `start()` and before `end()`;
+ * * a status at `end()` closing the gate (unless `end()` is `MaxTick`).
+ * An empty range is always closed.
+ * 
+ * The queries have the same meaning as the ones of `TriggerGateData`, and
+ * the combinations (`Min()`, `Max()`, `Sum()`, `Mul()`) create a new gate
+ * from two views, reading the stati of the viewed gates in place.
+ * For example, a beam gate can be applied to all channels with no copy of
+ * each channel gate:
+ * @code
+ * for (auto const& gate: gates) {
+ *   auto const inBeam = gate.range(beamStart, beamEnd);
+ *   if (inBeam.alwaysClosed()) continue;
+ *   auto const triggerTick = inBeam.findOpen(threshold);
+ *   // ...
+ * }
+ * @endcode
+ */
+template <typename Tick, typename TickInterval>
+class icarus::trigger::TriggerGateData<Tick, TickInterval>
+  ::RangeView {
+  
+    public:
+  
+  /// Constructor: view of `gate` in [ `start`, `end` [.
+  RangeView(triggergatedata_t const& gate, ClockTick_t start, ClockTick_t end);
+  
+  /// Returns the viewed gate.
+  triggergatedata_t const& gate() const { return *fGate; }
+  
+  /// Returns the first tick of the range.
+  ClockTick_t start() const { return fStart; }
+  
+  /// Returns the first tick after the range.
+  ClockTick_t end() const { return fEnd; }
+  
+  /// Returns whether the range is empty.
+  bool empty() const { return fStart >= fEnd; }
+  
+  /// Returns whether `tick` is in the range.
+  bool contains(ClockTick_t tick) const
+    { return (tick >= fStart) && (tick < fEnd); }
+  
+  
+  // --- BEGIN -- Queries ------------------------------------------------------
+  /// Returns the opening count of the view at the specified `tick`.
+  /// @see `TriggerGateData::openingCount()`
+  OpeningCount_t openingCount(ClockTick_t tick) const;
+  
+  /// Returns whether the view is open at all at the specified `tick`.
+  bool isOpen(ClockTick_t tick) const { return openingCount(tick) > 0U; }
+  
+  /// Returns whether the view never opens.
+  bool alwaysClosed() const { return findOpen() == MaxTick; }
+  
+  /// Returns the tick at which the view opened, or `end` if never.
+  /// @see `TriggerGateData::findOpen()`
+  ClockTick_t findOpen(
+    OpeningCount_t minOpening = 1U,
+    ClockTick_t start = MinTick, ClockTick_t end = MaxTick
+    ) const;
+  
+  /// Returns the tick at which the view closed, or `end` if never.
+  /// @see `TriggerGateData::findClose()`
+  ClockTick_t findClose(
+    OpeningCount_t minOpening = 1U,
+    ClockTick_t start = MinTick, ClockTick_t end = MaxTick
+    ) const;
+  
+  /// Returns the first tick in [ `start`, `end` [ with the maximum opening,
+  /// `end` if the interval is empty.
+  ClockTick_t findMaxOpen
+    (ClockTick_t start = MinTick, ClockTick_t end = MaxTick) const;
+  // --- END ---- Queries ------------------------------------------------------
+  
+  
+  // --- BEGIN -- Combinations -------------------------------------------------
+  /// Returns a gate with the same stati as this view.
+  triggergatedata_t toGate() const;
+  
+  //@{
+  /// Returns the gate with the combination of the openings of two views.
+  /// @see `TriggerGateData::Min()`, `TriggerGateData::Max()`, ...
+  static triggergatedata_t Min(RangeView const& a, RangeView const& b);
+  static triggergatedata_t Max(RangeView const& a, RangeView const& b);
+  static triggergatedata_t Sum(RangeView const& a, RangeView const& b);
+  static triggergatedata_t Mul(RangeView const& a, RangeView const& b);
+  //@}
+  
+  /// Returns the gate combining the openings of two views with `op`.
+  /// @see `TriggerGateData::SymmetricCombination()`
+  template <typename Op>
+  static triggergatedata_t SymmetricCombination
+    (Op&& op, RangeView const& a, RangeView const& b);
+  // --- END ---- Combinations -------------------------------------------------
+  
+  
+    private:
+  
+  /// Iterates through the stati of a view, in tick order.
+  class StatusWalker;
+  
+  triggergatedata_t const* fGate; ///< The viewed gate.
+  
+  ClockTick_t fStart; ///< First tick of the range.
+  
+  ClockTick_t fEnd; ///< First tick after the range.
+  
+  status_const_iterator fFirst; ///< First gate status after `fStart`.
+  
+  status_const_iterator fLast; ///< First gate status at or after `fEnd`.
+  
+  OpeningCount_t fStartOpening; ///< Opening of the gate at `fStart`.
+  
+  /// Returns the first status tick in [ `start`, `end` [ satisfying `op`.
+  template <typename Op>
+  ClockTick_t find(Op op, ClockTick_t start, ClockTick_t end) const;
+  
+}; // icarus::trigger::TriggerGateData<>::RangeView
+
+
+//------------------------------------------------------------------------------
+/**
+ * @brief View of a gate shifted later in time by a fixed delay.
+ * @tparam Gate type of the gate
+ * 
+ * This object refers to an existing gate (which must outlive it) and adds
+ * a delay to it, without copying it. It is used as argument of the delayed
+ * combinations of gates (e.g. `TriggerGateData::Min(DelayedGate, DelayedGate)`)
+ * and it can be queried for the opening of the delayed gate.
+ * A view of a derived gate type can be converted into a view of its base.
+ * 
+ * Views are usually created with `icarus::trigger::delayed()`.
+ */
+template <typename Gate>
+class icarus::trigger::DelayedGate {
+  
+    public:
+  
+  using Gate_t = Gate; ///< Type of the gate.
+  
+  using ClockTick_t = typename Gate_t::ClockTick_t; ///< Tick point.
+  using ClockTicks_t = typename Gate_t::ClockTicks_t; ///< Tick interval.
+  
+  /// Type of count of number of open channels.
+  using OpeningCount_t = typename Gate_t::OpeningCount_t;
+  
+  
+  /// Constructor: view of `gate` delayed by `delay` ticks.
+  DelayedGate(Gate_t const& gate, ClockTicks_t delay)
+    : fGate(&gate), fDelay(delay) {}
+  
+  /// Constructor: view of the base part of a view of a derived gate.
+  template <
+    typename Other,
+    typename = std::enable_if_t<std::is_base_of_v<Gate_t, Other>>
+    >
+  DelayedGate(DelayedGate<Other> const& other)
+    : DelayedGate(other.gate(), other.delay()) {}
+  
+  /// Returns the (not delayed) gate.
+  Gate_t const& gate() const { return *fGate; }
+  
+  /// Returns the delay of the gate.
+  ClockTicks_t delay() const { return fDelay; }
+  
+  /// Returns the opening count of the delayed gate at the specified `tick`.
+  OpeningCount_t openingCount(ClockTick_t tick) const
+    { return fGate->openingCount(tick - fDelay); }
+  
+  /// Returns whether the delayed gate is open at the specified `tick`.
+  bool isOpen(ClockTick_t tick) const { return fGate->isOpen(tick - fDelay); }
+  
+    private:
+  
+  Gate_t const* fGate; ///< The gate.
+  
+  ClockTicks_t fDelay; ///< The delay.
+  
+}; // icarus::trigger::DelayedGate<>
+
+
+template <typename Gate>
+icarus::trigger::DelayedGate<Gate> icarus::trigger::delayed
+  (Gate const& gate, typename Gate::ClockTicks_t delay)
+  { return { gate, delay }; }
+
+
 //------------------------------------------------------------------------------
 //--- Template implementation
 //------------------------------------------------------------------------------
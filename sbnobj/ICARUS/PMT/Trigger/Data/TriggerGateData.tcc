@@ -12,10 +12,13 @@
 // C/C++ standard libraries
 #include <ostream>
 #include <stdexcept> // std::runtime_error
-#include <algorithm> // std::min(), std::max(), std::upper_bound()
+#include <algorithm> // std::min(), std::max(), std::upper_bound(), std::sort(), ...
 #include <utility> // std::move(), std::swap()
 #include <functional> // std::plus<>, std::multiplies<>
 #include <iterator> // std::prev(), std::next()
+#include <type_traits> // std::is_integral_v, std::make_unsigned_t
+#include <cstdint> // std::uint8_t, std::uint64_t
+#include <cstddef> // std::ptrdiff_t
 #include <cassert>
 
 
@@ -44,6 +47,7 @@ auto icarus::trigger::TriggerGateData<TK, TI>::findOpen(
   ClockTick_t start /* = MinTick */, ClockTick_t end /* = MaxTick */
 ) const -> ClockTick_t
 {
+  details::countGateStat(&TriggerGateStats::queries);
   auto iStatus = findOpenStatus(minOpening, start, end);
   return (iStatus == fGateLevel.end())? end: iStatus->tick;
 } // icarus::trigger::TriggerGateData<>::findOpen()
@@ -56,6 +60,7 @@ auto icarus::trigger::TriggerGateData<TK, TI>::findClose(
   ClockTick_t start /* = MinTick */, ClockTick_t end /* = MaxTick */
 ) const -> ClockTick_t
 {
+  details::countGateStat(&TriggerGateStats::queries);
   auto iStatus = findCloseStatus(minOpening, start, end);
   return (iStatus == fGateLevel.end())? end: iStatus->tick;
 } // icarus::trigger::TriggerGateData<>::findClose()
@@ -67,6 +72,7 @@ auto icarus::trigger::TriggerGateData<TK, TI>::findMaxOpen
   (ClockTick_t start /* = MinTick */, ClockTick_t end /* = MaxTick */) const
   -> ClockTick_t
 {
+  details::countGateStat(&TriggerGateStats::queries);
   auto iStatus = findMaxOpenStatus(start, end);
   // the iterator could point to a status change before the target interval...
   return (iStatus == fGateLevel.end())? end: std::max(iStatus->tick, start);
@@ -75,7 +81,9 @@ auto icarus::trigger::TriggerGateData<TK, TI>::findMaxOpen
 
 //------------------------------------------------------------------------------
 template <typename TK, typename TI>
-void icarus::trigger::TriggerGateData<TK, TI>::compact() {
+void icarus::trigger::TriggerGateData<TK, TI>::compact
+  (GateEvolution_t& gateLevel)
+{
   
   /*
    * Removes:
@@ -87,8 +95,10 @@ void icarus::trigger::TriggerGateData<TK, TI>::compact() {
    * 
    */
   
-  auto const send = fGateLevel.end();
-  auto iLast = fGateLevel.begin(); // last good status
+  details::countGateStat(&TriggerGateStats::compactions);
+  
+  auto const send = gateLevel.end();
+  auto iLast = gateLevel.begin(); // last good status
   auto iDest = std::next(iLast); // the status next to be assigned
   auto iTest = iDest; // the next status candidate
   
@@ -114,11 +124,28 @@ void icarus::trigger::TriggerGateData<TK, TI>::compact() {
     
   } // while
   
-  fGateLevel.erase(iDest, send);
+  gateLevel.erase(iDest, send);
   
 } // icarus::trigger::TriggerGateData<>::compact()
 
 
+//------------------------------------------------------------------------------
+template <typename TK, typename TI>
+void icarus::trigger::TriggerGateData<TK, TI>::registerNewStati
+  (std::size_t nNew)
+{
+  /*
+   * Each compaction costs a pass on all the stati; doing it only when the
+   * new stati are a fixed fraction of the total makes that cost constant
+   * per added status, on average, and it bounds the number of redundant ones.
+   */
+  fNewStati += nNew;
+  if (fNewStati < LazyCompactionMinStati) return;
+  if (fNewStati * LazyCompactionFraction < fGateLevel.size()) return;
+  compact();
+} // icarus::trigger::TriggerGateData<>::registerNewStati()
+
+
 //------------------------------------------------------------------------------
 template <typename TK, typename TI>
 auto icarus::trigger::TriggerGateData<TK, TI>::openingRange
@@ -136,11 +163,22 @@ auto icarus::trigger::TriggerGateData<TK, TI>::openingRange
   
   // look where to start from; if the start tick is before the start of the
   // gate, fast forward to the actual start of the gate
-  auto const send = fGateLevel.end();
   auto const maybeStatusIter = findLastStatusFor(start);
   auto iStatus = maybeStatusIter? maybeStatusIter.value(): fGateLevel.begin();
   assert(iStatus != fGateLevel.end());
   
+  return openingRangeFrom(iStatus, end);
+} // icarus::trigger::TriggerGateData<>::openingRange()
+
+
+//------------------------------------------------------------------------------
+template <typename TK, typename TI>
+auto icarus::trigger::TriggerGateData<TK, TI>::openingRangeFrom
+  (status_const_iterator iStatus, ClockTick_t end) const
+  -> std::pair<OpeningCount_t, OpeningCount_t> 
+{
+  auto const send = fGateLevel.end();
+  
   // so the requested range is fully before the start of the gate: bail out!
   if (iStatus->tick >= end) return { {}, {} };
   
@@ -157,7 +195,112 @@ auto icarus::trigger::TriggerGateData<TK, TI>::openingRange
   } // while
   
   return limits;
-} // icarus::trigger::TriggerGateData<>::openingRange()
+} // icarus::trigger::TriggerGateData<>::openingRangeFrom()
+
+
+//------------------------------------------------------------------------------
+template <typename TK, typename TI>
+auto icarus::trigger::TriggerGateData<TK, TI>::openingStats
+  (ClockTick_t start, ClockTick_t end, OpeningCount_t minOpening /* = 1U */)
+  const -> OpeningStats
+{
+  assert(!fGateLevel.empty());
+  
+  OpeningStats stats;
+  if (start >= end) return stats;
+  
+  auto const addTicks = [&stats](OpeningCount_t opening, ClockTicks_t ticks)
+    {
+      if (stats.ticksAtLevel.size() <= opening)
+        stats.ticksAtLevel.resize(opening + 1, ClockTicks_t{ 0 });
+      stats.ticksAtLevel[opening] += ticks;
+    };
+  
+  auto const maybeStatusIter = findLastStatusFor(start);
+  auto iStatus = maybeStatusIter? maybeStatusIter.value(): fGateLevel.begin();
+  auto const send = fGateLevel.end();
+  
+  ClockTick_t tick = std::max(start, iStatus->tick);
+  OpeningCount_t opening = iStatus->opening;
+  stats.maxOpening = opening;
+  stats.maxOpeningTick = tick;
+  
+  while ((++iStatus != send) && (iStatus->tick < end)) {
+    
+    addTicks(opening, iStatus->tick - tick);
+    
+    OpeningCount_t const newOpening = iStatus->opening;
+    if ((opening < minOpening) && (newOpening >= minOpening)) ++stats.nOpenings;
+    if (newOpening > stats.maxOpening) {
+      stats.maxOpening = newOpening;
+      stats.maxOpeningTick = iStatus->tick;
+    }
+    
+    opening = newOpening;
+    tick = iStatus->tick;
+  } // while
+  addTicks(opening, end - tick);
+  
+  return stats;
+} // icarus::trigger::TriggerGateData<>::openingStats()
+
+
+//------------------------------------------------------------------------------
+template <typename TK, typename TI>
+template <typename OTK, typename OTI>
+auto icarus::trigger::TriggerGateData<TK, TI>::convertFrom
+  (TriggerGateData<OTK, OTI> const& other) -> triggergatedata_t
+{
+  using OtherGate_t = TriggerGateData<OTK, OTI>;
+  using std::to_string;
+  
+  auto const convertTick = [](OTK tick) -> ClockTick_t
+    {
+      if (tick == OtherGate_t::MinTick) return MinTick;
+      if (tick == OtherGate_t::MaxTick) return MaxTick;
+      if ((tick < MinTick) || (tick > MaxTick)) {
+        throw std::runtime_error(
+          "icarus::trigger::TriggerGateData::convertFrom(): tick "
+          + to_string(tick) + " out of the supported range"
+          );
+      }
+      return static_cast<ClockTick_t>(tick);
+    };
+  
+  auto const convertOpening = [](typename OtherGate_t::OpeningCount_t opening) -> OpeningCount_t
+    {
+      if (opening > std::numeric_limits<OpeningCount_t>::max()) {
+        throw std::runtime_error(
+          "icarus::trigger::TriggerGateData::convertFrom(): opening "
+          + to_string(opening) + " out of the supported range"
+          );
+      }
+      return static_cast<OpeningCount_t>(opening);
+    };
+  
+  triggergatedata_t gate;
+  gate.fGateLevel.clear();
+  gate.fGateLevel.reserve(other.fGateLevel.size());
+  details::countGateStat(&TriggerGateStats::allocations);
+  for (auto const& status: other.fGateLevel) {
+    gate.fGateLevel.emplace_back
+      (status.event, convertTick(status.tick), convertOpening(status.opening));
+  }
+  return gate;
+} // icarus::trigger::TriggerGateData<>::convertFrom()
+
+
+//------------------------------------------------------------------------------
+template <typename TK, typename TI>
+auto icarus::trigger::TriggerGateData<TK, TI>::cursor() const -> Cursor
+  { return Cursor{ *this }; }
+
+
+//------------------------------------------------------------------------------
+template <typename TK, typename TI>
+auto icarus::trigger::TriggerGateData<TK, TI>::range
+  (ClockTick_t start, ClockTick_t end) const -> RangeView
+  { return RangeView{ *this, start, end }; }
 
 
 //------------------------------------------------------------------------------
@@ -165,19 +308,105 @@ template <typename TK, typename TI>
 auto icarus::trigger::TriggerGateData<TK, TI>::openingCount
   (ClockTick_t tick) const -> OpeningCount_t
 {
+  details::countGateStat(&TriggerGateStats::queries);
   return findLastStatusForTickOrThrow(tick)->opening;
 } // icarus::trigger::TriggerGateData<>::openingCount()
 
 
+//------------------------------------------------------------------------------
+template <typename TK, typename TI>
+void icarus::trigger::TriggerGateData<TK, TI>::openingCounts
+  (ClockTick_t const* ticks, std::size_t nTicks, OpeningCount_t* counts) const
+{
+  if (nTicks == 0U) return;
+  details::countGateStat(&TriggerGateStats::queries, nTicks);
+  
+  // this also checks that the first (hence all) ticks are in the gate
+  auto iStatus = findLastStatusForTickOrThrow(ticks[0]);
+  auto const send = fGateLevel.end();
+  
+  for (std::size_t i = 0; i < nTicks; ++i) {
+    ClockTick_t const tick = ticks[i];
+    assert((i == 0) || (ticks[i - 1] <= tick));
+    auto iNext = std::next(iStatus);
+    while ((iNext != send) && (iNext->tick <= tick)) iStatus = iNext++;
+    counts[i] = iStatus->opening;
+  } // for
+  
+} // icarus::trigger::TriggerGateData<>::openingCounts()
+
+
+//------------------------------------------------------------------------------
+template <typename TK, typename TI>
+void icarus::trigger::TriggerGateData<TK, TI>::openingCountsUnsorted
+  (ClockTick_t const* ticks, std::size_t nTicks, OpeningCount_t* counts) const
+{
+  if (nTicks == 0U) return;
+  details::countGateStat(&TriggerGateStats::queries, nTicks);
+  
+  // only the earliest tick can be before the gate start
+  findLastStatusForTickOrThrow(*std::min_element(ticks, ticks + nTicks));
+  
+  Status const* const stati = fGateLevel.data();
+  std::size_t const nStati = fGateLevel.size();
+  for (std::size_t i = 0; i < nTicks; ++i) {
+    ClockTick_t const tick = ticks[i];
+    // invariant: the last status not after `tick` is in [ base, base + n [
+    Status const* base = stati;
+    std::size_t n = nStati;
+    while (n > 1U) {
+      std::size_t const half = n / 2U;
+      base = (base[half].tick <= tick)? base + half: base;
+      n -= half;
+    } // while
+    counts[i] = base->opening;
+  } // for
+  
+} // icarus::trigger::TriggerGateData<>::openingCountsUnsorted()
+
+
+//------------------------------------------------------------------------------
+template <typename TK, typename TI>
+auto icarus::trigger::TriggerGateData<TK, TI>::openingCounts
+  (std::vector<ClockTick_t> const& ticks) const -> std::vector<OpeningCount_t>
+{
+  std::vector<OpeningCount_t> counts(ticks.size());
+  if (std::is_sorted(ticks.begin(), ticks.end()))
+    openingCounts(ticks.data(), ticks.size(), counts.data());
+  else
+    openingCountsUnsorted(ticks.data(), ticks.size(), counts.data());
+  return counts;
+} // icarus::trigger::TriggerGateData<>::openingCounts(vector)
+
+
 //------------------------------------------------------------------------------
 template <typename TK, typename TI>
 void icarus::trigger::TriggerGateData<TK, TI>::setOpeningAt
   (ClockTick_t tick, OpeningCount_t openingCount)
 {
+  assert(!fGateLevel.empty());
+  
+  //
+  // fast path: at or after the last status, there is nothing to search for
+  // and nothing following to update
+  //
+  if (Status& last = fGateLevel.back(); tick >= last.tick) {
+    if (last.tick == tick) { // overwrite the previous action
+      last.event = EventType::Set;
+      last.opening = openingCount;
+    }
+    else {
+      fGateLevel.push_back({ EventType::Set, tick, openingCount });
+      registerNewStati(1U);
+    }
+    return;
+  }
+  
   //
   // first find where to start acting
   //
   auto iStatus = findLastStatusForTickOrThrow(tick); // may be before the tick
+  std::size_t nNewStati = 0U;
   
   //
   // set the current status (possibly a new one)
@@ -190,6 +419,7 @@ void icarus::trigger::TriggerGateData<TK, TI>::setOpeningAt
     // insert the new status after iStatus
     iStatus = fGateLevel.insert
       (++iStatus, { EventType::Set, tick, openingCount });
+    ++nNewStati;
   }
   
   //
@@ -203,6 +433,7 @@ void icarus::trigger::TriggerGateData<TK, TI>::setOpeningAt
         iStatus = fGateLevel.erase(iStatus);
         break;
       case EventType::Set: // the later Set event takes over, we are done
+        registerNewStati(nNewStati);
         return;
       case EventType::Unknown: // not sure about this... let's keep going
         ++iStatus;
@@ -210,6 +441,8 @@ void icarus::trigger::TriggerGateData<TK, TI>::setOpeningAt
     } // switch event type
   }
   
+  registerNewStati(nNewStati);
+  
 } // icarus::trigger::TriggerGateData<>::setOpeningAt()
 
 
@@ -229,10 +462,35 @@ void icarus::trigger::TriggerGateData<TK, TI>::openBetween
    */
   if (start >= end) return; // weird, yet valid
   
+  assert(!fGateLevel.empty());
+  
+  //
+  // (0) fast path: a gate filled in tick order opens at or after its last
+  //     status; then there is no status to search for or to update, and both
+  //     opening and closing are appended at the end
+  //
+  if (Status& last = fGateLevel.back(); start >= last.tick) {
+    OpeningCount_t const closedOpening = last.opening;
+    std::size_t nNewStati = 1U; // the closing
+    if (last.tick == start) {
+      if (last.event == EventType::Unknown) last.event = EventType::Shift;
+      last.opening += count;
+    }
+    else {
+      OpeningCount_t const opening = closedOpening + count;
+      fGateLevel.push_back({ EventType::Shift, start, opening });
+      ++nNewStati;
+    }
+    fGateLevel.push_back({ EventType::Shift, end, closedOpening });
+    registerNewStati(nNewStati);
+    return;
+  }
+  
   //
   // (1) first find where to start acting
   //
   auto iStatus = findLastStatusForTickOrThrow(start); // may be before the start
+  std::size_t nNewStati = 0U;
   
   //
   // (2) set the current status (possibly a new one)
@@ -250,9 +508,10 @@ void icarus::trigger::TriggerGateData<TK, TI>::openBetween
   }
   else { // no status exactly at start tick, iStatus is just before
     // insert the new status after iStatus
-    auto const opening = iStatus->opening + count;
+    OpeningCount_t const opening = iStatus->opening + count;
     iStatus = fGateLevel.insert
       (++iStatus, { EventType::Shift, start, opening });
+    ++nNewStati;
   }
   
   //
@@ -283,6 +542,7 @@ void icarus::trigger::TriggerGateData<TK, TI>::openBetween
         iStatus->opening += count;
         break;
       case EventType::Set: // (4.1) Set event takes over, we are done
+        registerNewStati(nNewStati);
         return;
       case EventType::Unknown: // not sure about this... let's keep going
         break;
@@ -307,23 +567,20 @@ void icarus::trigger::TriggerGateData<TK, TI>::openBetween
   }
   else { // no status exactly at this tick, just need to insert one
     // insert the new status before iStatus;
-    // the correct opening now is the last one, minus what we added;
-    // it is also the status in iStatus, if it exists
+    // the correct opening now is the last one, minus what we added
+    // (the status in iStatus, if any, may be already affected by other
+    // openings starting between `start` and `end`)
     assert(iStatus != fGateLevel.begin()); // we must have added one status!
     
-    auto const opening = (iStatus == fGateLevel.end())
-      ? (std::prev(iStatus)->opening - count): (iStatus->opening);
-    
-    // checking that if the two branches above are both available, they match;
-    // the branch above just takes the easier way when available
-    assert((iStatus == fGateLevel.end())
-      || (opening == (std::prev(iStatus)->opening - count))
-      );
+    OpeningCount_t const opening = std::prev(iStatus)->opening - count;
     
     iStatus = fGateLevel.insert(iStatus, { EventType::Shift, end, opening });
+    ++nNewStati;
   }
   // if we get here, now iStatus contains the gate closing (for what we care)
   
+  registerNewStati(nNewStati);
+  
 } // icarus::trigger::TriggerGateData<>::openFor()
 
 
@@ -333,6 +590,7 @@ auto icarus::trigger::TriggerGateData<TK, TI>::Min
   (TriggerGateData const& other) -> triggergatedata_t&
 {
   fGateLevel = std::move(TriggerGateData::Min(*this, other).fGateLevel);
+  fNewStati = 0U; // combination results are already compact
   return *this;
 } // icarus::trigger::TriggerGateData<>::Min()
 
@@ -343,6 +601,7 @@ auto icarus::trigger::TriggerGateData<TK, TI>::Max
   (TriggerGateData const& other) -> triggergatedata_t&
 {
   fGateLevel = std::move(TriggerGateData::Max(*this, other).fGateLevel);
+  fNewStati = 0U; // combination results are already compact
   return *this;
 } // icarus::trigger::TriggerGateData<>::Max()
 
@@ -353,6 +612,7 @@ auto icarus::trigger::TriggerGateData<TK, TI>::Sum
   (TriggerGateData const& other) -> triggergatedata_t&
 {
   fGateLevel = std::move(TriggerGateData::Sum(*this, other).fGateLevel);
+  fNewStati = 0U; // combination results are already compact
   return *this;
 } // icarus::trigger::TriggerGateData<>::Sum()
 
@@ -363,10 +623,78 @@ auto icarus::trigger::TriggerGateData<TK, TI>::Mul
   (TriggerGateData const& other) -> triggergatedata_t&
 {
   fGateLevel = std::move(TriggerGateData::Mul(*this, other).fGateLevel);
+  fNewStati = 0U; // combination results are already compact
   return *this;
 } // icarus::trigger::TriggerGateData<>::Mul()
 
 
+//------------------------------------------------------------------------------
+template <typename TK, typename TI>
+auto icarus::trigger::TriggerGateData<TK, TI>::Min
+  (TriggerGateData const& other, CombinationBuffer& buffer)
+  -> triggergatedata_t&
+{
+  return combineWithBuffer
+    ([](OpeningCount_t a, OpeningCount_t b){ return std::min(a, b); },
+     other, buffer);
+} // icarus::trigger::TriggerGateData<>::Min(CombinationBuffer)
+
+
+//------------------------------------------------------------------------------
+template <typename TK, typename TI>
+auto icarus::trigger::TriggerGateData<TK, TI>::Max
+  (TriggerGateData const& other, CombinationBuffer& buffer)
+  -> triggergatedata_t&
+{
+  return combineWithBuffer
+    ([](OpeningCount_t a, OpeningCount_t b){ return std::max(a, b); },
+     other, buffer);
+} // icarus::trigger::TriggerGateData<>::Max(CombinationBuffer)
+
+
+//------------------------------------------------------------------------------
+template <typename TK, typename TI>
+auto icarus::trigger::TriggerGateData<TK, TI>::Sum
+  (TriggerGateData const& other, CombinationBuffer& buffer)
+  -> triggergatedata_t&
+{
+  return combineWithBuffer(std::plus<OpeningCount_t>(), other, buffer);
+} // icarus::trigger::TriggerGateData<>::Sum(CombinationBuffer)
+
+
+//------------------------------------------------------------------------------
+template <typename TK, typename TI>
+auto icarus::trigger::TriggerGateData<TK, TI>::Mul
+  (TriggerGateData const& other, CombinationBuffer& buffer)
+  -> triggergatedata_t&
+{
+  return combineWithBuffer(std::multiplies<OpeningCount_t>(), other, buffer);
+} // icarus::trigger::TriggerGateData<>::Mul(CombinationBuffer)
+
+
+//------------------------------------------------------------------------------
+template <typename TK, typename TI>
+template <typename Op>
+auto icarus::trigger::TriggerGateData<TK, TI>::combineWithBuffer
+  (Op&& op, TriggerGateData const& other, CombinationBuffer& buffer)
+  -> triggergatedata_t&
+{
+  // grow geometrically, so that a few combinations are enough to warm up
+  GateEvolution_t& levels = buffer.fLevels;
+  std::size_t const nStatus = fGateLevel.size() + other.fGateLevel.size() - 1U;
+  if (levels.capacity() < nStatus) {
+    levels.reserve(std::max(nStatus, 2 * levels.capacity()));
+    details::countGateStat(&TriggerGateStats::allocations);
+  }
+
+  SymmetricCombinationInto
+    (buffer.fLevels, std::forward<Op>(op), *this, other);
+  std::swap(fGateLevel, buffer.fLevels); // the old levels are the new buffer
+  fNewStati = 0U; // combination results are already compact
+  return *this;
+} // icarus::trigger::TriggerGateData<>::combineWithBuffer()
+
+
 //------------------------------------------------------------------------------
 template <typename TK, typename TI>
 auto icarus::trigger::TriggerGateData<TK, TI>::Min
@@ -405,6 +733,60 @@ auto icarus::trigger::TriggerGateData<TK, TI>::Mul
 } // icarus::trigger::TriggerGateData<>::Mul()
 
 
+//------------------------------------------------------------------------------
+template <typename TK, typename TI>
+auto icarus::trigger::TriggerGateData<TK, TI>::Min(
+  DelayedGate<triggergatedata_t> const& a,
+  DelayedGate<triggergatedata_t> const& b
+) -> triggergatedata_t
+{
+  return SymmetricCombination(
+    [](OpeningCount_t a, OpeningCount_t b){ return std::min(a, b); },
+    a.gate(), b.gate(), a.delay(), b.delay()
+    );
+} // icarus::trigger::TriggerGateData<>::Min(DelayedGate)
+
+
+//------------------------------------------------------------------------------
+template <typename TK, typename TI>
+auto icarus::trigger::TriggerGateData<TK, TI>::Max(
+  DelayedGate<triggergatedata_t> const& a,
+  DelayedGate<triggergatedata_t> const& b
+) -> triggergatedata_t
+{
+  return SymmetricCombination(
+    [](OpeningCount_t a, OpeningCount_t b){ return std::max(a, b); },
+    a.gate(), b.gate(), a.delay(), b.delay()
+    );
+} // icarus::trigger::TriggerGateData<>::Max(DelayedGate)
+
+
+//------------------------------------------------------------------------------
+template <typename TK, typename TI>
+auto icarus::trigger::TriggerGateData<TK, TI>::Sum(
+  DelayedGate<triggergatedata_t> const& a,
+  DelayedGate<triggergatedata_t> const& b
+) -> triggergatedata_t
+{
+  return SymmetricCombination
+    (std::plus<OpeningCount_t>(), a.gate(), b.gate(), a.delay(), b.delay());
+} // icarus::trigger::TriggerGateData<>::Sum(DelayedGate)
+
+
+//------------------------------------------------------------------------------
+template <typename TK, typename TI>
+auto icarus::trigger::TriggerGateData<TK, TI>::Mul(
+  DelayedGate<triggergatedata_t> const& a,
+  DelayedGate<triggergatedata_t> const& b
+) -> triggergatedata_t
+{
+  return SymmetricCombination(
+    std::multiplies<OpeningCount_t>(),
+    a.gate(), b.gate(), a.delay(), b.delay()
+    );
+} // icarus::trigger::TriggerGateData<>::Mul(DelayedGate)
+
+
 //------------------------------------------------------------------------------
 template <typename TK, typename TI>
 template <typename Op>
@@ -412,6 +794,24 @@ auto icarus::trigger::TriggerGateData<TK, TI>::SymmetricCombination(
   Op&& op, triggergatedata_t const& a, triggergatedata_t const& b,
   ClockTicks_t aDelay /* = { 0 } */, ClockTicks_t bDelay /* { = 0 } */
 ) -> triggergatedata_t {
+  
+  GateEvolution_t resultLevels;
+  SymmetricCombinationInto
+    (resultLevels, std::forward<Op>(op), a, b, aDelay, bDelay);
+  resultLevels.shrink_to_fit();
+  
+  return { std::move(resultLevels) };
+} // icarus::trigger::TriggerGateData<>::SymmetricCombination()
+
+
+//------------------------------------------------------------------------------
+template <typename TK, typename TI>
+template <typename Op>
+void icarus::trigger::TriggerGateData<TK, TI>::SymmetricCombinationInto(
+  GateEvolution_t& resultLevels,
+  Op&& op, triggergatedata_t const& a, triggergatedata_t const& b,
+  ClockTicks_t aDelay /* = { 0 } */, ClockTicks_t bDelay /* { = 0 } */
+) {
   /*
    * Combines two gates into a new one.
    * The new gate is created directly event by event.
@@ -533,10 +933,15 @@ auto icarus::trigger::TriggerGateData<TK, TI>::SymmetricCombination(
   }; // struct State
   
   
-  // prepare the container of the combination:
-  triggergatedata_t result;
-  auto& resultLevels = result.fGateLevel;
+  assert(&resultLevels != &a.fGateLevel);
+  assert(&resultLevels != &b.fGateLevel);
+  
+  // prepare the container of the combination (reusing its memory):
+  resultLevels.clear();
+  if (resultLevels.capacity() < a.fGateLevel.size() + b.fGateLevel.size() - 1U)
+    details::countGateStat(&TriggerGateStats::allocations);
   resultLevels.reserve(a.fGateLevel.size() + b.fGateLevel.size() - 1U);
+  resultLevels.push_back(NewGateStatus);
   
   // the state automatically selects the earliest as start
   State state(a, b, aDelay, bDelay);
@@ -574,11 +979,378 @@ auto icarus::trigger::TriggerGateData<TK, TI>::SymmetricCombination(
     
   } // while
   
-  result.compact();
-  resultLevels.shrink_to_fit();
+  compact(resultLevels);
+  
+  details::countGateCombination
+    (a.fGateLevel.size() + b.fGateLevel.size(), resultLevels.size());
   
+} // icarus::trigger::TriggerGateData<>::SymmetricCombinationInto()
+
+
+//------------------------------------------------------------------------------
+template <typename TK, typename TI>
+template <typename Op, typename Gates, typename Delays>
+auto icarus::trigger::TriggerGateData<TK, TI>::Combine
+  (Op&& op, Gates const& gates, Delays const& delays) -> triggergatedata_t
+{
+  /*
+   * Combines all the gates into a new one, with a single k-way merge.
+   *
+   * The next status of each input gate is kept in a heap sorted by tick.
+   * The current opening of each input gate is a leaf of a binary tree
+   * in which each node holds the combination of its two children, so that
+   * the root is always the combination of all the gates; when a gate
+   * changes its opening, only the path from its leaf to the root is updated.
+   * After all the changes at a given tick are applied, a new status is added
+   * to the result if the combined opening has changed.
+   *
+   */
+  using std::begin, std::end;
+
+  struct Cursor_t {
+    status_const_iterator iStatus; ///< Next status to be processed.
+    status_const_iterator send; ///< End of the status list.
+    ClockTicks_t delay; ///< Delay to be added to the ticks of this gate.
+
+    ClockTick_t tick() const { return iStatus->tick + delay; }
+  }; // Cursor_t
+
+  struct NextStatus_t {
+    ClockTick_t tick; ///< Delayed tick of the status.
+    std::size_t index; ///< Index of the gate in the input list.
+
+    /// Heap ordering: the earliest status has the highest priority.
+    bool operator< (NextStatus_t const& other) const
+      {
+        return (tick != other.tick)
+          ? (tick > other.tick): (index > other.index);
+      }
+  }; // NextStatus_t
+
+  triggergatedata_t result;
+
+  std::size_t const nGates = std::distance(begin(gates), end(gates));
+  if (nGates == 0U) return result;
+
+  std::size_t const nDelays = std::distance(begin(delays), end(delays));
+  if ((nDelays != 0U) && (nDelays != nGates)) {
+    using std::to_string;
+    throw std::runtime_error(
+      "icarus::trigger::TriggerGateData::Combine(): "
+      + to_string(nDelays) + " delays specified for "
+      + to_string(nGates) + " gates"
+      );
+  }
+
+  //
+  // set up the input cursors and the combination tree (leaves at [ N, 2N [)
+  //
+  std::vector<Cursor_t> cursors;
+  cursors.reserve(nGates);
+  std::vector<OpeningCount_t> levels(2 * nGates);
+  std::vector<NextStatus_t> nextStatus;
+  nextStatus.reserve(nGates);
+
+  std::size_t nStatus = 0U;
+  auto iDelay = begin(delays);
+  for (triggergatedata_t const& gate: gates) {
+    GateEvolution_t const& gateLevel = gate.fGateLevel;
+    assert(!gateLevel.empty());
+
+    ClockTicks_t const delay = (nDelays == 0U)? ClockTicks_t{}: *(iDelay++);
+
+    std::size_t const index = cursors.size();
+    cursors.push_back({ gateLevel.begin(), gateLevel.end(), delay });
+    nextStatus.push_back({ cursors.back().tick(), index });
+    // before its first status, a gate is assumed to be at its starting level
+    levels[nGates + index] = gateLevel.front().opening;
+
+    nStatus += gateLevel.size();
+  } // for
+
+  for (std::size_t iNode = nGates - 1; iNode > 0; --iNode)
+    levels[iNode] = op(levels[2 * iNode], levels[2 * iNode + 1]);
+
+  std::make_heap(nextStatus.begin(), nextStatus.end());
+
+  //
+  // merge
+  //
+  GateEvolution_t& resultLevels = result.fGateLevel;
+  resultLevels.reserve(nStatus - nGates + 1U);
+  details::countGateStat(&TriggerGateStats::allocations);
+  resultLevels.back().opening = levels[1]; // the root of the tree
+
+  while (!nextStatus.empty()) {
+
+    ClockTick_t const tick = nextStatus.front().tick;
+
+    // apply all the changes happening at this tick
+    do {
+      std::pop_heap(nextStatus.begin(), nextStatus.end());
+      std::size_t const index = nextStatus.back().index;
+      Cursor_t& cursor = cursors[index];
+
+      std::size_t iNode = nGates + index;
+      if (levels[iNode] != cursor.iStatus->opening) {
+        levels[iNode] = cursor.iStatus->opening;
+        while ((iNode /= 2) > 0)
+          levels[iNode] = op(levels[2 * iNode], levels[2 * iNode + 1]);
+      }
+
+      if (++cursor.iStatus == cursor.send) nextStatus.pop_back();
+      else {
+        nextStatus.back().tick = cursor.tick();
+        std::push_heap(nextStatus.begin(), nextStatus.end());
+      }
+    } while (!nextStatus.empty() && (nextStatus.front().tick == tick));
+
+    OpeningCount_t const newLevel = levels[1];
+    Status& lastStatus = resultLevels.back();
+    if (newLevel == lastStatus.opening) continue;
+
+    if (tick == lastStatus.tick) lastStatus.opening = newLevel;
+    else resultLevels.emplace_back(EventType::Shift, tick, newLevel);
+
+  } // while
+
+  resultLevels.shrink_to_fit();
+  details::countGateCombination(nStatus, resultLevels.size());
+
   return result;
-} // icarus::trigger::TriggerGateData<>::SymmetricCombination()
+} // icarus::trigger::TriggerGateData<>::Combine()
+
+
+//------------------------------------------------------------------------------
+template <typename TK, typename TI>
+template <typename Gates, typename Delays>
+auto icarus::trigger::TriggerGateData<TK, TI>::Multiplicity
+  (Gates const& gates, Delays const& delays) -> triggergatedata_t
+{
+  /*
+   * Each change of opening of each input gate is recorded as an "edge"
+   * with its (delayed) tick and the change in opening; edges are sorted by
+   * tick, and the result is the running sum of all the changes up to each
+   * tick. There is no status of the result to look up, nor a combination
+   * operation to be evaluated.
+   */
+  using std::begin, std::end;
+
+  struct Edge_t {
+    ClockTick_t tick; ///< Delayed tick of the change.
+    OpeningDiff_t change; ///< Change in opening.
+  }; // Edge_t
+
+  triggergatedata_t result;
+
+  std::size_t const nGates = std::distance(begin(gates), end(gates));
+  if (nGates == 0U) return result;
+
+  std::size_t const nDelays = std::distance(begin(delays), end(delays));
+  if ((nDelays != 0U) && (nDelays != nGates)) {
+    using std::to_string;
+    throw std::runtime_error(
+      "icarus::trigger::TriggerGateData::Multiplicity(): "
+      + to_string(nDelays) + " delays specified for "
+      + to_string(nGates) + " gates"
+      );
+  }
+
+  //
+  // collect the edges
+  //
+  std::size_t nStatus = 0U;
+  for (triggergatedata_t const& gate: gates) nStatus += gate.fGateLevel.size();
+
+  std::vector<Edge_t> edges;
+  edges.reserve(nStatus - nGates);
+
+  // before its first status, a gate is assumed to be at its starting level
+  OpeningCount_t level { 0 };
+  auto iDelay = begin(delays);
+  for (triggergatedata_t const& gate: gates) {
+    GateEvolution_t const& gateLevel = gate.fGateLevel;
+    assert(!gateLevel.empty());
+
+    ClockTicks_t const delay = (nDelays == 0U)? ClockTicks_t{}: *(iDelay++);
+
+    auto iStatus = gateLevel.begin();
+    OpeningCount_t opening = iStatus->opening;
+    level += opening;
+    while (++iStatus != gateLevel.end()) {
+      if (iStatus->opening == opening) continue;
+      edges.push_back({
+        iStatus->tick + delay,
+        static_cast<OpeningDiff_t>(iStatus->opening - opening)
+        });
+      opening = iStatus->opening;
+    } // while
+  } // for
+
+  std::sort(edges.begin(), edges.end(),
+    [](Edge_t const& a, Edge_t const& b){ return a.tick < b.tick; });
+
+  //
+  // sweep
+  //
+  GateEvolution_t& resultLevels = result.fGateLevel;
+  resultLevels.reserve(edges.size() + 1U);
+  details::countGateStat(&TriggerGateStats::allocations);
+  resultLevels.back().opening = level;
+
+  auto iEdge = edges.cbegin();
+  auto const eend = edges.cend();
+  while (iEdge != eend) {
+
+    // apply all the changes happening at this tick
+    ClockTick_t const tick = iEdge->tick;
+    do {
+      level += iEdge->change;
+    } while ((++iEdge != eend) && (iEdge->tick == tick));
+
+    if (level != resultLevels.back().opening)
+      resultLevels.emplace_back(EventType::Shift, tick, level);
+
+  } // while
+
+  resultLevels.shrink_to_fit();
+  details::countGateCombination(nStatus, resultLevels.size());
+
+  return result;
+} // icarus::trigger::TriggerGateData<>::Multiplicity()
+
+
+//------------------------------------------------------------------------------
+namespace icarus::trigger::details {
+  
+  /// Bits of the header byte of each status in packed gate representation.
+  struct TriggerGatePacking {
+    
+    static constexpr std::uint8_t EventMask = 0x03; ///< Bits of event type.
+    static constexpr std::uint8_t DecreaseBit = 0x04; ///< Opening decreases.
+    
+    /// Appends `value` to `buffer` as variable length integer.
+    static void writeVarInt
+      (std::vector<std::uint8_t>& buffer, std::uint64_t value)
+      {
+        while (value >= 0x80) {
+          buffer.push_back(static_cast<std::uint8_t>(value | 0x80));
+          value >>= 7;
+        }
+        buffer.push_back(static_cast<std::uint8_t>(value));
+      }
+    
+    /// Reads a variable length integer from `it`, advancing it.
+    template <typename Iter>
+    static std::uint64_t readVarInt(Iter& it, Iter const end)
+      {
+        std::uint64_t value = 0U;
+        for (unsigned int shift = 0U; shift < 64U; shift += 7U) {
+          if (it == end) break;
+          std::uint8_t const byte = *(it++);
+          value |= std::uint64_t(byte & 0x7F) << shift;
+          if ((byte & 0x80) == 0) return value;
+        } // for
+        throw std::runtime_error
+          ("icarus::trigger::TriggerGateData::unpack(): corrupted data");
+      }
+    
+  }; // TriggerGatePacking
+  
+} // namespace icarus::trigger::details
+
+
+//------------------------------------------------------------------------------
+template <typename TK, typename TI>
+auto icarus::trigger::TriggerGateData<TK, TI>::pack() const
+  -> PackedGate_t
+{
+  
+  static_assert(std::is_integral_v<ClockTick_t>,
+    "TriggerGateData::pack() supports only integral ticks");
+  using Packing = details::TriggerGatePacking;
+  using UTick_t = std::make_unsigned_t<ClockTick_t>;
+  
+  PackedGate_t packed;
+  packed.reserve(3 * fGateLevel.size() + 2);
+  
+  Packing::writeVarInt(packed, fGateLevel.size());
+  
+  // the "previous" status of the first one is at the earliest tick, closed
+  ClockTick_t prevTick = MinTick;
+  OpeningCount_t prevOpening = 0U;
+  for (Status const& status: fGateLevel) {
+    if (status.tick < prevTick) {
+      throw std::runtime_error
+        ("icarus::trigger::TriggerGateData::pack(): stati not sorted by tick");
+    }
+    
+    bool const decrease = status.opening < prevOpening;
+    packed.push_back(static_cast<std::uint8_t>(
+      (static_cast<std::uint8_t>(status.event) & Packing::EventMask)
+      | (decrease? Packing::DecreaseBit: 0)
+      ));
+    Packing::writeVarInt
+      (packed, static_cast<UTick_t>(UTick_t(status.tick) - UTick_t(prevTick)));
+    Packing::writeVarInt(packed, decrease
+      ? (prevOpening - status.opening): (status.opening - prevOpening)
+      );
+    
+    prevTick = status.tick;
+    prevOpening = status.opening;
+  } // for
+  
+  return packed;
+} // icarus::trigger::TriggerGateData<>::pack()
+
+
+//------------------------------------------------------------------------------
+template <typename TK, typename TI>
+auto icarus::trigger::TriggerGateData<TK, TI>::unpack
+  (PackedGate_t const& packed) -> triggergatedata_t
+{
+  using Packing = details::TriggerGatePacking;
+  using UTick_t = std::make_unsigned_t<ClockTick_t>;
+  
+  auto it = packed.begin();
+  auto const pend = packed.end();
+  
+  std::uint64_t const nStatus = Packing::readVarInt(it, pend);
+  // each status takes at least 3 bytes: this protects from silly allocations
+  if ((nStatus == 0U) || (nStatus > packed.size())) {
+    throw std::runtime_error
+      ("icarus::trigger::TriggerGateData::unpack(): corrupted data");
+  }
+  
+  GateEvolution_t gateLevel;
+  gateLevel.reserve(nStatus);
+  details::countGateStat(&TriggerGateStats::allocations);
+  
+  ClockTick_t tick = MinTick;
+  OpeningCount_t opening = 0U;
+  for (std::uint64_t iStatus = 0U; iStatus < nStatus; ++iStatus) {
+    if (it == pend) {
+      throw std::runtime_error
+        ("icarus::trigger::TriggerGateData::unpack(): truncated data");
+    }
+    std::uint8_t const header = *(it++);
+    std::uint8_t const eventCode = header & Packing::EventMask;
+    if (eventCode > static_cast<std::uint8_t>(EventType::Shift)) {
+      throw std::runtime_error
+        ("icarus::trigger::TriggerGateData::unpack(): corrupted data");
+    }
+    tick = static_cast<ClockTick_t>
+      (UTick_t(tick) + static_cast<UTick_t>(Packing::readVarInt(it, pend)));
+    auto const diff
+      = static_cast<OpeningCount_t>(Packing::readVarInt(it, pend));
+    if (header & Packing::DecreaseBit) opening -= diff;
+    else                               opening += diff;
+    
+    gateLevel.emplace_back(static_cast<EventType>(eventCode), tick, opening);
+  } // for
+  
+  return { std::move(gateLevel) };
+} // icarus::trigger::TriggerGateData<>::unpack()
 
 
 //------------------------------------------------------------------------------
@@ -677,16 +1449,25 @@ auto icarus::trigger::TriggerGateData<TK, TI>::findStatus
   // this is the status before (or at) `start` tick:
   auto const ppStartStatus = findLastStatusFor(start);
   
-  // if there is no status at or before `start`, no worry: we just look later;
+  // if there is no status at or before `start`, no worry: we just look later
+  return findStatusFrom(
+    op, (ppStartStatus? ppStartStatus.value(): fGateLevel.begin()), start, end
+    );
+  
+} // icarus::trigger::TriggerGateData<>::findStatus()
+
+
+//------------------------------------------------------------------------------
+template <typename TK, typename TI>
+template <typename Op>
+auto icarus::trigger::TriggerGateData<TK, TI>::findStatusFrom(
+  Op op, status_const_iterator iStartStatus, ClockTick_t start, ClockTick_t end
+) const -> status_const_iterator
+{
   // if the status is before `start`, by agreement we ignore it and start from
   // next
-  auto iStatus = ppStartStatus
-    ? ((ppStartStatus.value()->tick >= start)
-      ? ppStartStatus.value()
-      : std::next(ppStartStatus.value())
-      )
-    : fGateLevel.begin()
-    ;
+  auto iStatus = (iStartStatus->tick >= start)
+    ? iStartStatus: std::next(iStartStatus);
   
   auto const send = fGateLevel.end();
   while (iStatus != send) {
@@ -703,7 +1484,7 @@ auto icarus::trigger::TriggerGateData<TK, TI>::findStatus
   } // while
   return send;
   
-} // icarus::trigger::TriggerGateData<>::findOpenStatus()
+} // icarus::trigger::TriggerGateData<>::findStatusFrom()
 
 
 //------------------------------------------------------------------------------
@@ -809,6 +1590,376 @@ auto icarus::trigger::TriggerGateData<TK, TI>::startingGateLevel()
   { return { NewGateStatus }; }
 
 
+//------------------------------------------------------------------------------
+//--- icarus::trigger::TriggerGateData<>::Cursor
+//------------------------------------------------------------------------------
+template <typename TK, typename TI>
+auto icarus::trigger::TriggerGateData<TK, TI>::Cursor::findOpen(
+  OpeningCount_t minOpening /* = 1U */,
+  ClockTick_t start /* = MinTick */, ClockTick_t end /* = MaxTick */
+) -> ClockTick_t
+{
+  return find(
+    [minOpening](Status const& status){ return status.opening >= minOpening; },
+    start, end
+    );
+} // icarus::trigger::TriggerGateData<>::Cursor::findOpen()
+
+
+//------------------------------------------------------------------------------
+template <typename TK, typename TI>
+auto icarus::trigger::TriggerGateData<TK, TI>::Cursor::findClose(
+  OpeningCount_t minOpening /* = 1U */,
+  ClockTick_t start /* = MinTick */, ClockTick_t end /* = MaxTick */
+) -> ClockTick_t
+{
+  return find(
+    [minOpening](Status const& status){ return status.opening < minOpening; },
+    start, end
+    );
+} // icarus::trigger::TriggerGateData<>::Cursor::findClose()
+
+
+//------------------------------------------------------------------------------
+template <typename TK, typename TI>
+auto icarus::trigger::TriggerGateData<TK, TI>::Cursor::openingRange
+  (ClockTick_t start, ClockTick_t end)
+  -> std::pair<OpeningCount_t, OpeningCount_t>
+{
+  if (start >= end) return { {}, {} };
+  // if the start tick is before the start of the gate, start from the start
+  auto const& gateLevel = fGate->fGateLevel;
+  auto const iStatus = (start < gateLevel.front().tick)
+    ? gateLevel.begin(): seek(start);
+  return fGate->openingRangeFrom(iStatus, end);
+} // icarus::trigger::TriggerGateData<>::Cursor::openingRange()
+
+
+//------------------------------------------------------------------------------
+template <typename TK, typename TI>
+template <typename Op>
+auto icarus::trigger::TriggerGateData<TK, TI>::Cursor::find
+  (Op op, ClockTick_t start, ClockTick_t end) -> ClockTick_t
+{
+  auto const& gateLevel = fGate->fGateLevel;
+  auto const iStartStatus = (start < gateLevel.front().tick)
+    ? gateLevel.begin(): seek(start);
+  auto const iStatus = fGate->findStatusFrom(op, iStartStatus, start, end);
+  if (iStatus == gateLevel.end()) return end;
+  fCurrent = iStatus; // this status is current at the returned tick
+  return iStatus->tick;
+} // icarus::trigger::TriggerGateData<>::Cursor::find()
+
+
+//------------------------------------------------------------------------------
+template <typename TK, typename TI>
+auto icarus::trigger::TriggerGateData<TK, TI>::Cursor::seek
+  (ClockTick_t tick)
+  -> status_const_iterator
+{
+  auto const& gateLevel = fGate->fGateLevel;
+  assert(!gateLevel.empty());
+  auto const sbegin = gateLevel.begin();
+  auto const send = gateLevel.end();
+  
+  if (tick < sbegin->tick) {
+    using std::to_string;
+    throw std::runtime_error(
+      "icarus::trigger::TriggerGateData::Cursor: requested time "
+      + to_string(tick) + " is before the gate channel was created (at "
+      + to_string(sbegin->tick) + ")"
+      );
+  }
+  
+  // find a range [ iLow, iHigh [ with iLow at or before `tick`, and iHigh after
+  auto iLow = fCurrent, iHigh = fCurrent;
+  std::ptrdiff_t step = 1;
+  if (fCurrent->tick <= tick) { // gallop forward
+    while (true) {
+      if (send - iLow <= step) { iHigh = send; break; }
+      iHigh = iLow + step;
+      if (iHigh->tick > tick) break;
+      iLow = iHigh;
+      step *= 2;
+    } // while
+  }
+  else { // gallop backward; sbegin is known to be at or before `tick`
+    while (true) {
+      if (iHigh - sbegin <= step) { iLow = sbegin; break; }
+      iLow = iHigh - step;
+      if (iLow->tick <= tick) break;
+      iHigh = iLow;
+      step *= 2;
+    } // while
+  }
+  
+  // the first status after `tick` is in ] iLow, iHigh ]; we want the one before
+  fCurrent = std::prev
+    (std::upper_bound(std::next(iLow), iHigh, tick, CompareTick()));
+  return fCurrent;
+} // icarus::trigger::TriggerGateData<>::Cursor::seek()
+
+
+//------------------------------------------------------------------------------
+//--- icarus::trigger::TriggerGateData<>::RangeView
+//------------------------------------------------------------------------------
+/*
+ * The walker visits the stati of the view: the one at the start of the range,
+ * then the ones of the gate in the range (skipping the unknown ones, which
+ * the queries of the gate skip as well), then the one closing the range.
+ */
+template <typename TK, typename TI>
+class icarus::trigger::TriggerGateData<TK, TI>::RangeView::StatusWalker {
+  
+    public:
+  
+  /// Constructor: points to the first status of `view` at or after `from`.
+  StatusWalker(RangeView const& view, ClockTick_t from)
+    : fView(view), fStatus(view.fFirst)
+    {
+      if (view.empty()) fPhase = Phase::Done;
+      else if (from <= view.fStart) fPhase = Phase::Start;
+      else {
+        fPhase = Phase::Body;
+        fStatus = std::lower_bound
+          (view.fFirst, view.fLast, from, CompareTick());
+        skipUnknown();
+        if ((fPhase == Phase::End) && (from > view.fEnd)) fPhase = Phase::Done;
+      }
+    }
+  
+  bool done() const { return fPhase == Phase::Done; }
+  
+  ClockTick_t tick() const
+    {
+      switch (fPhase) {
+        case Phase::Start: return fView.fStart;
+        case Phase::Body: return fStatus->tick;
+        default: return fView.fEnd;
+      } // switch
+    }
+  
+  OpeningCount_t opening() const
+    {
+      switch (fPhase) {
+        case Phase::Start: return fView.fStartOpening;
+        case Phase::Body: return fStatus->opening;
+        default: return OpeningCount_t{ 0 };
+      } // switch
+    }
+  
+  void next()
+    {
+      switch (fPhase) {
+        case Phase::Start: fPhase = Phase::Body; break;
+        case Phase::Body: ++fStatus; break;
+        default: fPhase = Phase::Done; return;
+      } // switch
+      skipUnknown();
+    }
+  
+    private:
+  
+  enum class Phase { Start, Body, End, Done };
+  
+  RangeView const& fView;
+  Phase fPhase;
+  status_const_iterator fStatus;
+  
+  /// Moves past unknown stati; after the last one, to the end of the range.
+  void skipUnknown()
+    {
+      while ((fStatus != fView.fLast) && (fStatus->event == EventType::Unknown))
+        ++fStatus;
+      if (fStatus != fView.fLast) return;
+      fPhase = (fView.fEnd == MaxTick)? Phase::Done: Phase::End;
+    }
+  
+}; // icarus::trigger::TriggerGateData<>::RangeView::StatusWalker
+
+
+//------------------------------------------------------------------------------
+template <typename TK, typename TI>
+icarus::trigger::TriggerGateData<TK, TI>::RangeView::RangeView
+  (triggergatedata_t const& gate, ClockTick_t start, ClockTick_t end)
+  : fGate(&gate)
+  , fStart(start)
+  , fEnd(end)
+  , fFirst(std::upper_bound
+      (gate.fGateLevel.begin(), gate.fGateLevel.end(), start, CompareTick())
+    )
+  , fLast(std::lower_bound(fFirst, gate.fGateLevel.end(), end, CompareTick()))
+  , fStartOpening
+    ((fFirst == gate.fGateLevel.begin())? 0U: std::prev(fFirst)->opening)
+{
+  if (fLast < fFirst) fLast = fFirst; // empty range
+} // icarus::trigger::TriggerGateData<>::RangeView::RangeView()
+
+
+//------------------------------------------------------------------------------
+template <typename TK, typename TI>
+auto icarus::trigger::TriggerGateData<TK, TI>::RangeView::openingCount
+  (ClockTick_t tick) const -> OpeningCount_t
+{
+  if (!contains(tick)) return 0U;
+  auto const iNext = std::upper_bound(fFirst, fLast, tick, CompareTick());
+  return (iNext == fFirst)? fStartOpening: std::prev(iNext)->opening;
+} // icarus::trigger::TriggerGateData<>::RangeView::openingCount()
+
+
+//------------------------------------------------------------------------------
+template <typename TK, typename TI>
+auto icarus::trigger::TriggerGateData<TK, TI>::RangeView::findOpen(
+  OpeningCount_t minOpening /* = 1U */,
+  ClockTick_t start /* = MinTick */, ClockTick_t end /* = MaxTick */
+) const -> ClockTick_t
+{
+  return find(
+    [minOpening](OpeningCount_t opening){ return opening >= minOpening; },
+    start, end
+    );
+} // icarus::trigger::TriggerGateData<>::RangeView::findOpen()
+
+
+//------------------------------------------------------------------------------
+template <typename TK, typename TI>
+auto icarus::trigger::TriggerGateData<TK, TI>::RangeView::findClose(
+  OpeningCount_t minOpening /* = 1U */,
+  ClockTick_t start /* = MinTick */, ClockTick_t end /* = MaxTick */
+) const -> ClockTick_t
+{
+  return find(
+    [minOpening](OpeningCount_t opening){ return opening < minOpening; },
+    start, end
+    );
+} // icarus::trigger::TriggerGateData<>::RangeView::findClose()
+
+
+//------------------------------------------------------------------------------
+template <typename TK, typename TI>
+auto icarus::trigger::TriggerGateData<TK, TI>::RangeView::findMaxOpen
+  (ClockTick_t start /* = MinTick */, ClockTick_t end /* = MaxTick */) const
+  -> ClockTick_t
+{
+  if (start >= end) return end;
+  
+  OpeningCount_t maxOpening = openingCount(start);
+  ClockTick_t maxTick = start;
+  for (StatusWalker walker { *this, start }; !walker.done(); walker.next()) {
+    if (walker.tick() >= end) break;
+    if (walker.opening() <= maxOpening) continue;
+    maxOpening = walker.opening();
+    maxTick = walker.tick();
+  } // for
+  return maxTick;
+} // icarus::trigger::TriggerGateData<>::RangeView::findMaxOpen()
+
+
+//------------------------------------------------------------------------------
+template <typename TK, typename TI>
+auto icarus::trigger::TriggerGateData<TK, TI>::RangeView::toGate() const
+  -> triggergatedata_t
+{
+  return SymmetricCombination(
+    [](OpeningCount_t a, OpeningCount_t){ return a; },
+    *this, RangeView{ *fGate, fStart, fStart } // empty range, always closed
+    );
+} // icarus::trigger::TriggerGateData<>::RangeView::toGate()
+
+
+//------------------------------------------------------------------------------
+template <typename TK, typename TI>
+auto icarus::trigger::TriggerGateData<TK, TI>::RangeView::Min
+  (RangeView const& a, RangeView const& b) -> triggergatedata_t
+{
+  return SymmetricCombination
+    ([](OpeningCount_t a, OpeningCount_t b){ return std::min(a, b); }, a, b);
+} // icarus::trigger::TriggerGateData<>::RangeView::Min()
+
+
+//------------------------------------------------------------------------------
+template <typename TK, typename TI>
+auto icarus::trigger::TriggerGateData<TK, TI>::RangeView::Max
+  (RangeView const& a, RangeView const& b) -> triggergatedata_t
+{
+  return SymmetricCombination
+    ([](OpeningCount_t a, OpeningCount_t b){ return std::max(a, b); }, a, b);
+} // icarus::trigger::TriggerGateData<>::RangeView::Max()
+
+
+//------------------------------------------------------------------------------
+template <typename TK, typename TI>
+auto icarus::trigger::TriggerGateData<TK, TI>::RangeView::Sum
+  (RangeView const& a, RangeView const& b) -> triggergatedata_t
+{
+  return SymmetricCombination(std::plus<OpeningCount_t>(), a, b);
+} // icarus::trigger::TriggerGateData<>::RangeView::Sum()
+
+
+//------------------------------------------------------------------------------
+template <typename TK, typename TI>
+auto icarus::trigger::TriggerGateData<TK, TI>::RangeView::Mul
+  (RangeView const& a, RangeView const& b) -> triggergatedata_t
+{
+  return SymmetricCombination(std::multiplies<OpeningCount_t>(), a, b);
+} // icarus::trigger::TriggerGateData<>::RangeView::Mul()
+
+
+//------------------------------------------------------------------------------
+template <typename TK, typename TI>
+template <typename Op>
+auto icarus::trigger::TriggerGateData<TK, TI>::RangeView
+  ::SymmetricCombination(Op&& op, RangeView const& a, RangeView const& b)
+  -> triggergatedata_t
+{
+  triggergatedata_t result;
+  GateEvolution_t& resultLevels = result.fGateLevel;
+  
+  OpeningCount_t aOpening = 0U, bOpening = 0U;
+  resultLevels.back().opening = op(aOpening, bOpening);
+  
+  StatusWalker aWalker { a, MinTick }, bWalker { b, MinTick };
+  while (!aWalker.done() || !bWalker.done()) {
+    ClockTick_t const tick = aWalker.done()? bWalker.tick()
+      : bWalker.done()? aWalker.tick()
+      : std::min(aWalker.tick(), bWalker.tick());
+    
+    // all the stati at this tick, the last one of each view wins
+    for (; !aWalker.done() && (aWalker.tick() == tick); aWalker.next())
+      aOpening = aWalker.opening();
+    for (; !bWalker.done() && (bWalker.tick() == tick); bWalker.next())
+      bOpening = bWalker.opening();
+    
+    // like in `SymmetricCombinationInto()`, the changes are `Shift` stati,
+    // so that later openings of the result propagate through them
+    OpeningCount_t const opening = op(aOpening, bOpening);
+    if (opening == resultLevels.back().opening) continue;
+    if (resultLevels.back().tick == tick) {
+      auto& currentStatus = resultLevels.back();
+      currentStatus.event = EventType::Shift;
+      currentStatus.opening = opening;
+    }
+    else resultLevels.emplace_back(EventType::Shift, tick, opening);
+  } // while
+  
+  return result;
+} // icarus::trigger::TriggerGateData<>::RangeView::SymmetricCombination()
+
+
+//------------------------------------------------------------------------------
+template <typename TK, typename TI>
+template <typename Op>
+auto icarus::trigger::TriggerGateData<TK, TI>::RangeView::find
+  (Op op, ClockTick_t start, ClockTick_t end) const -> ClockTick_t
+{
+  for (StatusWalker walker { *this, start }; !walker.done(); walker.next()) {
+    if (walker.tick() >= end) break;
+    if (op(walker.opening())) return walker.tick();
+  } // for
+  return end;
+} // icarus::trigger::TriggerGateData<>::RangeView::find()
+
+
 //------------------------------------------------------------------------------
 //--- output functions
 //------------------------------------------------------------------------------
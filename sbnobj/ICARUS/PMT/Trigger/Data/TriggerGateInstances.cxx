@@ -0,0 +1,31 @@
+/**
+ * @file   sbnobj/ICARUS/PMT/Trigger/Data/TriggerGateInstances.cxx
+ * @brief  Explicit instantiation of the most common trigger gate types.
+ * @date   October 14, 2026
+ * @see    `sbnobj/ICARUS/PMT/Trigger/Data/OpticalTriggerGate.h`
+ * 
+ * The templates instantiated here are declared `extern` in
+ * `OpticalTriggerGate.h`, so that the code using them does not compile them
+ * again.
+ */
+
+// ICARUS libraries
+#include "sbnobj/ICARUS/PMT/Trigger/Data/OpticalTriggerGate.h"
+
+
+//------------------------------------------------------------------------------
+template class icarus::trigger::TriggerGateData
+  <icarus::trigger::TriggerGateTick_t, icarus::trigger::TriggerGateTicks_t>;
+
+template class icarus::trigger::ReadoutTriggerGate<
+  icarus::trigger::TriggerGateTick_t, icarus::trigger::TriggerGateTicks_t,
+  raw::Channel_t
+  >;
+
+template class icarus::trigger::TriggerGateData<
+  icarus::trigger::CompactTriggerGateTick_t,
+  icarus::trigger::CompactTriggerGateTicks_t
+  >;
+
+
+//------------------------------------------------------------------------------
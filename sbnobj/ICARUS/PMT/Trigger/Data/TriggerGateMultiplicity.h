@@ -0,0 +1,87 @@
+/**
+ * @file   sbnobj/ICARUS/PMT/Trigger/Data/TriggerGateMultiplicity.h
+ * @brief  Conversions between trigger gates and `sbn::MultiplicitySeries`.
+ * @date   October 14, 2026
+ * @see    `sbnobj/Common/Trigger/MultiplicitySeries.h`
+ *
+ * This is a header-only library.
+ */
+
+#ifndef SBNOBJ_ICARUS_PMT_TRIGGER_DATA_TRIGGERGATEMULTIPLICITY_H
+#define SBNOBJ_ICARUS_PMT_TRIGGER_DATA_TRIGGERGATEMULTIPLICITY_H
+
+
+// SBN libraries
+#include "sbnobj/ICARUS/PMT/Trigger/Data/TriggerGateData.h"
+#include "sbnobj/Common/Trigger/MultiplicitySeries.h"
+
+// C/C++ standard libraries
+#include <iterator> // std::next()
+#include <type_traits> // std::is_arithmetic_v
+#include <utility> // std::declval()
+
+
+//------------------------------------------------------------------------------
+namespace icarus::trigger {
+
+  namespace details {
+
+    /// Plain value of a tick, which may be a `util::quantities` point.
+    template <typename Tick>
+    constexpr auto tickValue(Tick tick)
+      {
+        if constexpr (std::is_arithmetic_v<Tick>) return tick;
+        else return tick.value();
+      }
+
+    template <typename Tick>
+    using TickValue_t = decltype(tickValue(std::declval<Tick>()));
+
+  } // namespace details
+
+
+  /// Type of multiplicity series matching the gate type `Gate`.
+  template <typename Gate>
+  using MultiplicitySeriesFor_t = sbn::MultiplicitySeries<
+    details::TickValue_t<typename Gate::ClockTick_t>,
+    typename Gate::OpeningCount_t
+    >;
+
+
+  /**
+   * @brief Returns the opening of `gate` as a detector-neutral series.
+   *
+   * The series can be summed and scanned with the same algorithms as the
+   * SBND `pmtTrigger` multiplicity (via `sbn::MultiplicitySeries::fromBinned()`).
+   * Ticks are converted to their plain value.
+   */
+  template <typename TK, typename TI>
+  MultiplicitySeriesFor_t<TriggerGateData<TK, TI>> toMultiplicitySeries
+    (TriggerGateData<TK, TI> const& gate)
+  {
+    MultiplicitySeriesFor_t<TriggerGateData<TK, TI>> series;
+    gate.forEachStatus([&series](TK tick, auto opening)
+      { series.setLevelFrom(details::tickValue(tick), opening); });
+    return series;
+  }
+
+  /// Returns a gate with the opening following the levels of `series`.
+  /// The starting level of the series is set at the first tick of the gate.
+  template <typename Gate>
+  Gate fromMultiplicitySeries(MultiplicitySeriesFor_t<Gate> const& series)
+  {
+    using ClockTick_t = typename Gate::ClockTick_t;
+    auto const& changes = series.changes();
+    Gate gate;
+    gate.setOpeningAt(Gate::MinTick, changes.front().level);
+    for (auto it = std::next(changes.begin()); it != changes.end(); ++it)
+      gate.setOpeningAt(ClockTick_t{ it->tick }, it->level);
+    return gate;
+  }
+
+} // namespace icarus::trigger
+
+
+//------------------------------------------------------------------------------
+
+#endif // SBNOBJ_ICARUS_PMT_TRIGGER_DATA_TRIGGERGATEMULTIPLICITY_H
@@ -0,0 +1,168 @@
+/**
+ * @file   sbnobj/ICARUS/PMT/Trigger/Data/TriggerGateStats.h
+ * @brief  Optional counters of the work done by `TriggerGateData`.
+ * @date   October 14, 2026
+ *
+ * This is a header-only library.
+ *
+ * The counters are enabled at compile time by defining the preprocessor macro
+ * `SBNOBJ_TRIGGER_GATE_STATS` (e.g. with the `SBNOBJ_TRIGGER_GATE_STATS`
+ * CMake option of `sbnobj`); otherwise all the counting is compiled out.
+ * Since `TriggerGateData` is a template, the macro must be defined in the
+ * same way in all the code using the gates, `sbnobj` libraries included.
+ */
+
+#ifndef SBNOBJ_ICARUS_PMT_TRIGGER_DATA_TRIGGERGATESTATS_H
+#define SBNOBJ_ICARUS_PMT_TRIGGER_DATA_TRIGGERGATESTATS_H
+
+
+// C/C++ standard libraries
+#include <functional> // std::function
+#include <ostream>
+#include <utility> // std::move()
+#include <cstddef> // std::size_t
+
+
+//------------------------------------------------------------------------------
+namespace icarus::trigger {
+
+  struct TriggerGateStats;
+
+  namespace details {
+
+    /// Adds `n` to the `counter` of the current thread, if enabled.
+    void countGateStat
+      (std::size_t TriggerGateStats::* counter, std::size_t n = 1U);
+
+    /// Counts a combination of `nConsumed` stati into `nProduced`, if enabled.
+    void countGateCombination(std::size_t nConsumed, std::size_t nProduced);
+
+  } // namespace details
+
+} // namespace icarus::trigger
+
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Counters of the operations of `TriggerGateData`, per thread.
+ *
+ * Each thread has its own counters (`forThisThread()`), which can be printed
+ * (`dump()`) or reset at any time. A hook can be registered to receive the
+ * counters of each thread when the thread ends, e.g. at the beginning of the
+ * job:
+ * @code
+ * icarus::trigger::TriggerGateStats::setThreadExitHook
+ *   ([](icarus::trigger::TriggerGateStats const& stats)
+ *     { stats.dump(std::cout); std::cout << std::endl; }
+ *   );
+ * @endcode
+ * The hook must be set before the threads using the gates start.
+ *
+ * When the counters are not enabled (`Enabled` is `false`), they are never
+ * changed and the hook is never called.
+ */
+struct icarus::trigger::TriggerGateStats {
+
+  /// Whether the counting is enabled in this build.
+#ifdef SBNOBJ_TRIGGER_GATE_STATS
+  static constexpr bool Enabled = true;
+#else
+  static constexpr bool Enabled = false;
+#endif // SBNOBJ_TRIGGER_GATE_STATS
+
+  /// Type of function receiving the counters of a thread.
+  using Hook_t = std::function<void(TriggerGateStats const&)>;
+
+  std::size_t combinations = 0U; ///< Gate combinations computed.
+  std::size_t statiConsumed = 0U; ///< Stati of the gates being combined.
+  std::size_t statiProduced = 0U; ///< Stati of the combination results.
+  std::size_t compactions = 0U; ///< Compactions of gate stati.
+  std::size_t allocations = 0U; ///< Allocations of storage for gate stati.
+  std::size_t queries = 0U; ///< Opening count and find queries.
+
+  /// Sets all the counters to zero.
+  void reset() { *this = TriggerGateStats{}; }
+
+  /// Adds the counters of `other` to these.
+  TriggerGateStats& operator+= (TriggerGateStats const& other)
+    {
+      combinations += other.combinations;
+      statiConsumed += other.statiConsumed;
+      statiProduced += other.statiProduced;
+      compactions += other.compactions;
+      allocations += other.allocations;
+      queries += other.queries;
+      return *this;
+    }
+
+  /// Prints all the counters into `out`, in a single line (no end of line).
+  void dump(std::ostream& out) const
+    {
+      out << combinations << " combinations (" << statiConsumed
+        << " stati in, " << statiProduced << " out), " << compactions
+        << " compactions, " << allocations << " allocations, " << queries
+        << " queries";
+    }
+
+  /// Returns the counters of the current thread.
+  static TriggerGateStats& forThisThread();
+
+  /// Sets the function called with the counters of each thread at its end.
+  static void setThreadExitHook(Hook_t hook)
+    { threadExitHook() = std::move(hook); }
+
+
+    private:
+
+  /// Counters of a thread, passed to the hook when the thread ends.
+  struct ThreadCounters_t;
+
+  static Hook_t& threadExitHook() { static Hook_t hook; return hook; }
+
+}; // icarus::trigger::TriggerGateStats
+
+
+//------------------------------------------------------------------------------
+struct icarus::trigger::TriggerGateStats::ThreadCounters_t {
+  TriggerGateStats stats;
+  ~ThreadCounters_t()
+    { if (Enabled && threadExitHook()) threadExitHook()(stats); }
+}; // icarus::trigger::TriggerGateStats::ThreadCounters_t
+
+
+//------------------------------------------------------------------------------
+inline auto icarus::trigger::TriggerGateStats::forThisThread()
+  -> TriggerGateStats&
+{
+  thread_local ThreadCounters_t counters;
+  return counters.stats;
+} // icarus::trigger::TriggerGateStats::forThisThread()
+
+
+//------------------------------------------------------------------------------
+inline void icarus::trigger::details::countGateStat(
+  [[maybe_unused]] std::size_t TriggerGateStats::* counter,
+  [[maybe_unused]] std::size_t n /* = 1U */
+) {
+  if constexpr (TriggerGateStats::Enabled)
+    TriggerGateStats::forThisThread().*counter += n;
+} // icarus::trigger::details::countGateStat()
+
+
+//------------------------------------------------------------------------------
+inline void icarus::trigger::details::countGateCombination(
+  [[maybe_unused]] std::size_t nConsumed,
+  [[maybe_unused]] std::size_t nProduced
+) {
+  if constexpr (TriggerGateStats::Enabled) {
+    TriggerGateStats& stats = TriggerGateStats::forThisThread();
+    ++stats.combinations;
+    stats.statiConsumed += nConsumed;
+    stats.statiProduced += nProduced;
+  }
+} // icarus::trigger::details::countGateCombination()
+
+
+//------------------------------------------------------------------------------
+
+#endif // SBNOBJ_ICARUS_PMT_TRIGGER_DATA_TRIGGERGATESTATS_H
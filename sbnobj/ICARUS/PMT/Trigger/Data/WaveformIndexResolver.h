@@ -0,0 +1,166 @@
+/**
+ * @file   sbnobj/ICARUS/PMT/Trigger/Data/WaveformIndexResolver.h
+ * @brief  Conversion between optical waveforms and their index in the event.
+ * @date   October 14, 2026
+ *
+ * This is a header-only library.
+ */
+
+#ifndef SBNOBJ_ICARUS_PMT_TRIGGER_DATA_WAVEFORMINDEXRESOLVER_H
+#define SBNOBJ_ICARUS_PMT_TRIGGER_DATA_WAVEFORMINDEXRESOLVER_H
+
+
+// ICARUS libraries
+#include "sbnobj/ICARUS/PMT/Trigger/Data/OpticalTriggerGate.h"
+#include "sbnobj/Common/Utilities/JaggedArray.h"
+
+// LArSoft libraries
+#include "lardataobj/RawData/OpDetWaveform.h"
+
+// C/C++ standard libraries
+#include <vector>
+#include <algorithm> // std::sort()
+#include <stdexcept> // std::out_of_range
+#include <string> // std::to_string()
+#include <cstddef> // std::size_t
+
+
+//------------------------------------------------------------------------------
+namespace icarus::trigger {
+
+  class WaveformIndexResolver;
+
+  /// Waveform indices of a list of gates, one row per gate (persistable).
+  using OpticalTriggerGateWaveformIndices_t
+    = sbn::JaggedArray<OpticalTriggerGate::WaveformIndex_t>;
+
+} // namespace icarus::trigger
+
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Translates between waveforms and their index in their collection.
+ *
+ * The resolver refers to the collection of waveforms of the event, which
+ * must stay valid and unchanged while the resolver is used; with _art_:
+ * @code
+ * icarus::trigger::WaveformIndexResolver const resolver
+ *   { *event.getValidHandle<std::vector<raw::OpDetWaveform>>(waveformTag) };
+ *
+ * icarus::trigger::SingleChannelOpticalTriggerGate gate { waveform };
+ * gate.add(waveform, resolver.index(waveform));
+ * @endcode
+ *
+ * The relation between a list of gates and the waveforms can then be stored
+ * as a `OpticalTriggerGateWaveformIndices_t` data product parallel to the
+ * gates, with `indexTable()`, in place of an `art::Assns`. In a later job,
+ * with the same waveform collection, `waveforms()` returns the waveforms of
+ * each gate.
+ */
+class icarus::trigger::WaveformIndexResolver {
+
+    public:
+
+  using Waveform_t = raw::OpDetWaveform; ///< Type of the waveforms.
+
+  /// Type of index of a waveform.
+  using WaveformIndex_t = OpticalTriggerGate::WaveformIndex_t;
+
+  /// Constructor: refers to the specified waveform collection.
+  WaveformIndexResolver(std::vector<Waveform_t> const& waveforms)
+    : fWaveforms(&waveforms) {}
+
+  /// Returns the number of waveforms in the collection.
+  std::size_t size() const { return fWaveforms->size(); }
+
+  /**
+   * @brief Returns the index of `waveform` in the collection.
+   * @throw std::out_of_range if `waveform` does not belong to the collection
+   */
+  WaveformIndex_t index(Waveform_t const& waveform) const
+    {
+      Waveform_t const* const first = fWaveforms->data();
+      if ((&waveform < first) || (&waveform >= first + size())) {
+        throw std::out_of_range{
+          "icarus::trigger::WaveformIndexResolver::index(): waveform on channel "
+          + std::to_string(waveform.ChannelNumber())
+          + " is not in the collection"
+          };
+      }
+      return static_cast<WaveformIndex_t>(&waveform - first);
+    }
+
+  /**
+   * @brief Returns the waveform with the specified `index`.
+   * @throw std::out_of_range if `index` is not in the collection
+   */
+  Waveform_t const& waveform(WaveformIndex_t index) const
+    {
+      if (index >= size()) {
+        throw std::out_of_range{
+          "icarus::trigger::WaveformIndexResolver::waveform(): index "
+          + std::to_string(index) + " requested, only "
+          + std::to_string(size()) + " waveforms present"
+          };
+      }
+      return (*fWaveforms)[index];
+    }
+
+  /// Returns the waveforms with the specified `indices`, in the same order.
+  template <typename Indices>
+  std::vector<Waveform_t const*> waveforms(Indices const& indices) const
+    {
+      std::vector<Waveform_t const*> result;
+      for (WaveformIndex_t const index: indices)
+        result.push_back(&waveform(index));
+      return result;
+    }
+
+  /// Returns the waveforms of `gate`, by their indices (in index order).
+  std::vector<Waveform_t const*> waveforms(OpticalTriggerGate const& gate) const
+    { return waveforms(gate.waveformIndices()); }
+
+  /**
+   * @brief Returns the waveform indices of all `gates`, one row per gate.
+   * @tparam Gates type of iterable of `OpticalTriggerGate` objects
+   *
+   * The indices are the ones registered in each gate (`waveformIndices()`);
+   * for gates with no index, they are computed from their waveforms.
+   */
+  template <typename Gates>
+  OpticalTriggerGateWaveformIndices_t indexTable(Gates const& gates) const;
+
+    private:
+
+  std::vector<Waveform_t> const* fWaveforms; ///< The waveform collection.
+
+}; // class icarus::trigger::WaveformIndexResolver
+
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+template <typename Gates>
+auto icarus::trigger::WaveformIndexResolver::indexTable
+  (Gates const& gates) const -> OpticalTriggerGateWaveformIndices_t
+{
+  OpticalTriggerGateWaveformIndices_t table;
+  std::vector<WaveformIndex_t> indices;
+  for (OpticalTriggerGate const& gate: gates) {
+    if (gate.hasWaveformIndices() || gate.waveformList().empty()) {
+      table.push_back(gate.waveformIndices());
+      continue;
+    }
+    indices.clear();
+    for (Waveform_t const* waveform: gate.waveformList())
+      indices.push_back(index(*waveform));
+    std::sort(indices.begin(), indices.end());
+    table.push_back(indices);
+  } // for
+  return table;
+} // icarus::trigger::WaveformIndexResolver::indexTable()
+
+
+//------------------------------------------------------------------------------
+
+#endif // SBNOBJ_ICARUS_PMT_TRIGGER_DATA_WAVEFORMINDEXRESOLVER_H
@@ -7,6 +7,8 @@
  * 
  * * `icarus::trigger::TriggerGateData< TODO >`
  *   (and its associations with `raw::OpDetWaveform`)
+ * * `icarus::trigger::CompactTriggerGateData_t`
+ * * `icarus::trigger::OpticalTriggerGateWaveformIndices_t`
  * 
  * See also `sbnobj/ICARUS/PMT/Trigger/Data/classes_def.xml`.
  */
@@ -14,6 +16,7 @@
 // ICARUS libraries
 #include "sbnobj/ICARUS/PMT/Trigger/Data/OpticalTriggerGate.h"
 #include "sbnobj/ICARUS/PMT/Trigger/Data/TriggerGateData.h"
+#include "sbnobj/ICARUS/PMT/Trigger/Data/WaveformIndexResolver.h"
 
 // LArSoft libraries
 #include "lardataobj/RawData/OpDetWaveform.h"
@@ -28,5 +31,6 @@
 namespace {
 
   icarus::trigger::OpticalTriggerGate::GateData_t tgd;
+  icarus::trigger::CompactTriggerGateData_t ctgd;
   
 } // local namespace
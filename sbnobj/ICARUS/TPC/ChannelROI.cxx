@@ -9,6 +9,8 @@
 #include "sbnobj/ICARUS/TPC/ChannelROI.h"
 
 // C/C++ standard libraries
+#include <stdexcept> // std::invalid_argument
+#include <string> // std::to_string()
 #include <utility> // std::move()
 
 namespace recob{
@@ -37,6 +39,24 @@ namespace recob{
     , fSignalROI(std::move(sigROIlist))
     {}
 
+  //----------------------------------------------------------------------
+  ChannelROI::ChannelROI(
+    RegionsOfInterest_t&& sigROIlist,
+    raw::ChannelID_t channel,
+    std::vector<ROINoiseInfo>&& roiInfo
+    )
+    : fChannel(channel)
+    , fSignalROI(std::move(sigROIlist))
+    , fROIInfo(std::move(roiInfo))
+    {
+      if (!fROIInfo.empty() && (fROIInfo.size() != fSignalROI.n_ranges())) {
+        throw std::invalid_argument("recob::ChannelROI: "
+          + std::to_string(fROIInfo.size()) + " noise information entries for "
+          + std::to_string(fSignalROI.n_ranges()) + " regions of interest on channel "
+          + std::to_string(fChannel));
+      }
+    }
+
 
   //----------------------------------------------------------------------
   std::vector<short int> ChannelROI::Signal() const {
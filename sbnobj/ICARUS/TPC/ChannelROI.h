@@ -30,11 +30,33 @@
 
 // C/C++ standard libraries
 #include <vector>
+#include <cmath> // std::isnan()
 #include <cstddef> // std::size_t
+#include <cstdint> // std::uint32_t
+#include <limits>
 
 
 namespace recob {
 
+  /**
+   * @brief Noise information of a region of interest of a `recob::ChannelROI`.
+   *
+   * The producer of the regions of interest usually knows these quantities
+   * already; storing them spares consumers another pass on the samples.
+   */
+  struct ROINoiseInfo {
+    /// Value of `RMS` and `pedestalResidual` when they are not available.
+    static constexpr float NoValue = std::numeric_limits<float>::quiet_NaN();
+
+    float RMS = 0.f; ///< Noise RMS of the samples in the region [ADC].
+    float pedestalResidual = 0.f; ///< Residual of the pedestal subtraction [ADC].
+    std::uint32_t peakTick = 0; ///< Tick of the largest sample of the region.
+
+    /// Returns whether `RMS` and `pedestalResidual` are available.
+    bool hasNoise() const { return !std::isnan(RMS); }
+  }; // ROINoiseInfo
+
+
   /**
    * @brief Class holding the regions of interest of signal from a channel.
    * @note This class is associated to an entire channel, not just a single
@@ -116,6 +138,9 @@ namespace recob {
       raw::ChannelID_t    fChannel;   ///< ID of the associated channel.
       RegionsOfInterest_t fSignalROI; ///< Signal on the channel as function of time tick.
 
+      /// Noise information of each region of interest (empty if not available).
+      std::vector<ROINoiseInfo> fROIInfo;
+
 
     friend class ChannelROICreator; // helper to create ChannelROIs in art
 
@@ -164,6 +189,22 @@ namespace recob {
         RegionsOfInterest_t&& sigROIlist,
         raw::ChannelID_t channel
         );
+
+      /**
+       * @brief Constructor: moves signal and noise information of the regions.
+       * @param sigROIlist signal organized in regions of interest
+       * @param channel the ID of the channel
+       * @param roiInfo noise information, one entry per region of interest
+       * @throw std::invalid_argument if `roiInfo` is neither empty nor has
+       *        one entry per region of interest in `sigROIlist`
+       *
+       * Empty `roiInfo` means no noise information is available.
+       */
+      ChannelROI(
+        RegionsOfInterest_t&& sigROIlist,
+        raw::ChannelID_t channel,
+        std::vector<ROINoiseInfo>&& roiInfo
+        );
       // --- END -- Constructors -----------------------------------------------
 
 
@@ -182,6 +223,12 @@ namespace recob {
 
       /// Returns the ID of the channel (or InvalidChannelID)
       raw::ChannelID_t           Channel()    const;
+
+      /// Returns whether there is noise information on the regions of interest
+      bool                       HasROIInfo() const;
+
+      /// Returns the noise information of each region (empty if not available)
+      const std::vector<ROINoiseInfo>& ROIInfo() const;
       
       ///@}
       // --- END -- Accessors --------------------------------------------------
@@ -209,6 +256,9 @@ inline const recob::ChannelROI::RegionsOfInterest_t&
                                   recob::ChannelROI::SignalROI()  const { return fSignalROI;        }
 inline std::size_t                recob::ChannelROI::NSignal()    const { return fSignalROI.size(); }
 inline raw::ChannelID_t           recob::ChannelROI::Channel()    const { return fChannel;          }
+inline bool                       recob::ChannelROI::HasROIInfo() const { return !fROIInfo.empty(); }
+inline const std::vector<recob::ROINoiseInfo>&
+                                  recob::ChannelROI::ROIInfo()    const { return fROIInfo;          }
 inline bool                       recob::ChannelROI::operator< (const ChannelROI& than) const
   { return Channel() < than.Channel(); }
 
@@ -0,0 +1,107 @@
+/** ****************************************************************************
+ * @file sbnobj/ICARUS/TPC/ChannelROIBlob.cxx
+ * @brief A whole collection of `recob::ChannelROI`, packed and decoded lazily.
+ * @date October 14, 2026
+ * @see  sbnobj/ICARUS/TPC/ChannelROIBlob.h
+ *
+ * ****************************************************************************/
+
+#include "sbnobj/ICARUS/TPC/ChannelROIBlob.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::stable_sort(), std::lower_bound()
+#include <numeric> // std::iota()
+#include <utility> // std::move()
+
+
+namespace recob {
+
+  //----------------------------------------------------------------------
+  ChannelROIBlob::ChannelROIBlob(std::vector<ChannelROI> const& channelROIs)
+  {
+    std::size_t const nChannels = channelROIs.size();
+    fChannels.reserve(nChannels);
+    fNSignal.reserve(nChannels);
+    fFirstROI.reserve(nChannels + 1);
+    fFirstROIInfo.reserve(nChannels + 1);
+
+    for (ChannelROI const& channelROI: channelROIs) {
+      PackedChannelROI const packed { channelROI };
+      std::uint32_t const firstWord = fWords.size();
+
+      fChannels.push_back(packed.Channel());
+      fNSignal.push_back(packed.NSignal());
+      for (std::size_t iROI = 0; iROI < packed.NROIs(); ++iROI) {
+        ROIHeader_t header = packed.ROIHeader(iROI);
+        header.firstWord += firstWord;
+        fROIs.push_back(header);
+      }
+      fFirstROI.push_back(fROIs.size());
+      fWords.insert
+        (fWords.end(), packed.PackedWords().begin(), packed.PackedWords().end());
+      fROIInfo.insert
+        (fROIInfo.end(), packed.ROIInfo().begin(), packed.ROIInfo().end());
+      fFirstROIInfo.push_back(fROIInfo.size());
+    } // for
+
+    fByChannel.resize(nChannels);
+    std::iota(fByChannel.begin(), fByChannel.end(), Position_t{ 0 });
+    std::stable_sort(fByChannel.begin(), fByChannel.end(),
+      [this](Position_t a, Position_t b){ return fChannels[a] < fChannels[b]; }
+      );
+
+  } // ChannelROIBlob::ChannelROIBlob()
+
+
+  //----------------------------------------------------------------------
+  auto ChannelROIBlob::position(raw::ChannelID_t channel) const -> Position_t
+  {
+    auto const it = std::lower_bound(fByChannel.begin(), fByChannel.end(),
+      channel,
+      [this](Position_t pos, raw::ChannelID_t ch){ return fChannels[pos] < ch; }
+      );
+    return ((it == fByChannel.end()) || (fChannels[*it] != channel))
+      ? NoPosition: *it;
+  } // ChannelROIBlob::position()
+
+
+  //----------------------------------------------------------------------
+  ChannelROI ChannelROIBlob::Unpack(std::size_t i) const
+  {
+    ChannelROI::RegionsOfInterest_t ROIs;
+    std::vector<short int> samples;
+    for (std::size_t iROI = 0; iROI < NROIs(i); ++iROI) {
+      ROIHeader_t const& roi = header(i, iROI);
+      if (roi.size == 0) continue;
+      samples.resize(roi.size);
+      PackedChannelROI::DecodeROI(roi, fWords.data(), samples.data());
+      ROIs.add_range(roi.begin, samples.begin(), samples.end());
+    }
+    ROIs.resize(fNSignal[i]);
+    std::vector<ROINoiseInfo> ROIInfo {
+      fROIInfo.begin() + fFirstROIInfo[i], fROIInfo.begin() + fFirstROIInfo[i + 1]
+      };
+    return { std::move(ROIs), fChannels[i], std::move(ROIInfo) };
+  } // ChannelROIBlob::Unpack()
+
+
+  //----------------------------------------------------------------------
+  std::optional<ChannelROI> ChannelROIBlob::UnpackChannel
+    (raw::ChannelID_t channel) const
+  {
+    Position_t const pos = position(channel);
+    if (pos == NoPosition) return std::nullopt;
+    return Unpack(pos);
+  } // ChannelROIBlob::UnpackChannel()
+
+
+  //----------------------------------------------------------------------
+  std::vector<ChannelROI> ChannelROIBlob::UnpackAll() const
+  {
+    std::vector<ChannelROI> channelROIs;
+    channelROIs.reserve(size());
+    for (std::size_t i = 0; i < size(); ++i) channelROIs.push_back(Unpack(i));
+    return channelROIs;
+  } // ChannelROIBlob::UnpackAll()
+
+} // namespace recob
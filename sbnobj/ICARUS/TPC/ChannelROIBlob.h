@@ -0,0 +1,172 @@
+/** ****************************************************************************
+ * @file sbnobj/ICARUS/TPC/ChannelROIBlob.h
+ * @brief A whole collection of `recob::ChannelROI`, packed and decoded lazily.
+ * @date October 14, 2026
+ * @see  sbnobj/ICARUS/TPC/ChannelROIBlob.cxx
+ *
+ * ****************************************************************************/
+
+#ifndef SBNOBJ_ICARUS_TPC_CHANNELROIBLOB_H
+#define SBNOBJ_ICARUS_TPC_CHANNELROIBLOB_H
+
+
+// ICARUS libraries
+#include "sbnobj/ICARUS/TPC/ChannelROI.h"
+#include "sbnobj/ICARUS/TPC/PackedChannelROI.h"
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h" // raw::ChannelID_t
+
+// C/C++ standard libraries
+#include <optional>
+#include <vector>
+#include <limits>
+#include <cstdint> // std::uint32_t
+#include <cstddef> // std::size_t
+
+
+namespace recob {
+
+  /**
+   * @brief A collection of `recob::ChannelROI`, packed in a few flat buffers.
+   *
+   * This data product holds the same information as a
+   * `std::vector<recob::ChannelROI>`, in the same order, packed with the
+   * encoding of `recob::PackedChannelROI`. Unlike a collection of
+   * `recob::PackedChannelROI` (or of `recob::ChannelROI`), all the channels
+   * share the same few vectors, so reading the product from a file costs no
+   * per-channel allocation, and the samples are decoded only when asked for,
+   * one channel or one region of interest at a time:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * auto const& blob = event.getProduct<recob::ChannelROIBlob>(tag);
+   * if (std::optional<recob::ChannelROI> const channelROI
+   *   = blob.UnpackChannel(channel)
+   * ) {
+   *   // ...
+   * }
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   * The lookup by channel is a binary search on a channel-sorted index stored
+   * with the product.
+   *
+   * The noise information of the regions (`recob::ChannelROI::ROIInfo()`) of
+   * the channels which have it is stored as it is.
+   */
+  class ChannelROIBlob {
+    public:
+
+      using Word_t = PackedChannelROI::Word_t; ///< Type of packed storage unit.
+      using ROIHeader_t = PackedChannelROI::ROIHeader_t; ///< Region description.
+
+      /// Type of position of a channel in the collection.
+      using Position_t = std::uint32_t;
+
+      /// Position of the channels not in the collection.
+      static constexpr Position_t NoPosition
+        = std::numeric_limits<Position_t>::max();
+
+
+      /// Default constructor: an empty collection (for ROOT I/O).
+      ChannelROIBlob() = default;
+
+      /// Constructor: packs all the elements of `channelROIs`.
+      explicit ChannelROIBlob(std::vector<ChannelROI> const& channelROIs);
+
+
+      // --- BEGIN -- Accessors ------------------------------------------------
+      ///@name Accessors
+      ///@{
+
+      /// Returns the number of channels in the collection.
+      std::size_t size() const { return fChannels.size(); }
+
+      /// Returns whether the collection is empty.
+      bool empty() const { return fChannels.empty(); }
+
+      /// Returns the ID of the channel at position `i`.
+      raw::ChannelID_t Channel(std::size_t i) const { return fChannels[i]; }
+
+      /// Returns the number of ticks of the channel at position `i`.
+      std::size_t NSignal(std::size_t i) const { return fNSignal[i]; }
+
+      /// Returns the number of regions of interest of the channel at `i`.
+      std::size_t NROIs(std::size_t i) const
+        { return fFirstROI[i + 1] - fFirstROI[i]; }
+
+      /// Returns the first tick of region `iROI` of the channel at `i`.
+      std::size_t ROIBegin(std::size_t i, std::size_t iROI) const
+        { return header(i, iROI).begin; }
+
+      /// Returns the number of samples of region `iROI` of the channel at `i`.
+      std::size_t ROISize(std::size_t i, std::size_t iROI) const
+        { return header(i, iROI).size; }
+
+      /// Returns the number of words of packed samples of all the channels.
+      std::size_t NPackedWords() const { return fWords.size(); }
+
+      /// Returns whether the channel at `i` has noise information on regions.
+      bool HasROIInfo(std::size_t i) const
+        { return fFirstROIInfo[i + 1] > fFirstROIInfo[i]; }
+
+      /// Returns the noise information of region `iROI` of the channel at `i`.
+      /// @see `HasROIInfo()`
+      ROINoiseInfo const& ROIInfo(std::size_t i, std::size_t iROI) const
+        { return fROIInfo[fFirstROIInfo[i] + iROI]; }
+
+      /// Returns the position of `channel`, `NoPosition` if not present.
+      Position_t position(raw::ChannelID_t channel) const;
+
+      ///@}
+      // --- END -- Accessors --------------------------------------------------
+
+
+      // --- BEGIN -- Decoding -------------------------------------------------
+      ///@name Decoding
+      ///@{
+
+      /**
+       * @brief Decodes region `iROI` of the channel at `i` into `buffer`.
+       * @param i position of the channel in the collection
+       * @param iROI index of the region of interest in the channel
+       * @param buffer pointer to room for at least `ROISize(i, iROI)` samples
+       */
+      void DecodeROI(std::size_t i, std::size_t iROI, short int* buffer) const
+        { PackedChannelROI::DecodeROI(header(i, iROI), fWords.data(), buffer); }
+
+      /// Returns the channel at position `i`, decoded.
+      ChannelROI Unpack(std::size_t i) const;
+
+      /// Returns the specified channel decoded, or nothing if not present.
+      std::optional<ChannelROI> UnpackChannel(raw::ChannelID_t channel) const;
+
+      /// Returns the whole collection, decoded.
+      std::vector<ChannelROI> UnpackAll() const;
+
+      ///@}
+      // --- END -- Decoding ---------------------------------------------------
+
+
+    private:
+
+      std::vector<raw::ChannelID_t> fChannels; ///< Channel ID, by position.
+      std::vector<std::uint32_t> fNSignal; ///< Number of ticks, by position.
+      /// Index in `fROIs` of the first region of each position, plus the end.
+      std::vector<std::uint32_t> fFirstROI { 0U };
+      /// All the regions (`firstWord` refers to `fWords`).
+      std::vector<ROIHeader_t> fROIs;
+      std::vector<Word_t> fWords; ///< Codes of the samples of all the regions.
+      /// Index in `fROIInfo` of the first entry of each position, plus the end.
+      std::vector<std::uint32_t> fFirstROIInfo { 0U };
+      /// Noise information of the regions of the channels that have it.
+      std::vector<ROINoiseInfo> fROIInfo;
+      std::vector<Position_t> fByChannel; ///< Positions sorted by channel ID.
+
+      /// Returns the description of region `iROI` of position `i`.
+      ROIHeader_t const& header(std::size_t i, std::size_t iROI) const
+        { return fROIs[fFirstROI[i] + iROI]; }
+
+  }; // class ChannelROIBlob
+
+} // namespace recob
+
+
+#endif // SBNOBJ_ICARUS_TPC_CHANNELROIBLOB_H
@@ -0,0 +1,84 @@
+/** ****************************************************************************
+ * @file sbnobj/ICARUS/TPC/ChannelROIBufferCreator.cxx
+ * @brief Helper to create many `recob::ChannelROI` from contiguous buffers.
+ * @date October 14, 2026
+ * @see  sbnobj/ICARUS/TPC/ChannelROIBufferCreator.h
+ *
+ * ****************************************************************************/
+
+#include "sbnobj/ICARUS/TPC/ChannelROIBufferCreator.h"
+
+// C/C++ standard libraries
+#include <stdexcept> // std::runtime_error
+#include <string>
+#include <utility> // std::move()
+
+
+namespace recob {
+
+  //----------------------------------------------------------------------
+  std::vector<ChannelROI> ChannelROIBufferCreator::create(
+    short int const* samples, std::size_t nSamples,
+    std::vector<ROIDescriptor_t> const& ROIs,
+    std::size_t nTicks
+    )
+  {
+    // first pass: validation, and count of the channels
+    std::size_t nChannels = 0;
+    std::size_t totalSamples = 0;
+    for (std::size_t iROI = 0; iROI < ROIs.size(); ++iROI) {
+      ROIDescriptor_t const& ROI = ROIs[iROI];
+      if (ROI.begin + ROI.length > nTicks) {
+        throw std::runtime_error(
+          "recob::ChannelROIBufferCreator::create(): region #" + std::to_string(iROI)
+          + " on channel " + std::to_string(ROI.channel) + " ends at tick "
+          + std::to_string(ROI.begin + ROI.length) + ", beyond the "
+          + std::to_string(nTicks) + " ticks of the waveform"
+          );
+      }
+      if ((iROI == 0) || (ROIs[iROI - 1].channel != ROI.channel)) ++nChannels;
+      else {
+        ROIDescriptor_t const& prevROI = ROIs[iROI - 1];
+        if (ROI.begin < prevROI.begin + prevROI.length) {
+          throw std::runtime_error(
+            "recob::ChannelROIBufferCreator::create(): region #"
+            + std::to_string(iROI) + " on channel "
+            + std::to_string(ROI.channel) + " starts at tick "
+            + std::to_string(ROI.begin)
+            + ", before the end of the previous region ("
+            + std::to_string(prevROI.begin + prevROI.length) + ")"
+            );
+        }
+      }
+      totalSamples += ROI.length;
+    } // for validation
+    if (totalSamples != nSamples) {
+      throw std::runtime_error(
+        "recob::ChannelROIBufferCreator::create(): regions describe "
+        + std::to_string(totalSamples) + " samples, but "
+        + std::to_string(nSamples) + " are provided"
+        );
+    }
+
+    // second pass: each region is copied into the regions of its channel,
+    // which are then moved into the channel object
+    std::vector<ChannelROI> channelROIs;
+    channelROIs.reserve(nChannels);
+    short int const* ROIsamples = samples;
+    std::size_t iROI = 0;
+    while (iROI < ROIs.size()) {
+      raw::ChannelID_t const channel = ROIs[iROI].channel;
+      ChannelROI::RegionsOfInterest_t signalROI(nTicks);
+      for (; (iROI < ROIs.size()) && (ROIs[iROI].channel == channel); ++iROI) {
+        ROIDescriptor_t const& ROI = ROIs[iROI];
+        if (ROI.length > 0)
+          signalROI.add_range(ROI.begin, ROIsamples, ROIsamples + ROI.length);
+        ROIsamples += ROI.length;
+      } // for regions on channel
+      channelROIs.emplace_back(std::move(signalROI), channel);
+    } // while
+
+    return channelROIs;
+  } // ChannelROIBufferCreator::create()
+
+} // namespace recob
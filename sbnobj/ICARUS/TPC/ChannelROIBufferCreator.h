@@ -0,0 +1,99 @@
+/** ****************************************************************************
+ * @file sbnobj/ICARUS/TPC/ChannelROIBufferCreator.h
+ * @brief Helper to create many `recob::ChannelROI` from contiguous buffers.
+ * @date October 14, 2026
+ * @see  sbnobj/ICARUS/TPC/ChannelROIBufferCreator.cxx
+ *
+ * ****************************************************************************/
+
+#ifndef SBNOBJ_ICARUS_TPC_CHANNELROIBUFFERCREATOR_H
+#define SBNOBJ_ICARUS_TPC_CHANNELROIBUFFERCREATOR_H
+
+
+// ICARUS libraries
+#include "sbnobj/ICARUS/TPC/ChannelROI.h"
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h" // raw::ChannelID_t
+
+// C/C++ standard libraries
+#include <vector>
+#include <cstddef> // std::size_t
+
+
+namespace recob {
+
+  /**
+   * @brief Creates `recob::ChannelROI` objects for many channels at once.
+   *
+   * Producers usually collect the regions of interest of a channel in a
+   * `recob::ChannelROI::RegionsOfInterest_t` one range at a time, and then move
+   * it into a `recob::ChannelROI`. When all the channels of a detector are
+   * processed, their samples are often already stored in a single contiguous
+   * buffer, together with a description of where each region starts.
+   * This helper creates all the `recob::ChannelROI` objects directly from such
+   * a buffer: the output collection is allocated once, and the samples of each
+   * region are copied only once, from the buffer into the regions of interest
+   * which are then moved into the `recob::ChannelROI` they belong to.
+   * It uses only the public interface of `recob::ChannelROI`.
+   *
+   * Example:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * std::vector<short int> samples; // samples of all regions, one after another
+   * std::vector<recob::ChannelROIBufferCreator::ROIDescriptor_t> ROIs;
+   * // ... fill both, e.g. `ROIs.push_back({ channel, firstTick, nSamples });`
+   * std::vector<recob::ChannelROI> channelROIs
+   *   = recob::ChannelROIBufferCreator::create(samples, ROIs, nTicks);
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   */
+  class ChannelROIBufferCreator {
+    public:
+
+      /// Description of a region of interest in a buffer of samples.
+      struct ROIDescriptor_t {
+        raw::ChannelID_t channel; ///< Channel the region belongs to.
+        std::size_t begin;        ///< First tick of the region.
+        std::size_t length;       ///< Number of samples (ticks) in the region.
+      }; // ROIDescriptor_t
+
+
+      /**
+       * @brief Creates channel objects from a buffer of region samples.
+       * @param samples pointer to the samples of all the regions
+       * @param nSamples number of samples in `samples`
+       * @param ROIs description of all the regions of interest
+       * @param nTicks duration of the waveform of each channel [ticks]
+       * @return a `recob::ChannelROI` per channel, in the order of `ROIs`
+       * @throw std::runtime_error if `ROIs` and `samples` are inconsistent
+       *
+       * The samples of the regions are read from `samples` in the same order
+       * as the regions appear in `ROIs`, the first region starting at the
+       * first sample, each of the others right after the previous one.
+       * All the consecutive regions in `ROIs` on the same channel are assigned
+       * to the same `recob::ChannelROI`; they must be sorted by tick and not
+       * overlap. Each channel waveform includes `nTicks` ticks; all the regions
+       * must be contained in it. The regions must describe exactly all the
+       * samples in the buffer.
+       */
+      static std::vector<ChannelROI> create(
+        short int const* samples, std::size_t nSamples,
+        std::vector<ROIDescriptor_t> const& ROIs,
+        std::size_t nTicks
+        );
+
+      /// Creates channel objects from a vector of region samples.
+      /// @see `create(short int const*, std::size_t,
+      ///       std::vector<ROIDescriptor_t> const&, std::size_t)`
+      static std::vector<ChannelROI> create(
+        std::vector<short int> const& samples,
+        std::vector<ROIDescriptor_t> const& ROIs,
+        std::size_t nTicks
+        )
+        { return create(samples.data(), samples.size(), ROIs, nTicks); }
+
+  }; // class ChannelROIBufferCreator
+
+} // namespace recob
+
+
+#endif // SBNOBJ_ICARUS_TPC_CHANNELROIBUFFERCREATOR_H
@@ -0,0 +1,100 @@
+/** ****************************************************************************
+ * @file sbnobj/ICARUS/TPC/ChannelROIExport.cxx
+ * @brief Export of `recob::ChannelROI` collections into dense matrices.
+ * @date October 14, 2026
+ * @see  sbnobj/ICARUS/TPC/ChannelROIExport.h
+ *
+ * ****************************************************************************/
+
+#include "sbnobj/ICARUS/TPC/ChannelROIExport.h"
+
+// framework libraries
+#include "tbb/task_arena.h"
+#include "tbb/parallel_for.h"
+#include "tbb/blocked_range.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::copy(), std::min()
+#include <stdexcept> // std::runtime_error
+#include <string>
+#include <cstring> // std::memset()
+
+
+namespace recob {
+
+  //----------------------------------------------------------------------
+  template <typename T>
+  void fillDenseMatrix(
+    std::vector<ChannelROI> const& channelROIs,
+    std::vector<int> const& channelRows,
+    T* buffer, std::size_t nRows, std::size_t nTicks,
+    unsigned int nThreads /* = 0U */
+  ) {
+
+    // row of each of the channels, checked so that tasks never share a row
+    std::vector<int> rows(channelROIs.size(), -1);
+    std::vector<bool> used(nRows, false);
+    for (std::size_t i = 0; i < channelROIs.size(); ++i) {
+      raw::ChannelID_t const channel = channelROIs[i].Channel();
+      if (channel >= channelRows.size()) continue;
+      int const row = channelRows[channel];
+      if (row < 0) continue;
+      if (static_cast<std::size_t>(row) >= nRows) {
+        throw std::runtime_error(
+          "recob::fillDenseMatrix(): channel " + std::to_string(channel)
+          + " is assigned row " + std::to_string(row) + ", but the matrix has "
+          + std::to_string(nRows) + " rows"
+          );
+      }
+      if (used[row]) {
+        throw std::runtime_error(
+          "recob::fillDenseMatrix(): row " + std::to_string(row)
+          + " is assigned to more than one channel (including "
+          + std::to_string(channel) + ")"
+          );
+      }
+      used[row] = true;
+      rows[i] = row;
+    } // for
+
+    std::memset(buffer, 0, nRows * nTicks * sizeof(T));
+
+    tbb::task_arena arena{
+      (nThreads > 0U)
+        ? static_cast<int>(nThreads): int(tbb::task_arena::automatic)
+      };
+    arena.execute([&channelROIs, &rows, buffer, nTicks]()
+      {
+        tbb::parallel_for(
+          tbb::blocked_range<std::size_t>(0U, channelROIs.size()),
+          [&channelROIs, &rows, buffer, nTicks]
+            (tbb::blocked_range<std::size_t> const& range)
+          {
+            for (std::size_t i = range.begin(); i != range.end(); ++i) {
+              if (rows[i] < 0) continue;
+              T* const rowBuffer = buffer + rows[i] * nTicks;
+              for (auto const& ROI: channelROIs[i].SignalROI().get_ranges()) {
+                std::size_t const begin = ROI.begin_index();
+                if (begin >= nTicks) break; // regions are sorted
+                std::size_t const n = std::min(ROI.size(), nTicks - begin);
+                std::copy(ROI.begin(), ROI.begin() + n, rowBuffer + begin);
+              } // for regions of interest
+            } // for channels
+          }
+          );
+      });
+
+  } // fillDenseMatrix()
+
+
+  //----------------------------------------------------------------------
+  template void fillDenseMatrix<float>(
+    std::vector<ChannelROI> const&, std::vector<int> const&,
+    float*, std::size_t, std::size_t, unsigned int
+    );
+  template void fillDenseMatrix<short int>(
+    std::vector<ChannelROI> const&, std::vector<int> const&,
+    short int*, std::size_t, std::size_t, unsigned int
+    );
+
+} // namespace recob
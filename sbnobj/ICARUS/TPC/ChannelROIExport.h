@@ -0,0 +1,67 @@
+/** ****************************************************************************
+ * @file sbnobj/ICARUS/TPC/ChannelROIExport.h
+ * @brief Export of `recob::ChannelROI` collections into dense matrices.
+ * @date October 14, 2026
+ * @see  sbnobj/ICARUS/TPC/ChannelROIExport.cxx
+ *
+ * ****************************************************************************/
+
+#ifndef SBNOBJ_ICARUS_TPC_CHANNELROIEXPORT_H
+#define SBNOBJ_ICARUS_TPC_CHANNELROIEXPORT_H
+
+
+// ICARUS libraries
+#include "sbnobj/ICARUS/TPC/ChannelROI.h"
+
+// C/C++ standard libraries
+#include <vector>
+#include <cstddef> // std::size_t
+
+
+namespace recob {
+
+  /**
+   * @brief Fills a dense channel-by-tick matrix with the content of channels.
+   * @tparam T type of the matrix elements (`float` and `short int` supported)
+   * @param channelROIs the channels to be exported
+   * @param channelRows row of each channel ID in the matrix (negative: skip)
+   * @param buffer pointer to the matrix, with room for `nRows x nTicks` values
+   * @param nRows number of rows of the matrix
+   * @param nTicks number of columns of the matrix, one per tick
+   * @param nThreads maximum number of threads to use (`0`: no limit)
+   * @throw std::runtime_error if a row is beyond the matrix, or the same row
+   *        is assigned to more than one of the channels in `channelROIs`
+   *
+   * The matrix is stored row-major: the sample at `tick` of the channel
+   * assigned to `row` is at `buffer[row * nTicks + tick]`.
+   * The channel of `channelROIs[i]` is assigned the row
+   * `channelRows[channelROIs[i].Channel()]`; channels with a negative row or
+   * with an ID beyond `channelRows` are not exported.
+   * Samples at ticks from `nTicks` on are not exported either.
+   *
+   * The whole matrix is first set to zero at once, then only the samples
+   * in the regions of interest are copied in their place, directly from the
+   * `recob::ChannelROI` objects (no `recob::ChannelROI::Signal()` waveform is
+   * created). Channels are copied in parallel by TBB tasks: when running in a
+   * multi-threaded _art_ job, the tasks share the threads with the rest of the
+   * job, unless `nThreads` restricts them further.
+   *
+   * Example exporting a plane into a `float` tensor:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * std::vector<float> tensor(nWires * nTicks);
+   * recob::fillDenseMatrix
+   *   (channelROIs, wireOfChannel, tensor.data(), nWires, nTicks);
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   */
+  template <typename T>
+  void fillDenseMatrix(
+    std::vector<ChannelROI> const& channelROIs,
+    std::vector<int> const& channelRows,
+    T* buffer, std::size_t nRows, std::size_t nTicks,
+    unsigned int nThreads = 0U
+    );
+
+} // namespace recob
+
+
+#endif // SBNOBJ_ICARUS_TPC_CHANNELROIEXPORT_H
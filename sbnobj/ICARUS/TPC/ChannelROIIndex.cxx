@@ -0,0 +1,38 @@
+/** ****************************************************************************
+ * @file sbnobj/ICARUS/TPC/ChannelROIIndex.cxx
+ * @brief Direct lookup of channels in a collection of `recob::ChannelROI`.
+ * @date October 14, 2026
+ * @see  sbnobj/ICARUS/TPC/ChannelROIIndex.h
+ *
+ * ****************************************************************************/
+
+#include "sbnobj/ICARUS/TPC/ChannelROIIndex.h"
+
+// C/C++ standard libraries
+#include <stdexcept> // std::runtime_error
+#include <string>
+
+
+namespace recob {
+
+  //----------------------------------------------------------------------
+  void ChannelROIIndex::addChannel(raw::ChannelID_t channel, std::size_t pos)
+  {
+    Position_t& position = fPositions[channel];
+    if (position != NoPosition) {
+      throw std::runtime_error(
+        "recob::ChannelROIIndex: channel " + std::to_string(channel)
+        + " appears at both position " + std::to_string(position)
+        + " and " + std::to_string(pos)
+        );
+    }
+    if (pos >= NoPosition) {
+      throw std::runtime_error(
+        "recob::ChannelROIIndex: position " + std::to_string(pos)
+        + " of channel " + std::to_string(channel) + " can't be indexed"
+        );
+    }
+    position = static_cast<Position_t>(pos);
+  } // ChannelROIIndex::addChannel()
+
+} // namespace recob
@@ -0,0 +1,146 @@
+/** ****************************************************************************
+ * @file sbnobj/ICARUS/TPC/ChannelROIIndex.h
+ * @brief Direct lookup of channels in a collection of `recob::ChannelROI`.
+ * @date October 14, 2026
+ * @see  sbnobj/ICARUS/TPC/ChannelROIIndex.cxx
+ *
+ * ****************************************************************************/
+
+#ifndef SBNOBJ_ICARUS_TPC_CHANNELROIINDEX_H
+#define SBNOBJ_ICARUS_TPC_CHANNELROIINDEX_H
+
+
+// ICARUS libraries
+#include "sbnobj/ICARUS/TPC/ChannelROI.h"
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h" // raw::ChannelID_t
+
+// C/C++ standard libraries
+#include <vector>
+#include <limits>
+#include <cstdint> // std::uint32_t
+#include <cstddef> // std::size_t
+
+
+namespace recob {
+
+  /**
+   * @brief Maps channel IDs into their position in a channel collection.
+   *
+   * The index is built once from a collection of `recob::ChannelROI` (or of
+   * any object with a `Channel()` method), and then
+   * `position(channel)` returns in constant time the position in that
+   * collection of the element on `channel`.
+   * Since channel IDs are dense, the map is a plain array of positions,
+   * indexed by channel ID, with `NoPosition` for the channels which are not
+   * in the collection.
+   *
+   * The index is a plain data object, so a producer can store it in the event
+   * next to the collection it describes, and all the consumers can share it:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * auto const& channelROIs
+   *   = event.getProduct<std::vector<recob::ChannelROI>>(tag);
+   * auto const& index = event.getProduct<recob::ChannelROIIndex>(tag);
+   * recob::ChannelROI const* channelROI = index.find(channel, channelROIs);
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   * Elements with an invalid channel ID (`raw::InvalidChannelID`) are not
+   * indexed.
+   */
+  class ChannelROIIndex {
+    public:
+
+      /// Type of position in the collection.
+      using Position_t = std::uint32_t;
+
+      /// Position of the channels not in the collection.
+      static constexpr Position_t NoPosition
+        = std::numeric_limits<Position_t>::max();
+
+
+      /// Default constructor: an empty index (for ROOT I/O).
+      ChannelROIIndex() = default;
+
+      /**
+       * @brief Constructor: indexes all the elements in `channels`.
+       * @tparam Coll type of collection of objects with a `Channel()` method
+       * @param channels the collection to be indexed
+       * @throw std::runtime_error if a channel appears more than once
+       */
+      template <typename Coll>
+      explicit ChannelROIIndex(Coll const& channels);
+
+
+      /// Returns the number of channels covered by the index (highest + 1).
+      std::size_t size() const { return fPositions.size(); }
+
+      /// Returns the position of `channel` in the collection,
+      /// `NoPosition` if not present.
+      Position_t position(raw::ChannelID_t channel) const
+        {
+          return (channel < fPositions.size())
+            ? fPositions[channel]: NoPosition;
+        }
+
+      /// Returns whether `channel` is present in the collection.
+      bool has(raw::ChannelID_t channel) const
+        { return position(channel) != NoPosition; }
+
+      /// Returns a pointer to the element of `channel` in `channels`,
+      /// `nullptr` if not present.
+      /// @note `channels` must be the collection the index was built from.
+      template <typename Coll>
+      auto find(raw::ChannelID_t channel, Coll const& channels) const
+        -> decltype(&channels[0])
+        {
+          Position_t const pos = position(channel);
+          return (pos == NoPosition)? nullptr: &channels[pos];
+        }
+
+
+    private:
+
+      /// Position of each channel in the collection.
+      std::vector<Position_t> fPositions;
+
+      /// Adds `channel` at position `pos`.
+      /// @throw std::runtime_error if `channel` was already added
+      void addChannel(raw::ChannelID_t channel, std::size_t pos);
+
+  }; // class ChannelROIIndex
+
+} // namespace recob
+
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+template <typename Coll>
+recob::ChannelROIIndex::ChannelROIIndex(Coll const& channels) {
+
+  // first pass: the size of the table
+  raw::ChannelID_t maxChannel = 0;
+  bool anyChannel = false;
+  for (auto const& element: channels) {
+    raw::ChannelID_t const channel = element.Channel();
+    if (channel == raw::InvalidChannelID) continue;
+    if (!anyChannel || (channel > maxChannel)) maxChannel = channel;
+    anyChannel = true;
+  } // for
+  if (!anyChannel) return;
+
+  fPositions.assign(std::size_t{ maxChannel } + 1, NoPosition);
+  std::size_t pos = 0;
+  for (auto const& element: channels) {
+    raw::ChannelID_t const channel = element.Channel();
+    if (channel != raw::InvalidChannelID) addChannel(channel, pos);
+    ++pos;
+  } // for
+
+} // recob::ChannelROIIndex::ChannelROIIndex()
+
+
+//------------------------------------------------------------------------------
+
+
+#endif // SBNOBJ_ICARUS_TPC_CHANNELROIINDEX_H
@@ -0,0 +1,158 @@
+/** ****************************************************************************
+ * @file sbnobj/ICARUS/TPC/ChannelROIOperations.cxx
+ * @brief Combination of the regions of interest of `recob::ChannelROI`.
+ * @date October 14, 2026
+ * @see  sbnobj/ICARUS/TPC/ChannelROIOperations.h
+ *
+ * ****************************************************************************/
+
+#include "sbnobj/ICARUS/TPC/ChannelROIOperations.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::max(), std::min(), std::clamp()
+#include <limits>
+#include <utility> // std::move()
+#include <vector>
+#include <cstddef> // std::size_t
+
+
+namespace {
+
+  using ROIs_t = recob::ChannelROI::RegionsOfInterest_t;
+  using Range_t = ROIs_t::datarange_t;
+  using RangeIter_t = ROIs_t::range_const_iterator;
+
+  //----------------------------------------------------------------------
+  /// Applies `op(dest, sample)` to the samples of `range` within
+  /// `[ begin, begin + values.size() [`.
+  template <typename Op>
+  void applyRange(
+    Range_t const& range, std::size_t begin, std::vector<short int>& values,
+    Op op
+  ) {
+    std::size_t const first = std::max(range.begin_index(), begin);
+    std::size_t const last
+      = std::min(range.end_index(), begin + values.size());
+    auto const samples = range.begin() + (first - range.begin_index());
+    short int* dest = values.data() + (first - begin);
+    for (std::size_t i = 0; i < last - first; ++i) op(dest[i], samples[i]);
+  } // applyRange()
+
+
+  //----------------------------------------------------------------------
+  /**
+   * Returns regions covering all the ticks of `a` and `b`.
+   * Each output sample starts as `init`, and it is then combined via
+   * `op(dest, sample)` with the samples of `b` and then the ones of `a`.
+   */
+  template <typename Op>
+  ROIs_t combineUnion(ROIs_t const& a, ROIs_t const& b, short int init, Op op)
+  {
+    ROIs_t result;
+
+    RangeIter_t iA = a.begin_range(), iB = b.begin_range();
+    RangeIter_t const aEnd = a.end_range(), bEnd = b.end_range();
+
+    // pick the next range by start tick from either operand
+    auto nextRange = [&]() -> Range_t const&
+      {
+        bool const fromA = (iB == bEnd)
+          || ((iA != aEnd) && (iA->begin_index() <= iB->begin_index()));
+        return fromA? *(iA++): *(iB++);
+      };
+
+    // the first ranges of each operand not completely before the output one
+    RangeIter_t firstA = iA, firstB = iB;
+    while ((iA != aEnd) || (iB != bEnd)) {
+
+      // find the extent of the output range
+      Range_t const& first = nextRange();
+      std::size_t const begin = first.begin_index();
+      std::size_t end = first.end_index();
+      while (true) {
+        if ((iA != aEnd) && (iA->begin_index() <= end))
+          end = std::max(end, (iA++)->end_index());
+        else if ((iB != bEnd) && (iB->begin_index() <= end))
+          end = std::max(end, (iB++)->end_index());
+        else break;
+      } // while
+
+      // fill the output range, which fully contains all the ranges so far
+      std::vector<short int> values(end - begin, init);
+      for (; firstB != iB; ++firstB) applyRange(*firstB, begin, values, op);
+      for (; firstA != iA; ++firstA) applyRange(*firstA, begin, values, op);
+
+      result.add_range(begin, std::move(values));
+    } // while
+
+    result.resize(std::max(a.size(), b.size()));
+    return result;
+  } // combineUnion()
+
+} // local namespace
+
+
+namespace recob {
+
+  //----------------------------------------------------------------------
+  ChannelROI::RegionsOfInterest_t ROIunion(
+    ChannelROI::RegionsOfInterest_t const& a,
+    ChannelROI::RegionsOfInterest_t const& b
+  ) {
+    return combineUnion
+      (a, b, 0, [](short int& dest, short int sample){ dest = sample; });
+  } // ROIunion()
+
+
+  //----------------------------------------------------------------------
+  ChannelROI::RegionsOfInterest_t ROIintersection(
+    ChannelROI::RegionsOfInterest_t const& a,
+    ChannelROI::RegionsOfInterest_t const& b
+  ) {
+    ChannelROI::RegionsOfInterest_t result;
+
+    RangeIter_t iA = a.begin_range(), iB = b.begin_range();
+    RangeIter_t const aEnd = a.end_range(), bEnd = b.end_range();
+    while ((iA != aEnd) && (iB != bEnd)) {
+      std::size_t const begin = std::max(iA->begin_index(), iB->begin_index());
+      std::size_t const end = std::min(iA->end_index(), iB->end_index());
+      if (begin < end) {
+        auto const samples = iA->begin() + (begin - iA->begin_index());
+        result.add_range(begin, samples, samples + (end - begin));
+      }
+      // the range ending first can't overlap any further
+      if (iA->end_index() <= iB->end_index()) ++iA;
+      else ++iB;
+    } // while
+
+    result.resize(std::max(a.size(), b.size()));
+    return result;
+  } // ROIintersection()
+
+
+  //----------------------------------------------------------------------
+  ChannelROI::RegionsOfInterest_t ROIsum(
+    ChannelROI::RegionsOfInterest_t const& a,
+    ChannelROI::RegionsOfInterest_t const& b
+  ) {
+    using Limits_t = std::numeric_limits<short int>;
+    return combineUnion(a, b, 0, [](short int& dest, short int sample)
+      {
+        dest = static_cast<short int>(std::clamp
+          (int{ dest } + sample, int{ Limits_t::min() }, int{ Limits_t::max() })
+          );
+      });
+  } // ROIsum()
+
+
+  //----------------------------------------------------------------------
+  ChannelROI::RegionsOfInterest_t ROImax(
+    ChannelROI::RegionsOfInterest_t const& a,
+    ChannelROI::RegionsOfInterest_t const& b
+  ) {
+    return combineUnion(a, b, std::numeric_limits<short int>::min(),
+      [](short int& dest, short int sample){ dest = std::max(dest, sample); }
+      );
+  } // ROImax()
+
+} // namespace recob
@@ -0,0 +1,68 @@
+/** ****************************************************************************
+ * @file sbnobj/ICARUS/TPC/ChannelROIOperations.h
+ * @brief Combination of the regions of interest of `recob::ChannelROI`.
+ * @date October 14, 2026
+ * @see  sbnobj/ICARUS/TPC/ChannelROIOperations.cxx
+ *
+ * ****************************************************************************/
+
+#ifndef SBNOBJ_ICARUS_TPC_CHANNELROIOPERATIONS_H
+#define SBNOBJ_ICARUS_TPC_CHANNELROIOPERATIONS_H
+
+
+// ICARUS libraries
+#include "sbnobj/ICARUS/TPC/ChannelROI.h"
+
+
+namespace recob {
+
+  // --- BEGIN -- Region of interest operations --------------------------------
+  /**
+   * @name Region of interest operations
+   *
+   * These functions combine two sets of regions of interest, for example the
+   * ones from two filtering passes on the same channel, into a new one.
+   * They work range by range on the sparse ranges: samples outside the
+   * regions of interest are never created, and each output region is
+   * allocated once with its final size.
+   *
+   * The regions of the result of `ROIunion()`, `ROIsum()` and `ROImax()`
+   * cover all the ticks covered by either of the operands, merging the
+   * regions which overlap or touch; the ones of `ROIintersection()` cover
+   * only the ticks covered by both.
+   * The nominal size of the result is the larger of the two operands.
+   */
+  /// @{
+
+  /// Returns the regions from `a` and `b`; samples of `a` win on overlaps.
+  ChannelROI::RegionsOfInterest_t ROIunion(
+    ChannelROI::RegionsOfInterest_t const& a,
+    ChannelROI::RegionsOfInterest_t const& b
+    );
+
+  /// Returns the ticks in regions of both `a` and `b`, with samples of `a`.
+  ChannelROI::RegionsOfInterest_t ROIintersection(
+    ChannelROI::RegionsOfInterest_t const& a,
+    ChannelROI::RegionsOfInterest_t const& b
+    );
+
+  /// Returns the regions from `a` and `b`, summing samples on overlaps.
+  /// Sums beyond the range of `short int` are clamped to it.
+  ChannelROI::RegionsOfInterest_t ROIsum(
+    ChannelROI::RegionsOfInterest_t const& a,
+    ChannelROI::RegionsOfInterest_t const& b
+    );
+
+  /// Returns the regions from `a` and `b`, with the larger sample on overlaps.
+  ChannelROI::RegionsOfInterest_t ROImax(
+    ChannelROI::RegionsOfInterest_t const& a,
+    ChannelROI::RegionsOfInterest_t const& b
+    );
+
+  /// @}
+  // --- END -- Region of interest operations ----------------------------------
+
+} // namespace recob
+
+
+#endif // SBNOBJ_ICARUS_TPC_CHANNELROIOPERATIONS_H
@@ -0,0 +1,168 @@
+/** ****************************************************************************
+ * @file sbnobj/ICARUS/TPC/ChannelROIReductions.cxx
+ * @brief Summaries of the regions of interest of a `recob::ChannelROI`.
+ * @date October 14, 2026
+ * @see  sbnobj/ICARUS/TPC/ChannelROIReductions.h
+ *
+ * ****************************************************************************/
+
+#include "sbnobj/ICARUS/TPC/ChannelROIReductions.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::min(), std::max()
+#include <cmath> // std::sqrt()
+#include <limits>
+#include <cstdint> // std::int32_t
+
+
+namespace {
+
+  /// Number of `short int` samples whose sum surely fits a 32-bit integer.
+  constexpr std::size_t SafeSumSamples = std::size_t{ 1 } << 16;
+
+  /// Type of iterator to the samples in a region of interest.
+  using SampleIter_t = recob::ChannelROIRange_t::const_iterator;
+
+  //----------------------------------------------------------------------
+  // Samples are summed in 32-bit blocks short enough not to overflow, which
+  // the compiler vectorizes much better than a 64-bit sum.
+  long long sumSamples(SampleIter_t begin, std::size_t n) {
+    long long sum = 0;
+    while (n > 0) {
+      std::size_t const nBlock = std::min(n, SafeSumSamples);
+      std::int32_t blockSum = 0;
+      for (std::size_t i = 0; i < nBlock; ++i) blockSum += begin[i];
+      sum += blockSum;
+      begin += nBlock;
+      n -= nBlock;
+    } // while
+    return sum;
+  } // sumSamples()
+
+} // local namespace
+
+
+namespace recob {
+
+  //----------------------------------------------------------------------
+  long long ROIintegral(ChannelROIRange_t const& roi) {
+    return sumSamples(roi.begin(), roi.size());
+  } // ROIintegral()
+
+
+  //----------------------------------------------------------------------
+  short int ROImaximum(ChannelROIRange_t const& roi) {
+    if (roi.size() == 0) return 0;
+    auto const begin = roi.begin();
+    std::size_t const n = roi.size();
+    short int maximum = std::numeric_limits<short int>::min();
+    for (std::size_t i = 0; i < n; ++i) maximum = std::max(maximum, begin[i]);
+    return maximum;
+  } // ROImaximum()
+
+
+  //----------------------------------------------------------------------
+  std::size_t ROIticksOverThreshold
+    (ChannelROIRange_t const& roi, short int threshold)
+  {
+    auto const begin = roi.begin();
+    std::size_t const n = roi.size();
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < n; ++i) count += (begin[i] >= threshold);
+    return count;
+  } // ROIticksOverThreshold()
+
+
+  //----------------------------------------------------------------------
+  std::vector<ROISummary> summarizeROIs
+    (ChannelROI const& channel, short int threshold)
+  {
+    ChannelROI::RegionsOfInterest_t const& ROIs = channel.SignalROI();
+
+    std::vector<ROISummary> summaries;
+    summaries.reserve(ROIs.n_ranges());
+
+    for (ChannelROIRange_t const& roi: ROIs.get_ranges()) {
+
+      ROISummary summary;
+      summary.beginTick = roi.begin_index();
+      summary.endTick = roi.end_index();
+
+      auto begin = roi.begin();
+      std::size_t n = roi.size();
+      short int maximum = std::numeric_limits<short int>::min();
+      std::size_t overThreshold = 0;
+      while (n > 0) {
+        // one pass per block for all the quantities
+        std::size_t const nBlock = std::min(n, SafeSumSamples);
+        std::int32_t blockSum = 0;
+        for (std::size_t i = 0; i < nBlock; ++i) {
+          short int const sample = begin[i];
+          blockSum += sample;
+          maximum = std::max(maximum, sample);
+          overThreshold += (sample >= threshold);
+        } // for
+        summary.integral += blockSum;
+        begin += nBlock;
+        n -= nBlock;
+      } // while
+
+      summary.maximum = (roi.size() > 0)? maximum: 0;
+      summary.ticksOverThreshold = overThreshold;
+      summaries.push_back(summary);
+    } // for regions of interest
+
+    return summaries;
+  } // summarizeROIs()
+
+
+  //----------------------------------------------------------------------
+  ROINoiseInfo computeROINoiseInfo
+    (ChannelROIRange_t const& roi, std::size_t sidebandTicks)
+  {
+    ROINoiseInfo info;
+    std::size_t const n = roi.size();
+    auto const begin = roi.begin();
+
+    std::size_t peak = 0;
+    for (std::size_t i = 1; i < n; ++i) if (begin[i] > begin[peak]) peak = i;
+    info.peakTick = static_cast<std::uint32_t>(roi.begin_index() + peak);
+
+    if ((sidebandTicks == 0) || (n <= 2 * sidebandTicks)) {
+      info.RMS = ROINoiseInfo::NoValue;
+      info.pedestalResidual = ROINoiseInfo::NoValue;
+      return info;
+    }
+
+    long long sumSq = 0;
+    for (std::size_t i = 0; i < sidebandTicks; ++i) {
+      long long const first = begin[i], last = begin[n - 1 - i];
+      sumSq += first * first + last * last;
+    } // for
+    std::size_t const nSideband = 2 * sidebandTicks;
+    double const mean = static_cast<double>(
+      sumSamples(begin, sidebandTicks) + sumSamples(begin + (n - sidebandTicks), sidebandTicks)
+      ) / nSideband;
+    double const variance = static_cast<double>(sumSq) / nSideband - mean * mean;
+
+    info.RMS = static_cast<float>(std::sqrt(std::max(variance, 0.0)));
+    info.pedestalResidual = static_cast<float>(mean);
+    return info;
+  } // computeROINoiseInfo()
+
+
+  //----------------------------------------------------------------------
+  std::vector<ROINoiseInfo> ROINoiseInfoOf
+    (ChannelROI const& channel, std::size_t sidebandTicks /* = 0 */)
+  {
+    if (channel.HasROIInfo()) return channel.ROIInfo();
+
+    ChannelROI::RegionsOfInterest_t const& ROIs = channel.SignalROI();
+    std::vector<ROINoiseInfo> info;
+    info.reserve(ROIs.n_ranges());
+    for (ChannelROIRange_t const& roi: ROIs.get_ranges())
+      info.push_back(computeROINoiseInfo(roi, sidebandTicks));
+    return info;
+  } // ROINoiseInfoOf()
+
+} // namespace recob
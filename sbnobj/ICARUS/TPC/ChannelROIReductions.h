@@ -0,0 +1,117 @@
+/** ****************************************************************************
+ * @file sbnobj/ICARUS/TPC/ChannelROIReductions.h
+ * @brief Summaries of the regions of interest of a `recob::ChannelROI`.
+ * @date October 14, 2026
+ * @see  sbnobj/ICARUS/TPC/ChannelROIReductions.cxx
+ *
+ * ****************************************************************************/
+
+#ifndef SBNOBJ_ICARUS_TPC_CHANNELROIREDUCTIONS_H
+#define SBNOBJ_ICARUS_TPC_CHANNELROIREDUCTIONS_H
+
+
+// ICARUS libraries
+#include "sbnobj/ICARUS/TPC/ChannelROI.h"
+
+// C/C++ standard libraries
+#include <vector>
+#include <cstddef> // std::size_t
+
+
+namespace recob {
+
+  /// Type of a single region of interest of a `recob::ChannelROI`.
+  using ChannelROIRange_t = ChannelROI::RegionsOfInterest_t::datarange_t;
+
+  /// Summary of a single region of interest (@see `summarizeROIs()`).
+  struct ROISummary {
+    std::size_t beginTick = 0;  ///< First tick of the region.
+    std::size_t endTick = 0;    ///< Tick after the last one of the region.
+    long long integral = 0;     ///< Sum of all the samples [ADC x tick].
+    short int maximum = 0;      ///< Largest sample [ADC].
+    std::size_t ticksOverThreshold = 0; ///< Samples at or above threshold.
+  }; // ROISummary
+
+
+  // --- BEGIN -- Region of interest reductions --------------------------------
+  /**
+   * @name Region of interest reductions
+   *
+   * These functions compute quantities from each region of interest of a
+   * channel, visiting only the samples actually stored in the regions: no
+   * zero-padded waveform is created, unlike with `ChannelROI::Signal()`.
+   * The loops on the samples are written so that the compiler can vectorize
+   * them on the `short int` samples.
+   *
+   * Example:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * for (recob::ROISummary const& roi: recob::summarizeROIs(channelROI, 10)) {
+   *   if (roi.ticksOverThreshold < 3) continue;
+   *   // ...
+   * }
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   */
+  /// @{
+
+  /// Returns the sum of the samples in the region of interest `roi`.
+  long long ROIintegral(ChannelROIRange_t const& roi);
+
+  /// Returns the largest sample in `roi` (`0` if `roi` is empty).
+  short int ROImaximum(ChannelROIRange_t const& roi);
+
+  /// Returns the number of samples in `roi` at or above `threshold`.
+  std::size_t ROIticksOverThreshold
+    (ChannelROIRange_t const& roi, short int threshold);
+
+  /**
+   * @brief Returns the summary of each of the regions of interest in `channel`.
+   * @param channel the channel with the regions of interest to summarize
+   * @param threshold threshold for the time over threshold [ADC]
+   * @return a summary per region of interest, in the same order
+   *
+   * All the quantities of the summary of a region are computed in a single
+   * pass on its samples.
+   */
+  std::vector<ROISummary> summarizeROIs
+    (ChannelROI const& channel, short int threshold);
+
+  /**
+   * @brief Estimates the noise information of the region of interest `roi`.
+   * @param roi the region of interest
+   * @param sidebandTicks number of baseline ticks at each end of the region
+   *
+   * The noise is estimated only from the sidebands: the first and the last
+   * `sidebandTicks` samples of the region, which the caller knows to be
+   * baseline (e.g. the padding added around the signal by the producer).
+   * The RMS is the standard deviation of the sideband samples, and the
+   * pedestal residual their mean. If `sidebandTicks` is `0` or the region
+   * is not longer than its two sidebands, there is no estimate, and both are
+   * `ROINoiseInfo::NoValue`.
+   * The peak tick is the one of the first largest sample of the region.
+   * An empty region has a peak tick `0`.
+   */
+  ROINoiseInfo computeROINoiseInfo
+    (ChannelROIRange_t const& roi, std::size_t sidebandTicks);
+
+  /**
+   * @brief Returns the noise information of each region of interest.
+   * @param channel the channel with the regions of interest
+   * @param sidebandTicks baseline ticks at each end of each region
+   *
+   * The information stored in `channel` by its producer is returned if
+   * available (`ChannelROI::HasROIInfo()`). Otherwise, it is estimated from
+   * the sidebands by `computeROINoiseInfo()`, which, with the default
+   * `sidebandTicks` of `0`, leaves the noise not available
+   * (`ROINoiseInfo::hasNoise()` is `false`) and fills only the peak tick.
+   * The samples of the signal are never used as noise.
+   */
+  std::vector<ROINoiseInfo> ROINoiseInfoOf
+    (ChannelROI const& channel, std::size_t sidebandTicks = 0);
+
+  /// @}
+  // --- END -- Region of interest reductions ----------------------------------
+
+} // namespace recob
+
+
+#endif // SBNOBJ_ICARUS_TPC_CHANNELROIREDUCTIONS_H
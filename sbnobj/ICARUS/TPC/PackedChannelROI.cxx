@@ -0,0 +1,164 @@
+/** ****************************************************************************
+ * @file sbnobj/ICARUS/TPC/PackedChannelROI.cxx
+ * @brief Lossless compact representation of a `recob::ChannelROI`.
+ * @date October 14, 2026
+ * @see  sbnobj/ICARUS/TPC/PackedChannelROI.h
+ *
+ * ****************************************************************************/
+
+#include "sbnobj/ICARUS/TPC/PackedChannelROI.h"
+
+// C/C++ standard libraries
+#include <utility> // std::move()
+
+
+namespace {
+
+  /// Number of bits in a storage word.
+  constexpr unsigned int WordBits = 64U;
+
+  //----------------------------------------------------------------------
+  /// Maps a difference of samples into an unsigned code ("zigzag" encoding).
+  constexpr std::uint32_t zigzag(std::int32_t value)
+    {
+      return (static_cast<std::uint32_t>(value) << 1)
+        ^ static_cast<std::uint32_t>(value >> 31);
+    }
+
+  /// Maps an unsigned code back into a difference of samples.
+  constexpr std::int32_t unzigzag(std::uint32_t code)
+    {
+      return static_cast<std::int32_t>(code >> 1)
+        ^ -static_cast<std::int32_t>(code & 1U);
+    }
+
+  /// Returns the number of bits needed to represent `value`.
+  unsigned int bitWidth(std::uint32_t value)
+    { return (value == 0)? 0U: (32U - __builtin_clz(value)); }
+
+} // local namespace
+
+
+namespace recob {
+
+  //----------------------------------------------------------------------
+  PackedChannelROI::PackedChannelROI()
+    : fChannel(raw::InvalidChannelID)
+    , fNSignal(0)
+    {}
+
+  //----------------------------------------------------------------------
+  PackedChannelROI::PackedChannelROI(ChannelROI const& channelROI)
+    : fChannel(channelROI.Channel())
+    , fNSignal(channelROI.NSignal())
+    , fROIInfo(channelROI.ROIInfo())
+  {
+    ChannelROI::RegionsOfInterest_t const& ROIs = channelROI.SignalROI();
+    fROIs.reserve(ROIs.n_ranges());
+
+    std::vector<std::uint32_t> codes;
+    for (auto const& range: ROIs.get_ranges()) {
+      ROIHeader_t header;
+      header.begin = range.begin_index();
+      header.size = range.size();
+      header.firstWord = fWords.size();
+      if (range.size() == 0) {
+        fROIs.push_back(header);
+        continue;
+      }
+
+      auto const samples = range.begin();
+      std::size_t const nCodes = range.size() - 1;
+      header.firstSample = samples[0];
+
+      // all codes, and the bits needed for the largest one
+      codes.resize(nCodes);
+      std::uint32_t allBits = 0;
+      for (std::size_t i = 0; i < nCodes; ++i) {
+        codes[i] = zigzag(std::int32_t{ samples[i + 1] } - samples[i]);
+        allBits |= codes[i];
+      }
+      unsigned int const bits = bitWidth(allBits);
+      header.bits = bits;
+
+      // codes are written one after the other, across word boundaries
+      fWords.resize(fWords.size() + (nCodes * bits + WordBits - 1) / WordBits);
+      Word_t* words = fWords.data() + header.firstWord;
+      std::size_t bit = 0;
+      for (std::size_t i = 0; i < (bits? nCodes: 0); ++i, bit += bits) {
+        std::size_t const iWord = bit / WordBits;
+        unsigned int const offset = bit % WordBits;
+        words[iWord] |= Word_t{ codes[i] } << offset;
+        if (offset + bits > WordBits)
+          words[iWord + 1] |= Word_t{ codes[i] } >> (WordBits - offset);
+      } // for codes
+
+      fROIs.push_back(header);
+    } // for regions of interest
+
+  } // PackedChannelROI::PackedChannelROI()
+
+
+  //----------------------------------------------------------------------
+  void PackedChannelROI::DecodeROI(std::size_t iROI, short int* buffer) const
+    { DecodeROI(fROIs[iROI], fWords.data(), buffer); }
+
+
+  //----------------------------------------------------------------------
+  void PackedChannelROI::DecodeROI
+    (ROIHeader_t const& header, Word_t const* allWords, short int* buffer)
+  {
+    if (header.size == 0) return;
+
+    std::size_t const nCodes = header.size - 1U;
+    unsigned int const bits = header.bits;
+    short int sample = header.firstSample;
+    buffer[0] = sample;
+    if (bits == 0) { // flat region: no code stored
+      for (std::size_t i = 0; i < nCodes; ++i) buffer[i + 1] = sample;
+      return;
+    }
+
+    Word_t const* words = allWords + header.firstWord;
+    Word_t const mask = (Word_t{ 1 } << bits) - 1;
+    std::size_t bit = 0;
+    for (std::size_t i = 0; i < nCodes; ++i, bit += bits) {
+      std::size_t const iWord = bit / WordBits;
+      unsigned int const offset = bit % WordBits;
+      Word_t code = words[iWord] >> offset;
+      if (offset + bits > WordBits)
+        code |= words[iWord + 1] << (WordBits - offset);
+      sample += unzigzag(static_cast<std::uint32_t>(code & mask));
+      buffer[i + 1] = sample;
+    } // for codes
+
+  } // PackedChannelROI::DecodeROI(header)
+
+
+  //----------------------------------------------------------------------
+  std::vector<short int> PackedChannelROI::DecodeROI(std::size_t iROI) const
+  {
+    std::vector<short int> samples(ROISize(iROI));
+    DecodeROI(iROI, samples.data());
+    return samples;
+  } // PackedChannelROI::DecodeROI()
+
+
+  //----------------------------------------------------------------------
+  ChannelROI::RegionsOfInterest_t PackedChannelROI::SignalROI() const
+  {
+    ChannelROI::RegionsOfInterest_t ROIs;
+    for (std::size_t iROI = 0; iROI < NROIs(); ++iROI) {
+      if (ROISize(iROI) == 0) continue;
+      ROIs.add_range(ROIBegin(iROI), DecodeROI(iROI));
+    }
+    ROIs.resize(fNSignal);
+    return ROIs;
+  } // PackedChannelROI::SignalROI()
+
+
+  //----------------------------------------------------------------------
+  ChannelROI PackedChannelROI::Unpack() const
+    { return { SignalROI(), fChannel, std::vector<ROINoiseInfo>{ fROIInfo } }; }
+
+} // namespace recob
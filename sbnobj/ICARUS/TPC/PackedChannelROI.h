@@ -0,0 +1,184 @@
+/** ****************************************************************************
+ * @file sbnobj/ICARUS/TPC/PackedChannelROI.h
+ * @brief Lossless compact representation of a `recob::ChannelROI`.
+ * @date October 14, 2026
+ * @see  sbnobj/ICARUS/TPC/PackedChannelROI.cxx
+ *
+ * ****************************************************************************/
+
+#ifndef SBNOBJ_ICARUS_TPC_PACKEDCHANNELROI_H
+#define SBNOBJ_ICARUS_TPC_PACKEDCHANNELROI_H
+
+
+// ICARUS libraries
+#include "sbnobj/ICARUS/TPC/ChannelROI.h"
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h" // raw::ChannelID_t
+
+// C/C++ standard libraries
+#include <vector>
+#include <cstdint> // std::uint64_t, std::uint32_t, ...
+#include <cstddef> // std::size_t
+
+
+namespace recob {
+
+  /**
+   * @brief Regions of interest of a channel, with samples packed in few bits.
+   *
+   * This object holds the same information as a `recob::ChannelROI`, with no
+   * loss, in a more compact form. It is meant to be stored in place of the
+   * `recob::ChannelROI` data product, and converted back (`Unpack()`) or
+   * decoded region by region when needed.
+   *
+   * Each region of interest is encoded independently:
+   * * its first sample is stored as it is;
+   * * each of the following samples is stored as difference from the previous
+   *   one, mapped to an unsigned value with "zigzag" encoding (`0`, `-1`, `1`,
+   *   `-2`, ... become `0`, `1`, `2`, `3`, ...), so that small differences, of
+   *   either sign, have small codes;
+   * * all the codes of the region are written with the same number of bits,
+   *   the smallest that fits all of them, one after the other in a stream of
+   *   64-bit words; each region starts at the beginning of a new word.
+   *
+   * Pedestal-subtracted, deconvolved waveforms vary slowly, and their codes
+   * typically take a handful of bits instead of 16. A flat region takes no
+   * code bit at all.
+   *
+   * The noise information of the regions (`recob::ChannelROI::ROIInfo()`), if
+   * any, is stored as it is.
+   *
+   * The packed data consists of plain vectors and it is written by the ROOT
+   * streamer generated from the dictionary.
+   *
+   * Example of decoding into a buffer of the caller:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * std::vector<short int> buffer;
+   * for (std::size_t iROI = 0; iROI < packed.NROIs(); ++iROI) {
+   *   buffer.resize(packed.ROISize(iROI));
+   *   packed.DecodeROI(iROI, buffer.data());
+   *   // sample `i` of the buffer is at tick `packed.ROIBegin(iROI) + i`
+   * }
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   */
+  class PackedChannelROI {
+    public:
+
+      /// Type of packed storage unit.
+      using Word_t = std::uint64_t;
+
+      /// Description of a packed region of interest.
+      struct ROIHeader_t {
+        std::uint32_t begin = 0;     ///< First tick of the region.
+        std::uint32_t size = 0;      ///< Number of samples in the region.
+        std::uint32_t firstWord = 0; ///< Index of the first word of the codes.
+        std::int16_t firstSample = 0; ///< Value of the first sample.
+        std::uint8_t bits = 0;       ///< Bits of each code.
+      }; // ROIHeader_t
+
+
+      /// Default constructor: no signal information (for ROOT I/O).
+      PackedChannelROI();
+
+      /// Constructor: packs the content of `channelROI`.
+      explicit PackedChannelROI(ChannelROI const& channelROI);
+
+
+      // --- BEGIN -- Accessors ------------------------------------------------
+      ///@name Accessors
+      ///@{
+
+      /// Returns the ID of the channel (or InvalidChannelID).
+      raw::ChannelID_t Channel() const { return fChannel; }
+
+      /// Returns the number of time ticks, or samples, in the channel.
+      std::size_t NSignal() const { return fNSignal; }
+
+      /// Returns the number of regions of interest.
+      std::size_t NROIs() const { return fROIs.size(); }
+
+      /// Returns the first tick of the region of interest `iROI`.
+      std::size_t ROIBegin(std::size_t iROI) const
+        { return fROIs[iROI].begin; }
+
+      /// Returns the number of samples in the region of interest `iROI`.
+      std::size_t ROISize(std::size_t iROI) const
+        { return fROIs[iROI].size; }
+
+      /// Returns the number of words of packed samples.
+      std::size_t NPackedWords() const { return fWords.size(); }
+
+      /// Returns the description of the packed region of interest `iROI`.
+      ROIHeader_t const& ROIHeader(std::size_t iROI) const
+        { return fROIs[iROI]; }
+
+      /// Returns the words of packed samples of all the regions.
+      std::vector<Word_t> const& PackedWords() const { return fWords; }
+
+      /// Returns whether there is noise information on the regions of interest.
+      bool HasROIInfo() const { return !fROIInfo.empty(); }
+
+      /// Returns the noise information of each region (empty if not available).
+      std::vector<ROINoiseInfo> const& ROIInfo() const { return fROIInfo; }
+
+      ///@}
+      // --- END -- Accessors --------------------------------------------------
+
+
+      // --- BEGIN -- Decoding -------------------------------------------------
+      ///@name Decoding
+      ///@{
+
+      /**
+       * @brief Decodes the samples of region `iROI` into `buffer`.
+       * @param iROI index of the region of interest
+       * @param buffer pointer to room for at least `ROISize(iROI)` samples
+       */
+      void DecodeROI(std::size_t iROI, short int* buffer) const;
+
+      /// Returns the samples of the region of interest `iROI`.
+      std::vector<short int> DecodeROI(std::size_t iROI) const;
+
+      /**
+       * @brief Decodes the samples of a packed region into `buffer`.
+       * @param header description of the region
+       * @param words words the `firstWord` of `header` refers to
+       * @param buffer pointer to room for at least `header.size` samples
+       *
+       * This is the decoding algorithm of `DecodeROI()`, for the objects
+       * which store regions packed by `PackedChannelROI` in their own buffer.
+       */
+      static void DecodeROI
+        (ROIHeader_t const& header, Word_t const* words, short int* buffer);
+
+      /// Returns all the regions of interest, decoded.
+      ChannelROI::RegionsOfInterest_t SignalROI() const;
+
+      /// Returns a `recob::ChannelROI` with the same content as this object.
+      ChannelROI Unpack() const;
+
+      ///@}
+      // --- END -- Decoding ---------------------------------------------------
+
+
+      /// Returns whether this channel ID is smaller than the other.
+      bool operator< (PackedChannelROI const& than) const
+        { return Channel() < than.Channel(); }
+
+
+    private:
+
+      raw::ChannelID_t fChannel; ///< ID of the associated channel.
+      std::size_t fNSignal;      ///< Number of ticks in the channel.
+      std::vector<ROIHeader_t> fROIs; ///< Description of all the regions.
+      std::vector<Word_t> fWords; ///< Codes of the samples of all the regions.
+      /// Noise information of each region of interest (empty if not available).
+      std::vector<ROINoiseInfo> fROIInfo;
+
+  }; // class PackedChannelROI
+
+} // namespace recob
+
+
+#endif // SBNOBJ_ICARUS_TPC_PACKEDCHANNELROI_H
@@ -3,6 +3,9 @@
 #include "canvas/Persistency/Common/Assns.h"
 
 #include "sbnobj/ICARUS/TPC/ChannelROI.h"
+#include "sbnobj/ICARUS/TPC/PackedChannelROI.h"
+#include "sbnobj/ICARUS/TPC/ChannelROIBlob.h"
+#include "sbnobj/ICARUS/TPC/ChannelROIIndex.h"
 #include <vector>
 
 
@@ -11,8 +11,8 @@ namespace sbnd {
       : fTs0          (0)
       , fTs1          (0)
       , fUnixS        (0)
-      , fNHits        (0)
       , fTagger       (kUndefinedTagger)
+      , fNHits        (0)
       , fComposition  (kUndefinedSet)
     {}
 
@@ -21,16 +21,16 @@ namespace sbnd {
       : fTs0          (_ts0)
       , fTs1          (_ts1)
       , fUnixS        (_unixS)
-      , fNHits        (_nHits)
       , fTagger       (_tagger)
+      , fNHits        (_nHits)
       , fComposition  (_composition)
     {}
 
-    CRTCluster::~CRTCluster() {}
-
     uint32_t  CRTCluster::Ts0() const { return fTs0; }
     uint32_t  CRTCluster::Ts1() const { return fTs1; }
     uint32_t  CRTCluster::UnixS() const { return fUnixS; }
+    sbn::TimeNs_t CRTCluster::Ts0Time() const { return sbn::TimeNs_t::fromSeconds(fUnixS, fTs0); }
+    sbn::TimeNs_t CRTCluster::Ts1Time() const { return sbn::TimeNs_t{ fTs1 }; }
     uint16_t  CRTCluster::NHits() const { return fNHits; }
     CRTTagger CRTCluster::Tagger() const { return fTagger; }
     CoordSet  CRTCluster::Composition() const { return fComposition; }
@@ -11,6 +11,7 @@
 #define SBND_CRTCLUSTER_HH
 
 #include "sbnobj/SBND/CRT/CRTEnums.hh"
+#include "sbnobj/Common/Utilities/TimeNs.h"
 
 namespace sbnd::crt {
 
@@ -19,8 +20,8 @@ namespace sbnd::crt {
     uint32_t  fTs0;          // T0 counter [ns]
     uint32_t  fTs1;          // T1 counter [ns]
     uint32_t  fUnixS;        // Unixtime of event [s]
-    uint16_t  fNHits;        // The number of strip hits forming the cluster
     CRTTagger fTagger;       // The tagger this cluster exists on
+    uint16_t  fNHits;        // The number of strip hits forming the cluster
     CoordSet  fComposition;  // What combination of orientations does the cluster make up?
 
   public:
@@ -30,11 +31,11 @@ namespace sbnd::crt {
     CRTCluster(uint32_t _ts0, uint32_t _ts1, uint32_t _unixS, uint16_t _nHits, CRTTagger _tagger,
                CoordSet _composition);
 
-    virtual ~CRTCluster();
-
     uint32_t  Ts0() const;
     uint32_t  Ts1() const;
     uint32_t  UnixS() const;
+    sbn::TimeNs_t Ts0Time() const; // T0 since the Epoch, from UnixS and Ts0
+    sbn::TimeNs_t Ts1Time() const;
     uint16_t  NHits() const;
     CRTTagger Tagger() const;
     CoordSet  Composition() const;
@@ -0,0 +1,114 @@
+#ifndef SBND_CRTCLUSTERSTREAMBUILDER_CXX
+#define SBND_CRTCLUSTERSTREAMBUILDER_CXX
+
+#include "cetlib_except/exception.h"
+
+#include "sbnobj/SBND/CRT/CRTClusterStreamBuilder.hh"
+
+#include <limits>
+
+namespace {
+
+  int64_t StripHitTime(const sbnd::crt::CRTStripHit &hit)
+  {
+    return static_cast<int64_t>(hit.UnixS()) * 1'000'000'000LL + hit.Ts0();
+  }
+
+} // local namespace
+
+namespace sbnd {
+
+  namespace crt {
+
+    CRTClusterStreamBuilder::CRTClusterStreamBuilder(const uint32_t window)
+      : fWindow      (window)
+      , fLastTime    (std::numeric_limits<int64_t>::min())
+      , fOpen        ()
+      , fClusters    ()
+      , fClusterHits ()
+      , fHitIndices  ()
+    {}
+
+    void CRTClusterStreamBuilder::Add(const uint32_t hitIndex, const CRTStripHit &hit, const CRTTagger tagger,
+                                      const CoordSet orientation)
+    {
+      if(tagger == kUndefinedTagger)
+        throw cet::exception("sbnd::crt::CRTClusterStreamBuilder") << "strip hit " << hitIndex
+                                                                   << " has no tagger.\n";
+
+      const int64_t time = StripHitTime(hit);
+      if(time < fLastTime)
+        throw cet::exception("sbnd::crt::CRTClusterStreamBuilder") << "strip hit " << hitIndex
+                                                                   << " is earlier than the previous one.\n";
+      fLastTime = time;
+
+      // close the clusters the stream has moved past, including this tagger's one
+      for(int t = 0; t <= kTopHighTagger; ++t)
+        {
+          if(!fOpen[t].hits.empty() && time - fOpen[t].start > fWindow)
+            Close(static_cast<CRTTagger>(t));
+        }
+
+      OpenCluster &cluster = fOpen[tagger];
+      if(cluster.hits.empty() || cluster.hits.size() == std::numeric_limits<uint16_t>::max())
+        {
+          if(!cluster.hits.empty()) Close(tagger);
+          cluster.start = time;
+          cluster.unixS = hit.UnixS();
+        }
+
+      cluster.sumDelay += time - cluster.start;
+      cluster.sumTs1 += hit.Ts1();
+      cluster.composition = cluster.composition | orientation;
+      cluster.hits.push_back(hitIndex);
+    }
+
+    void CRTClusterStreamBuilder::Flush()
+    {
+      for(int t = 0; t <= kTopHighTagger; ++t)
+        {
+          if(!fOpen[t].hits.empty())
+            Close(static_cast<CRTTagger>(t));
+        }
+    }
+
+    void CRTClusterStreamBuilder::Clear()
+    {
+      fClusters.clear();
+      fClusterHits.clear();
+      fHitIndices.clear();
+    }
+
+    std::size_t CRTClusterStreamBuilder::NOpenClusters() const
+    {
+      std::size_t n = 0;
+      for(OpenCluster const& cluster : fOpen)
+        if(!cluster.hits.empty()) ++n;
+      return n;
+    }
+
+    const std::vector<CRTCluster>& CRTClusterStreamBuilder::Clusters() const { return fClusters; }
+    const std::vector<CRTClusterHitRange>& CRTClusterStreamBuilder::ClusterHits() const { return fClusterHits; }
+    const std::vector<uint32_t>& CRTClusterStreamBuilder::HitIndices() const { return fHitIndices; }
+
+    void CRTClusterStreamBuilder::Close(const CRTTagger tagger)
+    {
+      OpenCluster &cluster = fOpen[tagger];
+      const uint64_t n = cluster.hits.size();
+      const int64_t ts0 = cluster.start - static_cast<int64_t>(cluster.unixS) * 1'000'000'000LL
+        + static_cast<int64_t>(cluster.sumDelay / n);
+
+      fClusters.emplace_back(static_cast<uint32_t>(ts0), static_cast<uint32_t>(cluster.sumTs1 / n),
+                             cluster.unixS, static_cast<uint16_t>(n), tagger, cluster.composition);
+      fClusterHits.push_back({static_cast<uint32_t>(fHitIndices.size()), static_cast<uint16_t>(n)});
+      fHitIndices.insert(fHitIndices.end(), cluster.hits.begin(), cluster.hits.end());
+
+      cluster.sumDelay = 0;
+      cluster.sumTs1 = 0;
+      cluster.composition = kUndefinedSet;
+      cluster.hits.clear(); // keeps the memory for the next cluster
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,89 @@
+/**
+ * \class CRTClusterStreamBuilder
+ *
+ * \brief Builds CRTClusters incrementally from a time-ordered stream of strip hits
+ *
+ */
+
+#ifndef SBND_CRTCLUSTERSTREAMBUILDER_HH
+#define SBND_CRTCLUSTERSTREAMBUILDER_HH
+
+#include "sbnobj/SBND/CRT/CRTStripHit.hh"
+#include "sbnobj/SBND/CRT/CRTCluster.hh"
+#include "sbnobj/SBND/CRT/CRTEnums.hh"
+
+#include <stdint.h>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace sbnd::crt {
+
+  // Range of the strip hits of a cluster in CRTClusterStreamBuilder::HitIndices().
+  struct CRTClusterHitRange {
+    uint32_t first;  // first entry of the cluster in the hit index list
+    uint16_t nHits;  // number of hits of the cluster
+  };
+
+  /**
+   * Strip hits are added in ascending time (UnixS() then Ts0()), each with
+   * its tagger and orientation. Each tagger has at most one open cluster: a
+   * hit joins it if it is within the coincidence window from the first hit
+   * of the cluster, otherwise the cluster is closed and a new one started.
+   * Clusters of all the taggers are also closed as soon as the stream moves
+   * past their window, so that only the hits of the open clusters are kept.
+   *
+   * Closed clusters are available from Clusters(), with the indices of
+   * their hits (as given to Add()) in the ranges of ClusterHits().
+   * Clear() drops them, e.g. after they have been handed over.
+   *
+   * The time of a cluster is the average of the ones of its hits, and its
+   * composition the union of their orientations. Its Ts0 is counted from
+   * the second of its first hit, also if later hits are past the next one.
+   */
+  class CRTClusterStreamBuilder {
+
+  public:
+
+    // Builder joining hits within `window` [ns] from the first hit of a cluster.
+    CRTClusterStreamBuilder(const uint32_t window);
+
+    // Adds the strip hit with index `hitIndex`; throws if it is earlier than the previous one.
+    void Add(const uint32_t hitIndex, const CRTStripHit &hit, const CRTTagger tagger, const CoordSet orientation);
+
+    // Closes all the open clusters (e.g. at the end of the stream).
+    void Flush();
+
+    // Drops the closed clusters and their hit indices.
+    void Clear();
+
+    std::size_t NOpenClusters() const;
+
+    const std::vector<CRTCluster>&         Clusters() const;
+    const std::vector<CRTClusterHitRange>& ClusterHits() const;
+    const std::vector<uint32_t>&           HitIndices() const;
+
+  private:
+
+    // Hits of the open cluster of a tagger.
+    struct OpenCluster {
+      int64_t               start = 0;       // time of the first hit [ns]
+      uint32_t              unixS = 0;       // unix time of the first hit [s]
+      uint64_t              sumDelay = 0;    // sum of the hit times from the first one [ns]
+      uint64_t              sumTs1 = 0;      // sum of the Ts1 of the hits [ns]
+      CoordSet              composition = kUndefinedSet;
+      std::vector<uint32_t> hits;            // indices of the hits
+    };
+
+    uint32_t                               fWindow;      // coincidence window [ns]
+    int64_t                                fLastTime;    // time of the last hit added [ns]
+    std::array<OpenCluster, kTopHighTagger + 1> fOpen;   // open cluster of each tagger
+    std::vector<CRTCluster>                fClusters;    // closed clusters
+    std::vector<CRTClusterHitRange>        fClusterHits; // hits of each closed cluster
+    std::vector<uint32_t>                  fHitIndices;  // hits of all the closed clusters
+
+    void Close(const CRTTagger tagger);
+  };
+}
+
+#endif
@@ -14,9 +14,6 @@ namespace crt{
     fADC(adc){
   }
 
-  CRTData::~CRTData(){
-  }
-
   uint32_t CRTData::Channel() const {
     return fChannel;
   }
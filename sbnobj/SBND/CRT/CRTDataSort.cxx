@@ -0,0 +1,79 @@
+#ifndef SBND_CRTDATASORT_CXX
+#define SBND_CRTDATASORT_CXX
+
+#include "sbnobj/SBND/CRT/CRTDataSort.hh"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace {
+
+  constexpr unsigned int DigitBits = 8;
+  constexpr unsigned int NDigits = 64 / DigitBits;
+  constexpr std::size_t NBuckets = std::size_t{1} << DigitBits;
+
+  template <typename Data>
+  std::uint64_t channelT0Key(Data const& d)
+  {
+    return (std::uint64_t{d.Channel()} << 32) | d.T0();
+  }
+
+  template <typename Data>
+  void radixSortByChannelAndT0(std::vector<Data>& data)
+  {
+    std::size_t const n = data.size();
+    if (n < 2) return;
+
+    // histograms of all the digits, in a single pass
+    std::vector<std::uint64_t> keys(n);
+    std::array<std::array<std::size_t, NBuckets>, NDigits> counts{};
+    for (std::size_t i = 0; i < n; ++i) {
+      std::uint64_t const key = keys[i] = channelT0Key(data[i]);
+      for (unsigned int d = 0; d < NDigits; ++d)
+        ++counts[d][(key >> (d * DigitBits)) & (NBuckets - 1)];
+    }
+
+    std::vector<Data> buffer(n);
+    std::vector<std::uint64_t> keyBuffer(n);
+    for (unsigned int d = 0; d < NDigits; ++d) {
+      auto& count = counts[d];
+      unsigned int const shift = d * DigitBits;
+      // all entries with the same digit: this pass would not move anything
+      if (count[(keys[0] >> shift) & (NBuckets - 1)] == n) continue;
+
+      std::size_t offset = 0;
+      for (std::size_t& c : count) {
+        std::size_t const size = c;
+        c = offset;
+        offset += size;
+      }
+      for (std::size_t i = 0; i < n; ++i) {
+        std::size_t const dest = count[(keys[i] >> shift) & (NBuckets - 1)]++;
+        buffer[dest] = data[i];
+        keyBuffer[dest] = keys[i];
+      }
+      data.swap(buffer);
+      keys.swap(keyBuffer);
+    }
+  }
+
+} // local namespace
+
+namespace sbnd{
+namespace crt{
+
+  void SortByChannelAndT0(std::vector<CRTData>& data)
+  {
+    radixSortByChannelAndT0(data);
+  }
+
+  void SortByChannelAndT0(std::vector<PackedCRTData>& data)
+  {
+    radixSortByChannelAndT0(data);
+  }
+
+} // namespace crt
+} // namespace sbnd
+
+#endif
@@ -0,0 +1,31 @@
+/**
+ * \brief Sorting of the CRT data of an event by channel and time
+ *
+ */
+
+#ifndef SBND_CRTDATASORT_HH
+#define SBND_CRTDATASORT_HH
+
+#include "sbnobj/SBND/CRT/CRTData.hh"
+#include "sbnobj/SBND/CRT/PackedCRTData.hh"
+
+#include <vector>
+
+namespace sbnd::crt {
+
+  /**
+   * Sorts `data` by channel and, within the same channel, by T0.
+   *
+   * This is a least significant digit radix sort, linear in the size of
+   * `data`; digits which are the same for all the entries are skipped.
+   * The sort is stable: entries with the same channel and T0 keep their order,
+   * the same as `std::stable_sort()` would do.
+   */
+  void SortByChannelAndT0(std::vector<CRTData>& data);
+
+  /// Sorts `data` by channel and T0 (see the `CRTData` version).
+  void SortByChannelAndT0(std::vector<PackedCRTData>& data);
+
+} // namespace sbnd::crt
+
+#endif
@@ -17,4 +17,26 @@ sbnd::crt::CoordSet operator&(sbnd::crt::CoordSet lhs, sbnd::crt::CoordSet rhs)
   );
 }
 
+sbnd::crt::CRTTaggerMask sbnd::crt::TaggerMask(const std::set<CRTTagger> &taggers) {
+  CRTTaggerMask mask = 0;
+  for(CRTTagger const tagger : taggers)
+    mask |= TaggerBit(tagger);
+  return mask;
+}
+
+std::set<sbnd::crt::CRTTagger> sbnd::crt::TaggerSet(const CRTTaggerMask mask) {
+  std::set<CRTTagger> taggers;
+  for(int tagger = kBottomTagger; tagger <= kTopHighTagger; ++tagger) {
+    if(mask & TaggerBit(static_cast<CRTTagger>(tagger)))
+      taggers.insert(static_cast<CRTTagger>(tagger));
+  }
+  return taggers;
+}
+
+unsigned sbnd::crt::NTaggers(const CRTTaggerMask mask) {
+  unsigned n = 0;
+  for(CRTTaggerMask m = mask; m; m &= m - 1) ++n;
+  return n;
+}
+
 #endif
@@ -8,6 +8,7 @@
 #define SBND_CRTENUMS_HH
 
 #include <stdint.h>
+#include <set>
 #include <type_traits>
 
 namespace sbnd::crt {
@@ -44,6 +45,21 @@ namespace sbnd::crt {
     kThreeD = kXYZ
 
   };
+
+  // A set of CRTTaggers stored as a bitset, like CoordSet: bit n is set if the tagger with value n is included.
+
+  typedef uint8_t CRTTaggerMask;
+
+  constexpr CRTTaggerMask TaggerBit(const CRTTagger tagger)
+  {
+    return tagger == kUndefinedTagger ? 0 : static_cast<CRTTaggerMask>(1u << tagger);
+  }
+
+  CRTTaggerMask TaggerMask(const std::set<CRTTagger> &taggers);
+
+  std::set<CRTTagger> TaggerSet(const CRTTaggerMask mask);
+
+  unsigned NTaggers(const CRTTaggerMask mask);
 }
 
 extern sbnd::crt::CoordSet operator|(sbnd::crt::CoordSet lhs, sbnd::crt::CoordSet rhs);
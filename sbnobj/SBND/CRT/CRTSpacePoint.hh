@@ -12,19 +12,33 @@
 
 #include "larcoreobj/SimpleTypesAndConstants/geo_vectors.h"
 
+#include <stdint.h>
+
 namespace sbnd::crt {
 
   class CRTSpacePoint {
-    
-    geo::Point_t fPos;      // position [cm]
-    geo::Point_t fPosErr;   // positional error [cm]
-    double       fPE;       // total PE
-    double       fTime;     // time [ns]
-    double       fTimeErr;  // time error [ns]
-    bool         fComplete; // whether or not the cluster was 3D and contained overlaps
+
+    // Positions and errors are stored as float (well below 1 mm precision
+    // across the detector) and the flags in a byte, in 48 bytes overall;
+    // the time keeps double precision.
+
+    double   fTime;     // time [ns]
+    float    fX;        // position [cm]
+    float    fY;
+    float    fZ;
+    float    fXErr;     // positional error [cm]
+    float    fYErr;
+    float    fZErr;
+    float    fPE;       // total PE
+    float    fTimeErr;  // time error [ns]
+    uint8_t  fFlags;    // bitset of Flag values
 
   public:
 
+    enum Flag : uint8_t {
+      kComplete = 1 // the cluster was 3D and contained overlaps
+    };
+
     CRTSpacePoint();
     
     CRTSpacePoint(double _x, double _ex, double _y, double _ey, double _z, double _ez, double _pe, 
@@ -32,8 +46,6 @@ namespace sbnd::crt {
 
     CRTSpacePoint(geo::Point_t _pos, geo::Point_t _err, double _pe, double _time, double _etime, bool _complete);
 
-    virtual ~CRTSpacePoint();
-
     double       X() const;
     double       XErr() const;
     double       Y() const;
@@ -46,6 +58,7 @@ namespace sbnd::crt {
     double       Time() const;
     double       TimeErr() const;
     bool         Complete() const;
+    uint8_t      Flags() const;
 
     CRTSpacePoint& operator= (CRTSpacePoint const&) = default;
   };
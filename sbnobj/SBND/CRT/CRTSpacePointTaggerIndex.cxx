@@ -0,0 +1,70 @@
+#ifndef SBND_CRTSPACEPOINTTAGGERINDEX_CXX
+#define SBND_CRTSPACEPOINTTAGGERINDEX_CXX
+
+#include "cetlib_except/exception.h"
+
+#include "sbnobj/SBND/CRT/CRTSpacePointTaggerIndex.hh"
+
+#include <algorithm>
+
+namespace sbnd {
+
+  namespace crt {
+
+    CRTSpacePointTaggerIndex::CRTSpacePointTaggerIndex()
+      : fBuckets ()
+    {}
+
+    CRTSpacePointTaggerIndex::CRTSpacePointTaggerIndex(const std::vector<CRTSpacePoint> &spacePoints,
+                                                       const std::vector<CRTTagger> &taggers)
+      : fBuckets ()
+    {
+      if(spacePoints.size() != taggers.size())
+        throw cet::exception("sbnd::crt::CRTSpacePointTaggerIndex")
+          << spacePoints.size() << " space points but " << taggers.size() << " taggers.\n";
+
+      std::array<std::size_t, N_TAGGERS> counts{};
+      for(CRTTagger const tagger : taggers)
+        if(tagger != kUndefinedTagger) ++counts[tagger];
+      for(int t = 0; t < N_TAGGERS; ++t)
+        fBuckets[t].reserve(counts[t]);
+
+      for(std::size_t i = 0; i < spacePoints.size(); ++i)
+        {
+          if(taggers[i] == kUndefinedTagger) continue;
+          fBuckets[taggers[i]].push_back({spacePoints[i].Time(), static_cast<uint32_t>(i)});
+        }
+
+      for(std::vector<Entry> &bucket : fBuckets)
+        std::stable_sort(bucket.begin(), bucket.end(),
+                         [](Entry const& a, Entry const& b){ return a.time < b.time; });
+    }
+
+    std::size_t CRTSpacePointTaggerIndex::NPoints(const CRTTagger tagger) const
+    {
+      return (tagger == kUndefinedTagger) ? 0 : fBuckets[tagger].size();
+    }
+
+    CRTSpacePointTaggerIndex::Range CRTSpacePointTaggerIndex::Points(const CRTTagger tagger) const
+    {
+      if(tagger == kUndefinedTagger) return {};
+
+      std::vector<Entry> const& bucket = fBuckets[tagger];
+      return { bucket.data(), bucket.data() + bucket.size() };
+    }
+
+    CRTSpacePointTaggerIndex::Range CRTSpacePointTaggerIndex::Window(const CRTTagger tagger, const double start,
+                                                                     const double stop) const
+    {
+      Range const all = Points(tagger);
+
+      Entry const* first = std::lower_bound(all.begin(), all.end(), start,
+                                            [](Entry const& e, double t){ return e.time < t; });
+      Entry const* last = std::lower_bound(first, all.end(), stop,
+                                           [](Entry const& e, double t){ return e.time < t; });
+      return { first, last };
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,77 @@
+/**
+ * \class CRTSpacePointTaggerIndex
+ *
+ * \brief Index of CRTSpacePoints by tagger, sorted by time within each tagger
+ *
+ */
+
+#ifndef SBND_CRTSPACEPOINTTAGGERINDEX_HH
+#define SBND_CRTSPACEPOINTTAGGERINDEX_HH
+
+#include "sbnobj/SBND/CRT/CRTSpacePoint.hh"
+#include "sbnobj/SBND/CRT/CRTEnums.hh"
+
+#include <stdint.h>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace sbnd::crt {
+
+  constexpr int N_TAGGERS = kTopHighTagger + 1;
+
+  /**
+   * Refers to space points by their position in the collection the index is
+   * built from, which must be kept unchanged while the index is used.
+   * As space points do not record their tagger, the tagger of each point
+   * (usually the one of its cluster) is given when building the index.
+   *
+   * Candidate tracks can then be formed by sweeping the points of one
+   * tagger in time and querying the other taggers around each time:
+   *
+   *     for(auto const& [time, iSP] : index.Points(kTopHighTagger))
+   *       for(CRTSpacePointTaggerIndex::Entry const& match : index.Window(kTopLowTagger, time - dt, time + dt))
+   *         ... // spacePoints[iSP] and spacePoints[match.index]
+   */
+  class CRTSpacePointTaggerIndex {
+
+  public:
+
+    // Time and space point index of an entry.
+    struct Entry {
+      double   time;  // Time() of the space point [ns]
+      uint32_t index; // position of the space point in the indexed collection
+    };
+
+    // Range of entries, in ascending time.
+    struct Range {
+      Entry const* first = nullptr;
+      Entry const* last = nullptr;
+
+      Entry const* begin() const { return first; }
+      Entry const* end() const { return last; }
+      std::size_t size() const { return last - first; }
+      bool empty() const { return first == last; }
+    };
+
+    CRTSpacePointTaggerIndex();
+
+    // Points with kUndefinedTagger are not indexed.
+    CRTSpacePointTaggerIndex(const std::vector<CRTSpacePoint> &spacePoints, const std::vector<CRTTagger> &taggers);
+
+    std::size_t NPoints(const CRTTagger tagger) const;
+
+    // All the points of the tagger, in ascending time.
+    Range Points(const CRTTagger tagger) const;
+
+    // Points of the tagger with start <= time < stop [ns] (half-open window).
+    Range Window(const CRTTagger tagger, const double start, const double stop) const;
+
+  private:
+
+    std::array<std::vector<Entry>, N_TAGGERS> fBuckets; // sorted entries of each tagger
+  };
+
+}
+
+#endif
@@ -49,12 +49,12 @@ namespace sbnd {
       , fSaturated2   (_saturated2)
     {}
 
-    CRTStripHit::~CRTStripHit() {}
-
     uint32_t CRTStripHit::Channel() const { return fChannel; }
     uint32_t CRTStripHit::Ts0() const { return fTs0; }
     uint32_t CRTStripHit::Ts1() const { return fTs1; }
     uint32_t CRTStripHit::UnixS() const { return fUnixS; }
+    sbn::TimeNs_t CRTStripHit::Ts0Time() const { return sbn::TimeNs_t::fromSeconds(fUnixS, fTs0); }
+    sbn::TimeNs_t CRTStripHit::Ts1Time() const { return sbn::TimeNs_t{ fTs1 }; }
     double   CRTStripHit::Pos() const { return fPos; }
     double   CRTStripHit::Error() const { return fErr; }
     uint16_t CRTStripHit::ADC1() const { return fADC1; }
@@ -10,6 +10,8 @@
 #ifndef SBND_CRTSTRIPHIT_HH
 #define SBND_CRTSTRIPHIT_HH
 
+#include "sbnobj/Common/Utilities/TimeNs.h"
+
 #include <stdint.h>
 
 namespace sbnd::crt {
@@ -20,8 +22,8 @@ namespace sbnd::crt {
     uint32_t fTs0;          // T0 counter [ns] - Time relative to pulse-per-second
     uint32_t fTs1;          // T1 counter [ns] - Time relative to some beam signal
     uint32_t fUnixS;        // Unixtime of event [s]
-    double   fPos;          // Lateral position within strip [cm]
-    double   fErr;          // Error on lateral position [cm]
+    float    fPos;          // Lateral position within strip [cm]
+    float    fErr;          // Error on lateral position [cm]
     uint16_t fADC1;         // ADC 1st SiPM
     uint16_t fADC2;         // ADC 2nd SiPM
     bool     fSaturated1;   // Did 1st SiPM record a saturated value?
@@ -37,12 +39,12 @@ namespace sbnd::crt {
     CRTStripHit(uint32_t _channel, uint32_t _ts0, uint32_t _ts1, uint32_t _s, double _pos,
                 double _err, uint16_t _adc1, uint16_t _adc2, bool _saturated1, bool _saturated2);
 
-    virtual ~CRTStripHit();
-
     uint32_t Channel() const;
     uint32_t Ts0() const;
     uint32_t Ts1() const;
     uint32_t UnixS() const;
+    sbn::TimeNs_t Ts0Time() const; // T0 since the Epoch, from UnixS and Ts0
+    sbn::TimeNs_t Ts1Time() const;
     double   Pos() const;
     double   Error() const;
     uint16_t ADC1() const;
@@ -0,0 +1,85 @@
+#ifndef SBND_CRTSTRIPHITKERNEL_CXX
+#define SBND_CRTSTRIPHITKERNEL_CXX
+
+#include "sbnobj/SBND/CRT/CRTStripHitKernel.hh"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+  // Integer arithmetic and no conditional floating point operation (which
+  // could trap) leave the loop with no branch, for the compiler to vectorize.
+  void FormStripHitsKernel(uint16_t const* __restrict__ adc, int32_t const* __restrict__ pedestals,
+                           int32_t threshold, uint16_t saturation, float width,
+                           float* __restrict__ pos, float* __restrict__ err,
+                           uint16_t* __restrict__ adc1, uint16_t* __restrict__ adc2,
+                           uint8_t* __restrict__ saturated1, uint8_t* __restrict__ saturated2,
+                           uint8_t* __restrict__ accepted)
+  {
+    float const uniformErr = width / std::sqrt(12.f);
+
+    for (int i = 0; i < sbnd::crt::N_STRIPS; ++i) {
+      int32_t const raw1 = adc[2 * i], raw2 = adc[2 * i + 1];
+      int32_t const a1 = std::max(raw1 - pedestals[2 * i], 0);
+      int32_t const a2 = std::max(raw2 - pedestals[2 * i + 1], 0);
+      int32_t const sum = a1 + a2;
+
+      // an empty strip gets position 0 rather than a division by 0
+      pos[i] = width * static_cast<float>(a1) / static_cast<float>(sum + (sum == 0));
+      err[i] = uniformErr;
+      adc1[i] = static_cast<uint16_t>(a1);
+      adc2[i] = static_cast<uint16_t>(a2);
+      saturated1[i] = (raw1 >= saturation);
+      saturated2[i] = (raw2 >= saturation);
+      accepted[i] = (sum > threshold);
+    }
+  }
+
+  std::size_t AppendStripHits(sbnd::crt::FEBStripHits const& strips, uint32_t firstChannel,
+                              uint32_t ts0, uint32_t ts1, uint32_t unixs,
+                              std::vector<sbnd::crt::CRTStripHit>& hits)
+  {
+    std::size_t n = 0;
+    for (int i = 0; i < sbnd::crt::N_STRIPS; ++i) {
+      if (!strips.accepted[i]) continue;
+      hits.emplace_back(firstChannel + 2 * i, ts0, ts1, unixs, strips.pos[i], strips.err[i],
+                        strips.adc1[i], strips.adc2[i], strips.saturated1[i], strips.saturated2[i]);
+      ++n;
+    }
+    return n;
+  }
+
+} // local namespace
+
+namespace sbnd{
+namespace crt{
+
+  void FormFEBStripHits(adc_array_t const& adc, StripHitParameters const& params, FEBStripHits& hits)
+  {
+    FormStripHitsKernel(adc.data(), params.pedestals.data(), params.threshold, params.saturation,
+                        params.stripWidth, hits.pos.data(), hits.err.data(), hits.adc1.data(),
+                        hits.adc2.data(), hits.saturated1.data(), hits.saturated2.data(),
+                        hits.accepted.data());
+  }
+
+  std::size_t MakeCRTStripHits(FEBRecord const& feb, uint32_t firstChannel,
+                               StripHitParameters const& params, std::vector<CRTStripHit>& hits)
+  {
+    FEBStripHits strips;
+    FormFEBStripHits(feb.adc, params, strips);
+    return AppendStripHits(strips, firstChannel, feb.ts0, feb.ts1, feb.unixs, hits);
+  }
+
+  std::size_t MakeCRTStripHits(FEBData const& feb, uint32_t firstChannel,
+                               StripHitParameters const& params, std::vector<CRTStripHit>& hits)
+  {
+    FEBStripHits strips;
+    FormFEBStripHits(feb.ADC(), params, strips);
+    return AppendStripHits(strips, firstChannel, feb.Ts0(), feb.Ts1(), feb.UnixS(), hits);
+  }
+
+} // namespace crt
+} // namespace sbnd
+
+#endif
@@ -0,0 +1,79 @@
+/**
+ * \brief Formation of CRT strip hits from the ADC values of a whole FEB
+ *
+ */
+
+#ifndef SBND_CRTSTRIPHITKERNEL_HH
+#define SBND_CRTSTRIPHITKERNEL_HH
+
+#include "sbnobj/SBND/CRT/FEBData.hh"
+#include "sbnobj/SBND/CRT/FEBRecord.hh"
+#include "sbnobj/SBND/CRT/CRTStripHit.hh"
+
+#include <stdint.h>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace sbnd::crt {
+
+  constexpr int N_STRIPS = N_CH / 2; ///< Strips read by one FEB, two SiPMs each.
+
+  /**
+   * Calibration of the strip hit formation of one FEB.
+   */
+  struct StripHitParameters {
+
+    std::array<int32_t, N_CH> pedestals{}; ///< Pedestal of each SiPM [ADC]
+    int32_t  threshold  = 0;     ///< Sum of the two pedestal-subtracted ADCs a strip must exceed
+    float    stripWidth = 0.f;   ///< Width of the strips [cm]
+    uint16_t saturation = 4095;  ///< ADC value of a saturated SiPM
+
+  };
+
+  /**
+   * Strip hit candidates of all the strips of one FEB, by column.
+   * Strip `i` is read by SiPMs `2i` and `2i+1`.
+   */
+  struct FEBStripHits {
+
+    std::array<float,    N_STRIPS> pos;       ///< Lateral position within strip [cm]
+    std::array<float,    N_STRIPS> err;       ///< Error on lateral position [cm]
+    std::array<uint16_t, N_STRIPS> adc1;      ///< Pedestal-subtracted ADC, 1st SiPM
+    std::array<uint16_t, N_STRIPS> adc2;      ///< Pedestal-subtracted ADC, 2nd SiPM
+    std::array<uint8_t,  N_STRIPS> saturated1;///< Whether the 1st SiPM is saturated
+    std::array<uint8_t,  N_STRIPS> saturated2;///< Whether the 2nd SiPM is saturated
+    std::array<uint8_t,  N_STRIPS> accepted;  ///< Whether the strip passes the threshold
+
+  };
+
+  /**
+   * Computes the strip hit candidates of all the strips of a FEB at once.
+   *
+   * The ADCs are pedestal-subtracted (and clamped at 0); the position is
+   * from the light sharing between the two SiPMs,
+   * `stripWidth * adc1 / (adc1 + adc2)`, with the error of a uniform
+   * distribution over the strip width.
+   * The loop over strips has no branches, for the compiler to vectorize it.
+   */
+  void FormFEBStripHits(adc_array_t const& adc, StripHitParameters const& params, FEBStripHits& hits);
+
+  /**
+   * Appends to `hits` a `CRTStripHit` for each accepted strip of the FEB.
+   *
+   * @param feb The FEB data.
+   * @param firstChannel Channel ID of the first SiPM of the FEB.
+   * @param params The calibration of this FEB.
+   * @param hits The strip hits to append to.
+   *
+   * @return The number of hits added.
+   */
+  std::size_t MakeCRTStripHits(FEBRecord const& feb, uint32_t firstChannel,
+                               StripHitParameters const& params, std::vector<CRTStripHit>& hits);
+
+  std::size_t MakeCRTStripHits(FEBData const& feb, uint32_t firstChannel,
+                               StripHitParameters const& params, std::vector<CRTStripHit>& hits);
+
+} // namespace sbnd::crt
+
+#endif
@@ -0,0 +1,79 @@
+#ifndef SBND_CRTTAGGERGEOMETRY_CXX
+#define SBND_CRTTAGGERGEOMETRY_CXX
+
+#include "cetlib_except/exception.h"
+
+#include "sbnobj/SBND/CRT/CRTTaggerGeometry.hh"
+
+#include <cstddef>
+
+namespace {
+
+  // Whether the line crosses the plane. Comparisons are combined with `&` so
+  // that all of them are evaluated; a line parallel to the plane gives infinite
+  // or NaN coordinates, which fail the comparisons.
+  inline bool crosses(const sbnd::crt::CRTTaggerPlane &plane, const double p[3], const double d[3])
+  {
+    unsigned const a = plane.normal;
+    unsigned const b = (a + 1) % 3;
+    unsigned const c = (a + 2) % 3;
+    double const t  = (plane.position - p[a]) / d[a];
+    double const qb = p[b] + t * d[b];
+    double const qc = p[c] + t * d[c];
+    return (qb >= plane.lower[b]) & (qb <= plane.upper[b])
+         & (qc >= plane.lower[c]) & (qc <= plane.upper[c]);
+  }
+
+}
+
+namespace sbnd {
+
+  namespace crt {
+
+    bool CRTTaggerGeometry::Crosses(const CRTTagger tagger, const geo::Point_t &point, const geo::Vector_t &dir) const
+    {
+      if(!IsValid(tagger))
+        return false;
+
+      double const p[3] = { point.X(), point.Y(), point.Z() };
+      double const d[3] = { dir.X(), dir.Y(), dir.Z() };
+      return crosses(fPlanes[tagger], p, d);
+    }
+
+    CRTTaggerMask CRTTaggerGeometry::CrossedTaggers(const geo::Point_t &point, const geo::Vector_t &dir) const
+    {
+      double const p[3] = { point.X(), point.Y(), point.Z() };
+      double const d[3] = { dir.X(), dir.Y(), dir.Z() };
+
+      CRTTaggerMask mask = 0;
+      for(int tagger = 0; tagger < N_TAGGERS; ++tagger)
+        mask |= static_cast<CRTTaggerMask>(crosses(fPlanes[tagger], p, d) << tagger);
+      return mask;
+    }
+
+    std::vector<CRTTaggerMask> CRTTaggerGeometry::CrossedTaggers(const std::vector<geo::Point_t> &points,
+                                                                 const std::vector<geo::Vector_t> &dirs) const
+    {
+      if(points.size() != dirs.size())
+        throw cet::exception("sbnd::crt::CRTTaggerGeometry::CrossedTaggers")
+          << points.size() << " points but " << dirs.size() << " directions.\n";
+
+      std::size_t const n = points.size();
+      std::vector<std::array<double, 3>> p(n), d(n);
+      for(std::size_t i = 0; i < n; ++i) {
+        p[i] = { points[i].X(), points[i].Y(), points[i].Z() };
+        d[i] = { dirs[i].X(), dirs[i].Y(), dirs[i].Z() };
+      }
+
+      std::vector<CRTTaggerMask> masks(n, 0);
+      for(int tagger = 0; tagger < N_TAGGERS; ++tagger) {
+        CRTTaggerPlane const& plane = fPlanes[tagger];
+        for(std::size_t i = 0; i < n; ++i)
+          masks[i] |= static_cast<CRTTaggerMask>(crosses(plane, p[i].data(), d[i].data()) << tagger);
+      }
+      return masks;
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,94 @@
+/**
+ * \class CRTTaggerGeometry
+ *
+ * \brief Planes of the CRT taggers, for fast acceptance tests of tracks
+ *
+ */
+
+#ifndef SBND_CRTTAGGERGEOMETRY_HH
+#define SBND_CRTTAGGERGEOMETRY_HH
+
+#include "sbnobj/SBND/CRT/CRTEnums.hh"
+#include "sbnobj/SBND/CRT/CRTSpacePointTaggerIndex.hh"
+
+#include "larcoreobj/SimpleTypesAndConstants/geo_vectors.h"
+
+#include <array>
+#include <limits>
+#include <vector>
+
+namespace sbnd::crt {
+
+  /**
+   * Plane of a tagger, orthogonal to one of the axes at a fixed coordinate,
+   * with its extent along the two other axes.
+   * A default plane has an empty extent and is never hit.
+   */
+  struct CRTTaggerPlane {
+    unsigned normal = 0;                                          // axis of the normal: 0 (x), 1 (y) or 2 (z)
+    double   position = 0.;                                       // coordinate along the normal [cm]
+    std::array<double, 3> lower{ std::numeric_limits<double>::max(),
+                                 std::numeric_limits<double>::max(),
+                                 std::numeric_limits<double>::max() }; // lower corner [cm]
+    std::array<double, 3> upper{ std::numeric_limits<double>::lowest(),
+                                 std::numeric_limits<double>::lowest(),
+                                 std::numeric_limits<double>::lowest() }; // upper corner [cm]
+  };
+
+  /**
+   * Immutable table of the planes of the seven taggers, indexed by CRTTagger.
+   * It can be defined constexpr, or filled once per job from the geometry:
+   *
+   *     std::array<sbnd::crt::CRTTaggerPlane, sbnd::crt::N_TAGGERS> planes;
+   *     // ... for each tagger, from the CRT geometry
+   *     sbnd::crt::CRTTaggerGeometry const taggers{ planes };
+   *
+   *     sbnd::crt::CRTTaggerMask const crossed = taggers.CrossedTaggers(start, dir);
+   *
+   * Tracks are extrapolated as lines, in both directions, so a line may cross
+   * a tagger behind its starting point. A line parallel to a tagger plane
+   * never crosses it. The tests are branchless, and the batch version runs
+   * over all the tracks for one tagger at a time.
+   */
+  class CRTTaggerGeometry {
+
+  public:
+
+    constexpr CRTTaggerGeometry() = default;
+
+    constexpr CRTTaggerGeometry(const std::array<CRTTaggerPlane, N_TAGGERS> &planes)
+      : fPlanes(planes)
+    {}
+
+    // Plane of the tagger; kUndefinedTagger (or any other invalid tagger)
+    // gets InvalidPlane, which is never hit.
+    constexpr const CRTTaggerPlane& Plane(const CRTTagger tagger) const
+    {
+      return IsValid(tagger) ? fPlanes[tagger] : InvalidPlane;
+    }
+
+    static constexpr bool IsValid(const CRTTagger tagger)
+    {
+      return (tagger >= 0) && (tagger < N_TAGGERS);
+    }
+
+    static constexpr CRTTaggerPlane InvalidPlane{};
+
+    // Whether the line through the point along the direction crosses the tagger.
+    bool Crosses(const CRTTagger tagger, const geo::Point_t &point, const geo::Vector_t &dir) const;
+
+    // Mask of the taggers crossed by the line through the point along the direction.
+    CRTTaggerMask CrossedTaggers(const geo::Point_t &point, const geo::Vector_t &dir) const;
+
+    // Masks of the taggers crossed by each of the lines (one direction per point).
+    std::vector<CRTTaggerMask> CrossedTaggers(const std::vector<geo::Point_t> &points,
+                                              const std::vector<geo::Vector_t> &dirs) const;
+
+  private:
+
+    std::array<CRTTaggerPlane, N_TAGGERS> fPlanes{};
+  };
+
+}
+
+#endif
@@ -13,7 +13,7 @@ namespace sbnd {
       , fTimeErr (0.)
       , fPE      (0.)
       , fToF     (0.)
-      , fTaggers ({})
+      , fTaggers (0)
     {}
 
     CRTTrack::CRTTrack(const geo::Point_t &_start, const geo::Point_t &_end, const double &_time, const double &_etime,
@@ -23,7 +23,7 @@ namespace sbnd {
       , fTimeErr (_etime)
       , fPE      (_pe)
       , fToF     (_tof)
-      , fTaggers (_taggers)
+      , fTaggers (sbnd::crt::TaggerMask(_taggers))
     {}
 
     CRTTrack::CRTTrack(const std::vector<geo::Point_t> &_points, const double &_time, const double &_etime,
@@ -33,27 +33,26 @@ namespace sbnd {
       , fTimeErr (_etime)
       , fPE      (_pe)
       , fToF     (_tof)
-      , fTaggers (_taggers)
+      , fTaggers (sbnd::crt::TaggerMask(_taggers))
     {}
 
-    CRTTrack::~CRTTrack() {}
-
-    std::vector<geo::Point_t> CRTTrack::Points() const { return fPoints; }
+    const std::vector<geo::Point_t>& CRTTrack::Points() const { return fPoints; }
     double                    CRTTrack::Time() const {return fTime; }
     double                    CRTTrack::TimeErr() const { return fTimeErr; }
     double                    CRTTrack::PE() const { return fPE; }
     double                    CRTTrack::ToF() const { return fToF; }
-    std::set<CRTTagger>       CRTTrack::Taggers() const { return fTaggers; }
+    std::set<CRTTagger>       CRTTrack::Taggers() const { return TaggerSet(fTaggers); }
+    CRTTaggerMask             CRTTrack::TaggerMask() const { return fTaggers; }
 
-    geo::Point_t  CRTTrack::Start() const { return fPoints.front(); }
-    geo::Point_t  CRTTrack::End() const { return fPoints.back(); }
+    const geo::Point_t& CRTTrack::Start() const { return fPoints.front(); }
+    const geo::Point_t& CRTTrack::End() const { return fPoints.back(); }
     geo::Vector_t CRTTrack::Direction() const { return (End() - Start()).Unit(); }
     double        CRTTrack::Length() const { return (End() - Start()).R(); }
     double        CRTTrack::Theta() const { return (End() - Start()).Theta(); }
     double        CRTTrack::Phi() const { return (End() - Start()).Phi(); }
-    bool          CRTTrack::Triple() const { return fTaggers.size() == 3; }
+    bool          CRTTrack::Triple() const { return NTaggers(fTaggers) == 3; }
 
-    bool CRTTrack::UsedTagger(const CRTTagger tagger) const { return fTaggers.count(tagger) == 1; }
+    bool CRTTrack::UsedTagger(const CRTTagger tagger) const { return (fTaggers & TaggerBit(tagger)) != 0; }
   }
 }
 
@@ -25,7 +25,7 @@ namespace sbnd::crt {
     double                    fTimeErr; // average time error [ns]
     double                    fPE;      // total PE
     double                    fToF;     // time from first space point to last [ns]
-    std::set<CRTTagger>       fTaggers; // which taggers were used to create the track
+    CRTTaggerMask             fTaggers; // which taggers were used to create the track
 
   public:
 
@@ -37,17 +37,16 @@ namespace sbnd::crt {
     CRTTrack(const std::vector<geo::Point_t> &_points, const double &_time, const double &_etime,
              const double &_pe, const double &_tof, const std::set<CRTTagger> &_taggers);
 
-    virtual ~CRTTrack();
-
-    std::vector<geo::Point_t> Points() const;
+    const std::vector<geo::Point_t>& Points() const;
     double                    Time() const;
     double                    TimeErr() const;
     double                    PE() const;
     double                    ToF() const;
-    std::set<CRTTagger>       Taggers() const;
+    std::set<CRTTagger>       Taggers() const;   // builds a set, prefer TaggerMask()
+    CRTTaggerMask             TaggerMask() const;
 
-    geo::Point_t  Start() const;
-    geo::Point_t  End() const;
+    const geo::Point_t& Start() const;
+    const geo::Point_t& End() const;
     geo::Vector_t Direction() const;
     double        Length() const;
     double        Theta() const;
@@ -0,0 +1,76 @@
+/**
+ * \class pmr::CRTTrack
+ *
+ * \brief Transient CRTTrack with the points allocated from a memory resource
+ *
+ */
+
+#ifndef SBND_CRTTRACKPMR_HH
+#define SBND_CRTTRACKPMR_HH
+
+#include "sbnobj/SBND/CRT/CRTTrack.hh"
+
+#include <cstddef>
+#include <memory_resource>
+#include <utility>
+#include <vector>
+
+namespace sbnd::crt::pmr {
+
+  /**
+   * Reconstruction-only form of `sbnd::crt::CRTTrack`, whose points come from
+   * a memory resource (e.g. a `sbn::crt::CRTEventArena`). It is
+   * allocator-aware, so tracks in a `std::pmr::vector` use the resource of
+   * the vector. `toCRTTrack()` makes the persistent product.
+   */
+  struct CRTTrack {
+
+    using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+    std::pmr::vector<geo::Point_t> points; // the fitted track points at each tagger [cm]
+    double        time    = 0.; // average time [ns]
+    double        timeErr = 0.; // average time error [ns]
+    double        pe      = 0.; // total PE
+    double        tof     = 0.; // time from first space point to last [ns]
+    CRTTaggerMask taggers = 0;  // which taggers were used to create the track
+
+    explicit CRTTrack(allocator_type alloc = {})
+      : points(alloc)
+    {}
+
+    CRTTrack(CRTTrack const& other, allocator_type alloc)
+      : points(other.points, alloc)
+      , time(other.time), timeErr(other.timeErr), pe(other.pe), tof(other.tof), taggers(other.taggers)
+    {}
+
+    CRTTrack(CRTTrack&& other, allocator_type alloc)
+      : points(std::move(other.points), alloc)
+      , time(other.time), timeErr(other.timeErr), pe(other.pe), tof(other.tof), taggers(other.taggers)
+    {}
+
+    CRTTrack(CRTTrack const&) = default;
+    CRTTrack(CRTTrack&&) = default;
+    CRTTrack& operator=(CRTTrack const&) = default;
+    CRTTrack& operator=(CRTTrack&&) = default;
+
+    allocator_type get_allocator() const { return points.get_allocator(); }
+
+    // persistent copy
+    sbnd::crt::CRTTrack toCRTTrack() const
+    {
+      return sbnd::crt::CRTTrack(std::vector<geo::Point_t>(points.begin(), points.end()),
+                                 time, timeErr, pe, tof, TaggerSet(taggers));
+    }
+  };
+
+  inline std::vector<sbnd::crt::CRTTrack> toPersistent(std::pmr::vector<CRTTrack> const& tracks)
+  {
+    std::vector<sbnd::crt::CRTTrack> result;
+    result.reserve(tracks.size());
+    for(CRTTrack const& track : tracks)
+      result.push_back(track.toCRTTrack());
+    return result;
+  }
+}
+
+#endif
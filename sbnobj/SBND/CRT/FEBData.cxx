@@ -55,7 +55,7 @@ namespace crt{
     return fUnixS;
   }
 
-  adc_array_t FEBData::ADC() const
+  adc_array_t const& FEBData::ADC() const
   {
     return fADC;
   }
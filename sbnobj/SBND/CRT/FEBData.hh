@@ -7,6 +7,7 @@
 #ifndef SBND_FEBDATA_HH
 #define SBND_FEBDATA_HH
 
+#include <stddef.h>
 #include <stdint.h>
 #include <vector>
 #include <utility>
@@ -92,7 +93,7 @@ namespace sbnd::crt {
      *
      * @return The ADC array of size 32 of this FEB data.
      */
-    adc_array_t ADC() const;
+    adc_array_t const& ADC() const;
 
     /**
      * Returns the ACD counts from a certain sipm in the FEB board.
@@ -0,0 +1,47 @@
+#ifndef SBND_FEBRECORD_CXX
+#define SBND_FEBRECORD_CXX
+
+#include "cetlib_except/exception.h"
+
+#include "sbnobj/SBND/CRT/FEBRecord.hh"
+
+#include <cstring>
+
+namespace sbnd{
+namespace crt{
+
+  std::vector<FEBRecord> DecodeFEBRecords(void const* data, std::size_t size)
+  {
+    std::vector<FEBRecord> records;
+    DecodeFEBRecords(data, size, records);
+    return records;
+  }
+
+  std::size_t DecodeFEBRecords(void const* data, std::size_t size, std::vector<FEBRecord>& records)
+  {
+    if (size % sizeof(FEBRecord) != 0) {
+      throw cet::exception("sbnd::crt::DecodeFEBRecords")
+        << "buffer size " << size << " is not a multiple of the record size "
+        << sizeof(FEBRecord) << ".\n";
+    }
+
+    std::size_t const n = size / sizeof(FEBRecord);
+    std::size_t const first = records.size();
+    records.resize(first + n);
+    if (n > 0) std::memcpy(records.data() + first, data, size);
+    return n;
+  }
+
+  std::vector<FEBData> ToFEBData(std::vector<FEBRecord> const& records)
+  {
+    std::vector<FEBData> febs;
+    febs.reserve(records.size());
+    for (FEBRecord const& r : records)
+      febs.emplace_back(r.mac5, r.flags, r.ts0, r.ts1, r.unixs, r.adc, r.coinc);
+    return febs;
+  }
+
+} // namespace crt
+} // namespace sbnd
+
+#endif
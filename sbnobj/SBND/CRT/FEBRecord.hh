@@ -0,0 +1,66 @@
+/**
+ * \brief Packed record of raw FEB data from the CRT, for bulk decoding
+ *
+ */
+
+#ifndef SBND_FEBRECORD_HH
+#define SBND_FEBRECORD_HH
+
+#include "sbnobj/SBND/CRT/FEBData.hh"
+
+#include <stdint.h>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace sbnd::crt {
+
+  /**
+   * Plain, non-virtual version of `FEBData`, with the same content.
+   *
+   * All the members are naturally aligned with no padding in between, so
+   * that records written one after the other (in the host byte order)
+   * can be copied in and out of a byte buffer as a block.
+   */
+  struct FEBRecord {
+
+    uint16_t mac5;   ///< ID of the FEB
+    uint16_t flags;  ///< Event flags describing the type of data recorded
+    uint32_t ts0;    ///< T0 counter [ns]
+    uint32_t ts1;    ///< T1 counter [ns]
+    uint32_t unixs;  ///< Event time since unix epoch [s]
+    adc_array_t adc; ///< 32 ADC values, one per SiPM
+    uint32_t coinc;  ///< ID of SiPM that fired the trigger
+
+  };
+
+  static_assert(sizeof(FEBRecord) == 2 * sizeof(uint16_t) + 4 * sizeof(uint32_t) + sizeof(adc_array_t),
+    "FEBRecord must have no padding");
+  static_assert(std::is_trivially_copyable_v<FEBRecord>
+    && std::is_standard_layout_v<FEBRecord>);
+
+  /**
+   * Decodes a buffer of consecutive `FEBRecord`s.
+   *
+   * @param data Pointer to the first byte of the buffer (no alignment required).
+   * @param size Size of the buffer in bytes, a multiple of `sizeof(FEBRecord)`.
+   *
+   * @return The records in the buffer.
+   */
+  std::vector<FEBRecord> DecodeFEBRecords(void const* data, std::size_t size);
+
+  /**
+   * Decodes a buffer of consecutive `FEBRecord`s, appending them to `records`.
+   *
+   * @return The number of records added.
+   */
+  std::size_t DecodeFEBRecords(void const* data, std::size_t size, std::vector<FEBRecord>& records);
+
+  /**
+   * Returns the records in `FEBData` form.
+   */
+  std::vector<FEBData> ToFEBData(std::vector<FEBRecord> const& records);
+
+} // namespace sbnd::crt
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef SBND_FEBTIMESTAMPCORRECTION_CXX
+#define SBND_FEBTIMESTAMPCORRECTION_CXX
+
+#include "cetlib_except/exception.h"
+
+#include "sbnobj/SBND/CRT/FEBTimestampCorrection.hh"
+
+#include <algorithm>
+
+namespace {
+
+  template <typename T>
+  uint32_t entry(std::vector<T> const& table, std::size_t i)
+  {
+    return (i < table.size()) ? static_cast<uint32_t>(table[i]) : 0U;
+  }
+
+  // One subtraction per timestamp, modulo 2^32; the tables are not aliased by
+  // the records, and no MAC5 is out of them.
+  void CorrectKernel(sbnd::crt::FEBRecord* __restrict__ records, std::size_t n,
+                     uint32_t const* __restrict__ ts0Offset, uint32_t const* __restrict__ ts1Offset)
+  {
+    for (std::size_t i = 0; i < n; ++i) {
+      uint16_t const mac5 = records[i].mac5;
+      records[i].ts0 -= ts0Offset[mac5];
+      records[i].ts1 -= ts1Offset[mac5];
+    }
+  }
+
+} // local namespace
+
+namespace sbnd{
+namespace crt{
+
+  FEBTimestampCorrector::FEBTimestampCorrector(FEBTimestampCorrections const& corrections)
+  {
+    std::size_t const n = std::max({ corrections.ts0Delay.size(), corrections.ts1Delay.size(),
+                                     corrections.ts0Reset.size(), corrections.ts1Reset.size() });
+    fTs0Offset.resize(n);
+    fTs1Offset.resize(n);
+    for (std::size_t mac5 = 0; mac5 < n; ++mac5) {
+      fTs0Offset[mac5] = entry(corrections.ts0Reset, mac5) + entry(corrections.ts0Delay, mac5);
+      fTs1Offset[mac5] = entry(corrections.ts1Reset, mac5) + entry(corrections.ts1Delay, mac5);
+    }
+  }
+
+  void FEBTimestampCorrector::Correct(FEBRecord* records, std::size_t n) const
+  {
+    uint16_t maxMac5 = 0;
+    for (std::size_t i = 0; i < n; ++i) maxMac5 = std::max(maxMac5, records[i].mac5);
+    if (n > 0 && maxMac5 >= NFEBs()) {
+      throw cet::exception("sbnd::crt::FEBTimestampCorrector")
+        << "no timestamp corrections for FEB with MAC5 " << maxMac5
+        << " (corrections for " << NFEBs() << " FEBs).\n";
+    }
+
+    CorrectKernel(records, n, fTs0Offset.data(), fTs1Offset.data());
+  }
+
+} // namespace crt
+} // namespace sbnd
+
+#endif
@@ -0,0 +1,78 @@
+/**
+ * \brief Batch correction of the timestamps of raw FEB data from the CRT
+ *
+ */
+
+#ifndef SBND_FEBTIMESTAMPCORRECTION_HH
+#define SBND_FEBTIMESTAMPCORRECTION_HH
+
+#include "sbnobj/SBND/CRT/FEBRecord.hh"
+
+#include <stdint.h>
+#include <cstddef>
+#include <vector>
+
+namespace sbnd::crt {
+
+  /**
+   * Timestamp corrections of each FEB, indexed by MAC5.
+   * Tables shorter than the others (or empty) count as zero beyond their end.
+   */
+  struct FEBTimestampCorrections {
+
+    std::vector<int32_t>  ts0Delay; ///< Cable delay of the T0 signal [ns]
+    std::vector<int32_t>  ts1Delay; ///< Cable delay of the T1 signal [ns]
+    std::vector<uint32_t> ts0Reset; ///< T0 counter value at the T0 reset [ns]
+    std::vector<uint32_t> ts1Reset; ///< T1 counter value at the T1 reset [ns]
+
+  };
+
+  /**
+   * Corrects the timestamps of FEB records in bulk.
+   *
+   * Each timestamp is reduced by the delay and the reset value of its FEB:
+   * `ts0 - ts0Reset[mac5] - ts0Delay[mac5]`, and the same for T1.
+   * The arithmetic is modulo 2^32, like the FEB counters, so that a counter
+   * which wrapped around after the reset still gives the right elapsed time.
+   *
+   * The two terms are combined into one offset per FEB and counter when the
+   * corrector is constructed (typically once per job or run). Correcting the
+   * records is then one subtraction per timestamp, in a loop with no branch
+   * for the compiler to vectorize; the MAC5 of all the records are checked
+   * beforehand.
+   *
+   *     sbnd::crt::FEBTimestampCorrector const corrector{ corrections };
+   *     corrector.Correct(records); // all the FEB records of the event
+   */
+  class FEBTimestampCorrector {
+
+  public:
+
+    FEBTimestampCorrector() = default;
+
+    FEBTimestampCorrector(FEBTimestampCorrections const& corrections);
+
+    /// Number of FEBs with corrections (MAC5 from 0 to NFEBs() - 1).
+    std::size_t NFEBs() const { return fTs0Offset.size(); }
+
+    /**
+     * Corrects in place the timestamps of `n` records starting at `records`.
+     *
+     * @throw cet::exception if any record has a MAC5 without corrections;
+     *        in that case no record is changed
+     */
+    void Correct(FEBRecord* records, std::size_t n) const;
+
+    void Correct(std::vector<FEBRecord>& records) const
+      { Correct(records.data(), records.size()); }
+
+  private:
+
+    std::vector<uint32_t> fTs0Offset; ///< Offset subtracted from T0, by MAC5
+    std::vector<uint32_t> fTs1Offset; ///< Offset subtracted from T1, by MAC5
+
+  };
+
+} // namespace sbnd::crt
+
+#endif
@@ -0,0 +1,81 @@
+#ifndef SBND_FEBTRUTHLINKS_CXX
+#define SBND_FEBTRUTHLINKS_CXX
+
+#include "cetlib_except/exception.h"
+
+#include "sbnobj/SBND/CRT/FEBTruthLinks.hh"
+
+namespace sbnd{
+namespace crt{
+
+  FEBTruthLinks::FEBTruthLinks()
+  : fOffsets{0}
+  , fIDEs()
+  , fChannels()
+  {}
+
+  void FEBTruthLinks::Reserve(size_t nFEBs, size_t nLinks)
+  {
+    fOffsets.reserve(nFEBs + 1);
+    fIDEs.reserve(nLinks);
+    fChannels.reserve(nLinks);
+  }
+
+  void FEBTruthLinks::AddFEB(std::vector<std::pair<uint32_t, uint8_t>> const& links)
+  {
+    for (auto const& [ide, channel] : links) AddLink(ide, channel);
+    CloseFEB();
+  }
+
+  void FEBTruthLinks::AddLink(uint32_t ide, uint8_t channel)
+  {
+    fIDEs.push_back(ide);
+    fChannels.push_back(channel);
+  }
+
+  void FEBTruthLinks::CloseFEB()
+  {
+    fOffsets.push_back(fIDEs.size());
+  }
+
+  size_t FEBTruthLinks::NFEBs() const
+  {
+    return fOffsets.size() - 1;
+  }
+
+  size_t FEBTruthLinks::NLinks() const
+  {
+    return fOffsets.back();
+  }
+
+  FEBTruthLinks::IDERange FEBTruthLinks::IDEs(size_t feb) const
+  {
+    if (feb >= NFEBs()) {
+      throw cet::exception("sbnd::crt::FEBTruthLinks") << "FEBData " << feb << " is out of limits.\n";
+    }
+
+    return { fIDEs.data() + fOffsets[feb], fIDEs.data() + fOffsets[feb + 1] };
+  }
+
+  std::pair<uint8_t const*, uint8_t const*> FEBTruthLinks::Channels(size_t feb) const
+  {
+    if (feb >= NFEBs()) {
+      throw cet::exception("sbnd::crt::FEBTruthLinks") << "FEBData " << feb << " is out of limits.\n";
+    }
+
+    return { fChannels.data() + fOffsets[feb], fChannels.data() + fOffsets[feb + 1] };
+  }
+
+  std::vector<uint32_t> FEBTruthLinks::FEBOfLinks() const
+  {
+    std::vector<uint32_t> febs;
+    febs.reserve(NLinks());
+    for (size_t feb = 0; feb < NFEBs(); ++feb)
+      febs.insert(febs.end(), fOffsets[feb + 1] - fOffsets[feb], feb);
+    return febs;
+  }
+
+} // namespace crt
+} // namespace sbnd
+
+#endif
@@ -0,0 +1,106 @@
+/**
+ * \brief Dataproduct to store the links between CRT FEBData and AuxDetIDEs
+ *
+ * \details Compact replacement of the art::Assns<FEBData, sim::AuxDetIDE, FEBTruthInfo>:
+ * for each FEBData of a collection, the indices of the AuxDetIDEs (in the
+ * sim::AuxDetIDE collection made together with it) that contributed to it,
+ * each with the SiPM the energy deposit was associated to.
+ * All the links are in a single vector, each FEBData owning a range of it.
+ */
+
+#ifndef SBND_FEBTRUTHLINKS_HH
+#define SBND_FEBTRUTHLINKS_HH
+
+#include <stdint.h>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace sbnd::crt {
+
+  class FEBTruthLinks {
+
+    std::vector<uint32_t> fOffsets; ///< First link of each FEBData, plus the end
+    std::vector<uint32_t> fIDEs; ///< AuxDetIDE index of each link
+    std::vector<uint8_t> fChannels; ///< SiPM channel (0-31) of each link
+
+   public:
+
+    /// Range of AuxDetIDE indices.
+    struct IDERange {
+      uint32_t const* first = nullptr;
+      uint32_t const* last = nullptr;
+
+      uint32_t const* begin() const { return first; }
+      uint32_t const* end() const { return last; }
+      std::size_t size() const { return last - first; }
+      bool empty() const { return first == last; }
+    };
+
+    /**
+     * Default constructor.
+     */
+    FEBTruthLinks();
+
+    /**
+     * Reserves memory.
+     *
+     * @param nFEBs The number of FEBData.
+     * @param nLinks The total number of links.
+     */
+    void Reserve(size_t nFEBs, size_t nLinks);
+
+    /**
+     * Adds the links of the next FEBData.
+     *
+     * @param links The (AuxDetIDE index, SiPM channel) of each link.
+     */
+    void AddFEB(std::vector<std::pair<uint32_t, uint8_t>> const& links);
+
+    /**
+     * Adds a link to the FEBData being filled (`NFEBs()`), which is
+     * completed by `CloseFEB()`.
+     *
+     * @param ide The index of the AuxDetIDE.
+     * @param channel The SiPM channel of the energy deposit.
+     */
+    void AddLink(uint32_t ide, uint8_t channel);
+
+    /**
+     * Completes the FEBData being filled, and starts the next one.
+     */
+    void CloseFEB();
+
+    /**
+     * Returns the number of completed FEBData.
+     */
+    size_t NFEBs() const;
+
+    /**
+     * Returns the total number of links.
+     */
+    size_t NLinks() const;
+
+    /**
+     * Returns the AuxDetIDE indices of a FEBData.
+     *
+     * @param feb The index of the FEBData.
+     *
+     * @return The range of the indices of its AuxDetIDEs.
+     */
+    IDERange IDEs(size_t feb) const;
+
+    /**
+     * Returns the SiPM channels of a FEBData, one per entry of `IDEs(feb)`.
+     */
+    std::pair<uint8_t const*, uint8_t const*> Channels(size_t feb) const;
+
+    /**
+     * Returns the FEBData of each link, for the AuxDetIDE to FEBData query.
+     */
+    std::vector<uint32_t> FEBOfLinks() const;
+  };
+
+} // namespace sbnd::crt
+
+#endif
@@ -0,0 +1,43 @@
+#ifndef SBND_PACKEDCRTDATA_CXX
+#define SBND_PACKEDCRTDATA_CXX
+
+#include "cetlib_except/exception.h"
+
+#include "sbnobj/SBND/CRT/PackedCRTData.hh"
+
+namespace sbnd{
+namespace crt{
+
+  PackedCRTData::PackedCRTData(uint32_t channel, uint32_t t0,
+    uint32_t t1, uint32_t adc):
+    fChannelADC(PackChannelADC(channel, adc)),
+    fT0(t0),
+    fT1(t1){
+    if (channel > MaxChannel || adc > MaxADC) {
+      throw cet::exception("sbnd::crt::PackedCRTData")
+        << "channel " << channel << " (max " << MaxChannel << ") with ADC "
+        << adc << " (max " << MaxADC << ") can't be packed.\n";
+    }
+  }
+
+  PackedCRTData::PackedCRTData(CRTData const& data):
+    PackedCRTData(data.Channel(), data.T0(), data.T1(), data.ADC()){
+  }
+
+  std::vector<PackedCRTData> PackCRTData(std::vector<CRTData> const& data)
+  {
+    return { data.begin(), data.end() };
+  }
+
+  std::vector<CRTData> UnpackCRTData(std::vector<PackedCRTData> const& data)
+  {
+    std::vector<CRTData> unpacked;
+    unpacked.reserve(data.size());
+    for (PackedCRTData const& d : data) unpacked.push_back(d.ToCRTData());
+    return unpacked;
+  }
+
+} // namespace crt
+} // namespace sbnd
+
+#endif
@@ -0,0 +1,81 @@
+/**
+ * \brief Compact version of CRTData, for storage of large MC samples
+ *
+ */
+
+#ifndef SBND_PACKEDCRTDATA_HH
+#define SBND_PACKEDCRTDATA_HH
+
+#include "sbnobj/SBND/CRT/CRTData.hh"
+
+#include <stdint.h>
+#include <type_traits>
+#include <vector>
+
+namespace sbnd::crt {
+
+  /**
+   * `CRTData` in 12 bytes instead of 16.
+   *
+   * The ADC count (12 bits) and the channel number (20 bits) share the same
+   * word; the two time stamps are stored unchanged.
+   * Conversion from `CRTData` throws `cet::exception` if the channel or the
+   * ADC count do not fit.
+   *
+   * A `std::vector<CRTData>` data product stays of that type when read
+   * back, so it needs to be converted explicitly, e.g. in a producer:
+   *
+   *     auto const& data = event.getProduct<std::vector<sbnd::crt::CRTData>>(fDataTag);
+   *     event.put(std::make_unique<std::vector<sbnd::crt::PackedCRTData>>
+   *       (sbnd::crt::PackCRTData(data)));
+   *
+   */
+  class PackedCRTData {
+
+    uint32_t fChannelADC; ///< Channel (upper 20 bits) and ADC (lower 12 bits)
+    uint32_t fT0;
+    uint32_t fT1;
+
+   public:
+
+    static constexpr unsigned int ADCBits = 12;
+    static constexpr uint32_t MaxADC = (1U << ADCBits) - 1;
+    static constexpr uint32_t MaxChannel = (~uint32_t{0}) >> ADCBits;
+
+    PackedCRTData(): fChannelADC(0), fT0(0), fT1(0) {}
+    PackedCRTData(uint32_t channel, uint32_t t0, uint32_t t1, uint32_t adc);
+    PackedCRTData(CRTData const& data);
+
+    uint32_t Channel() const { return fChannelADC >> ADCBits; }
+    uint32_t T0() const { return fT0; }
+    uint32_t T1() const { return fT1; }
+    uint32_t ADC() const { return fChannelADC & MaxADC; }
+
+    CRTData ToCRTData() const { return { Channel(), T0(), T1(), ADC() }; }
+
+   private:
+
+    /// Packs channel and ADC count in the same word, without checks.
+    static constexpr uint32_t PackChannelADC(uint32_t channel, uint32_t adc)
+      { return (channel << ADCBits) | (adc & MaxADC); }
+
+  };
+
+  static_assert(sizeof(PackedCRTData) == 3 * sizeof(uint32_t));
+  static_assert(std::is_trivially_copyable_v<PackedCRTData>);
+
+  /**
+   * Returns the data in `PackedCRTData` form.
+   *
+   * @throw cet::exception if any channel or ADC count does not fit
+   */
+  std::vector<PackedCRTData> PackCRTData(std::vector<CRTData> const& data);
+
+  /**
+   * Returns the data in `CRTData` form.
+   */
+  std::vector<CRTData> UnpackCRTData(std::vector<PackedCRTData> const& data);
+
+} // namespace sbnd::crt
+
+#endif
@@ -1,8 +1,11 @@
 #include "canvas/Persistency/Common/Wrapper.h"
 #include "canvas/Persistency/Common/Assns.h"
 #include "sbnobj/SBND/CRT/FEBData.hh"
+#include "sbnobj/SBND/CRT/FEBRecord.hh"
 #include "sbnobj/SBND/CRT/CRTData.hh"
+#include "sbnobj/SBND/CRT/PackedCRTData.hh"
 #include "sbnobj/SBND/CRT/FEBTruthInfo.hh"
+#include "sbnobj/SBND/CRT/FEBTruthLinks.hh"
 #include "sbnobj/SBND/CRT/CRTStripHit.hh"
 #include "sbnobj/SBND/CRT/CRTCluster.hh"
 #include "sbnobj/SBND/CRT/CRTSpacePoint.hh"
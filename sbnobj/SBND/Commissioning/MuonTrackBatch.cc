@@ -0,0 +1,125 @@
+#include "sbnobj/SBND/Commissioning/MuonTrackBatch.hh"
+
+#include "cetlib_except/exception.h"
+
+#include <algorithm>
+#include <cmath>
+
+sbnd::comm::MuonTrackBatch::MuonTrackBatch(std::vector<MuonTrack> const& tracks) {
+  std::size_t const n = tracks.size();
+  x1.reserve(n); y1.reserve(n); z1.reserve(n);
+  x2.reserve(n); y2.reserve(n); z2.reserve(n);
+  t0_us.reserve(n);
+  tpc.reserve(n);
+  for (MuonTrack const& track: tracks) {
+    x1.push_back(track.x1_pos); y1.push_back(track.y1_pos); z1.push_back(track.z1_pos);
+    x2.push_back(track.x2_pos); y2.push_back(track.y2_pos); z2.push_back(track.z2_pos);
+    t0_us.push_back(track.t0_us);
+    tpc.push_back(track.tpc);
+  }
+}
+
+void sbnd::comm::MuonTrackBatch::Lengths(std::vector<float>& length) const {
+  std::size_t const n = size();
+  length.resize(n);
+  float const* __restrict__ px1 = x1.data(); float const* __restrict__ px2 = x2.data();
+  float const* __restrict__ py1 = y1.data(); float const* __restrict__ py2 = y2.data();
+  float const* __restrict__ pz1 = z1.data(); float const* __restrict__ pz2 = z2.data();
+  float* __restrict__ len = length.data();
+
+  for (std::size_t i = 0; i < n; ++i) {
+    float const dx = px2[i] - px1[i], dy = py2[i] - py1[i], dz = pz2[i] - pz1[i];
+    len[i] = dx * dx + dy * dy + dz * dz; // squared for now
+  }
+
+  // lengths from the squared ones
+  for (std::size_t i = 0; i < n; ++i) len[i] = std::sqrt(len[i]);
+}
+
+void sbnd::comm::MuonTrackBatch::DirectionCosines(std::vector<float>& cosX, std::vector<float>& cosY,
+                                                  std::vector<float>& cosZ) const {
+  std::size_t const n = size();
+  std::vector<float> length;
+  Lengths(length);
+  cosX.resize(n); cosY.resize(n); cosZ.resize(n);
+  float const* __restrict__ px1 = x1.data(); float const* __restrict__ px2 = x2.data();
+  float const* __restrict__ py1 = y1.data(); float const* __restrict__ py2 = y2.data();
+  float const* __restrict__ pz1 = z1.data(); float const* __restrict__ pz2 = z2.data();
+  float const* __restrict__ len = length.data();
+  float* __restrict__ cx = cosX.data();
+  float* __restrict__ cy = cosY.data();
+  float* __restrict__ cz = cosZ.data();
+
+  for (std::size_t i = 0; i < n; ++i) {
+    // a null track gets 0 cosines without a branch, which would prevent vectorization
+    float const isNull = (len[i] > 0.f)? 0.f: 1.f;
+    float const invLen = (1.f - isNull) / (len[i] + isNull);
+    cx[i] = (px2[i] - px1[i]) * invLen;
+    cy[i] = (py2[i] - py1[i]) * invLen;
+    cz[i] = (pz2[i] - pz1[i]) * invLen;
+  }
+}
+
+void sbnd::comm::MuonTrackBatch::DriftProjections(std::vector<float>& driftExtent,
+                                                  std::vector<float>& cathodeDistance,
+                                                  float cathodeX) const {
+  std::size_t const n = size();
+  driftExtent.resize(n);
+  cathodeDistance.resize(n);
+  float const* __restrict__ px1 = x1.data();
+  float const* __restrict__ px2 = x2.data();
+  float* __restrict__ extent = driftExtent.data();
+  float* __restrict__ distance = cathodeDistance.data();
+
+  for (std::size_t i = 0; i < n; ++i) {
+    extent[i] = std::abs(px2[i] - px1[i]);
+    distance[i] = std::abs(0.5f * (px1[i] + px2[i]) - cathodeX);
+  }
+}
+
+std::vector<std::vector<uint32_t>> sbnd::comm::MuonTrackBatch::SplitByTPC() const {
+  std::vector<std::size_t> counts;
+  for (uint8_t const t: tpc) {
+    if (counts.size() <= t) counts.resize(t + 1, 0);
+    ++counts[t];
+  }
+
+  std::vector<std::vector<uint32_t>> split(counts.size());
+  for (std::size_t t = 0; t < counts.size(); ++t) split[t].reserve(counts[t]);
+  for (std::size_t i = 0; i < tpc.size(); ++i) split[tpc[i]].push_back(i);
+  return split;
+}
+
+sbnd::comm::MuonTrackHistogram::MuonTrackHistogram(std::size_t nBins, float min, float max)
+  : fMin(min)
+  , fMax(max)
+  , fInvBinWidth(nBins / (max - min))
+  , fBins(nBins, 0.)
+{
+  if (nBins == 0 || !(max > min)) {
+    throw cet::exception("sbnd::comm::MuonTrackHistogram")
+      << "Invalid binning: " << nBins << " bins in [ " << min << " ; " << max << " ].\n";
+  }
+}
+
+void sbnd::comm::MuonTrackHistogram::Fill(float const* values, float const* weights,
+                                          std::size_t first, std::size_t last) {
+  std::size_t const nBins = fBins.size();
+  for (std::size_t i = first; i < last; ++i) {
+    double const w = weights? weights[i]: 1.;
+    float const v = values[i];
+    if (v < fMin) fUnderflow += w;
+    else if (!(v < fMax)) fOverflow += w; // NaN also goes here
+    else fBins[std::min(static_cast<std::size_t>((v - fMin) * fInvBinWidth), nBins - 1)] += w;
+  }
+}
+
+void sbnd::comm::MuonTrackHistogram::Join(MuonTrackHistogram const& other) {
+  if (other.fBins.size() != fBins.size() || other.fMin != fMin || other.fMax != fMax) {
+    throw cet::exception("sbnd::comm::MuonTrackHistogram")
+      << "Can't join histograms with different binning.\n";
+  }
+  for (std::size_t b = 0; b < fBins.size(); ++b) fBins[b] += other.fBins[b];
+  fUnderflow += other.fUnderflow;
+  fOverflow += other.fOverflow;
+}
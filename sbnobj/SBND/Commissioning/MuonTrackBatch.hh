@@ -0,0 +1,96 @@
+#ifndef MuonTrackBatch_hh_
+#define MuonTrackBatch_hh_
+#include <cstdint>
+
+#include <cstddef>
+#include <vector>
+
+#include "sbnobj/SBND/Commissioning/MuonTrack.hh"
+
+namespace sbnd::comm {
+
+  // Structure of arrays copy of a collection of MuonTrack, with the derived
+  // quantities computed in vectorizable loops over all the tracks.
+  struct MuonTrackBatch{
+
+    std::vector<float> x1, y1, z1; // first end point [cm]
+    std::vector<float> x2, y2, z2; // second end point [cm]
+    std::vector<int32_t> t0_us;
+    std::vector<uint8_t> tpc;
+
+    MuonTrackBatch() {}
+    explicit MuonTrackBatch(std::vector<MuonTrack> const& tracks);
+
+    std::size_t size() const { return x1.size(); }
+
+    // length of each track [cm]
+    void Lengths(std::vector<float>& length) const;
+
+    // direction cosines from the first to the second end point
+    // (0 for a track of null length)
+    void DirectionCosines(std::vector<float>& cosX, std::vector<float>& cosY,
+                          std::vector<float>& cosZ) const;
+
+    // extent of each track along the drift coordinate, |x2 - x1| [cm],
+    // and distance of its middle from the cathode plane at x = cathodeX [cm]
+    void DriftProjections(std::vector<float>& driftExtent, std::vector<float>& cathodeDistance,
+                          float cathodeX = 0.f) const;
+
+    // track indices of each TPC, in their original order:
+    // element t lists the tracks with tpc == t
+    std::vector<std::vector<uint32_t>> SplitByTPC() const;
+
+  };
+
+  // Histogram with fixed binning which can be filled in parallel: each worker
+  // fills its own copy (made with the splitting constructor) and the copies
+  // are then added with Join(). This is the body interface of
+  // tbb::parallel_reduce(), with the split tag of any type.
+  class MuonTrackHistogram{
+
+  public:
+
+    MuonTrackHistogram(std::size_t nBins, float min, float max);
+
+    template <typename Split>
+    MuonTrackHistogram(MuonTrackHistogram& other, Split)
+      : MuonTrackHistogram(other.NBins(), other.fMin, other.fMax)
+      { SetInput(other.fValues, other.fWeights); }
+
+    // fills with values[i] for i in [ first, last [, with weights if not null;
+    // values out of range go to underflow and overflow counts
+    void Fill(float const* values, float const* weights, std::size_t first, std::size_t last);
+
+    // tbb::parallel_reduce() body call, on a range with begin() and end() indices
+    template <typename Range>
+    void operator() (Range const& range)
+      { Fill(fValues, fWeights, range.begin(), range.end()); }
+
+    void Join(MuonTrackHistogram const& other);
+    void join(MuonTrackHistogram const& other) { Join(other); }
+
+    // values and weights used by the body call
+    void SetInput(float const* values, float const* weights) { fValues = values; fWeights = weights; }
+
+    std::size_t NBins() const { return fBins.size(); }
+    std::vector<double> const& Bins() const { return fBins; }
+    double Underflow() const { return fUnderflow; }
+    double Overflow() const { return fOverflow; }
+
+  private:
+
+    float fMin;
+    float fMax;
+    float fInvBinWidth;
+    std::vector<double> fBins;
+    double fUnderflow = 0.;
+    double fOverflow = 0.;
+
+    float const* fValues = nullptr;
+    float const* fWeights = nullptr;
+
+  };
+
+} // namespace sbnd::comm
+
+#endif
@@ -3,33 +3,33 @@
 
 #include "sbnobj/SBND/Timing/DAQTimestamp.hh"
 
+#include <algorithm>
+
 namespace sbnd::timing {
 
   DAQTimestamp::DAQTimestamp()
     : fChannel(std::numeric_limits<uint32_t>::max())
     , fTimestamp(0)
     , fOffset(0)
-    , fName("")
+    , fName{}
+    , fNameID(DAQTimestampNames::ID(""))
   {}
 
   DAQTimestamp::DAQTimestamp(uint32_t channel, uint64_t timestamp, uint64_t offset, std::string name)
     : fChannel(channel)
     , fTimestamp(timestamp)
     , fOffset(offset)
-    , fName(name)
+    , fName(PackName(name))
+    , fNameID(DAQTimestampNames::ID(UnpackName(fName)))
   {}
 
   DAQTimestamp::DAQTimestamp(uint32_t channel, uint64_t timestamp, uint64_t offset, std::array<char, 8> name)
     : fChannel(channel)
     , fTimestamp(timestamp)
     , fOffset(offset)
-    , fName("")
-  {
-    for(auto const& c : name)
-      fName.push_back(c);
-  }
-
-  DAQTimestamp::~DAQTimestamp() {}
+    , fName(name)
+    , fNameID(DAQTimestampNames::ID(UnpackName(fName)))
+  {}
 
   uint32_t DAQTimestamp::Channel() const
   {
@@ -46,9 +46,24 @@ namespace sbnd::timing {
     return fOffset;
   }
 
-  std::string DAQTimestamp::Name() const
+  sbn::TimeNs_t DAQTimestamp::Time() const
+  {
+    return sbn::TimeNs_t{ static_cast<sbn::TimeNs_t::rep>(fTimestamp) };
+  }
+
+  sbn::TimeNs_t DAQTimestamp::OffsetTime() const
+  {
+    return sbn::TimeNs_t{ static_cast<sbn::TimeNs_t::rep>(fOffset) };
+  }
+
+  std::string const& DAQTimestamp::Name() const
+  {
+    return DAQTimestampNames::Name(fNameID);
+  }
+
+  uint8_t DAQTimestamp::NameID() const
   {
-    return fName;
+    return fNameID;
   }
 
   void DAQTimestamp::SetChannel(uint32_t channel)
@@ -67,8 +82,34 @@ namespace sbnd::timing {
   }
 
   void DAQTimestamp::SetName(std::string name)
+  {
+    SetName(PackName(name));
+  }
+
+  void DAQTimestamp::SetName(std::array<char, 8> name)
   {
     fName = name;
+    UpdateNameID();
+  }
+
+  DAQTimestamp::Name_t DAQTimestamp::PackName(std::string const& name)
+  {
+    Name_t packed{};
+    for(std::size_t i = 0; i < std::min(name.size(), packed.size()); ++i)
+      packed[i] = name[i];
+    return packed;
+  }
+
+  std::string DAQTimestamp::UnpackName(Name_t const& name)
+  {
+    std::size_t n = name.size();
+    while(n > 0 && name[n - 1] == '\0') --n;
+    return std::string(name.data(), n);
+  }
+
+  void DAQTimestamp::UpdateNameID()
+  {
+    fNameID = DAQTimestampNames::ID(UnpackName(fName));
   }
 }
 
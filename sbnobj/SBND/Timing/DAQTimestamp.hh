@@ -13,17 +13,28 @@
 #include <array>
 #include <limits> // for std::numeric_limits
 
+#include "sbnobj/SBND/Timing/DAQTimestampNames.hh"
+#include "sbnobj/Common/Utilities/TimeNs.h"
+
 namespace sbnd::timing {
 
+  /**
+   * The name of the channel input is stored as its fixed 8-character form
+   * (shorter names are padded with NUL, longer ones truncated), and is
+   * interned into a DAQTimestampNames ID when the timestamp is created or read.
+   */
   class DAQTimestamp {
 
     uint32_t fChannel;   ///< Hardware channel
     uint64_t fTimestamp; ///< Timestamp of signal [ns]
     uint64_t fOffset;    ///< Channel specific offset [ns]
-    std::string fName;   ///< Name of channel input
+    std::array<char, 8> fName; ///< Name of channel input
+    uint8_t  fNameID;    ///< DAQTimestampNames ID of the name (not stored)
 
    public:
 
+    using Name_t = std::array<char, 8>;
+
     /**
      * Default constructor.
      */
@@ -49,18 +60,20 @@ namespace sbnd::timing {
      */
     DAQTimestamp(uint32_t channel, uint64_t timestamp, uint64_t offset, std::array<char, 8> name);
 
-    /**
-     * Destructor
-     */
-    virtual ~DAQTimestamp();
-
     /**
      * Getters
      */
     uint32_t    Channel() const;
     uint64_t    Timestamp() const;
     uint64_t    Offset() const;
-    std::string Name() const;
+    std::string const& Name() const;
+    uint8_t     NameID() const;
+
+    /**
+     * Timestamp and offset as sbn::TimeNs_t
+     */
+    sbn::TimeNs_t Time() const;
+    sbn::TimeNs_t OffsetTime() const;
  
     /**
      * Setters
@@ -69,6 +82,19 @@ namespace sbnd::timing {
     void SetTimestamp(uint64_t timestamp);
     void SetOffset(uint64_t offset);
     void SetName(std::string name);
+    void SetName(std::array<char, 8> name);
+
+    /**
+     * Fixed size form of a name, and name of a fixed size form
+     * (without the trailing NUL padding)
+     */
+    static Name_t PackName(std::string const& name);
+    static std::string UnpackName(Name_t const& name);
+
+    /**
+     * Registers the name again; for use after reading from file
+     */
+    void UpdateNameID();
   };
 }
 
@@ -0,0 +1,124 @@
+#ifndef SBND_DAQTIMESTAMPINDEX_CXX
+#define SBND_DAQTIMESTAMPINDEX_CXX
+
+#include "sbnobj/SBND/Timing/DAQTimestampIndex.hh"
+
+#include <algorithm>
+#include <tuple>
+
+namespace sbnd::timing {
+
+  namespace {
+
+    uint64_t Distance(const uint64_t a, const uint64_t b) { return (a > b) ? a - b : b - a; }
+
+  }
+
+  DAQTimestampIndex::DAQTimestampIndex()
+    : fEntries ()
+    , fGroups ()
+  {}
+
+  DAQTimestampIndex::DAQTimestampIndex(const std::vector<DAQTimestamp> &timestamps)
+    : fEntries ()
+    , fGroups ()
+  {
+    fEntries.reserve(timestamps.size());
+    for(std::size_t i = 0; i < timestamps.size(); ++i)
+      {
+        DAQTimestamp const& ts = timestamps[i];
+        fEntries.push_back({ts.Timestamp(), ts.Channel(), ts.NameID(), static_cast<uint32_t>(i)});
+      }
+
+    std::stable_sort(fEntries.begin(), fEntries.end(),
+                     [](Entry const& a, Entry const& b)
+                     {
+                       return std::tie(a.channel, a.nameID, a.timestamp)
+                         < std::tie(b.channel, b.nameID, b.timestamp);
+                     });
+
+    for(std::size_t first = 0; first < fEntries.size();)
+      {
+        std::size_t last = first + 1;
+        while(last < fEntries.size() && fEntries[last].channel == fEntries[first].channel
+              && fEntries[last].nameID == fEntries[first].nameID)
+          ++last;
+
+        uint8_t const nameID = fEntries[first].nameID;
+        if(fGroups.size() <= nameID) fGroups.resize(nameID + 1);
+        fGroups[nameID].emplace_back(first, last);
+        first = last;
+      }
+  }
+
+  std::size_t DAQTimestampIndex::NTimestamps() const
+  {
+    return fEntries.size();
+  }
+
+  DAQTimestampIndex::Range DAQTimestampIndex::ToRange(std::pair<uint32_t, uint32_t> const& group) const
+  {
+    return { fEntries.data() + group.first, fEntries.data() + group.second };
+  }
+
+  DAQTimestampIndex::Range DAQTimestampIndex::All() const
+  {
+    return { fEntries.data(), fEntries.data() + fEntries.size() };
+  }
+
+  DAQTimestampIndex::Range DAQTimestampIndex::Group(const uint32_t channel, const uint8_t nameID) const
+  {
+    if(nameID >= fGroups.size()) return {};
+
+    for(auto const& group : fGroups[nameID])
+      if(fEntries[group.first].channel == channel) return ToRange(group);
+
+    return {};
+  }
+
+  std::vector<DAQTimestampIndex::Range> DAQTimestampIndex::Groups(const uint8_t nameID) const
+  {
+    std::vector<Range> ranges;
+    if(nameID >= fGroups.size()) return ranges;
+
+    ranges.reserve(fGroups[nameID].size());
+    for(auto const& group : fGroups[nameID])
+      ranges.push_back(ToRange(group));
+
+    return ranges;
+  }
+
+  DAQTimestampIndex::Entry const* DAQTimestampIndex::Closest(const uint8_t nameID, const uint64_t time) const
+  {
+    if(nameID >= fGroups.size()) return nullptr;
+
+    Entry const* best = nullptr;
+    for(auto const& group : fGroups[nameID])
+      {
+        Range const range = ToRange(group);
+        Entry const* after = std::lower_bound(range.begin(), range.end(), time,
+                                              [](Entry const& e, uint64_t t){ return e.timestamp < t; });
+
+        // the earlier candidate comes first, to win ties
+        for(Entry const* candidate : { (after != range.begin()) ? after - 1 : nullptr,
+                                       (after != range.end()) ? after : nullptr })
+          {
+            if(!candidate) continue;
+            if(!best || Distance(candidate->timestamp, time) < Distance(best->timestamp, time)
+               || (Distance(candidate->timestamp, time) == Distance(best->timestamp, time)
+                   && candidate->timestamp < best->timestamp))
+              best = candidate;
+          }
+      }
+
+    return best;
+  }
+
+  DAQTimestampIndex::Entry const* DAQTimestampIndex::Closest(const std::string &name, const uint64_t time) const
+  {
+    uint8_t const nameID = DAQTimestampNames::FindID(name);
+    return (nameID == DAQTimestampNames::InvalidID) ? nullptr : Closest(nameID, time);
+  }
+}
+
+#endif
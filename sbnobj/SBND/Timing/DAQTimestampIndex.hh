@@ -0,0 +1,84 @@
+/**
+ * \class DAQTimestampIndex
+ *
+ * \brief Index of the DAQTimestamps of an event, sorted by channel and time
+ *
+ */
+
+#ifndef SBND_DAQTIMESTAMPINDEX_HH
+#define SBND_DAQTIMESTAMPINDEX_HH
+
+#include "sbnobj/SBND/Timing/DAQTimestamp.hh"
+
+#include <stdint.h>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace sbnd::timing {
+
+  /**
+   * Refers to timestamps by their position in the collection the index is
+   * built from, which must be kept unchanged while the index is used.
+   * Entries are sorted by channel, then name, then timestamp; the entries
+   * sharing channel and name form a group in ascending time, and the groups
+   * of each name ID are listed, so that timestamps are looked up by name with
+   * binary searches and no string comparison:
+   *
+   *     DAQTimestampIndex const index(timestamps);
+   *     DAQTimestampIndex::Entry const* etrig = index.Closest("etrig", time);
+   *     if(etrig) ... timestamps[etrig->index] ...
+   */
+  class DAQTimestampIndex {
+
+  public:
+
+    struct Entry {
+      uint64_t timestamp; // Timestamp() of the timestamp [ns]
+      uint32_t channel;   // Channel() of the timestamp
+      uint8_t  nameID;    // NameID() of the timestamp
+      uint32_t index;     // position of the timestamp in the indexed collection
+    };
+
+    // Range of entries, in ascending time.
+    struct Range {
+      Entry const* first = nullptr;
+      Entry const* last = nullptr;
+
+      Entry const* begin() const { return first; }
+      Entry const* end() const { return last; }
+      std::size_t size() const { return last - first; }
+      bool empty() const { return first == last; }
+    };
+
+    DAQTimestampIndex();
+
+    DAQTimestampIndex(const std::vector<DAQTimestamp> &timestamps);
+
+    std::size_t NTimestamps() const;
+
+    // All the entries, sorted by channel, name and time.
+    Range All() const;
+
+    // Timestamps of the channel with the name, in ascending time.
+    Range Group(const uint32_t channel, const uint8_t nameID) const;
+
+    // Groups with the name, in ascending channel.
+    std::vector<Range> Groups(const uint8_t nameID) const;
+
+    // Timestamp with the name closest to time [ns] (the earliest one of a tie,
+    // then the lowest channel); nullptr if there is none.
+    Entry const* Closest(const uint8_t nameID, const uint64_t time) const;
+    Entry const* Closest(const std::string &name, const uint64_t time) const;
+
+  private:
+
+    std::vector<Entry> fEntries; // sorted entries
+    std::vector<std::vector<std::pair<uint32_t, uint32_t>>> fGroups; // [first, last[ of each group, by name ID
+
+    Range ToRange(std::pair<uint32_t, uint32_t> const& group) const;
+  };
+
+}
+
+#endif
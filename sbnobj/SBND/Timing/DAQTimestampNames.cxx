@@ -0,0 +1,63 @@
+#ifndef SBND_DAQTIMESTAMPNAMES_CXX
+#define SBND_DAQTIMESTAMPNAMES_CXX
+
+#include "cetlib_except/exception.h"
+
+#include "sbnobj/SBND/Timing/DAQTimestampNames.hh"
+
+namespace sbnd::timing {
+
+  DAQTimestampNames& DAQTimestampNames::Instance()
+  {
+    static DAQTimestampNames names;
+    return names;
+  }
+
+  uint8_t DAQTimestampNames::Find(std::string const& name) const
+  {
+    std::size_t const n = fNNames.load(std::memory_order_acquire);
+    for(std::size_t id = 0; id < n; ++id)
+      if(fNames[id] == name) return id;
+    return InvalidID;
+  }
+
+  uint8_t DAQTimestampNames::ID(std::string const& name)
+  {
+    DAQTimestampNames& names = Instance();
+
+    uint8_t id = names.Find(name);
+    if(id != InvalidID) return id;
+
+    std::lock_guard<std::mutex> lock(names.fMutex);
+    id = names.Find(name); // may have been added in the meanwhile
+    if(id != InvalidID) return id;
+
+    std::size_t const n = names.fNNames.load(std::memory_order_relaxed);
+    if(n == MaxNames)
+      throw cet::exception("sbnd::timing::DAQTimestampNames")
+        << "No room for name '" << name << "': " << MaxNames << " names already registered.\n";
+
+    names.fNames[n] = name;
+    names.fNNames.store(n + 1, std::memory_order_release);
+    return n;
+  }
+
+  uint8_t DAQTimestampNames::FindID(std::string const& name)
+  {
+    return Instance().Find(name);
+  }
+
+  std::string const& DAQTimestampNames::Name(uint8_t id)
+  {
+    static std::string const unknown;
+    DAQTimestampNames const& names = Instance();
+    return (id < names.fNNames.load(std::memory_order_acquire)) ? names.fNames[id] : unknown;
+  }
+
+  std::size_t DAQTimestampNames::NNames()
+  {
+    return Instance().fNNames.load(std::memory_order_acquire);
+  }
+}
+
+#endif
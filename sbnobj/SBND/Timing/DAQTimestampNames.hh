@@ -0,0 +1,56 @@
+/**
+ * \brief Process-wide registry of DAQ timestamp channel names
+ *
+ */
+
+#ifndef SBND_DAQTIMESTAMPNAMES_HH
+#define SBND_DAQTIMESTAMPNAMES_HH
+
+#include <stdint.h>
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <string>
+
+namespace sbnd::timing {
+
+  /**
+   * Interns channel names into small integer IDs, so that timestamps can be
+   * selected by name without string comparisons.
+   *
+   * IDs are assigned in order of first registration and are only valid within
+   * the process: they are not stored in data files. Registration is thread
+   * safe, and the names of registered IDs can be read concurrently with it.
+   */
+  class DAQTimestampNames {
+
+  public:
+
+    static constexpr std::size_t MaxNames = 255;
+    static constexpr uint8_t InvalidID = 255;
+
+    // ID of the name, registering it if needed; throws when the registry is full
+    static uint8_t ID(std::string const& name);
+
+    // ID of the name if already registered, InvalidID otherwise
+    static uint8_t FindID(std::string const& name);
+
+    // Name of a registered ID (empty string for an unknown ID)
+    static std::string const& Name(uint8_t id);
+
+    static std::size_t NNames();
+
+  private:
+
+    std::array<std::string, MaxNames> fNames;
+    std::atomic<std::size_t> fNNames{ 0 };
+    std::mutex fMutex;
+
+    static DAQTimestampNames& Instance();
+
+    uint8_t Find(std::string const& name) const;
+  };
+
+}
+
+#endif
@@ -1,6 +1,8 @@
 #ifndef ToF_hh_
 #define ToF_hh_
 
+#include "sbnobj/Common/Utilities/TimeNs.h"
+
 #include <cstdint>
 #include <string>
 
@@ -20,6 +22,13 @@ struct ToF {
       int pmt_hit_id = -9999;
       int pmt_flash_id = -9999;
       int flash_tpc_id = -9999;
+
+      // Times as sbn::TimeNs_t, invalid if not set (-9999) [ns]
+      sbn::TimeNs_t tofNs() const { return timeNs(tof); }
+      sbn::TimeNs_t crtTimeNs() const { return timeNs(crt_time); }
+      sbn::TimeNs_t pmtTimeNs() const { return timeNs(pmt_time); }
+
+      static sbn::TimeNs_t timeNs(float t) { return (t == -9999)? sbn::TimeNs_t::none(): sbn::TimeNs_t::fromNanoseconds(t); }
 };
 
 }
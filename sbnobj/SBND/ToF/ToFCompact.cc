@@ -0,0 +1,53 @@
+#include "sbnobj/SBND/ToF/ToFCompact.hh"
+
+#include <array>
+
+namespace {
+
+  // in the order of sbnd::crt::CRTTagger
+  std::array<char const*, 7> const TaggerNames
+    { "Bottom", "South", "North", "West", "East", "TopLow", "TopHigh" };
+
+}
+
+std::string sbnd::ToF::TaggerName(sbnd::crt::CRTTagger tagger) {
+  if (tagger < 0 || static_cast<std::size_t>(tagger) >= TaggerNames.size()) return "N/A";
+  return TaggerNames[tagger];
+}
+
+sbnd::crt::CRTTagger sbnd::ToF::TaggerFromName(std::string const& name) {
+  for (std::size_t i = 0; i < TaggerNames.size(); ++i)
+    if (name == TaggerNames[i]) return static_cast<sbnd::crt::CRTTagger>(i);
+  return sbnd::crt::kUndefinedTagger;
+}
+
+sbnd::ToF::ToFCompact::ToFCompact(ToF const& tof)
+  : tof(tof.tof)
+  , crt_time(tof.crt_time)
+  , pmt_time(tof.pmt_time)
+  , crt_sp_id(tof.crt_sp_id)
+  , crt_trk_id(tof.crt_trk_id)
+  , pmt_hit_id(tof.pmt_hit_id)
+  , pmt_flash_id(tof.pmt_flash_id)
+  , flash_tpc_id(tof.flash_tpc_id)
+  , crt_tagger(TaggerFromName(tof.crt_tagger))
+  , crt_taggers(sbnd::crt::TaggerBit(TaggerFromName(tof.crt_tagger)))
+  , frm_trk(tof.frm_trk)
+  , frm_hit(tof.frm_hit)
+{}
+
+sbnd::ToF::ToF sbnd::ToF::ToFCompact::toToF() const {
+  ToF out;
+  out.tof = tof;
+  out.frm_trk = frm_trk;
+  out.frm_hit = frm_hit;
+  out.crt_time = crt_time;
+  out.pmt_time = pmt_time;
+  out.crt_tagger = TaggerName(Tagger());
+  out.crt_sp_id = crt_sp_id;
+  out.crt_trk_id = crt_trk_id;
+  out.pmt_hit_id = pmt_hit_id;
+  out.pmt_flash_id = pmt_flash_id;
+  out.flash_tpc_id = flash_tpc_id;
+  return out;
+}
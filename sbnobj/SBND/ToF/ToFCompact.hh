@@ -0,0 +1,47 @@
+#ifndef ToFCompact_hh_
+#define ToFCompact_hh_
+
+#include "sbnobj/SBND/CRT/CRTEnums.hh"
+#include "sbnobj/SBND/ToF/ToF.hh"
+
+#include <cstdint>
+#include <string>
+
+namespace sbnd::ToF{
+
+// Compact form of ToF: the CRT tagger is an enum and the ids are packed.
+// tof is pmt_time - crt_time [ns].
+struct ToFCompact {
+      float tof = -9999;
+      float crt_time = -9999;
+      float pmt_time = -9999;
+      int32_t crt_sp_id = -9999;
+      int32_t crt_trk_id = -9999;
+      int32_t pmt_hit_id = -9999;
+      int32_t pmt_flash_id = -9999;
+      int16_t flash_tpc_id = -9999;
+      int8_t crt_tagger = sbnd::crt::kUndefinedTagger;  // tagger of a space point
+      sbnd::crt::CRTTaggerMask crt_taggers = 0;         // taggers of a space point or track
+      bool frm_trk = false;
+      bool frm_hit = false;
+
+      ToFCompact() = default;
+      explicit ToFCompact(ToF const& tof);
+
+      sbnd::crt::CRTTagger Tagger() const { return static_cast<sbnd::crt::CRTTagger>(crt_tagger); }
+
+      ToF toToF() const;
+
+      // Times as sbn::TimeNs_t, invalid if not set (-9999) [ns]
+      sbn::TimeNs_t tofNs() const { return ToF::timeNs(tof); }
+      sbn::TimeNs_t crtTimeNs() const { return ToF::timeNs(crt_time); }
+      sbn::TimeNs_t pmtTimeNs() const { return ToF::timeNs(pmt_time); }
+};
+
+// Name of the tagger in ToF::crt_tagger ("N/A" for kUndefinedTagger), and back
+std::string TaggerName(sbnd::crt::CRTTagger tagger);
+sbnd::crt::CRTTagger TaggerFromName(std::string const& name);
+
+}
+
+#endif
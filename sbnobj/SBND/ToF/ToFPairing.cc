@@ -0,0 +1,75 @@
+#include "sbnobj/SBND/ToF/ToFPairing.hh"
+
+#include "cetlib_except/exception.h"
+
+#include <algorithm>
+
+sbnd::ToF::ToFPairing::ToFPairing(double minToF, double maxToF)
+  : fMinToF(minToF)
+  , fMaxToF(maxToF)
+{
+  if (!(minToF <= maxToF)) {
+    throw cet::exception("sbnd::ToF::ToFPairing")
+      << "Invalid time of flight window [ " << minToF << " ; " << maxToF << " ] ns.\n";
+  }
+}
+
+void sbnd::ToF::ToFPairing::AddSpacePoint(sbnd::crt::CRTSpacePoint const& sp, sbnd::crt::CRTTagger tagger, int32_t id) {
+  fCRT.push_back({ sp.Time(), id, -9999, static_cast<int8_t>(tagger), sbnd::crt::TaggerBit(tagger) });
+}
+
+void sbnd::ToF::ToFPairing::AddTrack(sbnd::crt::CRTTrack const& trk, int32_t id) {
+  fCRT.push_back({ trk.Time(), -9999, id, sbnd::crt::kUndefinedTagger, trk.TaggerMask() });
+}
+
+void sbnd::ToF::ToFPairing::AddFlash(double time, int32_t id, int16_t tpc_id) {
+  fPMT.push_back({ time, -9999, id, tpc_id });
+}
+
+void sbnd::ToF::ToFPairing::AddHit(double time, int32_t id) {
+  fPMT.push_back({ time, id, -9999, -9999 });
+}
+
+std::size_t sbnd::ToF::ToFPairing::Pair(std::vector<ToFCompact>& out) {
+  std::stable_sort(fCRT.begin(), fCRT.end(),
+    [](CRTObject const& a, CRTObject const& b){ return a.time < b.time; });
+  std::stable_sort(fPMT.begin(), fPMT.end(),
+    [](PMTObject const& a, PMTObject const& b){ return a.time < b.time; });
+
+  std::size_t const nBefore = out.size();
+  std::size_t first = 0; // first PMT object not too early for the current CRT one
+  for (CRTObject const& crt : fCRT) {
+    double const start = crt.time + fMinToF, stop = crt.time + fMaxToF;
+    while (first < fPMT.size() && fPMT[first].time < start) ++first;
+
+    for (std::size_t j = first; j < fPMT.size() && fPMT[j].time <= stop; ++j) {
+      PMTObject const& pmt = fPMT[j];
+      ToFCompact tof;
+      tof.tof = pmt.time - crt.time;
+      tof.crt_time = crt.time;
+      tof.pmt_time = pmt.time;
+      tof.crt_sp_id = crt.sp_id;
+      tof.crt_trk_id = crt.trk_id;
+      tof.pmt_hit_id = pmt.hit_id;
+      tof.pmt_flash_id = pmt.flash_id;
+      tof.flash_tpc_id = pmt.tpc_id;
+      tof.crt_tagger = crt.tagger;
+      tof.crt_taggers = crt.taggers;
+      tof.frm_trk = crt.trk_id != -9999;
+      tof.frm_hit = pmt.hit_id != -9999;
+      out.push_back(tof);
+    }
+  }
+  return out.size() - nBefore;
+}
+
+std::vector<sbnd::ToF::ToFCompact> sbnd::ToF::ToFPairing::Pair() {
+  std::vector<ToFCompact> out;
+  Pair(out);
+  return out;
+}
+
+void sbnd::ToF::ToFPairing::Clear() {
+  fCRT.clear();
+  fPMT.clear();
+}
@@ -0,0 +1,65 @@
+#ifndef ToFPairing_hh_
+#define ToFPairing_hh_
+
+#include "sbnobj/SBND/CRT/CRTSpacePoint.hh"
+#include "sbnobj/SBND/CRT/CRTTrack.hh"
+#include "sbnobj/SBND/ToF/ToFCompact.hh"
+
+#include <cstdint>
+#include <vector>
+
+namespace sbnd::ToF{
+
+// Pairs CRT objects (space points or tracks) with PMT objects (flashes or
+// hits) whose time of flight pmt_time - crt_time is in [ minToF, maxToF ].
+//
+// The objects of an event are added in any order, then Pair() sorts both
+// sides by time and sweeps them together, so that only the pairs in the
+// window are visited instead of all of them. All times are in [ns].
+class ToFPairing {
+public:
+
+      struct CRTObject {
+            double time;
+            int32_t sp_id;
+            int32_t trk_id;
+            int8_t tagger;
+            sbnd::crt::CRTTaggerMask taggers;
+      };
+
+      struct PMTObject {
+            double time;
+            int32_t hit_id;
+            int32_t flash_id;
+            int16_t tpc_id;
+      };
+
+      ToFPairing(double minToF, double maxToF);
+
+      void AddSpacePoint(sbnd::crt::CRTSpacePoint const& sp, sbnd::crt::CRTTagger tagger, int32_t id);
+      void AddTrack(sbnd::crt::CRTTrack const& trk, int32_t id);
+      void AddFlash(double time, int32_t id, int16_t tpc_id);
+      void AddHit(double time, int32_t id);
+
+      std::size_t NCRT() const { return fCRT.size(); }
+      std::size_t NPMT() const { return fPMT.size(); }
+
+      // appends the ToF of all the pairs in the window to out, by CRT time
+      // then PMT time; returns the number of pairs
+      std::size_t Pair(std::vector<ToFCompact>& out);
+      std::vector<ToFCompact> Pair();
+
+      // removes all the objects, keeping the window
+      void Clear();
+
+private:
+
+      double fMinToF;
+      double fMaxToF;
+      std::vector<CRTObject> fCRT;
+      std::vector<PMTObject> fPMT;
+};
+
+}
+
+#endif
@@ -1,6 +1,7 @@
 #include "canvas/Persistency/Common/Wrapper.h"
 #include "canvas/Persistency/Common/Assns.h"
 #include "sbnobj/SBND/ToF/ToF.hh"
+#include "sbnobj/SBND/ToF/ToFCompact.hh"
 #include <vector>
 #include <map>
 #include <utility>
@@ -1,6 +1,7 @@
 #include "canvas/Persistency/Common/Wrapper.h"
 #include "canvas/Persistency/Common/Assns.h"
 #include "sbnobj/SBND/Trigger/pmtTrigger.hh"
+#include "sbnobj/SBND/Trigger/pmtTriggerRunLength.hh"
 #include <vector>
 #include <map>
 #include <utility>
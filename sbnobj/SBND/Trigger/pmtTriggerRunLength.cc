@@ -0,0 +1,68 @@
+#include "sbnobj/SBND/Trigger/pmtTriggerRunLength.hh"
+
+#include "cetlib_except/exception.h"
+
+#include <algorithm>
+
+sbnd::comm::pmtTriggerRunLength::pmtTriggerRunLength(pmtTrigger const& trigger)
+  : nBins(trigger.numPassed.size())
+  , maxPMTs(trigger.maxPMTs)
+{
+  for (std::size_t bin = 0; bin < trigger.numPassed.size(); ++bin) {
+    int const n = trigger.numPassed[bin];
+    if (n < 0 || n > 255) {
+      throw cet::exception("sbnd::comm::pmtTriggerRunLength")
+        << "Multiplicity " << n << " of bin " << bin << " out of the [ 0, 255 ] range.\n";
+    }
+    if (!runValue.empty() && runValue.back() == n) continue;
+    runStart.push_back(bin);
+    runValue.push_back(n);
+  }
+}
+
+sbnd::comm::pmtTrigger sbnd::comm::pmtTriggerRunLength::toPmtTrigger() const {
+  pmtTrigger trigger;
+  trigger.maxPMTs = maxPMTs;
+  trigger.numPassed.reserve(nBins);
+  for (std::size_t run = 0; run < NRuns(); ++run)
+    trigger.numPassed.insert(trigger.numPassed.end(), RunEnd(run) - runStart[run], runValue[run]);
+  return trigger;
+}
+
+std::size_t sbnd::comm::pmtTriggerRunLength::RunOf(uint32_t bin) const {
+  return std::upper_bound(runStart.begin(), runStart.end(), bin) - runStart.begin() - 1;
+}
+
+uint8_t sbnd::comm::pmtTriggerRunLength::At(uint32_t bin) const {
+  return (bin < nBins)? runValue[RunOf(bin)]: 0;
+}
+
+uint8_t sbnd::comm::pmtTriggerRunLength::MaxInWindow(uint32_t first, uint32_t last) const {
+  last = std::min(last, nBins);
+  if (first >= last) return 0;
+
+  uint8_t maxValue = 0;
+  for (std::size_t run = RunOf(first); run < NRuns() && runStart[run] < last; ++run)
+    maxValue = std::max(maxValue, runValue[run]);
+  return maxValue;
+}
+
+uint32_t sbnd::comm::pmtTriggerRunLength::BinsAtLeast(uint8_t threshold, uint32_t first, uint32_t last) const {
+  last = std::min(last, nBins);
+  if (first >= last) return 0;
+
+  uint32_t count = 0;
+  for (std::size_t run = RunOf(first); run < NRuns() && runStart[run] < last; ++run) {
+    if (runValue[run] < threshold) continue;
+    count += std::min(RunEnd(run), last) - std::max(runStart[run], first);
+  }
+  return count;
+}
+
+uint32_t sbnd::comm::pmtTriggerRunLength::FirstAtLeast(uint8_t threshold, uint32_t from) const {
+  if (from >= nBins) return nBins;
+
+  for (std::size_t run = RunOf(from); run < NRuns(); ++run)
+    if (runValue[run] >= threshold) return std::max(runStart[run], from);
+  return nBins;
+}
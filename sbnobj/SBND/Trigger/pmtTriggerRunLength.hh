@@ -0,0 +1,53 @@
+#ifndef pmtTriggerRunLength_hh_
+#define pmtTriggerRunLength_hh_
+#include <cstdint>
+
+#include <cstddef>
+#include <vector>
+
+#include "sbnobj/SBND/Trigger/pmtTrigger.hh"
+
+namespace sbnd::comm {
+
+  // Run-length form of the pmtTrigger multiplicity series: run i covers the
+  // time bins [ runStart[i], runStart[i+1] [ (the last one up to nBins), all
+  // with multiplicity runValue[i]. Consecutive runs have different values.
+  struct pmtTriggerRunLength{
+
+    std::vector<uint32_t> runStart;
+    std::vector<uint8_t> runValue;
+    uint32_t nBins = 0;
+    int maxPMTs = 0;
+
+    pmtTriggerRunLength() {}
+
+    // multiplicities must be in [ 0, 255 ]
+    explicit pmtTriggerRunLength(pmtTrigger const& trigger);
+
+    pmtTrigger toPmtTrigger() const;
+
+    std::size_t NRuns() const { return runStart.size(); }
+    uint32_t RunEnd(std::size_t run) const
+      { return (run + 1 < runStart.size())? runStart[run + 1]: nBins; }
+
+    // multiplicity of the bin (0 beyond the series)
+    uint8_t At(uint32_t bin) const;
+
+    // largest multiplicity in the bins [ first, last [ (0 if none)
+    uint8_t MaxInWindow(uint32_t first, uint32_t last) const;
+
+    // number of bins in [ first, last [ with at least `threshold` PMTs
+    uint32_t BinsAtLeast(uint8_t threshold, uint32_t first, uint32_t last) const;
+    uint32_t BinsAtLeast(uint8_t threshold) const { return BinsAtLeast(threshold, 0, nBins); }
+
+    // first bin from `from` on with at least `threshold` PMTs (nBins if none)
+    uint32_t FirstAtLeast(uint8_t threshold, uint32_t from = 0) const;
+
+  private:
+    std::size_t RunOf(uint32_t bin) const; // run containing a bin < nBins
+
+  };
+
+} // namespace sbnd::comm
+
+#endif